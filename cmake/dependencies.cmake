@@ -110,6 +110,13 @@ find_package(Boost 1.65.0 REQUIRED
     thread
     )
 
+##########################
+#        RocksDB         #
+##########################
+if(USE_ROCKSDB)
+  find_package(RocksDB REQUIRED CONFIG)
+endif()
+
 ##########################
 #       benchmark        #
 ##########################
@@ -0,0 +1,155 @@
+#!/usr/bin/python3
+#
+# Copyright Soramitsu Co., Ltd. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Performance-regression harness over the test/benchmark targets.
+#
+# Runs every bm_* binary produced by a -DBENCHMARKING=ON build in
+# google-benchmark JSON mode, stores the results as the baseline for the
+# current git revision, and optionally compares them against a previously
+# recorded revision, failing with a readable diff when a benchmark slows
+# down beyond the threshold.
+#
+# Typical CI usage:
+#   housekeeping/benchmark-regression.py --build-dir build \
+#       --baseline-dir /var/iroha-benchmarks --against <last-release-sha>
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+
+def git_revision():
+    return subprocess.check_output(
+        ["git", "rev-parse", "HEAD"]).decode().strip()
+
+
+def discover_benchmarks(build_dir):
+    """bm_* binaries end up in <build>/benchmark_bin (see
+    test/benchmark/CMakeLists.txt); benchmark_example is a smoke test and
+    is skipped."""
+    bin_dir = os.path.join(build_dir, "benchmark_bin")
+    if not os.path.isdir(bin_dir):
+        sys.exit("no benchmark_bin in {}; "
+                 "configure with -DBENCHMARKING=ON".format(build_dir))
+    return sorted(
+        os.path.join(bin_dir, name)
+        for name in os.listdir(bin_dir)
+        if name.startswith("bm_")
+        and os.access(os.path.join(bin_dir, name), os.X_OK))
+
+
+def run_benchmarks(build_dir, out_dir, repetitions):
+    os.makedirs(out_dir, exist_ok=True)
+    for binary in discover_benchmarks(build_dir):
+        target = os.path.basename(binary)
+        out_file = os.path.join(out_dir, target + ".json")
+        print("running {}...".format(target))
+        subprocess.check_call([
+            binary,
+            "--benchmark_format=json",
+            "--benchmark_out={}".format(out_file),
+            "--benchmark_repetitions={}".format(repetitions),
+            "--benchmark_report_aggregates_only=true"
+            if repetitions > 1 else "--benchmark_report_aggregates_only=false",
+        ])
+
+
+def load_results(result_dir):
+    """benchmark name -> {metric: value}; with repetitions only the mean
+    aggregates are compared."""
+    results = {}
+    for name in sorted(os.listdir(result_dir)):
+        if not name.endswith(".json"):
+            continue
+        with open(os.path.join(result_dir, name)) as f:
+            report = json.load(f)
+        for bench in report.get("benchmarks", []):
+            if bench.get("aggregate_name", "mean") != "mean":
+                continue
+            key = "{}/{}".format(name[:-len(".json")],
+                                 bench["name"].replace("_mean", ""))
+            metrics = {"real_time": bench["real_time"]}
+            for rate in ("items_per_second", "bytes_per_second"):
+                if rate in bench:
+                    metrics[rate] = bench[rate]
+            results[key] = metrics
+    return results
+
+
+def compare(baseline, current, threshold):
+    """Returns the list of regressions; a benchmark regresses when its
+    time grows or its throughput drops by more than the threshold."""
+    regressions = []
+    for key, base_metrics in sorted(baseline.items()):
+        cur_metrics = current.get(key)
+        if cur_metrics is None:
+            print("  [gone]     {}".format(key))
+            continue
+        for metric, base_value in base_metrics.items():
+            cur_value = cur_metrics.get(metric)
+            if cur_value is None or base_value == 0:
+                continue
+            # for times growth is bad, for rates shrinkage is bad
+            if metric == "real_time":
+                change = cur_value / base_value - 1.0
+            else:
+                change = base_value / cur_value - 1.0
+            marker = "REGRESSED" if change > threshold else "ok"
+            print("  [{:9s}] {} {}: {:.6g} -> {:.6g} ({:+.1f}%)".format(
+                marker, key, metric, base_value, cur_value,
+                100 * (cur_value / base_value - 1.0)))
+            if change > threshold:
+                regressions.append((key, metric, base_value, cur_value))
+    for key in sorted(set(current) - set(baseline)):
+        print("  [new]      {}".format(key))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="run test/benchmark targets and compare against "
+                    "a recorded baseline")
+    parser.add_argument("--build-dir", required=True,
+                        help="cmake build directory with benchmark_bin")
+    parser.add_argument("--baseline-dir", required=True,
+                        help="directory keeping one result set per revision")
+    parser.add_argument("--against", metavar="REVISION",
+                        help="baseline revision to compare with; without it "
+                             "results are only recorded")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="tolerated relative slowdown (default 0.10)")
+    parser.add_argument("--repetitions", type=int, default=3,
+                        help="benchmark repetitions, compared by mean "
+                             "(default 3)")
+    args = parser.parse_args()
+
+    revision = git_revision()
+    out_dir = os.path.join(args.baseline_dir, revision)
+    run_benchmarks(args.build_dir, out_dir, args.repetitions)
+    print("results stored in {}".format(out_dir))
+
+    if not args.against:
+        return
+
+    baseline_dir = os.path.join(args.baseline_dir, args.against)
+    if not os.path.isdir(baseline_dir):
+        sys.exit("no recorded baseline for {}".format(args.against))
+
+    print("comparing {} against {} (threshold {:.0%})".format(
+        revision, args.against, args.threshold))
+    regressions = compare(load_results(baseline_dir),
+                          load_results(out_dir),
+                          args.threshold)
+    if regressions:
+        print("{} benchmark(s) regressed beyond the threshold"
+              .format(len(regressions)))
+        sys.exit(1)
+    print("no regressions")
+
+
+if __name__ == "__main__":
+    main()
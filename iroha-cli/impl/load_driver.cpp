@@ -0,0 +1,257 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "load_driver.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "builders/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "logger/logger.hpp"
+#include "network/impl/channel_factory.hpp"
+#include "torii/command_async_client.hpp"
+#include "torii/command_client.hpp"
+
+using namespace std::chrono;
+
+namespace {
+  /// every such transaction has its commit latency measured through a
+  /// status stream; the rest are fire-and-forget
+  constexpr size_t kLatencySampleEvery = 10;
+
+  /// sampled hashes waiting for their status stream; bounded so a slow
+  /// peer throttles sampling instead of growing the queue
+  constexpr size_t kMaxPendingSamples = 64;
+
+  std::unique_ptr<torii::CommandSyncClient::Service::StubInterface> makeStub(
+      const std::string &target_ip, int port) {
+    using namespace iroha::network;
+    static const auto kChannelParams = getDefaultChannelParams();
+    return createInsecureClient<torii::CommandSyncClient::Service>(
+        target_ip, port, *kChannelParams);
+  }
+
+  double percentile(const std::vector<double> &sorted, double quantile) {
+    if (sorted.empty()) {
+      return 0;
+    }
+    auto index = static_cast<size_t>(quantile * (sorted.size() - 1));
+    return sorted[index];
+  }
+}  // namespace
+
+namespace iroha_cli {
+
+  LoadDriver::LoadDriver(Config config, logger::LoggerPtr log)
+      : config_(std::move(config)), log_(std::move(log)) {}
+
+  int LoadDriver::run() {
+    if (config_.command == "transfer_asset"
+        and config_.dest_account_id.empty()) {
+      log_->error("transfer_asset workload needs --load_dest_account");
+      return EXIT_FAILURE;
+    }
+    if (config_.target_tps == 0 or config_.connections == 0
+        or config_.txs_per_list == 0 or config_.commands_per_tx == 0) {
+      log_->error("rate, connections and sizes must be positive");
+      return EXIT_FAILURE;
+    }
+
+    std::atomic<uint64_t> sent{0};
+    std::atomic<uint64_t> send_failures{0};
+    std::atomic<uint64_t> tx_seq{0};
+    std::atomic<bool> stop{false};
+
+    std::mutex latencies_mutex;
+    std::vector<double> latencies_ms;
+
+    struct Sample {
+      std::string hash;
+      steady_clock::time_point sent_at;
+    };
+    std::mutex samples_mutex;
+    std::condition_variable samples_cv;
+    std::deque<Sample> samples;
+
+    // all command setters return the same builder type, so one command is
+    // appended before the loop to fix the compile-time field mask
+    auto add_command = [&](auto builder) {
+      if (config_.command == "add_asset_quantity") {
+        return builder.addAssetQuantity(config_.asset_id, "1.0");
+      }
+      if (config_.command == "transfer_asset") {
+        return builder.transferAsset(config_.creator_account_id,
+                                     config_.dest_account_id,
+                                     config_.asset_id,
+                                     "load",
+                                     "1.0");
+      }
+      return builder.setAccountDetail(config_.creator_account_id,
+                                      "load_key",
+                                      std::to_string(tx_seq.fetch_add(1)));
+    };
+
+    auto make_transaction = [&] {
+      auto builder =
+          add_command(shared_model::proto::TransactionBuilder()
+                          .creatorAccountId(config_.creator_account_id)
+                          .createdTime(iroha::time::now())
+                          .quorum(1));
+      for (size_t i = 1; i < config_.commands_per_tx; ++i) {
+        builder = add_command(builder);
+      }
+      return builder.build().signAndAddSignature(config_.keypair).finish();
+    };
+
+    // the status streams run beside the senders, so the latency of the
+    // sampled transactions includes everything up to the final status
+    auto status_worker = [&] {
+      torii::CommandSyncClient client(
+          makeStub(config_.peer_ip, config_.torii_port), log_);
+      while (true) {
+        Sample sample;
+        {
+          std::unique_lock<std::mutex> lock(samples_mutex);
+          samples_cv.wait(
+              lock, [&] { return not samples.empty() or stop.load(); });
+          if (samples.empty()) {
+            return;
+          }
+          sample = std::move(samples.front());
+          samples.pop_front();
+        }
+        iroha::protocol::TxStatusRequest request;
+        request.set_tx_hash(sample.hash);
+        std::vector<iroha::protocol::ToriiResponse> responses;
+        client.StatusStream(request, responses);
+        if (not responses.empty()
+            and responses.back().tx_status()
+                == iroha::protocol::TxStatus::COMMITTED) {
+          auto latency =
+              duration_cast<duration<double, std::milli>>(
+                  steady_clock::now() - sample.sent_at)
+                  .count();
+          std::lock_guard<std::mutex> lock(latencies_mutex);
+          latencies_ms.push_back(latency);
+        }
+      }
+    };
+
+    // every sender multiplexes its submissions on this one shared
+    // channel: HTTP/2 streams provide the concurrency, and the pipelined
+    // calls keep the senders pacing instead of blocking on round-trips
+    auto async_client = std::make_unique<torii::CommandAsyncClient>(
+        makeStub(config_.peer_ip, config_.torii_port), log_);
+
+    auto send_worker = [&] {
+      const auto period = duration<double>(
+          static_cast<double>(config_.connections * config_.txs_per_list)
+          / config_.target_tps);
+      auto next_send = steady_clock::now();
+      uint64_t sent_here = 0;
+
+      while (not stop.load()) {
+        std::this_thread::sleep_until(next_send);
+        next_send += duration_cast<steady_clock::duration>(period);
+
+        iroha::protocol::TxList tx_list;
+        auto new_samples = std::make_shared<std::vector<Sample>>();
+        for (size_t i = 0; i < config_.txs_per_list; ++i) {
+          auto transaction = make_transaction();
+          if (++sent_here % kLatencySampleEvery == 0) {
+            new_samples->push_back(
+                Sample{shared_model::crypto::toBinaryString(transaction.hash()),
+                       steady_clock::now()});
+          }
+          *tx_list.add_transactions() = transaction.getTransport();
+        }
+
+        auto on_sent = [&, new_samples](grpc::Status status,
+                                        size_t transactions) {
+          if (not status.ok()) {
+            send_failures += transactions;
+            return;
+          }
+          sent += transactions;
+          std::lock_guard<std::mutex> lock(samples_mutex);
+          // the samples are registered once, by whichever chunk of the
+          // submission completes successfully first
+          for (auto &sample : *new_samples) {
+            if (samples.size() < kMaxPendingSamples) {
+              samples.push_back(std::move(sample));
+              samples_cv.notify_one();
+            }
+          }
+          new_samples->clear();
+        };
+
+        if (config_.txs_per_list == 1) {
+          async_client->Torii(
+              tx_list.transactions(0),
+              [on_sent](grpc::Status status) { on_sent(status, 1); });
+        } else {
+          async_client->ListTorii(tx_list, on_sent);
+        }
+      }
+    };
+
+    log_->info(
+        "starting load: {} tps for {}s over {} connection(s), {} command(s) "
+        "per transaction, {} transaction(s) per submission",
+        config_.target_tps,
+        config_.duration_seconds,
+        config_.connections,
+        config_.commands_per_tx,
+        config_.txs_per_list);
+
+    auto started_at = steady_clock::now();
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < config_.connections; ++i) {
+      workers.emplace_back(send_worker);
+      workers.emplace_back(status_worker);
+    }
+
+    std::this_thread::sleep_for(seconds(config_.duration_seconds));
+    stop = true;
+    samples_cv.notify_all();
+    for (auto &worker : workers) {
+      worker.join();
+    }
+    // drains the in-flight submissions, so the counters below are final
+    async_client.reset();
+    auto elapsed =
+        duration_cast<duration<double>>(steady_clock::now() - started_at)
+            .count();
+
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    log_->info("sent {} transactions in {:.1f}s ({:.1f} tps), {} failed sends",
+               sent.load(),
+               elapsed,
+               sent.load() / elapsed,
+               send_failures.load());
+    if (latencies_ms.empty()) {
+      log_->warn(
+          "no sampled transaction was committed; latency is unavailable");
+    } else {
+      log_->info(
+          "commit latency over {} samples: p50 {:.0f}ms, p90 {:.0f}ms, "
+          "p99 {:.0f}ms, max {:.0f}ms",
+          latencies_ms.size(),
+          percentile(latencies_ms, 0.50),
+          percentile(latencies_ms, 0.90),
+          percentile(latencies_ms, 0.99),
+          latencies_ms.back());
+    }
+    return sent.load() == 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+
+}  // namespace iroha_cli
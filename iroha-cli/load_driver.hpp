@@ -0,0 +1,64 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHACLI_LOAD_DRIVER_HPP
+#define IROHACLI_LOAD_DRIVER_HPP
+
+#include <string>
+
+#include "cryptography/keypair.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha_cli {
+
+  /**
+   * Sustained-load driver: generates signed transactions at a target rate,
+   * submits them through several parallel torii connections and reports the
+   * achieved TPS together with end-to-end commit latency percentiles taken
+   * from a sample of the sent transactions.
+   */
+  class LoadDriver {
+   public:
+    struct Config {
+      std::string peer_ip;
+      int torii_port;
+
+      /// account the transactions are created and signed by
+      std::string creator_account_id;
+      shared_model::crypto::Keypair keypair;
+
+      /// target send rate over all connections, transactions per second
+      size_t target_tps;
+      size_t duration_seconds;
+      /// parallel torii connections, each paced at target_tps / connections
+      size_t connections;
+
+      /// commands packed into every transaction
+      size_t commands_per_tx;
+      /// transactions submitted per ListTorii call; 1 means plain Torii
+      size_t txs_per_list;
+
+      /// workload: "set_account_detail", "add_asset_quantity" or
+      /// "transfer_asset"
+      std::string command;
+      std::string asset_id;
+      /// recipient for transfer_asset
+      std::string dest_account_id;
+    };
+
+    LoadDriver(Config config, logger::LoggerPtr log);
+
+    /// runs the load until the configured duration elapses and prints the
+    /// report; returns a main()-style exit code
+    int run();
+
+   private:
+    Config config_;
+    logger::LoggerPtr log_;
+  };
+
+}  // namespace iroha_cli
+
+#endif  // IROHACLI_LOAD_DRIVER_HPP
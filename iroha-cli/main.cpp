@@ -18,6 +18,7 @@
 #include "crypto/keys_manager_impl.hpp"
 #include "grpc_response_handler.hpp"
 #include "interactive/interactive_cli.hpp"
+#include "load_driver.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "model/converters/json_block_factory.hpp"
@@ -58,6 +59,27 @@ DEFINE_string(peers_address,
               "",
               "File with peers address for new Iroha network");
 
+// Sustained-load driver
+DEFINE_bool(load_test,
+            false,
+            "Generate and send transactions at a target rate; uses "
+            "--account_name and --key_path for the creator keypair");
+DEFINE_uint64(load_tps, 100, "Target transactions per second");
+DEFINE_uint64(load_duration, 30, "Load duration in seconds");
+DEFINE_uint64(load_connections, 4, "Parallel torii connections");
+DEFINE_uint64(load_commands_per_tx, 1, "Commands packed into a transaction");
+DEFINE_uint64(load_txs_per_list,
+              1,
+              "Transactions per submission; above 1 uses ListTorii");
+DEFINE_string(load_command,
+              "set_account_detail",
+              "Workload command: set_account_detail, add_asset_quantity or "
+              "transfer_asset");
+DEFINE_string(load_asset_id, "coin#test", "Asset for the asset workloads");
+DEFINE_string(load_dest_account,
+              "",
+              "Recipient account for the transfer_asset workload");
+
 // Run iroha-cli in interactive mode
 DEFINE_bool(interactive, true, "Run iroha-cli in interactive mode");
 
@@ -208,6 +230,38 @@ int main(int argc, char *argv[]) {
       }
     }
   }
+  // Run the sustained-load driver
+  else if (FLAGS_load_test) {
+    if (FLAGS_account_name.empty()) {
+      logger->error("Specify your account name");
+      return EXIT_FAILURE;
+    }
+    fs::path path(FLAGS_key_path);
+    iroha::KeysManagerImpl manager((path / FLAGS_account_name).string(),
+                                   keys_manager_log);
+    auto keypair = FLAGS_pass_phrase.size() != 0
+        ? manager.loadKeys(FLAGS_pass_phrase)
+        : manager.loadKeys(boost::none);
+    if (auto e = iroha::expected::resultToOptionalError(keypair)) {
+      logger->error("Keypair error: {}.", e.value());
+      return EXIT_FAILURE;
+    }
+    iroha_cli::LoadDriver driver(
+        iroha_cli::LoadDriver::Config{FLAGS_peer_ip,
+                                      FLAGS_torii_port,
+                                      FLAGS_account_name,
+                                      keypair.assumeValue(),
+                                      FLAGS_load_tps,
+                                      FLAGS_load_duration,
+                                      FLAGS_load_connections,
+                                      FLAGS_load_commands_per_tx,
+                                      FLAGS_load_txs_per_list,
+                                      FLAGS_load_command,
+                                      FLAGS_load_asset_id,
+                                      FLAGS_load_dest_account},
+        log_manager->getChild("LoadDriver")->getLogger());
+    return driver.run();
+  }
   // Run iroha-cli in interactive mode
   else if (FLAGS_interactive) {
     if (FLAGS_account_name.empty()) {
@@ -7,10 +7,12 @@
 #define IROHA_BLOCK_QUERY_HPP
 
 #include <optional>
+#include <vector>
 
 #include "ametsuchi/tx_cache_response.hpp"
 #include "common/result_fwd.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
 
 namespace iroha {
 
@@ -55,6 +57,18 @@ namespace iroha {
        */
       virtual void reloadBlockstore() = 0;
 
+      /**
+       * Retrieve committed transactions with the given hashes. Hashes are
+       * grouped by the block containing them, so each block is deserialized
+       * at most once regardless of how many of its transactions were asked
+       * for.
+       * @param tx_hashes - hashes of transactions to retrieve
+       * @return found transactions; hashes missing from the chain are skipped
+       */
+      virtual std::vector<std::unique_ptr<shared_model::interface::Transaction>>
+      getTransactions(
+          const std::vector<shared_model::crypto::Hash> &tx_hashes) = 0;
+
       /**
        * Synchronously checks whether transaction with given hash is present in
        * any block
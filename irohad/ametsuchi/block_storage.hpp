@@ -6,10 +6,11 @@
 #ifndef IROHA_BLOCK_STORAGE_HPP
 #define IROHA_BLOCK_STORAGE_HPP
 
-#include <boost/optional/optional_fwd.hpp>
+#include <boost/optional/optional.hpp>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
 
 #include "common/result_fwd.hpp"
 #include "interfaces/iroha_internal/block.hpp"
@@ -36,6 +37,20 @@ namespace iroha {
       virtual boost::optional<std::unique_ptr<shared_model::interface::Block>>
       fetch(shared_model::interface::types::HeightType height) const = 0;
 
+      /**
+       * Get the stored serialized form of the block with given height,
+       * when the backing storage can provide it without building a block
+       * object. The format is the one of BlockJsonConverter. Fast paths
+       * parse it straight into a transport, so the shared_model
+       * construction and its re-serialization are skipped.
+       * @return serialized block if cheaply available, boost::none
+       * otherwise - the caller falls back to fetch()
+       */
+      virtual boost::optional<std::string> fetchRaw(
+          shared_model::interface::types::HeightType height) const {
+        return boost::none;
+      }
+
       /**
        * Returns the size of the storage
        */
@@ -6,9 +6,16 @@
 #ifndef IROHA_AMETSUCHI_COMMAND_EXECUTOR_HPP
 #define IROHA_AMETSUCHI_COMMAND_EXECUTOR_HPP
 
+#include <boost/optional.hpp>
 #include "common/result.hpp"
 #include "interfaces/common_objects/types.hpp"
 
+namespace iroha {
+  namespace protocol {
+    class Command;
+  }  // namespace protocol
+}  // namespace iroha
+
 namespace shared_model {
   namespace interface {
     class Command;
@@ -51,6 +58,24 @@ namespace iroha {
           const std::string &tx_hash,
           shared_model::interface::types::CommandIndexType cmd_index,
           bool do_validation) = 0;
+
+      /**
+       * Execute a command given in its raw protobuf form, binding the
+       * fields without constructing the shared model wrappers. Backends
+       * implement it for the command types dominating typical blocks.
+       * @return the execution result, or boost::none when this command
+       * type has no direct path and the caller must fall back to the
+       * shared model overload
+       */
+      virtual boost::optional<CommandResult> executeRaw(
+          const iroha::protocol::Command &,
+          const shared_model::interface::types::AccountIdType
+              & /* creator_account_id */,
+          const std::string & /* tx_hash */,
+          shared_model::interface::types::CommandIndexType /* cmd_index */,
+          bool /* do_validation */) {
+        return boost::none;
+      }
     };
   }  // namespace ametsuchi
 }  // namespace iroha
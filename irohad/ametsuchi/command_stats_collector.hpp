@@ -0,0 +1,71 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_AMETSUCHI_COMMAND_STATS_COLLECTOR_HPP
+#define IROHA_AMETSUCHI_COMMAND_STATS_COLLECTOR_HPP
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace shared_model {
+  namespace interface {
+    class Command;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace metrics {
+    class Counter;
+    class Histogram;
+  }  // namespace metrics
+
+  namespace ametsuchi {
+
+    /**
+     * Aggregates command execution timings per command type. Cumulative
+     * counts and duration histograms are published through the metrics
+     * registry; per-block aggregates are taken with takeSummary() and
+     * logged by the block apply path, so a slow block can be attributed
+     * to the commands which made it slow.
+     */
+    class CommandStatsCollector {
+     public:
+      /// account one command execution
+      void record(const shared_model::interface::Command &command,
+                  std::chrono::steady_clock::duration duration);
+
+      /// same, for callers which know the command type name without
+      /// having a shared model wrapper at hand
+      void record(const std::string &command_name,
+                  std::chrono::steady_clock::duration duration);
+
+      /**
+       * Human-readable per-type summary of everything recorded since the
+       * previous call, most expensive type first; empty string if nothing
+       * was recorded. Resets the per-block aggregates, the cumulative
+       * metrics are unaffected.
+       */
+      std::string takeSummary();
+
+     private:
+      struct TypeStats {
+        uint64_t count{0};
+        double total_us{0};
+        double max_us{0};
+        std::shared_ptr<metrics::Counter> executed_total;
+        std::shared_ptr<metrics::Histogram> execution_duration;
+      };
+
+      std::mutex mutex_;
+      std::map<std::string, TypeStats> stats_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_AMETSUCHI_COMMAND_STATS_COLLECTOR_HPP
@@ -0,0 +1,96 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/async_block_indexer.hpp"
+
+#include <soci/soci.h>
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/postgres_indexer.hpp"
+#include "common/thread_affinity.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    AsyncBlockIndexer::AsyncBlockIndexer(
+        std::shared_ptr<soci::connection_pool> pool,
+        shared_model::interface::types::HeightType indexed_height,
+        logger::LoggerPtr log)
+        : log_(std::move(log)),
+          pool_(std::move(pool)),
+          indexed_height_(indexed_height),
+          worker_([this] { run(); }) {}
+
+    AsyncBlockIndexer::~AsyncBlockIndexer() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      worker_cv_.notify_one();
+      worker_.join();
+    }
+
+    void AsyncBlockIndexer::enqueue(
+        std::shared_ptr<const shared_model::interface::Block> block) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(block));
+      }
+      worker_cv_.notify_one();
+    }
+
+    shared_model::interface::types::HeightType
+    AsyncBlockIndexer::indexedHeight() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return indexed_height_;
+    }
+
+    bool AsyncBlockIndexer::waitUntilCaughtUp(
+        std::chrono::milliseconds timeout) const {
+      std::unique_lock<std::mutex> lock(mutex_);
+      return watermark_cv_.wait_for(lock, timeout, [this] {
+        return queue_.empty() and not busy_;
+      });
+    }
+
+    void AsyncBlockIndexer::run() {
+      affinity::pinThisThread(affinity::stage::kStorage);
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        worker_cv_.wait(lock, [this] { return stop_ or not queue_.empty(); });
+        if (queue_.empty()) {
+          break;
+        }
+        auto block = std::move(queue_.front());
+        queue_.pop_front();
+        busy_ = true;
+        lock.unlock();
+
+        auto height = block->height();
+        try {
+          // the session is leased per block, so that an idle indexer does
+          // not occupy a pool slot
+          soci::session sql(*pool_);
+          PostgresBlockIndex block_index(std::make_unique<PostgresIndexer>(sql),
+                                         log_);
+          block_index.indexPositions(*block);
+        } catch (std::exception const &e) {
+          // matches the synchronous behaviour: index errors are logged and
+          // the block stays committed
+          log_->error("Failed to index block {}: {}", height, e.what());
+        }
+
+        lock.lock();
+        busy_ = false;
+        indexed_height_ = height;
+        if (queue_.empty()) {
+          watermark_cv_.notify_all();
+        }
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
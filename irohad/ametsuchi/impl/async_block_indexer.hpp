@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_BLOCK_INDEXER_HPP
+#define IROHA_ASYNC_BLOCK_INDEXER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace soci {
+  class connection_pool;
+}
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Single background thread which builds the transaction position indices
+     * of committed blocks, taking those inserts out of the commit
+     * transaction. The committed and rejected hash indices guarding against
+     * replay are not handled here - they stay atomic with the WSV changes.
+     * The indexed watermark tells up to which height the position indices
+     * are complete; history queries wait for it to catch up with the
+     * committed height before reading tx_positions.
+     */
+    class AsyncBlockIndexer {
+     public:
+      /**
+       * @param pool - pool to lease index writing sessions from
+       * @param indexed_height - height up to which the index is complete
+       * @param log - component logger
+       */
+      AsyncBlockIndexer(std::shared_ptr<soci::connection_pool> pool,
+                        shared_model::interface::types::HeightType
+                            indexed_height,
+                        logger::LoggerPtr log);
+
+      AsyncBlockIndexer(const AsyncBlockIndexer &) = delete;
+      AsyncBlockIndexer &operator=(const AsyncBlockIndexer &) = delete;
+
+      /// Waits for pending index writes and stops the worker.
+      ~AsyncBlockIndexer();
+
+      /// Schedule indexing of a committed block.
+      void enqueue(
+          std::shared_ptr<const shared_model::interface::Block> block);
+
+      /// @return height up to which the position indices are complete
+      shared_model::interface::types::HeightType indexedHeight() const;
+
+      /**
+       * Wait until every block enqueued so far has been indexed.
+       * @param timeout - longest time to wait
+       * @return true if the index caught up, false on timeout
+       */
+      bool waitUntilCaughtUp(std::chrono::milliseconds timeout) const;
+
+     private:
+      void run();
+
+      logger::LoggerPtr log_;
+      std::shared_ptr<soci::connection_pool> pool_;
+      mutable std::mutex mutex_;
+      std::condition_variable worker_cv_;
+      mutable std::condition_variable watermark_cv_;
+      std::deque<std::shared_ptr<const shared_model::interface::Block>>
+          queue_;
+      bool busy_{false};
+      bool stop_{false};
+      shared_model::interface::types::HeightType indexed_height_;
+      std::thread worker_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_BLOCK_INDEXER_HPP
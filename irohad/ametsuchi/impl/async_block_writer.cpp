@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/async_block_writer.hpp"
+
+#include <fmt/core.h>
+#include "ametsuchi/block_storage.hpp"
+#include "common/thread_affinity.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    AsyncBlockWriter::AsyncBlockWriter(logger::LoggerPtr log)
+        : log_(std::move(log)), worker_([this] { run(); }) {}
+
+    AsyncBlockWriter::~AsyncBlockWriter() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      worker_cv_.notify_one();
+      worker_.join();
+    }
+
+    void AsyncBlockWriter::enqueue(
+        std::shared_ptr<const shared_model::interface::Block> block,
+        BlockStorage &target) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(Job{std::move(block), &target});
+      }
+      worker_cv_.notify_one();
+    }
+
+    expected::Result<void, std::string> AsyncBlockWriter::sync() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      sync_cv_.wait(lock, [this] { return queue_.empty() and not busy_; });
+      if (first_error_) {
+        auto error = std::move(*first_error_);
+        first_error_ = boost::none;
+        return expected::makeError(std::move(error));
+      }
+      return {};
+    }
+
+    void AsyncBlockWriter::run() {
+      affinity::pinThisThread(affinity::stage::kStorage);
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        worker_cv_.wait(lock,
+                        [this] { return stop_ or not queue_.empty(); });
+        if (queue_.empty()) {
+          break;
+        }
+        auto job = std::move(queue_.front());
+        queue_.pop_front();
+        busy_ = true;
+        lock.unlock();
+
+        boost::optional<std::string> error;
+        try {
+          if (not job.target->insert(job.block)) {
+            error = fmt::format("Failed to insert block {}", *job.block);
+          }
+        } catch (std::exception const &e) {
+          error = fmt::format("Failed to insert block: {}", e.what());
+        }
+        if (error) {
+          log_->error("{}", *error);
+        }
+
+        lock.lock();
+        busy_ = false;
+        if (error and not first_error_) {
+          first_error_ = std::move(error);
+        }
+        if (queue_.empty()) {
+          sync_cv_.notify_all();
+        }
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_BLOCK_WRITER_HPP
+#define IROHA_ASYNC_BLOCK_WRITER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <boost/optional.hpp>
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+    class BlockStorage;
+
+    /**
+     * Single background thread which performs block storage inserts, taking
+     * block serialization and disk flushes off the committing thread.
+     * Consumers which need the blocks to be durable call sync(), which acts
+     * as a barrier: it returns once every insert enqueued before it has
+     * completed, reporting the first failure if any occurred.
+     */
+    class AsyncBlockWriter {
+     public:
+      explicit AsyncBlockWriter(logger::LoggerPtr log);
+
+      AsyncBlockWriter(const AsyncBlockWriter &) = delete;
+      AsyncBlockWriter &operator=(const AsyncBlockWriter &) = delete;
+
+      /// Waits for pending writes and stops the worker.
+      ~AsyncBlockWriter();
+
+      /**
+       * Schedule insertion of a block into the target storage.
+       * @param block - block to insert
+       * @param target - destination storage; must stay alive until the next
+       * sync() returns
+       */
+      void enqueue(std::shared_ptr<const shared_model::interface::Block> block,
+                   BlockStorage &target);
+
+      /**
+       * Durability barrier. Blocks until every previously enqueued insert
+       * has completed.
+       * @return error of the first failed insert, if any
+       */
+      expected::Result<void, std::string> sync();
+
+     private:
+      struct Job {
+        std::shared_ptr<const shared_model::interface::Block> block;
+        BlockStorage *target;
+      };
+
+      void run();
+
+      logger::LoggerPtr log_;
+      std::mutex mutex_;
+      std::condition_variable worker_cv_;
+      std::condition_variable sync_cv_;
+      std::deque<Job> queue_;
+      bool busy_{false};
+      bool stop_{false};
+      boost::optional<std::string> first_error_;
+      std::thread worker_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_BLOCK_WRITER_HPP
@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/async_commit_notifier.hpp"
+
+#include "common/thread_affinity.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    AsyncCommitNotifier::AsyncCommitNotifier(PublishFunction publish,
+                                             logger::LoggerPtr log)
+        : log_(std::move(log)),
+          publish_(std::move(publish)),
+          worker_([this] { run(); }) {}
+
+    AsyncCommitNotifier::~AsyncCommitNotifier() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      worker_cv_.notify_one();
+      worker_.join();
+    }
+
+    void AsyncCommitNotifier::enqueue(
+        std::shared_ptr<const shared_model::interface::Block> block) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(block));
+      }
+      worker_cv_.notify_one();
+    }
+
+    bool AsyncCommitNotifier::waitUntilDelivered(
+        std::chrono::milliseconds timeout) const {
+      std::unique_lock<std::mutex> lock(mutex_);
+      return delivered_cv_.wait_for(lock, timeout, [this] {
+        return queue_.empty() and not busy_;
+      });
+    }
+
+    void AsyncCommitNotifier::run() {
+      affinity::pinThisThread(affinity::stage::kStorage);
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        worker_cv_.wait(lock, [this] { return stop_ or not queue_.empty(); });
+        if (queue_.empty()) {
+          break;
+        }
+        auto block = std::move(queue_.front());
+        queue_.pop_front();
+        busy_ = true;
+        lock.unlock();
+
+        try {
+          publish_(std::move(block));
+        } catch (std::exception const &e) {
+          // a throwing subscriber must not take down the delivery of the
+          // following blocks
+          log_->error("commit notification delivery failed: {}", e.what());
+        }
+
+        lock.lock();
+        busy_ = false;
+        if (queue_.empty()) {
+          delivered_cv_.notify_all();
+        }
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
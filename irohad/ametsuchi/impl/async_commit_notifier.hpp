@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_COMMIT_NOTIFIER_HPP
+#define IROHA_ASYNC_COMMIT_NOTIFIER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "logger/logger_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Single background thread which delivers committed blocks to the
+     * on_commit subscribers (status cache, pending transactions cleanup,
+     * recent blocks cache, query watermark), taking their work off the
+     * committing thread. The blocks of one commit are delivered in their
+     * chain order, and the subscribers of one block still run one after
+     * another - their mutual ordering is part of the on_commit contract -
+     * but the committing thread returns as soon as the block is enqueued.
+     */
+    class AsyncCommitNotifier {
+     public:
+      using PublishFunction = std::function<void(
+          std::shared_ptr<const shared_model::interface::Block>)>;
+
+      /**
+       * @param publish - delivers one block to the subscribers; called
+       * only from the worker thread
+       * @param log - component logger
+       */
+      AsyncCommitNotifier(PublishFunction publish, logger::LoggerPtr log);
+
+      AsyncCommitNotifier(const AsyncCommitNotifier &) = delete;
+      AsyncCommitNotifier &operator=(const AsyncCommitNotifier &) = delete;
+
+      /// Delivers the pending notifications and stops the worker.
+      ~AsyncCommitNotifier();
+
+      /// Schedule delivery of a committed block to the subscribers.
+      void enqueue(
+          std::shared_ptr<const shared_model::interface::Block> block);
+
+      /**
+       * Wait until every block enqueued so far has been delivered.
+       * @param timeout - longest time to wait
+       * @return true if the deliveries completed, false on timeout
+       */
+      bool waitUntilDelivered(std::chrono::milliseconds timeout) const;
+
+     private:
+      void run();
+
+      logger::LoggerPtr log_;
+      PublishFunction publish_;
+      mutable std::mutex mutex_;
+      std::condition_variable worker_cv_;
+      mutable std::condition_variable delivered_cv_;
+      std::deque<std::shared_ptr<const shared_model::interface::Block>>
+          queue_;
+      bool busy_{false};
+      bool stop_{false};
+      std::thread worker_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_COMMIT_NOTIFIER_HPP
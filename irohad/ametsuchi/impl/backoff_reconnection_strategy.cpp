@@ -0,0 +1,115 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/backoff_reconnection_strategy.hpp"
+
+#include <algorithm>
+#include <thread>
+
+using namespace iroha::ametsuchi;
+
+// ------------- | ExponentialBackoffReconnectionStrategy::Coordinator | ------
+
+bool ExponentialBackoffReconnectionStrategy::Coordinator::startProbeOrWait(
+    std::chrono::milliseconds wait_limit) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (not probe_in_flight_) {
+    probe_in_flight_ = true;
+    return true;
+  }
+  // the verdict of the prober may only arrive with its next query, so the
+  // wait is bounded; either way the caller retries its own connection
+  // once without becoming a prober itself
+  cv_.wait_for(lock, wait_limit, [this] { return not probe_in_flight_; });
+  return false;
+}
+
+void ExponentialBackoffReconnectionStrategy::Coordinator::endProbe() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    probe_in_flight_ = false;
+  }
+  cv_.notify_all();
+}
+
+// ------------------ | ExponentialBackoffReconnectionStrategy | --------------
+
+ExponentialBackoffReconnectionStrategy::ExponentialBackoffReconnectionStrategy(
+    size_t number_of_reconnections,
+    std::chrono::milliseconds base_delay,
+    std::chrono::milliseconds max_delay,
+    std::shared_ptr<Coordinator> coordinator)
+    : max_number_of_reconnections_(number_of_reconnections),
+      base_delay_(base_delay),
+      max_delay_(max_delay),
+      coordinator_(std::move(coordinator)) {}
+
+std::chrono::milliseconds
+ExponentialBackoffReconnectionStrategy::delayBeforeAttempt(size_t attempt) {
+  if (attempt <= 1) {
+    // the first attempt is immediate: a blip is cheapest to discover now
+    return std::chrono::milliseconds::zero();
+  }
+  auto delay = base_delay_;
+  for (size_t i = 2; i < attempt and delay < max_delay_; ++i) {
+    delay *= 2;
+  }
+  delay = std::min(delay, max_delay_);
+  // uniform jitter in [delay / 2, delay] decorrelates the sessions which
+  // became probers at the same moment
+  std::uniform_int_distribution<std::chrono::milliseconds::rep> jitter(
+      delay.count() / 2, delay.count());
+  return std::chrono::milliseconds(jitter(random_engine_));
+}
+
+bool ExponentialBackoffReconnectionStrategy::canReconnect() {
+  if (current_number_of_reconnections_ >= max_number_of_reconnections_) {
+    // this session gives up; let another one probe the database
+    if (is_prober_) {
+      is_prober_ = false;
+      coordinator_->endProbe();
+    }
+    return false;
+  }
+  if (not is_prober_) {
+    // either becomes the prober, or has waited for a probe verdict and
+    // retries its own connection once right away
+    is_prober_ = coordinator_->startProbeOrWait(max_delay_);
+  }
+  if (is_prober_) {
+    std::this_thread::sleep_for(
+        delayBeforeAttempt(current_number_of_reconnections_ + 1));
+  }
+  ++current_number_of_reconnections_;
+  return true;
+}
+
+void ExponentialBackoffReconnectionStrategy::reset() {
+  if (is_prober_) {
+    is_prober_ = false;
+    coordinator_->endProbe();
+  }
+  current_number_of_reconnections_ = 0;
+}
+
+// -------------- | ExponentialBackoffReconnectionStrategyFactory | -----------
+
+ExponentialBackoffReconnectionStrategyFactory::
+    ExponentialBackoffReconnectionStrategyFactory(
+        size_t number_of_reconnections,
+        std::chrono::milliseconds base_delay,
+        std::chrono::milliseconds max_delay)
+    : max_number_of_reconnections_(number_of_reconnections),
+      base_delay_(base_delay),
+      max_delay_(max_delay),
+      coordinator_(
+          std::make_shared<
+              ExponentialBackoffReconnectionStrategy::Coordinator>()) {}
+
+std::unique_ptr<ReconnectionStrategy>
+ExponentialBackoffReconnectionStrategyFactory::create() const {
+  return std::make_unique<ExponentialBackoffReconnectionStrategy>(
+      max_number_of_reconnections_, base_delay_, max_delay_, coordinator_);
+}
@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/reconnection_strategy.hpp"
+
+#ifndef IROHA_BACKOFF_RECONNECTION_STRATEGY_HPP
+#define IROHA_BACKOFF_RECONNECTION_STRATEGY_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+
+namespace iroha {
+  namespace ametsuchi {
+    /**
+     * Strategy which limits the number of attempts like
+     * KTimesReconnectionStrategy, but waits an exponentially growing,
+     * jittered delay before every retry, and coordinates the sessions of
+     * one connection pool: a database outage is probed by a single session
+     * while the rest wait for its verdict, so recovery from a blip costs
+     * one round trip per session instead of a pool-wide retry storm.
+     */
+    class ExponentialBackoffReconnectionStrategy : public ReconnectionStrategy {
+     public:
+      /// shared between the strategies of one pool, serializes the probing
+      class Coordinator {
+       public:
+        /**
+         * Take the prober role, or wait until the probe in flight ends.
+         * @param wait_limit - upper bound on waiting for another prober
+         * @return true when the caller became the prober
+         */
+        bool startProbeOrWait(std::chrono::milliseconds wait_limit);
+
+        /// release the prober role and wake the waiting sessions
+        void endProbe();
+
+       private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool probe_in_flight_{false};
+      };
+
+      /**
+       * @param number_of_reconnections - number of attempts for reconnection
+       * @param base_delay - delay before the second attempt; doubled for
+       * every further attempt
+       * @param max_delay - upper bound for the delay between attempts
+       * @param coordinator - probe coordination shared within the pool
+       */
+      ExponentialBackoffReconnectionStrategy(
+          size_t number_of_reconnections,
+          std::chrono::milliseconds base_delay,
+          std::chrono::milliseconds max_delay,
+          std::shared_ptr<Coordinator> coordinator);
+
+      ExponentialBackoffReconnectionStrategy(
+          const ExponentialBackoffReconnectionStrategy &) = delete;
+      ExponentialBackoffReconnectionStrategy &operator=(
+          const ExponentialBackoffReconnectionStrategy &) = delete;
+
+      bool canReconnect() override;
+      void reset() override;
+
+     private:
+      /// jittered exponential delay before the given (1-based) attempt
+      std::chrono::milliseconds delayBeforeAttempt(size_t attempt);
+
+      const size_t max_number_of_reconnections_;
+      const std::chrono::milliseconds base_delay_;
+      const std::chrono::milliseconds max_delay_;
+      std::shared_ptr<Coordinator> coordinator_;
+      size_t current_number_of_reconnections_{0};
+      bool is_prober_{false};
+      std::mt19937 random_engine_{std::random_device{}()};
+    };
+
+    class ExponentialBackoffReconnectionStrategyFactory
+        : public ReconnectionStrategyFactory {
+     public:
+      ExponentialBackoffReconnectionStrategyFactory(
+          size_t number_of_reconnections,
+          std::chrono::milliseconds base_delay,
+          std::chrono::milliseconds max_delay);
+
+      std::unique_ptr<ReconnectionStrategy> create() const override;
+
+     private:
+      const size_t max_number_of_reconnections_;
+      const std::chrono::milliseconds base_delay_;
+      const std::chrono::milliseconds max_delay_;
+      std::shared_ptr<ExponentialBackoffReconnectionStrategy::Coordinator>
+          coordinator_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BACKOFF_RECONNECTION_STRATEGY_HPP
@@ -28,6 +28,21 @@ namespace iroha {
        * @param block to be indexed
        */
       virtual void index(const shared_model::interface::Block &) = 0;
+
+      /**
+       * Store only the committed and rejected transaction hashes of a block.
+       * This part guards against transaction replay and must stay atomic
+       * with the WSV changes.
+       * @param block to be indexed
+       */
+      virtual void indexStatuses(const shared_model::interface::Block &) = 0;
+
+      /**
+       * Build only the transaction position indices of a block, used by
+       * history queries. May be run outside of the commit transaction.
+       * @param block to be indexed
+       */
+      virtual void indexPositions(const shared_model::interface::Block &) = 0;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
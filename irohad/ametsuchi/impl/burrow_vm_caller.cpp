@@ -30,9 +30,10 @@ BurrowVmCaller::call(
       : static_cast<const char *>(nullptr);
   const char *input_raw =
       const_cast<char *>(static_cast<std::string_view const &>(input).data());
-  std::string nonce = tx_hash;
-  const char *nonce_raw =
-      const_cast<char *>(nonce.append(numToHexstring(cmd_index)).c_str());
+  std::string nonce;
+  nonce.reserve(tx_hash.size() + sizeof(cmd_index) * 2);
+  nonce.append(tx_hash).append(numToHexstring(cmd_index));
+  const char *nonce_raw = nonce.c_str();
   auto raw_result = VmCall(input_raw,
                            caller.c_str(),
                            callee_raw,
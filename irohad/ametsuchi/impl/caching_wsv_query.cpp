@@ -0,0 +1,96 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/caching_wsv_query.hpp"
+
+#include "ametsuchi/impl/tx_rw_set.hpp"
+#include "ametsuchi/ledger_state.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    CachingWsvQuery::CachingWsvQuery(std::shared_ptr<WsvQuery> source,
+                                     logger::LoggerPtr log)
+        : source_(std::move(source)), log_(std::move(log)) {}
+
+    boost::optional<std::vector<std::string>> CachingWsvQuery::getSignatories(
+        const shared_model::interface::types::AccountIdType &account_id) {
+      {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = signatories_cache_.find(account_id);
+        if (it != signatories_cache_.end()) {
+          return boost::make_optional(it->second);
+        }
+      }
+      auto signatories = source_->getSignatories(account_id);
+      if (signatories) {
+        std::lock_guard<std::shared_mutex> lock(mutex_);
+        signatories_cache_[account_id] = *signatories;
+      }
+      return signatories;
+    }
+
+    boost::optional<std::vector<std::shared_ptr<shared_model::interface::Peer>>>
+    CachingWsvQuery::getPeers() {
+      {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        if (peers_cache_) {
+          return peers_cache_;
+        }
+      }
+      auto peers = source_->getPeers();
+      if (peers) {
+        std::lock_guard<std::shared_mutex> lock(mutex_);
+        peers_cache_ = peers;
+      }
+      return peers;
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::Peer>>
+    CachingWsvQuery::getPeerByPublicKey(
+        shared_model::interface::types::PublicKeyHexStringView public_key) {
+      // peer-by-key lookups are rare enough to serve from the source
+      return source_->getPeerByPublicKey(public_key);
+    }
+
+    iroha::expected::Result<iroha::TopBlockInfo, std::string>
+    CachingWsvQuery::getTopBlockInfo() const {
+      // must always reflect the latest commit, never cached
+      return source_->getTopBlockInfo();
+    }
+
+    void CachingWsvQuery::onBlockCommitted(
+        const shared_model::interface::Block &block) {
+      for (const auto &tx : block.transactions()) {
+        auto rw_set = extractRwSet(tx);
+        if (rw_set.global) {
+          log_->debug("global command in block {}, dropping whole cache",
+                      block.height());
+          invalidateAll();
+          return;
+        }
+        for (const auto &account : rw_set.accounts) {
+          invalidateAccount(account);
+        }
+      }
+    }
+
+    void CachingWsvQuery::invalidateAccount(
+        const shared_model::interface::types::AccountIdType &account_id) {
+      std::lock_guard<std::shared_mutex> lock(mutex_);
+      signatories_cache_.erase(account_id);
+    }
+
+    void CachingWsvQuery::invalidateAll() {
+      std::lock_guard<std::shared_mutex> lock(mutex_);
+      signatories_cache_.clear();
+      peers_cache_ = boost::none;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
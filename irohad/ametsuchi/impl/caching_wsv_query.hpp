@@ -0,0 +1,82 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CACHING_WSV_QUERY_HPP
+#define IROHA_CACHING_WSV_QUERY_HPP
+
+#include "ametsuchi/wsv_query.hpp"
+
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "logger/logger_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Read-through cache over another WsvQuery. Signatory lists and the peer
+     * set are kept in memory after the first lookup, so repeated stateful
+     * validation of hot accounts does not hit the database.
+     *
+     * Consistency is maintained per block: onBlockCommitted() drops the
+     * entries touched by the block's write set (and everything on a global
+     * command), so cached data never outlives the state it was read from.
+     */
+    class CachingWsvQuery : public WsvQuery {
+     public:
+      CachingWsvQuery(std::shared_ptr<WsvQuery> source, logger::LoggerPtr log);
+
+      boost::optional<std::vector<std::string>> getSignatories(
+          const shared_model::interface::types::AccountIdType &account_id)
+          override;
+
+      boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::Peer>>>
+      getPeers() override;
+
+      boost::optional<std::shared_ptr<shared_model::interface::Peer>>
+      getPeerByPublicKey(shared_model::interface::types::PublicKeyHexStringView
+                             public_key) override;
+
+      iroha::expected::Result<iroha::TopBlockInfo, std::string>
+      getTopBlockInfo() const override;
+
+      /**
+       * Invalidate the cache entries touched by a committed block.
+       */
+      void onBlockCommitted(const shared_model::interface::Block &block);
+
+      /// Drop cached signatories of the given account.
+      void invalidateAccount(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      /// Drop everything cached.
+      void invalidateAll();
+
+     private:
+      std::shared_ptr<WsvQuery> source_;
+      logger::LoggerPtr log_;
+
+      mutable std::shared_mutex mutex_;
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         std::vector<std::string>>
+          signatories_cache_;
+      boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::Peer>>>
+          peers_cache_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_CACHING_WSV_QUERY_HPP
@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/command_stats_collector.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <vector>
+
+#include <fmt/core.h>
+#include <boost/core/demangle.hpp>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/command.hpp"
+#include "metrics/metrics_registry.hpp"
+
+using namespace iroha::ametsuchi;
+
+namespace {
+  /// "shared_model::interface::AddPeer" -> "AddPeer"
+  std::string commandName(const shared_model::interface::Command &command) {
+    auto name = iroha::visit_in_place(command.get(), [](const auto &specific) {
+      return boost::core::demangle(typeid(specific).name());
+    });
+    auto pos = name.rfind(':');
+    return pos == std::string::npos ? name : name.substr(pos + 1);
+  }
+
+  /// "AddPeer" -> "add_peer", for use in metric names
+  std::string metricSuffix(const std::string &name) {
+    std::string suffix;
+    for (auto c : name) {
+      if (std::isupper(c)) {
+        if (not suffix.empty()) {
+          suffix.push_back('_');
+        }
+        suffix.push_back(std::tolower(c));
+      } else {
+        suffix.push_back(c);
+      }
+    }
+    return suffix;
+  }
+}  // namespace
+
+void CommandStatsCollector::record(
+    const shared_model::interface::Command &command,
+    std::chrono::steady_clock::duration duration) {
+  record(commandName(command), duration);
+}
+
+void CommandStatsCollector::record(
+    const std::string &name, std::chrono::steady_clock::duration duration) {
+  auto duration_us =
+      std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+          duration)
+          .count();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &entry = stats_[name];
+  if (not entry.executed_total) {
+    auto suffix = metricSuffix(name);
+    entry.executed_total = metrics::MetricsRegistry::instance().makeCounter(
+        "iroha_commands_executed_total_" + suffix,
+        "Number of executed " + name + " commands");
+    entry.execution_duration =
+        metrics::MetricsRegistry::instance().makeHistogram(
+            "iroha_command_execution_seconds_" + suffix,
+            "Execution time of " + name + " commands",
+            metrics::Histogram::defaultDurationBounds());
+  }
+  ++entry.count;
+  entry.total_us += duration_us;
+  entry.max_us = std::max(entry.max_us, duration_us);
+  entry.executed_total->inc();
+  entry.execution_duration->observe(duration_us / 1e6);
+}
+
+std::string CommandStatsCollector::takeSummary() {
+  std::vector<std::pair<std::string, TypeStats *>> ordered;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &entry : stats_) {
+    if (entry.second.count != 0) {
+      ordered.emplace_back(entry.first, &entry.second);
+    }
+  }
+  std::sort(ordered.begin(), ordered.end(), [](auto &lhs, auto &rhs) {
+    return lhs.second->total_us > rhs.second->total_us;
+  });
+
+  std::string summary;
+  for (auto &entry : ordered) {
+    if (not summary.empty()) {
+      summary += ", ";
+    }
+    summary += fmt::format("{}: {} in {:.1f}ms (max {:.1f}ms)",
+                           entry.first,
+                           entry.second->count,
+                           entry.second->total_us / 1000,
+                           entry.second->max_us / 1000);
+    entry.second->count = 0;
+    entry.second->total_us = 0;
+    entry.second->max_us = 0;
+  }
+  return summary;
+}
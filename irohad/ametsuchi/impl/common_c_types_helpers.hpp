@@ -9,6 +9,7 @@
 #include "ametsuchi/impl/common_c_types.h"
 
 #include <cstddef>
+#include <cstdlib>
 #include <cstring>
 #include <optional>
 #include <string_view>
@@ -25,8 +26,10 @@ namespace iroha {
   }
 
   inline void toCharBuffer(Iroha_CharBuffer &buf, const std::string &string) {
-    buf.data = new char[string.length() + 1];
-    strncpy(buf.data, string.c_str(), string.length());
+    // the receiving go code releases the buffer with free(), so it must be
+    // allocated with malloc, not new[]
+    buf.data = static_cast<char *>(std::malloc(string.length() + 1));
+    std::memcpy(buf.data, string.data(), string.length());
     buf.data[string.length()] = 0;
     buf.size = string.length();
   }
@@ -47,6 +50,7 @@ namespace iroha {
   inline std::vector<std::string_view> charBufferArrayToStringViewVector(
       Iroha_CharBufferArray const &arr) {
     std::vector<std::string_view> result;
+    result.reserve(arr.size);
     Iroha_CharBuffer const *const end = arr.data + arr.size;
     for (Iroha_CharBuffer *ptr = arr.data; ptr < end; ++ptr) {
       result.emplace_back(charBufferToStringView(*ptr));
@@ -11,6 +11,7 @@
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/algorithm/find_if.hpp>
 #include <ciso646>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -22,6 +23,9 @@
 #ifdef _WIN32
 #include <windows.h>
 #include <fileapi.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
 using namespace iroha::ametsuchi;
@@ -29,8 +33,13 @@ using Identifier = FlatFile::Identifier;
 using BlockIdCollectionType = FlatFile::BlockIdCollectionType;
 
 const std::string FlatFile::kTempFileExtension = ".tmp";
+const std::string FlatFile::kManifestFileName = "manifest";
 const std::regex FlatFile::kBlockFilenameRegex = std::regex("[0-9]{16}");
 
+namespace {
+  constexpr char kManifestMagic[8] = {'i', 'r', 'b', 's', 'm', 'a', 'n', '1'};
+}
+
 // ----------| public API |----------
 
 std::string FlatFile::id_to_name(Identifier id) {
@@ -52,7 +61,9 @@ boost::optional<Identifier> FlatFile::name_to_id(const std::string &name) {
 }
 
 iroha::expected::Result<std::unique_ptr<FlatFile>, std::string>
-FlatFile::create(const std::string &path, logger::LoggerPtr log) {
+FlatFile::create(const std::string &path,
+                 logger::LoggerPtr log,
+                 FlatFileSyncPolicy sync_policy) {
   boost::system::error_code err;
   if (not boost::filesystem::is_directory(path, err)
       and not boost::filesystem::create_directory(path, err)) {
@@ -60,7 +71,8 @@ FlatFile::create(const std::string &path, logger::LoggerPtr log) {
         "Cannot create storage dir '{}': {}", path, err.message());
   }
 
-  return std::make_unique<FlatFile>(path, private_tag{}, std::move(log));
+  return std::make_unique<FlatFile>(
+      path, sync_policy, private_tag{}, std::move(log));
 }
 
 bool FlatFile::add(Identifier id, const Bytes &block) {
@@ -104,13 +116,15 @@ bool FlatFile::add(Identifier id, const Bytes &block) {
     return false;
   }
 
+  if (sync_policy_.group_blocks <= 1) {
 #ifdef _WIN32
-  if (not FlushFileBuffers(file->handle())) {
+    if (not FlushFileBuffers(file->handle())) {
 #else
-  if (fsync(file->handle())) {
+    if (fsync(file->handle())) {
 #endif
-    log_->warn("Cannot fsync file by index {}", id);
-    return false;
+      log_->warn("Cannot fsync file by index {}", id);
+      return false;
+    }
   }
 
   boost::system::error_code error_code;
@@ -122,9 +136,64 @@ bool FlatFile::add(Identifier id, const Bytes &block) {
   }
 
   available_blocks_.insert(id);
+  updateManifest();
+
+  if (sync_policy_.group_blocks > 1) {
+    // group commit: the file stays in the page cache until the size or
+    // time trigger fires, so a group of appends costs one barrier
+    pending_sync_.push_back(id);
+    const auto now = std::chrono::steady_clock::now();
+    if (pending_sync_.size() >= sync_policy_.group_blocks
+        or (sync_policy_.group_interval.count() > 0
+            and now - last_sync_ >= sync_policy_.group_interval)) {
+      sync();
+    }
+  }
   return true;
 }
 
+bool FlatFile::sync() {
+  last_sync_ = std::chrono::steady_clock::now();
+  if (pending_sync_.empty()) {
+    return true;
+  }
+  bool success = true;
+  for (auto id : pending_sync_) {
+    const auto file_name =
+        (boost::filesystem::path{dump_dir_} / id_to_name(id)).string();
+    try {
+      boost::iostreams::file_descriptor_source file{file_name,
+                                                    std::ios::binary};
+#ifdef _WIN32
+      if (not FlushFileBuffers(file.handle())) {
+#else
+      if (fsync(file.handle())) {
+#endif
+        log_->warn("Cannot fsync file by index {}", id);
+        success = false;
+      }
+    } catch (const std::exception &e) {
+      log_->warn("Cannot open file by index {} for fsync: {}", id, e.what());
+      success = false;
+    }
+  }
+#ifndef _WIN32
+  // the renames become durable with the directory entry flush
+  const int dir_fd = ::open(dump_dir_.c_str(), O_RDONLY);
+  if (dir_fd < 0 or ::fsync(dir_fd)) {
+    log_->warn("Cannot fsync block store directory {}", dump_dir_);
+    success = false;
+  }
+  if (dir_fd >= 0) {
+    ::close(dir_fd);
+  }
+#endif
+  if (success) {
+    pending_sync_.clear();
+  }
+  return success;
+}
+
 boost::optional<FlatFile::Bytes> FlatFile::get(Identifier id) const {
   const auto filename =
       boost::filesystem::path{dump_dir_} / FlatFile::id_to_name(id);
@@ -136,6 +205,21 @@ boost::optional<FlatFile::Bytes> FlatFile::get(Identifier id) const {
       iroha::readBinaryFile(filename.string()));
 }
 
+boost::optional<FlatFile::MappedBytes> FlatFile::getView(Identifier id) const {
+  const auto filename =
+      boost::filesystem::path{dump_dir_} / FlatFile::id_to_name(id);
+  if (not boost::filesystem::exists(filename)) {
+    log_->info("getView({}) file not found", id);
+    return boost::none;
+  }
+  try {
+    return boost::make_optional(MappedBytes{filename.string()});
+  } catch (const std::exception &e) {
+    log_->warn("getView({}) cannot map file: {}", id, e.what());
+    return boost::none;
+  }
+}
+
 std::string FlatFile::directory() const {
   return dump_dir_;
 }
@@ -160,11 +244,18 @@ void FlatFile::reload() {
       boost::filesystem::remove(it->path());
     }
   }
+  rewriteManifest();
 }
 
 void FlatFile::dropAll() {
+  // the manifest is removed with the rest of the contents; unmap it first
+  manifest_ = nullptr;
+  if (manifest_file_.is_open()) {
+    manifest_file_.close();
+  }
   iroha::remove_dir_contents(dump_dir_, log_);
   available_blocks_.clear();
+  rewriteManifest();
 }
 
 const BlockIdCollectionType &FlatFile::blockIdentifiers() const {
@@ -174,8 +265,121 @@ const BlockIdCollectionType &FlatFile::blockIdentifiers() const {
 // ----------| private API |----------
 
 FlatFile::FlatFile(std::string path,
+                   FlatFileSyncPolicy sync_policy,
                    FlatFile::private_tag,
                    logger::LoggerPtr log)
-    : dump_dir_(std::move(path)), log_{std::move(log)} {
-  reload();
+    : dump_dir_(std::move(path)),
+      sync_policy_(sync_policy),
+      last_sync_(std::chrono::steady_clock::now()),
+      log_{std::move(log)} {
+  if (not loadFromManifest()) {
+    reload();
+  }
+}
+
+FlatFile::~FlatFile() {
+  if (not pending_sync_.empty()) {
+    sync();
+  }
+}
+
+bool FlatFile::loadFromManifest() {
+  namespace fs = boost::filesystem;
+
+  const auto manifest_path = fs::path{dump_dir_} / kManifestFileName;
+  boost::system::error_code ec;
+  if (not fs::exists(manifest_path, ec)
+      or fs::file_size(manifest_path, ec) != sizeof(ManifestLayout)) {
+    return false;
+  }
+  try {
+    boost::iostreams::mapped_file_params params{manifest_path.string()};
+    params.flags = boost::iostreams::mapped_file::readwrite;
+    manifest_file_.open(params);
+  } catch (const std::exception &e) {
+    log_->warn("cannot map block store manifest: {}", e.what());
+    return false;
+  }
+  manifest_ = reinterpret_cast<ManifestLayout *>(manifest_file_.data());
+
+  const auto give_up = [this] {
+    manifest_ = nullptr;
+    manifest_file_.close();
+    return false;
+  };
+  if (std::memcmp(manifest_->magic, kManifestMagic, sizeof(kManifestMagic))
+      != 0) {
+    return give_up();
+  }
+  const auto block_exists = [this](Identifier id) {
+    boost::system::error_code ec;
+    return boost::filesystem::exists(
+        boost::filesystem::path{dump_dir_} / id_to_name(id), ec);
+  };
+  if (manifest_->count == 0) {
+    // an empty manifest is trusted only while the first block is absent
+    return block_exists(1) ? give_up() : true;
+  }
+  if (manifest_->count != manifest_->last_id - manifest_->first_id + 1) {
+    // the set had gaps, it cannot be reconstructed from the extents
+    return give_up();
+  }
+  const auto first = static_cast<Identifier>(manifest_->first_id);
+  auto last = static_cast<Identifier>(manifest_->last_id);
+  if (not block_exists(first) or not block_exists(last)) {
+    return give_up();
+  }
+  // an append renames the block file before touching the manifest, so
+  // after a crash the manifest can lag behind; roll the tail forward
+  while (block_exists(last + 1)) {
+    ++last;
+  }
+  for (auto id = first; id <= last; ++id) {
+    available_blocks_.insert(available_blocks_.end(), id);
+  }
+  updateManifest();
+  return true;
+}
+
+void FlatFile::rewriteManifest() {
+  manifest_ = nullptr;
+  if (manifest_file_.is_open()) {
+    manifest_file_.close();
+  }
+  const auto manifest_path =
+      (boost::filesystem::path{dump_dir_} / kManifestFileName).string();
+  try {
+    boost::iostreams::mapped_file_params params{manifest_path};
+    params.flags = boost::iostreams::mapped_file::readwrite;
+    boost::system::error_code ec;
+    if (not boost::filesystem::exists(manifest_path, ec)
+        or boost::filesystem::file_size(manifest_path, ec)
+            != sizeof(ManifestLayout)) {
+      params.new_file_size = sizeof(ManifestLayout);
+    }
+    manifest_file_.open(params);
+  } catch (const std::exception &e) {
+    // storage keeps working without the manifest, the next startup
+    // falls back to the directory scan
+    log_->warn("cannot create block store manifest: {}", e.what());
+    return;
+  }
+  manifest_ = reinterpret_cast<ManifestLayout *>(manifest_file_.data());
+  std::memcpy(manifest_->magic, kManifestMagic, sizeof(kManifestMagic));
+  updateManifest();
+}
+
+void FlatFile::updateManifest() {
+  if (not manifest_) {
+    return;
+  }
+  if (available_blocks_.empty()) {
+    manifest_->first_id = 0;
+    manifest_->last_id = 0;
+    manifest_->count = 0;
+  } else {
+    manifest_->first_id = *available_blocks_.begin();
+    manifest_->last_id = *available_blocks_.rbegin();
+    manifest_->count = available_blocks_.size();
+  }
 }
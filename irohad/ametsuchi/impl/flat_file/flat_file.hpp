@@ -6,10 +6,15 @@
 #ifndef IROHA_FLAT_FILE_HPP
 #define IROHA_FLAT_FILE_HPP
 
+#include <chrono>
 #include <memory>
 #include <regex>
 #include <set>
+#include <string_view>
+#include <vector>
 
+#include <boost/iostreams/device/mapped_file.hpp>
+#include "ametsuchi/impl/flat_file/flat_file_sync_policy.hpp"
 #include "ametsuchi/key_value_storage.hpp"
 #include "common/result_fwd.hpp"
 #include "logger/logger_fwd.hpp"
@@ -36,6 +41,8 @@ namespace iroha {
 
       static const std::string kTempFileExtension;
 
+      static const std::string kManifestFileName;
+
       static const std::regex kBlockFilenameRegex;
 
       /**
@@ -63,15 +70,45 @@ namespace iroha {
        * Create storage in paths
        * @param path - target path for creating
        * @param log - logger
+       * @param sync_policy - durability policy, per-block fsync by default
        * @return created storage
        */
       static iroha::expected::Result<std::unique_ptr<FlatFile>, std::string>
-      create(const std::string &path, logger::LoggerPtr log);
+      create(const std::string &path,
+             logger::LoggerPtr log,
+             FlatFileSyncPolicy sync_policy = {});
+
+      /**
+       * Read-only, memory-mapped view of a stored blob. The bytes stay in
+       * the page cache and are never copied to the heap; the view keeps the
+       * mapping alive for its own lifetime.
+       */
+      class MappedBytes {
+       public:
+        explicit MappedBytes(const std::string &filename)
+            : source_(filename) {}
+
+        std::string_view view() const {
+          return {source_.data(), source_.size()};
+        }
+
+       private:
+        boost::iostreams::mapped_file_source source_;
+      };
 
       bool add(Identifier id, const Bytes &blob) override;
 
       boost::optional<Bytes> get(Identifier id) const override;
 
+      /**
+       * Get a zero-copy view of the data associated with id. Prefer this to
+       * get() on read paths which only parse the bytes, e.g. serving chain
+       * sync, to avoid double-buffering block files through the heap.
+       * @param id - reference key
+       * @return mmap-backed view, if the blob exists and can be mapped
+       */
+      boost::optional<MappedBytes> getView(Identifier id) const;
+
       std::string directory() const override;
 
       Identifier last_id() const override;
@@ -85,6 +122,17 @@ namespace iroha {
        */
       const BlockIdCollectionType &blockIdentifiers() const;
 
+      /**
+       * Durability barrier: fsync every block appended since the last
+       * barrier and the directory entry renames. Under a group commit
+       * policy a caller which must acknowledge durability - e.g. before
+       * reporting the block as committed - invokes this instead of
+       * waiting for the size or time trigger. A no-op under the
+       * per-block policy.
+       * @return true when all pending blocks reached the disk
+       */
+      bool sync();
+
       // ----------| modify operations |----------
 
       FlatFile(const FlatFile &rhs) = delete;
@@ -100,13 +148,47 @@ namespace iroha {
       /**
        * Create storage in path
        * @param path - folder of storage
+       * @param sync_policy - durability policy
        * @param log to print progress
        */
       FlatFile(std::string path,
+               FlatFileSyncPolicy sync_policy,
                FlatFile::private_tag,
                logger::LoggerPtr log);
 
      private:
+      /**
+       * Fixed-size, memory-mapped summary of the storage contents kept
+       * next to the block files. It makes startup a single small file
+       * read instead of listing a directory with one file per block; the
+       * full directory scan of reload() stays as the repair path when the
+       * manifest is absent or does not match the files.
+       */
+      struct ManifestLayout {
+        char magic[8];
+        uint64_t first_id;
+        uint64_t last_id;
+        /// number of stored blocks; differs from the extent of the
+        /// [first_id, last_id] range when the set has gaps, in which case
+        /// the manifest cannot reconstruct it and a scan is needed
+        uint64_t count;
+      };
+
+      /**
+       * Try to restore the available block set from the manifest.
+       * An append updates the manifest after the block file is renamed in
+       * place, so after a crash it can lag behind; the missing tail is
+       * rolled forward by probing the next ids.
+       * @return true on success, false when a full scan is required
+       */
+      bool loadFromManifest();
+
+      /// (re)create the manifest file reflecting available_blocks_
+      void rewriteManifest();
+
+      /// bring the mapped manifest up to date with available_blocks_
+      void updateManifest();
+
       /**
        * Folder of storage
        */
@@ -117,10 +199,26 @@ namespace iroha {
        */
       BlockIdCollectionType available_blocks_;
 
+      /**
+       * Durability policy of add()
+       */
+      const FlatFileSyncPolicy sync_policy_;
+
+      /// blocks appended since the last durability barrier
+      std::vector<Identifier> pending_sync_;
+
+      /// time of the last durability barrier
+      std::chrono::steady_clock::time_point last_sync_;
+
+      boost::iostreams::mapped_file manifest_file_;
+
+      ManifestLayout *manifest_{nullptr};
+
       logger::LoggerPtr log_;
 
      public:
-      ~FlatFile() = default;
+      /// flushes the blocks still awaiting a durability barrier
+      ~FlatFile();
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,37 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_FLAT_FILE_SYNC_POLICY_HPP
+#define IROHA_FLAT_FILE_SYNC_POLICY_HPP
+
+#include <chrono>
+#include <cstddef>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Durability policy of the flat file block store. With the default
+     * settings every appended block is fsynced before the append is
+     * acknowledged. Raising group_blocks above one enables group commit:
+     * appended files stay buffered until the configured number of blocks
+     * or the configured time has accumulated, then one barrier fsyncs
+     * them all, trading a bounded window of re-syncable tail blocks for
+     * one disk flush per group instead of per block.
+     */
+    struct FlatFileSyncPolicy {
+      /// number of appended blocks fsynced with one barrier;
+      /// 1 means per-block fsync
+      size_t group_blocks{1};
+
+      /// longest time appended blocks may stay without a barrier;
+      /// zero disables the time trigger
+      std::chrono::milliseconds group_interval{0};
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_FLAT_FILE_SYNC_POLICY_HPP
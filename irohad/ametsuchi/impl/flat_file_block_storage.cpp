@@ -6,6 +6,11 @@
 #include "ametsuchi/impl/flat_file_block_storage.hpp"
 
 #include <boost/filesystem.hpp>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
 
 #include "backend/protobuf/block.hpp"
 #include "common/byteutils.hpp"
@@ -13,20 +18,54 @@
 
 using namespace iroha::ametsuchi;
 
+namespace {
+  /// gzip magic bytes distinguishing compressed blobs from plain JSON
+  bool isCompressed(std::string_view bytes) {
+    return bytes.size() >= 2 and static_cast<uint8_t>(bytes[0]) == 0x1f
+        and static_cast<uint8_t>(bytes[1]) == 0x8b;
+  }
+
+  iroha::ametsuchi::KeyValueStorage::Bytes compress(const std::string &json) {
+    iroha::ametsuchi::KeyValueStorage::Bytes compressed;
+    boost::iostreams::filtering_ostream stream;
+    stream.push(boost::iostreams::gzip_compressor());
+    stream.push(boost::iostreams::back_inserter(compressed));
+    stream.write(json.data(), json.size());
+    boost::iostreams::close(stream);
+    return compressed;
+  }
+
+  /// stream-decompress a mapped blob without materializing the compressed
+  /// bytes on the heap
+  std::string decompress(std::string_view bytes) {
+    std::string json;
+    boost::iostreams::filtering_istream stream;
+    stream.push(boost::iostreams::gzip_decompressor());
+    stream.push(boost::iostreams::array_source(bytes.data(), bytes.size()));
+    boost::iostreams::copy(stream,
+                           boost::iostreams::back_inserter(json));
+    return json;
+  }
+}  // namespace
+
 FlatFileBlockStorage::FlatFileBlockStorage(
     std::unique_ptr<FlatFile> flat_file,
     std::shared_ptr<shared_model::interface::BlockJsonConverter> json_converter,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    bool compress_on_write)
     : flat_file_storage_(std::move(flat_file)),
       json_converter_(std::move(json_converter)),
-      log_(std::move(log)) {}
+      log_(std::move(log)),
+      compress_on_write_(compress_on_write) {}
 
 bool FlatFileBlockStorage::insert(
     std::shared_ptr<const shared_model::interface::Block> block) {
   return json_converter_->serialize(*block).match(
       [&](const auto &block_json) {
         return flat_file_storage_->add(block->height(),
-                                       stringToBytes(block_json.value));
+                                       compress_on_write_
+                                           ? compress(block_json.value)
+                                           : stringToBytes(block_json.value));
       },
       [this](const auto &error) {
         log_->warn("Error while block serialization: {}", error.error);
@@ -34,15 +73,38 @@ bool FlatFileBlockStorage::insert(
       });
 }
 
+boost::optional<std::string> FlatFileBlockStorage::readStoredJson(
+    shared_model::interface::types::HeightType height) const {
+  // map the block file instead of reading it to avoid buffering the bytes
+  // through the heap twice
+  auto storage_block = flat_file_storage_->getView(height);
+  if (not storage_block) {
+    return boost::none;
+  }
+
+  auto bytes = storage_block->view();
+  try {
+    return isCompressed(bytes) ? decompress(bytes) : std::string{bytes};
+  } catch (const std::exception &e) {
+    log_->warn("Error while block decompression: {}", e.what());
+    return boost::none;
+  }
+}
+
+boost::optional<std::string> FlatFileBlockStorage::fetchRaw(
+    shared_model::interface::types::HeightType height) const {
+  return readStoredJson(height);
+}
+
 boost::optional<std::unique_ptr<shared_model::interface::Block>>
 FlatFileBlockStorage::fetch(
     shared_model::interface::types::HeightType height) const {
-  auto storage_block = flat_file_storage_->get(height);
-  if (not storage_block) {
+  auto block_json = readStoredJson(height);
+  if (not block_json) {
     return boost::none;
   }
 
-  return json_converter_->deserialize(bytesToString(*storage_block))
+  return json_converter_->deserialize(*block_json)
       .match(
           [&](auto &&block) {
             return boost::make_optional<
@@ -16,11 +16,18 @@ namespace iroha {
   namespace ametsuchi {
     class FlatFileBlockStorage : public BlockStorage {
      public:
+      /**
+       * @param compress_on_write - store new blocks gzip-compressed. Reads
+       * are transparent either way: fetch() detects compressed blobs by
+       * their magic bytes, so compressed and plain blocks can coexist in
+       * one storage directory and old chains keep working.
+       */
       FlatFileBlockStorage(
           std::unique_ptr<FlatFile> flat_file,
           std::shared_ptr<shared_model::interface::BlockJsonConverter>
               json_converter,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          bool compress_on_write = false);
 
       bool insert(
           std::shared_ptr<const shared_model::interface::Block> block) override;
@@ -28,6 +35,9 @@ namespace iroha {
       boost::optional<std::unique_ptr<shared_model::interface::Block>> fetch(
           shared_model::interface::types::HeightType height) const override;
 
+      boost::optional<std::string> fetchRaw(
+          shared_model::interface::types::HeightType height) const override;
+
       size_t size() const override;
 
       void reload() override;
@@ -38,10 +48,15 @@ namespace iroha {
           FunctionType function) const override;
 
      private:
+      /// read the stored block JSON, decompressing it when needed
+      boost::optional<std::string> readStoredJson(
+          shared_model::interface::types::HeightType height) const;
+
       std::unique_ptr<FlatFile> flat_file_storage_;
       std::shared_ptr<shared_model::interface::BlockJsonConverter>
           json_converter_;
       logger::LoggerPtr log_;
+      bool compress_on_write_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
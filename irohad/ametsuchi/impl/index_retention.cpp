@@ -0,0 +1,132 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/index_retention.hpp"
+
+#include <fmt/core.h>
+#include <soci/soci.h>
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    IndexRetention::IndexRetention(
+        std::shared_ptr<soci::connection_pool> pool,
+        IndexRetentionPolicy policy,
+        logger::LoggerPtr log)
+        : log_(std::move(log)), pool_(std::move(pool)), policy_(policy) {
+      if (enabled()) {
+        worker_ = std::thread([this] { run(); });
+      }
+    }
+
+    IndexRetention::~IndexRetention() {
+      if (not worker_.joinable()) {
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      worker_cv_.notify_one();
+      worker_.join();
+    }
+
+    bool IndexRetention::enabled() const {
+      return policy_.retention_blocks > 0;
+    }
+
+    void IndexRetention::onCommittedHeight(
+        shared_model::interface::types::HeightType height) {
+      if (not enabled()) {
+        return;
+      }
+      if (height > policy_.retention_blocks) {
+        // the floor follows the committed height directly, so queries are
+        // refused by policy even while the physical pruning lags behind
+        retention_floor_.store(height - policy_.retention_blocks,
+                               std::memory_order_relaxed);
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        committed_height_ = std::max(committed_height_, height);
+      }
+      worker_cv_.notify_one();
+    }
+
+    shared_model::interface::types::HeightType
+    IndexRetention::retentionFloor() const {
+      return retention_floor_.load(std::memory_order_relaxed);
+    }
+
+    void IndexRetention::run() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        worker_cv_.wait(lock, [this] {
+          return stop_
+              or committed_height_
+              > pruned_watermark_ + policy_.retention_blocks;
+        });
+        if (stop_) {
+          break;
+        }
+        const auto watermark = committed_height_ - policy_.retention_blocks;
+        lock.unlock();
+
+        try {
+          // the session is leased per pass, so an idle pruner does not
+          // occupy a pool slot
+          soci::session sql(*pool_);
+          prune(sql, watermark);
+        } catch (const std::exception &e) {
+          log_->error("index pruning below height {} failed: {}",
+                      watermark,
+                      e.what());
+        }
+
+        lock.lock();
+        pruned_watermark_ = std::max(pruned_watermark_, watermark);
+      }
+    }
+
+    void IndexRetention::prune(
+        soci::session &sql,
+        shared_model::interface::types::HeightType watermark) {
+      if (not partitioned_) {
+        int partitioned_count = 0;
+        sql << "SELECT count(1) FROM pg_partitioned_table AS pt "
+               "JOIN pg_class AS c ON c.oid = pt.partrelid "
+               "WHERE c.relname = 'tx_positions'",
+            soci::into(partitioned_count);
+        partitioned_ = partitioned_count != 0;
+        if (not *partitioned_) {
+          log_->warn(
+              "tx_positions is not partitioned (database predates "
+              "partitioning), pruning by DELETE instead of partition drop");
+        }
+      }
+      if (*partitioned_) {
+        // a partition can go once its whole height range is below the
+        // watermark; dropping it reclaims the space without touching rows
+        const auto drop_until = watermark / kTxPositionsPartitionSpan;
+        for (auto partition = next_partition_to_drop_; partition < drop_until;
+             ++partition) {
+          sql << fmt::format("DROP TABLE IF EXISTS tx_positions_p{}",
+                             partition);
+          log_->info("dropped index partition tx_positions_p{} (heights "
+                     "below {})",
+                     partition,
+                     (partition + 1) * kTxPositionsPartitionSpan);
+        }
+        next_partition_to_drop_ = drop_until;
+      } else {
+        sql << fmt::format("DELETE FROM tx_positions WHERE height < {}",
+                           watermark);
+        log_->debug("pruned index rows below height {}", watermark);
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
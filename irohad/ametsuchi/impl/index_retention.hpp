@@ -0,0 +1,104 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_INDEX_RETENTION_HPP
+#define IROHA_INDEX_RETENTION_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace soci {
+  class connection_pool;
+  class session;
+}  // namespace soci
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /// number of blocks covered by one tx_positions partition; dropping a
+    /// partition prunes this many blocks of index history at once
+    constexpr shared_model::interface::types::HeightType
+        kTxPositionsPartitionSpan = 100000;
+
+    /// Height-based retention of the transaction position indices.
+    struct IndexRetentionPolicy {
+      /// number of most recent blocks whose position index rows are kept;
+      /// 0 keeps the whole history
+      shared_model::interface::types::HeightType retention_blocks{0};
+    };
+
+    /**
+     * Background pruner of the tx_positions index. On every committed
+     * height it computes the retention watermark and removes the index
+     * rows below it: on a partitioned tx_positions whole partitions are
+     * dropped once they fall entirely below the watermark, on a legacy
+     * unpartitioned table the rows are deleted. The watermark is exposed
+     * to the query executors, which refuse history requests reaching
+     * below it instead of serving truncated results.
+     */
+    class IndexRetention {
+     public:
+      /**
+       * @param pool - pool to lease pruning sessions from
+       * @param policy - retention policy; an all-zero policy disables
+       * pruning and the worker thread is not started
+       * @param log - component logger
+       */
+      IndexRetention(std::shared_ptr<soci::connection_pool> pool,
+                     IndexRetentionPolicy policy,
+                     logger::LoggerPtr log);
+
+      IndexRetention(const IndexRetention &) = delete;
+      IndexRetention &operator=(const IndexRetention &) = delete;
+
+      /// Waits for a pruning pass in progress and stops the worker.
+      ~IndexRetention();
+
+      /// @return true when a retention limit is configured
+      bool enabled() const;
+
+      /// Notify the pruner of a newly committed height.
+      void onCommittedHeight(
+          shared_model::interface::types::HeightType height);
+
+      /**
+       * @return height below which the position indices are outside of
+       * the retention window; 0 when the whole history is retained
+       */
+      shared_model::interface::types::HeightType retentionFloor() const;
+
+     private:
+      void run();
+      void prune(soci::session &sql,
+                 shared_model::interface::types::HeightType watermark);
+
+      logger::LoggerPtr log_;
+      std::shared_ptr<soci::connection_pool> pool_;
+      const IndexRetentionPolicy policy_;
+      std::atomic<shared_model::interface::types::HeightType>
+          retention_floor_{0};
+
+      std::mutex mutex_;
+      std::condition_variable worker_cv_;
+      shared_model::interface::types::HeightType committed_height_{0};
+      shared_model::interface::types::HeightType pruned_watermark_{0};
+      /// first partition index not yet dropped
+      shared_model::interface::types::HeightType next_partition_to_drop_{0};
+      std::optional<bool> partitioned_;
+      bool stop_{false};
+      std::thread worker_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_INDEX_RETENTION_HPP
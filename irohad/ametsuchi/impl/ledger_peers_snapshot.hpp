@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LEDGER_PEERS_SNAPSHOT_HPP
+#define IROHA_LEDGER_PEERS_SNAPSHOT_HPP
+
+#include <atomic>
+#include <memory>
+
+#include "interfaces/common_objects/types.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Lock-free holder of the latest committed ledger peer list.
+     *
+     * The peer list changes only on commit, yet ordering, consensus and MST
+     * consult it several times per round. Storage publishes a new immutable
+     * snapshot on each commit, and per-round readers pick it up through an
+     * atomic shared_ptr load without locks or SQL round trips.
+     */
+    class LedgerPeersSnapshot {
+     public:
+      using PeerList = shared_model::interface::types::PeerList;
+
+      /**
+       * @return the latest published peer list, nullptr if nothing has been
+       * published yet
+       */
+      std::shared_ptr<const PeerList> get() const {
+        return std::atomic_load_explicit(&peers_, std::memory_order_acquire);
+      }
+
+      /**
+       * Publish a new snapshot, replacing the previous epoch. Readers holding
+       * the old snapshot keep it alive until they are done with it.
+       */
+      void set(std::shared_ptr<const PeerList> peers) {
+        std::atomic_store_explicit(
+            &peers_, std::move(peers), std::memory_order_release);
+      }
+
+     private:
+      std::shared_ptr<const PeerList> peers_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+#endif  // IROHA_LEDGER_PEERS_SNAPSHOT_HPP
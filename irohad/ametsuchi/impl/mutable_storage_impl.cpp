@@ -10,18 +10,24 @@
 #include <rxcpp/operators/rx-all.hpp>
 #include <stdexcept>
 #include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/command_stats_collector.hpp"
+#include "ametsuchi/impl/async_block_writer.hpp"
+#include "ametsuchi/impl/parallel_wave_applier.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_indexer.hpp"
+#include "ametsuchi/impl/postgres_wsv_bulk_writer.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/touches_peer_set.hpp"
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/tx_executor.hpp"
-#include "interfaces/commands/command.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
+#include "metrics/tx_latency_tracer.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -39,55 +45,111 @@ namespace iroha {
           block_index_(std::make_unique<PostgresBlockIndex>(
               std::make_unique<PostgresIndexer>(sql_),
               log_manager->getChild("PostgresBlockIndex")->getLogger())),
+          command_stats_(std::make_shared<CommandStatsCollector>()),
           transaction_executor_(std::make_unique<TransactionExecutor>(
-              std::move(command_executor))),
+              std::move(command_executor), command_stats_)),
           block_storage_(std::move(block_storage)),
           committed(false),
-          log_(log_manager->getLogger()) {
+          log_(log_manager->getLogger()),
+          commit_duration_(metrics::MetricsRegistry::instance().makeHistogram(
+              "iroha_commit_duration_seconds",
+              "Time spent committing the applied blocks to storage",
+              metrics::Histogram::defaultDurationBounds())) {
       sql_ << "BEGIN";
     }
 
+    void MutableStorageImpl::enableParallelApply(
+        std::shared_ptr<ParallelWaveApplier> applier) {
+      parallel_applier_ = std::move(applier);
+    }
+
     bool MutableStorageImpl::apply(
         std::shared_ptr<const shared_model::interface::Block> block,
         MutableStoragePredicate predicate) {
-      auto execute_transaction = [this](auto &transaction) -> bool {
-        auto result = transaction_executor_->execute(transaction, false);
-        auto error = expected::resultToOptionalError(result);
-        if (error) {
-          log_->error(error->command_error.toString());
-        }
-        auto ok = !error;
-        return ok;
-      };
+      // the block fields and the chain linkage predicate are invariant
+      // across the transactions, so they are extracted and evaluated once
+      // here instead of inside the per-transaction loop
+      const auto height = block->height();
+      const auto &block_hash = block->hash();
 
       log_->info("Applying block: height {}, hash {}",
-                 block->height(),
-                 block->hash().hex());
-
-      auto block_applied =
-          (not ledger_state_ or predicate(block, *ledger_state_.value()))
-          and std::all_of(block->transactions().begin(),
-                          block->transactions().end(),
-                          execute_transaction);
-      if (block_applied) {
-        if (auto e =
-                expected::resultToOptionalError(wsv_command_->setTopBlockInfo(
-                    TopBlockInfo{block->height(), block->hash()}))) {
-          log_->error("{}", e.value());
-          return false;
-        }
+                 height,
+                 block_hash.hex());
 
+      bool block_applied =
+          not ledger_state_ or predicate(block, *ledger_state_.value());
+      bool executed_in_bulk = false;
+      // in parallel mode every write has to go through the autocommitting
+      // worker sessions: bulk writes made inside this session's open
+      // transaction would be invisible to the workers applying the
+      // following blocks
+      if (block_applied and not ledger_state_ and not parallel_applier_) {
+        // genesis writes into an empty wsv, so its commands reduce to
+        // plain row inserts which go through the bulk COPY path instead
+        // of one executor statement per command
+        PostgresWsvBulkWriter bulk_writer(sql_);
+        if (stageGenesisCommands(*block, bulk_writer)) {
+          if (auto error =
+                  expected::resultToOptionalError(bulk_writer.flush())) {
+            log_->error("Bulk genesis application failed: {}", error.value());
+            block_applied = false;
+          } else {
+            log_->info("Applied the genesis block through the bulk writer");
+            executed_in_bulk = true;
+          }
+        } else {
+          log_->debug(
+              "The genesis block contains commands outside of the bulk "
+              "path, applying it through the command executor");
+        }
+      }
+      if (block_applied and not executed_in_bulk) {
+        const auto transactions = block->transactions();
+        if (parallel_applier_) {
+          auto result = parallel_applier_->apply(transactions);
+          if (auto error = expected::resultToOptionalError(result)) {
+            log_->error("{}", error.value());
+            block_applied = false;
+          }
+        } else {
+          for (const auto &transaction : transactions) {
+            auto result = transaction_executor_->execute(transaction, false);
+            if (auto error = expected::resultToOptionalError(result)) {
+              log_->error(error->command_error.toString());
+              block_applied = false;
+              break;
+            }
+          }
+        }
+      }
+      if (block_applied) {
         block_storage_->insert(block);
-        block_index_->index(*block);
+        // only the replay-guarding hash indices are written inside the
+        // commit transaction; the position indices are built by the storage
+        // background indexer once the block is committed
+        block_index_->indexStatuses(*block);
 
-        auto opt_ledger_peers = peer_query_->getLedgerPeers();
-        if (not opt_ledger_peers) {
-          log_->error("Failed to get ledger peers!");
-          return false;
+        // catch-up applies long chains in this one transaction; skip the
+        // peer list SQL round trip when the block cannot have changed it
+        shared_model::interface::types::PeerList ledger_peers;
+        if (ledger_state_ and not touchesPeerSet(*block)) {
+          ledger_peers = ledger_state_.value()->ledger_peers;
+        } else {
+          auto opt_ledger_peers = peer_query_->getLedgerPeers();
+          if (not opt_ledger_peers) {
+            log_->error("Failed to get ledger peers!");
+            return false;
+          }
+          ledger_peers = std::move(*opt_ledger_peers);
         }
 
         ledger_state_ = std::make_shared<const LedgerState>(
-            std::move(*opt_ledger_peers), block->height(), block->hash());
+            std::move(ledger_peers), height, block_hash);
+
+        auto command_timings = command_stats_->takeSummary();
+        if (not command_timings.empty()) {
+          log_->info("block {} command timings: {}", height, command_timings);
+        }
       }
 
       return block_applied;
@@ -152,22 +214,41 @@ namespace iroha {
         assert(ledger_state_);
         return "Tried to commit mutable storage with no blocks applied.";
       }
+      // Blocks are handed to a background writer which serializes them and
+      // flushes them to disk while we drain the staging storage. The sync()
+      // barrier before COMMIT keeps the crash-consistency invariant: a block
+      // is durable in the block store before the WSV state referring to it.
+      const auto start = std::chrono::steady_clock::now();
+      AsyncBlockWriter writer(log_);
       return block_storage_->forEach(
-                 [&block_storage](
+                 [&writer, &block_storage](
                      auto const &block) -> expected::Result<void, std::string> {
-                   if (not block_storage.insert(block)) {
-                     return fmt::format("Failed to insert block {}", *block);
+                   for (const auto &tx : block->transactions()) {
+                     metrics::TxLatencyTracer::instance().recordStage(
+                         tx.hash().hex(), metrics::TxStage::kCommitted);
                    }
+                   writer.enqueue(block, block_storage);
                    return {};
                  })
-                 | [this]() -> expected::Result<MutableStorage::CommitResult,
-                                                std::string> {
+                 | [&writer] { return writer.sync(); }
+                 | [this, &start]() -> expected::Result<
+                                        MutableStorage::CommitResult,
+                                        std::string> {
         try {
+          // within the transaction only the final top block info is visible
+          // to anyone, so it is written once here instead of per applied
+          // block
+          if (auto e = expected::resultToOptionalError(
+                  wsv_command_->setTopBlockInfo(
+                      ledger_state_.value()->top_block_info))) {
+            return expected::makeError(e.value());
+          }
           sql_ << "COMMIT";
           committed = true;
         } catch (std::exception &e) {
           return expected::makeError(e.what());
         }
+        commit_duration_->observeSince(start);
         return MutableStorage::CommitResult{ledger_state_.value(),
                                             std::move(block_storage_)};
       };
@@ -14,10 +14,13 @@
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
+#include "metrics/metrics_registry.hpp"
 
 namespace iroha {
   namespace ametsuchi {
     class BlockIndex;
+    class CommandStatsCollector;
+    class ParallelWaveApplier;
     class PeerQuery;
     class PostgresCommandExecutor;
     class PostgresWsvCommand;
@@ -37,6 +40,16 @@ namespace iroha {
       bool apply(
           std::shared_ptr<const shared_model::interface::Block> block) override;
 
+      /**
+       * Route transaction execution through the given multi-session wave
+       * applier instead of the own sequential executor. The applier's
+       * sessions autocommit outside of this storage's transaction, so the
+       * applied state survives a rollback; only the WSV restorer uses
+       * this, for full rebuilds where a failed restore discards the WSV
+       * anyway.
+       */
+      void enableParallelApply(std::shared_ptr<ParallelWaveApplier> applier);
+
       bool apply(rxcpp::observable<
                      std::shared_ptr<shared_model::interface::Block>> blocks,
                  MutableStoragePredicate predicate) override;
@@ -72,12 +85,19 @@ namespace iroha {
       std::unique_ptr<PostgresWsvCommand> wsv_command_;
       std::unique_ptr<PeerQuery> peer_query_;
       std::unique_ptr<BlockIndex> block_index_;
+      /// per-command-type execution timings of the applied blocks
+      std::shared_ptr<CommandStatsCollector> command_stats_;
       std::shared_ptr<TransactionExecutor> transaction_executor_;
+      /// when set, blocks are applied wave by wave on several sessions
+      std::shared_ptr<ParallelWaveApplier> parallel_applier_;
       std::unique_ptr<BlockStorage> block_storage_;
 
       bool committed;
 
       logger::LoggerPtr log_;
+
+      /// duration of committing the applied blocks, exposed to the scraper
+      std::shared_ptr<iroha::metrics::Histogram> commit_duration_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
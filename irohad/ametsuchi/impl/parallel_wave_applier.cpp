@@ -0,0 +1,140 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/parallel_wave_applier.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#include <fmt/core.h>
+#include "ametsuchi/impl/tx_rw_set.hpp"
+#include "ametsuchi/tx_executor.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  std::string describeFailure(
+      const shared_model::interface::Transaction &transaction,
+      const iroha::ametsuchi::TxExecutionError &error) {
+    return fmt::format("transaction {} failed: {}",
+                       transaction.hash().hex(),
+                       error.command_error.toString());
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    ParallelWaveApplier::ParallelWaveApplier(
+        std::vector<std::shared_ptr<CommandExecutor>> executors,
+        logger::LoggerPtr log)
+        : log_(std::move(log)) {
+      assert(not executors.empty());
+      for (auto &executor : executors) {
+        executors_.push_back(
+            std::make_unique<TransactionExecutor>(std::move(executor)));
+      }
+      assignments_.resize(executors_.size());
+      for (size_t i = 0; i < executors_.size(); ++i) {
+        threads_.emplace_back([this, i] { workerLoop(i); });
+      }
+    }
+
+    ParallelWaveApplier::~ParallelWaveApplier() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shutdown_ = true;
+      }
+      wake_workers_.notify_all();
+      for (auto &thread : threads_) {
+        thread.join();
+      }
+    }
+
+    void ParallelWaveApplier::workerLoop(size_t worker_index) {
+      uint64_t seen_generation = 0;
+      while (true) {
+        std::vector<const shared_model::interface::Transaction *> my_txs;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          wake_workers_.wait(lock, [&] {
+            return shutdown_ or generation_ != seen_generation;
+          });
+          if (shutdown_) {
+            return;
+          }
+          seen_generation = generation_;
+          my_txs.swap(assignments_[worker_index]);
+        }
+        if (my_txs.empty()) {
+          continue;
+        }
+        std::string error_description;
+        for (const auto *transaction : my_txs) {
+          auto result = executors_[worker_index]->execute(*transaction, false);
+          if (auto error = expected::resultToOptionalError(result)) {
+            error_description = describeFailure(*transaction, error.value());
+            break;
+          }
+        }
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (not error_description.empty()) {
+            errors_.push_back(std::move(error_description));
+          }
+          if (--busy_workers_ == 0) {
+            wave_done_.notify_all();
+          }
+        }
+      }
+    }
+
+    expected::Result<void, std::string> ParallelWaveApplier::apply(
+        shared_model::interface::types::TransactionsCollectionType
+            transactions) {
+      std::vector<
+          std::reference_wrapper<const shared_model::interface::Transaction>>
+          txs;
+      for (const auto &transaction : transactions) {
+        txs.emplace_back(transaction);
+      }
+      const auto waves = scheduleIndependentWaves(txs);
+      for (const auto &wave : waves) {
+        if (wave.size() == 1) {
+          // nothing to overlap; run on the calling thread through the
+          // first worker's session - the workers are idle between waves
+          auto result =
+              executors_.front()->execute(txs[wave.front()].get(), false);
+          if (auto error = expected::resultToOptionalError(result)) {
+            return expected::makeError(
+                describeFailure(txs[wave.front()].get(), error.value()));
+          }
+          continue;
+        }
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          const auto workers = std::min(executors_.size(), wave.size());
+          for (size_t slot = 0; slot < wave.size(); ++slot) {
+            assignments_[slot % workers].push_back(&txs[wave[slot]].get());
+          }
+          busy_workers_ = workers;
+          ++generation_;
+        }
+        wake_workers_.notify_all();
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          wave_done_.wait(lock, [&] { return busy_workers_ == 0; });
+          if (not errors_.empty()) {
+            auto description = errors_.front();
+            errors_.clear();
+            return expected::makeError(std::move(description));
+          }
+        }
+      }
+      return expected::Value<void>();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,95 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PARALLEL_WAVE_APPLIER_HPP
+#define IROHA_PARALLEL_WAVE_APPLIER_HPP
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/result.hpp"
+#include "interfaces/common_objects/range_types.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class CommandExecutor;
+    class TransactionExecutor;
+
+    /**
+     * Applies the transactions of one block concurrently on several
+     * database sessions, following the schedule of
+     * scheduleIndependentWaves: transactions inside one wave have
+     * disjoint read/write sets and run on the worker sessions in
+     * parallel, waves run strictly in order.
+     *
+     * The worker sessions autocommit every statement, so the applied
+     * state is not covered by the surrounding mutable storage
+     * transaction and cannot be rolled back: a failed or interrupted
+     * parallel apply leaves a partially restored WSV which has to be
+     * dropped before retrying. The restorer therefore engages this
+     * applier only when rebuilding the WSV from scratch.
+     */
+    class ParallelWaveApplier {
+     public:
+      /**
+       * @param executors - one per worker, each holding its own database
+       * session
+       * @param log - applier logger
+       */
+      ParallelWaveApplier(
+          std::vector<std::shared_ptr<CommandExecutor>> executors,
+          logger::LoggerPtr log);
+      ~ParallelWaveApplier();
+
+      ParallelWaveApplier(const ParallelWaveApplier &) = delete;
+      ParallelWaveApplier &operator=(const ParallelWaveApplier &) = delete;
+
+      /**
+       * Apply the transactions of one block wave by wave.
+       * @param transactions - transactions in their block order
+       * @return error description of the first failed transaction, if any
+       */
+      iroha::expected::Result<void, std::string> apply(
+          shared_model::interface::types::TransactionsCollectionType
+              transactions);
+
+     private:
+      void workerLoop(size_t worker_index);
+
+      std::vector<std::unique_ptr<TransactionExecutor>> executors_;
+      logger::LoggerPtr log_;
+
+      std::mutex mutex_;
+      std::condition_variable wake_workers_;
+      std::condition_variable wave_done_;
+      /// per-worker slices of the wave being applied
+      std::vector<std::vector<const shared_model::interface::Transaction *>>
+          assignments_;
+      /// incremented for every dispatched wave to wake the workers
+      uint64_t generation_{0};
+      /// workers still applying their slice of the current wave
+      size_t busy_workers_{0};
+      std::vector<std::string> errors_;
+      bool shutdown_{false};
+
+      std::vector<std::thread> threads_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_PARALLEL_WAVE_APPLIER_HPP
@@ -5,24 +5,47 @@
 
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 
+#include <algorithm>
 #include <numeric>
 
+#include "ametsuchi/impl/ledger_peers_snapshot.hpp"
 #include "ametsuchi/wsv_query.hpp"
+#include "interfaces/common_objects/peer.hpp"
 
 namespace iroha {
   namespace ametsuchi {
 
-    PeerQueryWsv::PeerQueryWsv(std::shared_ptr<WsvQuery> wsv)
-        : wsv_(std::move(wsv)) {}
+    PeerQueryWsv::PeerQueryWsv(
+        std::shared_ptr<WsvQuery> wsv,
+        std::shared_ptr<const LedgerPeersSnapshot> peers_snapshot)
+        : wsv_(std::move(wsv)), peers_snapshot_(std::move(peers_snapshot)) {}
 
     boost::optional<std::vector<PeerQuery::wPeer>>
     PeerQueryWsv::getLedgerPeers() {
+      if (peers_snapshot_) {
+        if (auto peers = peers_snapshot_->get()) {
+          return *peers;
+        }
+      }
       return wsv_->getPeers();
     }
 
     boost::optional<PeerQuery::wPeer> PeerQueryWsv::getLedgerPeerByPublicKey(
         shared_model::interface::types::PublicKeyHexStringView public_key)
         const {
+      if (peers_snapshot_) {
+        if (auto peers = peers_snapshot_->get()) {
+          auto it = std::find_if(
+              peers->begin(), peers->end(), [&public_key](const auto &peer) {
+                return peer->pubkey() == std::string_view{public_key};
+              });
+          if (it != peers->end()) {
+            return *it;
+          }
+          // the snapshot is authoritative for the committed peer list
+          return boost::none;
+        }
+      }
       return wsv_->getPeerByPublicKey(public_key);
     }
 
@@ -16,6 +16,7 @@
 namespace iroha {
   namespace ametsuchi {
 
+    class LedgerPeersSnapshot;
     class WsvQuery;
 
     /**
@@ -23,7 +24,15 @@ namespace iroha {
      */
     class PeerQueryWsv : public PeerQuery {
      public:
-      explicit PeerQueryWsv(std::shared_ptr<WsvQuery> wsv);
+      /**
+       * @param wsv - query executor hitting the database
+       * @param peers_snapshot - optional in-memory snapshot of the committed
+       * peer list; when present and populated, it is served instead of
+       * querying the database
+       */
+      explicit PeerQueryWsv(
+          std::shared_ptr<WsvQuery> wsv,
+          std::shared_ptr<const LedgerPeersSnapshot> peers_snapshot = nullptr);
 
       /**
        * Fetch peers stored in ledger
@@ -41,6 +50,7 @@ namespace iroha {
 
      private:
       std::shared_ptr<WsvQuery> wsv_;
+      std::shared_ptr<const LedgerPeersSnapshot> peers_snapshot_;
     };
 
   }  // namespace ametsuchi
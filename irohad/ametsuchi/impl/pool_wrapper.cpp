@@ -12,8 +12,12 @@ using namespace iroha::ametsuchi;
 
 PoolWrapper::PoolWrapper(
     std::shared_ptr<soci::connection_pool> connection_pool,
+    std::shared_ptr<soci::connection_pool> maintenance_pool,
+    std::vector<std::shared_ptr<soci::connection_pool>> replica_pools,
     std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
     bool enable_prepared_transactions)
     : connection_pool_(std::move(connection_pool)),
+      maintenance_pool_(std::move(maintenance_pool)),
+      replica_pools_(std::move(replica_pools)),
       failover_callback_holder_(std::move(failover_callback_holder)),
       enable_prepared_transactions_(enable_prepared_transactions) {}
@@ -7,6 +7,7 @@
 #define IROHA_POOL_WRAPPER_HPP
 
 #include <memory>
+#include <vector>
 
 namespace soci {
   class connection_pool;
@@ -17,12 +18,23 @@ namespace iroha {
     class FailoverCallbackHolder;
 
     struct PoolWrapper {
+      /// number of sessions reserved for the block commit path
+      static constexpr size_t kMaintenancePoolSize = 2;
+
       PoolWrapper(
           std::shared_ptr<soci::connection_pool> connection_pool,
+          std::shared_ptr<soci::connection_pool> maintenance_pool,
+          std::vector<std::shared_ptr<soci::connection_pool>> replica_pools,
           std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
           bool enable_prepared_transactions);
 
       std::shared_ptr<soci::connection_pool> connection_pool_;
+      /// dedicated sessions for the block commit path, so that queries never
+      /// queue behind a commit; may be null, then connection_pool_ is shared
+      std::shared_ptr<soci::connection_pool> maintenance_pool_;
+      /// pools of sessions to read replicas which serve torii queries; may be
+      /// empty, then all queries go to connection_pool_
+      std::vector<std::shared_ptr<soci::connection_pool>> replica_pools_;
       std::unique_ptr<FailoverCallbackHolder> failover_callback_holder_;
       bool enable_prepared_transactions_;
     };
@@ -72,12 +72,32 @@ PostgresBlockIndex::PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
     : indexer_(std::move(indexer)), log_(std::move(log)) {}
 
 void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
+  indexStatuses(block);
+  indexPositions(block);
+}
+
+void PostgresBlockIndex::indexStatuses(
+    const shared_model::interface::Block &block) {
+  for (const auto &tx : block.transactions()) {
+    indexer_->committedTxHash(tx.hash());
+  }
+
+  for (const auto &rejected_tx_hash : block.rejected_transactions_hashes()) {
+    indexer_->rejectedTxHash(rejected_tx_hash);
+  }
+
+  if (auto e = resultToOptionalError(indexer_->flush())) {
+    log_->error(e.value());
+  }
+}
+
+void PostgresBlockIndex::indexPositions(
+    const shared_model::interface::Block &block) {
   auto height = block.height();
   for (auto tx : block.transactions() | boost::adaptors::indexed(0)) {
     const auto &creator_id = tx.value().creatorAccountId();
     const TxPosition position{height, static_cast<size_t>(tx.index())};
 
-    indexer_->committedTxHash(tx.value().hash());
     makeAccountAssetIndex(creator_id,
                           tx.value().hash(),
                           tx.value().createdTime(),
@@ -90,10 +110,6 @@ void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
                           position);
   }
 
-  for (const auto &rejected_tx_hash : block.rejected_transactions_hashes()) {
-    indexer_->rejectedTxHash(rejected_tx_hash);
-  }
-
   if (auto e = resultToOptionalError(indexer_->flush())) {
     log_->error(e.value());
   }
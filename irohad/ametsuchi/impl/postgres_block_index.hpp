@@ -35,6 +35,13 @@ namespace iroha {
       /// Index a block.
       void index(const shared_model::interface::Block &block) override;
 
+      /// Index the committed and rejected tx hashes of a block.
+      void indexStatuses(const shared_model::interface::Block &block) override;
+
+      /// Index the tx positions of a block.
+      void indexPositions(
+          const shared_model::interface::Block &block) override;
+
      private:
       /// Index a transaction.
       void makeAccountAssetIndex(
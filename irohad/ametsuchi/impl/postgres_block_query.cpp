@@ -5,7 +5,12 @@
 
 #include "ametsuchi/impl/postgres_block_query.hpp"
 
+#include <set>
+#include <unordered_set>
+
+#include <boost/algorithm/string/join.hpp>
 #include <boost/format.hpp>
+#include <boost/range/adaptor/transformed.hpp>
 
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "common/byteutils.hpp"
@@ -17,7 +22,10 @@ namespace iroha {
     PostgresBlockQuery::PostgresBlockQuery(soci::session &sql,
                                            BlockStorage &block_storage,
                                            logger::LoggerPtr log)
-        : sql_(sql), block_storage_(block_storage), log_(std::move(log)) {}
+        : sql_(sql),
+          block_storage_(block_storage),
+          block_cache_(std::make_unique<BlockCache>()),
+          log_(std::move(log)) {}
 
     PostgresBlockQuery::PostgresBlockQuery(std::unique_ptr<soci::session> sql,
                                            BlockStorage &block_storage,
@@ -25,18 +33,35 @@ namespace iroha {
         : psql_(std::move(sql)),
           sql_(*psql_),
           block_storage_(block_storage),
+          block_cache_(std::make_unique<BlockCache>()),
           log_(std::move(log)) {}
 
-    BlockQuery::BlockResult PostgresBlockQuery::getBlock(
+    std::shared_ptr<const shared_model::interface::Block>
+    PostgresBlockQuery::fetchBlock(
         shared_model::interface::types::HeightType height) {
+      if (auto cached = block_cache_->findItem(height)) {
+        return *cached;
+      }
       auto block = block_storage_.fetch(height);
+      if (not block) {
+        return nullptr;
+      }
+      std::shared_ptr<const shared_model::interface::Block> shared_block =
+          std::move(*block);
+      block_cache_->addItem(height, shared_block);
+      return shared_block;
+    }
+
+    BlockQuery::BlockResult PostgresBlockQuery::getBlock(
+        shared_model::interface::types::HeightType height) {
+      auto block = fetchBlock(height);
       if (not block) {
         auto error =
             boost::format("Failed to retrieve block with height %d") % height;
         return expected::makeError(
             GetBlockError{GetBlockError::Code::kNoBlock, error.str()});
       }
-      return std::move(*block);
+      return clone(*block);
     }
 
     shared_model::interface::types::HeightType
@@ -46,6 +71,56 @@ namespace iroha {
 
     void PostgresBlockQuery::reloadBlockstore() {
       block_storage_.reload();
+      block_cache_ = std::make_unique<BlockCache>();
+    }
+
+    std::vector<std::unique_ptr<shared_model::interface::Transaction>>
+    PostgresBlockQuery::getTransactions(
+        const std::vector<shared_model::crypto::Hash> &tx_hashes) {
+      std::vector<std::unique_ptr<shared_model::interface::Transaction>>
+          result;
+      if (tx_hashes.empty()) {
+        return result;
+      }
+
+      std::unordered_set<std::string> requested_hashes;
+      for (const auto &hash : tx_hashes) {
+        requested_hashes.insert(hash.hex());
+      }
+
+      auto hash_list = boost::algorithm::join(
+          tx_hashes | boost::adaptors::transformed([](const auto &hash) {
+            return "decode('" + hash.hex() + "', 'hex')";
+          }),
+          ", ");
+
+      std::set<shared_model::interface::types::HeightType> heights;
+      try {
+        soci::rowset<long long> rows =
+            (sql_.prepare << "SELECT DISTINCT height FROM tx_positions "
+                             "WHERE hash IN ("
+                 + hash_list + ")");
+        for (auto height : rows) {
+          heights.insert(height);
+        }
+      } catch (const std::exception &e) {
+        log_->error("Failed to execute query: {}", e.what());
+        return result;
+      }
+
+      for (auto height : heights) {
+        auto block = fetchBlock(height);
+        if (not block) {
+          log_->error("Failed to retrieve block with height {}", height);
+          continue;
+        }
+        for (const auto &tx : block->transactions()) {
+          if (requested_hashes.count(tx.hash().hex()) > 0) {
+            result.push_back(clone(tx));
+          }
+        }
+      }
+      return result;
     }
 
     std::optional<TxCacheStatusType> PostgresBlockQuery::checkTxPresence(
@@ -54,7 +129,8 @@ namespace iroha {
       const auto &hash_str = hash.hex();
 
       try {
-        sql_ << "SELECT status FROM tx_status_by_hash WHERE hash = :hash",
+        sql_ << "SELECT status FROM tx_status_by_hash "
+                "WHERE hash = decode(:hash, 'hex')",
             soci::into(res), soci::use(hash_str);
       } catch (const std::exception &e) {
         log_->error("Failed to execute query: {}", e.what());
@@ -10,6 +10,7 @@
 
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/block_storage.hpp"
+#include "cache/cache.hpp"
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
@@ -35,13 +36,36 @@ namespace iroha {
 
       void reloadBlockstore() override;
 
+      std::vector<std::unique_ptr<shared_model::interface::Transaction>>
+      getTransactions(const std::vector<shared_model::crypto::Hash> &tx_hashes)
+          override;
+
       std::optional<TxCacheStatusType> checkTxPresence(
           const shared_model::crypto::Hash &hash) override;
 
      private:
+      /// number of recently deserialized blocks kept in memory
+      static constexpr size_t kBlockCacheSize = 32;
+
+      using BlockCache =
+          cache::Cache<shared_model::interface::types::HeightType,
+                       std::shared_ptr<const shared_model::interface::Block>,
+                       std::hash<shared_model::interface::types::HeightType>,
+                       kBlockCacheSize>;
+
+      /**
+       * Fetch a block through the deserialized block cache.
+       * @param height - height of a block to retrieve
+       * @return the block, or nullptr if it is not in the storage
+       */
+      std::shared_ptr<const shared_model::interface::Block> fetchBlock(
+          shared_model::interface::types::HeightType height);
+
       std::unique_ptr<soci::session> psql_;
       soci::session &sql_;
       BlockStorage &block_storage_;
+      /// behind a pointer so that reloadBlockstore() can drop stale entries
+      std::unique_ptr<BlockCache> block_cache_;
       logger::LoggerPtr log_;
     };
   }  // namespace ametsuchi
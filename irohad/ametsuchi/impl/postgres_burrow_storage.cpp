@@ -5,6 +5,8 @@
 
 #include "ametsuchi/impl/postgres_burrow_storage.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <optional>
 
 #include <soci/soci.h>
@@ -16,6 +18,17 @@
 using namespace iroha::ametsuchi;
 using namespace iroha::expected;
 
+namespace {
+  /// the database stores addresses and keys lowercased
+  std::string toLower(std::string_view sv) {
+    std::string result{sv};
+    std::transform(result.begin(), result.end(), result.begin(), [](char c) {
+      return std::tolower(static_cast<unsigned char>(c));
+    });
+    return result;
+  }
+}  // namespace
+
 PostgresBurrowStorage::PostgresBurrowStorage(
     soci::session &sql,
     std::string const &tx_hash,
@@ -24,11 +37,17 @@ PostgresBurrowStorage::PostgresBurrowStorage(
 
 Result<std::optional<std::string>, std::string>
 PostgresBurrowStorage::getAccount(std::string_view address) {
+  auto addr = toLower(address);
+  auto it = account_cache_.find(addr);
+  if (it != account_cache_.end()) {
+    return it->second.value;
+  }
   try {
     std::optional<std::string> data;
     sql_ << "select data from burrow_account_data "
-            "where address = lower(:address)",
-        soci::use(address, "address"), soci::into(data);
+            "where address = :address",
+        soci::use(addr, "address"), soci::into(data);
+    account_cache_.emplace(std::move(addr), CacheEntry{data, false});
     return data;
   } catch (std::exception const &e) {
     return makeError(e.what());
@@ -37,50 +56,46 @@ PostgresBurrowStorage::getAccount(std::string_view address) {
 
 Result<void, std::string> PostgresBurrowStorage::updateAccount(
     std::string_view address, std::string_view account) {
-  try {
-    int check = 0;
-    sql_ << "insert into burrow_account_data (address, data) "
-            "values (lower(:address), :data) "
-            "on conflict (address) do update set data = excluded.data "
-            "returning 1",
-        soci::use(address, "address"), soci::use(account, "data"),
-        soci::into(check);
-    if (check == 0) {
-      return makeError("account data update failed");
-    }
-    return Value<void>{};
-  } catch (std::exception const &e) {
-    return makeError(e.what());
-  }
+  account_cache_[toLower(address)] =
+      CacheEntry{std::make_optional<std::string>(account), true};
+  return Value<void>{};
 }
 
 Result<void, std::string> PostgresBurrowStorage::removeAccount(
     std::string_view address) {
-  try {
-    int check = 0;
-    sql_ << "delete from burrow_account_key_value "
-            "where address = lower(:address); "
-            "delete from burrow_account_data "
-            "where address = lower(:address) "
-            "returning 1",
-        soci::use(address, "address"), soci::into(check);
-    if (check == 0) {
+  return getAccount(address) | [&](auto &&data) -> Result<void, std::string> {
+    if (not data) {
       return makeError("account deletion failed");
     }
+    auto addr = toLower(address);
+    account_cache_[addr] = CacheEntry{std::nullopt, true};
+    storage_cache_[addr].clear();
+    cleared_accounts_.insert(std::move(addr));
     return Value<void>{};
-  } catch (std::exception const &e) {
-    return makeError(e.what());
-  }
+  };
 }
 
 Result<std::optional<std::string>, std::string>
 PostgresBurrowStorage::getStorage(std::string_view address,
                                   std::string_view key) {
+  auto addr = toLower(address);
+  auto lowered_key = toLower(key);
+  auto &slots = storage_cache_[addr];
+  auto it = slots.find(lowered_key);
+  if (it != slots.end()) {
+    return it->second.value;
+  }
+  if (cleared_accounts_.count(addr) > 0) {
+    // the account was removed in this call, all unwritten slots are gone
+    return std::optional<std::string>{};
+  }
   try {
     std::optional<std::string> value;
     sql_ << "select value from burrow_account_key_value "
-            "where address = lower(:address) and key = lower(:key) ",
-        soci::use(address, "address"), soci::use(key, "key"), soci::into(value);
+            "where address = :address and key = :key ",
+        soci::use(addr, "address"), soci::use(lowered_key, "key"),
+        soci::into(value);
+    slots.emplace(std::move(lowered_key), CacheEntry{value, false});
     return value;
   } catch (std::exception const &e) {
     return makeError(e.what());
@@ -89,17 +104,64 @@ PostgresBurrowStorage::getStorage(std::string_view address,
 
 Result<void, std::string> PostgresBurrowStorage::setStorage(
     std::string_view address, std::string_view key, std::string_view value) {
+  storage_cache_[toLower(address)][toLower(key)] =
+      CacheEntry{std::make_optional<std::string>(value), true};
+  return Value<void>{};
+}
+
+Result<void, std::string> PostgresBurrowStorage::flush() {
   try {
-    int check = 0;
-    sql_ << "insert into burrow_account_key_value (address, key, value) "
-            "values (lower(:address), lower(:key), :value) "
-            "on conflict (address, key) do update set value = excluded.value "
-            "returning 1",
-        soci::use(address, "address"), soci::use(key, "key"),
-        soci::use(value, "value"), soci::into(check);
-    if (check == 0) {
-      return makeError("account key-value storage update failed");
+    if (not cleared_accounts_.empty()) {
+      std::vector<std::string> addresses{cleared_accounts_.begin(),
+                                         cleared_accounts_.end()};
+      sql_ << "delete from burrow_account_key_value "
+              "where address = :address",
+          soci::use(addresses, "address");
+      sql_ << "delete from burrow_account_data "
+              "where address = :address",
+          soci::use(addresses, "address");
+    }
+
+    std::vector<std::string> account_addresses;
+    std::vector<std::string> account_datas;
+    for (auto &entry : account_cache_) {
+      if (entry.second.dirty and entry.second.value) {
+        account_addresses.push_back(entry.first);
+        account_datas.push_back(*entry.second.value);
+      }
+      entry.second.dirty = false;
+    }
+    if (not account_addresses.empty()) {
+      sql_ << "insert into burrow_account_data (address, data) "
+              "values (:address, :data) "
+              "on conflict (address) do update set data = excluded.data",
+          soci::use(account_addresses, "address"),
+          soci::use(account_datas, "data");
+    }
+
+    std::vector<std::string> slot_addresses;
+    std::vector<std::string> slot_keys;
+    std::vector<std::string> slot_values;
+    for (auto &slots : storage_cache_) {
+      for (auto &entry : slots.second) {
+        if (entry.second.dirty and entry.second.value) {
+          slot_addresses.push_back(slots.first);
+          slot_keys.push_back(entry.first);
+          slot_values.push_back(*entry.second.value);
+        }
+        entry.second.dirty = false;
+      }
+    }
+    if (not slot_addresses.empty()) {
+      sql_ << "insert into burrow_account_key_value (address, key, value) "
+              "values (:address, :key, :value) "
+              "on conflict (address, key) do update "
+              "set value = excluded.value",
+          soci::use(slot_addresses, "address"), soci::use(slot_keys, "key"),
+          soci::use(slot_values, "value");
     }
+
+    cleared_accounts_.clear();
     return Value<void>{};
   } catch (std::exception const &e) {
     return makeError(e.what());
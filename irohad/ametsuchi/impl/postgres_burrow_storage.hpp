@@ -8,6 +8,10 @@
 
 #include "ametsuchi/burrow_storage.hpp"
 
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "interfaces/common_objects/types.hpp"
 
 namespace soci {
@@ -15,6 +19,14 @@ namespace soci {
 }
 
 namespace iroha::ametsuchi {
+  /**
+   * Burrow storage with an in-memory overlay. The object lives for one
+   * CallEngine command: reads go through a cache filled from the database,
+   * account and storage writes are buffered and written out in bulk by
+   * flush() once the engine call has finished, instead of one SQL round
+   * trip per touched slot. Logs are an append-only stream and are stored
+   * immediately.
+   */
   class PostgresBurrowStorage : public BurrowStorage {
    public:
     PostgresBurrowStorage(
@@ -44,11 +56,30 @@ namespace iroha::ametsuchi {
         std::string_view data,
         std::vector<std::string_view> topics) override;
 
+    /**
+     * Write all buffered account and storage mutations to the database in
+     * bulk statements. Must be called once after the engine call completes.
+     */
+    expected::Result<void, std::string> flush();
+
    private:
+    /// overlay record; dirty entries are pending a flush()
+    struct CacheEntry {
+      std::optional<std::string> value;
+      bool dirty{false};
+    };
+
     soci::session &sql_;
     std::string const &tx_hash_;
     shared_model::interface::types::CommandIndexType cmd_index_;
     std::optional<size_t> call_id_cache_;
+
+    std::unordered_map<std::string, CacheEntry> account_cache_;
+    std::unordered_map<std::string,
+                       std::unordered_map<std::string, CacheEntry>>
+        storage_cache_;
+    /// accounts removed in this call: all their slots are known to be gone
+    std::unordered_set<std::string> cleared_accounts_;
   };
 
 }  // namespace iroha::ametsuchi
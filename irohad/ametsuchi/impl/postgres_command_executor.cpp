@@ -6,7 +6,6 @@
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 
 #include <exception>
-#include <forward_list>
 #include <memory>
 
 #include <fmt/core.h>
@@ -14,14 +13,17 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/join.hpp>
 #include <boost/format.hpp>
+#include <boost/variant/get.hpp>
 #include "ametsuchi/impl/executor_common.hpp"
 #include "ametsuchi/impl/postgres_block_storage.hpp"
 #include "ametsuchi/impl/postgres_burrow_storage.hpp"
+#include "ametsuchi/impl/postgres_pipeline.hpp"
 #include "ametsuchi/impl/postgres_specific_query_executor.hpp"
 #include "ametsuchi/impl/soci_std_optional.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "ametsuchi/setting_query.hpp"
 #include "ametsuchi/vm_caller.hpp"
+#include "commands.pb.h"
 #include "interfaces/commands/add_asset_quantity.hpp"
 #include "interfaces/commands/add_peer.hpp"
 #include "interfaces/commands/add_signatory.hpp"
@@ -342,180 +344,61 @@ namespace {
             % creator_id % account_id)
         .str();
   }
-}  // namespace
-
-namespace iroha {
-  namespace ametsuchi {
-    class PostgresCommandExecutor::CommandStatements {
-     public:
-      CommandStatements(soci::session &session,
-                        const std::string &base_statement,
-                        const std::vector<std::string> &permission_checks)
-          : statement_with_validation([&] {
-              // Create query with validation
-              auto with_validation_str = boost::format(base_statement);
-
-              // append all necessary checks to the query
-              for (const auto &check : permission_checks) {
-                with_validation_str = with_validation_str % check;
-              }
-
-              return (session.prepare << with_validation_str);
-            }()),
-            statement_without_validation([&] {
-              // Create query without validation
-              auto without_validation_str = boost::format(base_statement);
-
-              // since checks are not needed, append empty strings to their
-              // place
-              for (size_t i = 0; i < permission_checks.size(); i++) {
-                without_validation_str = without_validation_str % "";
-              }
-
-              return (session.prepare << without_validation_str);
-            }()) {}
-
-      soci::statement &getStatement(bool with_validation) {
-        return with_validation ? statement_with_validation
-                               : statement_without_validation;
-      }
-
-     private:
-      soci::statement statement_with_validation;
-      soci::statement statement_without_validation;
-    };
-
-    class PostgresCommandExecutor::StatementExecutor {
-     public:
-      StatementExecutor(
-          std::unique_ptr<CommandStatements> &statements,
-          bool enable_validation,
-          std::string command_name,
-          std::shared_ptr<shared_model::interface::PermissionToString>
-              perm_converter)
-          : statement_(statements->getStatement(enable_validation)),
-            command_name_(std::move(command_name)),
-            perm_converter_(std::move(perm_converter)) {
-        arguments_string_builder_.init(command_name_)
-            .appendNamed("Validation", enable_validation);
-      }
-
-      template <typename T,
-                typename = decltype(soci::use(std::declval<T>(),
-                                              std::string{}))>
-      void use(const std::string &argument_name, const T &value) {
-        statement_.exchange(soci::use(value, argument_name));
-        addArgumentToString(argument_name, value);
-      }
-
-      void use(const std::string &argument_name, const Role &permission) {
-        temp_values_.emplace_front(
-            shared_model::interface::RolePermissionSet({permission})
-                .toBitstring());
-        statement_.exchange(soci::use(temp_values_.front(), argument_name));
-        addArgumentToString(argument_name,
-                            perm_converter_->toString(permission));
-      }
-
-      void use(const std::string &argument_name, const Grantable &permission) {
-        temp_values_.emplace_front(
-            shared_model::interface::GrantablePermissionSet({permission})
-                .toBitstring());
-        statement_.exchange(soci::use(temp_values_.front(), argument_name));
-        addArgumentToString(argument_name,
-                            perm_converter_->toString(permission));
-      }
-
-      void use(
-          const std::string &argument_name,
-          const shared_model::interface::RolePermissionSet &permission_set) {
-        temp_values_.emplace_front(permission_set.toBitstring());
-        statement_.exchange(soci::use(temp_values_.front(), argument_name));
-        addArgumentToString(
-            argument_name,
-            boost::algorithm::join(perm_converter_->toString(permission_set),
-                                   ", "));
-      }
-
-      void use(const std::string &argument_name, bool value) {
-        statement_.exchange(
-            soci::use(value ? kPgTrue : kPgFalse, argument_name));
-        addArgumentToString(argument_name, std::to_string(value));
-      }
 
-      // TODO IR-597 mboldyrev 2019.08.10: build args string on demand
-      void addArgumentToString(const std::string &argument_name,
-                               const std::string &value) {
-        arguments_string_builder_.appendNamed(argument_name, value);
-      }
-
-      void addArgumentToString(const std::string &argument_name,
-                               const boost::optional<std::string> &value) {
-        if (value) {
-          addArgumentToString(argument_name, *value);
-        }
-      }
-
-      void addArgumentToString(const std::string &argument_name,
-                               const std::optional<std::string> &value) {
-        if (value) {
-          addArgumentToString(argument_name, *value);
-        }
-      }
-
-      template <typename T>
-      std::enable_if_t<std::is_arithmetic<T>::value> addArgumentToString(
-          const std::string &argument_name, const T &value) {
-        addArgumentToString(argument_name, std::to_string(value));
-      }
-
-      iroha::ametsuchi::CommandResult execute() noexcept {
-        try {
-          soci::row r;
-          statement_.define_and_bind();
-          statement_.exchange_for_rowset(soci::into(r));
-          statement_.execute();
-          auto result = statement_.fetch() ? r.get<int>(0) : 1;
-          statement_.bind_clean_up();
-          temp_values_.clear();
-          if (result != 0) {
-            return makeCommandError(
-                command_name_, result, arguments_string_builder_.finalize());
-          }
-          return {};
-        } catch (const std::exception &e) {
-          statement_.bind_clean_up();
-          temp_values_.clear();
-          return getCommandError(
-              command_name_, e.what(), arguments_string_builder_.finalize());
-        }
-      }
-
-     private:
-      soci::statement &statement_;
-      std::string command_name_;
-      std::shared_ptr<shared_model::interface::PermissionToString>
-          perm_converter_;
-      shared_model::detail::PrettyStringBuilder arguments_string_builder_;
-      std::forward_list<std::string> temp_values_;
-    };
-
-    std::unique_ptr<PostgresCommandExecutor::CommandStatements>
-    PostgresCommandExecutor::makeCommandStatements(
-        const std::unique_ptr<soci::session> &session,
-        const std::string &base_statement,
-        const std::vector<std::string> &permission_checks) {
-      return std::make_unique<CommandStatements>(
-          *session, base_statement, permission_checks);
+  /**
+   * Fully formatted SQL texts of one command statement: the variant with the
+   * permission checks spliced in and the variant with the checks removed.
+   */
+  struct StatementText {
+    std::string with_validation;
+    std::string without_validation;
+  };
+
+  /// the statement texts of every command, one per CommandStatements member
+  struct StatementRegistry {
+    StatementText add_asset_quantity;
+    StatementText add_peer;
+    StatementText add_signatory;
+    StatementText append_role;
+    StatementText compare_and_set_account_detail;
+    StatementText create_account;
+    StatementText create_asset;
+    StatementText create_domain;
+    StatementText create_role;
+    StatementText detach_role;
+    StatementText grant_permission;
+    StatementText remove_peer;
+    StatementText remove_signatory;
+    StatementText revoke_permission;
+    StatementText set_account_detail;
+    StatementText set_quorum;
+    StatementText store_engine_response;
+    StatementText subtract_asset_quantity;
+    StatementText transfer_asset;
+    StatementText set_setting_value;
+  };
+
+  StatementText makeStatementText(
+      const std::string &base_statement,
+      const std::vector<std::string> &permission_checks) {
+    auto with_validation = boost::format(base_statement);
+    for (const auto &check : permission_checks) {
+      with_validation = with_validation % check;
+    }
+    auto without_validation = boost::format(base_statement);
+    for (size_t i = 0; i < permission_checks.size(); i++) {
+      without_validation = without_validation % "";
     }
+    return StatementText{with_validation.str(), without_validation.str()};
+  }
 
-    void PostgresCommandExecutor::initStatements() {
-      // TODO [IR-1830] Akvinikym 31.10.18: make benchmarks to compare exception
-      // parsing vs nested queries
-      // 14.09.18 nickaleks: IR-1708 Load SQL from separate files
-      add_asset_quantity_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+  StatementRegistry buildStatementRegistry() {
+    StatementRegistry registry;
+    // TODO [IR-1830] Akvinikym 31.10.18: make benchmarks to compare exception
+    // parsing vs nested queries
+    // 14.09.18 nickaleks: IR-1708 Load SQL from separate files
+    registry.add_asset_quantity = makeStatementText(
+        R"(
           WITH %s
              new_quantity AS
              (
@@ -555,26 +438,32 @@ namespace iroha {
                 )
                 ON CONFLICT (account_id, asset_id) DO UPDATE
                 SET amount = EXCLUDED.amount
-                RETURNING (1)
+                RETURNING (xmax = 0) AS is_new
+             ),
+             counted AS -- keep account.assets_count in sync with new rows
+             (
+                UPDATE account
+                SET assets_count = assets_count + 1
+                WHERE account_id = :creator
+                    AND EXISTS (SELECT * FROM inserted WHERE is_new)
              )
           SELECT CASE
               %s
               WHEN EXISTS (SELECT * FROM inserted LIMIT 1) THEN 0
               ELSE (SELECT code FROM checks WHERE not result ORDER BY code ASC LIMIT 1)
           END AS result;)",
-          {(boost::format(R"(has_perm AS (%s),)")
-            % checkAccountDomainRoleOrGlobalRolePermission(
-                  Role::kAddAssetQty,
-                  Role::kAddDomainAssetQty,
-                  ":creator",
-                  ":asset_id"))
-               .str(),
-           "AND (SELECT * from has_perm)",
-           "WHEN NOT (SELECT * from has_perm) THEN 2"});
-
-      add_peer_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+        {(boost::format(R"(has_perm AS (%s),)")
+          % checkAccountDomainRoleOrGlobalRolePermission(
+                Role::kAddAssetQty,
+                Role::kAddDomainAssetQty,
+                ":creator",
+                ":asset_id"))
+             .str(),
+         "AND (SELECT * from has_perm)",
+         "WHEN NOT (SELECT * from has_perm) THEN 2"});
+
+    registry.add_peer = makeStatementText(
+        R"(
           WITH %s
             inserted AS (
                 INSERT INTO peer(public_key, address, tls_certificate)
@@ -586,15 +475,14 @@ namespace iroha {
           SELECT CASE WHEN EXISTS (SELECT * FROM inserted) THEN 0
               %s
               ELSE 1 END AS result)",
-          {(boost::format(R"(has_perm AS (%s),)")
-            % checkAccountRolePermission(Role::kAddPeer, ":creator"))
-               .str(),
-           "WHERE (SELECT * FROM has_perm)",
-           "WHEN NOT (SELECT * from has_perm) THEN 2"});
-
-      add_signatory_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+        {(boost::format(R"(has_perm AS (%s),)")
+          % checkAccountRolePermission(Role::kAddPeer, ":creator"))
+             .str(),
+         "WHERE (SELECT * FROM has_perm)",
+         "WHEN NOT (SELECT * from has_perm) THEN 2"});
+
+    registry.add_signatory = makeStatementText(
+        R"(
           WITH %s
             insert_signatory AS
             (
@@ -618,19 +506,18 @@ namespace iroha {
             %s
             ELSE 1
           END AS RESULT;)",
-          {(boost::format(R"(
+        {(boost::format(R"(
                                 has_perm AS (%s),)")
-            % checkAccountHasRoleOrGrantablePerm(Role::kAddSignatory,
-                                                 Grantable::kAddMySignatory,
-                                                 ":creator",
-                                                 ":target"))
-               .str(),
-           "WHERE (SELECT * FROM has_perm)",
-           "WHEN NOT (SELECT * from has_perm) THEN 2"});
-
-      append_role_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+          % checkAccountHasRoleOrGrantablePerm(Role::kAddSignatory,
+                                               Grantable::kAddMySignatory,
+                                               ":creator",
+                                               ":target"))
+             .str(),
+         "WHERE (SELECT * FROM has_perm)",
+         "WHEN NOT (SELECT * from has_perm) THEN 2"});
+
+    registry.append_role = makeStatementText(
+        R"(
           WITH %s
             role_exists AS (SELECT * FROM role WHERE role_id = :role),
             inserted AS (
@@ -644,7 +531,7 @@ namespace iroha {
             %s
             ELSE 1
           END AS result)",
-          {(boost::format(R"(
+        {(boost::format(R"(
             has_perm AS (%1%),
             has_root_perm AS (%2%),
             role_permissions AS (
@@ -662,24 +549,23 @@ namespace iroha {
                 JOIN account_has_roles AS ar on ar.role_id = rp.role_id
                 WHERE ar.account_id = :creator
             ),)")
-            % checkAccountRolePermission(Role::kAppendRole, ":creator")
-            % checkAccountRolePermission(Role::kRoot, ":creator")
-            % kRolePermissionSetSize)
-               .str(),
-           R"(WHERE
+          % checkAccountRolePermission(Role::kAppendRole, ":creator")
+          % checkAccountRolePermission(Role::kRoot, ":creator")
+          % kRolePermissionSetSize)
+             .str(),
+         R"(WHERE
               (SELECT * FROM has_root_perm)
               OR (EXISTS (SELECT * FROM account_roles) AND
               (SELECT * FROM account_has_role_permissions)
               AND (SELECT * FROM has_perm)))",
-           R"(WHEN NOT EXISTS (SELECT * FROM account_roles)
+         R"(WHEN NOT EXISTS (SELECT * FROM account_roles)
                   AND NOT (SELECT * FROM has_root_perm) THEN 2
               WHEN NOT (SELECT * FROM account_has_role_permissions)
                   AND NOT (SELECT * FROM has_root_perm) THEN 2
               WHEN NOT (SELECT * FROM has_perm) THEN 2)"});
 
-      compare_and_set_account_detail_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+    registry.compare_and_set_account_detail = makeStatementText(
+        R"(
           WITH %s
             old_value AS
             (
@@ -721,7 +607,7 @@ namespace iroha {
               %s
               ELSE 1
           END AS result)",
-          {(boost::format(R"(
+        {(boost::format(R"(
               has_role_perm AS (%s),
               has_grantable_perm AS (%s),
               %s,
@@ -739,24 +625,22 @@ namespace iroha {
                       ELSE false END
               ),
               )")
-            % checkAccountRolePermission(Role::kSetDetail, ":creator")
-            % checkAccountGrantablePermission(
-                  Grantable::kSetMyAccountDetail, ":creator", ":target")
-            % hasQueryPermission(":creator",
-                                 ":target",
-                                 Role::kGetMyAccDetail,
-                                 Role::kGetAllAccDetail,
-                                 Role::kGetDomainAccDetail,
-                                 ":creator_domain",
-                                 ":target_domain"))
-               .str(),
-           R"( AND (SELECT * FROM has_perm))",
-           R"( WHEN NOT (SELECT * FROM has_perm) THEN 2 )"});
-
-      create_account_statements_ =
-          makeCommandStatements(
-              sql_,
-              R"(
+          % checkAccountRolePermission(Role::kSetDetail, ":creator")
+          % checkAccountGrantablePermission(
+                Grantable::kSetMyAccountDetail, ":creator", ":target")
+          % hasQueryPermission(":creator",
+                               ":target",
+                               Role::kGetMyAccDetail,
+                               Role::kGetAllAccDetail,
+                               Role::kGetDomainAccDetail,
+                               ":creator_domain",
+                               ":target_domain"))
+             .str(),
+         R"( AND (SELECT * FROM has_perm))",
+         R"( WHEN NOT (SELECT * FROM has_perm) THEN 2 )"});
+
+    registry.create_account = makeStatementText(
+            R"(
           WITH get_domain_default_role AS (SELECT default_role FROM domain
                                              WHERE domain_id = :domain),
             %s
@@ -805,7 +689,7 @@ namespace iroha {
             %s
             ELSE 1
           END AS result)",
-              {(boost::format(R"(
+            {(boost::format(R"(
            domain_role_permissions_bits AS (
                  SELECT COALESCE(bit_or(rhp.permission), '0'::bit(%1%)) AS bits
                  FROM role_has_permissions AS rhp
@@ -826,17 +710,16 @@ namespace iroha {
            ),
            has_perm AS (%2%),
           )") % kRolePermissionSetSize
-                % checkAccountRolePermission(Role::kCreateAccount, ":creator")
-                % checkAccountRolePermission(Role::kRoot, ":creator"))
-                   .str(),
-               R"(AND (SELECT * FROM has_perm)
+              % checkAccountRolePermission(Role::kCreateAccount, ":creator")
+              % checkAccountRolePermission(Role::kRoot, ":creator"))
+                 .str(),
+             R"(AND (SELECT * FROM has_perm)
                 AND (SELECT * FROM creator_has_enough_permissions))",
-               R"(WHEN NOT (SELECT * FROM has_perm) THEN 2
+             R"(WHEN NOT (SELECT * FROM has_perm) THEN 2
                 WHEN NOT (SELECT * FROM creator_has_enough_permissions) THEN 2)"});
 
-      create_asset_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+    registry.create_asset = makeStatementText(
+        R"(
           WITH %s
             inserted AS
             (
@@ -851,16 +734,15 @@ namespace iroha {
             %s
             ELSE 1
           END AS result)",
-          {(boost::format(R"(
+        {(boost::format(R"(
               has_perm AS (%s),)")
-            % checkAccountRolePermission(Role::kCreateAsset, ":creator"))
-               .str(),
-           R"(WHERE (SELECT * FROM has_perm))",
-           R"(WHEN NOT (SELECT * FROM has_perm) THEN 2)"});
-
-      create_domain_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+          % checkAccountRolePermission(Role::kCreateAsset, ":creator"))
+             .str(),
+         R"(WHERE (SELECT * FROM has_perm))",
+         R"(WHEN NOT (SELECT * FROM has_perm) THEN 2)"});
+
+    registry.create_domain = makeStatementText(
+        R"(
           WITH %s
             inserted AS
             (
@@ -875,16 +757,15 @@ namespace iroha {
             %s
             ELSE 1
           END AS result)",
-          {(boost::format(R"(
+        {(boost::format(R"(
               has_perm AS (%s),)")
-            % checkAccountRolePermission(Role::kCreateDomain, ":creator"))
-               .str(),
-           R"(WHERE (SELECT * FROM has_perm))",
-           R"(WHEN NOT (SELECT * FROM has_perm) THEN 2)"});
-
-      create_role_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+          % checkAccountRolePermission(Role::kCreateDomain, ":creator"))
+             .str(),
+         R"(WHERE (SELECT * FROM has_perm))",
+         R"(WHEN NOT (SELECT * FROM has_perm) THEN 2)"});
+
+    registry.create_role = makeStatementText(
+        R"(
           WITH %s
             insert_role AS (INSERT INTO role(role_id)
                                 (SELECT :role
@@ -903,7 +784,7 @@ namespace iroha {
             WHEN EXISTS (SELECT * FROM role WHERE role_id = :role) THEN 2
             ELSE 1
           END AS result)",
-          {(boost::format(R"(
+        {(boost::format(R"(
           account_has_role_permissions AS (
                 SELECT COALESCE(bit_or(rp.permission), '0'::bit(%s)) &
                     :perms = :perms
@@ -912,20 +793,19 @@ namespace iroha {
                 WHERE ar.account_id = :creator),
           has_perm AS (%s),
           has_root_perm AS (%s),)")
-            % kRolePermissionSetSize
-            % checkAccountRolePermission(Role::kCreateRole, ":creator")
-            % checkAccountRolePermission(Role::kRoot, ":creator"))
-               .str(),
-           R"(WHERE (SELECT * FROM has_root_perm) OR
+          % kRolePermissionSetSize
+          % checkAccountRolePermission(Role::kCreateRole, ":creator")
+          % checkAccountRolePermission(Role::kRoot, ":creator"))
+             .str(),
+         R"(WHERE (SELECT * FROM has_root_perm) OR
                     ((SELECT * FROM account_has_role_permissions)
                      AND (SELECT * FROM has_perm)))",
-           R"(WHEN NOT (SELECT * FROM account_has_role_permissions)
+         R"(WHEN NOT (SELECT * FROM account_has_role_permissions)
                AND NOT (SELECT * FROM has_root_perm) THEN 2
               WHEN NOT (SELECT * FROM has_perm) THEN 2)"});
 
-      detach_role_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+    registry.detach_role = makeStatementText(
+        R"(
           WITH %s
             deleted AS
             (
@@ -946,16 +826,15 @@ namespace iroha {
             %s
             ELSE 1
           END AS result)",
-          {(boost::format(R"(
+        {(boost::format(R"(
             has_perm AS (%s),)")
-            % checkAccountRolePermission(Role::kDetachRole, ":creator"))
-               .str(),
-           R"(AND (SELECT * FROM has_perm))",
-           R"(WHEN NOT (SELECT * FROM has_perm) THEN 2)"});
-
-      grant_permission_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+          % checkAccountRolePermission(Role::kDetachRole, ":creator"))
+             .str(),
+         R"(AND (SELECT * FROM has_perm))",
+         R"(WHEN NOT (SELECT * FROM has_perm) THEN 2)"});
+
+    registry.grant_permission = makeStatementText(
+        R"(
           WITH %s
             inserted AS (
               INSERT INTO account_has_grantable_permissions AS
@@ -971,15 +850,15 @@ namespace iroha {
             %s
             ELSE 1
           END AS result)",
-          {(boost::format(R"(
+        {(boost::format(R"(
             has_perm AS (%s),)")
-            % checkAccountRolePermission(":required_perm", ":creator"))
-               .str(),
-           R"( WHERE (SELECT * FROM has_perm))",
-           R"(WHEN NOT (SELECT * FROM has_perm) THEN 2)"});
+          % checkAccountRolePermission(":required_perm", ":creator"))
+             .str(),
+         R"( WHERE (SELECT * FROM has_perm))",
+         R"(WHEN NOT (SELECT * FROM has_perm) THEN 2)"});
 
-      remove_peer_statements_ = makeCommandStatements(sql_,
-                                                      R"(
+    registry.remove_peer = makeStatementText(
+        R"(
           WITH %s
           removed AS (
               DELETE FROM peer WHERE public_key = lower(:pubkey)
@@ -991,7 +870,7 @@ namespace iroha {
             %s
             ELSE 1
           END AS result)",
-                                                      {(boost::format(R"(
+                                                    {(boost::format(R"(
             has_perm AS (%s),
             get_peer AS (
               SELECT * from peer WHERE public_key = lower(:pubkey) LIMIT 1
@@ -999,19 +878,18 @@ namespace iroha {
             check_peers AS (
               SELECT 1 WHERE (SELECT COUNT(*) FROM peer) > 1
             ),)") % checkAccountRolePermission(Role::kRemovePeer, ":creator"))
-                                                           .str(),
-                                                       R"(
+                                                         .str(),
+                                                     R"(
              AND (SELECT * FROM has_perm)
              AND EXISTS (SELECT * FROM get_peer)
              AND EXISTS (SELECT * FROM check_peers))",
-                                                       R"(
+                                                     R"(
              WHEN NOT EXISTS (SELECT * from get_peer) THEN 3
              WHEN NOT EXISTS (SELECT * from check_peers) THEN 4
              WHEN NOT (SELECT * from has_perm) THEN 2)"});
 
-      remove_signatory_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+    registry.remove_signatory = makeStatementText(
+        R"(
           WITH %s
             delete_account_signatory AS (DELETE FROM account_has_signatory
                 WHERE account_id = :target
@@ -1040,7 +918,7 @@ namespace iroha {
             %s
             ELSE 1
           END AS result)",
-          {(boost::format(R"(
+        {(boost::format(R"(
           has_perm AS (%s),
           get_account AS (
               SELECT quorum FROM account WHERE account_id = :target LIMIT 1
@@ -1058,27 +936,26 @@ namespace iroha {
               WHERE quorum < (SELECT COUNT(*) FROM get_signatories)
           ),
           )")
-            % checkAccountHasRoleOrGrantablePerm(Role::kRemoveSignatory,
-                                                 Grantable::kRemoveMySignatory,
-                                                 ":creator",
-                                                 ":target"))
-               .str(),
-           R"(
+          % checkAccountHasRoleOrGrantablePerm(Role::kRemoveSignatory,
+                                               Grantable::kRemoveMySignatory,
+                                               ":creator",
+                                               ":target"))
+             .str(),
+         R"(
               AND (SELECT * FROM has_perm)
               AND EXISTS (SELECT * FROM get_account)
               AND EXISTS (SELECT * FROM get_signatories)
               AND EXISTS (SELECT * FROM check_account_signatories)
           )",
-           R"(
+         R"(
               WHEN NOT EXISTS (SELECT * FROM get_account) THEN 3
               WHEN NOT (SELECT * FROM has_perm) THEN 2
               WHEN NOT EXISTS (SELECT * FROM get_signatory) THEN 4
               WHEN NOT EXISTS (SELECT * FROM check_account_signatories) THEN 5
           )"});
 
-      revoke_permission_statements_ = makeCommandStatements(
-          sql_,
-          (boost::format(R"(
+    registry.revoke_permission = makeStatementText(
+        (boost::format(R"(
           WITH %%s
             inserted AS (
                 UPDATE account_has_grantable_permissions as has_perm
@@ -1099,9 +976,9 @@ namespace iroha {
             %%s
             ELSE 1
           END AS result)")
-           % kGrantablePermissionSetSize)
-              .str(),
-          {(boost::format(R"(
+         % kGrantablePermissionSetSize)
+            .str(),
+        {(boost::format(R"(
             has_perm AS (
               SELECT
                   (
@@ -1112,14 +989,13 @@ namespace iroha {
               FROM account_has_grantable_permissions
               WHERE account_id = :creator AND
               permittee_account_id = :target),)")
-            % kGrantablePermissionSetSize)
-               .str(),
-           R"( AND (SELECT * FROM has_perm))",
-           R"( WHEN NOT (SELECT * FROM has_perm) THEN 2 )"});
-
-      set_account_detail_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+          % kGrantablePermissionSetSize)
+             .str(),
+         R"( AND (SELECT * FROM has_perm))",
+         R"( WHEN NOT (SELECT * FROM has_perm) THEN 2 )"});
+
+    registry.set_account_detail = makeStatementText(
+        R"(
           WITH %s
             inserted AS
             (
@@ -1136,7 +1012,7 @@ namespace iroha {
             %s
             ELSE 1
           END AS result)",
-          {(boost::format(R"(
+        {(boost::format(R"(
               has_role_perm AS (%s),
               has_grantable_perm AS (%s),
               has_perm AS (SELECT CASE
@@ -1146,16 +1022,15 @@ namespace iroha {
                                ELSE false END
               ),
               )")
-            % checkAccountRolePermission(Role::kSetDetail, ":creator")
-            % checkAccountGrantablePermission(
-                  Grantable::kSetMyAccountDetail, ":creator", ":target"))
-               .str(),
-           R"( AND (SELECT * FROM has_perm))",
-           R"( WHEN NOT (SELECT * FROM has_perm) THEN 2 )"});
-
-      set_quorum_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+          % checkAccountRolePermission(Role::kSetDetail, ":creator")
+          % checkAccountGrantablePermission(
+                Grantable::kSetMyAccountDetail, ":creator", ":target"))
+             .str(),
+         R"( AND (SELECT * FROM has_perm))",
+         R"( WHEN NOT (SELECT * FROM has_perm) THEN 2 )"});
+
+    registry.set_quorum = makeStatementText(
+        R"(
           WITH %s
             updated AS (
                 UPDATE account SET quorum=:quorum
@@ -1168,7 +1043,7 @@ namespace iroha {
             %s
             ELSE 1
           END AS result)",
-          {(boost::format(R"(
+        {(boost::format(R"(
             get_signatories AS (
                 SELECT public_key FROM account_has_signatory
                 WHERE account_id = :target
@@ -1179,23 +1054,23 @@ namespace iroha {
                 AND account_id = :target
             ),
             has_perm AS (%s),)")
-            % checkAccountHasRoleOrGrantablePerm(Role::kSetQuorum,
-                                                 Grantable::kSetMyQuorum,
-                                                 ":creator",
-                                                 ":target"))
-               .str(),
-           R"(AND EXISTS
+          % checkAccountHasRoleOrGrantablePerm(Role::kSetQuorum,
+                                               Grantable::kSetMyQuorum,
+                                               ":creator",
+                                               ":target"))
+             .str(),
+         R"(AND EXISTS
               (SELECT * FROM get_signatories)
               AND EXISTS (SELECT * FROM check_account_signatories)
               AND (SELECT * FROM has_perm))",
-           R"(
+         R"(
               WHEN NOT (SELECT * FROM has_perm) THEN 2
               WHEN NOT EXISTS (SELECT * FROM get_signatories) THEN 4
               WHEN NOT EXISTS (SELECT * FROM check_account_signatories) THEN 5
               )"});
 
-      store_engine_response_statements_ = makeCommandStatements(sql_,
-                                                                R"(
+    registry.store_engine_response = makeStatementText(
+        R"(
           WITH
             inserted AS (
               INSERT INTO engine_calls
@@ -1219,11 +1094,10 @@ namespace iroha {
             WHEN EXISTS (SELECT * FROM inserted) THEN 0
             ELSE 1
           END AS result)",
-                                                                {});
+                                                              {});
 
-      subtract_asset_quantity_statements_ = makeCommandStatements(
-          sql_,
-          R"(
+    registry.subtract_asset_quantity = makeStatementText(
+        R"(
           WITH %s
             has_account AS (SELECT account_id FROM account
                             WHERE account_id = :creator LIMIT 1),
@@ -1243,6 +1117,8 @@ namespace iroha {
                        ),
             inserted AS
             (
+               -- never adds a row (value >= 0 requires an existing balance),
+               -- so account.assets_count needs no maintenance here
                INSERT INTO account_has_asset(account_id, asset_id, amount)
                (
                    SELECT :creator, :asset_id, value FROM new_value
@@ -1263,21 +1139,20 @@ namespace iroha {
                   (SELECT value FROM new_value WHERE value >= 0 LIMIT 1) THEN 4
               ELSE 1
           END AS result)",
-          {(boost::format(R"(
+        {(boost::format(R"(
                has_perm AS (%s),)")
-            % checkAccountDomainRoleOrGlobalRolePermission(
-                  Role::kSubtractAssetQty,
-                  Role::kSubtractDomainAssetQty,
-                  ":creator",
-                  ":asset_id"))
-               .str(),
-           R"( AND (SELECT * FROM has_perm))",
-           R"( WHEN NOT (SELECT * FROM has_perm) THEN 2 )"});
-
-      transfer_asset_statements_ = makeCommandStatements(
-          sql_,
-          fmt::format(
-              R"(
+          % checkAccountDomainRoleOrGlobalRolePermission(
+                Role::kSubtractAssetQty,
+                Role::kSubtractDomainAssetQty,
+                ":creator",
+                ":asset_id"))
+             .str(),
+         R"( AND (SELECT * FROM has_perm))",
+         R"( WHEN NOT (SELECT * FROM has_perm) THEN 2 )"});
+
+    registry.transfer_asset = makeStatementText(
+        fmt::format(
+            R"(
           WITH %s
             new_src_quantity AS
             (
@@ -1352,15 +1227,22 @@ namespace iroha {
                 )
                 ON CONFLICT (account_id, asset_id)
                 DO UPDATE SET amount = EXCLUDED.amount
-                RETURNING (1)
+                RETURNING (xmax = 0) AS is_new
+            ),
+            count_dest AS -- keep account.assets_count in sync with new rows
+            (
+                UPDATE account
+                SET assets_count = assets_count + 1
+                WHERE account_id = :dest_account_id
+                    AND EXISTS (SELECT * FROM insert_dest WHERE is_new)
             )
           SELECT CASE
               WHEN EXISTS (SELECT * FROM insert_dest LIMIT 1) THEN 0
               %s
               ELSE (SELECT code FROM checks WHERE not result ORDER BY code ASC LIMIT 1)
           END AS result)",
-              iroha::ametsuchi::kMaxDescriptionSizeKey),
-          {(boost::format(R"(
+            iroha::ametsuchi::kMaxDescriptionSizeKey),
+        {(boost::format(R"(
               has_role_perm AS (%s),
               has_grantable_perm AS (%s),
               dest_can_receive AS (%s),
@@ -1380,19 +1262,18 @@ namespace iroha {
                       ELSE false END
               ),
               )")
-            % checkAccountRolePermission(Role::kTransfer, ":creator")
-            % checkAccountGrantablePermission(Grantable::kTransferMyAssets,
-                                              ":creator",
-                                              ":source_account_id")
-            % checkAccountRolePermission(Role::kReceive, ":dest_account_id"))
-               .str(),
-           R"( AND (SELECT * FROM has_perm))",
-           R"( AND (SELECT * FROM has_perm))",
-           R"( WHEN NOT (SELECT * FROM has_perm) THEN 2 )"});
-
-      set_setting_value_statements_ = makeCommandStatements(
-          sql_,
-          R"(INSERT INTO setting(setting_key, setting_value)
+          % checkAccountRolePermission(Role::kTransfer, ":creator")
+          % checkAccountGrantablePermission(Grantable::kTransferMyAssets,
+                                            ":creator",
+                                            ":source_account_id")
+          % checkAccountRolePermission(Role::kReceive, ":dest_account_id"))
+             .str(),
+         R"( AND (SELECT * FROM has_perm))",
+         R"( AND (SELECT * FROM has_perm))",
+         R"( WHEN NOT (SELECT * FROM has_perm) THEN 2 )"});
+
+    registry.set_setting_value = makeStatementText(
+        R"(INSERT INTO setting(setting_key, setting_value)
              VALUES
              (
                  :setting_key,
@@ -1401,7 +1282,202 @@ namespace iroha {
              ON CONFLICT (setting_key)
                  DO UPDATE SET setting_value = EXCLUDED.setting_value
              RETURNING 0)",
-          {});
+        {});
+    return registry;
+  }
+
+  /**
+   * The statement texts depend only on compile-time constants, so they are
+   * formatted once per process; executor construction is reduced to looking
+   * the texts up here and preparing them on its session.
+   */
+  const StatementRegistry &statementRegistry() {
+    static const StatementRegistry registry = buildStatementRegistry();
+    return registry;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+    class PostgresCommandExecutor::CommandStatements {
+     public:
+      CommandStatements(soci::session &session, const StatementText &text)
+          : statement_with_validation(session.prepare << text.with_validation),
+            statement_without_validation(session.prepare
+                                         << text.without_validation) {}
+
+      soci::statement &getStatement(bool with_validation) {
+        return with_validation ? statement_with_validation
+                               : statement_without_validation;
+      }
+
+     private:
+      soci::statement statement_with_validation;
+      soci::statement statement_without_validation;
+    };
+
+    class PostgresCommandExecutor::StatementExecutor {
+     public:
+      StatementExecutor(
+          std::unique_ptr<CommandStatements> &statements,
+          bool enable_validation,
+          std::string command_name,
+          std::shared_ptr<shared_model::interface::PermissionToString>
+              perm_converter,
+          CommandTemporaries &temporaries)
+          : statement_(statements->getStatement(enable_validation)),
+            command_name_(std::move(command_name)),
+            perm_converter_(std::move(perm_converter)),
+            temporaries_(temporaries),
+            arguments_string_builder_(temporaries.arguments_string_builder) {
+        temporaries_.reset();
+        arguments_string_builder_.init(command_name_)
+            .appendNamed("Validation", enable_validation);
+      }
+
+      template <typename T,
+                typename = decltype(soci::use(std::declval<T>(),
+                                              std::string{}))>
+      void use(const std::string &argument_name, const T &value) {
+        statement_.exchange(soci::use(value, argument_name));
+        addArgumentToString(argument_name, value);
+      }
+
+      void use(const std::string &argument_name, const Role &permission) {
+        auto &temp_value = temporaries_.nextTempValue();
+        temp_value = shared_model::interface::RolePermissionSet({permission})
+                         .toBitstring();
+        statement_.exchange(soci::use(temp_value, argument_name));
+        addArgumentToString(argument_name,
+                            perm_converter_->toString(permission));
+      }
+
+      void use(const std::string &argument_name, const Grantable &permission) {
+        auto &temp_value = temporaries_.nextTempValue();
+        temp_value =
+            shared_model::interface::GrantablePermissionSet({permission})
+                .toBitstring();
+        statement_.exchange(soci::use(temp_value, argument_name));
+        addArgumentToString(argument_name,
+                            perm_converter_->toString(permission));
+      }
+
+      void use(
+          const std::string &argument_name,
+          const shared_model::interface::RolePermissionSet &permission_set) {
+        auto &temp_value = temporaries_.nextTempValue();
+        temp_value = permission_set.toBitstring();
+        statement_.exchange(soci::use(temp_value, argument_name));
+        addArgumentToString(
+            argument_name,
+            boost::algorithm::join(perm_converter_->toString(permission_set),
+                                   ", "));
+      }
+
+      void use(const std::string &argument_name, bool value) {
+        statement_.exchange(
+            soci::use(value ? kPgTrue : kPgFalse, argument_name));
+        addArgumentToString(argument_name, std::to_string(value));
+      }
+
+      // TODO IR-597 mboldyrev 2019.08.10: build args string on demand
+      void addArgumentToString(const std::string &argument_name,
+                               const std::string &value) {
+        arguments_string_builder_.appendNamed(argument_name, value);
+      }
+
+      void addArgumentToString(const std::string &argument_name,
+                               const boost::optional<std::string> &value) {
+        if (value) {
+          addArgumentToString(argument_name, *value);
+        }
+      }
+
+      void addArgumentToString(const std::string &argument_name,
+                               const std::optional<std::string> &value) {
+        if (value) {
+          addArgumentToString(argument_name, *value);
+        }
+      }
+
+      template <typename T>
+      std::enable_if_t<std::is_arithmetic<T>::value> addArgumentToString(
+          const std::string &argument_name, const T &value) {
+        addArgumentToString(argument_name, std::to_string(value));
+      }
+
+      iroha::ametsuchi::CommandResult execute() noexcept {
+        try {
+          soci::row r;
+          statement_.define_and_bind();
+          statement_.exchange_for_rowset(soci::into(r));
+          statement_.execute();
+          auto result = statement_.fetch() ? r.get<int>(0) : 1;
+          statement_.bind_clean_up();
+          if (result != 0) {
+            return makeCommandError(
+                command_name_, result, arguments_string_builder_.finalize());
+          }
+          return {};
+        } catch (const std::exception &e) {
+          statement_.bind_clean_up();
+          return getCommandError(
+              command_name_, e.what(), arguments_string_builder_.finalize());
+        }
+      }
+
+     private:
+      soci::statement &statement_;
+      std::string command_name_;
+      std::shared_ptr<shared_model::interface::PermissionToString>
+          perm_converter_;
+      CommandTemporaries &temporaries_;
+      shared_model::detail::PrettyStringBuilder &arguments_string_builder_;
+    };
+
+    void PostgresCommandExecutor::initStatements() {
+      const auto &registry = statementRegistry();
+      add_asset_quantity_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.add_asset_quantity);
+      add_peer_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.add_peer);
+      add_signatory_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.add_signatory);
+      append_role_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.append_role);
+      compare_and_set_account_detail_statements_ =
+          std::make_unique<CommandStatements>(
+              *sql_, registry.compare_and_set_account_detail);
+      create_account_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.create_account);
+      create_asset_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.create_asset);
+      create_domain_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.create_domain);
+      create_role_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.create_role);
+      detach_role_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.detach_role);
+      grant_permission_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.grant_permission);
+      remove_peer_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.remove_peer);
+      remove_signatory_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.remove_signatory);
+      revoke_permission_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.revoke_permission);
+      set_account_detail_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.set_account_detail);
+      set_quorum_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.set_quorum);
+      store_engine_response_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.store_engine_response);
+      subtract_asset_quantity_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.subtract_asset_quantity);
+      transfer_asset_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.transfer_asset);
+      set_setting_value_statements_ = std::make_unique<CommandStatements>(
+          *sql_, registry.set_setting_value);
     }
 
     std::string CommandError::toString() const {
@@ -1431,19 +1507,148 @@ namespace iroha {
         const std::string &tx_hash,
         shared_model::interface::types::CommandIndexType cmd_index,
         bool do_validation) {
+      const auto &command_variant = cmd.get();
+
+      // predicted dispatch: real workloads are dominated by asset
+      // transfers and quantity changes, so these alternatives are probed
+      // with direct, branch-predictable checks and only the cold rest of
+      // the commands pays for the full variant visitation
+      if (auto *transfer =
+              boost::get<const shared_model::interface::TransferAsset>(
+                  &command_variant)) {
+        return (*this)(
+            *transfer, creator_account_id, tx_hash, cmd_index, do_validation);
+      }
+      if (auto *add_asset =
+              boost::get<const shared_model::interface::AddAssetQuantity>(
+                  &command_variant)) {
+        return (*this)(
+            *add_asset, creator_account_id, tx_hash, cmd_index, do_validation);
+      }
+      if (auto *set_detail =
+              boost::get<const shared_model::interface::SetAccountDetail>(
+                  &command_variant)) {
+        return (*this)(
+            *set_detail, creator_account_id, tx_hash, cmd_index, do_validation);
+      }
+
       return boost::apply_visitor(
           [this, &creator_account_id, &tx_hash, cmd_index, do_validation](
               const auto &command) {
             return (*this)(
                 command, creator_account_id, tx_hash, cmd_index, do_validation);
           },
-          cmd.get());
+          command_variant);
+    }
+
+    namespace {
+      /**
+       * Precision of an amount string as the shared model defines it:
+       * the number of digits after the decimal separator.
+       * @return boost::none when the string is not a well-formed amount,
+       * so the caller falls back to the shared model path and its error
+       * handling
+       */
+      boost::optional<uint32_t> amountPrecision(const std::string &amount) {
+        if (amount.empty()) {
+          return boost::none;
+        }
+        auto dot_pos = std::string::npos;
+        for (size_t i = 0; i < amount.size(); ++i) {
+          const char c = amount[i];
+          if (c == '.') {
+            if (dot_pos != std::string::npos) {
+              return boost::none;
+            }
+            dot_pos = i;
+          } else if (not isdigit(static_cast<unsigned char>(c))) {
+            return boost::none;
+          }
+        }
+        if (dot_pos == 0 or dot_pos == amount.size() - 1) {
+          return boost::none;
+        }
+        return static_cast<uint32_t>(
+            dot_pos == std::string::npos ? 0 : amount.size() - dot_pos - 1);
+      }
+    }  // namespace
+
+    boost::optional<CommandResult> PostgresCommandExecutor::executeRaw(
+        const iroha::protocol::Command &cmd,
+        const shared_model::interface::types::AccountIdType
+            &creator_account_id,
+        const std::string &tx_hash,
+        shared_model::interface::types::CommandIndexType cmd_index,
+        bool do_validation) {
+      switch (cmd.command_case()) {
+        case iroha::protocol::Command::kTransferAsset: {
+          const auto &command = cmd.transfer_asset();
+          const auto precision = amountPrecision(command.amount());
+          if (not precision) {
+            break;
+          }
+          const uint32_t precision_value = *precision;
+          StatementExecutor executor(transfer_asset_statements_,
+                                     do_validation,
+                                     "TransferAsset",
+                                     perm_converter_, temporaries_);
+          executor.use("creator", creator_account_id);
+          executor.use("source_account_id", command.src_account_id());
+          executor.use("dest_account_id", command.dest_account_id());
+          executor.use("asset_id", command.asset_id());
+          executor.use("quantity", command.amount());
+          executor.use("precision", precision_value);
+          executor.use("description_length", command.description().size());
+          return executor.execute();
+        }
+        case iroha::protocol::Command::kAddAssetQuantity: {
+          const auto &command = cmd.add_asset_quantity();
+          const auto precision = amountPrecision(command.amount());
+          if (not precision) {
+            break;
+          }
+          const int precision_value = *precision;
+          StatementExecutor executor(add_asset_quantity_statements_,
+                                     do_validation,
+                                     "AddAssetQuantity",
+                                     perm_converter_, temporaries_);
+          executor.use("creator", creator_account_id);
+          executor.use("asset_id", command.asset_id());
+          executor.use("precision", precision_value);
+          executor.use("quantity", command.amount());
+          return executor.execute();
+        }
+        case iroha::protocol::Command::kSubtractAssetQuantity: {
+          const auto &command = cmd.subtract_asset_quantity();
+          const auto precision = amountPrecision(command.amount());
+          if (not precision) {
+            break;
+          }
+          const uint32_t precision_value = *precision;
+          StatementExecutor executor(subtract_asset_quantity_statements_,
+                                     do_validation,
+                                     "SubtractAssetQuantity",
+                                     perm_converter_, temporaries_);
+          executor.use("creator", creator_account_id);
+          executor.use("asset_id", command.asset_id());
+          executor.use("quantity", command.amount());
+          executor.use("precision", precision_value);
+          return executor.execute();
+        }
+        default:
+          break;
+      }
+      return boost::none;
     }
 
     soci::session &PostgresCommandExecutor::getSession() {
       return *sql_;
     }
 
+    std::unique_ptr<PostgresPipeline> PostgresCommandExecutor::makePipeline() {
+      return std::make_unique<PostgresPipeline>(*sql_);
+    }
+
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AddAssetQuantity &command,
         const shared_model::interface::types::AccountIdType &creator_account_id,
@@ -1457,7 +1662,7 @@ namespace iroha {
       StatementExecutor executor(add_asset_quantity_statements_,
                                  do_validation,
                                  "AddAssetQuantity",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("asset_id", asset_id);
       executor.use("precision", precision);
@@ -1475,7 +1680,7 @@ namespace iroha {
       auto &peer = command.peer();
 
       StatementExecutor executor(
-          add_peer_statements_, do_validation, "AddPeer", perm_converter_);
+          add_peer_statements_, do_validation, "AddPeer", perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("address", peer.address());
       executor.use("pubkey", peer.pubkey());
@@ -1496,7 +1701,7 @@ namespace iroha {
       StatementExecutor executor(add_signatory_statements_,
                                  do_validation,
                                  "AddSignatory",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("target", target);
       executor.use("pubkey", pubkey);
@@ -1516,7 +1721,7 @@ namespace iroha {
       StatementExecutor executor(append_role_statements_,
                                  do_validation,
                                  "AppendRole",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("target", target);
       executor.use("role", role);
@@ -1566,11 +1771,16 @@ namespace iroha {
                   *specific_query_executor_)
               .match(
                   [&](const auto &value) -> CommandResult {
+                    if (auto e = expected::resultToOptionalError(
+                            burrow_storage.flush())) {
+                      return makeCommandError(
+                          "CallEngine", 3, std::move(e.value()));
+                    }
                     StatementExecutor executor(
                         store_engine_response_statements_,
                         false,
                         "StoreEngineReceiptsResponse",
-                        perm_converter_);
+                        perm_converter_, temporaries_);
                     executor.use("tx_hash", tx_hash);
                     executor.use("cmd_index", cmd_index);
 
@@ -1615,7 +1825,7 @@ namespace iroha {
       StatementExecutor executor(compare_and_set_account_detail_statements_,
                                  do_validation,
                                  "CompareAndSetAccountDetail",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("target", command.accountId());
       executor.use("key", command.key());
@@ -1647,7 +1857,7 @@ namespace iroha {
       StatementExecutor executor(create_account_statements_,
                                  do_validation,
                                  "CreateAccount",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("account_id", account_id);
       executor.use("domain", domain_id);
@@ -1669,7 +1879,7 @@ namespace iroha {
       StatementExecutor executor(create_asset_statements_,
                                  do_validation,
                                  "CreateAsset",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("asset_id", asset_id);
       executor.use("domain", domain_id);
@@ -1690,7 +1900,7 @@ namespace iroha {
       StatementExecutor executor(create_domain_statements_,
                                  do_validation,
                                  "CreateDomain",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("domain", domain_id);
       executor.use("default_role", default_role);
@@ -1711,7 +1921,7 @@ namespace iroha {
       StatementExecutor executor(create_role_statements_,
                                  do_validation,
                                  "CreateRole",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("role", role_id);
       executor.use("perms", perm_str);
@@ -1731,7 +1941,7 @@ namespace iroha {
       StatementExecutor executor(detach_role_statements_,
                                  do_validation,
                                  "DetachRole",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("target", account_id);
       executor.use("role", role_name);
@@ -1753,7 +1963,7 @@ namespace iroha {
       StatementExecutor executor(grant_permission_statements_,
                                  do_validation,
                                  "GrantPermission",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("target", permittee_account_id);
       executor.use("granted_perm", granted_perm);
@@ -1773,7 +1983,7 @@ namespace iroha {
       StatementExecutor executor(remove_peer_statements_,
                                  do_validation,
                                  "RemovePeer",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("pubkey", pubkey);
 
@@ -1792,7 +2002,7 @@ namespace iroha {
       StatementExecutor executor(remove_signatory_statements_,
                                  do_validation,
                                  "RemoveSignatory",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("target", account_id);
       executor.use("pubkey", pubkey);
@@ -1812,7 +2022,7 @@ namespace iroha {
       StatementExecutor executor(revoke_permission_statements_,
                                  do_validation,
                                  "RevokePermission",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("target", permittee_account_id);
       executor.use("revoked_perm", revoked_perm);
@@ -1834,7 +2044,7 @@ namespace iroha {
       StatementExecutor executor(set_account_detail_statements_,
                                  do_validation,
                                  "SetAccountDetail",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       if (not creator_account_id.empty()) {
         executor.use("creator", creator_account_id);
       } else {
@@ -1859,7 +2069,7 @@ namespace iroha {
       int quorum = command.newQuorum();
 
       StatementExecutor executor(
-          set_quorum_statements_, do_validation, "SetQuorum", perm_converter_);
+          set_quorum_statements_, do_validation, "SetQuorum", perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("target", account_id);
       executor.use("quorum", quorum);
@@ -1880,7 +2090,7 @@ namespace iroha {
       StatementExecutor executor(subtract_asset_quantity_statements_,
                                  do_validation,
                                  "SubtractAssetQuantity",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("asset_id", asset_id);
       executor.use("quantity", quantity);
@@ -1904,7 +2114,7 @@ namespace iroha {
       StatementExecutor executor(transfer_asset_statements_,
                                  do_validation,
                                  "TransferAsset",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
       executor.use("creator", creator_account_id);
       executor.use("source_account_id", src_account_id);
       executor.use("dest_account_id", dest_account_id);
@@ -1936,7 +2146,7 @@ namespace iroha {
       StatementExecutor executor(set_setting_value_statements_,
                                  do_validation,
                                  "SetSettingValue",
-                                 perm_converter_);
+                                 perm_converter_, temporaries_);
 
       executor.use("setting_key", key);
       executor.use("setting_value", value);
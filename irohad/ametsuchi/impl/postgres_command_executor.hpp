@@ -6,10 +6,12 @@
 #ifndef IROHA_POSTGRES_COMMAND_EXECUTOR_HPP
 #define IROHA_POSTGRES_COMMAND_EXECUTOR_HPP
 
+#include <deque>
 #include <optional>
 #include "ametsuchi/command_executor.hpp"
 
 #include "ametsuchi/impl/soci_utils.hpp"
+#include "utils/string_builder.hpp"
 
 namespace soci {
   class session;
@@ -44,6 +46,7 @@ namespace shared_model {
 namespace iroha {
   namespace ametsuchi {
 
+    class PostgresPipeline;
     class PostgresSpecificQueryExecutor;
     class VmCaller;
 
@@ -67,8 +70,27 @@ namespace iroha {
           shared_model::interface::types::CommandIndexType cmd_index,
           bool do_validation) override;
 
+      /**
+       * Direct path for the hot command types: binds the protobuf fields
+       * into the prepared statements without constructing the shared
+       * model wrapper hierarchy
+       */
+      boost::optional<CommandResult> executeRaw(
+          const iroha::protocol::Command &cmd,
+          const shared_model::interface::types::AccountIdType
+              &creator_account_id,
+          const std::string &tx_hash,
+          shared_model::interface::types::CommandIndexType cmd_index,
+          bool do_validation) override;
+
       soci::session &getSession();
 
+      /**
+       * Make a pipeline bound to this executor's session for batched
+       * statement execution during block commit (see PostgresPipeline).
+       */
+      std::unique_ptr<PostgresPipeline> makePipeline();
+
       CommandResult operator()(
           const shared_model::interface::AddAssetQuantity &command,
           const shared_model::interface::types::AccountIdType
@@ -233,12 +255,36 @@ namespace iroha {
       class CommandStatements;
       class StatementExecutor;
 
-      void initStatements();
+      /**
+       * Scratch storage for per-command temporaries. One instance lives as
+       * long as the executor and is handed to every StatementExecutor, so
+       * the string buffers built for each of the thousands of commands in a
+       * block reuse the same allocations instead of being reallocated per
+       * command.
+       */
+      struct CommandTemporaries {
+        shared_model::detail::PrettyStringBuilder arguments_string_builder;
+        /// bound into soci statements by reference, hence the stable-address
+        /// container; slots are recycled, their capacity is kept
+        std::deque<std::string> temp_values;
+        size_t temp_values_used{0};
+
+        /// prepare for the next command, keeping all allocated buffers
+        void reset() {
+          arguments_string_builder.clear();
+          temp_values_used = 0;
+        }
+
+        /// get a reusable string slot with a stable address
+        std::string &nextTempValue() {
+          if (temp_values_used == temp_values.size()) {
+            temp_values.emplace_back();
+          }
+          return temp_values[temp_values_used++];
+        }
+      };
 
-      std::unique_ptr<CommandStatements> makeCommandStatements(
-          const std::unique_ptr<soci::session> &session,
-          const std::string &base_statement,
-          const std::vector<std::string> &permission_checks);
+      void initStatements();
 
       std::unique_ptr<soci::session> sql_;
 
@@ -247,6 +293,8 @@ namespace iroha {
       std::shared_ptr<PostgresSpecificQueryExecutor> specific_query_executor_;
       std::optional<std::reference_wrapper<const VmCaller>> vm_caller_;
 
+      CommandTemporaries temporaries_;
+
       std::unique_ptr<CommandStatements> add_asset_quantity_statements_;
       std::unique_ptr<CommandStatements> add_peer_statements_;
       std::unique_ptr<CommandStatements> add_signatory_statements_;
@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_copy.hpp"
+
+#include <soci/postgresql/soci-postgresql.h>
+#include <soci/soci.h>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    std::optional<std::string> copyRows(soci::session &sql,
+                                        const std::string &copy_statement,
+                                        const std::string &rows) {
+      auto *connection =
+          static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+              ->conn_;
+      PGresult *result = PQexec(connection, copy_statement.c_str());
+      if (PQresultStatus(result) != PGRES_COPY_IN) {
+        std::string error = PQresultErrorMessage(result);
+        PQclear(result);
+        return error;
+      }
+      PQclear(result);
+      if (PQputCopyData(connection, rows.data(), rows.size()) != 1
+          or PQputCopyEnd(connection, nullptr) != 1) {
+        return std::string{PQerrorMessage(connection)};
+      }
+      while ((result = PQgetResult(connection)) != nullptr) {
+        auto status = PQresultStatus(result);
+        if (status != PGRES_COMMAND_OK) {
+          std::string error = PQresultErrorMessage(result);
+          PQclear(result);
+          return error;
+        }
+        PQclear(result);
+      }
+      return std::nullopt;
+    }
+
+    std::string escapeCopyField(const std::string &value) {
+      std::string escaped;
+      escaped.reserve(value.size());
+      for (char c : value) {
+        switch (c) {
+          case '\\':
+            escaped += "\\\\";
+            break;
+          case '\t':
+            escaped += "\\t";
+            break;
+          case '\n':
+            escaped += "\\n";
+            break;
+          default:
+            escaped += c;
+        }
+      }
+      return escaped;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,42 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_COPY_HPP
+#define IROHA_POSTGRES_COPY_HPP
+
+#include <optional>
+#include <string>
+
+namespace soci {
+  class session;
+}
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Send pre-formatted COPY text rows into the given table. Bulk-loading
+     * through the COPY protocol skips per-row parsing and planning and is
+     * the fastest path for loading many rows at once.
+     * @param sql - session to write through
+     * @param copy_statement - "COPY <table> (<columns>) FROM STDIN"
+     * @param rows - tab-separated rows terminated by newlines, with
+     * backslash escapes and NULL encoded as \N
+     * @return error description on failure
+     */
+    std::optional<std::string> copyRows(soci::session &sql,
+                                        const std::string &copy_statement,
+                                        const std::string &rows);
+
+    /**
+     * Escape a text value for the COPY text format: backslashes, tabs and
+     * newlines are replaced with backslash sequences.
+     */
+    std::string escapeCopyField(const std::string &value);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_COPY_HPP
@@ -0,0 +1,100 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_CURSOR_HPP
+#define IROHA_POSTGRES_CURSOR_HPP
+
+#include <functional>
+#include <string>
+
+#include <fmt/core.h>
+#include <soci/soci.h>
+#include "common/result.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Server-side cursor over a SELECT statement. Rows are produced by the
+     * server on demand and fetched in fixed-size chunks, so a query over a
+     * large history never materializes the full result set on either side
+     * of the connection.
+     *
+     * The cursor opens its own transaction (server-side cursors only live
+     * inside one) and closes it together with the cursor on destruction.
+     */
+    class PostgresCursor {
+     public:
+      /**
+       * Declare a cursor for the given query.
+       * @param sql - session to run on; must not have an open transaction
+       * @param name - unique cursor name within the session
+       * @param query - SELECT statement to stream; parameters must already
+       * be bound into the text
+       */
+      PostgresCursor(soci::session &sql, std::string name, std::string query)
+          : sql_(sql), name_(std::move(name)) {
+        sql_ << "BEGIN";
+        sql_ << fmt::format(
+            "DECLARE {} NO SCROLL CURSOR FOR {}", name_, query);
+        open_ = true;
+      }
+
+      ~PostgresCursor() {
+        close();
+      }
+
+      PostgresCursor(const PostgresCursor &) = delete;
+      PostgresCursor &operator=(const PostgresCursor &) = delete;
+
+      /**
+       * Fetch the next chunk of rows and feed each to the callback.
+       * @param chunk_size - maximum number of rows to fetch
+       * @param on_row - called once per row
+       * @return number of rows fetched; less than chunk_size means the
+       * result set is exhausted
+       */
+      iroha::expected::Result<size_t, std::string> fetch(
+          size_t chunk_size, std::function<void(const soci::row &)> on_row) {
+        try {
+          soci::rowset<soci::row> rows =
+              (sql_.prepare << fmt::format(
+                   "FETCH FORWARD {} FROM {}", chunk_size, name_));
+          size_t count = 0;
+          for (const auto &row : rows) {
+            on_row(row);
+            ++count;
+          }
+          return iroha::expected::makeValue(count);
+        } catch (const std::exception &e) {
+          return iroha::expected::makeError(
+              fmt::format("cursor fetch failed: {}", e.what()));
+        }
+      }
+
+      /// Close the cursor and its transaction. Safe to call repeatedly.
+      void close() {
+        if (open_) {
+          open_ = false;
+          try {
+            sql_ << fmt::format("CLOSE {}", name_);
+            sql_ << "COMMIT";
+          } catch (const std::exception &) {
+            // the session is broken; the server drops the cursor with the
+            // failed transaction
+          }
+        }
+      }
+
+     private:
+      soci::session &sql_;
+      std::string name_;
+      bool open_{false};
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_CURSOR_HPP
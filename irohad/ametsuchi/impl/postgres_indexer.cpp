@@ -5,9 +5,13 @@
 
 #include "ametsuchi/impl/postgres_indexer.hpp"
 
+#include <set>
+
 #include <fmt/core.h>
 #include <soci/soci.h>
 #include <boost/format.hpp>
+#include "ametsuchi/impl/index_retention.hpp"
+#include "ametsuchi/impl/postgres_copy.hpp"
 #include "cryptography/hash.hpp"
 
 using namespace iroha::ametsuchi;
@@ -42,22 +46,50 @@ void PostgresIndexer::txPositions(
   tx_positions_.index.emplace_back(position.index);
 }
 
+void PostgresIndexer::ensureTxPositionsPartitions() {
+  if (not tx_positions_partitioned_) {
+    int partitioned_count = 0;
+    sql_ << "SELECT count(1) FROM pg_partitioned_table AS pt "
+            "JOIN pg_class AS c ON c.oid = pt.partrelid "
+            "WHERE c.relname = 'tx_positions'",
+        soci::into(partitioned_count);
+    tx_positions_partitioned_ = partitioned_count != 0;
+  }
+  if (not *tx_positions_partitioned_) {
+    return;
+  }
+  std::set<size_t> spans;
+  for (auto height : tx_positions_.height) {
+    spans.insert(height / kTxPositionsPartitionSpan);
+  }
+  for (auto span : spans) {
+    sql_ << fmt::format(
+        "CREATE TABLE IF NOT EXISTS tx_positions_p{0} "
+        "PARTITION OF tx_positions FOR VALUES FROM ({1}) TO ({2})",
+        span,
+        span * kTxPositionsPartitionSpan,
+        (span + 1) * kTxPositionsPartitionSpan);
+  }
+}
+
 iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
   try {
-    cache_.clear();
     assert(tx_hash_status_.hash.size() == tx_hash_status_.status.size());
     if (not tx_hash_status_.hash.empty()) {
-      cache_ +=
-          "INSERT INTO tx_status_by_hash"
-          "(hash, status) VALUES ";
+      cache_.clear();
       for (size_t ix = 0; ix < tx_hash_status_.hash.size(); ++ix) {
-        cache_ += fmt::format("('{}','{}')",
+        // the hash columns are bytea; "\\x<hex>" unescapes to the "\x<hex>"
+        // binary input format when parsed from the COPY text stream
+        cache_ += fmt::format("\\\\x{}\t{}\n",
                               tx_hash_status_.hash[ix],
                               tx_hash_status_.status[ix]);
-        if (ix != tx_hash_status_.hash.size() - 1)
-          cache_ += ',';
       }
-      cache_ += ";\n";
+      if (auto error =
+              copyRows(sql_,
+                       "COPY tx_status_by_hash (hash, status) FROM STDIN",
+                       cache_)) {
+        return *error;
+      }
 
       tx_hash_status_.hash.clear();
       tx_hash_status_.status.clear();
@@ -69,30 +101,35 @@ iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
     assert(tx_positions_.account.size() == tx_positions_.height.size());
     assert(tx_positions_.account.size() == tx_positions_.index.size());
     if (!tx_positions_.account.empty()) {
-      cache_ +=
-          "INSERT INTO tx_positions"
-          "(creator_id, hash, asset_id, ts, height, index) VALUES ";
+      cache_.clear();
       for (size_t ix = 0; ix < tx_positions_.account.size(); ++ix) {
-        if (tx_positions_.asset_id[ix]) {
-          cache_ += fmt::format("('{}','{}','{}',{},{},{})",
-                                tx_positions_.account[ix],
-                                tx_positions_.hash[ix],
-                                *tx_positions_.asset_id[ix],
-                                tx_positions_.ts[ix],
-                                tx_positions_.height[ix],
-                                tx_positions_.index[ix]);
-        } else {
-          cache_ += fmt::format("('{}','{}',NULL,{},{},{})",
-                                tx_positions_.account[ix],
-                                tx_positions_.hash[ix],
-                                tx_positions_.ts[ix],
-                                tx_positions_.height[ix],
-                                tx_positions_.index[ix]);
-        }
-        if (ix != tx_positions_.account.size() - 1)
-          cache_ += ',';
+        cache_ += fmt::format("{}\t\\\\x{}\t{}\t{}\t{}\t{}\n",
+                              tx_positions_.account[ix],
+                              tx_positions_.hash[ix],
+                              tx_positions_.asset_id[ix]
+                                  ? *tx_positions_.asset_id[ix]
+                                  : std::string{"\\N"},
+                              tx_positions_.ts[ix],
+                              tx_positions_.height[ix],
+                              tx_positions_.index[ix]);
       }
-      cache_ += " ON CONFLICT DO NOTHING;\n";
+      ensureTxPositionsPartitions();
+      // tx_positions needs conflict handling which COPY does not provide,
+      // so bulk-load into a transaction-local staging table and merge
+      sql_ <<
+          "CREATE TEMP TABLE IF NOT EXISTS tx_positions_load "
+          "(LIKE tx_positions) ON COMMIT DROP";
+      if (auto error = copyRows(
+              sql_,
+              "COPY tx_positions_load "
+              "(creator_id, hash, asset_id, ts, height, index) FROM STDIN",
+              cache_)) {
+        return *error;
+      }
+      sql_ <<
+          "INSERT INTO tx_positions SELECT * FROM tx_positions_load "
+          "ON CONFLICT DO NOTHING";
+      sql_ << "TRUNCATE tx_positions_load";
 
       tx_positions_.account.clear();
       tx_positions_.hash.clear();
@@ -101,9 +138,6 @@ iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
       tx_positions_.height.clear();
       tx_positions_.index.clear();
     }
-
-    if (!cache_.empty())
-      sql_ << cache_;
   } catch (const std::exception &e) {
     return e.what();
   }
@@ -8,6 +8,7 @@
 
 #include "ametsuchi/indexer.hpp"
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -59,8 +60,15 @@ namespace iroha {
       void txHashStatus(const shared_model::interface::types::HashType &tx_hash,
                         bool is_committed);
 
+      /// Create the tx_positions partitions covering the staged heights
+      /// when the table is partitioned. Detects the table layout on the
+      /// first call and is a no-op on a legacy unpartitioned table.
+      void ensureTxPositionsPartitions();
+
       soci::session &sql_;
       std::string cache_;
+      /// whether tx_positions is partitioned by height; detected lazily
+      std::optional<bool> tx_positions_partitioned_;
     };
 
   }  // namespace ametsuchi
@@ -0,0 +1,129 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_pipeline.hpp"
+
+#include <optional>
+#include <string_view>
+
+#include <fmt/core.h>
+#include <soci/postgresql/soci-postgresql.h>
+#include <soci/soci.h>
+
+namespace {
+  PGconn *getRawConnection(soci::session &sql) {
+    return static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+        ->conn_;
+  }
+
+  /// Check a single PGresult against the command executor convention:
+  /// no rows, or a single integer status code with zero meaning success.
+  std::optional<std::string> checkResult(PGresult *result) {
+    auto status = PQresultStatus(result);
+    if (status != PGRES_TUPLES_OK and status != PGRES_COMMAND_OK) {
+      return std::string{PQresultErrorMessage(result)};
+    }
+    if (PQntuples(result) > 0) {
+      char *value = PQgetvalue(result, 0, 0);
+      if (value != nullptr and std::string_view{value} != "0") {
+        return fmt::format("statement returned status code {}", value);
+      }
+    }
+    return std::nullopt;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    PostgresPipeline::PostgresPipeline(soci::session &sql) : sql_(sql) {}
+
+    PostgresPipeline::~PostgresPipeline() {
+#ifdef LIBPQ_HAS_PIPELINING
+      if (in_pipeline_) {
+        PQexitPipelineMode(getRawConnection(sql_));
+      }
+#endif
+    }
+
+    iroha::expected::Result<void, std::string> PostgresPipeline::enter() {
+#ifdef LIBPQ_HAS_PIPELINING
+      auto *connection = getRawConnection(sql_);
+      if (PQenterPipelineMode(connection) != 1) {
+        return iroha::expected::makeError(
+            fmt::format("failed to enter pipeline mode: {}",
+                        PQerrorMessage(connection)));
+      }
+      in_pipeline_ = true;
+#endif
+      return {};
+    }
+
+    void PostgresPipeline::queue(std::string statement) {
+      queued_.push_back(std::move(statement));
+    }
+
+    size_t PostgresPipeline::size() const {
+      return queued_.size();
+    }
+
+    PostgresPipeline::FlushResult PostgresPipeline::flush() {
+      std::vector<StatementError> errors;
+#ifdef LIBPQ_HAS_PIPELINING
+      if (in_pipeline_) {
+        auto *connection = getRawConnection(sql_);
+        for (size_t i = 0; i < queued_.size(); ++i) {
+          if (PQsendQueryParams(connection,
+                                queued_[i].c_str(),
+                                0,
+                                nullptr,
+                                nullptr,
+                                nullptr,
+                                nullptr,
+                                0)
+              != 1) {
+            errors.push_back({i, PQerrorMessage(connection)});
+          }
+        }
+        PQpipelineSync(connection);
+        for (size_t i = 0; i < queued_.size(); ++i) {
+          // each statement yields its results followed by a null terminator
+          while (PGresult *result = PQgetResult(connection)) {
+            if (auto error = checkResult(result)) {
+              errors.push_back({i, std::move(*error)});
+            }
+            PQclear(result);
+          }
+        }
+        // consume the sync point result
+        if (PGresult *sync_result = PQgetResult(connection)) {
+          PQclear(sync_result);
+        }
+        PQexitPipelineMode(connection);
+        in_pipeline_ = false;
+        queued_.clear();
+        if (not errors.empty()) {
+          return iroha::expected::makeError(std::move(errors));
+        }
+        return {};
+      }
+#endif
+      // synchronous fallback for libpq without pipeline support
+      for (size_t i = 0; i < queued_.size(); ++i) {
+        try {
+          sql_ << queued_[i];
+        } catch (const std::exception &e) {
+          errors.push_back({i, e.what()});
+        }
+      }
+      queued_.clear();
+      if (not errors.empty()) {
+        return iroha::expected::makeError(std::move(errors));
+      }
+      return {};
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
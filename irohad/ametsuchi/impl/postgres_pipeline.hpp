@@ -0,0 +1,84 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_PIPELINE_HPP
+#define IROHA_POSTGRES_PIPELINE_HPP
+
+#include <string>
+#include <vector>
+
+#include "common/result.hpp"
+
+namespace soci {
+  class session;
+}
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Batched statement execution over libpq pipeline mode.
+     *
+     * Statements queued between enter() and flush() are sent to the server
+     * without waiting for individual results, so a block worth of command
+     * statements costs one network round-trip instead of one per command.
+     * Results are collected and checked at flush() time; each statement is
+     * expected to either produce no rows or a single integer status code in
+     * the first column, zero meaning success (the convention used by the
+     * command executor statements).
+     *
+     * Requires a server and libpq with pipeline support (PostgreSQL 14+
+     * client library). On older libpq the class falls back to synchronous
+     * execution of the queued statements at flush() time, preserving
+     * semantics at the old cost.
+     */
+    class PostgresPipeline {
+     public:
+      /// Description of a failed statement: its queue position and the error.
+      struct StatementError {
+        size_t index;
+        std::string error;
+      };
+
+      using FlushResult =
+          iroha::expected::Result<void, std::vector<StatementError>>;
+
+      /// @param sql - session whose underlying connection is pipelined
+      explicit PostgresPipeline(soci::session &sql);
+
+      ~PostgresPipeline();
+
+      /**
+       * Switch the connection into pipeline mode.
+       * @return error description if the mode could not be entered
+       */
+      iroha::expected::Result<void, std::string> enter();
+
+      /**
+       * Queue a complete SQL statement for execution. The statement text
+       * must be fully formed (no client-side parameters are bound).
+       */
+      void queue(std::string statement);
+
+      /// Number of statements queued and not yet flushed.
+      size_t size() const;
+
+      /**
+       * Send all queued statements, wait for their results and leave
+       * pipeline mode.
+       * @return errors of the failed statements, if any
+       */
+      FlushResult flush();
+
+     private:
+      soci::session &sql_;
+      std::vector<std::string> queued_;
+      bool in_pipeline_{false};
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_PIPELINE_HPP
@@ -5,6 +5,7 @@
 
 #include "ametsuchi/impl/postgres_specific_query_executor.hpp"
 
+#include <chrono>
 #include <tuple>
 #include <unordered_map>
 
@@ -15,7 +16,10 @@
 #include <boost/range/algorithm/transform.hpp>
 #include <boost/range/irange.hpp>
 #include "ametsuchi/block_storage.hpp"
+#include "ametsuchi/impl/async_block_indexer.hpp"
 #include "ametsuchi/impl/executor_common.hpp"
+#include "ametsuchi/impl/index_retention.hpp"
+#include "ametsuchi/impl/query_permission_cache.hpp"
 #include "ametsuchi/impl/soci_std_optional.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "backend/plain/account_detail_record_id.hpp"
@@ -55,6 +59,10 @@ namespace {
 
   using namespace iroha;
 
+  /// longest time a history query waits for the background tx position
+  /// indexer to catch up with the committed height
+  constexpr std::chrono::seconds kTxPositionsWaitTimeout{5};
+
   std::string getAccountRolePermissionCheckSql(
       shared_model::interface::permissions::Role permission,
       const std::string &account_alias = ":role_account_id") {
@@ -265,13 +273,19 @@ namespace iroha {
             response_factory,
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<AsyncBlockIndexer> async_block_indexer,
+        std::shared_ptr<QueryPermissionCache> permission_cache,
+        std::shared_ptr<IndexRetention> index_retention)
         : sql_(sql),
           block_store_(block_store),
           pending_txs_storage_(std::move(pending_txs_storage)),
           query_response_factory_{std::move(response_factory)},
           perm_converter_(std::move(perm_converter)),
-          log_(std::move(log)) {
+          log_(std::move(log)),
+          async_block_indexer_(std::move(async_block_indexer)),
+          permission_cache_(std::move(permission_cache)),
+          index_retention_(std::move(index_retention)) {
       for (size_t value = 0; value < (size_t)OrderingField::kMaxValueCount;
            ++value) {
         BOOST_ASSERT_MSG(kOrderingFieldMapping.find((OrderingField)value)
@@ -372,16 +386,67 @@ namespace iroha {
       }
     }
 
+    std::string PostgresSpecificQueryExecutor::cachedQueryPermissionTarget(
+        const shared_model::interface::types::AccountIdType &creator_id,
+        const shared_model::interface::types::AccountIdType &target_account,
+        shared_model::interface::permissions::Role indiv_permission_id,
+        shared_model::interface::permissions::Role all_permission_id,
+        shared_model::interface::permissions::Role domain_permission_id) {
+      auto subquery = hasQueryPermissionTarget(creator_id,
+                                               target_account,
+                                               indiv_permission_id,
+                                               all_permission_id,
+                                               domain_permission_id);
+      if (not permission_cache_) {
+        return subquery;
+      }
+      // the subquery text has the creator, target and permission bits baked
+      // in, so it doubles as the cache key
+      auto decision = permission_cache_->get(subquery);
+      if (not decision) {
+        try {
+          using T = boost::tuple<int>;
+          soci::rowset<T> st =
+              (sql_.prepare << fmt::format("WITH {} SELECT perm FROM has_perms",
+                                           subquery));
+          decision = st.begin()->get<0>() != 0;
+          permission_cache_->put(subquery, decision.value());
+        } catch (const std::exception &e) {
+          log_->warn("Failed to precompute query permission: {}", e.what());
+          return subquery;
+        }
+      }
+      // the main query may still reference `target' and `target_domain'
+      return fmt::format(
+          R"(target AS (select '{0}'::text as t),
+        target_domain AS (select split_part(target.t, '@', 2) as td from target),
+        has_perms AS (SELECT {1}::boolean AS perm))",
+          target_account,
+          decision.value() ? "true" : "false");
+    }
+
     bool PostgresSpecificQueryExecutor::hasAccountRolePermission(
         shared_model::interface::permissions::Role permission,
         const std::string &account_id) const {
+      const auto cache_key = fmt::format("role permission {} of {}",
+                                         static_cast<size_t>(permission),
+                                         account_id);
+      if (permission_cache_) {
+        if (auto decision = permission_cache_->get(cache_key)) {
+          return decision.value();
+        }
+      }
       using T = boost::tuple<int>;
       try {
         soci::rowset<T> st =
             (sql_.prepare << fmt::format(
                  R"({})", getAccountRolePermissionCheckSql(permission)),
              soci::use(account_id, "role_account_id"));
-        return st.begin()->get<0>();
+        const bool is_allowed = st.begin()->get<0>();
+        if (permission_cache_) {
+          permission_cache_->put(cache_key, is_allowed);
+        }
+        return is_allowed;
       } catch (const std::exception &e) {
         log_->error("Failed to validate query: {}", e.what());
         return false;
@@ -425,6 +490,24 @@ namespace iroha {
           error_type, error, error_code, query_hash);
     }
 
+    void PostgresSpecificQueryExecutor::waitForTxPositions() const {
+      if (async_block_indexer_
+          and not async_block_indexer_->waitUntilCaughtUp(
+              kTxPositionsWaitTimeout)) {
+        log_->warn(
+            "transaction position index is behind the committed height, "
+            "serving possibly incomplete history");
+      }
+    }
+
+    shared_model::interface::types::HeightType
+    PostgresSpecificQueryExecutor::retentionFloor() const {
+      if (index_retention_ and index_retention_->enabled()) {
+        return index_retention_->retentionFloor();
+      }
+      return 0;
+    }
+
     template <typename Query,
               typename QueryChecker,
               typename QueryApplier,
@@ -437,6 +520,7 @@ namespace iroha {
         char const *related_txs,
         QueryApplier applier,
         Permissions... perms) {
+      waitForTxPositions();
       using QueryTuple = QueryType<shared_model::interface::types::HeightType,
                                    uint64_t,
                                    uint64_t>;
@@ -453,6 +537,7 @@ namespace iroha {
                  FROM tx_positions
                  WHERE
                  {2} -- related_txs
+                 {5} -- time window
                  {1} -- ordering
                  ),
                total_size AS (SELECT COUNT(*) FROM my_txs) {3}
@@ -462,6 +547,23 @@ namespace iroha {
                JOIN total_size ON TRUE
                LIMIT :page_size)";
 
+      // the time window bounds are pushed into the index scan; being
+      // plain integers they are embedded directly, which keeps the
+      // positional parameter binding of the callers untouched
+      std::string time_window;
+      if (auto first_tx_time = pagination_info.firstTxTime()) {
+        time_window += fmt::format(" AND ts >= {}", *first_tx_time);
+      }
+      if (auto last_tx_time = pagination_info.lastTxTime()) {
+        time_window += fmt::format(" AND ts <= {}", *last_tx_time);
+      }
+      // index rows below the retention floor are pruned, so they are cut
+      // from the scan instead of surfacing as a truncated history
+      const auto retention_floor = retentionFloor();
+      if (retention_floor != 0) {
+        time_window += fmt::format(" AND height >= {}", retention_floor);
+      }
+
       auto const &ordering = q.paginationMeta().ordering();
       ordering_str_.clear();
 
@@ -474,13 +576,14 @@ namespace iroha {
 
       auto query = fmt::format(
           base,
-          hasQueryPermissionTarget(creator_id, q.accountId(), perms...),
+          cachedQueryPermissionTarget(creator_id, q.accountId(), perms...),
           (ordering_str_.empty() ? "" : ordering_str_.c_str()),
           related_txs,
           (first_hash
-               ? R"(, base_row AS(SELECT row FROM my_txs WHERE hash = lower(:hash) LIMIT 1))"
+               ? R"(, base_row AS(SELECT row FROM my_txs WHERE hash = decode(:hash, 'hex') LIMIT 1))"
                : ""),
-          (first_hash ? R"(JOIN base_row ON my_txs.row >= base_row.row)" : ""));
+          (first_hash ? R"(JOIN base_row ON my_txs.row >= base_row.row)" : ""),
+          time_window);
 
       return executeQuery<QueryTuple, PermissionTuple>(
           applier(query),
@@ -523,6 +626,12 @@ namespace iroha {
                 // hash is guaranteed to return at least one transaction
                 auto error = fmt::format("invalid pagination hash: {}",
                                          first_hash->hex());
+                if (retention_floor != 0) {
+                  error += fmt::format(
+                      ", or it points below the index retention window "
+                      "(height {})",
+                      retention_floor);
+                }
                 return this->logAndReturnErrorResponse(
                     QueryErrorType::kStatefulFailed, error, 4, query_hash);
               }
@@ -581,11 +690,11 @@ namespace iroha {
       SELECT account_id, domain_id, quorum, data, roles, perm
       FROM t RIGHT OUTER JOIN has_perms AS p ON TRUE
       )",
-                      hasQueryPermissionTarget(creator_id,
-                                               q.accountId(),
-                                               Role::kGetMyAccount,
-                                               Role::kGetAllAccounts,
-                                               Role::kGetDomainAccounts));
+                      cachedQueryPermissionTarget(creator_id,
+                                                  q.accountId(),
+                                                  Role::kGetMyAccount,
+                                                  Role::kGetAllAccounts,
+                                                  Role::kGetDomainAccounts));
 
       auto query_apply = [this, &query_hash](auto &account_id,
                                              auto &domain_id,
@@ -648,6 +757,19 @@ namespace iroha {
             query_hash);
       }
 
+      if (auto raw_block = block_store_.fetchRaw(q.height())) {
+        // the stored serialized block is parsed straight into the
+        // response, skipping the shared_model construction and its
+        // protobuf round-trip; chain audit tooling fetches blocks one by
+        // one, so the query is served off this path almost always
+        if (auto response = query_response_factory_->createRawBlockResponse(
+                std::move(*raw_block), query_hash)) {
+          return response;
+        }
+        // fall through to the regular path on a parse failure, it will
+        // produce the proper error response
+      }
+
       auto block_deserialization_msg = [height = q.height()] {
         return "could not retrieve block with given height: "
             + std::to_string(height);
@@ -680,11 +802,11 @@ namespace iroha {
       SELECT public_key, perm FROM t
       RIGHT OUTER JOIN has_perms ON TRUE
       )",
-                      hasQueryPermissionTarget(creator_id,
-                                               q.accountId(),
-                                               Role::kGetMySignatories,
-                                               Role::kGetAllSignatories,
-                                               Role::kGetDomainSignatories));
+                      cachedQueryPermissionTarget(creator_id,
+                                                  q.accountId(),
+                                                  Role::kGetMySignatories,
+                                                  Role::kGetAllSignatories,
+                                                  Role::kGetDomainSignatories));
 
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] { return (sql_.prepare << cmd, soci::use(q.accountId())); },
@@ -763,21 +885,27 @@ namespace iroha {
         const shared_model::interface::GetTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash) {
+      waitForTxPositions();
       std::string hash_str = boost::algorithm::join(
           q.transactionHashes()
-              | boost::adaptors::transformed(
-                    [](const auto &h) { return "lower('" + h.hex() + "')"; }),
+              | boost::adaptors::transformed([](const auto &h) {
+                  return "decode('" + h.hex() + "', 'hex')";
+                }),
           ", ");
 
       using QueryTuple =
           QueryType<shared_model::interface::types::HeightType, std::string>;
       using PermissionTuple = boost::tuple<int, int>;
 
+      // hashes resolving below the retention floor are treated the same
+      // as unknown ones - their index rows are already pruned
+      const auto retention_floor = retentionFloor();
       auto cmd = fmt::format(
           R"(WITH has_my_perm AS ({}),
       has_all_perm AS ({}),
       t AS (
-          SELECT DISTINCT height, hash FROM tx_positions WHERE hash IN ({})
+          SELECT DISTINCT height, encode(hash, 'hex') AS hash
+          FROM tx_positions WHERE hash IN ({}) AND height >= {}
       )
       SELECT height, hash, has_my_perm.perm, has_all_perm.perm FROM t
       RIGHT OUTER JOIN has_my_perm ON TRUE
@@ -785,7 +913,8 @@ namespace iroha {
       )",
           getAccountRolePermissionCheckSql(Role::kGetMyTxs, ":account_id"),
           getAccountRolePermissionCheckSql(Role::kGetAllTxs, ":account_id"),
-          hash_str);
+          hash_str,
+          retention_floor);
 
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] {
@@ -799,12 +928,16 @@ namespace iroha {
               // TODO [IR-1816] Akvinikym 03.12.18: replace magic number 4
               // with a named constant
               // at least one of the hashes in the query was invalid -
-              // nonexistent or permissions were missed
+              // nonexistent, pruned by retention or permissions were missed
+              std::string error =
+                  "At least one of the supplied hashes is incorrect";
+              if (retention_floor != 0) {
+                error += fmt::format(
+                    " or below the index retention window (height {})",
+                    retention_floor);
+              }
               return this->logAndReturnErrorResponse(
-                  QueryErrorType::kStatefulFailed,
-                  "At least one of the supplied hashes is incorrect",
-                  4,
-                  query_hash);
+                  QueryErrorType::kStatefulFailed, error, 4, query_hash);
             }
             std::map<uint64_t, std::unordered_set<std::string>> index;
             for (const auto &t : range_without_nulls) {
@@ -909,49 +1042,45 @@ namespace iroha {
                     size_t>;
       using PermissionTuple = boost::tuple<int>;
 
-      // get the assets
+      // get the assets; the page is located with a keyset seek over the
+      // (account_id, asset_id) primary key and the total comes from the
+      // denormalized account.assets_count, so the cost is bound by the page
+      // size rather than by the number of assets the account holds
       auto cmd = fmt::format(R"(
       with {},
-      all_data as (
-          select row_number() over () rn, *
-          from (
-              select *
-              from account_has_asset
-              where account_id = :account_id
-              order by asset_id
-          ) t
-      ),
       total_number as (
-          select rn total_number
-          from all_data
-          order by rn desc
-          limit 1
-      ),
-      page_start as (
-          select rn
-          from all_data
-          where coalesce(asset_id = :first_asset_id, true)
-          limit 1
+          select assets_count total_number
+          from account
+          where account_id = :account_id
       ),
       page_data as (
-          select * from all_data, page_start, total_number
+          select t.account_id, t.asset_id, t.amount, total_number
+          from account_has_asset t, total_number
           where
-              all_data.rn >= page_start.rn and
-              coalesce( -- TODO remove after pagination is mandatory IR-516
-                  all_data.rn < page_start.rn + :page_size,
-                  true
-              )
+              t.account_id = :account_id
+              and coalesce(t.asset_id >= :first_asset_id, true)
+              -- an unknown cursor must yield an empty page, not the next one
+              and (:first_asset_id is null
+                   or exists(
+                          select 1 from account_has_asset
+                          where account_id = :account_id
+                              and asset_id = :first_asset_id))
+          order by t.asset_id
+          -- null when pagination is not requested
+          -- TODO remove after pagination is mandatory IR-516
+          limit :page_size
       )
       select account_id, asset_id, amount, total_number, perm
           from
               page_data
               right join has_perms on true
       )",
-                             hasQueryPermissionTarget(creator_id,
-                                                      q.accountId(),
-                                                      Role::kGetMyAccAst,
-                                                      Role::kGetAllAccAst,
-                                                      Role::kGetDomainAccAst));
+                             cachedQueryPermissionTarget(
+                                 creator_id,
+                                 q.accountId(),
+                                 Role::kGetMyAccAst,
+                                 Role::kGetAllAccAst,
+                                 Role::kGetDomainAccAst));
 
       // These must stay alive while soci query is being done.
       const auto pagination_meta{q.paginationMeta()};
@@ -1035,13 +1164,35 @@ namespace iroha {
                     uint32_t>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd =
-          fmt::format(R"(
-      with {},
-      detail AS (
-          with filtered_plain_data as (
-              select row_number() over () rn, *
-              from (
+      const auto writer = q.writer();
+      const auto key = q.key();
+
+      // the writer filter is known before the query runs, so the document
+      // is opened directly at that path instead of expanding every
+      // writer's subtree with jsonb_each
+      std::string filtered_source;
+      if (writer and key) {
+        filtered_source = R"(
+                  select
+                      cast(:writer as text) writer,
+                      cast(:key as text) as key,
+                      data->:writer->:key as value
+                  from account
+                  where account_id = :account_id and data->:writer ? :key)";
+      } else if (writer) {
+        filtered_source = R"(
+                  select
+                      cast(:writer as text) writer,
+                      plain_data.key as key,
+                      plain_data.value as value
+                  from jsonb_each((
+                      select data->:writer
+                      from account
+                      where account_id = :account_id and data ? :writer
+                  )) plain_data
+                  order by plain_data.key asc)";
+      } else {
+        filtered_source = R"(
                   select
                       data_by_writer.key writer,
                       plain_data.key as key,
@@ -1054,9 +1205,17 @@ namespace iroha {
                       )) data_by_writer,
                   jsonb_each(data_by_writer.value) plain_data
                   where
-                      coalesce(data_by_writer.key = :writer, true) and
                       coalesce(plain_data.key = :key, true)
-                  order by data_by_writer.key asc, plain_data.key asc
+                  order by data_by_writer.key asc, plain_data.key asc)";
+      }
+
+      auto cmd =
+          fmt::format(R"(
+      with {0},
+      detail AS (
+          with filtered_plain_data as (
+              select row_number() over () rn, *
+              from ({1}
               ) t
           ),
           page_limits as (
@@ -1111,14 +1270,13 @@ namespace iroha {
       select detail.*, perm from detail
       right join has_perms on true
       )",
-                      hasQueryPermissionTarget(creator_id,
-                                               q.accountId(),
-                                               Role::kGetMyAccDetail,
-                                               Role::kGetAllAccDetail,
-                                               Role::kGetDomainAccDetail));
+                      cachedQueryPermissionTarget(creator_id,
+                                                  q.accountId(),
+                                                  Role::kGetMyAccDetail,
+                                                  Role::kGetAllAccDetail,
+                                                  Role::kGetDomainAccDetail),
+                      filtered_source);
 
-      const auto writer = q.writer();
-      const auto key = q.key();
       boost::optional<std::string> first_record_writer;
       boost::optional<std::string> first_record_key;
       boost::optional<size_t> page_size;
@@ -1135,13 +1293,21 @@ namespace iroha {
 
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "account_id"),
-                    soci::use(writer, "writer"),
-                    soci::use(key, "key"),
-                    soci::use(first_record_writer, "first_record_writer"),
-                    soci::use(first_record_key, "first_record_key"),
-                    soci::use(page_size, "page_size"));
+            auto statement =
+                (sql_.prepare << cmd,
+                 soci::use(q.accountId(), "account_id"),
+                 soci::use(first_record_writer, "first_record_writer"),
+                 soci::use(first_record_key, "first_record_key"),
+                 soci::use(page_size, "page_size"));
+            // each variant of filtered_plain_data references only the
+            // placeholders of the filters it inlines
+            if (writer) {
+              (statement, soci::use(writer, "writer"));
+            }
+            if (key or not writer) {
+              (statement, soci::use(key, "key"));
+            }
+            return statement;
           },
           query_hash,
           [&, this](auto range, auto &) {
@@ -1484,7 +1650,7 @@ namespace iroha {
               target as (
                 select distinct creator_id as t
                 from tx_positions
-                where hash=lower(:tx_hash)
+                where hash=decode(:tx_hash, 'hex')
               ),
               {}
             select
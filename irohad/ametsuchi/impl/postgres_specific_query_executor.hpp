@@ -39,7 +39,10 @@ namespace iroha {
 
   namespace ametsuchi {
 
+    class AsyncBlockIndexer;
     class BlockStorage;
+    class IndexRetention;
+    class QueryPermissionCache;
 
     using QueryErrorType =
         shared_model::interface::QueryResponseFactory::ErrorQueryType;
@@ -58,7 +61,10 @@ namespace iroha {
               response_factory,
           std::shared_ptr<shared_model::interface::PermissionToString>
               perm_converter,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<AsyncBlockIndexer> async_block_indexer = nullptr,
+          std::shared_ptr<QueryPermissionCache> permission_cache = nullptr,
+          std::shared_ptr<IndexRetention> index_retention = nullptr);
 
       QueryExecutorResult execute(
           const shared_model::interface::Query &qry) override;
@@ -218,6 +224,35 @@ namespace iroha {
           QueryApplier applier,
           Permissions... perms);
 
+      /**
+       * Wait for the background indexer to finish the tx position indices of
+       * already committed blocks, so that history queries do not miss
+       * recently committed transactions. Logs a warning and proceeds when
+       * the indexer cannot catch up in time.
+       */
+      void waitForTxPositions() const;
+
+      /**
+       * @return height below which the tx position indices have been
+       * pruned by the retention policy; 0 when the whole history is kept
+       */
+      shared_model::interface::types::HeightType retentionFloor() const;
+
+      /**
+       * Generate the `has_perms' permission check subquery for the creator
+       * against the target account, serving the decision from the shared
+       * permission cache when there is one. On a cache miss the check is
+       * evaluated standalone and remembered, and the returned subquery
+       * reports the constant decision, so repeated queries skip the role
+       * permission aggregation.
+       */
+      std::string cachedQueryPermissionTarget(
+          const shared_model::interface::types::AccountIdType &creator_id,
+          const shared_model::interface::types::AccountIdType &target_account,
+          shared_model::interface::permissions::Role indiv_permission_id,
+          shared_model::interface::permissions::Role all_permission_id,
+          shared_model::interface::permissions::Role domain_permission_id);
+
       /**
        * Check if entry with such key exists in the database
        * @tparam ReturnValueType - type of the value to be returned in the
@@ -268,6 +303,9 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
       logger::LoggerPtr log_;
+      std::shared_ptr<AsyncBlockIndexer> async_block_indexer_;
+      std::shared_ptr<QueryPermissionCache> permission_cache_;
+      std::shared_ptr<IndexRetention> index_retention_;
       std::string ordering_str_;
     };
 
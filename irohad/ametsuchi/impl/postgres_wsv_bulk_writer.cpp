@@ -0,0 +1,339 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_wsv_bulk_writer.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+
+#include <fmt/core.h>
+#include <soci/soci.h>
+#include "ametsuchi/impl/postgres_copy.hpp"
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/common_objects/peer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ametsuchi;
+
+namespace {
+  /// the wsv stores public keys lowercased, matching lower(:pk) in the
+  /// statement-based writers
+  std::string toLowerHex(const std::string &pubkey_hex) {
+    std::string lowered;
+    lowered.reserve(pubkey_hex.size());
+    std::transform(pubkey_hex.begin(),
+                   pubkey_hex.end(),
+                   std::back_inserter(lowered),
+                   [](char c) {
+                     return std::tolower(static_cast<unsigned char>(c));
+                   });
+    return lowered;
+  }
+}  // namespace
+
+PostgresWsvBulkWriter::PostgresWsvBulkWriter(soci::session &sql) : sql_(sql) {}
+
+void PostgresWsvBulkWriter::addRole(
+    const shared_model::interface::types::RoleIdType &role_id,
+    const shared_model::interface::RolePermissionSet &permissions) {
+  roles_.role_id.emplace_back(role_id);
+  roles_.permission.emplace_back(permissions.toBitstring());
+}
+
+void PostgresWsvBulkWriter::addDomain(
+    const shared_model::interface::types::DomainIdType &domain_id,
+    const shared_model::interface::types::RoleIdType &default_role) {
+  domains_.domain_id.emplace_back(domain_id);
+  domains_.default_role.emplace_back(default_role);
+}
+
+void PostgresWsvBulkWriter::addSignatory(const std::string &pubkey_hex) {
+  signatories_.emplace(toLowerHex(pubkey_hex));
+}
+
+void PostgresWsvBulkWriter::addAccount(
+    const shared_model::interface::types::AccountIdType &account_id,
+    const shared_model::interface::types::DomainIdType &domain_id,
+    shared_model::interface::types::QuorumType quorum) {
+  accounts_.account_id.emplace_back(account_id);
+  accounts_.domain_id.emplace_back(domain_id);
+  accounts_.quorum.emplace_back(quorum);
+}
+
+void PostgresWsvBulkWriter::addAccountSignatory(
+    const shared_model::interface::types::AccountIdType &account_id,
+    const std::string &pubkey_hex) {
+  account_signatories_.account_id.emplace_back(account_id);
+  account_signatories_.public_key.emplace_back(toLowerHex(pubkey_hex));
+}
+
+void PostgresWsvBulkWriter::addAccountRole(
+    const shared_model::interface::types::AccountIdType &account_id,
+    const shared_model::interface::types::RoleIdType &role_id) {
+  account_roles_.account_id.emplace_back(account_id);
+  account_roles_.role_id.emplace_back(role_id);
+}
+
+void PostgresWsvBulkWriter::addPeer(
+    const shared_model::interface::Peer &peer) {
+  peers_.public_key.emplace_back(toLowerHex(peer.pubkey()));
+  peers_.address.emplace_back(peer.address());
+  peers_.tls_certificate.emplace_back(peer.tlsCertificate());
+}
+
+void PostgresWsvBulkWriter::addAsset(
+    const shared_model::interface::types::AssetIdType &asset_id,
+    const shared_model::interface::types::DomainIdType &domain_id,
+    uint32_t precision) {
+  assets_.asset_id.emplace_back(asset_id);
+  assets_.domain_id.emplace_back(domain_id);
+  assets_.precision.emplace_back(precision);
+}
+
+iroha::expected::Result<void, std::string> PostgresWsvBulkWriter::flush() {
+  // the tables are flushed in an order that satisfies the foreign key
+  // constraints: roles before domains before accounts and so on
+  try {
+    if (not roles_.role_id.empty()) {
+      cache_.clear();
+      for (const auto &role_id : roles_.role_id) {
+        cache_ += fmt::format("{}\n", escapeCopyField(role_id));
+      }
+      if (auto error =
+              copyRows(sql_, "COPY role (role_id) FROM STDIN", cache_)) {
+        return *error;
+      }
+      cache_.clear();
+      for (size_t ix = 0; ix < roles_.role_id.size(); ++ix) {
+        cache_ += fmt::format("{}\t{}\n",
+                              escapeCopyField(roles_.role_id[ix]),
+                              roles_.permission[ix]);
+      }
+      if (auto error = copyRows(
+              sql_,
+              "COPY role_has_permissions (role_id, permission) FROM STDIN",
+              cache_)) {
+        return *error;
+      }
+      roles_.role_id.clear();
+      roles_.permission.clear();
+    }
+
+    if (not domains_.domain_id.empty()) {
+      cache_.clear();
+      for (size_t ix = 0; ix < domains_.domain_id.size(); ++ix) {
+        cache_ += fmt::format("{}\t{}\n",
+                              escapeCopyField(domains_.domain_id[ix]),
+                              escapeCopyField(domains_.default_role[ix]));
+      }
+      if (auto error = copyRows(
+              sql_,
+              "COPY domain (domain_id, default_role) FROM STDIN",
+              cache_)) {
+        return *error;
+      }
+      domains_.domain_id.clear();
+      domains_.default_role.clear();
+    }
+
+    if (not signatories_.empty()) {
+      cache_.clear();
+      for (const auto &public_key : signatories_) {
+        cache_ += fmt::format("{}\n", public_key);
+      }
+      if (auto error = copyRows(
+              sql_, "COPY signatory (public_key) FROM STDIN", cache_)) {
+        return *error;
+      }
+      signatories_.clear();
+    }
+
+    if (not accounts_.account_id.empty()) {
+      cache_.clear();
+      for (size_t ix = 0; ix < accounts_.account_id.size(); ++ix) {
+        cache_ += fmt::format("{}\t{}\t{}\t{{}}\n",
+                              escapeCopyField(accounts_.account_id[ix]),
+                              escapeCopyField(accounts_.domain_id[ix]),
+                              accounts_.quorum[ix]);
+      }
+      if (auto error = copyRows(
+              sql_,
+              "COPY account (account_id, domain_id, quorum, data) FROM STDIN",
+              cache_)) {
+        return *error;
+      }
+      accounts_.account_id.clear();
+      accounts_.domain_id.clear();
+      accounts_.quorum.clear();
+    }
+
+    if (not account_signatories_.account_id.empty()) {
+      cache_.clear();
+      for (size_t ix = 0; ix < account_signatories_.account_id.size(); ++ix) {
+        cache_ += fmt::format(
+            "{}\t{}\n",
+            escapeCopyField(account_signatories_.account_id[ix]),
+            account_signatories_.public_key[ix]);
+      }
+      if (auto error = copyRows(sql_,
+                                "COPY account_has_signatory "
+                                "(account_id, public_key) FROM STDIN",
+                                cache_)) {
+        return *error;
+      }
+      account_signatories_.account_id.clear();
+      account_signatories_.public_key.clear();
+    }
+
+    if (not account_roles_.account_id.empty()) {
+      cache_.clear();
+      for (size_t ix = 0; ix < account_roles_.account_id.size(); ++ix) {
+        cache_ += fmt::format("{}\t{}\n",
+                              escapeCopyField(account_roles_.account_id[ix]),
+                              escapeCopyField(account_roles_.role_id[ix]));
+      }
+      if (auto error = copyRows(
+              sql_,
+              "COPY account_has_roles (account_id, role_id) FROM STDIN",
+              cache_)) {
+        return *error;
+      }
+      account_roles_.account_id.clear();
+      account_roles_.role_id.clear();
+    }
+
+    if (not peers_.public_key.empty()) {
+      cache_.clear();
+      for (size_t ix = 0; ix < peers_.public_key.size(); ++ix) {
+        cache_ += fmt::format(
+            "{}\t{}\t{}\n",
+            peers_.public_key[ix],
+            escapeCopyField(peers_.address[ix]),
+            peers_.tls_certificate[ix]
+                ? escapeCopyField(*peers_.tls_certificate[ix])
+                : std::string{"\\N"});
+      }
+      if (auto error = copyRows(sql_,
+                                "COPY peer (public_key, address, "
+                                "tls_certificate) FROM STDIN",
+                                cache_)) {
+        return *error;
+      }
+      peers_.public_key.clear();
+      peers_.address.clear();
+      peers_.tls_certificate.clear();
+    }
+
+    if (not assets_.asset_id.empty()) {
+      cache_.clear();
+      for (size_t ix = 0; ix < assets_.asset_id.size(); ++ix) {
+        cache_ += fmt::format("{}\t{}\t{}\n",
+                              escapeCopyField(assets_.asset_id[ix]),
+                              escapeCopyField(assets_.domain_id[ix]),
+                              assets_.precision[ix]);
+      }
+      if (auto error = copyRows(
+              sql_,
+              "COPY asset (asset_id, domain_id, \"precision\") FROM STDIN",
+              cache_)) {
+        return *error;
+      }
+      assets_.asset_id.clear();
+      assets_.domain_id.clear();
+      assets_.precision.clear();
+    }
+  } catch (const std::exception &e) {
+    return e.what();
+  }
+  return {};
+}
+
+namespace iroha {
+  namespace ametsuchi {
+
+    bool stageGenesisCommands(const shared_model::interface::Block &block,
+                              PostgresWsvBulkWriter &writer) {
+      // domains created in the block, with their default roles; a created
+      // account gets the default role of its domain, which must therefore
+      // come from this same block since the wsv is empty
+      std::unordered_map<std::string, std::string> domain_default_roles;
+      for (const auto &transaction : block.transactions()) {
+        for (const auto &command : transaction.commands()) {
+          const bool staged = iroha::visit_in_place(
+              command.get(),
+              [&](const shared_model::interface::CreateRole &create_role) {
+                writer.addRole(create_role.roleName(),
+                               create_role.rolePermissions());
+                return true;
+              },
+              [&](const shared_model::interface::CreateDomain &create_domain) {
+                writer.addDomain(create_domain.domainId(),
+                                 create_domain.userDefaultRole());
+                domain_default_roles[create_domain.domainId()] =
+                    create_domain.userDefaultRole();
+                return true;
+              },
+              [&](const shared_model::interface::CreateAsset &create_asset) {
+                writer.addAsset(fmt::format("{}#{}",
+                                            create_asset.assetName(),
+                                            create_asset.domainId()),
+                                create_asset.domainId(),
+                                create_asset.precision());
+                return true;
+              },
+              [&](const shared_model::interface::CreateAccount
+                      &create_account) {
+                auto default_role =
+                    domain_default_roles.find(create_account.domainId());
+                if (default_role == domain_default_roles.end()) {
+                  return false;
+                }
+                auto account_id = fmt::format("{}@{}",
+                                              create_account.accountName(),
+                                              create_account.domainId());
+                writer.addSignatory(create_account.pubkey());
+                writer.addAccount(account_id, create_account.domainId(), 1);
+                writer.addAccountSignatory(account_id,
+                                           create_account.pubkey());
+                writer.addAccountRole(account_id, default_role->second);
+                return true;
+              },
+              [&](const shared_model::interface::AppendRole &append_role) {
+                writer.addAccountRole(append_role.accountId(),
+                                      append_role.roleName());
+                return true;
+              },
+              [&](const shared_model::interface::AddSignatory
+                      &add_signatory) {
+                writer.addSignatory(add_signatory.pubkey());
+                writer.addAccountSignatory(add_signatory.accountId(),
+                                           add_signatory.pubkey());
+                return true;
+              },
+              [&](const shared_model::interface::AddPeer &add_peer) {
+                writer.addPeer(add_peer.peer());
+                return true;
+              },
+              [](const auto &) { return false; });
+          if (not staged) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
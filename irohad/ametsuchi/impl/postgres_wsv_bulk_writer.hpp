@@ -0,0 +1,142 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_WSV_BULK_WRITER_HPP
+#define IROHA_POSTGRES_WSV_BULK_WRITER_HPP
+
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "common/result.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "interfaces/permissions.hpp"
+
+namespace soci {
+  class session;
+}
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+    class Peer;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Typed staging buffers for wholesale WSV writes. Rows are accumulated
+     * per entity table and flushed with one COPY per table, skipping the
+     * per-row statement round trips of WsvCommand. Used where a large state
+     * is written into an empty WSV at once: genesis application and
+     * snapshot restore.
+     */
+    class PostgresWsvBulkWriter {
+     public:
+      explicit PostgresWsvBulkWriter(soci::session &sql);
+
+      void addRole(const shared_model::interface::types::RoleIdType &role_id,
+                   const shared_model::interface::RolePermissionSet
+                       &permissions);
+
+      void addDomain(
+          const shared_model::interface::types::DomainIdType &domain_id,
+          const shared_model::interface::types::RoleIdType &default_role);
+
+      /// stage a signatory; duplicates are collapsed like ON CONFLICT would
+      void addSignatory(const std::string &pubkey_hex);
+
+      void addAccount(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::DomainIdType &domain_id,
+          shared_model::interface::types::QuorumType quorum);
+
+      void addAccountSignatory(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const std::string &pubkey_hex);
+
+      void addAccountRole(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::RoleIdType &role_id);
+
+      void addPeer(const shared_model::interface::Peer &peer);
+
+      void addAsset(
+          const shared_model::interface::types::AssetIdType &asset_id,
+          const shared_model::interface::types::DomainIdType &domain_id,
+          uint32_t precision);
+
+      /**
+       * COPY the staged rows into their tables in an order that satisfies
+       * the foreign key constraints, clearing the buffers.
+       * @return error description on failure
+       */
+      iroha::expected::Result<void, std::string> flush();
+
+     private:
+      struct {
+        std::vector<std::string> role_id;
+        std::vector<std::string> permission;
+      } roles_;
+
+      struct {
+        std::vector<std::string> domain_id;
+        std::vector<std::string> default_role;
+      } domains_;
+
+      /// lowercased, insertion-deduplicated
+      std::set<std::string> signatories_;
+
+      struct {
+        std::vector<std::string> account_id;
+        std::vector<std::string> domain_id;
+        std::vector<uint32_t> quorum;
+      } accounts_;
+
+      struct {
+        std::vector<std::string> account_id;
+        std::vector<std::string> public_key;
+      } account_signatories_;
+
+      struct {
+        std::vector<std::string> account_id;
+        std::vector<std::string> role_id;
+      } account_roles_;
+
+      struct {
+        std::vector<std::string> public_key;
+        std::vector<std::string> address;
+        std::vector<std::optional<std::string>> tls_certificate;
+      } peers_;
+
+      struct {
+        std::vector<std::string> asset_id;
+        std::vector<std::string> domain_id;
+        std::vector<uint32_t> precision;
+      } assets_;
+
+      soci::session &sql_;
+      std::string cache_;
+    };
+
+    /**
+     * Stage the effects of the genesis block commands into the writer.
+     * The genesis block writes into an empty WSV, so the commands reduce
+     * to plain row inserts. Nothing is written until the writer is
+     * flushed.
+     * @return true when every command was staged; false when the block
+     * contains a command the bulk path does not cover, in which case the
+     * caller should apply the block through the command executor instead
+     */
+    bool stageGenesisCommands(const shared_model::interface::Block &block,
+                              PostgresWsvBulkWriter &writer);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_WSV_BULK_WRITER_HPP
@@ -0,0 +1,32 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/query_permission_cache.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    boost::optional<bool> QueryPermissionCache::get(
+        const std::string &key) const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      auto it = decisions_.find(key);
+      if (it == decisions_.end()) {
+        return boost::none;
+      }
+      return it->second;
+    }
+
+    void QueryPermissionCache::put(const std::string &key, bool is_allowed) {
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      decisions_[key] = is_allowed;
+    }
+
+    void QueryPermissionCache::invalidate() {
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      decisions_.clear();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_AMETSUCHI_QUERY_PERMISSION_CACHE_HPP
+#define IROHA_AMETSUCHI_QUERY_PERMISSION_CACHE_HPP
+
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Cache of query permission check decisions, shared by the query
+     * executors of one storage. Query permissions are derived from the
+     * roles of the creator account, which change only when a committed
+     * block carries a role-mutating command, while clients tend to repeat
+     * the same queries with the same creator every round - so the decision
+     * is remembered until the storage invalidates the cache at such a
+     * commit (see touchesPermissions()).
+     *
+     * The key is chosen by the caller and must encode everything the
+     * decision was derived from - the executors use the generated
+     * permission check SQL, which has the creator, target and permission
+     * bits baked into its text.
+     */
+    class QueryPermissionCache {
+     public:
+      /// @return the remembered decision for the key, if there is one
+      boost::optional<bool> get(const std::string &key) const;
+
+      /// remember the permission check decision for the key
+      void put(const std::string &key, bool is_allowed);
+
+      /// forget all decisions; called when a committed block could have
+      /// changed the roles of some account
+      void invalidate();
+
+     private:
+      mutable std::shared_timed_mutex mutex_;
+      std::unordered_map<std::string, bool> decisions_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_AMETSUCHI_QUERY_PERMISSION_CACHE_HPP
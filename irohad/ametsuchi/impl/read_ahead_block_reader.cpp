@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/read_ahead_block_reader.hpp"
+
+#include "common/result.hpp"
+#include "common/thread_affinity.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    ReadAheadBlockReader::ReadAheadBlockReader(
+        BlockQuery &block_query,
+        shared_model::interface::types::HeightType starting_height,
+        shared_model::interface::types::HeightType ending_height,
+        size_t depth,
+        logger::LoggerPtr log)
+        : log_(std::move(log)),
+          block_query_(block_query),
+          starting_height_(starting_height),
+          ending_height_(ending_height),
+          depth_(depth),
+          worker_([this] { run(); }) {}
+
+    ReadAheadBlockReader::~ReadAheadBlockReader() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      worker_cv_.notify_one();
+      worker_.join();
+    }
+
+    BlockQuery::BlockResult ReadAheadBlockReader::next() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      consumer_cv_.wait(lock, [this] { return not queue_.empty(); });
+      auto result = std::move(queue_.front());
+      queue_.pop_front();
+      lock.unlock();
+      worker_cv_.notify_one();
+      return result;
+    }
+
+    void ReadAheadBlockReader::run() {
+      affinity::pinThisThread(affinity::stage::kStorage);
+      for (auto height = starting_height_; height <= ending_height_;
+           ++height) {
+        // both the storage read and the deserialization happen here, off the
+        // consumer thread
+        auto result = block_query_.getBlock(height);
+        bool failed = expected::hasError(result);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        worker_cv_.wait(lock,
+                        [this] { return stop_ or queue_.size() < depth_; });
+        if (stop_) {
+          return;
+        }
+        queue_.push_back(std::move(result));
+        lock.unlock();
+        consumer_cv_.notify_one();
+
+        if (failed) {
+          // the consumer stops the scan at the error, so the remaining
+          // heights will never be asked for
+          return;
+        }
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_READ_AHEAD_BLOCK_READER_HPP
+#define IROHA_READ_AHEAD_BLOCK_READER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "ametsuchi/block_query.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Sequential block reader which prefetches and deserializes the next
+     * blocks of a height range on a background thread, so that the
+     * deserialization of block k overlaps the processing of block k-1 by the
+     * consumer. Used for long chain scans - WSV restore, audit - which
+     * otherwise pay single-request storage latency per block. The prefetch
+     * queue is bounded, so the reader never runs more than the configured
+     * depth ahead of the consumer.
+     */
+    class ReadAheadBlockReader {
+     public:
+      /// prefetch depth which saturates a flat file scan without holding
+      /// many deserialized blocks in memory
+      static constexpr size_t kDefaultDepth = 8;
+
+      /**
+       * Starts prefetching immediately.
+       * @param block_query - source of blocks; must outlive the reader
+       * @param starting_height - the first block to read
+       * @param ending_height - the last block to read (inclusive)
+       * @param depth - how many blocks to fetch ahead of the consumer
+       * @param log - component logger
+       */
+      ReadAheadBlockReader(
+          BlockQuery &block_query,
+          shared_model::interface::types::HeightType starting_height,
+          shared_model::interface::types::HeightType ending_height,
+          size_t depth,
+          logger::LoggerPtr log);
+
+      ReadAheadBlockReader(const ReadAheadBlockReader &) = delete;
+      ReadAheadBlockReader &operator=(const ReadAheadBlockReader &) = delete;
+
+      /// Stops the prefetcher; pending results are dropped.
+      ~ReadAheadBlockReader();
+
+      /**
+       * Take the next block of the range, waiting for the prefetcher if it
+       * has not been read yet. Must be called at most once per height of the
+       * range, and not after an error was returned - the prefetcher stops at
+       * the first failed read.
+       * @return the next block, or the error which ended the scan
+       */
+      BlockQuery::BlockResult next();
+
+     private:
+      void run();
+
+      logger::LoggerPtr log_;
+      BlockQuery &block_query_;
+      const shared_model::interface::types::HeightType starting_height_;
+      const shared_model::interface::types::HeightType ending_height_;
+      const size_t depth_;
+      std::mutex mutex_;
+      std::condition_variable worker_cv_;
+      std::condition_variable consumer_cv_;
+      std::deque<BlockQuery::BlockResult> queue_;
+      bool stop_{false};
+      std::thread worker_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_READ_AHEAD_BLOCK_READER_HPP
@@ -0,0 +1,49 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/recent_blocks_cache.hpp"
+
+#include "interfaces/iroha_internal/block.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    RecentBlocksCache::~RecentBlocksCache() {
+      subscription_.unsubscribe();
+    }
+
+    void RecentBlocksCache::subscribeTo(
+        rxcpp::observable<
+            std::shared_ptr<const shared_model::interface::Block>> commits) {
+      commits.subscribe(subscription_,
+                        [this](auto block) { push(std::move(block)); });
+    }
+
+    void RecentBlocksCache::push(
+        std::shared_ptr<const shared_model::interface::Block> block) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      buffer_.push(
+          [this](Buffer::Handle, const Entry &entry) {
+            by_height_[entry->height()] = entry;
+          },
+          [this](Buffer::Handle, const Entry &entry) {
+            by_height_.erase(entry->height());
+          },
+          std::move(block));
+    }
+
+    std::shared_ptr<const shared_model::interface::Block>
+    RecentBlocksCache::get(
+        shared_model::interface::types::HeightType height) const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = by_height_.find(height);
+      if (it == by_height_.end()) {
+        return nullptr;
+      }
+      return it->second;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_RECENT_BLOCKS_CACHE_HPP
+#define IROHA_RECENT_BLOCKS_CACHE_HPP
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <rxcpp/rx-lite.hpp>
+#include "common/ring_buffer.hpp"
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Fixed-size ring of the most recently committed blocks, kept in their
+     * deserialized (and, for proto blocks, transport-carrying) form. Lagging
+     * peers which sync a recent range are served from here instead of
+     * re-reading the same block files from disk for every requester.
+     */
+    class RecentBlocksCache {
+     public:
+      /// number of committed blocks retained
+      static constexpr size_t kRecentBlocksCount = 64;
+
+      RecentBlocksCache() = default;
+      ~RecentBlocksCache();
+
+      RecentBlocksCache(const RecentBlocksCache &) = delete;
+      RecentBlocksCache &operator=(const RecentBlocksCache &) = delete;
+
+      /// retain commits from the given observable for as long as this
+      /// object lives
+      void subscribeTo(
+          rxcpp::observable<
+              std::shared_ptr<const shared_model::interface::Block>> commits);
+
+      /// add a committed block, evicting the oldest one when full
+      void push(std::shared_ptr<const shared_model::interface::Block> block);
+
+      /**
+       * @param height - height of a block to look up
+       * @return the block, or nullptr when it is not among the recent ones
+       */
+      std::shared_ptr<const shared_model::interface::Block> get(
+          shared_model::interface::types::HeightType height) const;
+
+     private:
+      using Entry = std::shared_ptr<const shared_model::interface::Block>;
+      using Buffer = containers::RingBuffer<Entry, kRecentBlocksCount>;
+
+      mutable std::mutex mutex_;
+      Buffer buffer_;
+      std::unordered_map<shared_model::interface::types::HeightType, Entry>
+          by_height_;
+      rxcpp::composite_subscription subscription_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_RECENT_BLOCKS_CACHE_HPP
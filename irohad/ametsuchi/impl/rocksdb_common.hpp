@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ROCKSDB_COMMON_HPP
+#define IROHA_ROCKSDB_COMMON_HPP
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <rocksdb/db.h>
+#include <rocksdb/options.h>
+#include "common/result.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Shared handle to an embedded RocksDB instance holding the world state
+     * view. All WSV data lives in the default column family under the
+     * following key schema (fields are separated with the 0x01 byte to keep
+     * account/asset identifiers, which may contain '/', unambiguous):
+     *
+     *   R|<role_id>                          -> role permissions bitstring
+     *   D|<domain_id>                        -> default role id
+     *   A|<account_id>|q                     -> quorum (decimal string)
+     *   A|<account_id>|d                     -> domain id
+     *   A|<account_id>|j                     -> JSON details blob
+     *   A|<account_id>|r|<role_id>           -> ""
+     *   A|<account_id>|s|<public_key>        -> ""
+     *   A|<account_id>|g|<permittee_id>      -> grantable permissions
+     *                                           bitstring
+     *   A|<account_id>|a|<asset_id>          -> balance string representation
+     *   X|<asset_id>|d                       -> domain id
+     *   X|<asset_id>|p                       -> precision (decimal string)
+     *   S|<public_key>                       -> ""
+     *   P|<public_key>                       -> address '\n' tls certificate
+     *   T                                    -> top block height ' ' hash hex
+     */
+    class RocksDbContext {
+     public:
+      static constexpr char kDelimiter = '\x01';
+
+      /**
+       * Open (or create) a database at the given path.
+       * @param path - filesystem directory for the database
+       * @return context on success, description of the error otherwise
+       */
+      static iroha::expected::Result<std::shared_ptr<RocksDbContext>,
+                                     std::string>
+      create(const std::string &path) {
+        rocksdb::Options options;
+        options.create_if_missing = true;
+        rocksdb::DB *db;
+        auto status = rocksdb::DB::Open(options, path, &db);
+        if (not status.ok()) {
+          return iroha::expected::makeError(
+              "failed to open RocksDB database at '" + path
+              + "': " + status.ToString());
+        }
+        return iroha::expected::makeValue(
+            std::shared_ptr<RocksDbContext>(new RocksDbContext(db)));
+      }
+
+      rocksdb::DB &db() {
+        return *db_;
+      }
+
+      /// Concatenate key fields with the schema delimiter.
+      template <typename... Fields>
+      static std::string makeKey(std::string_view prefix, Fields &&... fields) {
+        std::string key{prefix};
+        ((key += kDelimiter, key += fields), ...);
+        return key;
+      }
+
+     private:
+      explicit RocksDbContext(rocksdb::DB *db) : db_(db) {}
+
+      std::unique_ptr<rocksdb::DB> db_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ROCKSDB_COMMON_HPP
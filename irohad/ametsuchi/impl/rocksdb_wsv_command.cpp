@@ -0,0 +1,371 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/rocksdb_wsv_command.hpp"
+
+#include <fmt/core.h>
+#include <rocksdb/db.h>
+#include "ametsuchi/impl/rocksdb_common.hpp"
+#include "ametsuchi/ledger_state.hpp"
+#include "interfaces/common_objects/account.hpp"
+#include "interfaces/common_objects/account_asset.hpp"
+#include "interfaces/common_objects/asset.hpp"
+#include "interfaces/common_objects/domain.hpp"
+#include "interfaces/common_objects/peer.hpp"
+
+using shared_model::interface::GrantablePermissionSet;
+
+namespace {
+  iroha::ametsuchi::WsvCommandResult makeCommandError(
+      std::string description, const rocksdb::Status &status) {
+    return iroha::expected::makeError(
+        fmt::format("{}: {}", std::move(description), status.ToString()));
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    RocksDbWsvCommand::RocksDbWsvCommand(
+        std::shared_ptr<RocksDbContext> db_context)
+        : db_context_(std::move(db_context)) {}
+
+    WsvCommandResult RocksDbWsvCommand::insertRole(
+        const shared_model::interface::types::RoleIdType &role_name) {
+      auto status = db_context_->db().Put(rocksdb::WriteOptions(),
+                                          RocksDbContext::makeKey("R", role_name),
+                                          "");
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to insert role: '{}'", role_name), status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::insertAccountRole(
+        const shared_model::interface::types::AccountIdType &account_id,
+        const shared_model::interface::types::RoleIdType &role_name) {
+      auto status = db_context_->db().Put(
+          rocksdb::WriteOptions(),
+          RocksDbContext::makeKey("A", account_id, "r", role_name),
+          "");
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to insert account role, account: '{}', "
+                        "role name: '{}'",
+                        account_id,
+                        role_name),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::deleteAccountRole(
+        const shared_model::interface::types::AccountIdType &account_id,
+        const shared_model::interface::types::RoleIdType &role_name) {
+      auto status = db_context_->db().Delete(
+          rocksdb::WriteOptions(),
+          RocksDbContext::makeKey("A", account_id, "r", role_name));
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to delete account role, account id: '{}', "
+                        "role name: '{}'",
+                        account_id,
+                        role_name),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::insertRolePermissions(
+        const shared_model::interface::types::RoleIdType &role_id,
+        const shared_model::interface::RolePermissionSet &permissions) {
+      auto status =
+          db_context_->db().Put(rocksdb::WriteOptions(),
+                                RocksDbContext::makeKey("R", role_id),
+                                permissions.toBitstring());
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to insert role permissions, role id: '{}'",
+                        role_id),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::insertAccount(
+        const shared_model::interface::Account &account) {
+      rocksdb::WriteBatch batch;
+      batch.Put(RocksDbContext::makeKey("A", account.accountId(), "q"),
+                std::to_string(account.quorum()));
+      batch.Put(RocksDbContext::makeKey("A", account.accountId(), "d"),
+                account.domainId());
+      batch.Put(RocksDbContext::makeKey("A", account.accountId(), "j"),
+                account.jsonData());
+      auto status = db_context_->db().Write(rocksdb::WriteOptions(), &batch);
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to insert account, account id: '{}'",
+                        account.accountId()),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::updateAccount(
+        const shared_model::interface::Account &account) {
+      return insertAccount(account);
+    }
+
+    WsvCommandResult RocksDbWsvCommand::setAccountKV(
+        const shared_model::interface::types::AccountIdType &account_id,
+        const shared_model::interface::types::AccountIdType
+            &creator_account_id,
+        const std::string &key,
+        const std::string &val) {
+      auto status = db_context_->db().Put(
+          rocksdb::WriteOptions(),
+          RocksDbContext::makeKey("A", account_id, "k", creator_account_id, key),
+          val);
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to set account key-value, account id: '{}', "
+                        "creator account id: '{}'",
+                        account_id,
+                        creator_account_id),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::insertAsset(
+        const shared_model::interface::Asset &asset) {
+      rocksdb::WriteBatch batch;
+      batch.Put(RocksDbContext::makeKey("X", asset.assetId(), "d"),
+                asset.domainId());
+      batch.Put(RocksDbContext::makeKey("X", asset.assetId(), "p"),
+                std::to_string(asset.precision()));
+      auto status = db_context_->db().Write(rocksdb::WriteOptions(), &batch);
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to insert asset, asset id: '{}'",
+                        asset.assetId()),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::upsertAccountAsset(
+        const shared_model::interface::AccountAsset &asset) {
+      auto status = db_context_->db().Put(
+          rocksdb::WriteOptions(),
+          RocksDbContext::makeKey("A", asset.accountId(), "a", asset.assetId()),
+          asset.balance().toStringRepr());
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to upsert account asset, account id: '{}', "
+                        "asset id: '{}'",
+                        asset.accountId(),
+                        asset.assetId()),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::insertSignatory(
+        shared_model::interface::types::PublicKeyHexStringView signatory) {
+      auto status = db_context_->db().Put(
+          rocksdb::WriteOptions(),
+          RocksDbContext::makeKey("S", std::string_view{signatory}),
+          "");
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to insert signatory '{}'",
+                        std::string_view{signatory}),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::insertAccountSignatory(
+        const shared_model::interface::types::AccountIdType &account_id,
+        shared_model::interface::types::PublicKeyHexStringView signatory) {
+      auto status = db_context_->db().Put(
+          rocksdb::WriteOptions(),
+          RocksDbContext::makeKey(
+              "A", account_id, "s", std::string_view{signatory}),
+          "");
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to insert account signatory, account id: "
+                        "'{}', signatory: '{}'",
+                        account_id,
+                        std::string_view{signatory}),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::deleteAccountSignatory(
+        const shared_model::interface::types::AccountIdType &account_id,
+        shared_model::interface::types::PublicKeyHexStringView signatory) {
+      auto status = db_context_->db().Delete(
+          rocksdb::WriteOptions(),
+          RocksDbContext::makeKey(
+              "A", account_id, "s", std::string_view{signatory}));
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to delete account signatory, account id: "
+                        "'{}', signatory: '{}'",
+                        account_id,
+                        std::string_view{signatory}),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::deleteSignatory(
+        shared_model::interface::types::PublicKeyHexStringView signatory) {
+      auto status = db_context_->db().Delete(
+          rocksdb::WriteOptions(),
+          RocksDbContext::makeKey("S", std::string_view{signatory}));
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to delete signatory '{}'",
+                        std::string_view{signatory}),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::insertPeer(
+        const shared_model::interface::Peer &peer) {
+      std::string value = peer.address();
+      value += '\n';
+      if (auto tls_certificate = peer.tlsCertificate()) {
+        value += *tls_certificate;
+      }
+      auto status =
+          db_context_->db().Put(rocksdb::WriteOptions(),
+                                RocksDbContext::makeKey("P", peer.pubkey()),
+                                value);
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to insert peer, public key: '{}', "
+                        "address: '{}'",
+                        peer.pubkey(),
+                        peer.address()),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::deletePeer(
+        const shared_model::interface::Peer &peer) {
+      auto status =
+          db_context_->db().Delete(rocksdb::WriteOptions(),
+                                   RocksDbContext::makeKey("P", peer.pubkey()));
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to delete peer, public key: '{}', "
+                        "address: '{}'",
+                        peer.pubkey(),
+                        peer.address()),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::insertDomain(
+        const shared_model::interface::Domain &domain) {
+      auto status =
+          db_context_->db().Put(rocksdb::WriteOptions(),
+                                RocksDbContext::makeKey("D", domain.domainId()),
+                                domain.defaultRole());
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to insert domain, domain id: '{}', "
+                        "default role: '{}'",
+                        domain.domainId(),
+                        domain.defaultRole()),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::insertAccountGrantablePermission(
+        const shared_model::interface::types::AccountIdType
+            &permittee_account_id,
+        const shared_model::interface::types::AccountIdType &account_id,
+        shared_model::interface::permissions::Grantable permission) {
+      const auto key =
+          RocksDbContext::makeKey("A", account_id, "g", permittee_account_id);
+      std::string bitstring;
+      auto get_status =
+          db_context_->db().Get(rocksdb::ReadOptions(), key, &bitstring);
+      GrantablePermissionSet permissions =
+          get_status.ok() ? GrantablePermissionSet{bitstring}
+                          : GrantablePermissionSet{};
+      permissions.set(permission);
+      auto status = db_context_->db().Put(
+          rocksdb::WriteOptions(), key, permissions.toBitstring());
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to insert account grantable permission, "
+                        "permittee account id: '{}', account id: '{}'",
+                        permittee_account_id,
+                        account_id),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::deleteAccountGrantablePermission(
+        const shared_model::interface::types::AccountIdType
+            &permittee_account_id,
+        const shared_model::interface::types::AccountIdType &account_id,
+        shared_model::interface::permissions::Grantable permission) {
+      const auto key =
+          RocksDbContext::makeKey("A", account_id, "g", permittee_account_id);
+      std::string bitstring;
+      auto get_status =
+          db_context_->db().Get(rocksdb::ReadOptions(), key, &bitstring);
+      if (not get_status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to delete account grantable permission, "
+                        "permittee account id: '{}', account id: '{}'",
+                        permittee_account_id,
+                        account_id),
+            get_status);
+      }
+      auto permissions = GrantablePermissionSet{bitstring}.unset(permission);
+      auto status = db_context_->db().Put(
+          rocksdb::WriteOptions(), key, permissions.toBitstring());
+      if (not status.ok()) {
+        return makeCommandError(
+            fmt::format("failed to delete account grantable permission, "
+                        "permittee account id: '{}', account id: '{}'",
+                        permittee_account_id,
+                        account_id),
+            status);
+      }
+      return {};
+    }
+
+    WsvCommandResult RocksDbWsvCommand::setTopBlockInfo(
+        const TopBlockInfo &top_block_info) const {
+      auto status =
+          db_context_->db().Put(rocksdb::WriteOptions(),
+                                "T",
+                                std::to_string(top_block_info.height) + " "
+                                    + top_block_info.top_hash.hex());
+      if (not status.ok()) {
+        return makeCommandError("failed to set top block info", status);
+      }
+      return {};
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
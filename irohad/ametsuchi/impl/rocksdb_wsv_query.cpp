@@ -0,0 +1,120 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/rocksdb_wsv_query.hpp"
+
+#include <rocksdb/db.h>
+#include "ametsuchi/impl/rocksdb_common.hpp"
+#include "ametsuchi/ledger_state.hpp"
+#include "backend/plain/peer.hpp"
+#include "common/result.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /// Split a peer value stored as "address '\n' tls certificate".
+  std::shared_ptr<shared_model::interface::Peer> makePeer(
+      std::string public_key, const std::string &value) {
+    auto delimiter_pos = value.find('\n');
+    std::string address = value.substr(0, delimiter_pos);
+    std::optional<std::string> tls_certificate;
+    if (delimiter_pos != std::string::npos
+        and delimiter_pos + 1 < value.size()) {
+      tls_certificate = value.substr(delimiter_pos + 1);
+    }
+    return std::make_shared<shared_model::plain::Peer>(
+        address, std::move(public_key), tls_certificate);
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    RocksDbWsvQuery::RocksDbWsvQuery(std::shared_ptr<RocksDbContext> db_context,
+                                     logger::LoggerPtr log)
+        : db_context_(std::move(db_context)), log_(std::move(log)) {}
+
+    boost::optional<std::vector<std::string>> RocksDbWsvQuery::getSignatories(
+        const shared_model::interface::types::AccountIdType &account_id) {
+      const auto prefix = RocksDbContext::makeKey("A", account_id, "s")
+          + RocksDbContext::kDelimiter;
+      std::vector<std::string> signatories;
+      std::unique_ptr<rocksdb::Iterator> it(
+          db_context_->db().NewIterator(rocksdb::ReadOptions()));
+      for (it->Seek(prefix); it->Valid() and it->key().starts_with(prefix);
+           it->Next()) {
+        signatories.emplace_back(it->key().ToString().substr(prefix.size()));
+      }
+      if (not it->status().ok()) {
+        log_->error("Failed to get signatories of '{}': {}",
+                    account_id,
+                    it->status().ToString());
+        return boost::none;
+      }
+      return boost::make_optional(std::move(signatories));
+    }
+
+    boost::optional<std::vector<std::shared_ptr<shared_model::interface::Peer>>>
+    RocksDbWsvQuery::getPeers() {
+      const auto prefix = std::string{"P"} + RocksDbContext::kDelimiter;
+      std::vector<std::shared_ptr<shared_model::interface::Peer>> peers;
+      std::unique_ptr<rocksdb::Iterator> it(
+          db_context_->db().NewIterator(rocksdb::ReadOptions()));
+      for (it->Seek(prefix); it->Valid() and it->key().starts_with(prefix);
+           it->Next()) {
+        peers.push_back(makePeer(it->key().ToString().substr(prefix.size()),
+                                 it->value().ToString()));
+      }
+      if (not it->status().ok()) {
+        log_->error("Failed to get peers: {}", it->status().ToString());
+        return boost::none;
+      }
+      return boost::make_optional(std::move(peers));
+    }
+
+    boost::optional<std::shared_ptr<shared_model::interface::Peer>>
+    RocksDbWsvQuery::getPeerByPublicKey(
+        shared_model::interface::types::PublicKeyHexStringView public_key) {
+      std::string target_public_key{public_key};
+      std::string value;
+      auto status =
+          db_context_->db().Get(rocksdb::ReadOptions(),
+                                RocksDbContext::makeKey("P", target_public_key),
+                                &value);
+      if (status.IsNotFound()) {
+        return boost::none;
+      }
+      if (not status.ok()) {
+        log_->error("Failed to get peer by public key '{}': {}",
+                    target_public_key,
+                    status.ToString());
+        return boost::none;
+      }
+      return boost::make_optional(makePeer(std::move(target_public_key), value));
+    }
+
+    iroha::expected::Result<iroha::TopBlockInfo, std::string>
+    RocksDbWsvQuery::getTopBlockInfo() const {
+      std::string value;
+      auto status = db_context_->db().Get(rocksdb::ReadOptions(), "T", &value);
+      if (status.IsNotFound()) {
+        return "No top block information in WSV.";
+      }
+      if (not status.ok()) {
+        return status.ToString();
+      }
+      auto delimiter_pos = value.find(' ');
+      if (delimiter_pos == std::string::npos) {
+        return "Malformed top block information in WSV.";
+      }
+      shared_model::interface::types::HeightType height =
+          std::stoull(value.substr(0, delimiter_pos));
+      shared_model::crypto::Hash hash(shared_model::crypto::Blob::fromHexString(
+          value.substr(delimiter_pos + 1)));
+      assert(not hash.blob().empty());
+      return iroha::TopBlockInfo{height, hash};
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,51 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ROCKSDB_WSV_QUERY_HPP
+#define IROHA_ROCKSDB_WSV_QUERY_HPP
+
+#include "ametsuchi/wsv_query.hpp"
+
+#include <memory>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class RocksDbContext;
+
+    /**
+     * WsvQuery implementation over an embedded RocksDB instance. Reads are
+     * served from the local key-value store without leaving the process.
+     */
+    class RocksDbWsvQuery : public WsvQuery {
+     public:
+      RocksDbWsvQuery(std::shared_ptr<RocksDbContext> db_context,
+                      logger::LoggerPtr log);
+
+      boost::optional<std::vector<std::string>> getSignatories(
+          const shared_model::interface::types::AccountIdType &account_id)
+          override;
+
+      boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::Peer>>>
+      getPeers() override;
+
+      boost::optional<std::shared_ptr<shared_model::interface::Peer>>
+      getPeerByPublicKey(shared_model::interface::types::PublicKeyHexStringView
+                             public_key) override;
+
+      iroha::expected::Result<iroha::TopBlockInfo, std::string>
+      getTopBlockInfo() const override;
+
+     private:
+      std::shared_ptr<RocksDbContext> db_context_;
+      logger::LoggerPtr log_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ROCKSDB_WSV_QUERY_HPP
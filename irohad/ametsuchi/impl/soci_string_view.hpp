@@ -25,11 +25,12 @@ namespace soci {
           >> {
     using base_type = std::string;
 
-    static void from_base(base_type const &in,
-                          indicator ind,
-                          std::string_view &out) {
-      // TODO IR-726 @mboldyrev 07.05.2020 prevent silent acceptance
-      // of std::string to soci::into
+    static void from_base(base_type const &in, indicator ind, T &out) {
+      // the view aliases the string soci keeps for this into-binding, so
+      // the read does not copy the column; it stays valid until the next
+      // fetch or rebind on the same statement, which covers the per-row
+      // processing the callers do
+      out = T{std::string_view{in}};
     }
 
     static void to_base(std::string_view const &in,
@@ -5,6 +5,7 @@
 
 #include "ametsuchi/impl/storage_impl.hpp"
 
+#include <fstream>
 #include <utility>
 
 #include <soci/callbacks.h>
@@ -13,6 +14,9 @@
 #include <boost/format.hpp>
 #include <boost/range/algorithm/replace_if.hpp>
 #include <boost/tuple/tuple.hpp>
+#include "ametsuchi/impl/async_block_indexer.hpp"
+#include "ametsuchi/impl/async_commit_notifier.hpp"
+#include "ametsuchi/impl/ledger_peers_snapshot.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
@@ -26,7 +30,11 @@
 #include "ametsuchi/impl/postgres_specific_query_executor.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/query_permission_cache.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
+#include "ametsuchi/impl/touches_peer_set.hpp"
+#include "ametsuchi/impl/touches_permissions.hpp"
+#include "ametsuchi/impl/wsv_snapshot.hpp"
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/tx_executor.hpp"
 #include "backend/protobuf/permissions.hpp"
@@ -57,10 +65,14 @@ namespace iroha {
         std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
         size_t pool_size,
         std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
-        logger::LoggerManagerTreePtr log_manager)
+        logger::LoggerManagerTreePtr log_manager,
+        IndexRetentionPolicy index_retention_policy)
         : block_store_(std::move(block_store)),
           pool_wrapper_(std::move(pool_wrapper)),
           connection_(pool_wrapper_->connection_pool_),
+          maintenance_connection_(pool_wrapper_->maintenance_pool_),
+          replica_connections_(pool_wrapper_->replica_pools_),
+          next_replica_index_(0),
           notifier_(notifier_lifetime_),
           perm_converter_(std::move(perm_converter)),
           pending_txs_storage_(std::move(pending_txs_storage)),
@@ -75,7 +87,34 @@ namespace iroha {
               pool_wrapper_->enable_prepared_transactions_),
           block_is_prepared_(false),
           prepared_block_name_(postgres_options.preparedBlockName()),
-          ledger_state_(std::move(ledger_state)) {}
+          ledger_state_(std::move(ledger_state)),
+          ledger_peers_snapshot_(std::make_shared<LedgerPeersSnapshot>()),
+          query_permission_cache_(std::make_shared<QueryPermissionCache>()),
+          async_block_indexer_(std::make_shared<AsyncBlockIndexer>(
+              connection_,
+              ledger_state_ ? ledger_state_.value()->top_block_info.height : 0,
+              log_manager_->getChild("AsyncBlockIndexer")->getLogger())),
+          index_retention_(std::make_shared<IndexRetention>(
+              connection_,
+              index_retention_policy,
+              log_manager_->getChild("IndexRetention")->getLogger())),
+          commit_notifier_worker_(std::make_unique<AsyncCommitNotifier>(
+              [this](auto block) {
+                notifier_.get_subscriber().on_next(std::move(block));
+              },
+              log_manager_->getChild("AsyncCommitNotifier")->getLogger())) {
+      publishPeersSnapshot();
+    }
+
+    void StorageImpl::publishPeersSnapshot() {
+      if (ledger_state_) {
+        // alias into the ledger state, so the snapshot epoch shares its
+        // lifetime without copying the peer list
+        ledger_peers_snapshot_->set(
+            std::shared_ptr<const shared_model::interface::types::PeerList>(
+                ledger_state_.value(), &ledger_state_.value()->ledger_peers));
+      }
+    }
 
     std::unique_ptr<TemporaryWsv> StorageImpl::createTemporaryWsv(
         std::shared_ptr<CommandExecutor> command_executor) {
@@ -107,7 +146,7 @@ namespace iroha {
         return boost::none;
       }
       return boost::make_optional<std::shared_ptr<PeerQuery>>(
-          std::make_shared<PeerQueryWsv>(wsv));
+          std::make_shared<PeerQueryWsv>(wsv, ledger_peers_snapshot_));
     }
 
     boost::optional<std::shared_ptr<BlockQuery>> StorageImpl::createBlockQuery()
@@ -128,7 +167,7 @@ namespace iroha {
       if (not connection_) {
         return "createQueryExecutor: connection to database is not initialised";
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
+      auto sql = createQuerySession();
       auto log_manager = log_manager_->getChild("QueryExecutor");
       return std::make_unique<PostgresQueryExecutor>(
           std::move(sql),
@@ -139,10 +178,43 @@ namespace iroha {
               std::move(pending_txs_storage),
               response_factory,
               perm_converter_,
-              log_manager->getChild("SpecificQueryExecutor")->getLogger()),
+              log_manager->getChild("SpecificQueryExecutor")->getLogger(),
+              async_block_indexer_,
+              query_permission_cache_,
+              index_retention_),
           log_manager->getLogger());
     }
 
+    std::unique_ptr<soci::session> StorageImpl::createQuerySession() const {
+      const auto committed_height = ledger_state_
+          ? (*ledger_state_)->top_block_info.height
+          : shared_model::interface::types::HeightType{0};
+      for (size_t attempt = 0; attempt < replica_connections_.size();
+           ++attempt) {
+        auto &replica_pool =
+            replica_connections_[next_replica_index_.fetch_add(1)
+                                 % replica_connections_.size()];
+        try {
+          auto session = std::make_unique<soci::session>(*replica_pool);
+          // only serve from a replica which has already applied the state
+          // this peer has committed, so a client never observes its own
+          // transaction disappear
+          shared_model::interface::types::HeightType replica_height = 0;
+          *session << "SELECT height FROM top_block_info",
+              soci::into(replica_height);
+          if (replica_height >= committed_height) {
+            return session;
+          }
+          log_->debug("replica is behind: {} < {}, trying the next one",
+                      replica_height,
+                      committed_height);
+        } catch (const std::exception &e) {
+          log_->warn("replica connection failed: {}", e.what());
+        }
+      }
+      return std::make_unique<soci::session>(*connection_);
+    }
+
     expected::Result<void, std::string> StorageImpl::insertBlock(
         std::shared_ptr<const shared_model::interface::Block> block) {
       log_->info("create mutable storage");
@@ -168,13 +240,38 @@ namespace iroha {
       return wsv_command.insertPeer(peer);
     }
 
+    expected::Result<void, std::string> StorageImpl::dumpWsvSnapshot(
+        const std::string &path) {
+      log_->info("Dump WSV snapshot to {}", path);
+      std::ofstream dest(path, std::ofstream::binary);
+      if (not dest.is_open()) {
+        return expected::makeError(
+            fmt::format("Cannot open '{}' for writing", path));
+      }
+      soci::session sql(*connection_);
+      return saveWsvSnapshot(sql, dest, log_);
+    }
+
+    expected::Result<void, std::string> StorageImpl::loadWsvSnapshot(
+        const std::string &path) {
+      log_->info("Load WSV snapshot from {}", path);
+      std::ifstream src(path, std::ifstream::binary);
+      if (not src.is_open()) {
+        return expected::makeError(
+            fmt::format("Cannot open '{}' for reading", path));
+      }
+      soci::session sql(*connection_);
+      return restoreWsvSnapshot(sql, src, log_);
+    }
+
     expected::Result<std::unique_ptr<CommandExecutor>, std::string>
     StorageImpl::createCommandExecutor() {
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
       if (connection_ == nullptr) {
         return expected::makeError("Connection was closed");
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
+      auto sql = std::make_unique<soci::session>(
+          maintenance_connection_ ? *maintenance_connection_ : *connection_);
       return std::make_unique<PostgresCommandExecutor>(
           std::move(sql),
           perm_converter_,
@@ -232,6 +329,8 @@ namespace iroha {
         log_->warn("Tried to free connections without active connection");
         return;
       }
+      // stop the background indexer before its pool sessions are closed
+      async_block_indexer_.reset();
       // rollback possible prepared transaction
       {
         soci::session sql(*connection_);
@@ -244,6 +343,25 @@ namespace iroha {
         log_->debug("Closed connection {}", i);
       }
       sessions.clear();
+      if (maintenance_connection_) {
+        for (size_t i = 0; i < PoolWrapper::kMaintenancePoolSize; i++) {
+          sessions.push_back(
+              std::make_shared<soci::session>(*maintenance_connection_));
+          sessions.back()->close();
+          log_->debug("Closed maintenance connection {}", i);
+        }
+        sessions.clear();
+        maintenance_connection_.reset();
+      }
+      for (auto &replica_pool : replica_connections_) {
+        for (size_t i = 0; i < pool_size_; i++) {
+          sessions.push_back(std::make_shared<soci::session>(*replica_pool));
+          sessions.back()->close();
+          log_->debug("Closed replica connection {}", i);
+        }
+        sessions.clear();
+      }
+      replica_connections_.clear();
       connection_.reset();
     }
 
@@ -260,7 +378,8 @@ namespace iroha {
         std::shared_ptr<BlockStorage> persistent_block_storage,
         std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
         logger::LoggerManagerTreePtr log_manager,
-        size_t pool_size) {
+        size_t pool_size,
+        IndexRetentionPolicy index_retention_policy) {
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state;
       {
         soci::session sql{*pool_wrapper->connection_pool_};
@@ -292,7 +411,8 @@ namespace iroha {
                           std::move(temporary_block_storage_factory),
                           pool_size,
                           std::move(vm_caller_ref),
-                          std::move(log_manager))));
+                          std::move(log_manager),
+                          index_retention_policy)));
     }
 
     CommitResult StorageImpl::commit(
@@ -301,14 +421,20 @@ namespace iroha {
       return std::move(*mutable_storage).commit(*block_store_) |
                  [this, old_height](auto commit_result) -> CommitResult {
         ledger_state_ = commit_result.ledger_state;
+        publishPeersSnapshot();
         auto new_height = block_store_->size();
         for (auto height = old_height + 1; height <= new_height; ++height) {
           auto maybe_block = block_store_->fetch(height);
           if (not maybe_block) {
             return fmt::format("Failed to fetch block {}", height);
           }
-          notifier_.get_subscriber().on_next(*std::move(maybe_block));
+          if (touchesPermissions(**maybe_block)) {
+            query_permission_cache_->invalidate();
+          }
+          async_block_indexer_->enqueue(*maybe_block);
+          commit_notifier_worker_->enqueue(*std::move(maybe_block));
         }
+        index_retention_->onCommittedHeight(new_height);
         return expected::makeValue(std::move(commit_result.ledger_state));
       };
     }
@@ -342,35 +468,49 @@ namespace iroha {
           return fmt::format("Failed to insert block {}", *block);
         }
 
-        soci::session sql(*connection_);
+        soci::session sql(
+            maintenance_connection_ ? *maintenance_connection_ : *connection_);
         sql << "COMMIT PREPARED '" + prepared_block_name_ + "';";
         PostgresBlockIndex block_index(
             std::make_unique<PostgresIndexer>(sql),
             log_manager_->getChild("BlockIndex")->getLogger());
-        block_index.index(*block);
+        block_index.indexStatuses(*block);
+        async_block_indexer_->enqueue(block);
+        index_retention_->onCommittedHeight(block->height());
         block_is_prepared_ = false;
 
+        if (touchesPermissions(*block)) {
+          query_permission_cache_->invalidate();
+        }
+
         if (auto e = expected::resultToOptionalError(
                 PostgresWsvCommand{sql}.setTopBlockInfo(
                     TopBlockInfo{block->height(), block->hash()}))) {
           throw std::runtime_error(e.value());
         }
 
-        notifier_.get_subscriber().on_next(block);
+        commit_notifier_worker_->enqueue(block);
 
-        decltype(std::declval<PostgresWsvQuery>().getPeers()) opt_ledger_peers;
-        {
+        // the prepared commit is the per-round critical section, so the
+        // peer list SQL round trip is skipped when the block cannot have
+        // changed the peer set
+        shared_model::interface::types::PeerList ledger_peers;
+        if (ledger_state_ and not touchesPeerSet(*block)) {
+          ledger_peers = ledger_state_.value()->ledger_peers;
+        } else {
           auto peer_query = PostgresWsvQuery(
               sql, this->log_manager_->getChild("WsvQuery")->getLogger());
-          if (not(opt_ledger_peers = peer_query.getPeers())) {
+          auto opt_ledger_peers = peer_query.getPeers();
+          if (not opt_ledger_peers) {
             return expected::makeError(
                 std::string{"Failed to get ledger peers! Will retry."});
           }
+          ledger_peers = std::move(*opt_ledger_peers);
         }
-        assert(opt_ledger_peers);
 
         ledger_state_ = std::make_shared<const LedgerState>(
-            std::move(*opt_ledger_peers), block->height(), block->hash());
+            std::move(ledger_peers), block->height(), block->hash());
+        publishPeersSnapshot();
         return expected::makeValue(ledger_state_.value());
       } catch (const std::exception &e) {
         std::string msg((boost::format("failed to apply prepared block %s: %s")
@@ -423,6 +563,11 @@ namespace iroha {
       return notifier_.get_observable();
     }
 
+    bool StorageImpl::flushCommitNotifications(
+        std::chrono::milliseconds timeout) {
+      return commit_notifier_worker_->waitUntilDelivered(timeout);
+    }
+
     void StorageImpl::prepareBlock(std::unique_ptr<TemporaryWsv> wsv) {
       auto &wsv_impl = static_cast<TemporaryWsvImpl &>(*wsv);
       if (not prepared_blocks_enabled_) {
@@ -447,6 +592,8 @@ namespace iroha {
     }
 
     StorageImpl::~StorageImpl() {
+      // deliver the pending notifications while the subscribers are alive
+      commit_notifier_worker_.reset();
       notifier_lifetime_.unsubscribe();
       freeConnections();
     }
@@ -454,7 +601,7 @@ namespace iroha {
     StorageImpl::StoreBlockResult StorageImpl::storeBlock(
         std::shared_ptr<const shared_model::interface::Block> block) {
       if (block_store_->insert(block)) {
-        notifier_.get_subscriber().on_next(block);
+        commit_notifier_worker_->enqueue(block);
         return {};
       }
       return expected::makeError("Block insertion to storage failed");
@@ -15,6 +15,7 @@
 #include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/block_storage_factory.hpp"
+#include "ametsuchi/impl/index_retention.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/key_value_storage.hpp"
 #include "ametsuchi/ledger_state.hpp"
@@ -35,7 +36,11 @@ namespace iroha {
   namespace ametsuchi {
 
     class AmetsuchiTest;
+    class AsyncBlockIndexer;
+    class AsyncCommitNotifier;
+    class LedgerPeersSnapshot;
     class PostgresOptions;
+    class QueryPermissionCache;
     class VmCaller;
 
     class StorageImpl : public Storage {
@@ -52,7 +57,8 @@ namespace iroha {
           std::shared_ptr<BlockStorage> persistent_block_storage,
           std::optional<std::reference_wrapper<const VmCaller>> vm_caller_ref,
           logger::LoggerManagerTreePtr log_manager,
-          size_t pool_size = 10);
+          size_t pool_size = 10,
+          IndexRetentionPolicy index_retention_policy = {});
 
       expected::Result<std::unique_ptr<CommandExecutor>, std::string>
       createCommandExecutor() override;
@@ -113,8 +119,26 @@ namespace iroha {
       rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
       on_commit() override;
 
+      bool flushCommitNotifications(
+          std::chrono::milliseconds timeout) override;
+
       void prepareBlock(std::unique_ptr<TemporaryWsv> wsv) override;
 
+      /**
+       * Dump the WSV tables into a snapshot file at the given path (see
+       * wsv_snapshot.hpp for the format). The snapshot carries the current
+       * top block info, so restoring it and running WsvRestorerImpl replays
+       * only the chain tail above the snapshot height.
+       */
+      expected::Result<void, std::string> dumpWsvSnapshot(
+          const std::string &path);
+
+      /**
+       * Load a WSV snapshot file into an empty WSV.
+       */
+      expected::Result<void, std::string> loadWsvSnapshot(
+          const std::string &path);
+
       ~StorageImpl() override;
 
      protected:
@@ -132,7 +156,8 @@ namespace iroha {
           std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory,
           size_t pool_size,
           std::optional<std::reference_wrapper<const VmCaller>> vm_caller,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          IndexRetentionPolicy index_retention_policy = {});
 
      private:
       using StoreBlockResult = iroha::expected::Result<void, std::string>;
@@ -150,6 +175,19 @@ namespace iroha {
        */
       void tryRollback(soci::session &session);
 
+      /**
+       * Publish the peer list of the current ledger state to the lock-free
+       * snapshot. Must be called after every ledger_state_ update.
+       */
+      void publishPeersSnapshot();
+
+      /**
+       * Lease a session for a torii query. When read replicas are configured,
+       * picks one which has caught up with the committed ledger height,
+       * falling back to the primary pool otherwise.
+       */
+      std::unique_ptr<soci::session> createQuerySession() const;
+
       std::shared_ptr<BlockStorage> block_store_;
 
       std::shared_ptr<PoolWrapper> pool_wrapper_;
@@ -157,6 +195,17 @@ namespace iroha {
       /// ref for pool_wrapper_::connection_pool_
       std::shared_ptr<soci::connection_pool> &connection_;
 
+      /// ref for pool_wrapper_::maintenance_pool_; commit path sessions are
+      /// taken from here so queries do not queue behind a block commit
+      std::shared_ptr<soci::connection_pool> &maintenance_connection_;
+
+      /// ref for pool_wrapper_::replica_pools_; torii queries are routed to
+      /// these read replicas when they are not behind the committed height
+      std::vector<std::shared_ptr<soci::connection_pool>> &replica_connections_;
+
+      /// round-robin cursor over replica_connections_
+      mutable std::atomic<size_t> next_replica_index_;
+
       rxcpp::composite_subscription notifier_lifetime_;
       rxcpp::subjects::subject<
           std::shared_ptr<const shared_model::interface::Block>>
@@ -188,6 +237,26 @@ namespace iroha {
       std::string prepared_block_name_;
 
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state_;
+
+      /// lock-free peer list snapshot republished on every ledger state
+      /// change; served by the peer queries created by createPeerQuery()
+      std::shared_ptr<LedgerPeersSnapshot> ledger_peers_snapshot_;
+
+      /// query permission decisions shared by the query executors; flushed
+      /// on commit of a block with a role-mutating command
+      std::shared_ptr<QueryPermissionCache> query_permission_cache_;
+
+      /// builds tx position indices of committed blocks off the commit path;
+      /// initialized after ledger_state_ to start at the committed height
+      std::shared_ptr<AsyncBlockIndexer> async_block_indexer_;
+
+      /// prunes tx position indices below the retention watermark; shared
+      /// with the query executors which refuse out-of-retention requests
+      std::shared_ptr<IndexRetention> index_retention_;
+
+      /// delivers committed blocks to the on_commit subscribers off the
+      /// committing thread; reset before notifier_lifetime_ is closed
+      std::unique_ptr<AsyncCommitNotifier> commit_notifier_worker_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -5,12 +5,18 @@
 
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 
+#include <algorithm>
+#include <cctype>
+
 #include <boost/algorithm/string/join.hpp>
-#include <boost/format.hpp>
-#include <boost/range/adaptor/transformed.hpp>
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/tx_executor.hpp"
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_signatory.hpp"
 #include "interfaces/commands/command.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/set_quorum.hpp"
 #include "interfaces/permission_to_string.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
@@ -32,31 +38,9 @@ namespace iroha {
     expected::Result<void, validation::CommandError>
     TemporaryWsvImpl::validateSignatures(
         const shared_model::interface::Transaction &transaction) {
-      auto keys_range = transaction.signatures()
-          | boost::adaptors::transformed(
-                            [](const auto &s) { return s.publicKey(); });
-      auto keys = boost::algorithm::join(keys_range, "'), ('");
-      // not using bool since it is not supported by SOCI
-      boost::optional<uint8_t> signatories_valid;
-
-      boost::format query(R"(SELECT sum(count) = :signatures_count
-                          AND sum(quorum) <= :signatures_count
-                  FROM
-                      (SELECT count(public_key)
-                      FROM ( VALUES ('%s') ) AS CTE1(public_key)
-                      WHERE lower(public_key) IN
-                          (SELECT public_key
-                          FROM account_has_signatory
-                          WHERE account_id = :account_id ) ) AS CTE2(count),
-                          (SELECT quorum
-                          FROM account
-                          WHERE account_id = :account_id) AS CTE3(quorum))");
-
+      const SignatoryState *state = nullptr;
       try {
-        auto keys_range_size = boost::size(keys_range);
-        sql_ << (query % keys).str(), soci::into(signatories_valid),
-            soci::use(keys_range_size, "signatures_count"),
-            soci::use(transaction.creatorAccountId(), "account_id");
+        state = findSignatoryState(transaction.creatorAccountId());
       } catch (const std::exception &e) {
         auto error_str = "Transaction " + transaction.toString()
             + " failed signatures validation with db error: " + e.what();
@@ -66,7 +50,7 @@ namespace iroha {
             "signatures validation", 1, error_str, false});
       }
 
-      if (signatories_valid and *signatories_valid) {
+      if (state and checkSignatures(*state, transaction)) {
         return {};
       } else {
         auto error_str = "Transaction " + transaction.toString()
@@ -78,11 +62,162 @@ namespace iroha {
       }
     }
 
-    expected::Result<void, validation::CommandError> TemporaryWsvImpl::apply(
+    std::vector<expected::Result<void, validation::CommandError>>
+    TemporaryWsvImpl::validateSignatures(
+        const std::vector<std::reference_wrapper<
+            const shared_model::interface::Transaction>> &transactions) {
+      std::vector<expected::Result<void, validation::CommandError>> results;
+      if (transactions.empty()) {
+        return results;
+      }
+
+      try {
+        // load the creators missing from the overlay with a single query
+        std::unordered_set<std::string> missing_accounts;
+        for (const auto &transaction_ref : transactions) {
+          const auto &creator = transaction_ref.get().creatorAccountId();
+          if (signatory_overlay_.count(creator) == 0) {
+            missing_accounts.insert(creator);
+          }
+        }
+        if (not missing_accounts.empty()) {
+          fetchSignatoryStates(missing_accounts);
+        }
+
+        for (const auto &transaction_ref : transactions) {
+          const auto &transaction = transaction_ref.get();
+          auto state = signatory_overlay_.find(transaction.creatorAccountId());
+          if (state != signatory_overlay_.end()
+              and checkSignatures(state->second, transaction)) {
+            results.emplace_back(expected::Value<void>{});
+          } else {
+            auto error_str = "Transaction " + transaction.toString()
+                + " failed signatures validation";
+            // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic
+            // number with named constant
+            results.emplace_back(expected::makeError(validation::CommandError{
+                "signatures validation", 2, error_str, false}));
+          }
+        }
+      } catch (const std::exception &e) {
+        results.clear();
+        for (const auto &transaction_ref : transactions) {
+          auto error_str = "Transaction " + transaction_ref.get().toString()
+              + " failed signatures validation with db error: " + e.what();
+          // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic
+          // number with named constant
+          results.emplace_back(expected::makeError(validation::CommandError{
+              "signatures validation", 1, error_str, false}));
+        }
+      }
+      return results;
+    }
+
+    void TemporaryWsvImpl::prefetchSignatories(
+        const std::vector<std::reference_wrapper<
+            const shared_model::interface::Transaction>> &transactions) {
+      std::unordered_set<std::string> missing_accounts;
+      for (const auto &transaction_ref : transactions) {
+        const auto &creator = transaction_ref.get().creatorAccountId();
+        if (signatory_overlay_.count(creator) == 0) {
+          missing_accounts.insert(creator);
+        }
+      }
+      if (missing_accounts.empty()) {
+        return;
+      }
+      try {
+        fetchSignatoryStates(missing_accounts);
+      } catch (const std::exception &e) {
+        // best effort - the validation queries will report the problem
+        log_->warn("signatory prefetch failed: {}", e.what());
+      }
+    }
+
+    void TemporaryWsvImpl::fetchSignatoryStates(
+        const std::unordered_set<std::string> &account_ids) {
+      // all the ids travel in a single bound parameter and are split
+      // back on the server: the account id grammar has no commas, and
+      // binding keeps the id bytes out of the statement text
+      auto ids = boost::algorithm::join(account_ids, ",");
+      soci::rowset<soci::row> rows(
+          (sql_.prepare << "SELECT a.account_id, a.quorum, s.public_key "
+                           "FROM account a "
+                           "LEFT JOIN account_has_signatory s "
+                           "ON s.account_id = a.account_id "
+                           "WHERE a.account_id = "
+                           "ANY(string_to_array(:ids, ','))",
+           soci::use(ids, "ids")));
+      for (const auto &row : rows) {
+        auto &state = signatory_overlay_[row.get<std::string>(0)];
+        state.quorum = row.get<int>(1);
+        if (row.get_indicator(2) == soci::i_ok) {
+          state.signatories.insert(row.get<std::string>(2));
+        }
+      }
+    }
+
+    const TemporaryWsvImpl::SignatoryState *
+    TemporaryWsvImpl::findSignatoryState(
+        const shared_model::interface::types::AccountIdType &account_id) {
+      auto it = signatory_overlay_.find(account_id);
+      if (it == signatory_overlay_.end()) {
+        fetchSignatoryStates({account_id});
+        it = signatory_overlay_.find(account_id);
+      }
+      return it == signatory_overlay_.end() ? nullptr : &it->second;
+    }
+
+    bool TemporaryWsvImpl::checkSignatures(
+        const SignatoryState &state,
+        const shared_model::interface::Transaction &transaction) const {
+      // the overlay keys are lowercase, as in account_has_signatory
+      size_t signatures_count = 0;
+      size_t known_signatories = 0;
+      for (const auto &signature : transaction.signatures()) {
+        ++signatures_count;
+        auto key = signature.publicKey();
+        std::transform(key.begin(), key.end(), key.begin(), [](char c) {
+          return std::tolower(c);
+        });
+        known_signatories += state.signatories.count(key);
+      }
+      return known_signatories == signatures_count
+          and state.quorum <= static_cast<int>(signatures_count);
+    }
+
+    void TemporaryWsvImpl::invalidateSignatoryState(
         const shared_model::interface::Transaction &transaction) {
+      for (const auto &command : transaction.commands()) {
+        visit_in_place(
+            command.get(),
+            [this](const shared_model::interface::AddSignatory &cmd) {
+              signatory_overlay_.erase(cmd.accountId());
+            },
+            [this](const shared_model::interface::RemoveSignatory &cmd) {
+              signatory_overlay_.erase(cmd.accountId());
+            },
+            [this](const shared_model::interface::SetQuorum &cmd) {
+              signatory_overlay_.erase(cmd.accountId());
+            },
+            [this](const shared_model::interface::CreateAccount &cmd) {
+              signatory_overlay_.erase(cmd.accountName() + "@"
+                                       + cmd.domainId());
+            },
+            [](const auto &) {});
+      }
+    }
+
+    expected::Result<void, validation::CommandError>
+    TemporaryWsvImpl::applyInternal(
+        const shared_model::interface::Transaction &transaction,
+        bool do_signatures_check) {
       auto savepoint_wrapper = createSavepoint("savepoint_temp_wsv");
 
-      return validateSignatures(transaction) |
+      auto signatures_result = do_signatures_check
+          ? validateSignatures(transaction)
+          : expected::Result<void, validation::CommandError>{};
+      return std::move(signatures_result) |
                  [this,
                   savepoint = std::move(savepoint_wrapper),
                   &transaction]()
@@ -96,12 +231,25 @@ namespace iroha {
                                        true,
                                        error->command_index});
         }
-        // success
+        // success - the applied commands may have changed quorums or
+        // signatories, so the affected overlay entries must be refetched
+        invalidateSignatoryState(transaction);
         savepoint->release();
         return {};
       };
     }
 
+    expected::Result<void, validation::CommandError> TemporaryWsvImpl::apply(
+        const shared_model::interface::Transaction &transaction) {
+      return applyInternal(transaction, true);
+    }
+
+    expected::Result<void, validation::CommandError>
+    TemporaryWsvImpl::applyPrevalidated(
+        const shared_model::interface::Transaction &transaction) {
+      return applyInternal(transaction, false);
+    }
+
     std::unique_ptr<TemporaryWsv::SavepointWrapper>
     TemporaryWsvImpl::createSavepoint(const std::string &name) {
       return std::make_unique<TemporaryWsvImpl::SavepointWrapperImpl>(
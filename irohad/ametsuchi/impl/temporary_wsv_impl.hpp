@@ -8,8 +8,13 @@
 
 #include "ametsuchi/temporary_wsv.hpp"
 
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
 #include <soci/soci.h>
 #include "ametsuchi/command_executor.hpp"
+#include "interfaces/common_objects/types.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
 
@@ -52,12 +57,38 @@ namespace iroha {
       expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) override;
 
+      void prefetchSignatories(
+          const std::vector<std::reference_wrapper<
+              const shared_model::interface::Transaction>> &transactions)
+          override;
+
+      std::vector<expected::Result<void, validation::CommandError>>
+      validateSignatures(
+          const std::vector<std::reference_wrapper<
+              const shared_model::interface::Transaction>> &transactions)
+          override;
+
+      expected::Result<void, validation::CommandError> applyPrevalidated(
+          const shared_model::interface::Transaction &transaction) override;
+
       std::unique_ptr<TemporaryWsv::SavepointWrapper> createSavepoint(
           const std::string &name) override;
 
       ~TemporaryWsvImpl() override;
 
      private:
+      /**
+       * Signature-validation view of one account. Entries are filled from
+       * the open database transaction and dropped when a transaction of the
+       * same proposal changes the account, so repeated creators are served
+       * from memory instead of another database round trip.
+       */
+      struct SignatoryState {
+        int quorum;
+        /// lowercase hex signatory keys of the account
+        std::unordered_set<std::string> signatories;
+      };
+
       /**
        * Verifies whether transaction has at least quorum signatures and they
        * are a subset of creator account signatories
@@ -65,7 +96,42 @@ namespace iroha {
       expected::Result<void, validation::CommandError> validateSignatures(
           const shared_model::interface::Transaction &transaction);
 
+      /**
+       * Applies a transaction with an optional signatures check
+       */
+      expected::Result<void, validation::CommandError> applyInternal(
+          const shared_model::interface::Transaction &transaction,
+          bool do_signatures_check);
+
+      /**
+       * Load the signatory states of the given accounts from the database
+       * into the overlay with a single query. Accounts missing from WSV are
+       * left out of the overlay - they may be created later in the proposal.
+       */
+      void fetchSignatoryStates(
+          const std::unordered_set<std::string> &account_ids);
+
+      /**
+       * Find the signatory state of an account, fetching it from the
+       * database on an overlay miss.
+       * @return the state, or nullptr if the account does not exist
+       */
+      const SignatoryState *findSignatoryState(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      /// check the signatures of the transaction against an account state
+      bool checkSignatures(
+          const SignatoryState &state,
+          const shared_model::interface::Transaction &transaction) const;
+
+      /// drop overlay entries of accounts the transaction has modified
+      void invalidateSignatoryState(
+          const shared_model::interface::Transaction &transaction);
+
       soci::session &sql_;
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         SignatoryState>
+          signatory_overlay_;
       std::unique_ptr<TransactionExecutor> transaction_executor_;
 
       logger::LoggerManagerTreePtr log_manager_;
@@ -0,0 +1,45 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_AMETSUCHI_TOUCHES_PEER_SET_HPP
+#define IROHA_AMETSUCHI_TOUCHES_PEER_SET_HPP
+
+#include <algorithm>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/remove_peer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+    /// true if the block contains a command which can modify the peer list
+    inline bool touchesPeerSet(const shared_model::interface::Block &block) {
+      return std::any_of(
+          block.transactions().begin(),
+          block.transactions().end(),
+          [](const auto &tx) {
+            return std::any_of(
+                tx.commands().begin(),
+                tx.commands().end(),
+                [](const auto &command) {
+                  return iroha::visit_in_place(
+                      command.get(),
+                      [](const shared_model::interface::AddPeer &) {
+                        return true;
+                      },
+                      [](const shared_model::interface::RemovePeer &) {
+                        return true;
+                      },
+                      [](const auto &) { return false; });
+                });
+          });
+    }
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_AMETSUCHI_TOUCHES_PEER_SET_HPP
@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_AMETSUCHI_TOUCHES_PERMISSIONS_HPP
+#define IROHA_AMETSUCHI_TOUCHES_PERMISSIONS_HPP
+
+#include <algorithm>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+    /**
+     * True if the block contains a command which can change the role
+     * permissions of an existing account. Only role attachment matters
+     * here: role permission sets are immutable once the role is created,
+     * and a role created in this block grants nothing until it is
+     * appended to an account.
+     */
+    inline bool touchesPermissions(
+        const shared_model::interface::Block &block) {
+      return std::any_of(
+          block.transactions().begin(),
+          block.transactions().end(),
+          [](const auto &tx) {
+            return std::any_of(
+                tx.commands().begin(),
+                tx.commands().end(),
+                [](const auto &command) {
+                  return iroha::visit_in_place(
+                      command.get(),
+                      [](const shared_model::interface::AppendRole &) {
+                        return true;
+                      },
+                      [](const shared_model::interface::DetachRole &) {
+                        return true;
+                      },
+                      [](const auto &) { return false; });
+                });
+          });
+    }
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_AMETSUCHI_TOUCHES_PERMISSIONS_HPP
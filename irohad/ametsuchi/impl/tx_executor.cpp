@@ -5,25 +5,101 @@
 
 #include "ametsuchi/tx_executor.hpp"
 
+#include <chrono>
+
+#include <boost/optional.hpp>
+#include "ametsuchi/command_stats_collector.hpp"
+#include "backend/protobuf/transaction.hpp"
 #include "interfaces/commands/command.hpp"
 #include "interfaces/transaction.hpp"
 
 using namespace iroha::ametsuchi;
 
+namespace {
+  /// names for the command types covered by the raw execution path
+  const char *rawCommandName(const iroha::protocol::Command &cmd) {
+    switch (cmd.command_case()) {
+      case iroha::protocol::Command::kTransferAsset:
+        return "TransferAsset";
+      case iroha::protocol::Command::kAddAssetQuantity:
+        return "AddAssetQuantity";
+      case iroha::protocol::Command::kSubtractAssetQuantity:
+        return "SubtractAssetQuantity";
+      default:
+        return "Unknown";
+    }
+  }
+}  // namespace
+
 TransactionExecutor::TransactionExecutor(
-    std::shared_ptr<CommandExecutor> command_executor)
-    : command_executor_(std::move(command_executor)) {}
+    std::shared_ptr<CommandExecutor> command_executor,
+    std::shared_ptr<CommandStatsCollector> stats_collector)
+    : command_executor_(std::move(command_executor)),
+      stats_collector_(std::move(stats_collector)) {}
 
 iroha::expected::Result<void, TxExecutionError> TransactionExecutor::execute(
     const shared_model::interface::Transaction &transaction,
     bool do_validation) const {
   const auto &hash = transaction.hash().hex();
   const auto &creator_account_id = transaction.creatorAccountId();
+
+  // proto-backed transactions take the direct path where the executor
+  // supports it: the raw protobuf command is bound into the prepared
+  // statements without constructing the shared model wrappers, which
+  // spares a variant and a multiprecision amount parse per hot command
+  if (const auto *proto_tx =
+          dynamic_cast<const shared_model::proto::Transaction *>(
+              &transaction)) {
+    const auto &raw_commands =
+        proto_tx->getTransport().payload().reduced_payload().commands();
+    // materialized lazily, only when a command type has no direct path
+    boost::optional<shared_model::interface::Transaction::CommandsType>
+        wrapped_commands;
+    size_t cmd_index = 0;
+    for (const auto &raw_cmd : raw_commands) {
+      const auto started_at = std::chrono::steady_clock::now();
+      boost::optional<CommandError> cmd_error;
+      if (auto raw_result = command_executor_->executeRaw(
+              raw_cmd, creator_account_id, hash, cmd_index, do_validation)) {
+        if (stats_collector_) {
+          stats_collector_->record(
+              rawCommandName(raw_cmd),
+              std::chrono::steady_clock::now() - started_at);
+        }
+        cmd_error =
+            iroha::expected::resultToOptionalError(raw_result.value());
+      } else {
+        if (not wrapped_commands) {
+          wrapped_commands = transaction.commands();
+        }
+        const auto &cmd = (*wrapped_commands)[cmd_index];
+        auto result = command_executor_->execute(
+            cmd, creator_account_id, hash, cmd_index, do_validation);
+        if (stats_collector_) {
+          stats_collector_->record(
+              cmd, std::chrono::steady_clock::now() - started_at);
+        }
+        cmd_error = iroha::expected::resultToOptionalError(result);
+      }
+      if (cmd_error) {
+        return iroha::expected::makeError(
+            TxExecutionError{std::move(cmd_error.value()), cmd_index});
+      }
+      ++cmd_index;
+    }
+    return {};
+  }
+
   size_t cmd_index = 0;
   for (const auto &cmd : transaction.commands()) {
-    if (auto cmd_error =
-            iroha::expected::resultToOptionalError(command_executor_->execute(
-                cmd, creator_account_id, hash, cmd_index, do_validation))) {
+    const auto started_at = std::chrono::steady_clock::now();
+    auto result = command_executor_->execute(
+        cmd, creator_account_id, hash, cmd_index, do_validation);
+    if (stats_collector_) {
+      stats_collector_->record(cmd,
+                               std::chrono::steady_clock::now() - started_at);
+    }
+    if (auto cmd_error = iroha::expected::resultToOptionalError(result)) {
       return iroha::expected::makeError(
           TxExecutionError{std::move(cmd_error.value()), cmd_index});
     }
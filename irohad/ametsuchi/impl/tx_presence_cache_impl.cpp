@@ -5,15 +5,69 @@
 
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 
+#include "ametsuchi/block_query.hpp"
 #include "common/bind.hpp"
 #include "common/visitor.hpp"
+#include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
 
+namespace {
+  void addBlockHashes(
+      iroha::cache::BloomFilter<shared_model::crypto::Hash,
+                                shared_model::crypto::Hash::Hasher> &filter,
+      const shared_model::interface::Block &block) {
+    for (const auto &tx : block.transactions()) {
+      filter.add(tx.hash());
+    }
+    for (const auto &rejected_hash : block.rejected_transactions_hashes()) {
+      filter.add(rejected_hash);
+    }
+  }
+}  // namespace
+
 namespace iroha {
   namespace ametsuchi {
-    TxPresenceCacheImpl::TxPresenceCacheImpl(std::shared_ptr<Storage> storage)
-        : storage_(std::move(storage)) {}
+    TxPresenceCacheImpl::TxPresenceCacheImpl(std::shared_ptr<Storage> storage,
+                                             bool use_bloom_filter)
+        : storage_(std::move(storage)) {
+      if (use_bloom_filter) {
+        committed_hashes_filter_ = std::make_shared<
+            cache::BloomFilter<shared_model::crypto::Hash,
+                               shared_model::crypto::Hash::Hasher>>();
+        if (not populateBloomFilter()) {
+          // an incomplete filter cannot prove absence - disable it
+          committed_hashes_filter_.reset();
+        }
+      }
+    }
+
+    TxPresenceCacheImpl::~TxPresenceCacheImpl() {
+      commit_subscription_.unsubscribe();
+    }
+
+    bool TxPresenceCacheImpl::populateBloomFilter() {
+      auto block_query = storage_->getBlockQuery();
+      if (not block_query) {
+        return false;
+      }
+      // subscribe before the walk so no commit is lost in between
+      auto filter = committed_hashes_filter_;
+      commit_subscription_ = storage_->on_commit().subscribe(
+          [filter](auto block) { addBlockHashes(*filter, *block); });
+      auto top_height = block_query->getTopBlockHeight();
+      for (shared_model::interface::types::HeightType height = 1;
+           height <= top_height;
+           ++height) {
+        auto result = block_query->getBlock(height);
+        if (expected::hasError(result)) {
+          return false;
+        }
+        addBlockHashes(*committed_hashes_filter_,
+                       *std::move(result).assumeValue());
+      }
+      return true;
+    }
 
     boost::optional<TxCacheStatusType> TxPresenceCacheImpl::check(
         const shared_model::crypto::Hash &hash) const {
@@ -21,6 +75,12 @@ namespace iroha {
       if (res) {
         return *res;
       }
+      if (committed_hashes_filter_
+          and not committed_hashes_filter_->maybeContains(hash)) {
+        // the filter covers every committed and rejected hash, so a negative
+        // answer is definitive and needs no storage round trip
+        return TxCacheStatusType{tx_cache_status_responses::Missing{hash}};
+      }
       return checkInStorage(hash);
     }
 
@@ -6,16 +6,28 @@
 #ifndef IROHA_TX_PRESENCE_CACHE_IMPL_HPP
 #define IROHA_TX_PRESENCE_CACHE_IMPL_HPP
 
+#include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/storage.hpp"
 #include "ametsuchi/tx_presence_cache.hpp"
-#include "cache/cache.hpp"
+#include "cache/bloom_filter.hpp"
+#include "cache/sharded_cache.hpp"
 
 namespace iroha {
   namespace ametsuchi {
 
     class TxPresenceCacheImpl : public TxPresenceCache {
      public:
-      explicit TxPresenceCacheImpl(std::shared_ptr<Storage> storage);
+      /**
+       * @param storage - underlying persistent storage
+       * @param use_bloom_filter - keep a bloom filter over all committed and
+       * rejected transaction hashes, populated from block storage at
+       * construction and updated on every commit, so definitively-absent
+       * hashes are answered without a storage round trip
+       */
+      explicit TxPresenceCacheImpl(std::shared_ptr<Storage> storage,
+                                   bool use_bloom_filter = false);
+
+      ~TxPresenceCacheImpl() override;
 
       boost::optional<TxCacheStatusType> check(
           const shared_model::crypto::Hash &hash) const override;
@@ -34,11 +46,22 @@ namespace iroha {
       boost::optional<TxCacheStatusType> checkInStorage(
           const shared_model::crypto::Hash &hash) const;
 
+      /**
+       * Fill the bloom filter with the hashes of all transactions in block
+       * storage and subscribe to commits for incremental updates
+       * @return true if the filter covers the whole chain and can be trusted
+       */
+      bool populateBloomFilter();
+
       std::shared_ptr<Storage> storage_;
-      mutable cache::Cache<shared_model::crypto::Hash,
-                           TxCacheStatusType,
-                           shared_model::crypto::Hash::Hasher>
+      mutable cache::ShardedCache<shared_model::crypto::Hash,
+                                  TxCacheStatusType,
+                                  shared_model::crypto::Hash::Hasher>
           memory_cache_;
+      std::shared_ptr<cache::BloomFilter<shared_model::crypto::Hash,
+                                         shared_model::crypto::Hash::Hasher>>
+          committed_hashes_filter_;
+      rxcpp::composite_subscription commit_subscription_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/tx_rw_set.hpp"
+
+#include <unordered_map>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/compare_and_set_account_detail.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    TxRwSet extractRwSet(const shared_model::interface::Transaction &tx) {
+      TxRwSet rw_set;
+      rw_set.accounts.emplace(tx.creatorAccountId());
+      for (const auto &command : tx.commands()) {
+        boost::apply_visitor(
+            make_visitor(
+                [&](const shared_model::interface::AddAssetQuantity &) {
+                  // credits the creator's balance, already in the set
+                },
+                [&](const shared_model::interface::SubtractAssetQuantity &) {
+                  // debits the creator's balance, already in the set
+                },
+                [&](const shared_model::interface::TransferAsset &transfer) {
+                  rw_set.accounts.emplace(transfer.srcAccountId());
+                  rw_set.accounts.emplace(transfer.destAccountId());
+                },
+                [&](const shared_model::interface::AddSignatory &cmd) {
+                  rw_set.accounts.emplace(cmd.accountId());
+                },
+                [&](const shared_model::interface::RemoveSignatory &cmd) {
+                  rw_set.accounts.emplace(cmd.accountId());
+                },
+                [&](const shared_model::interface::SetQuorum &cmd) {
+                  rw_set.accounts.emplace(cmd.accountId());
+                },
+                [&](const shared_model::interface::AppendRole &cmd) {
+                  rw_set.accounts.emplace(cmd.accountId());
+                },
+                [&](const shared_model::interface::DetachRole &cmd) {
+                  rw_set.accounts.emplace(cmd.accountId());
+                },
+                [&](const shared_model::interface::GrantPermission &cmd) {
+                  rw_set.accounts.emplace(cmd.accountId());
+                },
+                [&](const shared_model::interface::RevokePermission &cmd) {
+                  rw_set.accounts.emplace(cmd.accountId());
+                },
+                [&](const shared_model::interface::SetAccountDetail &cmd) {
+                  rw_set.accounts.emplace(cmd.accountId());
+                },
+                [&](const shared_model::interface::CompareAndSetAccountDetail
+                        &cmd) { rw_set.accounts.emplace(cmd.accountId()); },
+                [&](const shared_model::interface::CreateAccount &cmd) {
+                  rw_set.accounts.emplace(cmd.accountName() + "@"
+                                          + cmd.domainId());
+                },
+                // commands below mutate or read state shared between
+                // accounts and are treated as global barriers
+                [&](const auto &) { rw_set.global = true; }),
+            command.get());
+      }
+      return rw_set;
+    }
+
+    std::vector<std::vector<size_t>> scheduleIndependentWaves(
+        const std::vector<
+            std::reference_wrapper<const shared_model::interface::Transaction>>
+            &txs) {
+      std::vector<std::vector<size_t>> waves;
+      // index of the last wave that touched the account
+      std::unordered_map<InternedString, size_t> last_wave_of_account;
+      // everything at or below this wave must precede any new transaction
+      size_t barrier_wave = 0;
+
+      for (size_t index = 0; index < txs.size(); ++index) {
+        const auto rw_set = extractRwSet(txs[index].get());
+
+        size_t wave = barrier_wave;
+        for (const auto &account : rw_set.accounts) {
+          auto it = last_wave_of_account.find(account);
+          if (it != last_wave_of_account.end()) {
+            wave = std::max(wave, it->second + 1);
+          }
+        }
+        if (rw_set.global) {
+          // a global transaction runs alone after everything scheduled
+          wave = std::max(wave, waves.size());
+        }
+
+        if (wave >= waves.size()) {
+          waves.resize(wave + 1);
+        }
+        waves[wave].push_back(index);
+
+        for (const auto &account : rw_set.accounts) {
+          last_wave_of_account[account] = wave;
+        }
+        if (rw_set.global) {
+          barrier_wave = wave + 1;
+        }
+      }
+      return waves;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TX_RW_SET_HPP
+#define IROHA_TX_RW_SET_HPP
+
+#include <unordered_set>
+#include <vector>
+
+#include "common/interned_string.hpp"
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Conservative read/write set of a transaction, used to decide which
+     * transactions may be applied concurrently during WSV restore and
+     * stateful validation. Commands touching global state (peers, roles,
+     * domains, assets, settings, the EVM) set the global flag and act as a
+     * barrier.
+     *
+     * Account ids are interned: membership tests and the wave scheduler's
+     * per-account map work on pointer identity instead of hashing and
+     * comparing the id characters for every transaction.
+     */
+    struct TxRwSet {
+      std::unordered_set<InternedString> accounts;
+      bool global{false};
+    };
+
+    /**
+     * Extract the read/write set of a transaction. The creator account is
+     * always included since quorum and signatories are read for it.
+     */
+    TxRwSet extractRwSet(const shared_model::interface::Transaction &tx);
+
+    /**
+     * Partition transactions into waves of mutually independent
+     * transactions. Transactions inside one wave have disjoint read/write
+     * sets and may be applied concurrently; waves must be applied in order.
+     * @param txs - transactions in their block order
+     * @return waves of indices into txs, in execution order
+     */
+    std::vector<std::vector<size_t>> scheduleIndependentWaves(
+        const std::vector<
+            std::reference_wrapper<const shared_model::interface::Transaction>>
+            &txs);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_TX_RW_SET_HPP
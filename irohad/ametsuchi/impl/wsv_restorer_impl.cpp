@@ -12,6 +12,9 @@
 #include "ametsuchi/block_storage.hpp"
 #include "ametsuchi/block_storage_factory.hpp"
 #include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/impl/mutable_storage_impl.hpp"
+#include "ametsuchi/impl/parallel_wave_applier.hpp"
+#include "ametsuchi/impl/read_ahead_block_reader.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "ametsuchi/storage.hpp"
 #include "backend/protobuf/block.hpp"
@@ -97,6 +100,7 @@ namespace {
    * @param validator - chain validator
    * @param starting_height - the first block to apply
    * @param ending_height - the last block to apply (inclusive)
+   * @param log - logger for the block prefetcher
    * @return commit status after applying the blocks
    */
   iroha::ametsuchi::CommitResult reindexBlocks(
@@ -109,16 +113,26 @@ namespace {
           &proto_validator,
       iroha::validation::ChainValidator &validator,
       HeightType starting_height,
-      HeightType ending_height) {
+      HeightType ending_height,
+      logger::LoggerPtr log) {
     auto blocks = rxcpp::observable<>::create<
         std::shared_ptr<shared_model::interface::Block>>([&block_query,
                                                           &interface_validator,
                                                           &proto_validator,
+                                                          &log,
                                                           starting_height,
                                                           ending_height](
                                                              auto s) {
+      // prefetch and deserialize the following blocks while the current one
+      // is being validated and applied
+      iroha::ametsuchi::ReadAheadBlockReader reader(
+          block_query,
+          starting_height,
+          ending_height,
+          iroha::ametsuchi::ReadAheadBlockReader::kDefaultDepth,
+          log);
       for (auto height = starting_height; height <= ending_height; ++height) {
-        auto result = block_query.getBlock(height);
+        auto result = reader.next();
         if (auto e = iroha::expected::resultToOptionalError(result)) {
           s.on_error(std::make_exception_ptr(
               std::runtime_error(std::move(e).value().message)));
@@ -169,11 +183,13 @@ namespace iroha::ametsuchi {
       std::unique_ptr<shared_model::validation::AbstractValidator<
           iroha::protocol::Block_v1>> proto_validator,
       std::shared_ptr<validation::ChainValidator> validator,
-      logger::LoggerPtr log)
+      logger::LoggerPtr log,
+      size_t parallel_sessions)
       : interface_validator_{std::move(interface_validator)},
         proto_validator_{std::move(proto_validator)},
         validator_{std::move(validator)},
-        log_{std::move(log)} {}
+        log_{std::move(log)},
+        parallel_sessions_{parallel_sessions} {}
 
   CommitResult WsvRestorerImpl::restoreWsv(Storage &storage,
                                            bool wait_for_new_blocks) {
@@ -247,6 +263,35 @@ namespace iroha::ametsuchi {
             wsv_ledger_height = 0;
           }
 
+          // a full rebuild of a fresh WSV may be applied wave-parallel
+          // on several sessions; an incremental catch-up may not: the
+          // worker sessions autocommit, so a crash would leave writes
+          // above the recorded top block which a rerun would apply again
+          if (parallel_sessions_ > 1 and wsv_ledger_height == 0) {
+            if (auto *mutable_storage_impl = dynamic_cast<MutableStorageImpl *>(
+                    mutable_storage.get())) {
+              std::vector<std::shared_ptr<CommandExecutor>> workers;
+              while (workers.size() < parallel_sessions_) {
+                auto worker = storage.createCommandExecutor();
+                if (auto e = expected::resultToOptionalError(worker)) {
+                  log_->warn(
+                      "Cannot create a session for parallel restore, "
+                      "falling back to sequential: {}",
+                      e.value());
+                  break;
+                }
+                workers.push_back(std::move(worker).assumeValue());
+              }
+              if (workers.size() == parallel_sessions_) {
+                log_->info("Restoring the WSV on {} parallel sessions",
+                           workers.size());
+                mutable_storage_impl->enableParallelApply(
+                    std::make_shared<ParallelWaveApplier>(std::move(workers),
+                                                          log_));
+              }
+            }
+          }
+
           return reindexBlocks(storage,
                                mutable_storage,
                                *block_query,
@@ -254,7 +299,8 @@ namespace iroha::ametsuchi {
                                *proto_validator_,
                                *validator_,
                                wsv_ledger_height + 1,
-                               last_block_in_storage);
+                               last_block_in_storage,
+                               log_);
         };
         if (hasError(res)) {
           break;
@@ -36,13 +36,21 @@ namespace iroha {
      */
     class WsvRestorerImpl : public WsvRestorer {
      public:
+      /**
+       * @param parallel_sessions - number of database sessions applying
+       * independent transactions concurrently when the WSV is rebuilt
+       * from scratch; those sessions autocommit, so an interrupted
+       * parallel restore has to be restarted with a dropped WSV;
+       * sequential, fully transactional restore when below 2
+       */
       WsvRestorerImpl(
           std::unique_ptr<shared_model::validation::AbstractValidator<
               shared_model::interface::Block>> interface_validator,
           std::unique_ptr<shared_model::validation::AbstractValidator<
               iroha::protocol::Block_v1>> proto_validator,
           std::shared_ptr<validation::ChainValidator> validator,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          size_t parallel_sessions = 0);
 
       virtual ~WsvRestorerImpl() = default;
       /**
@@ -66,6 +74,7 @@ namespace iroha {
           proto_validator_;
       std::shared_ptr<validation::ChainValidator> validator_;
       logger::LoggerPtr log_;
+      size_t parallel_sessions_;
     };
 
   }  // namespace ametsuchi
@@ -0,0 +1,200 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_snapshot.hpp"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include <fmt/core.h>
+#include <soci/soci.h>
+#include "ametsuchi/impl/postgres_copy.hpp"
+#include "ametsuchi/impl/wsv_state_digest.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /**
+   * WSV tables in an order that satisfies foreign key constraints on
+   * restore.
+   */
+  const std::vector<std::string> kWsvTables{"role",
+                                            "domain",
+                                            "signatory",
+                                            "account",
+                                            "account_has_signatory",
+                                            "peer",
+                                            "asset",
+                                            "account_has_asset",
+                                            "role_has_permissions",
+                                            "account_has_roles",
+                                            "account_has_grantable_permissions",
+                                            "setting",
+                                            "top_block_info"};
+
+  /// pseudo-section carrying the WSV state digest of the dump
+  const std::string kWsvDigestSection{"wsv_digest"};
+
+  /// Render a row column as text, NULL as \N.
+  std::string columnToText(const soci::row &row, size_t index) {
+    if (row.get_indicator(index) == soci::i_null) {
+      return "\\N";
+    }
+    switch (row.get_properties(index).get_data_type()) {
+      case soci::dt_string:
+        return iroha::ametsuchi::escapeCopyField(row.get<std::string>(index));
+      case soci::dt_integer:
+        return std::to_string(row.get<int>(index));
+      case soci::dt_long_long:
+        return std::to_string(row.get<long long>(index));
+      case soci::dt_unsigned_long_long:
+        return std::to_string(row.get<unsigned long long>(index));
+      case soci::dt_double:
+        return std::to_string(row.get<double>(index));
+      default:
+        throw std::runtime_error("unsupported column type in WSV snapshot");
+    }
+  }
+
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    iroha::expected::Result<void, std::string> saveWsvSnapshot(
+        soci::session &sql, std::ostream &dest, logger::LoggerPtr log) {
+      try {
+        sql << "BEGIN TRANSACTION ISOLATION LEVEL REPEATABLE READ READ ONLY";
+        for (const auto &table : kWsvTables) {
+          dest << '*' << table << '\n';
+          soci::rowset<soci::row> rows =
+              (sql.prepare << fmt::format("SELECT * FROM {}", table));
+          size_t row_count = 0;
+          for (const auto &row : rows) {
+            for (size_t i = 0; i < row.size(); ++i) {
+              if (i != 0) {
+                dest << '\t';
+              }
+              dest << columnToText(row, i);
+            }
+            dest << '\n';
+            ++row_count;
+          }
+          log->debug("dumped {} rows of {}", row_count, table);
+        }
+        // the state digest of the dumped WSV; the restoring side uses it
+        // to verify the loaded state without replaying the chain
+        auto digest = WsvStateDigest::fromWsv(sql);
+        if (auto e = expected::resultToOptionalError(digest)) {
+          sql << "ROLLBACK";
+          return iroha::expected::makeError(std::move(e).value());
+        }
+        dest << '*' << kWsvDigestSection << '\n'
+             << std::move(digest).assumeValue().root().to_hexstring() << '\n';
+        sql << "COMMIT";
+      } catch (const std::exception &e) {
+        sql << "ROLLBACK";
+        return iroha::expected::makeError(
+            fmt::format("failed to save WSV snapshot: {}", e.what()));
+      }
+      if (not dest.good()) {
+        return iroha::expected::makeError(
+            std::string{"failed to write WSV snapshot"});
+      }
+      return {};
+    }
+
+    iroha::expected::Result<void, std::string> restoreWsvSnapshot(
+        soci::session &sql, std::istream &src, logger::LoggerPtr log) {
+      std::string table;
+      std::string line;
+      std::string rows;
+      std::string expected_root;
+      size_t line_number = 0;
+      // the snapshot rows are already in the COPY text format, so each
+      // table section is fed to the server as one COPY instead of a
+      // round trip per row
+      auto flush_section =
+          [&]() -> iroha::expected::Result<void, std::string> {
+        if (table.empty() or table == kWsvDigestSection or rows.empty()) {
+          return {};
+        }
+        if (auto error =
+                copyRows(sql, fmt::format("COPY {} FROM STDIN", table), rows)) {
+          return iroha::expected::makeError(std::move(*error));
+        }
+        rows.clear();
+        return {};
+      };
+      try {
+        sql << "BEGIN";
+        while (std::getline(src, line)) {
+          ++line_number;
+          if (not line.empty() and line[0] == '*') {
+            if (auto e = expected::resultToOptionalError(flush_section())) {
+              sql << "ROLLBACK";
+              return iroha::expected::makeError(std::move(e).value());
+            }
+            table = line.substr(1);
+            if (table != kWsvDigestSection
+                and std::find(kWsvTables.begin(), kWsvTables.end(), table)
+                    == kWsvTables.end()) {
+              sql << "ROLLBACK";
+              return iroha::expected::makeError(fmt::format(
+                  "unknown table '{}' in WSV snapshot, line {}",
+                  table,
+                  line_number));
+            }
+            continue;
+          }
+          if (table == kWsvDigestSection) {
+            expected_root = line;
+            continue;
+          }
+          if (table.empty()) {
+            sql << "ROLLBACK";
+            return iroha::expected::makeError(fmt::format(
+                "row outside of a table section, line {}", line_number));
+          }
+          rows += line;
+          rows += '\n';
+        }
+        if (auto e = expected::resultToOptionalError(flush_section())) {
+          sql << "ROLLBACK";
+          return iroha::expected::makeError(std::move(e).value());
+        }
+        if (not expected_root.empty()) {
+          // integrity check against the digest taken at dump time; a
+          // truncated or altered snapshot is rejected without replay
+          auto digest = WsvStateDigest::fromWsv(sql);
+          if (auto e = expected::resultToOptionalError(digest)) {
+            sql << "ROLLBACK";
+            return iroha::expected::makeError(std::move(e).value());
+          }
+          auto restored_root =
+              std::move(digest).assumeValue().root().to_hexstring();
+          if (restored_root != expected_root) {
+            sql << "ROLLBACK";
+            return iroha::expected::makeError(
+                fmt::format("WSV snapshot digest mismatch: snapshot has {}, "
+                            "restored state has {}",
+                            expected_root,
+                            restored_root));
+          }
+          log->info("WSV snapshot digest verified: {}", restored_root);
+        }
+        sql << "COMMIT";
+      } catch (const std::exception &e) {
+        sql << "ROLLBACK";
+        return iroha::expected::makeError(
+            fmt::format("failed to restore WSV snapshot: {}", e.what()));
+      }
+      log->info("restored WSV snapshot of {} lines", line_number);
+      return {};
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
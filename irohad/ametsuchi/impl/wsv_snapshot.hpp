@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_HPP
+#define IROHA_WSV_SNAPSHOT_HPP
+
+#include <iosfwd>
+#include <string>
+
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace soci {
+  class session;
+}
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Consistent text dump of the world state view tables at the current
+     * height. The format is one section per table:
+     *
+     *   *<table name>
+     *   <tab-separated row with backslash escapes, NULL encoded as \N>
+     *   ...
+     *
+     * The dump includes top_block_info, so a restored WSV carries the height
+     * it was taken at and WsvRestorerImpl::restoreWsv replays only the
+     * blocks above it instead of the whole chain. A trailing wsv_digest
+     * pseudo-section carries the WSV state digest taken at dump time; on
+     * restore the loaded state is verified against it without replay.
+     */
+
+    /**
+     * Dump all WSV tables into the given stream. Must be called with no
+     * concurrent writers to get a consistent snapshot (runs in one
+     * transaction with repeatable read isolation).
+     * @param sql - session to read from
+     * @param dest - destination stream
+     * @param log - logger
+     * @return error description on failure
+     */
+    iroha::expected::Result<void, std::string> saveWsvSnapshot(
+        soci::session &sql, std::ostream &dest, logger::LoggerPtr log);
+
+    /**
+     * Load a snapshot produced by saveWsvSnapshot into an empty WSV.
+     * @param sql - session to write to
+     * @param src - source stream
+     * @param log - logger
+     * @return error description on failure
+     */
+    iroha::expected::Result<void, std::string> restoreWsvSnapshot(
+        soci::session &sql, std::istream &src, logger::LoggerPtr log);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_HPP
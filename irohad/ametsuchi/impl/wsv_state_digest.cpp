@@ -0,0 +1,339 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_state_digest.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include <fmt/core.h>
+#include <soci/soci.h>
+#include "ametsuchi/impl/tx_rw_set.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace {
+  using iroha::hash256_t;
+
+  const hash256_t kEmptySubtree{};
+
+  /// bit of the key hash at the given depth, highest bit first
+  bool bitAt(const hash256_t &bytes, size_t depth) {
+    return (bytes[depth / 8] >> (7 - depth % 8)) & 1;
+  }
+
+  /// domain-separated digest of a leaf
+  hash256_t leafDigest(const hash256_t &key_hash,
+                       const hash256_t &value_hash) {
+    std::string preimage{'\x00'};
+    preimage += key_hash.to_string();
+    preimage += value_hash.to_string();
+    return iroha::sha3_256(preimage);
+  }
+
+  /// domain-separated digest of an inner node
+  hash256_t nodeDigest(const hash256_t &left, const hash256_t &right) {
+    std::string preimage{'\x01'};
+    preimage += left.to_string();
+    preimage += right.to_string();
+    return iroha::sha3_256(preimage);
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Trie node: a leaf carries the full key hash, so the leaves sit at
+     * the first depth where their key hashes diverge instead of at the
+     * full key hash length.
+     */
+    struct WsvStateDigest::Node {
+      std::unique_ptr<Node> children[2];
+      hash256_t key_hash;
+      hash256_t value_hash;
+      hash256_t hash;
+      bool leaf{false};
+
+      const hash256_t &childHash(bool bit) const {
+        return children[bit] ? children[bit]->hash : kEmptySubtree;
+      }
+
+      void rehash() {
+        hash = leaf ? leafDigest(key_hash, value_hash)
+                    : nodeDigest(childHash(0), childHash(1));
+      }
+
+      static std::unique_ptr<Node> makeLeaf(const hash256_t &key_hash,
+                                            const hash256_t &value_hash) {
+        auto leaf = std::make_unique<Node>();
+        leaf->leaf = true;
+        leaf->key_hash = key_hash;
+        leaf->value_hash = value_hash;
+        leaf->rehash();
+        return leaf;
+      }
+
+      static std::unique_ptr<Node> insert(std::unique_ptr<Node> node,
+                                          const hash256_t &key_hash,
+                                          const hash256_t &value_hash,
+                                          size_t depth) {
+        if (not node) {
+          return makeLeaf(key_hash, value_hash);
+        }
+        if (node->leaf) {
+          if (node->key_hash == key_hash) {
+            node->value_hash = value_hash;
+            node->rehash();
+            return node;
+          }
+          // split: push the existing leaf down to the first depth where
+          // the key hashes diverge
+          auto branch = std::make_unique<Node>();
+          bool existing_bit = bitAt(node->key_hash, depth);
+          if (existing_bit == bitAt(key_hash, depth)) {
+            branch->children[existing_bit] =
+                insert(std::move(node), key_hash, value_hash, depth + 1);
+          } else {
+            branch->children[existing_bit] = std::move(node);
+            branch->children[not existing_bit] =
+                makeLeaf(key_hash, value_hash);
+          }
+          branch->rehash();
+          return branch;
+        }
+        bool bit = bitAt(key_hash, depth);
+        node->children[bit] = insert(
+            std::move(node->children[bit]), key_hash, value_hash, depth + 1);
+        node->rehash();
+        return node;
+      }
+
+      static std::unique_ptr<Node> remove(std::unique_ptr<Node> node,
+                                          const hash256_t &key_hash,
+                                          size_t depth) {
+        if (not node) {
+          return nullptr;
+        }
+        if (node->leaf) {
+          return node->key_hash == key_hash ? nullptr : std::move(node);
+        }
+        bool bit = bitAt(key_hash, depth);
+        node->children[bit] =
+            remove(std::move(node->children[bit]), key_hash, depth + 1);
+        // collapse a branch left with a single leaf child, so the trie
+        // stays canonical for the remaining key set
+        for (bool side : {false, true}) {
+          if (not node->children[side] and node->children[not side]
+              and node->children[not side]->leaf) {
+            return std::move(node->children[not side]);
+          }
+        }
+        if (not node->children[0] and not node->children[1]) {
+          return nullptr;
+        }
+        node->rehash();
+        return node;
+      }
+    };
+
+    WsvStateDigest::WsvStateDigest() = default;
+    WsvStateDigest::WsvStateDigest(WsvStateDigest &&) noexcept = default;
+    WsvStateDigest &WsvStateDigest::operator=(WsvStateDigest &&) noexcept =
+        default;
+    WsvStateDigest::~WsvStateDigest() = default;
+
+    void WsvStateDigest::update(const std::string &key,
+                                const std::string &value) {
+      auto value_hash = sha3_256(value);
+      leaves_[key] = value_hash;
+      root_ = Node::insert(std::move(root_), sha3_256(key), value_hash, 0);
+    }
+
+    void WsvStateDigest::remove(const std::string &key) {
+      if (leaves_.erase(key) != 0) {
+        root_ = Node::remove(std::move(root_), sha3_256(key), 0);
+      }
+    }
+
+    void WsvStateDigest::removePrefix(const std::string &prefix) {
+      for (auto it = leaves_.lower_bound(prefix);
+           it != leaves_.end() and it->first.compare(0, prefix.size(), prefix)
+               == 0;) {
+        root_ = Node::remove(std::move(root_), sha3_256(it->first), 0);
+        it = leaves_.erase(it);
+      }
+    }
+
+    size_t WsvStateDigest::size() const {
+      return leaves_.size();
+    }
+
+    hash256_t WsvStateDigest::root() const {
+      return root_ ? root_->hash : kEmptySubtree;
+    }
+
+    std::optional<WsvStateDigest::Proof> WsvStateDigest::proof(
+        const std::string &key) const {
+      auto key_hash = sha3_256(key);
+      Proof siblings;
+      const Node *node = root_.get();
+      for (size_t depth = 0; node and not node->leaf; ++depth) {
+        bool bit = bitAt(key_hash, depth);
+        siblings.push_back(node->childHash(not bit));
+        node = node->children[bit].get();
+      }
+      if (not node or node->key_hash != key_hash) {
+        return std::nullopt;
+      }
+      return siblings;
+    }
+
+    bool WsvStateDigest::verifyProof(const hash256_t &root,
+                                     const std::string &key,
+                                     const std::string &value,
+                                     const Proof &proof) {
+      auto key_hash = sha3_256(key);
+      auto hash = leafDigest(key_hash, sha3_256(value));
+      for (size_t depth = proof.size(); depth-- > 0;) {
+        hash = bitAt(key_hash, depth) ? nodeDigest(proof[depth], hash)
+                                      : nodeDigest(hash, proof[depth]);
+      }
+      return hash == root;
+    }
+
+    namespace {
+      /// render a nullable text column, NULL as \N like the WSV snapshot
+      std::string textColumn(const soci::row &row, size_t index) {
+        return row.get_indicator(index) == soci::i_null
+            ? "\\N"
+            : row.get<std::string>(index);
+      }
+
+      /**
+       * Digest the rows of one WSV domain; the extra condition narrows
+       * the scan down to one account on the incremental path.
+       */
+      void digestRows(WsvStateDigest &digest,
+                      soci::session &sql,
+                      const std::string &query,
+                      const std::optional<std::string> &account_id,
+                      const std::function<void(WsvStateDigest &,
+                                               const soci::row &)> &consume) {
+        if (account_id) {
+          soci::rowset<soci::row> rows =
+              (sql.prepare << query + " WHERE account_id = :account_id",
+               soci::use(*account_id, "account_id"));
+          for (const auto &row : rows) {
+            consume(digest, row);
+          }
+        } else {
+          soci::rowset<soci::row> rows = (sql.prepare << query);
+          for (const auto &row : rows) {
+            consume(digest, row);
+          }
+        }
+      }
+
+      void digestAccountState(WsvStateDigest &digest,
+                              soci::session &sql,
+                              const std::optional<std::string> &account_id) {
+        digestRows(
+            digest,
+            sql,
+            "SELECT account_id, domain_id, quorum::text, data::text "
+            "FROM account",
+            account_id,
+            [](WsvStateDigest &digest, const soci::row &row) {
+              digest.update(fmt::format("account:{}",
+                                        row.get<std::string>(0)),
+                            fmt::format("{}\t{}\t{}",
+                                        textColumn(row, 1),
+                                        textColumn(row, 2),
+                                        textColumn(row, 3)));
+            });
+        digestRows(digest,
+                   sql,
+                   "SELECT account_id, asset_id, amount::text "
+                   "FROM account_has_asset",
+                   account_id,
+                   [](WsvStateDigest &digest, const soci::row &row) {
+                     digest.update(fmt::format("balance:{}:{}",
+                                               row.get<std::string>(0),
+                                               row.get<std::string>(1)),
+                                   textColumn(row, 2));
+                   });
+        digestRows(digest,
+                   sql,
+                   "SELECT account_id, public_key "
+                   "FROM account_has_signatory",
+                   account_id,
+                   [](WsvStateDigest &digest, const soci::row &row) {
+                     digest.update(fmt::format("signatory:{}:{}",
+                                               row.get<std::string>(0),
+                                               row.get<std::string>(1)),
+                                   std::string{});
+                   });
+      }
+    }  // namespace
+
+    iroha::expected::Result<WsvStateDigest, std::string>
+    WsvStateDigest::fromWsv(soci::session &sql) {
+      WsvStateDigest digest;
+      try {
+        digestAccountState(digest, sql, std::nullopt);
+      } catch (const std::exception &e) {
+        return iroha::expected::makeError(
+            fmt::format("failed to digest WSV state: {}", e.what()));
+      }
+      return iroha::expected::makeValue(std::move(digest));
+    }
+
+    iroha::expected::Result<void, std::string> WsvStateDigest::refreshAccounts(
+        soci::session &sql, const std::vector<std::string> &account_ids) {
+      try {
+        for (const auto &account_id : account_ids) {
+          // the ':' separators below keep one account id from matching
+          // the entries of another it is a prefix of
+          remove(fmt::format("account:{}", account_id));
+          removePrefix(fmt::format("balance:{}:", account_id));
+          removePrefix(fmt::format("signatory:{}:", account_id));
+          digestAccountState(*this, sql, account_id);
+        }
+      } catch (const std::exception &e) {
+        return iroha::expected::makeError(fmt::format(
+            "failed to refresh WSV state digest: {}", e.what()));
+      }
+      return {};
+    }
+
+    iroha::expected::Result<void, std::string> WsvStateDigest::applyBlock(
+        soci::session &sql, const shared_model::interface::Block &block) {
+      std::vector<std::string> touched;
+      for (const auto &tx : block.transactions()) {
+        auto rw_set = extractRwSet(tx);
+        if (rw_set.global) {
+          // a command touching global state may have changed entries
+          // outside any account's read/write set - rebuild from scratch
+          auto rebuilt = fromWsv(sql);
+          if (auto e = expected::resultToOptionalError(rebuilt)) {
+            return iroha::expected::makeError(std::move(e).value());
+          }
+          *this = std::move(rebuilt).assumeValue();
+          return {};
+        }
+        for (const auto &account : rw_set.accounts) {
+          touched.push_back(account.str());
+        }
+      }
+      std::sort(touched.begin(), touched.end());
+      touched.erase(std::unique(touched.begin(), touched.end()),
+                    touched.end());
+      return refreshAccounts(sql, touched);
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_STATE_DIGEST_HPP
+#define IROHA_WSV_STATE_DIGEST_HPP
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/result.hpp"
+#include "crypto/hash_types.hpp"
+
+namespace soci {
+  class session;
+}
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Merkleized digest over the WSV domains which define account state:
+     * accounts (domain, quorum, data), asset balances and signatories.
+     * Every entry is a leaf of a binary Merkle trie addressed by the
+     * sha3-256 of its key, so an update touches a logarithmic number of
+     * nodes, any entry has a log-sized membership proof against the
+     * root, and two peers compare their whole WSV by comparing one hash.
+     * The root is a pure function of the entry set - it does not depend
+     * on the order the entries were inserted or updated in.
+     */
+    class WsvStateDigest {
+     public:
+      /// sibling digests on the path from the root towards a leaf
+      using Proof = std::vector<hash256_t>;
+
+      WsvStateDigest();
+      WsvStateDigest(WsvStateDigest &&) noexcept;
+      WsvStateDigest &operator=(WsvStateDigest &&) noexcept;
+      ~WsvStateDigest();
+
+      /// set or replace the value of an entry
+      void update(const std::string &key, const std::string &value);
+
+      /// drop an entry; unknown keys are ignored
+      void remove(const std::string &key);
+
+      /// drop every entry whose key starts with the given prefix
+      void removePrefix(const std::string &prefix);
+
+      /// number of entries
+      size_t size() const;
+
+      /// digest of the whole state; the zero hash for the empty state
+      hash256_t root() const;
+
+      /// membership proof of an entry against root(); nullopt for
+      /// unknown keys
+      std::optional<Proof> proof(const std::string &key) const;
+
+      /// check a membership proof produced by proof()
+      static bool verifyProof(const hash256_t &root,
+                              const std::string &key,
+                              const std::string &value,
+                              const Proof &proof);
+
+      /**
+       * Build the digest of the whole WSV read through the given
+       * session. Must run with no concurrent writers (or inside a
+       * repeatable read transaction) to digest a consistent state.
+       */
+      static iroha::expected::Result<WsvStateDigest, std::string> fromWsv(
+          soci::session &sql);
+
+      /**
+       * Re-read the entries of the given accounts and replace their
+       * leaves; the incremental counterpart of fromWsv.
+       */
+      iroha::expected::Result<void, std::string> refreshAccounts(
+          soci::session &sql, const std::vector<std::string> &account_ids);
+
+      /**
+       * Advance the digest over a committed block: the accounts touched
+       * by the block's transactions (their read/write sets) are
+       * re-read, and a transaction touching global state falls back to
+       * a full rebuild.
+       */
+      iroha::expected::Result<void, std::string> applyBlock(
+          soci::session &sql, const shared_model::interface::Block &block);
+
+     private:
+      struct Node;
+
+      /// entry values by key, hashed; the source for prefix removal
+      std::map<std::string, hash256_t> leaves_;
+      std::unique_ptr<Node> root_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_STATE_DIGEST_HPP
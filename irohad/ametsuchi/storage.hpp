@@ -6,6 +6,7 @@
 #ifndef IROHA_AMETSUCHI_H
 #define IROHA_AMETSUCHI_H
 
+#include <chrono>
 #include <vector>
 
 #include <rxcpp/rx-observable-fwd.hpp>
@@ -88,6 +89,18 @@ namespace iroha {
           std::shared_ptr<const shared_model::interface::Block>>
       on_commit() = 0;
 
+      /**
+       * Wait until the on_commit subscribers have seen every block
+       * committed so far. The notifications are delivered off the
+       * committing thread, so a caller which genuinely depends on the
+       * subscriber side effects has to await them explicitly.
+       * @param timeout - longest time to wait
+       * @return true if the deliveries completed, false on timeout
+       */
+      virtual bool flushCommitNotifications(std::chrono::milliseconds timeout) {
+        return true;
+      }
+
       /**
        * Removes all peers from WSV
        */
@@ -7,6 +7,7 @@
 #define IROHA_TEMPORARYWSV_HPP
 
 #include <functional>
+#include <vector>
 
 #include "common/result.hpp"
 #include "validation/stateful_validator_common.hpp"
@@ -47,6 +48,39 @@ namespace iroha {
       virtual expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) = 0;
 
+      /**
+       * Load the signature-validation state of the transactions' creator
+       * accounts ahead of time, in one batch. An optimization hint called
+       * once per proposal: later per-transaction signature checks find the
+       * accounts already in memory. Failures are not reported - they
+       * resurface in the validation itself.
+       * @param transactions whose creators to prefetch
+       */
+      virtual void prefetchSignatories(
+          const std::vector<std::reference_wrapper<
+              const shared_model::interface::Transaction>> &transactions) {}
+
+      /**
+       * Validates the signatures of the given transactions against the
+       * current state in one batch
+       * @param transactions to be checked
+       * @return per-transaction results, in the order of the argument
+       */
+      virtual std::vector<expected::Result<void, validation::CommandError>>
+      validateSignatures(
+          const std::vector<std::reference_wrapper<
+              const shared_model::interface::Transaction>> &transactions) = 0;
+
+      /**
+       * Applies a transaction whose signatures have been checked with
+       * validateSignatures beforehand
+       * @param transaction Transaction to be applied
+       * @return True if transaction was successfully applied, false otherwise
+       */
+      virtual expected::Result<void, validation::CommandError>
+      applyPrevalidated(
+          const shared_model::interface::Transaction &transaction) = 0;
+
       /**
        * Create a savepoint for wsv state
        * @param name of savepoint to be created
@@ -24,10 +24,18 @@ namespace iroha {
       size_t command_index;
     };
 
+    class CommandStatsCollector;
+
     class TransactionExecutor {
      public:
+      /**
+       * @param command_executor - executes the individual commands
+       * @param stats_collector - when given, accounts the execution time of
+       * every command per command type
+       */
       explicit TransactionExecutor(
-          std::shared_ptr<CommandExecutor> command_executor);
+          std::shared_ptr<CommandExecutor> command_executor,
+          std::shared_ptr<CommandStatsCollector> stats_collector = nullptr);
 
       iroha::expected::Result<void, TxExecutionError> execute(
           const shared_model::interface::Transaction &transaction,
@@ -35,6 +43,7 @@ namespace iroha {
 
      private:
       std::shared_ptr<CommandExecutor> command_executor_;
+      std::shared_ptr<CommandStatsCollector> stats_collector_;
     };
 
   }  // namespace ametsuchi
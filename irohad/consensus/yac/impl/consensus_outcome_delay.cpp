@@ -15,24 +15,76 @@ ConsensusOutcomeDelay::ConsensusOutcomeDelay(
     : max_rounds_delay_(max_rounds_delay),
       delay_increment_(
           std::min(max_rounds_delay_, std::chrono::milliseconds(1000))),
-      reject_delay_(0),
+      stretch_initial_delay_(
+          std::min(max_rounds_delay_, std::chrono::milliseconds(125))),
       max_local_counter_(2),
-      local_counter_(0) {}
+      state_(std::make_shared<State>()) {
+  state_->wait_duration = metrics::MetricsRegistry::instance().makeHistogram(
+      "iroha_consensus_outcome_wait_seconds",
+      "Time an agreed outcome waited for the previous one to be processed",
+      metrics::Histogram::defaultDurationBounds());
+}
 
 std::chrono::milliseconds ConsensusOutcomeDelay::operator()(
     ConsensusOutcomeType type) {
-  if (type == ConsensusOutcomeType::kReject
-      or type == ConsensusOutcomeType::kNothing) {
-    // Increment reject_counter each local_counter calls of function
-    ++local_counter_;
-    if (local_counter_ == max_local_counter_) {
-      local_counter_ = 0;
-      if (reject_delay_ < max_rounds_delay_) {
-        reject_delay_ += delay_increment_;
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  if (type == ConsensusOutcomeType::kReject) {
+    // Increment reject_delay each max_local_counter_ calls of function
+    state_->empty_rounds = 0;
+    ++state_->reject_counter;
+    if (state_->reject_counter == max_local_counter_) {
+      state_->reject_counter = 0;
+      if (state_->reject_delay < max_rounds_delay_) {
+        state_->reject_delay += delay_increment_;
       }
     }
-  } else {
-    reject_delay_ = std::chrono::milliseconds(0);
+    return state_->reject_delay;
+  }
+  if (type == ConsensusOutcomeType::kNothing) {
+    // the first rounds of a quiet period are free so a single late batch
+    // is not penalized, then the cadence doubles up to the maximum
+    ++state_->empty_rounds;
+    if (state_->empty_rounds <= kEmptyRoundsBeforeStretch) {
+      return std::chrono::milliseconds(0);
+    }
+    auto const exponent = std::min<uint64_t>(
+        state_->empty_rounds - kEmptyRoundsBeforeStretch - 1, 16);
+    return std::min(max_rounds_delay_,
+                    stretch_initial_delay_ * (int64_t(1) << exponent));
+  }
+  state_->reject_delay = std::chrono::milliseconds(0);
+  state_->reject_counter = 0;
+  state_->empty_rounds = 0;
+  return std::chrono::milliseconds(0);
+}
+
+void ConsensusOutcomeDelay::onBatchesArrived() {
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  state_->empty_rounds = 0;
+}
+
+void ConsensusOutcomeDelay::awaitConsumerReady() {
+  std::unique_lock<std::mutex> lock(state_->mutex);
+  if (not state_->handshake_active) {
+    return;
+  }
+  auto const start = std::chrono::steady_clock::now();
+  if (not state_->consumer_ready) {
+    // a lost signal (e.g. a consumer dropped mid-processing) degrades
+    // into a bounded wait instead of blocking consensus forever
+    state_->ready_cv.wait_for(lock, kMaxReadinessWait, [this] {
+      return state_->consumer_ready;
+    });
+  }
+  state_->consumer_ready = false;
+  state_->wait_duration->observeSince(start);
+}
+
+void ConsensusOutcomeDelay::onOutcomeProcessed() {
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->handshake_active = true;
+    state_->consumer_ready = true;
   }
-  return reject_delay_;
+  state_->ready_cv.notify_all();
 }
@@ -7,24 +7,98 @@
 #define IROHA_CONSENSUS_OUTCOME_DELAY_HPP
 
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 
 #include "consensus/yac/consensus_outcome_type.hpp"
+#include "metrics/metrics_registry.hpp"
 
 namespace iroha::consensus::yac {
 
+  /**
+   * Computes the delivery delay of a round outcome, which sets the cadence
+   * of the following round.
+   *
+   * Reject rounds keep the original linear backoff. Empty rounds are free
+   * for the first few occurrences, then the cadence is stretched
+   * exponentially up to the configured maximum, so a quiet network does
+   * not burn CPU and votes on rounds which order nothing. The delay is a
+   * pure function of the agreed outcome sequence, hence all honest peers
+   * stretch and reset in lockstep without extra negotiation.
+   *
+   * Besides the cadence, the class carries the readiness handshake of
+   * outcome delivery: an outcome is handed to the pipeline only after the
+   * previous one has been fully processed, \see awaitConsumerReady and
+   * onOutcomeProcessed. The handshake replaces the configured sleeps that
+   * used to paper over delivery racing ahead of the synchronizer.
+   *
+   * Copies share their state: the consensus pipeline queries one copy
+   * while the ordering service reports batch arrivals through another,
+   * \see onBatchesArrived. All methods are thread-safe.
+   */
   class ConsensusOutcomeDelay {
    public:
     ConsensusOutcomeDelay(std::chrono::milliseconds max_rounds_delay);
 
     std::chrono::milliseconds operator()(ConsensusOutcomeType type);
 
+    /**
+     * Snap the stretched empty-round cadence back so the batches are
+     * ordered at the immediate round rate again. Called when new batches
+     * reach the ordering service. A round outcome already sleeping keeps
+     * its delay, which bounds the extra latency by the configured
+     * maximum.
+     */
+    void onBatchesArrived();
+
+    /**
+     * Block until the consumer of the previous outcome has declared
+     * readiness through onOutcomeProcessed, then take the readiness
+     * token for the outcome about to be delivered. The actually waited
+     * time is recorded in a histogram; a lost readiness signal degrades
+     * into a bounded wait instead of wedging consensus. Until the first
+     * onOutcomeProcessed report the handshake is inactive and outcomes
+     * pass through immediately.
+     */
+    void awaitConsumerReady();
+
+    /**
+     * Declare the previously delivered outcome fully processed,
+     * releasing the next one. Called on every synchronization event.
+     */
+    void onOutcomeProcessed();
+
    private:
+    /// empty rounds before the cadence starts to stretch
+    static constexpr uint64_t kEmptyRoundsBeforeStretch = 4;
+
+    /// upper bound of awaitConsumerReady in case the readiness signal
+    /// is lost
+    static constexpr std::chrono::milliseconds kMaxReadinessWait{1000};
+
+    struct State {
+      std::mutex mutex;
+      std::chrono::milliseconds reject_delay{0};
+      uint64_t reject_counter{0};
+      uint64_t empty_rounds{0};
+      /// set by the first onOutcomeProcessed call; without a consumer
+      /// reporting readiness the outcomes pass through ungated
+      bool handshake_active{false};
+      /// the previous outcome has been processed, the next may go
+      bool consumer_ready{true};
+      std::condition_variable ready_cv;
+      /// time outcomes actually spent waiting for consumer readiness
+      std::shared_ptr<metrics::Histogram> wait_duration;
+    };
+
     std::chrono::milliseconds const max_rounds_delay_;
     std::chrono::milliseconds const delay_increment_;
-    std::chrono::milliseconds reject_delay_;
+    /// first stretched empty round delay, doubled each following round
+    std::chrono::milliseconds const stretch_initial_delay_;
     uint64_t const max_local_counter_;
-    uint64_t local_counter_;
+    std::shared_ptr<State> state_;
   };
 
 }  // namespace iroha::consensus::yac
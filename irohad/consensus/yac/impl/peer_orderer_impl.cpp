@@ -24,10 +24,16 @@ namespace iroha {
           const YacHash &hash,
           std::vector<std::shared_ptr<shared_model::interface::Peer>> const
               &peers) {
-        auto prng = iroha::makeSeededPrng(hash.vote_hashes.block_hash.data(),
-                                          hash.vote_hashes.block_hash.size());
-        iroha::generatePermutation(
-            peer_positions_, std::move(prng), peers.size());
+        // the permutation depends only on the seed and the number of peers,
+        // so repeated requests within a round reuse the cached positions
+        const auto &seed = hash.vote_hashes.block_hash;
+        if (peer_positions_.size() != peers.size()
+            or cached_seed_ != seed) {
+          auto prng = iroha::makeSeededPrng(seed.data(), seed.size());
+          iroha::generatePermutation(
+              peer_positions_, std::move(prng), peers.size());
+          cached_seed_ = seed;
+        }
 
         return ClusterOrdering::create(peers, peer_positions_);
       }
@@ -7,6 +7,7 @@
 #define IROHA_PEER_ORDERER_IMPL_HPP
 
 #include <memory>
+#include <string>
 
 #include "ametsuchi/peer_query_factory.hpp"
 #include "consensus/yac/yac_peer_orderer.hpp"
@@ -32,6 +33,8 @@ namespace iroha {
 
        private:
         std::vector<size_t> peer_positions_;
+        /// seed which peer_positions_ was generated from
+        std::string cached_seed_;
         std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
       };
 
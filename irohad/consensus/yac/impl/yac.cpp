@@ -12,6 +12,7 @@
 #include "common/bind.hpp"
 #include "common/visitor.hpp"
 #include "consensus/yac/cluster_order.hpp"
+#include "consensus/yac/storage/round_journal.hpp"
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
 #include "consensus/yac/timer.hpp"
 #include "consensus/yac/yac_crypto_provider.hpp"
@@ -36,7 +37,8 @@ namespace iroha {
           ClusterOrdering order,
           Round round,
           rxcpp::observe_on_one_worker worker,
-          logger::LoggerPtr log) {
+          logger::LoggerPtr log,
+          std::shared_ptr<RoundJournal> journal) {
         return std::make_shared<Yac>(vote_storage,
                                      network,
                                      crypto,
@@ -44,7 +46,8 @@ namespace iroha {
                                      order,
                                      round,
                                      worker,
-                                     std::move(log));
+                                     std::move(log),
+                                     std::move(journal));
       }
 
       Yac::Yac(YacVoteStorage vote_storage,
@@ -54,7 +57,8 @@ namespace iroha {
                ClusterOrdering order,
                Round round,
                rxcpp::observe_on_one_worker worker,
-               logger::LoggerPtr log)
+               logger::LoggerPtr log,
+               std::shared_ptr<RoundJournal> journal)
           : log_(std::move(log)),
             cluster_order_(order),
             round_(round),
@@ -63,7 +67,8 @@ namespace iroha {
             vote_storage_(std::move(vote_storage)),
             network_(std::move(network)),
             crypto_(std::move(crypto)),
-            timer_(std::move(timer)) {}
+            timer_(std::move(timer)),
+            journal_(std::move(journal)) {}
 
       Yac::~Yac() {
         notifier_lifetime_.unsubscribe();
@@ -90,6 +95,9 @@ namespace iroha {
         alternative_order_ = std::move(alternative_order);
         round_ = hash.vote_round;
         lock.unlock();
+        if (journal_) {
+          journal_->recordVote(hash.vote_round);
+        }
         auto vote = crypto_->getVote(hash);
         // TODO 10.06.2018 andrei: IR-1407 move YAC propagation strategy to a
         // separate entity
@@ -140,7 +148,14 @@ namespace iroha {
           return;
         }
 
-        if (crypto_->verify(state)) {
+        // signature verification reads no consensus state, so the crypto
+        // work - possibly fanned out over several cores - runs with the
+        // lock released
+        guard.unlock();
+        auto verified = crypto_->verify(state);
+        guard.lock();
+
+        if (verified) {
           auto &proposal_round = getRound(state);
 
           if (proposal_round.block_round > round_.block_round) {
@@ -299,6 +314,9 @@ namespace iroha {
                   vote_storage_.nextProcessingState(proposal_round);
                   log_->info("Pass outcome for {} to pipeline", proposal_round);
                   lock.unlock();
+                  if (journal_) {
+                    journal_->recordCertificate(visit_in_place(answer, votes));
+                  }
                   if (proposal_round >= current_round) {
                     this->closeRound();
                   }
@@ -5,6 +5,10 @@
 
 #include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
 #include "backend/plain/signature.hpp"
 #include "common/result.hpp"
 #include "consensus/yac/transport/yac_pb_converters.hpp"
@@ -20,25 +24,88 @@ namespace iroha {
           const shared_model::crypto::Keypair &keypair, logger::LoggerPtr log)
           : keypair_(keypair), log_(std::move(log)) {}
 
+      namespace {
+        /// bundles smaller than this are verified on the calling thread
+        constexpr size_t kParallelVerificationChunkSize = 16;
+      }  // namespace
+
       bool CryptoProviderImpl::verify(const std::vector<VoteMessage> &msg) {
-        return std::all_of(
-            std::begin(msg), std::end(msg), [this](const auto &vote) {
-              auto serialized =
-                  PbConverters::serializeVote(vote).hash().SerializeAsString();
-              auto blob = shared_model::crypto::Blob(serialized);
+        auto verify_one = [this](const auto &vote) {
+          auto serialized =
+              PbConverters::serializeVote(vote).hash().SerializeAsString();
+
+          // the field lengths are encoded into the key, so two distinct
+          // votes can never concatenate to the same key; collision
+          // safety of the cached verdict itself rests on the sharded
+          // cache comparing the full key on lookup
+          const uint32_t serialized_size =
+              static_cast<uint32_t>(serialized.size());
+          const uint32_t public_key_size =
+              static_cast<uint32_t>(vote.signature->publicKey().size());
+          std::string cache_key;
+          cache_key.reserve(2 * sizeof(uint32_t) + serialized.size()
+                            + vote.signature->publicKey().size()
+                            + vote.signature->signedData().size());
+          cache_key.append(reinterpret_cast<const char *>(&serialized_size),
+                           sizeof(serialized_size));
+          cache_key.append(serialized);
+          cache_key.append(reinterpret_cast<const char *>(&public_key_size),
+                           sizeof(public_key_size));
+          cache_key.append(vote.signature->publicKey());
+          cache_key.append(vote.signature->signedData());
+          if (verified_votes_cache_.findItem(cache_key)) {
+            // the same vote has already been verified, e.g. it was
+            // redelivered during state propagation
+            return true;
+          }
+
+          auto blob = shared_model::crypto::Blob(serialized);
+
+          using namespace shared_model::interface::types;
+          return shared_model::crypto::CryptoVerifier::verify(
+                     SignedHexStringView{vote.signature->signedData()},
+                     blob,
+                     PublicKeyHexStringView{vote.signature->publicKey()})
+              .match(
+                  [&, this](const auto &) {
+                    verified_votes_cache_.addItem(cache_key, true);
+                    return true;
+                  },
+                  [this](const auto &error) {
+                    log_->debug("Vote signature verification failed: {}",
+                                error.error);
+                    return false;
+                  });
+        };
+
+        const size_t size = msg.size();
+        const size_t hardware_tasks =
+            std::max<size_t>(1, std::thread::hardware_concurrency());
+        const size_t tasks =
+            std::min(hardware_tasks, size / kParallelVerificationChunkSize);
+        if (tasks <= 1) {
+          return std::all_of(std::begin(msg), std::end(msg), verify_one);
+        }
 
-              using namespace shared_model::interface::types;
-              return shared_model::crypto::CryptoVerifier::verify(
-                         SignedHexStringView{vote.signature->signedData()},
-                         blob,
-                         PublicKeyHexStringView{vote.signature->publicKey()})
-                  .match([](const auto &) { return true; },
-                         [this](const auto &error) {
-                           log_->debug("Vote signature verification failed: {}",
-                                       error.error);
-                           return false;
-                         });
-            });
+        // fan the bundle's signatures out over a pool of workers; the
+        // verification cache is thread-safe
+        std::vector<std::future<bool>> chunks;
+        chunks.reserve(tasks);
+        for (size_t task = 0; task < tasks; ++task) {
+          const size_t begin = task * size / tasks;
+          const size_t end = (task + 1) * size / tasks;
+          chunks.push_back(
+              std::async(std::launch::async, [&msg, &verify_one, begin, end] {
+                return std::all_of(
+                    msg.begin() + begin, msg.begin() + end, verify_one);
+              }));
+        }
+        bool result = true;
+        for (auto &chunk : chunks) {
+          // all chunks are joined even after a failure
+          result = chunk.get() and result;
+        }
+        return result;
       }
 
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
@@ -8,6 +8,7 @@
 
 #include "consensus/yac/yac_crypto_provider.hpp"
 
+#include "cache/sharded_cache.hpp"
 #include "cryptography/keypair.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -26,6 +27,10 @@ namespace iroha {
 
        private:
         shared_model::crypto::Keypair keypair_;
+        /// payload + signature keys of votes which have already been verified
+        /// successfully, so that redelivered votes skip the full verification;
+        /// sharded since verification workers access it concurrently
+        cache::ShardedCache<std::string, bool> verified_votes_cache_;
         logger::LoggerPtr log_;
       };
     }  // namespace yac
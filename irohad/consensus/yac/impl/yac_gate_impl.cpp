@@ -18,6 +18,7 @@
 #include "interfaces/common_objects/signature.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
+#include "metrics/pipeline_snapshots.hpp"
 #include "simulator/block_creator.hpp"
 
 namespace {
@@ -45,17 +46,23 @@ namespace iroha {
           std::shared_ptr<consensus::ConsensusResultCache>
               consensus_result_cache,
           logger::LoggerPtr log,
-          std::function<std::chrono::milliseconds(ConsensusOutcomeType)>
-              delay_func)
+          ConsensusOutcomeDelay delay_func)
           : log_(std::move(log)),
             current_hash_(),
+            round_duration_(
+                iroha::metrics::MetricsRegistry::instance().makeHistogram(
+                    "iroha_yac_round_duration_seconds",
+                    "Time from casting a vote to the round outcome",
+                    iroha::metrics::Histogram::defaultDurationBounds())),
             alternative_order_(std::move(alternative_order)),
             current_ledger_state_(std::move(ledger_state)),
             published_events_([&] {
               rxcpp::observable<Answer> outcomes = hash_gate->onOutcome();
+              auto delay_state = std::make_shared<ConsensusOutcomeDelay>(
+                  std::move(delay_func));
               rxcpp::observable<Answer> delayed_outcomes = outcomes.concat_map(
-                  [delay_func = std::move(delay_func)](auto message) {
-                    auto delay = delay_func(visit_in_place(
+                  [delay_state](auto message) {
+                    auto delay = (*delay_state)(visit_in_place(
                         message,
                         [](const CommitMessage &msg) {
                           auto const hash = getHash(msg.votes).value();
@@ -70,6 +77,11 @@ namespace iroha {
                         [](const FutureMessage &msg) {
                           return ConsensusOutcomeType::kFuture;
                         }));
+                    // delivery is gated on the pipeline having finished
+                    // with the previous outcome, so the configured delay
+                    // only sets round cadence and can be zero without
+                    // racing the synchronizer
+                    delay_state->awaitConsumerReady();
                     rxcpp::observable<Answer> just_message =
                         rxcpp::observable<>::just(std::move(message));
                     rxcpp::observable<Answer> delayed_message =
@@ -118,6 +130,10 @@ namespace iroha {
 
         current_ledger_state_ = event.ledger_state;
         current_hash_ = hash_provider_->makeHash(event);
+        round_start_time_ = std::chrono::steady_clock::now();
+        iroha::metrics::PipelineSnapshots::instance().setConsensusRound(
+            current_hash_.vote_round.block_round,
+            current_hash_.vote_round.reject_round);
         assert(current_hash_.vote_round.block_round
                == current_ledger_state_->top_block_info.height + 1);
 
@@ -168,6 +184,17 @@ namespace iroha {
         }
       }
 
+      void YacGateImpl::recordRoundOutcome(const Round &round,
+                                           size_t votes) const {
+        auto &snapshots = iroha::metrics::PipelineSnapshots::instance();
+        snapshots.setConsensusVotes(static_cast<uint32_t>(votes));
+        snapshots.recordRound(
+            round.block_round,
+            round.reject_round,
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - round_start_time_));
+      }
+
       rxcpp::observable<YacGateImpl::GateObject> YacGateImpl::handleCommit(
           const CommitMessage &msg) {
         const auto hash = getHash(msg.votes).value();
@@ -182,6 +209,9 @@ namespace iroha {
         assert(hash.vote_round.block_round
                == current_hash_.vote_round.block_round);
 
+        round_duration_->observeSince(round_start_time_);
+        this->recordRoundOutcome(hash.vote_round, msg.votes.size());
+
         if (hash == current_hash_ and current_block_) {
           // if node has voted for the committed block
           // append signatures of other nodes
@@ -229,6 +259,9 @@ namespace iroha {
         assert(hash.vote_round.block_round
                == current_hash_.vote_round.block_round);
 
+        round_duration_->observeSince(round_start_time_);
+        this->recordRoundOutcome(hash.vote_round, msg.votes.size());
+
         auto has_same_proposals =
             std::all_of(std::next(msg.votes.begin()),
                         msg.votes.end(),
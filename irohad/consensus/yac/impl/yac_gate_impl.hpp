@@ -16,6 +16,7 @@
 #include "consensus/yac/impl/consensus_outcome_delay.hpp"
 #include "consensus/yac/yac_hash_provider.hpp"
 #include "logger/logger_fwd.hpp"
+#include "metrics/metrics_registry.hpp"
 
 namespace iroha {
 
@@ -45,9 +46,8 @@ namespace iroha {
             std::shared_ptr<consensus::ConsensusResultCache>
                 consensus_result_cache,
             logger::LoggerPtr log,
-            std::function<std::chrono::milliseconds(ConsensusOutcomeType)>
-                delay_func =
-                    ConsensusOutcomeDelay(std::chrono::milliseconds(0)));
+            ConsensusOutcomeDelay delay_func =
+                ConsensusOutcomeDelay(std::chrono::milliseconds(0)));
         void vote(const simulator::BlockCreatorEvent &event) override;
 
         rxcpp::observable<GateObject> onOutcome() override;
@@ -61,6 +61,14 @@ namespace iroha {
          */
         void copySignatures(const CommitMessage &commit);
 
+        /**
+         * Publish the finished round and its vote count to the diagnostics
+         * snapshots
+         * @param round - the round the outcome belongs to
+         * @param votes - number of votes the outcome was built from
+         */
+        void recordRoundOutcome(const Round &round, size_t votes) const;
+
         rxcpp::observable<GateObject> handleCommit(const CommitMessage &msg);
         rxcpp::observable<GateObject> handleReject(const RejectMessage &msg);
         rxcpp::observable<GateObject> handleFuture(const FutureMessage &msg);
@@ -70,6 +78,10 @@ namespace iroha {
         boost::optional<std::shared_ptr<shared_model::interface::Block>>
             current_block_;
         YacHash current_hash_;
+        /// when the vote for the current round was cast; the distance to
+        /// the round outcome is exposed to the scraper
+        std::chrono::steady_clock::time_point round_start_time_;
+        std::shared_ptr<iroha::metrics::Histogram> round_duration_;
         boost::optional<ClusterOrdering> alternative_order_;
         std::shared_ptr<const LedgerState> current_ledger_state_;
 
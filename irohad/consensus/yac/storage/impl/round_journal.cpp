@@ -0,0 +1,208 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/storage/round_journal.hpp"
+
+#include <cstring>
+
+#include "backend/plain/signature.hpp"
+#include "interfaces/common_objects/signature.hpp"
+#include "interfaces/common_objects/string_view_types.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  constexpr char kVoteRecord = 'V';
+  constexpr char kCertificateRecord = 'C';
+
+  template <typename IntType>
+  void putInt(std::string &buffer, IntType value) {
+    char bytes[sizeof(IntType)];
+    std::memcpy(bytes, &value, sizeof(IntType));
+    buffer.append(bytes, sizeof(IntType));
+  }
+
+  void putString(std::string &buffer, const std::string &value) {
+    putInt<uint32_t>(buffer, value.size());
+    buffer.append(value);
+  }
+
+  /// reads an integer, returns false on a truncated record
+  template <typename IntType>
+  bool getInt(std::istream &in, IntType &value) {
+    char bytes[sizeof(IntType)];
+    if (not in.read(bytes, sizeof(IntType))) {
+      return false;
+    }
+    std::memcpy(&value, bytes, sizeof(IntType));
+    return true;
+  }
+
+  bool getString(std::istream &in, std::string &value) {
+    uint32_t size{};
+    if (not getInt(in, size)) {
+      return false;
+    }
+    value.resize(size);
+    return static_cast<bool>(in.read(&value[0], size));
+  }
+
+  void putRound(std::string &buffer, const iroha::consensus::Round &round) {
+    putInt<uint64_t>(buffer, round.block_round);
+    putInt<uint32_t>(buffer, round.reject_round);
+  }
+
+  bool getRound(std::istream &in, iroha::consensus::Round &round) {
+    return getInt(in, round.block_round) and getInt(in, round.reject_round);
+  }
+
+  void putSignature(std::string &buffer,
+                    const shared_model::interface::Signature &signature) {
+    putString(buffer, signature.publicKey());
+    putString(buffer, signature.signedData());
+  }
+
+  bool getSignature(
+      std::istream &in,
+      std::shared_ptr<shared_model::interface::Signature> &signature) {
+    std::string public_key;
+    std::string signed_data;
+    if (not getString(in, public_key) or not getString(in, signed_data)) {
+      return false;
+    }
+    using namespace shared_model::interface::types;
+    signature = std::make_shared<shared_model::plain::Signature>(
+        SignedHexStringView{signed_data}, PublicKeyHexStringView{public_key});
+    return true;
+  }
+
+  void putVote(std::string &buffer,
+               const iroha::consensus::yac::VoteMessage &vote) {
+    putRound(buffer, vote.hash.vote_round);
+    putString(buffer, vote.hash.vote_hashes.proposal_hash);
+    putString(buffer, vote.hash.vote_hashes.block_hash);
+    putInt<uint8_t>(buffer, vote.hash.block_signature ? 1 : 0);
+    if (vote.hash.block_signature) {
+      putSignature(buffer, *vote.hash.block_signature);
+    }
+    putSignature(buffer, *vote.signature);
+  }
+
+  bool getVote(std::istream &in, iroha::consensus::yac::VoteMessage &vote) {
+    if (not getRound(in, vote.hash.vote_round)
+        or not getString(in, vote.hash.vote_hashes.proposal_hash)
+        or not getString(in, vote.hash.vote_hashes.block_hash)) {
+      return false;
+    }
+    uint8_t has_block_signature{};
+    if (not getInt(in, has_block_signature)) {
+      return false;
+    }
+    if (has_block_signature
+        and not getSignature(in, vote.hash.block_signature)) {
+      return false;
+    }
+    return getSignature(in, vote.signature);
+  }
+}  // namespace
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      RoundJournal::RoundJournal(std::string path, logger::LoggerPtr log)
+          : path_(std::move(path)), log_(std::move(log)) {
+        load();
+        out_.open(path_, std::ios::binary | std::ios::app);
+        if (not out_.is_open()) {
+          log_->error("Cannot open round journal {} for writing", path_);
+        }
+      }
+
+      void RoundJournal::recordVote(const Round &round) {
+        std::string record;
+        record.push_back(kVoteRecord);
+        putRound(record, round);
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        last_voted_round_ = round;
+        append(record);
+      }
+
+      void RoundJournal::recordCertificate(
+          const std::vector<VoteMessage> &votes) {
+        std::string record;
+        record.push_back(kCertificateRecord);
+        putInt<uint32_t>(record, votes.size());
+        for (const auto &vote : votes) {
+          putVote(record, vote);
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        last_certificate_ = votes;
+        append(record);
+      }
+
+      boost::optional<Round> RoundJournal::lastVotedRound() const {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return last_voted_round_;
+      }
+
+      boost::optional<std::vector<VoteMessage>> RoundJournal::lastCertificate()
+          const {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return last_certificate_;
+      }
+
+      void RoundJournal::load() {
+        std::ifstream in(path_, std::ios::binary);
+        if (not in.is_open()) {
+          return;
+        }
+        char record_type{};
+        while (in.get(record_type)) {
+          if (record_type == kVoteRecord) {
+            Round round;
+            if (not getRound(in, round)) {
+              break;
+            }
+            last_voted_round_ = round;
+          } else if (record_type == kCertificateRecord) {
+            uint32_t size{};
+            if (not getInt(in, size)) {
+              break;
+            }
+            std::vector<VoteMessage> votes(size);
+            bool complete = true;
+            for (auto &vote : votes) {
+              if (not getVote(in, vote)) {
+                complete = false;
+                break;
+              }
+            }
+            if (not complete) {
+              break;
+            }
+            last_certificate_ = std::move(votes);
+          } else {
+            log_->error("Unknown record type in round journal {}", path_);
+            break;
+          }
+        }
+      }
+
+      void RoundJournal::append(const std::string &record) {
+        if (not out_.is_open()) {
+          return;
+        }
+        out_.write(record.data(), record.size());
+        out_.flush();
+        if (not out_) {
+          log_->error("Cannot append to round journal {}", path_);
+        }
+      }
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
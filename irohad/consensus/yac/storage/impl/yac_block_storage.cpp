@@ -21,18 +21,23 @@ namespace iroha {
           : storage_key_(std::move(hash)),
             peers_in_round_(peers_in_round),
             supermajority_checker_(std::move(supermajority_checker)),
-            log_(std::move(log)) {}
+            log_(std::move(log)) {
+        // the round cannot have more votes for this hash than peers, so one
+        // upfront allocation serves the whole storage lifetime
+        votes_.reserve(peers_in_round_);
+      }
 
       boost::optional<Answer> YacBlockStorage::insert(VoteMessage msg) {
         if (validScheme(msg) and uniqueVote(msg)) {
-          votes_.push_back(msg);
+          votes_.push_back(std::move(msg));
 
+          const auto &inserted = votes_.back();
           log_->info(
               "Vote with round {} and hashes ({}, {}) inserted, votes in "
               "storage [{}/{}]",
-              msg.hash.vote_round,
-              msg.hash.vote_hashes.proposal_hash,
-              msg.hash.vote_hashes.block_hash,
+              inserted.hash.vote_round,
+              inserted.hash.vote_hashes.proposal_hash,
+              inserted.hash.vote_hashes.block_hash,
               votes_.size(),
               peers_in_round_);
         }
@@ -41,8 +46,8 @@ namespace iroha {
 
       boost::optional<Answer> YacBlockStorage::insert(
           std::vector<VoteMessage> votes) {
-        std::for_each(votes.begin(), votes.end(), [this](auto vote) {
-          this->insert(vote);
+        std::for_each(votes.begin(), votes.end(), [this](auto &vote) {
+          this->insert(std::move(vote));
         });
         return getState();
       }
@@ -68,7 +73,7 @@ namespace iroha {
         return std::count(votes_.begin(), votes_.end(), msg) != 0;
       }
 
-      YacHash YacBlockStorage::getStorageKey() const {
+      const YacHash &YacBlockStorage::getStorageKey() const {
         return storage_key_;
       }
 
@@ -76,9 +81,10 @@ namespace iroha {
 
       bool YacBlockStorage::uniqueVote(VoteMessage &msg) {
         // lookup take O(n) times
-        return std::all_of(votes_.begin(), votes_.end(), [&msg](auto vote) {
-          return vote != msg;
-        });
+        return std::all_of(
+            votes_.begin(), votes_.end(), [&msg](const auto &vote) {
+              return vote != msg;
+            });
       }
 
       bool YacBlockStorage::validScheme(VoteMessage &vote) {
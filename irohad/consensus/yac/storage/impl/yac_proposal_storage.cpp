@@ -21,10 +21,9 @@ namespace iroha {
         // find exist
         auto iter = std::find_if(block_storages_.begin(),
                                  block_storages_.end(),
-                                 [&store_hash](auto block_storage) {
-                                   auto storage_key =
-                                       block_storage.getStorageKey();
-                                   return storage_key == store_hash;
+                                 [&store_hash](const auto &block_storage) {
+                                   return block_storage.getStorageKey()
+                                       == store_hash;
                                  });
         if (iter != block_storages_.end()) {
           return iter;
@@ -64,7 +63,7 @@ namespace iroha {
                      msg.hash.vote_hashes.block_hash);
 
           auto iter = findStore(msg.hash);
-          auto block_state = iter->insert(msg);
+          auto block_state = iter->insert(std::move(msg));
 
           // Single BlockStorage always returns CommitMessage because it
           // aggregates votes for a single hash.
@@ -85,7 +84,7 @@ namespace iroha {
 
       boost::optional<Answer> YacProposalStorage::insert(
           std::vector<VoteMessage> messages) {
-        std::for_each(messages.begin(), messages.end(), [this](auto vote) {
+        std::for_each(messages.begin(), messages.end(), [this](auto &vote) {
           this->insert(std::move(vote));
         });
         return getState();
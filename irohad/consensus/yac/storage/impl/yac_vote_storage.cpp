@@ -93,7 +93,7 @@ namespace iroha {
         return findProposalStorage(state.at(0), peers_in_round) |
             [this, &state](auto &&storage) {
               const auto &round = storage->getStorageKey();
-              return storage->insert(state) |
+              return storage->insert(std::move(state)) |
                          [this, &round](
                              auto &&insert_outcome) -> boost::optional<Answer> {
                 last_round_ = std::max(last_round_.value_or(round), round);
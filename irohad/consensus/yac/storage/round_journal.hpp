@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_ROUND_JOURNAL_HPP
+#define IROHA_YAC_ROUND_JOURNAL_HPP
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "consensus/round.hpp"
+#include "consensus/yac/vote_message.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /**
+       * Small append-only journal of consensus progress, kept in a plain
+       * file outside the ledger database. It records the last round this
+       * peer voted in and the last collected certificate, so that after a
+       * restart the peer re-enters consensus at the round it left instead
+       * of rediscovering it through timeouts and state requests.
+       *
+       * A record with a truncated tail (e.g. after a crash mid-write) is
+       * ignored; the journal then reflects the previous complete record.
+       */
+      class RoundJournal {
+       public:
+        /**
+         * Opens the journal, replaying the existing records, if any
+         * @param path of the journal file
+         * @param log to report read and write failures to
+         */
+        RoundJournal(std::string path, logger::LoggerPtr log);
+
+        /**
+         * Append the round this peer is about to vote in
+         */
+        void recordVote(const Round &round);
+
+        /**
+         * Append the certificate collected for a round
+         */
+        void recordCertificate(const std::vector<VoteMessage> &votes);
+
+        /**
+         * @return the last recorded voted round, if any
+         */
+        boost::optional<Round> lastVotedRound() const;
+
+        /**
+         * @return the votes of the last recorded certificate, if any
+         */
+        boost::optional<std::vector<VoteMessage>> lastCertificate() const;
+
+       private:
+        /// replay the journal from disk into the last_* fields
+        void load();
+
+        /// append a serialized record to the journal file
+        void append(const std::string &record);
+
+        const std::string path_;
+        mutable std::mutex mutex_;
+        std::ofstream out_;
+        boost::optional<Round> last_voted_round_;
+        boost::optional<std::vector<VoteMessage>> last_certificate_;
+        logger::LoggerPtr log_;
+      };
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_ROUND_JOURNAL_HPP
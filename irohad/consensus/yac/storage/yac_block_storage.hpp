@@ -79,7 +79,7 @@ namespace iroha {
         /**
          * Provide key attached to this storage
          */
-        YacHash getStorageKey() const;
+        const YacHash &getStorageKey() const;
 
        private:
         // --------| private api |--------
@@ -6,10 +6,13 @@
 #include "consensus/yac/transport/impl/network_impl.hpp"
 
 #include <grpc++/grpc++.h>
+#include <algorithm>
+#include <map>
 #include <memory>
 
 #include <fmt/core.h>
-#include "consensus/yac/storage/yac_common.hpp"
+#include "backend/plain/peer.hpp"
+#include "common/thread_affinity.hpp"
 #include "consensus/yac/transport/yac_pb_converters.hpp"
 #include "consensus/yac/vote_message.hpp"
 #include "interfaces/common_objects/peer.hpp"
@@ -26,10 +29,27 @@ namespace iroha {
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
           std::unique_ptr<ClientFactory> client_factory,
-          logger::LoggerPtr log)
+          logger::LoggerPtr log,
+          std::chrono::milliseconds send_window)
           : async_call_(async_call),
             client_factory_(std::move(client_factory)),
-            log_(std::move(log)) {}
+            send_window_(send_window),
+            log_(std::move(log)) {
+        if (send_window_ != std::chrono::milliseconds::zero()) {
+          flusher_ = std::thread([this] { this->flushPendingBundles(); });
+        }
+      }
+
+      NetworkImpl::~NetworkImpl() {
+        {
+          std::lock_guard<std::mutex> pending_lock(pending_mutex_);
+          flusher_stop_ = true;
+        }
+        pending_cv_.notify_all();
+        if (flusher_.joinable()) {
+          flusher_.join();
+        }
+      }
 
       void NetworkImpl::subscribe(
           std::shared_ptr<YacNetworkNotifications> handler) {
@@ -43,6 +63,70 @@ namespace iroha {
 
       void NetworkImpl::sendState(const shared_model::interface::Peer &to,
                                   const std::vector<VoteMessage> &state) {
+        if (send_window_ == std::chrono::milliseconds::zero()) {
+          doSendState(to, state);
+          return;
+        }
+
+        std::lock_guard<std::mutex> pending_lock(pending_mutex_);
+        auto &bundle = pending_bundles_[to.address()];
+        if (not bundle.peer) {
+          bundle.peer = std::make_unique<shared_model::plain::Peer>(
+              to.address(), to.pubkey(), to.tlsCertificate());
+          bundle.deadline = std::chrono::steady_clock::now() + send_window_;
+        }
+        for (const auto &vote : state) {
+          // the same vote may be outstanding from a previous voting step
+          if (std::find(bundle.votes.begin(), bundle.votes.end(), vote)
+              == bundle.votes.end()) {
+            bundle.votes.push_back(vote);
+          }
+        }
+        pending_cv_.notify_one();
+      }
+
+      void NetworkImpl::flushPendingBundles() {
+        affinity::pinThisThread(affinity::stage::kConsensus);
+        std::unique_lock<std::mutex> pending_lock(pending_mutex_);
+        while (not flusher_stop_) {
+          if (pending_bundles_.empty()) {
+            pending_cv_.wait(pending_lock);
+            continue;
+          }
+          auto earliest_deadline =
+              std::min_element(pending_bundles_.begin(),
+                               pending_bundles_.end(),
+                               [](const auto &lhs, const auto &rhs) {
+                                 return lhs.second.deadline
+                                     < rhs.second.deadline;
+                               })
+                  ->second.deadline;
+          if (pending_cv_.wait_until(pending_lock, earliest_deadline)
+                  == std::cv_status::no_timeout
+              and not flusher_stop_) {
+            continue;
+          }
+          auto now = std::chrono::steady_clock::now();
+          std::vector<PendingBundle> due_bundles;
+          for (auto it = pending_bundles_.begin();
+               it != pending_bundles_.end();) {
+            if (it->second.deadline <= now) {
+              due_bundles.push_back(std::move(it->second));
+              it = pending_bundles_.erase(it);
+            } else {
+              ++it;
+            }
+          }
+          pending_lock.unlock();
+          for (const auto &bundle : due_bundles) {
+            doSendState(*bundle.peer, bundle.votes);
+          }
+          pending_lock.lock();
+        }
+      }
+
+      void NetworkImpl::doSendState(const shared_model::interface::Peer &to,
+                                    const std::vector<VoteMessage> &state) {
         std::lock_guard<std::mutex> stop_lock(stop_mutex_);
         if (stop_requested_) {
           log_->warn("Not sending state to {} because stop was requested.", to);
@@ -58,6 +142,7 @@ namespace iroha {
         client_factory_->createClient(to).match(
             [&](auto client) {
               async_call_->Call(
+                  to.address(),
                   [client = std::move(client.value),
                    request = std::move(request),
                    log = log_,
@@ -87,17 +172,21 @@ namespace iroha {
           log_->info("Received an empty votes collection");
           return grpc::Status::CANCELLED;
         }
-        if (not sameKeys(state)) {
-          log_->info(
-              "Votes are statelessly invalid: proposal rounds are different");
-          return grpc::Status::CANCELLED;
-        }
 
         log_->info(
             "Received votes[size={}] from {}", state.size(), context->peer());
 
+        // a bundled message may mix several rounds; the pipeline expects the
+        // votes of one round at a time
+        std::map<Round, std::vector<VoteMessage>> state_by_round;
+        for (auto &vote : state) {
+          state_by_round[vote.hash.vote_round].push_back(std::move(vote));
+        }
+
         if (auto notifications = handler_.lock()) {
-          notifications->onState(std::move(state));
+          for (auto &round_state : state_by_round) {
+            notifications->onState(std::move(round_state.second));
+          }
         } else {
           log_->error("Unable to lock the subscriber");
         }
@@ -9,9 +9,13 @@
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetwork
 #include "yac.grpc.pb.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "consensus/yac/outcome_messages.hpp"
 #include "consensus/yac/vote_message.hpp"
@@ -34,12 +38,23 @@ namespace iroha {
         using Service = proto::Yac;
         using ClientFactory = iroha::network::ClientFactory<Service>;
 
+        /**
+         * @param async_call - gRPC call helper
+         * @param client_factory - a factory of client stubs
+         * @param log - the logger
+         * @param send_window - how long outgoing votes are held back to be
+         * coalesced into a single message per peer; zero sends them at once
+         */
         explicit NetworkImpl(
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
             std::unique_ptr<iroha::network::ClientFactory<
                 ::iroha::consensus::yac::proto::Yac>> client_factory,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            std::chrono::milliseconds send_window =
+                std::chrono::milliseconds::zero());
+
+        ~NetworkImpl() override;
 
         void subscribe(
             std::shared_ptr<YacNetworkNotifications> handler) override;
@@ -60,6 +75,25 @@ namespace iroha {
         void stop() override;
 
        private:
+        /// votes waiting to be coalesced into one message for a peer
+        struct PendingBundle {
+          std::unique_ptr<shared_model::interface::Peer> peer;
+          std::vector<VoteMessage> votes;
+          std::chrono::steady_clock::time_point deadline;
+        };
+
+        /**
+         * Send the votes to the peer in a single message right away
+         */
+        void doSendState(const shared_model::interface::Peer &to,
+                         const std::vector<VoteMessage> &state);
+
+        /**
+         * Send window worker: sends each pending bundle when its window
+         * expires
+         */
+        void flushPendingBundles();
+
         /**
          * Subscriber of network messages
          */
@@ -79,6 +113,14 @@ namespace iroha {
         std::mutex stop_mutex_;
         bool stop_requested_{false};
 
+        const std::chrono::milliseconds send_window_;
+        std::mutex pending_mutex_;
+        std::condition_variable pending_cv_;
+        /// pending bundles by peer address
+        std::unordered_map<std::string, PendingBundle> pending_bundles_;
+        bool flusher_stop_{false};
+        std::thread flusher_;
+
         logger::LoggerPtr log_;
       };
 
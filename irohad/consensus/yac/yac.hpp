@@ -26,6 +26,7 @@ namespace iroha {
     namespace yac {
 
       class YacCryptoProvider;
+      class RoundJournal;
       class Timer;
 
       class Yac : public HashGate, public YacNetworkNotifications {
@@ -42,7 +43,8 @@ namespace iroha {
             ClusterOrdering order,
             Round round,
             rxcpp::observe_on_one_worker worker,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            std::shared_ptr<RoundJournal> journal = nullptr);
 
         Yac(YacVoteStorage vote_storage,
             std::shared_ptr<YacNetwork> network,
@@ -51,7 +53,8 @@ namespace iroha {
             ClusterOrdering order,
             Round round,
             rxcpp::observe_on_one_worker worker,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            std::shared_ptr<RoundJournal> journal = nullptr);
 
         ~Yac() override;
 
@@ -131,6 +134,9 @@ namespace iroha {
         std::shared_ptr<YacNetwork> network_;
         std::shared_ptr<YacCryptoProvider> crypto_;
         std::shared_ptr<Timer> timer_;
+        /// journal of consensus progress for re-entry after restart, may be
+        /// nullptr
+        std::shared_ptr<RoundJournal> journal_;
       };
     }  // namespace yac
   }    // namespace consensus
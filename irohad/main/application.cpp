@@ -5,11 +5,14 @@
 
 #include "main/application.hpp"
 
-#include <boost/filesystem.hpp>
+#include <future>
 #include <optional>
+
+#include <boost/filesystem.hpp>
 #include <rxcpp/operators/rx-map.hpp>
 
 #include "ametsuchi/impl/pool_wrapper.hpp"
+#include "ametsuchi/impl/recent_blocks_cache.hpp"
 #include "ametsuchi/impl/storage_impl.hpp"
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
@@ -22,6 +25,7 @@
 #include "backend/protobuf/proto_tx_status_factory.hpp"
 #include "common/bind.hpp"
 #include "common/files.hpp"
+#include "common/task_scheduler.hpp"
 #include "consensus/yac/consensus_outcome_type.hpp"
 #include "consensus/yac/consistency_model.hpp"
 #include "cryptography/crypto_provider/crypto_model_signer.hpp"
@@ -37,6 +41,8 @@
 #include "main/impl/pg_connection_init.hpp"
 #include "main/impl/storage_init.hpp"
 #include "main/server_runner.hpp"
+#include "main/subsystem_registry.hpp"
+#include "metrics/metrics_registry.hpp"
 #include "multi_sig_transactions/gossip_propagation_strategy.hpp"
 #include "multi_sig_transactions/mst_processor_impl.hpp"
 #include "multi_sig_transactions/mst_propagation_strategy_stub.hpp"
@@ -45,6 +51,7 @@
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
 #include "multi_sig_transactions/transport/mst_transport_stub.hpp"
 #include "network/impl/block_loader_impl.hpp"
+#include "network/impl/address_resolver.hpp"
 #include "network/impl/channel_factory.hpp"
 #include "network/impl/channel_pool.hpp"
 #include "network/impl/client_factory_impl.hpp"
@@ -52,18 +59,23 @@
 #include "network/impl/peer_communication_service_impl.hpp"
 #include "network/impl/peer_tls_certificates_provider_root.hpp"
 #include "network/impl/peer_tls_certificates_provider_wsv.hpp"
+#include "network/impl/peer_zones.hpp"
 #include "network/impl/tls_credentials.hpp"
+#include "network/impl/wsv_diff_service.hpp"
 #include "ordering/impl/kick_out_proposal_creation_strategy.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/impl/on_demand_ordering_gate.hpp"
 #include "ordering/impl/unique_creation_proposal_strategy.hpp"
 #include "simulator/impl/simulator.hpp"
+#include "synchronizer/impl/sync_stage_file.hpp"
 #include "synchronizer/impl/synchronizer_impl.hpp"
 #include "torii/impl/command_service_impl.hpp"
+#include "torii/impl/command_service_async_transport_grpc.hpp"
 #include "torii/impl/command_service_transport_grpc.hpp"
 #include "torii/impl/status_bus_impl.hpp"
 #include "torii/processor/query_processor_impl.hpp"
 #include "torii/processor/transaction_processor_impl.hpp"
+#include "torii/impl/query_service_async_transport_grpc.hpp"
 #include "torii/query_service.hpp"
 #include "torii/tls_params.hpp"
 #include "validation/impl/chain_validator_impl.hpp"
@@ -76,10 +88,6 @@
 #include "validators/protobuf/proto_query_validator.hpp"
 #include "validators/protobuf/proto_transaction_validator.hpp"
 
-#if defined(USE_BURROW)
-#include "ametsuchi/impl/burrow_vm_caller.hpp"
-#endif
-
 using namespace iroha;
 using namespace iroha::ametsuchi;
 using namespace iroha::simulator;
@@ -126,19 +134,34 @@ Irohad::Irohad(
       pg_opt_(std::move(pg_opt)),
       ordering_init(logger_manager->getLogger()),
       yac_init(std::make_unique<iroha::consensus::yac::YacInit>()),
+      consensus_outcome_delay_(std::chrono::milliseconds(
+          config_.max_round_delay_ms.value_or(kMaxRoundsDelayDefault))),
       consensus_gate_objects(consensus_gate_objects_lifetime),
       log_manager_(std::move(logger_manager)),
       log_(log_manager_->getLogger()) {
   log_->info("created");
+  // the shared worker pool exists before any subsystem, so every parallel
+  // stage initialized below can rely on it
+  task_scheduler = std::make_shared<iroha::TaskScheduler>(
+      0, log_manager_->getChild("TaskScheduler")->getLogger());
+  if (config_.zone) {
+    peer_zones_ = std::make_shared<iroha::network::PeerZones>(
+        *config_.zone,
+        config_.peer_zones.value_or(
+            std::unordered_map<std::string, std::string>{}));
+  }
   // TODO: rework in a more C++11+ - ish way luckychess 29.06.2019 IR-575
   std::srand(std::time(0));
   // Initializing storage at this point in order to insert genesis block before
   // initialization of iroha daemon
 
+  registerCompiledSubsystems();
   if (auto e = expected::resultToOptionalError(initPendingTxsStorage() | [&] {
-#if defined(USE_BURROW)
-        vm_caller_ = std::make_unique<iroha::ametsuchi::BurrowVmCaller>();
-#endif
+        if (auto vm_caller =
+                SubsystemRegistry<iroha::ametsuchi::VmCaller>::instance()
+                    .create(kBurrowVmCallerName)) {
+          vm_caller_ = std::move(vm_caller);
+        }
         return initStorage(startup_wsv_data_policy);
       })) {
     log_->error("Storage initialization failed: {}", e.value());
@@ -161,20 +184,43 @@ Irohad::~Irohad() {
  */
 Irohad::RunResult Irohad::init() {
   // clang-format off
-  return initSettings()
+  auto prerequisites = initSettings()
          | [this]{ return initValidatorsConfigs();}
          | [this]{ return initBatchParser();}
          | [this]{ return initValidators();}
-         // Recover WSV from the existing ledger to be sure it is consistent
-         | [this]{ return initWsvRestorer(); }
-         | [this]{ return restoreWsv();}
-         | [this]{ return validateKeypair();}
-         | [this]{ return initTlsCredentials();}
+         | [this]{ return initWsvRestorer(); };
+  // clang-format on
+  if (expected::hasError(prerequisites)) {
+    return prerequisites;
+  }
+
+  // WSV restoration dominates restart time and only touches storage, so
+  // the subsystems with no storage dependency are brought up concurrently
+  // with it; the stages that read the WSV (keypair check, peer
+  // certificates, channel warmup) wait until restoration is done
+  auto independent_subsystems = std::async(std::launch::async, [this] {
+    // clang-format off
+    return initTlsCredentials()
+           | [this]{ return initCryptoProvider();}
+           | [this]{ return initNetworkClient();}
+           | [this]{ return initFactories();};
+    // clang-format on
+  });
+
+  // Recover WSV from the existing ledger to be sure it is consistent
+  auto restore_result = restoreWsv();
+  auto independent_result = independent_subsystems.get();
+  if (expected::hasError(restore_result)) {
+    return restore_result;
+  }
+  if (expected::hasError(independent_result)) {
+    return independent_result;
+  }
+
+  // clang-format off
+  return validateKeypair()
          | [this]{ return initPeerCertProvider();}
          | [this]{ return initClientFactory();}
-         | [this]{ return initCryptoProvider();}
-         | [this]{ return initNetworkClient();}
-         | [this]{ return initFactories();}
          | [this]{ return initPersistentCache();}
          | [this]{ return initOrderingGate();}
          | [this]{ return initSimulator();}
@@ -243,7 +289,11 @@ Irohad::RunResult Irohad::initValidatorsConfigs() {
  */
 Irohad::RunResult Irohad::initStorage(
     StartupWsvDataPolicy startup_wsv_data_policy) {
-  return PgConnectionInit::init(startup_wsv_data_policy, *pg_opt_, log_manager_)
+  return PgConnectionInit::init(
+             startup_wsv_data_policy,
+             *pg_opt_,
+             log_manager_,
+             config_.replica_pg_opts.value_or(std::vector<std::string>{}))
              | [this](auto &&pool_wrapper) -> RunResult {
     pool_wrapper_ = std::move(pool_wrapper);
     query_response_factory_ =
@@ -255,13 +305,31 @@ Irohad::RunResult Irohad::initStorage(
       vm_caller_ref = *vm_caller_.value();
     }
 
+    iroha::ametsuchi::FlatFileSyncPolicy block_store_sync_policy;
+    if (config_.block_store_fsync_blocks) {
+      block_store_sync_policy.group_blocks =
+          *config_.block_store_fsync_blocks;
+    }
+    if (config_.block_store_fsync_interval_ms) {
+      block_store_sync_policy.group_interval =
+          std::chrono::milliseconds(*config_.block_store_fsync_interval_ms);
+    }
+
+    iroha::ametsuchi::IndexRetentionPolicy index_retention_policy;
+    if (config_.tx_index_retention_blocks) {
+      index_retention_policy.retention_blocks =
+          *config_.tx_index_retention_blocks;
+    }
+
     return ::iroha::initStorage(*pg_opt_,
                                 pool_wrapper_,
                                 pending_txs_storage_,
                                 query_response_factory_,
                                 config_.block_store_path,
+                                block_store_sync_policy,
                                 vm_caller_ref,
-                                log_manager_->getChild("Storage"))
+                                log_manager_->getChild("Storage"),
+                                index_retention_policy)
                | [&](auto &&v) -> RunResult {
       storage = std::move(v);
 
@@ -410,9 +478,23 @@ Irohad::RunResult Irohad::initPeerCertProvider() {
  * Initializing channel pool.
  */
 Irohad::RunResult Irohad::initClientFactory() {
+  channel_pool_ = std::make_shared<ChannelPool>(
+      std::make_unique<ChannelFactory>(
+          this->grpc_channel_params_,
+          std::make_shared<AddressResolver>(
+              log_manager_->getChild("AddressResolver")->getLogger())),
+      log_manager_->getChild("ChannelPool")->getLogger());
   inter_peer_client_factory_ =
-      std::make_unique<GenericClientFactory>(std::make_unique<ChannelPool>(
-          std::make_unique<ChannelFactory>(this->grpc_channel_params_)));
+      std::make_unique<GenericClientFactory>(channel_pool_);
+
+  // start connecting to the current ledger peers right away, so the first
+  // vote after startup does not pay for connection establishment
+  auto peers = storage->createPeerQuery() |
+      [](auto &&peer_query) { return peer_query->getLedgerPeers(); };
+  if (peers) {
+    channel_pool_->warmup(
+        iroha::consensus::yac::proto::Yac::service_full_name(), *peers);
+  }
   return {};
 }
 
@@ -439,11 +521,8 @@ Irohad::RunResult Irohad::initBatchParser() {
  * Initializing validators
  */
 Irohad::RunResult Irohad::initValidators() {
-  auto factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
-      shared_model::validation::DefaultProposalValidator>>(validators_config_);
   auto validators_log_manager = log_manager_->getChild("Validators");
   stateful_validator = std::make_shared<StatefulValidatorImpl>(
-      std::move(factory),
       batch_parser,
       validators_log_manager->getChild("Stateful")->getLogger());
   chain_validator = std::make_shared<ChainValidatorImpl>(
@@ -460,31 +539,30 @@ Irohad::RunResult Irohad::initValidators() {
 Irohad::RunResult Irohad::initNetworkClient() {
   async_call_ =
       std::make_shared<network::AsyncGrpcClient<google::protobuf::Empty>>(
-          log_manager_->getChild("AsyncNetworkClient")->getLogger());
+          log_manager_->getChild("AsyncNetworkClient")->getLogger(),
+          config_.async_client_cq_count.value_or(1));
   return {};
 }
 
 Irohad::RunResult Irohad::initFactories() {
-  // proposal factory
-  std::shared_ptr<
-      shared_model::validation::AbstractValidator<iroha::protocol::Transaction>>
-      proto_transaction_validator = std::make_shared<
-          shared_model::validation::ProtoTransactionValidator>();
-  std::unique_ptr<shared_model::validation::AbstractValidator<
-      shared_model::interface::Proposal>>
-      proposal_validator =
-          std::make_unique<shared_model::validation::DefaultProposalValidator>(
-              proposal_validators_config_);
-  std::unique_ptr<
-      shared_model::validation::AbstractValidator<iroha::protocol::Proposal>>
-      proto_proposal_validator =
-          std::make_unique<shared_model::validation::ProtoProposalValidator>(
-              proto_transaction_validator);
+  // the validation profile of every factory is known here at compile
+  // time, so the validators are composed statically - each build() runs
+  // one inlined validation pass instead of going through
+  // AbstractValidator pointers
+  auto proto_transaction_validator = std::make_shared<
+      shared_model::validation::ProtoTransactionValidator>();
+
+  // proposal factory: trusted internal re-validation of proposals
   proposal_factory =
-      std::make_shared<shared_model::proto::ProtoTransportFactory<
+      std::make_shared<shared_model::proto::StaticProtoTransportFactory<
           shared_model::interface::Proposal,
-          shared_model::proto::Proposal>>(std::move(proposal_validator),
-                                          std::move(proto_proposal_validator));
+          shared_model::proto::Proposal,
+          shared_model::validation::DefaultProposalValidator,
+          shared_model::validation::ProtoProposalValidator>>(
+          shared_model::validation::DefaultProposalValidator{
+              proposal_validators_config_},
+          shared_model::validation::ProtoProposalValidator{
+              proto_transaction_validator});
 
   auto batch_validator =
       std::make_shared<shared_model::validation::DefaultBatchValidator>(
@@ -494,45 +572,35 @@ Irohad::RunResult Irohad::initFactories() {
       std::make_shared<shared_model::interface::TransactionBatchFactoryImpl>(
           batch_validator);
 
-  std::unique_ptr<shared_model::validation::AbstractValidator<
-      shared_model::interface::Transaction>>
-      transaction_validator = std::make_unique<
-          shared_model::validation::DefaultOptionalSignedTransactionValidator>(
-          validators_config_);
+  // transaction factory: strict torii ingress validation
   transaction_factory =
-      std::make_shared<shared_model::proto::ProtoTransportFactory<
+      std::make_shared<shared_model::proto::StaticProtoTransportFactory<
           shared_model::interface::Transaction,
-          shared_model::proto::Transaction>>(
-          std::move(transaction_validator),
-          std::move(proto_transaction_validator));
-
-  // query factories
-  std::unique_ptr<shared_model::validation::AbstractValidator<
-      shared_model::interface::Query>>
-      query_validator = std::make_unique<
-          shared_model::validation::DefaultSignedQueryValidator>(
-          validators_config_);
-  std::unique_ptr<
-      shared_model::validation::AbstractValidator<iroha::protocol::Query>>
-      proto_query_validator =
-          std::make_unique<shared_model::validation::ProtoQueryValidator>();
-  query_factory = std::make_shared<
-      shared_model::proto::ProtoTransportFactory<shared_model::interface::Query,
-                                                 shared_model::proto::Query>>(
-      std::move(query_validator), std::move(proto_query_validator));
-
-  auto blocks_query_validator = std::make_unique<
-      shared_model::validation::DefaultSignedBlocksQueryValidator>(
-      validators_config_);
-  auto proto_blocks_query_validator =
-      std::make_unique<shared_model::validation::ProtoBlocksQueryValidator>();
+          shared_model::proto::Transaction,
+          shared_model::validation::
+              DefaultOptionalSignedTransactionValidator,
+          shared_model::validation::ProtoTransactionValidator>>(
+          shared_model::validation::DefaultOptionalSignedTransactionValidator{
+              validators_config_});
+
+  // query factories: strict torii ingress validation
+  query_factory =
+      std::make_shared<shared_model::proto::StaticProtoTransportFactory<
+          shared_model::interface::Query,
+          shared_model::proto::Query,
+          shared_model::validation::DefaultSignedQueryValidator,
+          shared_model::validation::ProtoQueryValidator>>(
+          shared_model::validation::DefaultSignedQueryValidator{
+              validators_config_});
 
   blocks_query_factory =
-      std::make_shared<shared_model::proto::ProtoTransportFactory<
+      std::make_shared<shared_model::proto::StaticProtoTransportFactory<
           shared_model::interface::BlocksQuery,
-          shared_model::proto::BlocksQuery>>(
-          std::move(blocks_query_validator),
-          std::move(proto_blocks_query_validator));
+          shared_model::proto::BlocksQuery,
+          shared_model::validation::DefaultSignedBlocksQueryValidator,
+          shared_model::validation::ProtoBlocksQueryValidator>>(
+          shared_model::validation::DefaultSignedBlocksQueryValidator{
+              validators_config_});
 
   log_->info("[Init] => factories");
   return {};
@@ -596,8 +664,16 @@ Irohad::RunResult Irohad::initOrderingGate() {
   std::shared_ptr<iroha::ordering::ProposalCreationStrategy> proposal_strategy =
       std::make_shared<ordering::UniqueCreationProposalStrategy>();
 
+  // the journal lives next to the block storage; without a block store
+  // path the accepted batches are not journaled
+  auto batch_journal_path = config_.block_store_path |
+      [](const auto &path) -> boost::optional<std::string> {
+    return path + "/ordering_batch_journal.bin";
+  };
+
   ordering_gate = ordering_init.initOrderingGate(
       config_.max_proposal_size,
+      config_.max_proposal_bytes.value_or(0),
       std::chrono::milliseconds(config_.proposal_delay),
       std::move(hashes),
       transaction_factory,
@@ -609,7 +685,11 @@ Irohad::RunResult Irohad::initOrderingGate() {
       persistent_cache,
       proposal_strategy,
       log_manager_->getChild("Ordering"),
-      inter_peer_client_factory_);
+      inter_peer_client_factory_,
+      [outcome_delay = consensus_outcome_delay_]() mutable {
+        outcome_delay.onBatchesArrived();
+      },
+      std::move(batch_journal_path));
   log_->info("[Init] => init ordering gate - [{}]",
              logger::boolRepr(bool(ordering_gate)));
   return {};
@@ -662,13 +742,26 @@ Irohad::RunResult Irohad::initConsensusCache() {
  * Initializing block loader
  */
 Irohad::RunResult Irohad::initBlockLoader() {
+  recent_blocks_cache_ = std::make_shared<ametsuchi::RecentBlocksCache>();
+  recent_blocks_cache_->subscribeTo(storage->on_commit());
+
+  wsv_diff_service_ = std::make_shared<network::WsvDiffService>(
+      log_manager_->getChild("WsvDiffService")->getLogger());
+  wsv_diff_service_->subscribeTo(storage->on_commit());
+
   block_loader =
       loader_init.initBlockLoader(storage,
                                   storage,
                                   consensus_result_cache_,
+                                  recent_blocks_cache_,
                                   block_validators_config_,
+                                  config_.trusted_sync_validation.value_or(
+                                      false),
                                   log_manager_->getChild("BlockLoader"),
-                                  inter_peer_client_factory_);
+                                  inter_peer_client_factory_,
+                                  PublicKeyHexStringView{
+                                      keypair_->publicKey()});
+  loader_init.pusher->subscribeTo(storage->on_commit());
 
   log_->info("[Init] => block loader");
   return {};
@@ -698,6 +791,13 @@ Irohad::RunResult Irohad::initConsensusGate() {
     return expected::makeError("Failed to fetch ledger state!");
   }
 
+  // the journal lives next to the block storage; without a block store
+  // path the consensus progress is not journaled
+  auto round_journal_path = config_.block_store_path |
+      [](const auto &path) -> boost::optional<std::string> {
+    return path + "/yac_round_journal.bin";
+  };
+
   consensus_gate = yac_init->initConsensusGate(
       {block->height(), ordering::kFirstRejectRound},
       storage,
@@ -711,9 +811,9 @@ Irohad::RunResult Irohad::initConsensusGate() {
       async_call_,
       kConsensusConsistencyModel,
       log_manager_->getChild("Consensus"),
-      std::chrono::milliseconds(
-          config_.max_round_delay_ms.value_or(kMaxRoundsDelayDefault)),
-      inter_peer_client_factory_);
+      consensus_outcome_delay_,
+      inter_peer_client_factory_,
+      std::move(round_journal_path));
   consensus_gate->onOutcome().subscribe(
       consensus_gate_events_subscription,
       consensus_gate_objects.get_subscriber());
@@ -727,6 +827,16 @@ Irohad::RunResult Irohad::initConsensusGate() {
 Irohad::RunResult Irohad::initSynchronizer() {
   return storage->createCommandExecutor() |
              [this](auto &&command_executor) -> RunResult {
+    // the stage file lives next to the block storage; without a block
+    // store path an interrupted catch-up starts over
+    auto stage_file = config_.block_store_path |
+        [this](const auto &path)
+        -> boost::optional<std::shared_ptr<SyncStageFile>> {
+      return std::make_shared<SyncStageFile>(
+          path + "/sync_stage.bin",
+          log_manager_->getChild("SyncStageFile")->getLogger());
+    };
+
     synchronizer = std::make_shared<SynchronizerImpl>(
         std::move(command_executor),
         consensus_gate,
@@ -734,7 +844,9 @@ Irohad::RunResult Irohad::initSynchronizer() {
         storage,
         storage,
         block_loader,
-        log_manager_->getChild("Synchronizer")->getLogger());
+        log_manager_->getChild("Synchronizer")->getLogger(),
+        peer_zones_,
+        stage_file.value_or(nullptr));
 
     log_->info("[Init] => synchronizer");
     return {};
@@ -755,7 +867,21 @@ Irohad::RunResult Irohad::initPeerCommunicationService() {
     log_->info("~~~~~~~~~| PROPOSAL ^_^ |~~~~~~~~~ ");
   });
 
+  pcs->onSynchronization().subscribe(
+      [outcome_delay = consensus_outcome_delay_](const auto &) mutable {
+        // every processed outcome ends in a synchronization event, so the
+        // next outcome may be handed over without a configured sleep
+        outcome_delay.onOutcomeProcessed();
+      });
+
   pcs->onSynchronization().subscribe([this](const auto &event) {
+    if (event.ledger_state) {
+      // the peer set (or some peer address) may have changed - make sure
+      // channels to all current peers exist and are connecting
+      channel_pool_->warmup(
+          iroha::consensus::yac::proto::Yac::service_full_name(),
+          event.ledger_state->ledger_peers);
+    }
     using iroha::synchronizer::SynchronizationOutcomeType;
     switch (event.sync_outcome) {
       case SynchronizationOutcomeType::kCommit:
@@ -810,7 +936,10 @@ Irohad::RunResult Irohad::initMstProcessor() {
             iroha::network::MstTransportGrpc::Service>>(
             inter_peer_client_factory_));
     mst_propagation = std::make_shared<GossipPropagationStrategy>(
-        storage, rxcpp::observe_on_new_thread(), *opt_mst_gossip_params_);
+        storage,
+        rxcpp::observe_on_new_thread(),
+        *opt_mst_gossip_params_,
+        peer_zones_);
   } else {
     mst_transport = std::make_shared<iroha::network::MstTransportStub>();
     mst_propagation = std::make_shared<iroha::PropagationStrategyStub>();
@@ -854,6 +983,13 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
       status_factory,
       storage->on_commit(),
       command_service_log_manager->getChild("Processor")->getLogger());
+  // the status cache is dumped next to the block store on shutdown, so a
+  // restarted node answers status polls for recent transactions directly
+  boost::optional<std::string> status_cache_snapshot_path;
+  if (config_.block_store_path) {
+    status_cache_snapshot_path =
+        *config_.block_store_path + "/status_cache.snapshot";
+  }
   command_service = std::make_shared<::torii::CommandServiceImpl>(
       tx_processor,
       storage,
@@ -861,6 +997,7 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
       status_factory,
       cs_cache,
       persistent_cache,
+      std::move(status_cache_snapshot_path),
       command_service_log_manager->getLogger());
   command_service_transport =
       std::make_shared<::torii::CommandServiceTransportGrpc>(
@@ -881,6 +1018,20 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
   return {};
 }
 
+std::shared_ptr<::torii::CommandServiceAsyncTransportGrpc>
+Irohad::makeAsyncCommandServiceTransport() {
+  return std::make_shared<::torii::CommandServiceAsyncTransportGrpc>(
+      command_service_transport,
+      command_service,
+      consensus_gate_objects.get_observable().map([](const auto &) {
+        return ::torii::CommandServiceTransportGrpc::ConsensusGateEvent{};
+      }),
+      config_.stale_stream_max_rounds.value_or(kStaleStreamMaxRoundsDefault),
+      log_manager_->getChild("CommandService")
+          ->getChild("AsyncTransport")
+          ->getLogger());
+}
+
 /**
  * Initializing query command service
  */
@@ -897,12 +1048,23 @@ Irohad::RunResult Irohad::initQueryService() {
       query_processor,
       query_factory,
       blocks_query_factory,
+      storage->on_commit(),
       query_service_log_manager->getLogger());
 
   log_->info("[Init] => query service");
   return {};
 }
 
+std::shared_ptr<::torii::QueryServiceAsyncTransportGrpc>
+Irohad::makeAsyncQueryServiceTransport() {
+  return std::make_shared<::torii::QueryServiceAsyncTransportGrpc>(
+      query_service,
+      task_scheduler,
+      log_manager_->getChild("QueryService")
+          ->getChild("AsyncTransport")
+          ->getLogger());
+}
+
 Irohad::RunResult Irohad::initWsvRestorer() {
   auto interface_validator =
       std::make_unique<shared_model::validation::DefaultSignedBlockValidator>(
@@ -913,7 +1075,8 @@ Irohad::RunResult Irohad::initWsvRestorer() {
       std::move(interface_validator),
       std::move(proto_validator),
       chain_validator,
-      log_manager_->getChild("WsvRestorer")->getLogger());
+      log_manager_->getChild("WsvRestorer")->getLogger(),
+      config_.restore_parallel_sessions.value_or(0));
   return {};
 }
 
@@ -943,10 +1106,14 @@ Irohad::RunResult Irohad::run() {
     };
   };
 
-  // Run torii server
-  auto run_result = torii_server->append(command_service_transport)
-                        .append(query_service)
-                        .run()
+  // Run torii server; StatusStream and Find are served through the
+  // completion queue of the runner, so the open streams multiplex over
+  // its poller threads instead of parking one handler thread each, and
+  // query responses leave through the single-allocation raw path
+  auto run_result =
+      torii_server->appendAsync(makeAsyncCommandServiceTransport())
+          .appendAsync(makeAsyncQueryServiceTransport())
+          .run()
       | make_port_logger("Torii");
 
   // Run torii TLS server
@@ -958,13 +1125,32 @@ Irohad::RunResult Irohad::run() {
           false,
           tls_creds);
       return (*torii_tls_server)
-                 ->append(command_service_transport)
-                 .append(query_service)
+                 ->appendAsync(makeAsyncCommandServiceTransport())
+                 .appendAsync(makeAsyncQueryServiceTransport())
                  .run()
           | make_port_logger("Torii TLS");
     };
   };
 
+  // Run torii unix domain socket server; co-located clients submitting
+  // over it skip the localhost TCP and TLS overhead entirely
+  config_.torii_unix_socket | [&, this](const auto &socket_path) {
+    run_result |= [&, this]() -> RunResult {
+      torii_uds_server = std::make_unique<ServerRunner>(
+          "unix:" + socket_path,
+          log_manager_->getChild("ToriiUdsServerRunner")->getLogger(),
+          false);
+      return (*torii_uds_server)
+                 ->appendAsync(makeAsyncCommandServiceTransport())
+                 .appendAsync(makeAsyncQueryServiceTransport())
+                 .run()
+          | [this, &socket_path](auto) -> RunResult {
+        log_->info("Torii server bound on unix socket {}", socket_path);
+        return {};
+      };
+    };
+  };
+
   // Run internal server
   run_result |= [&, this] {
     if (config_.mst_support) {
@@ -974,10 +1160,27 @@ Irohad::RunResult Irohad::run() {
     return internal_server->append(ordering_init.service)
                .append(yac_init->getConsensusNetwork())
                .append(loader_init.service)
+               .append(wsv_diff_service_)
                .run()
         | make_port_logger("Internal");
   };
 
+  // Run metrics endpoint
+  run_result |= [&, this]() -> RunResult {
+    if (config_.metrics_port) {
+      try {
+        metrics_server = std::make_unique<iroha::metrics::MetricsHttpServer>(
+            listen_ip_,
+            *config_.metrics_port,
+            iroha::metrics::MetricsRegistry::instance(),
+            log_manager_->getChild("MetricsServer")->getLogger());
+      } catch (std::runtime_error const &e) {
+        return expected::makeError(e.what());
+      }
+    }
+    return {};
+  };
+
   return run_result | [&]() -> RunResult {
     log_->info("===> iroha initialized");
     // initiate first round
@@ -10,6 +10,7 @@
 
 #include "consensus/consensus_block_cache.hpp"
 #include "consensus/gate_object.hpp"
+#include "consensus/yac/impl/consensus_outcome_delay.hpp"
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
 #include "cryptography/keypair.hpp"
 #include "interfaces/queries/blocks_query.hpp"
@@ -21,6 +22,7 @@
 #include "main/iroha_conf_loader.hpp"
 #include "main/server_runner.hpp"
 #include "main/startup_params.hpp"
+#include "metrics/metrics_http_server.hpp"
 #include "multi_sig_transactions/gossip_propagation_strategy_params.hpp"
 #include "torii/tls_params.hpp"
 
@@ -28,7 +30,9 @@ namespace iroha {
   class PendingTransactionStorage;
   class PendingTransactionStorageInit;
   class MstProcessor;
+  class TaskScheduler;
   namespace ametsuchi {
+    class RecentBlocksCache;
     class WsvRestorer;
     class TxPresenceCache;
     class Storage;
@@ -51,6 +55,8 @@ namespace iroha {
     class OrderingGate;
     class PeerCommunicationService;
     class PeerTlsCertificatesProvider;
+    class PeerZones;
+    class WsvDiffService;
     struct GrpcChannelParams;
     struct TlsCredentials;
   }  // namespace network
@@ -69,7 +75,9 @@ namespace iroha {
     class StatusBus;
     class CommandService;
     class CommandServiceTransportGrpc;
+    class CommandServiceAsyncTransportGrpc;
     class QueryService;
+    class QueryServiceAsyncTransportGrpc;
 
     struct TlsParams;
   }  // namespace torii
@@ -203,8 +211,26 @@ class Irohad {
 
   virtual RunResult initTransactionCommandService();
 
+  /**
+   * Makes a torii transport with the asynchronous StatusStream. gRPC
+   * allows a service with asynchronous methods to be registered with a
+   * single server only, so every torii server gets an instance of its
+   * own; they all delegate to the shared command_service_transport
+   */
+  std::shared_ptr<iroha::torii::CommandServiceAsyncTransportGrpc>
+  makeAsyncCommandServiceTransport();
+
   virtual RunResult initQueryService();
 
+  /**
+   * Makes a torii transport with the asynchronous raw Find. gRPC
+   * allows a service with asynchronous methods to be registered with a
+   * single server only, so every torii server gets an instance of its
+   * own; they all delegate to the shared query_service
+   */
+  std::shared_ptr<iroha::torii::QueryServiceAsyncTransportGrpc>
+  makeAsyncQueryServiceTransport();
+
   virtual RunResult initSettings();
 
   virtual RunResult initValidatorsConfigs();
@@ -249,20 +275,33 @@ class Irohad {
   std::unique_ptr<iroha::ametsuchi::PostgresOptions> pg_opt_;
   std::shared_ptr<iroha::ametsuchi::Storage> storage;
 
+  // worker pool shared by the parallel parts of the pipeline; subsystems
+  // post to it instead of spawning pools of their own
+  std::shared_ptr<iroha::TaskScheduler> task_scheduler;
+
  protected:
   rxcpp::observable<shared_model::interface::types::HashType> finalized_txs_;
 
   // initialization objects
   iroha::ordering::OnDemandOrderingInit ordering_init;
   std::unique_ptr<iroha::consensus::yac::YacInit> yac_init;
+  // shared between the consensus gate, which queries the round delays,
+  // and the ordering service, which snaps them back on batch arrival
+  iroha::consensus::yac::ConsensusOutcomeDelay consensus_outcome_delay_;
   iroha::network::BlockLoaderInit loader_init;
 
   // IR-907 14.09.2020 @lebdron: remove it from here
   std::shared_ptr<iroha::ametsuchi::PoolWrapper> pool_wrapper_;
 
+  std::shared_ptr<iroha::network::ChannelPool> channel_pool_;
+
   std::shared_ptr<iroha::network::GenericClientFactory>
       inter_peer_client_factory_;
 
+  // operator-assigned failure-domain labels of the peers; block sync and
+  // MST gossip prefer same-zone peers, unset when no zone is configured
+  std::shared_ptr<iroha::network::PeerZones> peer_zones_;
+
   // Settings
   std::shared_ptr<const shared_model::validation::Settings> settings_;
 
@@ -333,8 +372,12 @@ class Irohad {
       consensus_result_cache_;
 
   // block loader
+  std::shared_ptr<iroha::ametsuchi::RecentBlocksCache> recent_blocks_cache_;
   std::shared_ptr<iroha::network::BlockLoader> block_loader;
 
+  // per-block WSV diff feed for external read models
+  std::shared_ptr<iroha::network::WsvDiffService> wsv_diff_service_;
+
   // synchronizer
   std::shared_ptr<iroha::synchronizer::Synchronizer> synchronizer;
 
@@ -365,8 +408,13 @@ class Irohad {
   std::unique_ptr<iroha::network::ServerRunner> torii_server;
   boost::optional<std::unique_ptr<iroha::network::ServerRunner>>
       torii_tls_server = boost::none;
+  boost::optional<std::unique_ptr<iroha::network::ServerRunner>>
+      torii_uds_server = boost::none;
   std::unique_ptr<iroha::network::ServerRunner> internal_server;
 
+  /// serves the Prometheus scrape endpoint when metrics_port is configured
+  std::unique_ptr<iroha::metrics::MetricsHttpServer> metrics_server;
+
   logger::LoggerManagerTreePtr log_manager_;  ///< application root log manager
 
   logger::LoggerPtr log_;  ///< log for local messages
@@ -5,6 +5,7 @@
 
 #include "main/impl/block_loader_init.hpp"
 
+#include "ametsuchi/impl/recent_blocks_cache.hpp"
 #include "logger/logger_manager.hpp"
 #include "network/impl/client_factory_impl.hpp"
 #include "validators/default_validator.hpp"
@@ -16,48 +17,85 @@ using namespace iroha::network;
 
 namespace {
 
+  /**
+   * Create the factory validating the blocks downloaded or pushed from
+   * other peers
+   * @param validators_config - a config for underlying validators
+   * @param trusted_sync - validate the blocks with the certified
+   * profile: their supermajority signatures are verified either way, so
+   * the per-transaction stateless checks can be skipped
+   * @return initialized factory
+   */
+  auto createBlockFactory(
+      std::shared_ptr<shared_model::validation::ValidatorsConfig>
+          validators_config,
+      bool trusted_sync) {
+    std::unique_ptr<shared_model::validation::AbstractValidator<
+        shared_model::interface::Block>>
+        interface_validator;
+    if (trusted_sync) {
+      interface_validator = std::make_unique<
+          shared_model::validation::CertifiedBlockValidator>(
+          validators_config);
+    } else {
+      interface_validator = std::make_unique<
+          shared_model::validation::DefaultSignedBlockValidator>(
+          validators_config);
+    }
+    return std::make_shared<shared_model::proto::ProtoBlockFactory>(
+        std::move(interface_validator),
+        std::make_unique<shared_model::validation::ProtoBlockValidator>());
+  }
+
   /**
    * Create block loader service with given storage
    * @param block_query_factory - factory to block query component
    * @param block_cache used to retrieve last block put by consensus
+   * @param pushed_blocks_cache stores the blocks pushed by other peers
+   * @param block_factory validates the pushed blocks at receipt
    * @param loader_log - the log of the loader subsystem
    * @return initialized service
    */
   auto createService(
       std::shared_ptr<BlockQueryFactory> block_query_factory,
       std::shared_ptr<consensus::ConsensusResultCache> consensus_result_cache,
+      std::shared_ptr<RecentBlocksCache> recent_blocks_cache,
+      std::shared_ptr<RecentBlocksCache> pushed_blocks_cache,
+      std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory,
       const logger::LoggerManagerTreePtr &loader_log_manager) {
     return std::make_shared<BlockLoaderService>(
         std::move(block_query_factory),
         std::move(consensus_result_cache),
-        loader_log_manager->getChild("Network")->getLogger());
+        std::move(recent_blocks_cache),
+        loader_log_manager->getChild("Network")->getLogger(),
+        std::move(pushed_blocks_cache),
+        std::move(block_factory));
   }
 
   /**
    * Create block loader for loading blocks from given peer factory by top
    * block
    * @param peer_query_factory - factory for peer query component creation
-   * @param validators_config - a config for underlying validators
+   * @param block_factory - validates the downloaded blocks
+   * @param pushed_blocks_cache - blocks pushed by other peers, consulted
+   * before going to the network
    * @param loader_log - the log of the loader subsystem
    * @param client_factory - a factory to create client stubs
    * @return initialized loader
    */
-  auto createLoader(std::shared_ptr<PeerQueryFactory> peer_query_factory,
-                    std::shared_ptr<shared_model::validation::ValidatorsConfig>
-                        validators_config,
-                    logger::LoggerPtr loader_log,
-                    std::shared_ptr<GenericClientFactory> client_factory) {
-    auto block_factory = std::make_shared<
-        shared_model::proto::ProtoBlockFactory>(
-        std::make_unique<shared_model::validation::DefaultSignedBlockValidator>(
-            validators_config),
-        std::make_unique<shared_model::validation::ProtoBlockValidator>());
+  auto createLoader(
+      std::shared_ptr<PeerQueryFactory> peer_query_factory,
+      std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory,
+      std::shared_ptr<RecentBlocksCache> pushed_blocks_cache,
+      logger::LoggerPtr loader_log,
+      std::shared_ptr<GenericClientFactory> client_factory) {
     return std::make_shared<BlockLoaderImpl>(
         std::move(peer_query_factory),
         std::move(block_factory),
         std::move(loader_log),
         std::make_unique<ClientFactoryImpl<BlockLoaderImpl::Service>>(
-            std::move(client_factory)));
+            std::move(client_factory)),
+        std::move(pushed_blocks_cache));
   }
 
 }  // namespace
@@ -66,16 +104,34 @@ std::shared_ptr<BlockLoader> BlockLoaderInit::initBlockLoader(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     std::shared_ptr<BlockQueryFactory> block_query_factory,
     std::shared_ptr<consensus::ConsensusResultCache> consensus_result_cache,
+    std::shared_ptr<ametsuchi::RecentBlocksCache> recent_blocks_cache,
     std::shared_ptr<shared_model::validation::ValidatorsConfig>
         validators_config,
+    bool trusted_sync,
     const logger::LoggerManagerTreePtr &loader_log_manager,
-    std::shared_ptr<iroha::network::GenericClientFactory> client_factory) {
+    std::shared_ptr<iroha::network::GenericClientFactory> client_factory,
+    shared_model::interface::types::PublicKeyHexStringView own_pubkey) {
+  // the blocks pushed by committing peers wait here until the local
+  // synchronizer asks for them
+  auto pushed_blocks_cache = std::make_shared<RecentBlocksCache>();
+  auto block_factory =
+      createBlockFactory(std::move(validators_config), trusted_sync);
   service = createService(std::move(block_query_factory),
                           std::move(consensus_result_cache),
+                          std::move(recent_blocks_cache),
+                          pushed_blocks_cache,
+                          block_factory,
                           loader_log_manager);
-  loader = createLoader(std::move(peer_query_factory),
-                        std::move(validators_config),
+  loader = createLoader(peer_query_factory,
+                        std::move(block_factory),
+                        std::move(pushed_blocks_cache),
                         loader_log_manager->getLogger(),
-                        std::move(client_factory));
+                        client_factory);
+  pusher = std::make_shared<BlockPusher>(
+      std::move(peer_query_factory),
+      std::make_unique<ClientFactoryImpl<BlockPusher::Service>>(
+          std::move(client_factory)),
+      std::string{std::string_view{own_pubkey}},
+      loader_log_manager->getChild("Pusher")->getLogger());
   return loader;
 }
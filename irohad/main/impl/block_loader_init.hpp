@@ -12,6 +12,7 @@
 #include "logger/logger_manager_fwd.hpp"
 #include "network/impl/block_loader_impl.hpp"
 #include "network/impl/block_loader_service.hpp"
+#include "network/impl/block_pusher.hpp"
 #include "validators/validators_common.hpp"
 
 namespace iroha {
@@ -28,9 +29,16 @@ namespace iroha {
        * @param peer_query_factory - factory to peer query component
        * @param block_query_factory - factory to block query component
        * @param block_cache used to retrieve last block put by consensus
+       * @param recent_blocks_cache - ring of recently committed blocks for
+       * serving syncing peers from memory; may be null
        * @param validators_config - a config for underlying validators
+       * @param trusted_sync - when set, downloaded blocks are validated
+       * with the certified profile: the supermajority signatures are
+       * verified, the per-transaction stateless checks are skipped
        * @param loader_log - the log of the loader subsystem
        * @param client_factory - a factory of client stubs
+       * @param own_pubkey - hex public key of this node, fixes its
+       * position in the block push ring
        * @return initialized service
        */
       std::shared_ptr<BlockLoader> initBlockLoader(
@@ -38,13 +46,17 @@ namespace iroha {
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<consensus::ConsensusResultCache> block_cache,
+          std::shared_ptr<ametsuchi::RecentBlocksCache> recent_blocks_cache,
           std::shared_ptr<shared_model::validation::ValidatorsConfig>
               validators_config,
+          bool trusted_sync,
           const logger::LoggerManagerTreePtr &loader_log_manager,
-          std::shared_ptr<iroha::network::GenericClientFactory> client_factory);
+          std::shared_ptr<iroha::network::GenericClientFactory> client_factory,
+          shared_model::interface::types::PublicKeyHexStringView own_pubkey);
 
       std::shared_ptr<BlockLoaderImpl> loader;
       std::shared_ptr<BlockLoaderService> service;
+      std::shared_ptr<BlockPusher> pusher;
     };
   }  // namespace network
 }  // namespace iroha
@@ -13,6 +13,7 @@
 #include "consensus/yac/impl/yac_gate_impl.hpp"
 #include "consensus/yac/impl/yac_hash_provider_impl.hpp"
 #include "consensus/yac/storage/buffered_cleanup_strategy.hpp"
+#include "consensus/yac/storage/round_journal.hpp"
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
 #include "consensus/yac/transport/impl/network_impl.hpp"
 #include "consensus/yac/yac.hpp"
@@ -23,6 +24,9 @@ using namespace iroha::consensus;
 using namespace iroha::consensus::yac;
 
 namespace {
+  /// for how long outgoing votes are coalesced into one message per peer
+  const std::chrono::milliseconds kVoteSendWindow(10);
+
   auto createPeerOrderer(
       std::shared_ptr<iroha::ametsuchi::PeerQueryFactory> peer_query_factory) {
     return std::make_shared<PeerOrdererImpl>(peer_query_factory);
@@ -47,13 +51,26 @@ namespace {
       std::shared_ptr<YacNetwork> network,
       ConsistencyModel consistency_model,
       rxcpp::observe_on_one_worker coordination,
+      std::shared_ptr<RoundJournal> round_journal,
       const logger::LoggerManagerTreePtr &consensus_log_manager) {
     std::shared_ptr<iroha::consensus::yac::CleanupStrategy> cleanup_strategy =
         std::make_shared<iroha::consensus::yac::BufferedCleanupStrategy>();
+    YacVoteStorage vote_storage(
+        cleanup_strategy,
+        getSupermajorityChecker(consistency_model),
+        consensus_log_manager->getChild("VoteStorage"));
+    if (round_journal) {
+      round_journal->lastCertificate() | [&](const auto &votes) {
+        // keep the pre-restart certificate available for propagation to
+        // lagging peers without re-emitting it to the pipeline
+        vote_storage.store(votes, initial_order.getNumberOfPeers());
+        auto &certificate_round = votes.at(0).hash.vote_round;
+        vote_storage.nextProcessingState(certificate_round);
+        vote_storage.nextProcessingState(certificate_round);
+      };
+    }
     return Yac::create(
-        YacVoteStorage(cleanup_strategy,
-                       getSupermajorityChecker(consistency_model),
-                       consensus_log_manager->getChild("VoteStorage")),
+        std::move(vote_storage),
         std::move(network),
         createCryptoProvider(
             keypair, consensus_log_manager->getChild("Crypto")->getLogger()),
@@ -61,7 +78,8 @@ namespace {
         initial_order,
         initial_round,
         coordination,
-        consensus_log_manager->getChild("HashGate")->getLogger());
+        consensus_log_manager->getChild("HashGate")->getLogger(),
+        std::move(round_journal));
   }
 }  // namespace
 
@@ -101,10 +119,27 @@ namespace iroha {
               async_call,
           ConsistencyModel consistency_model,
           const logger::LoggerManagerTreePtr &consensus_log_manager,
-          std::chrono::milliseconds delay,
+          ConsensusOutcomeDelay outcome_delay,
           std::shared_ptr<iroha::network::GenericClientFactory>
-              client_factory) {
+              client_factory,
+          boost::optional<std::string> round_journal_path) {
         auto peer_orderer = createPeerOrderer(peer_query_factory);
+
+        std::shared_ptr<RoundJournal> round_journal;
+        if (round_journal_path) {
+          round_journal = std::make_shared<RoundJournal>(
+              *round_journal_path,
+              consensus_log_manager->getChild("RoundJournal")->getLogger());
+          round_journal->lastVotedRound() | [&](const auto &last_voted) {
+            // the ledger defines the block round; the journal restores the
+            // reject round progress within it, so the peer re-enters
+            // consensus where it left instead of starting the round over
+            if (last_voted.block_round == initial_round.block_round
+                and last_voted.reject_round > initial_round.reject_round) {
+              initial_round = last_voted;
+            }
+          };
+        }
         auto peers = peer_query_factory->createPeerQuery() |
             [](auto &&peer_query) { return peer_query->getLedgerPeers(); };
 
@@ -113,7 +148,8 @@ namespace iroha {
             std::make_unique<
                 iroha::network::ClientFactoryImpl<NetworkImpl::Service>>(
                 std::move(client_factory)),
-            consensus_log_manager->getChild("Network")->getLogger());
+            consensus_log_manager->getChild("Network")->getLogger(),
+            kVoteSendWindow);
 
         auto yac = createYac(*ClusterOrdering::create(peers.value()),
                              initial_round,
@@ -122,6 +158,7 @@ namespace iroha {
                              consensus_network_,
                              consistency_model,
                              rxcpp::observe_on_new_thread(),
+                             std::move(round_journal),
                              consensus_log_manager);
         consensus_network_->subscribe(yac);
 
@@ -139,7 +176,7 @@ namespace iroha {
             block_creator,
             std::move(consensus_result_cache),
             consensus_log_manager->getChild("Gate")->getLogger(),
-            ConsensusOutcomeDelay(delay));
+            std::move(outcome_delay));
       }
     }  // namespace yac
   }    // namespace consensus
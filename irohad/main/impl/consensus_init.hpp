@@ -12,6 +12,7 @@
 #include "consensus/consensus_block_cache.hpp"
 #include "consensus/yac/consensus_outcome_type.hpp"
 #include "consensus/yac/consistency_model.hpp"
+#include "consensus/yac/impl/consensus_outcome_delay.hpp"
 #include "consensus/yac/outcome_messages.hpp"
 #include "consensus/yac/timer.hpp"
 #include "consensus/yac/transport/impl/network_impl.hpp"
@@ -50,9 +51,10 @@ namespace iroha {
                 async_call,
             ConsistencyModel consistency_model,
             const logger::LoggerManagerTreePtr &consensus_log_manager,
-            std::chrono::milliseconds delay,
+            ConsensusOutcomeDelay outcome_delay,
             std::shared_ptr<iroha::network::GenericClientFactory>
-                client_factory);
+                client_factory,
+            boost::optional<std::string> round_journal_path = boost::none);
 
         std::shared_ptr<NetworkImpl> getConsensusNetwork() const;
 
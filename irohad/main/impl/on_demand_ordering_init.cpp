@@ -16,6 +16,8 @@
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "network/impl/client_factory_impl.hpp"
+#include "ordering/impl/adaptive_proposal_policy.hpp"
+#include "ordering/impl/batch_journal.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/impl/on_demand_connection_manager.hpp"
 #include "ordering/impl/on_demand_ordering_gate.hpp"
@@ -51,7 +53,15 @@ auto createNotificationFactory(
         proposal_transport_factory,
     std::chrono::milliseconds delay,
     const logger::LoggerManagerTreePtr &ordering_log_manager,
-    std::shared_ptr<iroha::network::GenericClientFactory> client_factory) {
+    std::shared_ptr<iroha::network::GenericClientFactory> client_factory,
+    std::shared_ptr<OnDemandOrderingService> ordering_service,
+    std::shared_ptr<transport::OnDemandOsClientGrpc::TransactionFactoryType>
+        transaction_factory,
+    std::shared_ptr<shared_model::interface::TransactionBatchParser>
+        batch_parser,
+    std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+        transaction_batch_factory,
+    std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy) {
   return std::make_shared<transport::OnDemandOsClientGrpcFactory>(
       std::move(async_call),
       std::move(proposal_transport_factory),
@@ -59,8 +69,19 @@ auto createNotificationFactory(
       delay,
       ordering_log_manager->getChild("NetworkClient")->getLogger(),
       std::make_unique<iroha::network::ClientFactoryImpl<
-          transport::OnDemandOsClientGrpcFactory::Service>>(
-          std::move(client_factory)));
+          transport::OnDemandOsClientGrpcFactory::Service>>(client_factory),
+      // the local ordering service cache and the batch factories let the
+      // clients rebuild announced proposals from batch hash digests
+      std::move(ordering_service),
+      std::move(transaction_factory),
+      std::move(batch_parser),
+      std::move(transaction_batch_factory),
+      std::move(adaptive_policy),
+      // the generic stubs let the clients send the batches request as one
+      // shared pre-serialized buffer instead of serializing it per peer
+      client_factory,
+      std::make_shared<iroha::network::AsyncGrpcClient<grpc::ByteBuffer>>(
+          ordering_log_manager->getChild("NetworkClient")->getLogger()));
 }
 
 auto OnDemandOrderingInit::createConnectionManager(
@@ -70,7 +91,16 @@ auto OnDemandOrderingInit::createConnectionManager(
     std::chrono::milliseconds delay,
     std::vector<shared_model::interface::types::HashType> initial_hashes,
     const logger::LoggerManagerTreePtr &ordering_log_manager,
-    std::shared_ptr<iroha::network::GenericClientFactory> client_factory) {
+    std::shared_ptr<iroha::network::GenericClientFactory> client_factory,
+    std::shared_ptr<OnDemandOrderingService> ordering_service,
+    std::shared_ptr<shared_model::interface::AbstractTransportFactory<
+        shared_model::interface::Transaction,
+        iroha::protocol::Transaction>> transaction_factory,
+    std::shared_ptr<shared_model::interface::TransactionBatchParser>
+        batch_parser,
+    std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+        transaction_batch_factory,
+    std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy) {
   // since top block will be the first in commit_notifier observable,
   // hashes of two previous blocks are prepended
   const size_t kBeforePreviousTop = 0, kPreviousTop = 1;
@@ -204,7 +234,12 @@ auto OnDemandOrderingInit::createConnectionManager(
                                 std::move(proposal_transport_factory),
                                 delay,
                                 ordering_log_manager,
-                                std::move(client_factory)),
+                                std::move(client_factory),
+                                std::move(ordering_service),
+                                std::move(transaction_factory),
+                                std::move(batch_parser),
+                                std::move(transaction_batch_factory),
+                                std::move(adaptive_policy)),
       peers,
       ordering_log_manager->getChild("ConnectionManager")->getLogger());
 }
@@ -273,17 +308,42 @@ auto OnDemandOrderingInit::createGate(
 
 auto OnDemandOrderingInit::createService(
     size_t max_number_of_transactions,
+    size_t max_proposal_bytes,
     std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
         proposal_factory,
     std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_cache,
     std::shared_ptr<ProposalCreationStrategy> creation_strategy,
-    const logger::LoggerManagerTreePtr &ordering_log_manager) {
+    const logger::LoggerManagerTreePtr &ordering_log_manager,
+    std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy,
+    std::function<void()> batches_arrived_callback,
+    std::shared_ptr<shared_model::interface::AbstractTransportFactory<
+        shared_model::interface::Transaction,
+        iroha::protocol::Transaction>> transaction_factory,
+    std::shared_ptr<shared_model::interface::TransactionBatchParser>
+        batch_parser,
+    std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+        transaction_batch_factory,
+    boost::optional<std::string> batch_journal_path) {
+  std::shared_ptr<BatchJournal> batch_journal;
+  if (batch_journal_path) {
+    batch_journal = std::make_shared<BatchJournal>(
+        std::move(*batch_journal_path),
+        std::move(transaction_factory),
+        std::move(batch_parser),
+        std::move(transaction_batch_factory),
+        ordering_log_manager->getChild("BatchJournal")->getLogger());
+  }
   return std::make_shared<OnDemandOrderingServiceImpl>(
       max_number_of_transactions,
       std::move(proposal_factory),
       std::move(tx_cache),
       creation_strategy,
-      ordering_log_manager->getChild("Service")->getLogger());
+      ordering_log_manager->getChild("Service")->getLogger(),
+      3,
+      std::move(adaptive_policy),
+      max_proposal_bytes,
+      std::move(batches_arrived_callback),
+      std::move(batch_journal));
 }
 
 OnDemandOrderingInit::~OnDemandOrderingInit() {
@@ -294,6 +354,7 @@ OnDemandOrderingInit::~OnDemandOrderingInit() {
 std::shared_ptr<iroha::network::OrderingGate>
 OnDemandOrderingInit::initOrderingGate(
     size_t max_number_of_transactions,
+    size_t max_proposal_bytes,
     std::chrono::milliseconds delay,
     std::vector<shared_model::interface::types::HashType> initial_hashes,
     std::shared_ptr<transport::OnDemandOsServerGrpc::TransportFactoryType>
@@ -310,17 +371,32 @@ OnDemandOrderingInit::initOrderingGate(
     std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_cache,
     std::shared_ptr<ProposalCreationStrategy> creation_strategy,
     logger::LoggerManagerTreePtr ordering_log_manager,
-    std::shared_ptr<iroha::network::GenericClientFactory> client_factory) {
+    std::shared_ptr<iroha::network::GenericClientFactory> client_factory,
+    std::function<void()> batches_arrived_callback,
+    boost::optional<std::string> batch_journal_path) {
+  // shared by the ordering service, which packs proposals, and the network
+  // clients, which set the proposal request deadlines
+  auto adaptive_policy = std::make_shared<AdaptiveProposalPolicy>(
+      max_number_of_transactions,
+      delay,
+      ordering_log_manager->getChild("AdaptivePolicy")->getLogger());
   auto ordering_service = createService(max_number_of_transactions,
+                                        max_proposal_bytes,
                                         proposal_factory,
                                         tx_cache,
                                         creation_strategy,
-                                        ordering_log_manager);
+                                        ordering_log_manager,
+                                        adaptive_policy,
+                                        std::move(batches_arrived_callback),
+                                        transaction_factory,
+                                        batch_parser,
+                                        transaction_batch_factory,
+                                        std::move(batch_journal_path));
   service = std::make_shared<transport::OnDemandOsServerGrpc>(
       ordering_service,
-      std::move(transaction_factory),
-      std::move(batch_parser),
-      std::move(transaction_batch_factory),
+      transaction_factory,
+      batch_parser,
+      transaction_batch_factory,
       ordering_log_manager->getChild("Server")->getLogger());
   return createGate(
       ordering_service,
@@ -329,7 +405,12 @@ OnDemandOrderingInit::initOrderingGate(
                               delay,
                               std::move(initial_hashes),
                               ordering_log_manager,
-                              std::move(client_factory)),
+                              std::move(client_factory),
+                              ordering_service,
+                              std::move(transaction_factory),
+                              std::move(batch_parser),
+                              std::move(transaction_batch_factory),
+                              std::move(adaptive_policy)),
       std::move(proposal_factory),
       std::move(tx_cache),
       std::move(creation_strategy),
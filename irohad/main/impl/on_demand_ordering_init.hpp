@@ -7,8 +7,11 @@
 #define IROHA_ON_DEMAND_ORDERING_INIT_HPP
 
 #include <chrono>
+#include <functional>
+#include <string>
 #include <vector>
 
+#include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger_fwd.hpp"
@@ -55,6 +58,7 @@ namespace iroha {
     struct SynchronizationEvent;
   }
   namespace ordering {
+    class AdaptiveProposalPolicy;
     class OnDemandOrderingService;
     class ProposalCreationStrategy;
     namespace transport {
@@ -87,7 +91,16 @@ namespace iroha {
           std::chrono::milliseconds delay,
           std::vector<shared_model::interface::types::HashType> initial_hashes,
           const logger::LoggerManagerTreePtr &ordering_log_manager,
-          std::shared_ptr<iroha::network::GenericClientFactory> client_factory);
+          std::shared_ptr<iroha::network::GenericClientFactory> client_factory,
+          std::shared_ptr<OnDemandOrderingService> ordering_service,
+          std::shared_ptr<shared_model::interface::AbstractTransportFactory<
+              shared_model::interface::Transaction,
+              iroha::protocol::Transaction>> transaction_factory,
+          std::shared_ptr<shared_model::interface::TransactionBatchParser>
+              batch_parser,
+          std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+              transaction_batch_factory,
+          std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy);
 
       /**
        * Creates on-demand ordering gate. \see initOrderingGate for parameters
@@ -109,11 +122,22 @@ namespace iroha {
        */
       auto createService(
           size_t max_number_of_transactions,
+          size_t max_proposal_bytes,
           std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
               proposal_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ProposalCreationStrategy> creation_strategy,
-          const logger::LoggerManagerTreePtr &ordering_log_manager);
+          const logger::LoggerManagerTreePtr &ordering_log_manager,
+          std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy,
+          std::function<void()> batches_arrived_callback,
+          std::shared_ptr<shared_model::interface::AbstractTransportFactory<
+              shared_model::interface::Transaction,
+              iroha::protocol::Transaction>> transaction_factory,
+          std::shared_ptr<shared_model::interface::TransactionBatchParser>
+              batch_parser,
+          std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+              transaction_batch_factory,
+          boost::optional<std::string> batch_journal_path);
 
       rxcpp::composite_subscription sync_event_notifier_lifetime_;
       rxcpp::composite_subscription commit_notifier_lifetime_;
@@ -130,6 +154,8 @@ namespace iroha {
        *
        * @param max_number_of_transactions maximum number of transactions in a
        * proposal
+       * @param max_proposal_bytes maximum serialized size of the
+       * transactions of a proposal, 0 disables the byte cap
        * @param delay timeout for ordering service response on proposal request
        * @param initial_hashes seeds for peer list permutations for first k
        * rounds they are required since hash of block i defines round i + k
@@ -146,10 +172,17 @@ namespace iroha {
        * @param creation_strategy - provides a strategy for creating proposals
        * in OS
        * @param client_factory - a factory of client stubs
+       * @param batches_arrived_callback - called when new batches enter the
+       * ordering service cache; lets the consensus cadence snap back from
+       * the stretched empty-round delays
+       * @param batch_journal_path - path of the persistent batch journal
+       * replayed into the ordering service cache after a crash; the cache
+       * is not journaled when not set
        * @return initialized ordering gate
        */
       std::shared_ptr<network::OrderingGate> initOrderingGate(
           size_t max_number_of_transactions,
+          size_t max_proposal_bytes,
           std::chrono::milliseconds delay,
           std::vector<shared_model::interface::types::HashType> initial_hashes,
           std::shared_ptr<shared_model::interface::AbstractTransportFactory<
@@ -167,7 +200,9 @@ namespace iroha {
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ProposalCreationStrategy> creation_strategy,
           logger::LoggerManagerTreePtr ordering_log_manager,
-          std::shared_ptr<iroha::network::GenericClientFactory> client_factory);
+          std::shared_ptr<iroha::network::GenericClientFactory> client_factory,
+          std::function<void()> batches_arrived_callback = {},
+          boost::optional<std::string> batch_journal_path = boost::none);
 
       /// gRPC service for ordering service
       std::shared_ptr<grpc::Service> service;
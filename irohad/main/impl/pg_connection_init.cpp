@@ -7,7 +7,7 @@
 
 #include <boost/functional/hash.hpp>
 #include <boost/range/adaptor/transformed.hpp>
-#include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
+#include "ametsuchi/impl/backoff_reconnection_strategy.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "common/irohad_version.hpp"
 #include "logger/logger.hpp"
@@ -28,28 +28,61 @@ namespace {
   /// WSV schema version is identified by compatibile irohad version.
   using SchemaVersion = iroha::IrohadVersion;
 
+  /// everything the reuse path needs to know about an existing schema,
+  /// gathered by a single query
+  struct SchemaStatus {
+    SchemaVersion version;
+    bool hash_indexes_binary{false};
+    bool time_window_index{false};
+    bool assets_count_column{false};
+  };
+
   /**
-   * Get the version of database.
+   * Get the version of database and the state of applied migrations.
    * @param sql a connection to working database
-   * @return result of schema version or error.
+   * @return result of schema status or error.
    */
-  iroha::expected::Result<SchemaVersion, std::string> getDbSchemaVersion(
+  iroha::expected::Result<SchemaStatus, std::string> getDbSchemaStatus(
       soci::session &sql) {
-    SchemaVersion version;
+    SchemaStatus status;
     try {
       int test = 0;
+      std::string hash_column_type;
+      soci::indicator hash_column_type_ind;
+      int time_window_index = 0;
+      soci::indicator time_window_index_ind;
+      int assets_count_column = 0;
+      soci::indicator assets_count_column_ind;
       sql << "select "
-             "1 test, iroha_major, iroha_minor, iroha_patch "
+             "1 test, iroha_major, iroha_minor, iroha_patch, "
+             "(select data_type from information_schema.columns "
+             "where table_name = 'tx_positions' "
+             "and column_name = 'hash') hash_column_type, "
+             "(select 1 from pg_indexes "
+             "where tablename = 'tx_positions' and indexname = "
+             "'tx_positions_creator_id_asset_ts_index') time_window_index, "
+             "(select 1 from information_schema.columns "
+             "where table_name = 'account' "
+             "and column_name = 'assets_count') assets_count_column "
              "from schema_version;",
-          soci::into(test), soci::into(version.major),
-          soci::into(version.minor), soci::into(version.patch);
+          soci::into(test), soci::into(status.version.major),
+          soci::into(status.version.minor), soci::into(status.version.patch),
+          soci::into(hash_column_type, hash_column_type_ind),
+          soci::into(time_window_index, time_window_index_ind),
+          soci::into(assets_count_column, assets_count_column_ind);
       if (test == 0) {
         return "Database contains no schema version information.";
       }
+      status.hash_indexes_binary = hash_column_type_ind == soci::i_ok
+          and hash_column_type == "bytea";
+      status.time_window_index =
+          time_window_index_ind == soci::i_ok and time_window_index == 1;
+      status.assets_count_column =
+          assets_count_column_ind == soci::i_ok and assets_count_column == 1;
     } catch (std::exception &e) {
       return iroha::expected::makeError(formatPostgresMessage(e.what()));
     }
-    return version;
+    return status;
   }
 
   iroha::expected::Result<std::unique_ptr<soci::session>, std::string>
@@ -77,22 +110,6 @@ namespace {
     }
   };
 
-  /**
-   * Checks schema compatibility.
-   * @return value of true if the schema in the provided sql connection is
-   * compatibile with this code, false if not and an error message if the
-   * check could not be performed.
-   */
-  iroha::expected::Result<bool, std::string> isSchemaCompatible(
-      const PostgresOptions &postgres_options) {
-    return getWorkingDbSession(postgres_options) | [](auto sql) {
-      return getDbSchemaVersion(*sql) |
-          [](const SchemaVersion &db_schema_version) {
-            return db_schema_version == iroha::getIrohadVersion();
-          };
-    };
-  }
-
   void processPqNotice(void *arg, const char *message) {
     auto *log = reinterpret_cast<logger::Logger *>(arg);
     log->debug("{}", formatPostgresMessage(message));
@@ -137,12 +154,19 @@ iroha::expected::Result<std::shared_ptr<iroha::ametsuchi::PoolWrapper>,
                         std::string>
 PgConnectionInit::init(StartupWsvDataPolicy startup_wsv_data_policy,
                        iroha::ametsuchi::PostgresOptions const &pg_opt,
-                       logger::LoggerManagerTreePtr log_manager) {
+                       logger::LoggerManagerTreePtr log_manager,
+                       std::vector<std::string> const &replica_conn_opts) {
   return prepareWorkingDatabase(startup_wsv_data_policy, pg_opt) | [&] {
-    return prepareConnectionPool(KTimesReconnectionStrategyFactory{10},
-                                 pg_opt,
-                                 kDbPoolSize,
-                                 log_manager);
+    // one session probes a database outage with growing jittered delays
+    // while the rest of the pool waits for its verdict, so a restart of
+    // postgres is not met with a simultaneous retry storm
+    return prepareConnectionPool(
+        ExponentialBackoffReconnectionStrategyFactory{
+            10, std::chrono::milliseconds(100), std::chrono::seconds(3)},
+        pg_opt,
+        kDbPoolSize,
+        log_manager,
+        replica_conn_opts);
   };
 }
 
@@ -150,20 +174,44 @@ iroha::expected::Result<void, std::string>
 PgConnectionInit::prepareWorkingDatabase(
     StartupWsvDataPolicy startup_wsv_data_policy,
     const PostgresOptions &options) {
-  return getMaintenanceSession(options) | [&](auto maintenance_sql) {
-    if (startup_wsv_data_policy == StartupWsvDataPolicy::kReuse) {
-      return isSchemaCompatible(options) | [&](bool is_compatible)
+  if (startup_wsv_data_policy == StartupWsvDataPolicy::kReuse) {
+    // fast path for restarts: one session, one query which brings back
+    // both the schema version and the migration state; no DDL is
+    // executed when the schema is current
+    return getWorkingDbSession(options) | [](auto session)
+               -> iroha::expected::Result<void, std::string> {
+      return getDbSchemaStatus(*session) | [&](const SchemaStatus &status)
                  -> iroha::expected::Result<void, std::string> {
-        if (not is_compatible) {
+        if (not(status.version == iroha::getIrohadVersion())) {
           return "The schema is not compatible. "
                  "Either overwrite the ledger or use a compatible binary "
                  "version.";
         }
-        return iroha::expected::Value<void>{};
+        if (status.hash_indexes_binary and status.time_window_index
+            and status.assets_count_column) {
+          return iroha::expected::Value<void>();
+        }
+        iroha::expected::Result<void, std::string> migrated =
+            status.hash_indexes_binary
+            ? iroha::expected::Result<void, std::string>{
+                  iroha::expected::Value<void>()}
+            : migrateHashIndexesToBinary(*session);
+        return std::move(migrated) |
+            [&]() -> iroha::expected::Result<void, std::string> {
+          if (status.time_window_index) {
+            return iroha::expected::Value<void>();
+          }
+          return createTimeWindowIndex(*session);
+        } | [&]() -> iroha::expected::Result<void, std::string> {
+          if (status.assets_count_column) {
+            return iroha::expected::Value<void>();
+          }
+          return addAssetsCountColumn(*session);
+        };
       };
-    }
-    return dropWorkingDatabase(options) | [&] { return createSchema(options); };
-  };
+    };
+  }
+  return dropWorkingDatabase(options) | [&] { return createSchema(options); };
 }
 
 iroha::expected::Result<std::shared_ptr<PoolWrapper>, std::string>
@@ -171,7 +219,8 @@ PgConnectionInit::prepareConnectionPool(
     const ReconnectionStrategyFactory &reconnection_strategy_factory,
     const PostgresOptions &options,
     const int pool_size,
-    logger::LoggerManagerTreePtr log_manager) {
+    logger::LoggerManagerTreePtr log_manager,
+    std::vector<std::string> const &replica_conn_opts) {
   auto options_str = options.workingConnectionString();
 
   auto conn = initPostgresConnection(options_str, pool_size);
@@ -200,6 +249,32 @@ PgConnectionInit::prepareConnectionPool(
     std::unique_ptr<FailoverCallbackHolder> failover_callback_factory =
         std::make_unique<FailoverCallbackHolder>();
 
+    // a small separate pool serves the block commit path, so that long
+    // commits cannot exhaust the pool which torii queries lease from
+    auto maintenance_conn = initPostgresConnection(
+        options_str, iroha::ametsuchi::PoolWrapper::kMaintenancePoolSize);
+    if (auto e = boost::get<expected::Error<std::string>>(&maintenance_conn)) {
+      return *e;
+    }
+    auto &maintenance_pool =
+        boost::get<expected::Value<std::shared_ptr<soci::connection_pool>>>(
+            maintenance_conn)
+            .value;
+
+    // pools of sessions to read replicas which serve torii queries
+    std::vector<std::shared_ptr<soci::connection_pool>> replica_pools;
+    replica_pools.reserve(replica_conn_opts.size());
+    for (auto replica_opts : replica_conn_opts) {
+      auto replica_conn = initPostgresConnection(replica_opts, pool_size);
+      if (auto e = boost::get<expected::Error<std::string>>(&replica_conn)) {
+        return *e;
+      }
+      replica_pools.push_back(
+          boost::get<expected::Value<std::shared_ptr<soci::connection_pool>>>(
+              replica_conn)
+              .value);
+    }
+
     return initializeConnectionPool(*connection,
                                     pool_size,
                                     try_rollback,
@@ -207,10 +282,39 @@ PgConnectionInit::prepareConnectionPool(
                                     reconnection_strategy_factory,
                                     options_str,
                                     log_manager)
+               | [&] {
+                 return initializeConnectionPool(
+                     *maintenance_pool,
+                     iroha::ametsuchi::PoolWrapper::kMaintenancePoolSize,
+                     [](soci::session &) {},
+                     *failover_callback_factory,
+                     reconnection_strategy_factory,
+                     options_str,
+                     log_manager);
+               }
+               | [&]() -> iroha::expected::Result<void, std::string> {
+                 for (size_t i = 0; i < replica_pools.size(); ++i) {
+                   auto replica_init = initializeConnectionPool(
+                       *replica_pools[i],
+                       pool_size,
+                       [](soci::session &) {},
+                       *failover_callback_factory,
+                       reconnection_strategy_factory,
+                       replica_conn_opts[i],
+                       log_manager);
+                   if (auto e =
+                           expected::resultToOptionalError(replica_init)) {
+                     return expected::makeError(std::move(e).value());
+                   }
+                 }
+                 return {};
+               }
                | [&]() -> iroha::expected::Result<std::shared_ptr<PoolWrapper>,
                                                   std::string> {
       return std::make_shared<iroha::ametsuchi::PoolWrapper>(
           std::move(connection),
+          std::move(maintenance_pool),
+          std::move(replica_pools),
           std::move(failover_callback_factory),
           enable_prepared_transactions);
     };
@@ -341,6 +445,9 @@ CREATE TABLE account (
     domain_id character varying(255) NOT NULL REFERENCES domain,
     quorum int NOT NULL,
     data JSONB,
+    -- denormalized count of account_has_asset rows, maintained by the
+    -- asset commands so that paginated queries avoid a full count
+    assets_count bigint NOT NULL DEFAULT 0,
     PRIMARY KEY (account_id)
 );
 CREATE TABLE account_has_signatory (
@@ -386,14 +493,19 @@ CREATE TABLE account_has_grantable_permissions (
       + R"() NOT NULL,
     PRIMARY KEY (permittee_account_id, account_id)
 );
+-- partitioned by height range so the retention pruner can drop whole
+-- partitions instead of deleting rows; the indexer creates partitions
+-- as the chain grows into them
 CREATE TABLE IF NOT EXISTS tx_positions (
     creator_id text,
-    hash varchar(64) not null,
+    -- hashes are stored as raw bytes: half the size of the former hex
+    -- text, which keeps twice as much of the hash index in cache
+    hash bytea not null,
     asset_id text,
     ts bigint,
-    height bigint,
+    height bigint not null,
     index bigint
-);
+) PARTITION BY RANGE (height);
 CREATE INDEX IF NOT EXISTS tx_positions_hash_index
     ON tx_positions
     USING hash
@@ -401,11 +513,16 @@ CREATE INDEX IF NOT EXISTS tx_positions_hash_index
 CREATE INDEX IF NOT EXISTS tx_positions_creator_id_asset_index
     ON tx_positions
     (creator_id, asset_id);
+-- serves the account transaction queries with a created-time window
+-- pushed down, with and without an asset filter
+CREATE INDEX IF NOT EXISTS tx_positions_creator_id_asset_ts_index
+    ON tx_positions
+    (creator_id, asset_id, ts);
 CREATE INDEX IF NOT EXISTS tx_positions_ts_height_index_index
     ON tx_positions
     (ts);
 CREATE TABLE IF NOT EXISTS tx_status_by_hash (
-    hash varchar,
+    hash bytea,
     status boolean
 );
 CREATE INDEX tx_status_by_hash_hash_index
@@ -480,6 +597,67 @@ iroha::expected::Result<void, std::string> PgConnectionInit::createSchema(
   }
 }
 
+iroha::expected::Result<void, std::string>
+PgConnectionInit::migrateHashIndexesToBinary(soci::session &session) {
+  try {
+    std::string hash_column_type;
+    session << "SELECT data_type FROM information_schema.columns "
+               "WHERE table_name = 'tx_positions' AND column_name = 'hash'",
+        soci::into(hash_column_type);
+    if (hash_column_type == "bytea") {
+      return expected::Value<void>();
+    }
+    // rewrites the tables and their indexes; runs once per ledger on the
+    // first start of a binary with the bytea schema
+    session << "ALTER TABLE tx_positions "
+               "ALTER COLUMN hash TYPE bytea USING decode(hash, 'hex')";
+    session << "ALTER TABLE tx_status_by_hash "
+               "ALTER COLUMN hash TYPE bytea USING decode(hash, 'hex')";
+  } catch (std::exception &e) {
+    return iroha::expected::makeError(
+        std::string{"Failed to migrate hash columns to binary: "}
+        + formatPostgresMessage(e.what()));
+  }
+  return expected::Value<void>();
+}
+
+iroha::expected::Result<void, std::string>
+PgConnectionInit::addAssetsCountColumn(soci::session &session) {
+  try {
+    // runs once per ledger on the first start of a binary which keeps
+    // the per-account asset counts denormalized in account; the
+    // backfill brings the counts of the existing accounts in line
+    session << "ALTER TABLE account "
+               "ADD COLUMN IF NOT EXISTS assets_count bigint NOT NULL "
+               "DEFAULT 0";
+    session << "UPDATE account SET assets_count = c.cnt "
+               "FROM (SELECT account_id, count(1) AS cnt "
+               "FROM account_has_asset GROUP BY account_id) c "
+               "WHERE account.account_id = c.account_id";
+  } catch (std::exception &e) {
+    return iroha::expected::makeError(
+        std::string{"Failed to add the assets count column: "}
+        + formatPostgresMessage(e.what()));
+  }
+  return expected::Value<void>();
+}
+
+iroha::expected::Result<void, std::string>
+PgConnectionInit::createTimeWindowIndex(soci::session &session) {
+  try {
+    // runs once per ledger on the first start of a binary with the
+    // time-window pushdown in the account transaction queries
+    session << "CREATE INDEX IF NOT EXISTS "
+               "tx_positions_creator_id_asset_ts_index "
+               "ON tx_positions (creator_id, asset_id, ts)";
+  } catch (std::exception &e) {
+    return iroha::expected::makeError(
+        std::string{"Failed to create the time window index: "}
+        + formatPostgresMessage(e.what()));
+  }
+  return expected::Value<void>();
+}
+
 iroha::expected::Result<void, std::string> PgConnectionInit::resetPeers(
     soci::session &sql) {
   try {
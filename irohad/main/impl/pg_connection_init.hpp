@@ -34,7 +34,8 @@ namespace iroha {
                               std::string>
       init(StartupWsvDataPolicy startup_wsv_data_policy,
            iroha::ametsuchi::PostgresOptions const &pg_opt,
-           logger::LoggerManagerTreePtr log_manager);
+           logger::LoggerManagerTreePtr log_manager,
+           std::vector<std::string> const &replica_conn_opts = {});
 
       static expected::Result<void, std::string> prepareWorkingDatabase(
           StartupWsvDataPolicy startup_wsv_data_policy,
@@ -45,7 +46,8 @@ namespace iroha {
           const ReconnectionStrategyFactory &reconnection_strategy_factory,
           const PostgresOptions &options,
           const int pool_size,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          std::vector<std::string> const &replica_conn_opts = {});
 
       /**
        * Verify whether postgres supports prepared transactions
@@ -71,6 +73,31 @@ namespace iroha {
       /// Create tables in the given session. Left public for tests.
       static void prepareTables(soci::session &session);
 
+      /**
+       * Converts the hex text hash columns of tx_positions and
+       * tx_status_by_hash of an existing ledger to bytea. Does nothing when
+       * the columns are binary already. Left public for tests.
+       */
+      static expected::Result<void, std::string> migrateHashIndexesToBinary(
+          soci::session &session);
+
+      /**
+       * Creates the composite (creator, asset, created time) index of
+       * tx_positions on an existing ledger, which serves the account
+       * transaction queries with a time window pushed down. Does nothing
+       * when the index exists already. Left public for tests.
+       */
+      static expected::Result<void, std::string> createTimeWindowIndex(
+          soci::session &session);
+
+      /**
+       * Adds the denormalized assets_count column to account on an
+       * existing ledger and backfills it from account_has_asset. Does
+       * nothing when the column exists already. Left public for tests.
+       */
+      static expected::Result<void, std::string> addAssetsCountColumn(
+          soci::session &session);
+
       /**
        * Creates schema. Working database must not exist when calling this.
        * @return void value in case of success or an error message otherwise.
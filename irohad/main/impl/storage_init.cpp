@@ -36,9 +36,12 @@ class StorageInitException : public std::runtime_error {
 namespace {
   std::unique_ptr<BlockStorage> makeFlatFileBlockStorage(
       std::string const &block_storage_dir,
+      FlatFileSyncPolicy block_store_sync_policy,
       logger::LoggerManagerTreePtr log_manager) {
-    auto flat_file = FlatFile::create(
-        block_storage_dir, log_manager->getChild("FlatFile")->getLogger());
+    auto flat_file =
+        FlatFile::create(block_storage_dir,
+                         log_manager->getChild("FlatFile")->getLogger(),
+                         block_store_sync_policy);
     if (auto err = iroha::expected::resultToOptionalError(flat_file)) {
       throw StorageInitException{err.value()};
     }
@@ -84,9 +87,11 @@ iroha::initStorage(
     std::shared_ptr<shared_model::interface::QueryResponseFactory>
         query_response_factory,
     boost::optional<std::string> block_storage_dir,
+    iroha::ametsuchi::FlatFileSyncPolicy block_store_sync_policy,
     std::optional<std::reference_wrapper<const iroha::ametsuchi::VmCaller>>
         vm_caller_ref,
-    logger::LoggerManagerTreePtr log_manager) {
+    logger::LoggerManagerTreePtr log_manager,
+    iroha::ametsuchi::IndexRetentionPolicy index_retention_policy) {
   try {
     auto perm_converter =
         std::make_shared<shared_model::proto::ProtoPermissionToString>();
@@ -107,7 +112,8 @@ iroha::initStorage(
             log_manager->getChild("TemporaryBlockStorage")->getLogger());
 
     auto persistent_block_storage = block_storage_dir
-        ? makeFlatFileBlockStorage(block_storage_dir.value(), log_manager)
+        ? makeFlatFileBlockStorage(
+              block_storage_dir.value(), block_store_sync_policy, log_manager)
         : makePostgresBlockStorage(
               pool_wrapper, block_transport_factory, log_manager);
     return StorageImpl::create(pg_opt,
@@ -118,7 +124,9 @@ iroha::initStorage(
                                std::move(temporary_block_storage_factory),
                                std::move(persistent_block_storage),
                                vm_caller_ref,
-                               log_manager->getChild("Storage"));
+                               log_manager->getChild("Storage"),
+                               10,
+                               index_retention_policy);
   } catch (StorageInitException const &e) {
     return iroha::expected::makeError(
         fmt::format("Storage initialization failed: ", e.what()));
@@ -12,6 +12,8 @@
 #include <string>
 
 #include <boost/optional/optional_fwd.hpp>
+#include "ametsuchi/impl/flat_file/flat_file_sync_policy.hpp"
+#include "ametsuchi/impl/index_retention.hpp"
 #include "common/result_fwd.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
@@ -38,9 +40,11 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::QueryResponseFactory>
           query_response_factory,
       boost::optional<std::string> block_storage_dir,
+      iroha::ametsuchi::FlatFileSyncPolicy block_store_sync_policy,
       std::optional<std::reference_wrapper<const iroha::ametsuchi::VmCaller>>
           vm_caller_ref,
-      logger::LoggerManagerTreePtr log_manager);
+      logger::LoggerManagerTreePtr log_manager,
+      iroha::ametsuchi::IndexRetentionPolicy index_retention_policy = {});
 }  // namespace iroha
 
 #endif
@@ -0,0 +1,31 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "main/subsystem_registry.hpp"
+
+#include "ametsuchi/vm_caller.hpp"
+
+#if defined(USE_BURROW)
+#include "ametsuchi/impl/burrow_vm_caller.hpp"
+#endif
+
+namespace iroha {
+
+  // registration happens in an ordinary function instead of static
+  // initializers in the engine translation units: an archive member
+  // nothing references is dropped by the linker together with its
+  // initializers
+  void registerCompiledSubsystems() {
+#if defined(USE_BURROW)
+    SubsystemRegistry<ametsuchi::VmCaller>::instance().add(
+        kBurrowVmCallerName,
+        [] { return std::make_unique<ametsuchi::BurrowVmCaller>(); });
+#endif
+    // the ursa ed25519 provider stays a compile-time choice inside the
+    // crypto verifier: signature checks run per transaction and are
+    // dispatched there without an indirection
+  }
+
+}  // namespace iroha
@@ -7,8 +7,12 @@
 
 namespace config_members {
   const char *BlockStorePath = "block_store_path";
+  const char *BlockStoreFsyncBlocks = "block_store_fsync_blocks";
+  const char *BlockStoreFsyncIntervalMs = "block_store_fsync_interval_ms";
+  const char *TrustedSyncValidation = "trusted_sync_validation";
   const char *ToriiPort = "torii_port";
   const char *ToriiTlsParams = "torii_tls_params";
+  const char *ToriiUnixSocket = "torii_unix_socket";
   const char *InterPeerTls = "inter_peer_tls";
   const char *PeerCertProvider = "peer_certificates";
   const char *RootCert = "root_certificate";
@@ -18,7 +22,12 @@ namespace config_members {
   const char *InternalPort = "internal_port";
   const char *KeyPairPath = "key_pair_path";
   const char *PgOpt = "pg_opt";
+  const char *ReplicaPgOpts = "replica_pg_opts";
   const char *DbConfig = "database";
+  const char *TxIndexRetentionBlocks = "tx_index_retention_blocks";
+  const char *RestoreParallelSessions = "restore_parallel_sessions";
+  const char *kDbTypePostgres = "postgres";
+  const char *kDbTypeRocksDb = "rocksdb";
   const char *Host = "host";
   const char *Ip = "ip";
   const char *Port = "port";
@@ -27,6 +36,7 @@ namespace config_members {
   const char *WorkingDbName = "working database";
   const char *MaintenanceDbName = "maintenance database";
   const char *MaxProposalSize = "max_proposal_size";
+  const char *MaxProposalBytes = "max_proposal_bytes";
   const char *ProposalDelay = "proposal_delay";
   const char *VoteDelay = "vote_delay";
   const char *MstSupport = "mst_enable";
@@ -36,6 +46,7 @@ namespace config_members {
   const char *LogSection = "log";
   const char *LogLevel = "level";
   const char *LogPatternsSection = "patterns";
+  const char *LogAsync = "async";
   const char *LogChildrenSection = "children";
   const std::unordered_map<std::string, logger::LogLevel> LogLevels{
       {"trace", logger::LogLevel::kTrace},
@@ -49,6 +60,13 @@ namespace config_members {
   const char *InitialPeers = "initial_peers";
   const char *TlsCertificatePath = "tls_certificate_path";
   const char *UtilityService = "utility_service";
+  const char *MetricsPort = "metrics_port";
+  const char *AsyncClientCqCount = "async_client_cq_count";
+  const char *ThreadAffinity = "thread_affinity";
+  const char *GrpcCompression = "grpc_compression";
+  const char *Zone = "zone";
+  const char *PeerZones = "peer_zones";
+  const char *MemoryBudgetMb = "memory_budget_mb";
   const char *kCrypto = "crypto";
   const char *kProviders = "providers";
   const char *kCryptoType = "crypto_type";
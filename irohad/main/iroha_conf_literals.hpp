@@ -13,8 +13,12 @@
 
 namespace config_members {
   extern const char *BlockStorePath;
+  extern const char *BlockStoreFsyncBlocks;
+  extern const char *BlockStoreFsyncIntervalMs;
+  extern const char *TrustedSyncValidation;
   extern const char *ToriiPort;
   extern const char *ToriiTlsParams;
+  extern const char *ToriiUnixSocket;
   extern const char *InterPeerTls;
   extern const char *PeerCertProvider;
   extern const char *RootCert;
@@ -24,7 +28,12 @@ namespace config_members {
   extern const char *InternalPort;
   extern const char *KeyPairPath;
   extern const char *PgOpt;
+  extern const char *ReplicaPgOpts;
   extern const char *DbConfig;
+  extern const char *TxIndexRetentionBlocks;
+  extern const char *RestoreParallelSessions;
+  extern const char *kDbTypePostgres;
+  extern const char *kDbTypeRocksDb;
   extern const char *Host;
   extern const char *Ip;
   extern const char *Port;
@@ -33,6 +42,7 @@ namespace config_members {
   extern const char *WorkingDbName;
   extern const char *MaintenanceDbName;
   extern const char *MaxProposalSize;
+  extern const char *MaxProposalBytes;
   extern const char *ProposalDelay;
   extern const char *VoteDelay;
   extern const char *MstSupport;
@@ -42,6 +52,7 @@ namespace config_members {
   extern const char *LogSection;
   extern const char *LogLevel;
   extern const char *LogPatternsSection;
+  extern const char *LogAsync;
   extern const char *LogChildrenSection;
   extern const std::unordered_map<std::string, logger::LogLevel> LogLevels;
   extern const char *InitialPeers;
@@ -49,6 +60,13 @@ namespace config_members {
   extern const char *PublicKey;
   extern const char *TlsCertificatePath;
   extern const char *UtilityService;
+  extern const char *MetricsPort;
+  extern const char *AsyncClientCqCount;
+  extern const char *ThreadAffinity;
+  extern const char *GrpcCompression;
+  extern const char *Zone;
+  extern const char *PeerZones;
+  extern const char *MemoryBudgetMb;
   extern const char *kCrypto;
   extern const char *kProviders;
   extern const char *kCryptoType;
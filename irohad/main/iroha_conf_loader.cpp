@@ -97,25 +97,15 @@ inline logger::LogLevel getLogLevel(std::string level_str,
   return it->second;
 }
 
-std::string makeEnvDictChildKey(std::string_view base_path,
-                                std::string_view child_key) {
-  std::string child_key_upper;
-  std::transform(child_key.begin(),
-                 child_key.end(),
-                 std::back_inserter(child_key_upper),
-                 ::toupper);
-  return base_path.empty() ? child_key_upper
-                           : fmt::format("{}_{}", base_path, child_key_upper);
-}
-
-template <typename T, typename = decltype(std::to_string(std::declval<T>()))>
-std::string makeEnvDictChildKey(std::string_view base_path,
-                                T const &child_key) {
-  return makeEnvDictChildKey(base_path, std::to_string(child_key));
-}
-
 /**
  * A class for reading a structure from a JSON node.
+ *
+ * The diagnostic path and the environment variable name of a node are not
+ * assembled eagerly: a node only remembers its own path component and a
+ * pointer to the node it was created from, and the full strings are built
+ * by walking that chain when an error is reported or an environment
+ * lookup is actually performed. Nodes are used within the full expression
+ * which created them, so every ancestor outlives its children.
  */
 class JsonDeserializerImpl {
  public:
@@ -125,9 +115,8 @@ class JsonDeserializerImpl {
       std::optional<ConstJsonValRef> json,
       std::optional<logger::LoggerPtr> log)
       : common_objects_factory_(std::move(common_objects_factory)),
-        env_path_(kEnvVarPrefix),
+        env_component_(kEnvVarPrefix),
         json_(json),
-        printable_path_(""),
         log_(std::move(log)) {}
 
   /**
@@ -147,23 +136,23 @@ class JsonDeserializerImpl {
 
  private:
   JsonDeserializerImpl(
-      std::shared_ptr<shared_model::interface::CommonObjectsFactory>
-          common_objects_factory,
-      std::optional<std::string> env_path,
+      JsonDeserializerImpl const *parent,
+      std::optional<std::string> env_component,
       std::optional<ConstJsonValRef> json,
-      std::string printable_path,
+      std::string printable_component,
       std::optional<logger::LoggerPtr> log)
-      : common_objects_factory_(std::move(common_objects_factory)),
-        env_path_(std::move(env_path)),
+      : common_objects_factory_(parent->common_objects_factory_),
+        parent_(parent),
+        env_component_(std::move(env_component)),
         json_(json),
-        printable_path_(std::move(printable_path)),
+        printable_component_(std::move(printable_component)),
         log_(std::move(log)) {}
 
   JsonDeserializerImpl getDictChild(std::string const &key) {
     return JsonDeserializerImpl{
-        common_objects_factory_,
-        env_path_ ? std::make_optional(makeEnvDictChildKey(key))
-                  : std::nullopt,
+        this,
+        env_component_ ? std::make_optional(envComponentFromKey(key))
+                       : std::nullopt,
         json_ | [&](auto const &json) -> std::optional<ConstJsonValRef> {
           assert_fatal(json_->get().IsObject(), "must be a JSON object.");
           auto const json_obj = json_->get().GetObject();
@@ -177,20 +166,46 @@ class JsonDeserializerImpl {
         log_};
   }
 
+  /// the full diagnostic path of this node, built on demand
+  std::string printablePath() const {
+    std::string path;
+    appendPrintablePath(path);
+    return path;
+  }
+
+  void appendPrintablePath(std::string &path) const {
+    if (parent_) {
+      parent_->appendPrintablePath(path);
+    }
+    path += printable_component_;
+  }
+
+  /// the full environment variable name of this node, built on demand
+  std::string envPath() const {
+    assert(env_component_);
+    if (not parent_) {
+      return env_component_.value();
+    }
+    return fmt::format("{}_{}", parent_->envPath(), env_component_.value());
+  }
+
   template <typename T>
   std::string makePrintableDictChildKey(T const &child_key) {
-    return fmt::format("{}/{}", printable_path_, child_key);
+    return fmt::format("/{}", child_key);
   }
 
-  template <typename T>
-  std::string makeEnvDictChildKey(T const &child_key) {
-    assert(env_path_);
-    return ::makeEnvDictChildKey(env_path_.value(), child_key);
+  static std::string envComponentFromKey(std::string_view key) {
+    std::string component;
+    std::transform(key.begin(),
+                   key.end(),
+                   std::back_inserter(component),
+                   ::toupper);
+    return component;
   }
 
   template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
   std::string makePrintableArrayElemPath(T const &index) {
-    return fmt::format("{}[{}]", printable_path_, index);
+    return fmt::format("[{}]", index);
   }
 
   template <typename F>
@@ -201,7 +216,7 @@ class JsonDeserializerImpl {
       for (const auto &child_json : json_obj) {
         auto const key = child_json.name.GetString();
         f(key,
-          JsonDeserializerImpl{common_objects_factory_,
+          JsonDeserializerImpl{this,
                                std::nullopt,
                                child_json.value,
                                makePrintableDictChildKey(key),
@@ -209,12 +224,11 @@ class JsonDeserializerImpl {
       }
       return true;
     }
-    if (env_path_) {
+    if (env_component_) {
       bool have_dict = false;
+      auto const env_path = envPath();
       for (int i = 0;; ++i) {
-        auto array_el_env_val_prefix = makeEnvDictChildKey(i);
-        auto array_el_env_key_key =
-            fmt::format("{}_KEY", array_el_env_val_prefix);
+        auto array_el_env_key_key = fmt::format("{}_{}_KEY", env_path, i);
         auto array_el_env_key_val = ::getOptEnvRaw(array_el_env_key_key, log_);
         if (not array_el_env_key_val) {
           break;
@@ -222,8 +236,8 @@ class JsonDeserializerImpl {
         have_dict = true;
         f(array_el_env_key_val.value(),
           JsonDeserializerImpl{
-              common_objects_factory_,
-              array_el_env_val_prefix,
+              this,
+              std::to_string(i),
               std::nullopt,
               makePrintableDictChildKey(array_el_env_key_val.value()),
               log_});
@@ -239,7 +253,9 @@ class JsonDeserializerImpl {
    * @param error - error message
    */
   inline void assert_fatal(bool condition, std::string error) {
-    ::assert_fatal(condition, printable_path_, error);
+    if (!condition) {
+      ::assert_fatal(false, printablePath(), error);
+    }
   }
 
   // ------------ loadInto(path, dst, src) ------------
@@ -263,10 +279,11 @@ class JsonDeserializerImpl {
   }
 
   std::optional<std::string> getOptEnvRaw() const {
-    return env_path_ | [this](auto const &env_path) {
-      return ::getOptEnvRaw(env_path.c_str(), log_) | [](std::string_view val) {
-        return std::make_optional(std::string{val});
-      };
+    if (not env_component_) {
+      return std::nullopt;
+    }
+    return ::getOptEnvRaw(envPath().c_str(), log_) | [](std::string_view val) {
+      return std::make_optional(std::string{val});
     };
   }
 
@@ -360,7 +377,7 @@ class JsonDeserializerImpl {
       assert_fatal(json_->get().IsArray(), "must be an array.");
       const auto arr = json_->get().GetArray();
       for (size_t i = 0; i < arr.Size(); ++i) {
-        load_elem(JsonDeserializerImpl{common_objects_factory_,
+        load_elem(JsonDeserializerImpl{this,
                                        std::nullopt,
                                        arr[i],
                                        makePrintableArrayElemPath(i),
@@ -368,11 +385,10 @@ class JsonDeserializerImpl {
       }
       return true;  // empty vector in JSON is loaded
     }
-    if (env_path_) {
+    if (env_component_) {
       for (int i = 0;; ++i) {
-        auto array_el_env_key_prefix = makeEnvDictChildKey(i);
-        if (not load_elem(JsonDeserializerImpl{common_objects_factory_,
-                                               array_el_env_key_prefix,
+        if (not load_elem(JsonDeserializerImpl{this,
+                                               std::to_string(i),
                                                std::nullopt,
                                                makePrintableArrayElemPath(i),
                                                log_})) {
@@ -448,9 +464,15 @@ class JsonDeserializerImpl {
 
   std::shared_ptr<shared_model::interface::CommonObjectsFactory>
       common_objects_factory_;
-  std::optional<std::string> env_path_;
+  // the node this one was created from; ancestors outlive their children,
+  // see the class comment
+  JsonDeserializerImpl const *parent_{nullptr};
+  // own component of the environment variable name; nullopt disables
+  // environment lookups for this node and everything below it
+  std::optional<std::string> env_component_;
   std::optional<ConstJsonValRef> json_;
-  std::string printable_path_;
+  // own component of the diagnostic path, with a leading separator
+  std::string printable_component_;
   std::optional<logger::LoggerPtr> log_;
 };
 
@@ -475,7 +497,7 @@ inline bool JsonDeserializerImpl::loadInto(logger::LogLevel &dest) {
   if (not loadInto(level_str)) {
     return false;
   }
-  dest = getLogLevel(level_str, printable_path_);
+  dest = getLogLevel(level_str, printablePath());
   return true;
 }
 
@@ -485,7 +507,7 @@ inline bool JsonDeserializerImpl::loadInto(logger::LogPatterns &dest) {
       [&](std::string_view level, JsonDeserializerImpl pattern_raw) {
         std::string pattern_str;
         pattern_raw.loadInto(pattern_str);
-        dest.setPattern(getLogLevel(std::string{level}, printable_path_),
+        dest.setPattern(getLogLevel(std::string{level}, printablePath()),
                         pattern_str);
       });
 }
@@ -554,7 +576,7 @@ JsonDeserializerImpl::loadInto<std::shared_ptr<shared_model::interface::Peer>>(
                [&](const auto &e) {
                  throw ConfigParsingException{
                      fmt::format("Error reading file specified in {}: {}",
-                                 printable_path_,
+                                 printablePath(),
                                  e.error)};
                });
   }
@@ -568,7 +590,7 @@ JsonDeserializerImpl::loadInto<std::shared_ptr<shared_model::interface::Peer>>(
              [&](const auto &error) {
                throw ConfigParsingException(
                    fmt::format("Failed to create a peer at {}: {}",
-                               printable_path_,
+                               printablePath(),
                                error.error));
              });
 
@@ -613,6 +635,20 @@ inline bool JsonDeserializerImpl::loadInto(IrohadConfig::InterPeerTls &dest) {
 
 template <>
 inline bool JsonDeserializerImpl::loadInto(IrohadConfig::DbConfig &dest) {
+  dest.type = getOptValByKey<std::string>(config_members::Type)
+                  .value_or(config_members::kDbTypePostgres);
+  // the embedded rocksdb engine is built behind USE_ROCKSDB but is not
+  // wired into storage initialization yet; accepting the value here would
+  // only defer the failure to a misleading postgres connection error
+  assert_fatal(dest.type != config_members::kDbTypeRocksDb,
+               fmt::format("database type `{}' is not wired into storage "
+                           "initialization yet: use `{}'",
+                           config_members::kDbTypeRocksDb,
+                           config_members::kDbTypePostgres));
+  assert_fatal(dest.type == config_members::kDbTypePostgres,
+               fmt::format("wrong database type `{}': must be `{}'",
+                           dest.type,
+                           config_members::kDbTypePostgres));
   return getDictChild(config_members::Host).loadInto(dest.host)
       and getDictChild(config_members::Port).loadInto(dest.port)
       and getDictChild(config_members::User).loadInto(dest.user)
@@ -676,13 +712,26 @@ template <>
 inline bool JsonDeserializerImpl::loadInto(IrohadConfig &dest) {
   using namespace config_members;
   return getDictChild(BlockStorePath).loadInto(dest.block_store_path)
+      and getDictChild(BlockStoreFsyncBlocks)
+              .loadInto(dest.block_store_fsync_blocks)
+      and getDictChild(BlockStoreFsyncIntervalMs)
+              .loadInto(dest.block_store_fsync_interval_ms)
+      and getDictChild(TrustedSyncValidation)
+              .loadInto(dest.trusted_sync_validation)
       and getDictChild(ToriiPort).loadInto(dest.torii_port)
       and getDictChild(ToriiTlsParams).loadInto(dest.torii_tls_params)
+      and getDictChild(ToriiUnixSocket).loadInto(dest.torii_unix_socket)
       and getDictChild(InterPeerTls).loadInto(dest.inter_peer_tls)
       and getDictChild(InternalPort).loadInto(dest.internal_port)
       and getDictChild(DbConfig).loadInto(dest.database_config)
       and (dest.database_config or getDictChild(PgOpt).loadInto(dest.pg_opt))
+      and getDictChild(ReplicaPgOpts).loadInto(dest.replica_pg_opts)
+      and getDictChild(TxIndexRetentionBlocks)
+              .loadInto(dest.tx_index_retention_blocks)
+      and getDictChild(RestoreParallelSessions)
+              .loadInto(dest.restore_parallel_sessions)
       and getDictChild(MaxProposalSize).loadInto(dest.max_proposal_size)
+      and getDictChild(MaxProposalBytes).loadInto(dest.max_proposal_bytes)
       and getDictChild(ProposalDelay).loadInto(dest.proposal_delay)
       and getDictChild(VoteDelay).loadInto(dest.vote_delay)
       and getDictChild(MstSupport).loadInto(dest.mst_support)
@@ -693,6 +742,14 @@ inline bool JsonDeserializerImpl::loadInto(IrohadConfig &dest) {
       and getDictChild(LogSection).loadInto(dest.logger_manager)
       and getDictChild(InitialPeers).loadInto(dest.initial_peers)
       and getDictChild(UtilityService).loadInto(dest.utility_service)
+      and getDictChild(MetricsPort).loadInto(dest.metrics_port)
+      and getDictChild(AsyncClientCqCount)
+              .loadInto(dest.async_client_cq_count)
+      and getDictChild(ThreadAffinity).loadInto(dest.thread_affinity)
+      and getDictChild(GrpcCompression).loadInto(dest.grpc_compression)
+      and getDictChild(Zone).loadInto(dest.zone)
+      and getDictChild(PeerZones).loadInto(dest.peer_zones)
+      and getDictChild(MemoryBudgetMb).loadInto(dest.memory_budget_mb)
       and getDictChild(kCrypto).loadInto(dest.crypto);
 }
 
@@ -727,6 +784,7 @@ bool JsonDeserializerImpl::addChildrenLoggerConfigs(
 void JsonDeserializerImpl::updateLoggerConfig(logger::LoggerConfig &cfg) {
   getDictChild(config_members::LogLevel).loadInto(cfg.log_level);
   getDictChild(config_members::LogPatternsSection).loadInto(cfg.patterns);
+  getDictChild(config_members::LogAsync).loadInto(cfg.async);
 }
 
 void reportJsonParsingError(const rapidjson::Document &doc,
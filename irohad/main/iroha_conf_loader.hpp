@@ -8,6 +8,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "common/result_fwd.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
@@ -19,12 +20,18 @@
 
 struct IrohadConfig {
   struct DbConfig {
+    // "postgres" (default); "rocksdb" is rejected at config load until
+    // the embedded engine is wired into storage initialization
+    std::string type;
     std::string host;
     uint16_t port;
     std::string user;
     std::string password;
     std::string working_dbname;
     std::string maintenance_dbname;
+    // path to the embedded database directory, reserved for the future
+    // "rocksdb" type
+    std::string path;
   };
 
   struct InterPeerTls {
@@ -47,15 +54,45 @@ struct IrohadConfig {
   // TODO: block_store_path is now optional, change docs IR-576
   // luckychess 29.06.2019
   boost::optional<std::string> block_store_path;
+  // group-commit durability of the flat file block store: number of
+  // appended blocks and longest time in milliseconds between fsync
+  // barriers; every block is fsynced on append when not set
+  boost::optional<uint32_t> block_store_fsync_blocks;
+  boost::optional<uint32_t> block_store_fsync_interval_ms;
+  // validate blocks downloaded during synchronization with the certified
+  // profile: their supermajority commit signatures are verified, the
+  // stateless re-validation of every contained transaction is skipped
+  boost::optional<bool> trusted_sync_validation;
   uint16_t torii_port;
   boost::optional<iroha::torii::TlsParams> torii_tls_params;
+  // path of a unix domain socket serving the torii API in addition to the
+  // TCP listener; lets co-located clients skip the localhost TCP stack
+  boost::optional<std::string> torii_unix_socket;
   boost::optional<InterPeerTls> inter_peer_tls;
   uint16_t internal_port;
   boost::optional<std::string>
       pg_opt;  // TODO 2019.06.26 mboldyrev IR-556 remove
+  // connection strings of read-replica databases which serve torii queries
+  boost::optional<std::vector<std::string>> replica_pg_opts;
   boost::optional<DbConfig>
       database_config;  // TODO 2019.06.26 mboldyrev IR-556 make required
+  // number of most recent blocks whose transaction position index rows
+  // are kept; older rows are pruned in the background and history
+  // queries reaching below the window are refused with an explicit
+  // error; the whole history is indexed when not set
+  boost::optional<uint32_t> tx_index_retention_blocks;
+  // number of database sessions applying independent transactions
+  // concurrently when the WSV is rebuilt from scratch; those sessions
+  // autocommit, so an interrupted parallel restore has to be restarted
+  // with a dropped WSV; sequential, fully transactional restore when
+  // not set
+  boost::optional<uint32_t> restore_parallel_sessions;
   uint32_t max_proposal_size;
+  // serialized size cap of the transactions packed into one proposal, in
+  // bytes; keeps the round time stable when the transaction count cap
+  // alone would admit proposals of maximal-size transactions; no byte
+  // cap when not set
+  boost::optional<uint32_t> max_proposal_bytes;
   uint32_t proposal_delay;
   uint32_t vote_delay;
   bool mst_support;
@@ -65,6 +102,35 @@ struct IrohadConfig {
   boost::optional<logger::LoggerManagerTreePtr> logger_manager;
   boost::optional<shared_model::interface::types::PeerList> initial_peers;
   boost::optional<UtilityService> utility_service;
+  // port of the Prometheus scrape endpoint; disabled when not set
+  boost::optional<uint16_t> metrics_port;
+  // number of completion queues and polling threads of the async gRPC
+  // client; one queue when not set
+  boost::optional<uint16_t> async_client_cq_count;
+  // pipeline stage name ("torii", "consensus", "storage", "scheduler") to
+  // list of CPUs
+  // the worker threads of that stage are pinned to; keeps a stage on one
+  // NUMA node on multi-socket hosts, no pinning when not set
+  boost::optional<std::unordered_map<std::string, std::vector<uint16_t>>>
+      thread_affinity;
+  // gRPC service full name to compression algorithm ("gzip" or "deflate")
+  // for the channels of that service; overrides the built-in defaults
+  // (block loader and MST state transfer compressed, consensus votes not)
+  boost::optional<std::unordered_map<std::string, std::string>>
+      grpc_compression;
+  // failure-domain (zone or region) label of this node; block sync and
+  // MST gossip prefer peers labeled with the same zone for bulk
+  // transfer, consensus traffic stays uniformly randomized; no
+  // preference when not set
+  boost::optional<std::string> zone;
+  // peer public key (hex) to failure-domain label; peers missing from
+  // the map are treated as remote
+  boost::optional<std::unordered_map<std::string, std::string>> peer_zones;
+  // combined budget in megabytes for the pipeline caches (ordering round
+  // cache, MST state, pending transactions, status cache); when exceeded
+  // torii sheds new batches with a retryable status instead of letting
+  // the node grow until the OOM killer ends it; no limit when not set
+  boost::optional<uint64_t> memory_budget_mb;
 
   // This is a part of cryto providers feature:
   // https://github.com/MBoldyrev/iroha/tree/feature/hsm-utimaco.
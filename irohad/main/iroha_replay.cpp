@@ -0,0 +1,220 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Offline replay tool: re-executes a block range from a flat file block
+ * store against a scratch WSV and prints per-command-type timing
+ * statistics, so commit-path performance can be profiled in isolation
+ * from consensus and networking.
+ *
+ * Usage:
+ *   iroha_replay --pg_opt "host=localhost port=5432 user=postgres ..." \
+ *       --block_store_path /var/iroha/blocks [--from 1] [--to 0]
+ *
+ * The working database named iroha_replay_wsv is dropped and recreated on
+ * every run; the block store is only read.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <fmt/core.h>
+#include <gflags/gflags.h>
+#include <boost/core/demangle.hpp>
+
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/flat_file_block_storage.hpp"
+#include "ametsuchi/impl/pool_wrapper.hpp"
+#include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/postgres_options.hpp"
+#include "ametsuchi/impl/postgres_specific_query_executor.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "backend/protobuf/proto_query_response_factory.hpp"
+#include "common/result.hpp"
+#include "common/visitor.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "main/impl/pending_transaction_storage_init.hpp"
+#include "main/impl/pg_connection_init.hpp"
+
+DEFINE_string(pg_opt, "", "Postgres connection options string");
+DEFINE_string(block_store_path, "", "Path of the flat file block store");
+DEFINE_uint64(from, 1, "First height to replay");
+DEFINE_uint64(to, 0, "Last height to replay; 0 means up to the top block");
+
+using namespace iroha;
+using namespace iroha::ametsuchi;
+using namespace std::chrono;
+
+namespace {
+  /// timings of one command type, microseconds
+  struct CommandStats {
+    std::vector<double> durations_us;
+    double total_us{0};
+
+    void add(double duration_us) {
+      durations_us.push_back(duration_us);
+      total_us += duration_us;
+    }
+
+    double percentile(double quantile) const {
+      auto index =
+          static_cast<size_t>(quantile * (durations_us.size() - 1));
+      return durations_us[index];
+    }
+  };
+
+  /// "shared_model::interface::AddPeer" -> "AddPeer"
+  std::string commandName(const shared_model::interface::Command &command) {
+    auto name = iroha::visit_in_place(command.get(), [](const auto &specific) {
+      return boost::core::demangle(typeid(specific).name());
+    });
+    auto pos = name.rfind(':');
+    return pos == std::string::npos ? name : name.substr(pos + 1);
+  }
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  gflags::SetUsageMessage(
+      "replay a block range against a scratch WSV and report per-command "
+      "timings");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  gflags::ShutDownCommandLineFlags();
+
+  auto log_manager = std::make_shared<logger::LoggerManagerTree>(
+                         logger::LoggerConfig{logger::LogLevel::kWarn,
+                                              logger::getDefaultLogPatterns()})
+                         ->getChild("Replay");
+  auto log = log_manager->getChild("Main")->getLogger();
+
+  if (FLAGS_pg_opt.empty() or FLAGS_block_store_path.empty()) {
+    log->error("both --pg_opt and --block_store_path are required");
+    return EXIT_FAILURE;
+  }
+
+  // source blocks; never written to
+  auto flat_file = FlatFile::create(
+      FLAGS_block_store_path, log_manager->getChild("FlatFile")->getLogger());
+  if (auto e = expected::resultToOptionalError(flat_file)) {
+    log->error("cannot open block store: {}", e.value());
+    return EXIT_FAILURE;
+  }
+  FlatFileBlockStorage block_storage(
+      std::move(flat_file).assumeValue(),
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+      log_manager->getChild("FlatFileBlockStorage")->getLogger());
+
+  // scratch WSV, always recreated from nothing
+  PostgresOptions pg_opt(FLAGS_pg_opt, "iroha_replay_wsv", log);
+  auto pool_wrapper = PgConnectionInit::init(
+      StartupWsvDataPolicy::kDrop, pg_opt, log_manager);
+  if (auto e = expected::resultToOptionalError(pool_wrapper)) {
+    log->error("database initialization failed: {}", e.value());
+    return EXIT_FAILURE;
+  }
+
+  auto perm_converter =
+      std::make_shared<shared_model::proto::ProtoPermissionToString>();
+  auto sql = std::make_unique<soci::session>(
+      *pool_wrapper.assumeValue()->connection_pool_);
+  auto &sql_ref = *sql;
+  PostgresCommandExecutor executor(
+      std::move(sql),
+      perm_converter,
+      std::make_shared<PostgresSpecificQueryExecutor>(
+          sql_ref,
+          block_storage,
+          PendingTransactionStorageInit().createPendingTransactionsStorage(),
+          std::make_shared<shared_model::proto::ProtoQueryResponseFactory>(),
+          perm_converter,
+          log_manager->getChild("SpecificQueryExecutor")->getLogger()),
+      std::nullopt);
+
+  std::map<std::string, CommandStats> stats;
+  uint64_t blocks_replayed = 0, transactions_replayed = 0, failures = 0;
+  const auto replay_started_at = steady_clock::now();
+
+  for (auto height = FLAGS_from; FLAGS_to == 0 or height <= FLAGS_to;
+       ++height) {
+    auto block = block_storage.fetch(height);
+    if (not block) {
+      if (FLAGS_to != 0) {
+        log->error("block {} is missing in the block store", height);
+        return EXIT_FAILURE;
+      }
+      break;
+    }
+    for (const auto &transaction : (*block)->transactions()) {
+      const auto tx_hash = transaction.hash().hex();
+      shared_model::interface::types::CommandIndexType command_index = 0;
+      for (const auto &command : transaction.commands()) {
+        const auto started_at = steady_clock::now();
+        auto result = executor.execute(command,
+                                       transaction.creatorAccountId(),
+                                       tx_hash,
+                                       command_index++,
+                                       false);
+        stats[commandName(command)].add(
+            duration_cast<duration<double, std::micro>>(steady_clock::now()
+                                                        - started_at)
+                .count());
+        if (auto e = expected::resultToOptionalError(result)) {
+          ++failures;
+          log->warn("block {}, tx {}: {}", height, tx_hash, e->toString());
+        }
+      }
+      ++transactions_replayed;
+    }
+    ++blocks_replayed;
+  }
+
+  auto elapsed = duration_cast<duration<double>>(steady_clock::now()
+                                                 - replay_started_at)
+                     .count();
+  fmt::print("replayed {} block(s), {} transaction(s) in {:.2f}s",
+             blocks_replayed,
+             transactions_replayed,
+             elapsed);
+  if (failures != 0) {
+    fmt::print(", {} command(s) failed", failures);
+  }
+  fmt::print("\n\n{:<28}{:>8}{:>12}{:>10}{:>10}{:>10}{:>10}\n",
+             "command",
+             "count",
+             "total ms",
+             "mean us",
+             "p50 us",
+             "p99 us",
+             "max us");
+  // most expensive command types first
+  std::vector<std::pair<std::string, CommandStats *>> ordered;
+  for (auto &entry : stats) {
+    ordered.emplace_back(entry.first, &entry.second);
+  }
+  std::sort(ordered.begin(), ordered.end(), [](auto &lhs, auto &rhs) {
+    return lhs.second->total_us > rhs.second->total_us;
+  });
+  for (auto &entry : ordered) {
+    auto &command_stats = *entry.second;
+    std::sort(command_stats.durations_us.begin(),
+              command_stats.durations_us.end());
+    fmt::print("{:<28}{:>8}{:>12.1f}{:>10.1f}{:>10.1f}{:>10.1f}{:>10.1f}\n",
+               entry.first,
+               command_stats.durations_us.size(),
+               command_stats.total_us / 1000,
+               command_stats.total_us / command_stats.durations_us.size(),
+               command_stats.percentile(0.50),
+               command_stats.percentile(0.99),
+               command_stats.durations_us.back());
+  }
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
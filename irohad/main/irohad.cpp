@@ -17,7 +17,9 @@
 #include "common/files.hpp"
 #include "common/hexutils.hpp"
 #include "common/irohad_version.hpp"
+#include "common/memory_budget.hpp"
 #include "common/result.hpp"
+#include "common/thread_affinity.hpp"
 #include "crypto/keys_manager_impl.hpp"
 #include "cryptography/ed25519_sha3_impl/crypto_provider.hpp"
 #include "cryptography/private_key.hpp"
@@ -143,6 +145,41 @@ static shared_model::crypto::Keypair getKeypairFromConfig(
   }
 }
 
+/**
+ * Describe the crypto backend compiled into this binary together with the
+ * vector extensions of the CPU it landed on. The fleet mixes CPU
+ * generations while one binary is shipped everywhere, so the startup log
+ * makes it visible which machines could run a wider ed25519 build.
+ */
+static std::string describeCryptoBackend() {
+#if defined(USE_LIBURSA)
+  std::string description = "ed25519-ursa";
+#else
+  std::string description = "ed25519-sha3";
+#endif
+#if defined(__x86_64__) and (defined(__GNUC__) or defined(__clang__))
+  __builtin_cpu_init();
+  description += ", cpu extensions:";
+  bool any = false;
+  if (__builtin_cpu_supports("sse4.2")) {
+    description += " sse4.2";
+    any = true;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    description += " avx2";
+    any = true;
+  }
+  if (__builtin_cpu_supports("avx512f")) {
+    description += " avx512f";
+    any = true;
+  }
+  if (not any) {
+    description += " none";
+  }
+#endif
+  return description;
+}
+
 static shared_model::crypto::Keypair getKeypairFromFile(
     std::string const &keypair_name, logger::LoggerManagerTreePtr log_manager) {
   iroha::KeysManagerImpl keys_manager{
@@ -235,8 +272,24 @@ int main(int argc, char *argv[]) {
       log = log_manager->getChild("Init")->getLogger();
     }
     log->info("Irohad version: {}", iroha::kGitPrettyVersion);
+    log->info("crypto backend: {}", describeCryptoBackend());
     log->info("config initialized");
 
+    if (config.thread_affinity) {
+      // must precede Irohad construction so the pipeline worker threads
+      // see the mapping when they start
+      iroha::affinity::configureStages(config.thread_affinity.value());
+      log->info("thread affinity configured for {} pipeline stages",
+                config.thread_affinity->size());
+    }
+
+    if (config.memory_budget_mb) {
+      iroha::MemoryBudget::instance().setLimit(*config.memory_budget_mb * 1024
+                                               * 1024);
+      log->info("pipeline cache memory budget: {} MB",
+                *config.memory_budget_mb);
+    }
+
     if (config.initial_peers and config.initial_peers->empty()) {
       log->critical(
           "Got an empty initial peers list in configuration file. You have to "
@@ -298,7 +351,14 @@ int main(int argc, char *argv[]) {
         FLAGS_wait_for_new_blocks
             ? iroha::StartupWsvSynchronizationPolicy::kWaitForNewBlocks
             : iroha::StartupWsvSynchronizationPolicy::kSyncUpAndGo,
-        ::iroha::network::getDefaultChannelParams(),
+        [&] {
+          auto channel_params = ::iroha::network::getDefaultChannelParams();
+          if (config.grpc_compression) {
+            channel_params->service_compression =
+                config.grpc_compression.value();
+          }
+          return channel_params;
+        }(),
         boost::make_optional(config.mst_support,
                              iroha::GossipPropagationStrategyParams{}),
         boost::none);
@@ -18,6 +18,10 @@ namespace {
 
   const auto kPortBindError = "Cannot bind server to address %s";
 
+  /// all streams of the asynchronous services of one server multiplex
+  /// over this many completion queues, each polled by one thread
+  constexpr size_t kCompletionQueuePollers = 2;
+
   std::shared_ptr<grpc::ServerCredentials> createCredentials(
       const boost::optional<std::shared_ptr<const TlsCredentials>>
           &my_tls_creds) {
@@ -55,6 +59,12 @@ ServerRunner &ServerRunner::append(std::shared_ptr<grpc::Service> service) {
   return *this;
 }
 
+ServerRunner &ServerRunner::appendAsync(
+    std::shared_ptr<AsyncCqService> service) {
+  async_services_.push_back(service);
+  return *this;
+}
+
 iroha::expected::Result<int, std::string> ServerRunner::run() {
   grpc::ServerBuilder builder;
   int selected_port = 0;
@@ -69,6 +79,10 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
     builder.RegisterService(service.get());
   }
 
+  for (auto &service : async_services_) {
+    builder.RegisterService(&service->service());
+  }
+
   // in order to bypass built-it limitation of gRPC message size
   builder.SetMaxReceiveMessageSize(INT_MAX);
   builder.SetMaxSendMessageSize(INT_MAX);
@@ -76,6 +90,12 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
   // enable retry policy
   builder.AddChannelArgument(GRPC_ARG_ENABLE_RETRIES, 1);
 
+  if (not async_services_.empty()) {
+    for (size_t i = 0; i < kCompletionQueuePollers; ++i) {
+      queues_.push_back(builder.AddCompletionQueue());
+    }
+  }
+
   server_instance_ = builder.BuildAndStart();
   server_instance_cv_.notify_one();
 
@@ -84,6 +104,19 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
         (boost::format(kPortBindError) % server_address_).str());
   }
 
+  for (auto &queue : queues_) {
+    for (auto &service : async_services_) {
+      service->start(*queue);
+    }
+    pollers_.emplace_back([cq = queue.get()] {
+      void *tag = nullptr;
+      bool ok = false;
+      while (cq->Next(&tag, &ok)) {
+        static_cast<AsyncCqTag *>(tag)->proceed(ok);
+      }
+    });
+  }
+
   return iroha::expected::makeValue(selected_port);
 }
 
@@ -100,6 +133,7 @@ void ServerRunner::shutdown() {
   } else {
     log_->warn("Tried to shutdown without a server instance");
   }
+  stopQueues();
 }
 
 void ServerRunner::shutdown(
@@ -109,4 +143,25 @@ void ServerRunner::shutdown(
   } else {
     log_->warn("Tried to shutdown without a server instance");
   }
+  stopQueues();
+}
+
+void ServerRunner::stopQueues() {
+  for (auto &queue : queues_) {
+    queue->Shutdown();
+  }
+  for (auto &poller : pollers_) {
+    poller.join();
+  }
+  pollers_.clear();
+  // a queue without a poller (the server failed to start) still has to
+  // be drained before its destruction
+  for (auto &queue : queues_) {
+    void *tag = nullptr;
+    bool ok = false;
+    while (queue->Next(&tag, &ok)) {
+      static_cast<AsyncCqTag *>(tag)->proceed(ok);
+    }
+  }
+  queues_.clear();
 }
@@ -7,11 +7,13 @@
 #define MAIN_SERVER_RUNNER_HPP
 
 #include <condition_variable>
+#include <thread>
 
 #include <grpc++/grpc++.h>
 #include <grpc++/impl/codegen/service_type.h>
 #include "common/result.hpp"
 #include "logger/logger_fwd.hpp"
+#include "network/async_cq_service.hpp"
 
 namespace iroha {
   namespace network {
@@ -45,6 +47,18 @@ namespace iroha {
        */
       ServerRunner &append(std::shared_ptr<grpc::Service> service);
 
+      /**
+       * Adds a new grpc service driven by a server completion queue.
+       * The runner registers the underlying service, polls the queues
+       * with a small fixed set of threads, so all the asynchronous
+       * calls of the service multiplex over them instead of occupying
+       * one handler thread each, and shuts the queues down together
+       * with the server.
+       * @param service - service to append.
+       * @return reference to this with service appended
+       */
+      ServerRunner &appendAsync(std::shared_ptr<AsyncCqService> service);
+
       /**
        * Initialize the server and run main loop.
        * @return Result with used port number or error message
@@ -67,6 +81,10 @@ namespace iroha {
       void shutdown(const std::chrono::system_clock::time_point &deadline);
 
      private:
+      /// shut the completion queues down and join the poller threads;
+      /// must be called after the server shutdown has been requested
+      void stopQueues();
+
       logger::LoggerPtr log_;
 
       std::unique_ptr<grpc::Server> server_instance_;
@@ -77,6 +95,9 @@ namespace iroha {
       std::shared_ptr<grpc::ServerCredentials> credentials_;
       bool reuse_;
       std::vector<std::shared_ptr<grpc::Service>> services_;
+      std::vector<std::shared_ptr<AsyncCqService>> async_services_;
+      std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> queues_;
+      std::vector<std::thread> pollers_;
     };
 
   }  // namespace network
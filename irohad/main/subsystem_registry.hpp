@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SUBSYSTEM_REGISTRY_HPP
+#define IROHA_SUBSYSTEM_REGISTRY_HPP
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace iroha {
+
+  /// registry name of the Burrow EVM engine
+  constexpr const char kBurrowVmCallerName[] = "burrow";
+
+  /**
+   * Build-time registry of the optional engines. An engine compiled into
+   * this binary is registered under its name by
+   * registerCompiledSubsystems(); the pipeline wiring asks the registry
+   * by name and handles the absence, so it spells neither the engine's
+   * build flag nor its headers. A deployment build with the engine
+   * switched off simply comes up without that name and carries none of
+   * its code.
+   */
+  template <typename Interface>
+  class SubsystemRegistry {
+   public:
+    using Factory = std::function<std::unique_ptr<Interface>()>;
+
+    /// the registry of the engines implementing one interface,
+    /// shared binary-wide
+    static SubsystemRegistry &instance() {
+      static SubsystemRegistry registry;
+      return registry;
+    }
+
+    void add(std::string name, Factory factory) {
+      factories_[std::move(name)] = std::move(factory);
+    }
+
+    /**
+     * @return a new instance of the named engine, or nullptr when it is
+     * not compiled into this binary
+     */
+    std::unique_ptr<Interface> create(const std::string &name) const {
+      auto it = factories_.find(name);
+      if (it == factories_.end()) {
+        return nullptr;
+      }
+      return it->second();
+    }
+
+    /// names of the engines compiled into this binary
+    std::vector<std::string> registered() const {
+      std::vector<std::string> names;
+      names.reserve(factories_.size());
+      for (const auto &factory : factories_) {
+        names.push_back(factory.first);
+      }
+      return names;
+    }
+
+   private:
+    SubsystemRegistry() = default;
+
+    std::map<std::string, Factory> factories_;
+  };
+
+  /**
+   * Register the optional engines this binary was built with. Idempotent
+   * and called during startup; all the per-flag registrations live in
+   * one translation unit, so the rest of the wiring stays free of build
+   * flags.
+   */
+  void registerCompiledSubsystems();
+
+}  // namespace iroha
+
+#endif  // IROHA_SUBSYSTEM_REGISTRY_HPP
@@ -6,8 +6,10 @@
 #ifndef IROHA_GOSSIP_PROPAGATION_STRATEGY_HPP
 #define IROHA_GOSSIP_PROPAGATION_STRATEGY_HPP
 
+#include <atomic>
 #include <boost/optional.hpp>
 #include <chrono>
+#include <limits>
 #include <mutex>
 
 #include <rxcpp/rx-lite.hpp>
@@ -19,11 +21,21 @@
 
 namespace iroha {
 
+  namespace network {
+    class PeerZones;
+  }  // namespace network
+
   /**
    * This class provides strategy for propagation states in network
    * Emits exactly (or zero if provider is empty) amount of peers
    * at some period
    * note: it can be inconsistent with the peer provider
+   *
+   * The period ticks adapt to the pending state reported through
+   * onStateChange: an idle state suppresses the ticks, a backlog scales
+   * the amount of emitted peers up, and a quorum completion triggers an
+   * immediate out-of-schedule emission. Until the first report the
+   * strategy behaves as the plain periodic gossip
    */
   class GossipPropagationStrategy : public PropagationStrategy {
    public:
@@ -34,12 +46,15 @@ namespace iroha {
      * @param peer_factory is a provider of peer list
      * @param emit_worker is the coordinator for the data emitting
      * @param params configuration parameters
+     * @param peer_zones failure-domain labels of the peers; same-zone
+     * peers are gossiped to first when set
      */
     GossipPropagationStrategy(
         // TODO 30.01.2019 lebdron: IR-266 Remove PeerQueryFactory
         PeerProviderFactory peer_factory,
         rxcpp::observe_on_one_worker emit_worker,
-        const GossipPropagationStrategyParams &params);
+        const GossipPropagationStrategyParams &params,
+        std::shared_ptr<network::PeerZones> peer_zones = nullptr);
 
     ~GossipPropagationStrategy();
 
@@ -47,8 +62,15 @@ namespace iroha {
 
     rxcpp::observable<PropagationData> emitter() override;
 
+    void onStateChange(size_t pending_batches,
+                       bool quorum_completed) override;
+
     // --------------------------| end override |---------------------------
    private:
+    /// sentinel of pending_batches until the first onStateChange report
+    static constexpr size_t kUnknownPending =
+        std::numeric_limits<size_t>::max();
+
     /**
      * Source of peers for propagation
      */
@@ -69,6 +91,32 @@ namespace iroha {
      */
     rxcpp::observe_on_one_worker emit_worker;
 
+    /**
+     * Configuration parameters, kept for the adaptive emission amounts
+     */
+    GossipPropagationStrategyParams params;
+
+    /**
+     * Failure-domain labels of the peers; the rotation queue serves the
+     * same-zone peers first when set
+     */
+    std::shared_ptr<network::PeerZones> peer_zones;
+
+    /**
+     * Pending batches as last reported through onStateChange
+     */
+    std::atomic<size_t> pending_batches{kUnknownPending};
+
+    /**
+     * Pass-through for the out-of-schedule emissions on quorum completion
+     */
+    rxcpp::subjects::subject<PropagationData> immediate_subject;
+
+    /**
+     * Time of the last out-of-schedule emission, limits their rate
+     */
+    std::chrono::steady_clock::time_point last_immediate;
+
     /*
      * Observable for the emitting propagated data
      */
@@ -90,6 +138,17 @@ namespace iroha {
      * @return following peer
      */
     OptPeer visit();
+
+    /**
+     * Collect up to amount peers from the rotation queue
+     */
+    PropagationData collect(uint32_t amount);
+
+    /**
+     * Build the emission of one period tick with respect to the
+     * reported pending state
+     */
+    PropagationData onTick();
   };
 }  // namespace iroha
 
@@ -5,13 +5,30 @@
 
 #include "multi_sig_transactions/gossip_propagation_strategy.hpp"
 
+#include <algorithm>
 #include <numeric>
 #include <random>
 
 #include <boost/assert.hpp>
 #include <boost/range/irange.hpp>
 #include <rxcpp/operators/rx-map.hpp>
+#include <rxcpp/operators/rx-merge.hpp>
 #include "common/bind.hpp"
+#include "interfaces/common_objects/peer.hpp"
+#include "network/impl/peer_zones.hpp"
+
+namespace {
+  /// every this many pending batches add one amount_per_once worth of
+  /// peers to a period tick
+  constexpr size_t kBatchesPerEmissionBoost = 8;
+
+  /// cap of the per-tick emission multiplier
+  constexpr size_t kMaxEmissionBoost = 4;
+
+  /// minimal spacing of the out-of-schedule quorum-completion emissions,
+  /// so a signature burst does not turn into a gossip flood
+  constexpr auto kImmediateCooldown = std::chrono::milliseconds(100);
+}  // namespace
 
 namespace iroha {
 
@@ -23,30 +40,73 @@ namespace iroha {
   GossipPropagationStrategy::GossipPropagationStrategy(
       PeerProviderFactory peer_factory,
       rxcpp::observe_on_one_worker emit_worker,
-      const GossipPropagationStrategyParams &params)
+      const GossipPropagationStrategyParams &params,
+      std::shared_ptr<network::PeerZones> peer_zones)
       : peer_factory(peer_factory),
         non_visited({}),
         emit_worker(emit_worker),
+        params(params),
+        peer_zones(std::move(peer_zones)),
         emitent(rxcpp::observable<>::interval(
                     steady_clock::now(), params.emission_period, emit_worker)
-                    .map([this, params](int) {
-                      PropagationData vec;
-                      auto range = boost::irange(0u, params.amount_per_once);
-                      // push until find empty element
-                      std::find_if_not(
-                          range.begin(), range.end(), [this, &vec](int) {
-                            return this->visit() | [&vec](auto e) -> bool {
-                              vec.push_back(e);
-                              return true;  // proceed
-                            };
-                          });
-                      return vec;
-                    })) {}
+                    .map([this](int) { return this->onTick(); })
+                    .merge(emit_worker,
+                           immediate_subject.get_observable())) {}
 
   rxcpp::observable<PropagationData> GossipPropagationStrategy::emitter() {
     return emitent;
   }
 
+  void GossipPropagationStrategy::onStateChange(size_t pending_batches,
+                                                bool quorum_completed) {
+    this->pending_batches.store(pending_batches);
+    if (not quorum_completed or pending_batches == 0) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(m);
+      const auto now = steady_clock::now();
+      if (now - last_immediate < kImmediateCooldown) {
+        return;
+      }
+      last_immediate = now;
+    }
+    // a quorum-completing signature settles fastest when the peers that
+    // still wait for it learn it now, not on the next period tick
+    immediate_subject.get_subscriber().on_next(
+        collect(params.amount_per_once));
+  }
+
+  PropagationData GossipPropagationStrategy::collect(uint32_t amount) {
+    PropagationData vec;
+    auto range = boost::irange(0u, amount);
+    // push until find empty element
+    std::find_if_not(range.begin(), range.end(), [this, &vec](int) {
+      return this->visit() | [&vec](auto e) -> bool {
+        vec.push_back(e);
+        return true;  // proceed
+      };
+    });
+    return vec;
+  }
+
+  PropagationData GossipPropagationStrategy::onTick() {
+    const auto pending = pending_batches.load();
+    if (pending == 0) {
+      // nothing is waiting for signatures: skip the tick instead of
+      // spending bandwidth on peers that would get an empty diff anyway
+      return {};
+    }
+    auto amount = params.amount_per_once;
+    if (pending != kUnknownPending) {
+      // a backlog widens the tick, so signature bursts converge in fewer
+      // periods
+      amount *= std::min(kMaxEmissionBoost,
+                         1 + pending / kBatchesPerEmissionBoost);
+    }
+    return collect(amount);
+  }
+
   GossipPropagationStrategy::~GossipPropagationStrategy() {
     // Make sure that emitent callback have finish and haven't started yet
     std::lock_guard<std::mutex> lock(m);
@@ -68,6 +128,18 @@ namespace iroha {
       std::shuffle(this->non_visited.begin(),
                    this->non_visited.end(),
                    std::default_random_engine{});
+      if (this->peer_zones) {
+        // visit() pops from the back, so a stable partition that moves
+        // the same-zone peers there lets each rotation gossip nearby
+        // first; the shuffle within the groups and the full rotation
+        // keep the propagation diverse
+        std::stable_partition(this->non_visited.begin(),
+                              this->non_visited.end(),
+                              [this](auto index) {
+                                return not this->peer_zones->sameZone(
+                                    this->last_data[index]->pubkey());
+                              });
+      }
       return true;
     };
   }
@@ -11,7 +11,11 @@
 #include <rxcpp/operators/rx-flat_map.hpp>
 #include <rxcpp/operators/rx-map.hpp>
 #include <rxcpp/operators/rx-take.hpp>
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "metrics/pipeline_snapshots.hpp"
+#include "metrics/tx_latency_tracer.hpp"
 
 using shared_model::interface::types::PublicKeyHexStringView;
 
@@ -87,6 +91,11 @@ namespace iroha {
         storage_(std::move(storage)),
         strategy_(std::move(strategy)),
         time_provider_(std::move(time_provider)),
+        expired_batches_counter_(
+            metrics::MetricsRegistry::instance().makeCounter(
+                "iroha_mst_expired_batches_total",
+                "Number of multisignature batches dropped because they "
+                "expired before gathering quorum.")),
         propagation_subscriber_(
             strategy_->emitter()
                 .flat_map([](auto data) {
@@ -106,11 +115,21 @@ namespace iroha {
 
   auto FairMstProcessor::propagateBatchImpl(const iroha::DataType &batch)
       -> decltype(propagateBatch(batch)) {
+    for (const auto &tx : batch->transactions()) {
+      metrics::TxLatencyTracer::instance().recordStage(
+          tx->hash().hex(), metrics::TxStage::kMstPending);
+    }
     auto state_update = storage_->updateOwnState(batch);
     completedBatchesNotify(*state_update.completed_state_);
     updatedBatchesNotify(*state_update.updated_state_);
     expiredBatchesNotify(
         storage_->extractExpiredTransactions(time_provider_->getCurrentTime()));
+    auto own_pending = storage_->ownPendingQuantity();
+    iroha::metrics::PipelineSnapshots::instance().setMstPendingBatches(
+        own_pending);
+    // let the propagation strategy adapt to the new backlog
+    strategy_->onStateChange(own_pending,
+                             not state_update.completed_state_->isEmpty());
   }
 
   auto FairMstProcessor::onStateUpdateImpl() const
@@ -154,6 +173,13 @@ namespace iroha {
     // expired batches
     // not nesessary to do it right here, just use the occasion to clean storage
     expiredBatchesNotify(storage_->extractExpiredTransactions(current_time));
+
+    auto own_pending = storage_->ownPendingQuantity();
+    iroha::metrics::PipelineSnapshots::instance().setMstPendingBatches(
+        own_pending);
+    // let the propagation strategy adapt to the new backlog
+    strategy_->onStateChange(own_pending,
+                             not state_update.completed_state_->isEmpty());
   }
 
   // -----------------------------| private api |-----------------------------
@@ -177,6 +203,7 @@ namespace iroha {
   void FairMstProcessor::expiredBatchesNotify(ConstRefState state) const {
     if (not state.isEmpty()) {
       state.iterateBatches([this](const auto &batch) {
+        expired_batches_counter_->inc();
         expired_subject_.get_subscriber().on_next(batch);
       });
     }
@@ -13,6 +13,7 @@
 
 #include <rxcpp/rx-lite.hpp>
 #include "logger/logger_fwd.hpp"
+#include "metrics/metrics_registry.hpp"
 #include "multi_sig_transactions/mst_propagation_strategy.hpp"
 #include "multi_sig_transactions/mst_time_provider.hpp"
 #include "multi_sig_transactions/storage/mst_storage.hpp"
@@ -92,6 +93,9 @@ namespace iroha {
     std::shared_ptr<PropagationStrategy> strategy_;
     std::shared_ptr<MstTimeProvider> time_provider_;
 
+    /// counts batches dropped because they expired before completion
+    std::shared_ptr<metrics::Counter> expired_batches_counter_;
+
     // rx subjects
 
     /// use for share new states from other peers
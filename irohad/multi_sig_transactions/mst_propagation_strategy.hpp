@@ -26,6 +26,17 @@ namespace iroha {
      * with respect to own strategy
      */
     virtual rxcpp::observable<PropagationData> emitter() = 0;
+
+    /**
+     * Notification about a change of the pending multisignature state,
+     * so a strategy can adapt its emission schedule to the actual
+     * backlog. Ignored by default.
+     * @param pending_batches - batches still collecting signatures
+     * @param quorum_completed - a just applied signature completed the
+     * quorum of some batch
+     */
+    virtual void onStateChange(size_t pending_batches,
+                               bool quorum_completed) {}
   };
 }  // namespace iroha
 
@@ -5,15 +5,12 @@
 
 #include "multi_sig_transactions/state/mst_state.hpp"
 
-#include <numeric>
 #include <utility>
 #include <vector>
 
 #include <boost/algorithm/cxx11/all_of.hpp>
 #include <boost/algorithm/minmax_element.hpp>
-#include <boost/range/adaptor/indirected.hpp>
 #include <boost/range/adaptor/transformed.hpp>
-#include <boost/range/algorithm/equal.hpp>
 #include <boost/range/algorithm/find.hpp>
 #include <boost/range/combine.hpp>
 #include "common/set.hpp"
@@ -59,6 +56,11 @@ namespace iroha {
         < current_time;
   }
 
+  TimeType DefaultCompleter::expirationDeadline(const DataType &batch) const {
+    return oldestTimestamp(batch)
+        + expiration_time_ / std::chrono::milliseconds(1) + 1;
+  }
+
   // ------------------------------| public api |-------------------------------
 
   MstState MstState::empty(logger::LoggerPtr log,
@@ -90,10 +92,12 @@ namespace iroha {
     difference.reserve(boost::size(batches_));
     for (const auto &batch : my_batches) {
       auto it = rhs.batches_.right.find(batch);
+      // batches with equal hashes have equal payloads, so comparing the
+      // indexed signatory sets is equivalent to the deep transaction
+      // comparison, without walking the signatures themselves
       if (it == rhs.batches_.right.end()
-          or not boost::range::equal(
-                 batch->transactions() | boost::adaptors::indirected,
-                 it->first->transactions() | boost::adaptors::indirected)) {
+          or signatures_index_.at(batch)
+              != rhs.signatures_index_.at(it->first)) {
         difference.push_back(batch);
       }
     }
@@ -105,6 +109,10 @@ namespace iroha {
     return batches_.empty();
   }
 
+  size_t MstState::batchesQuantity() const {
+    return batches_.size();
+  }
+
   std::unordered_set<DataType,
                      iroha::model::PointerBatchHasher,
                      shared_model::interface::BatchHashEquality>
@@ -127,6 +135,7 @@ namespace iroha {
       const shared_model::interface::types::HashType &hash) {
     auto it = batches_to_hash_.left.find(hash);
     if (it != batches_to_hash_.left.end()) {
+      unindexBatch(it->second);
       batches_.right.erase(it->second);
       batches_to_hash_.left.erase(it);
     }
@@ -134,34 +143,37 @@ namespace iroha {
 
   // ------------------------------| private api |------------------------------
 
-  /**
-   * Merge signatures in batches
-   * @param target - batch for inserting
-   * @param donor - batch with transactions to copy signatures from
-   * @return return if at least one new signature was inserted
-   */
-  bool mergeSignaturesInBatch(DataType &target, const DataType &donor) {
+  bool MstState::mergeSignaturesIndexed(DataType &target,
+                                        const DataType &donor) {
+    auto &signature_slots = signatures_index_.at(target);
     auto inserted_new_signatures = false;
+    size_t slot_index = 0;
     for (auto zip :
          boost::combine(target->transactions(), donor->transactions())) {
       const auto &target_tx = zip.get<0>();
       const auto &donor_tx = zip.get<1>();
-      inserted_new_signatures = std::accumulate(
-          std::begin(donor_tx->signatures()),
-          std::end(donor_tx->signatures()),
-          inserted_new_signatures,
-          [&target_tx](bool accumulator, const auto &signature) {
-            return target_tx->addSignature(
-                       shared_model::interface::types::SignedHexStringView{
-                           signature.signedData()},
-                       shared_model::interface::types::PublicKeyHexStringView{
-                           signature.publicKey()})
-                or accumulator;
-          });
+      auto &known_signatories = signature_slots[slot_index++];
+      for (const auto &signature : donor_tx->signatures()) {
+        // only signatures from unseen signatories reach the transaction
+        if (known_signatories.emplace(signature.publicKey()).second) {
+          inserted_new_signatures = target_tx->addSignature(
+                                        shared_model::interface::types::
+                                            SignedHexStringView{
+                                                signature.signedData()},
+                                        shared_model::interface::types::
+                                            PublicKeyHexStringView{
+                                                signature.publicKey()})
+              or inserted_new_signatures;
+        }
+      }
     }
     return inserted_new_signatures;
   }
 
+  void MstState::unindexBatch(const DataType &batch) {
+    signatures_index_.erase(batch);
+  }
+
   MstState::MstState(CompleterType const &completer, logger::LoggerPtr log)
       : MstState(completer, std::vector<DataType>{}, std::move(log)) {}
 
@@ -187,11 +199,12 @@ namespace iroha {
 
     DataType found = corresponding->first;
     // Append new signatures to the existing state
-    auto inserted_new_signatures = mergeSignaturesInBatch(found, rhs_batch);
+    auto inserted_new_signatures = mergeSignaturesIndexed(found, rhs_batch);
 
     if (completer_->isCompleted(found)) {
       // state already has completed transaction,
       // remove from state and return it
+      unindexBatch(found);
       batches_to_hash_.right.erase(found);
       batches_.right.erase(found);
       state_update.completed_state_->rawInsert(found);
@@ -206,10 +219,18 @@ namespace iroha {
   }
 
   void MstState::rawInsert(const DataType &rhs_batch) {
+    auto &signature_slots = signatures_index_[rhs_batch];
+    signature_slots.reserve(boost::size(rhs_batch->transactions()));
     for (auto &tx : rhs_batch->transactions()) {
       batches_to_hash_.insert({tx->hash(), rhs_batch});
+      auto &known_signatories = signature_slots.emplace_back();
+      for (const auto &signature : tx->signatures()) {
+        known_signatories.emplace(signature.publicKey());
+      }
     }
     batches_.insert({oldestTimestamp(rhs_batch), rhs_batch});
+    expiry_wheel_.insert(completer_->expirationDeadline(rhs_batch),
+                         (*rhs_batch->transactions().begin())->hash());
   }
 
   bool MstState::contains(const DataType &element) const {
@@ -222,15 +243,21 @@ namespace iroha {
 
   void MstState::extractExpiredImpl(const TimeType &current_time,
                                     boost::optional<MstState &> extracted) {
-    for (auto it = batches_.left.begin(); it != batches_.left.end()
-         and completer_->isExpired(it->second, current_time);) {
+    expiry_wheel_.advanceTo(current_time, [&](auto &&tx_hash) {
+      auto it = batches_to_hash_.left.find(tx_hash);
+      if (it == batches_to_hash_.left.end()) {
+        // the batch left the state before its deadline (it got completed or
+        // finalized), so the wheel entry is a leftover
+        return;
+      }
+      DataType batch = it->second;
       if (extracted) {
-        *extracted += it->second;
+        *extracted += batch;
       }
-      batches_to_hash_.right.erase(it->second);
-      it = batches_.left.erase(it);
-      assert(it == batches_.left.begin());
-    }
+      unindexBatch(batch);
+      batches_.right.erase(batch);
+      batches_to_hash_.right.erase(batch);
+    });
   }
 
 }  // namespace iroha
@@ -7,15 +7,18 @@
 #define IROHA_MST_STATE_HPP
 
 #include <chrono>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <boost/bimap.hpp>
-#include <boost/bimap/multiset_of.hpp>
 #include <boost/bimap/unordered_multiset_of.hpp>
 #include <boost/bimap/unordered_set_of.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/any_range.hpp>
+#include "common/timing_wheel.hpp"
 #include "cryptography/hash.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger_fwd.hpp"
@@ -46,6 +49,14 @@ namespace iroha {
     virtual bool isExpired(const DataType &batch,
                            const TimeType &current_time) const = 0;
 
+    /**
+     * Get the earliest time at which the batch counts as expired, that is,
+     * the smallest current_time for which isExpired returns true
+     * @param batch - object for inspection
+     * @return the expiration deadline of the batch
+     */
+    virtual TimeType expirationDeadline(const DataType &batch) const = 0;
+
     virtual ~Completer() = default;
   };
 
@@ -67,6 +78,8 @@ namespace iroha {
     bool isExpired(const DataType &tx,
                    const TimeType &current_time) const override;
 
+    TimeType expirationDeadline(const DataType &batch) const override;
+
    private:
     std::chrono::minutes expiration_time_;
   };
@@ -115,6 +128,11 @@ namespace iroha {
      */
     bool isEmpty() const;
 
+    /**
+     * @return number of batches inside
+     */
+    size_t batchesQuantity() const;
+
     /**
      * @return the batches from the state
      */
@@ -182,13 +200,36 @@ namespace iroha {
                          shared_model::interface::BatchHashEquality>>;
 
     using BatchesBimap =
-        boost::bimap<boost::bimaps::multiset_of<
+        boost::bimap<boost::bimaps::unordered_multiset_of<
                          shared_model::interface::types::TimestampType>,
                      boost::bimaps::unordered_set_of<
                          DataType,
                          iroha::model::PointerBatchHasher,
                          shared_model::interface::BatchHashEquality>>;
 
+    /**
+     * Batches are registered in a timing wheel under their expiration
+     * deadline (keyed by one of their transaction hashes), so an expiry
+     * pass yields exactly the due batches instead of walking an ordered
+     * index. Entries of batches that left the state earlier are dropped
+     * lazily when their slot comes up.
+     */
+    using ExpiryWheel =
+        containers::TimingWheel<shared_model::interface::types::HashType>;
+
+    /**
+     * Per-transaction sets of signatory public keys of each stored batch,
+     * indexed by the batch hash. Merging an incoming batch consults these
+     * slots instead of re-feeding every donor signature through the
+     * transaction objects, so a merge costs one set lookup per incoming
+     * signature and only the genuinely new ones are inserted.
+     */
+    using SignaturesIndex = std::unordered_map<
+        DataType,
+        std::vector<std::unordered_set<std::string>>,
+        iroha::model::PointerBatchHasher,
+        shared_model::interface::BatchHashEquality>;
+
     MstState(CompleterType const &completer, logger::LoggerPtr log);
 
     MstState(CompleterType const &completer,
@@ -209,6 +250,18 @@ namespace iroha {
      */
     void rawInsert(const DataType &rhs_tx);
 
+    /**
+     * Copy the signatures the target does not have yet from the donor,
+     * consulting and updating the signatures index of the target.
+     * @param target - the stored batch to accumulate signatures into
+     * @param donor - the incoming batch with the same hash
+     * @return true if at least one new signature was inserted
+     */
+    bool mergeSignaturesIndexed(DataType &target, const DataType &donor);
+
+    /// Drop the batch from the signatures index.
+    void unindexBatch(const DataType &batch);
+
     /**
      * Erase expired batches, optionally returning them.
      * @param current_time - current time
@@ -223,6 +276,8 @@ namespace iroha {
 
     BatchesBimap batches_;
     BatchesToHashBimap batches_to_hash_;
+    SignaturesIndex signatures_index_;
+    ExpiryWheel expiry_wheel_;
 
     logger::LoggerPtr log_;
   };
@@ -43,4 +43,9 @@ namespace iroha {
   bool MstStorage::batchInStorage(const DataType &batch) const {
     return batchInStorageImpl(batch);
   }
+
+  size_t MstStorage::ownPendingQuantity() const {
+    std::lock_guard<std::mutex> lock{this->mutex_};
+    return ownPendingQuantityImpl();
+  }
 }  // namespace iroha
@@ -88,6 +88,16 @@ namespace iroha {
       const TimeType &current_time)
       -> decltype(getDiffState(target_peer_key, current_time)) {
     auto target_current_state_iter = getState(target_peer_key);
+    auto &diffs_since_full_resend =
+        diffs_since_full_resend_[StringViewOrString{
+            std::string{target_peer_key}}];
+    if (++diffs_since_full_resend >= kAntiEntropyInterval) {
+      // forget what the peer is believed to have, so the whole own state is
+      // resent — recovers peers that lost their state since the last exchange
+      target_current_state_iter->second =
+          MstState::empty(mst_state_logger_, completer_);
+      diffs_since_full_resend = 0;
+    }
     auto new_diff_state = own_state_ - target_current_state_iter->second;
     new_diff_state.eraseExpired(current_time);
     return new_diff_state;
@@ -102,4 +112,8 @@ namespace iroha {
     return own_state_.contains(batch);
   }
 
+  size_t MstStorageStateImpl::ownPendingQuantityImpl() const {
+    return own_state_.batchesQuantity();
+  }
+
 }  // namespace iroha
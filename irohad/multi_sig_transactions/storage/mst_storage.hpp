@@ -53,6 +53,9 @@ namespace iroha {
     /**
      * Make state based on diff of own and target states.
      * All expired transactions will be removed from diff.
+     * Periodically the tracked state of the target peer is dropped, so the
+     * whole own state gets resent (anti-entropy for peers that lost their
+     * state).
      * @return difference between own and target state
      * General note: implementation of method covered by lock
      */
@@ -75,6 +78,12 @@ namespace iroha {
      */
     bool batchInStorage(const DataType &batch) const;
 
+    /**
+     * @return number of batches still collecting signatures in own state
+     * General note: implementation of method covered by lock
+     */
+    size_t ownPendingQuantity() const;
+
     virtual ~MstStorage() = default;
 
    protected:
@@ -107,6 +116,8 @@ namespace iroha {
 
     virtual bool batchInStorageImpl(const DataType &batch) const = 0;
 
+    virtual size_t ownPendingQuantityImpl() const = 0;
+
     // -------------------------------| fields |--------------------------------
 
     mutable std::mutex mutex_;
@@ -6,6 +6,7 @@
 #ifndef IROHA_MST_STORAGE_IMPL_HPP
 #define IROHA_MST_STORAGE_IMPL_HPP
 
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 
@@ -68,6 +69,8 @@ namespace iroha {
 
     bool batchInStorageImpl(const DataType &batch) const override;
 
+    size_t ownPendingQuantityImpl() const override;
+
    private:
     // ---------------------------| private fields |----------------------------
 
@@ -99,6 +102,18 @@ namespace iroha {
         peer_states_;
     MstState own_state_;
 
+    /**
+     * Every this many diffs for a peer its tracked state is dropped, so the
+     * next diff carries the whole own state. The tracked state is only our
+     * belief about what the peer has acknowledged — if the peer lost it (for
+     * example, after a restart), plain diffing would never resend those
+     * batches, so they are periodically pushed again as an anti-entropy
+     * measure.
+     */
+    static constexpr uint32_t kAntiEntropyInterval = 16;
+    std::unordered_map<StringViewOrString, uint32_t, StringViewOrString::Hash>
+        diffs_since_full_resend_;
+
     logger::LoggerPtr mst_state_logger_;  ///< Logger for created MstState
                                           ///< objects.
   };
@@ -60,7 +60,10 @@ grpc::Status MstTransportGrpc::SendState(
     ::google::protobuf::Empty *response) {
   log_->info("MstState Received");
 
-  auto transactions = shared_model::proto::deserializeTransactions(
+  // bulk state sync after a peer outage carries many transactions whose
+  // parsing and signature checks are independent, so they are built in
+  // parallel chunks before the state merge takes the storage lock
+  auto transactions = shared_model::proto::deserializeTransactionsParallel(
       *transaction_factory_, request->transactions());
   if (auto e = expected::resultToOptionalError(transactions)) {
     log_->warn(
@@ -154,7 +157,8 @@ rxcpp::observable<bool> MstTransportGrpc::sendState(
                                [s](auto &status, auto &) {
                                  s.on_next(status.ok());
                                  s.on_completed();
-                               });
+                               },
+                               to->address());
               }
             });
       },
@@ -170,7 +174,8 @@ void iroha::network::sendStateAsync(
     transport::MstTransportGrpc::StubInterface &client_stub,
     AsyncGrpcClient<google::protobuf::Empty> &async_call,
     std::function<void(grpc::Status &, google::protobuf::Empty &)>
-        on_response) {
+        on_response,
+    std::string destination) {
   transport::MstState proto_state;
   std::string_view sender_key_sv = sender_key;
   proto_state.set_source_peer_key(sender_key_sv.data(), sender_key_sv.size());
@@ -180,9 +185,12 @@ void iroha::network::sendStateAsync(
         std::static_pointer_cast<shared_model::proto::Transaction>(tx)
             ->getTransport();
   });
-  async_call.Call(
-      [&](auto context, auto cq) {
-        return client_stub.AsyncSendState(context, proto_state, cq);
-      },
-      std::move(on_response));
+  auto start_call = [&](auto context, auto cq) {
+    return client_stub.AsyncSendState(context, proto_state, cq);
+  };
+  if (destination.empty()) {
+    async_call.Call(start_call, std::move(on_response));
+  } else {
+    async_call.Call(destination, start_call, std::move(on_response));
+  }
 }
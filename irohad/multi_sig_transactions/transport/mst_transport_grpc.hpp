@@ -94,13 +94,19 @@ namespace iroha {
       std::shared_ptr<MstClientFactory> client_factory_;
     };
 
+    /**
+     * Send the state asynchronously. When destination is not empty, the
+     * call is accounted against the per-destination outstanding call
+     * budget of async_call.
+     */
     void sendStateAsync(
         MstState const &state,
         shared_model::interface::types::PublicKeyHexStringView sender_key,
         transport::MstTransportGrpc::StubInterface &client_stub,
         AsyncGrpcClient<google::protobuf::Empty> &async_call,
         std::function<void(grpc::Status &, google::protobuf::Empty &)>
-            on_response = {});
+            on_response = {},
+        std::string destination = {});
 
   }  // namespace network
 }  // namespace iroha
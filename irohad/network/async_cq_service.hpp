@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_CQ_SERVICE_HPP
+#define IROHA_ASYNC_CQ_SERVICE_HPP
+
+#include <grpc++/grpc++.h>
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Tag of one asynchronous gRPC server operation. The completion
+     * queue pollers of ServerRunner call proceed() once the tagged
+     * operation has completed.
+     */
+    class AsyncCqTag {
+     public:
+      virtual ~AsyncCqTag() = default;
+
+      /**
+       * Handle the completion of the tagged operation
+       * @param ok - success flag of the operation as reported by the
+       * completion queue; false means the operation was aborted (e.g.
+       * the server is shutting down) and no further operations may be
+       * started on its call
+       */
+      virtual void proceed(bool ok) = 0;
+    };
+
+    /**
+     * A gRPC service that serves calls through a server completion
+     * queue instead of parking one handler thread per call in flight.
+     * ServerRunner registers the underlying service, polls the queues
+     * with a small fixed set of threads and shuts the queues down
+     * together with the server. Every tag put on a queue must derive
+     * from AsyncCqTag. gRPC allows a service with asynchronous methods
+     * to be registered with a single server only, so every server needs
+     * an instance of its own.
+     */
+    class AsyncCqService {
+     public:
+      virtual ~AsyncCqService() = default;
+
+      /// @return the underlying service to register with the server
+      virtual grpc::Service &service() = 0;
+
+      /**
+       * Seed the initial call objects. Called once per completion queue
+       * after the server has started.
+       * @param cq - the queue to request calls on
+       */
+      virtual void start(grpc::ServerCompletionQueue &cq) = 0;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_CQ_SERVICE_HPP
@@ -0,0 +1,194 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/address_resolver.hpp"
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <sys/socket.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/core.h>
+#include "logger/logger.hpp"
+
+using namespace iroha::network;
+
+namespace {
+  /// how long one resolution is served; getaddrinfo exposes no record
+  /// TTLs, so a fixed one bounds the staleness instead
+  constexpr std::chrono::seconds kAddressTtl{300};
+
+  /// how often the background thread wakes up to refresh aging entries
+  constexpr std::chrono::seconds kRefreshPeriod{30};
+
+  /// resolve one host, preferring IPv4 results
+  std::optional<std::string> resolveHost(const std::string &host) {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo *results = nullptr;
+    if (getaddrinfo(host.c_str(), nullptr, &hints, &results) != 0) {
+      return std::nullopt;
+    }
+    std::optional<std::string> resolved;
+    for (auto *entry = results; entry != nullptr; entry = entry->ai_next) {
+      char buffer[INET6_ADDRSTRLEN];
+      if (entry->ai_family == AF_INET) {
+        auto *addr = reinterpret_cast<sockaddr_in *>(entry->ai_addr);
+        if (inet_ntop(AF_INET, &addr->sin_addr, buffer, sizeof(buffer))) {
+          resolved = buffer;
+          break;
+        }
+      }
+      if (entry->ai_family == AF_INET6 and not resolved) {
+        auto *addr = reinterpret_cast<sockaddr_in6 *>(entry->ai_addr);
+        if (inet_ntop(AF_INET6, &addr->sin6_addr, buffer, sizeof(buffer))) {
+          resolved = fmt::format("[{}]", buffer);
+        }
+      }
+    }
+    freeaddrinfo(results);
+    return resolved;
+  }
+}  // namespace
+
+std::optional<std::pair<std::string, std::string>> iroha::network::
+    splitHostPort(const std::string &address) {
+  auto const colon = address.rfind(':');
+  if (colon == std::string::npos or colon + 1 == address.size()) {
+    return std::nullopt;
+  }
+  auto host = address.substr(0, colon);
+  if (host.size() > 1 and host.front() == '[' and host.back() == ']') {
+    host = host.substr(1, host.size() - 2);
+  }
+  if (host.empty()) {
+    return std::nullopt;
+  }
+  return std::make_pair(std::move(host), address.substr(colon + 1));
+}
+
+bool iroha::network::isNumericHost(const std::string &host) {
+  in_addr v4;
+  in6_addr v6;
+  return inet_pton(AF_INET, host.c_str(), &v4) == 1
+      or inet_pton(AF_INET6, host.c_str(), &v6) == 1;
+}
+
+class AddressResolver::Impl {
+ public:
+  explicit Impl(logger::LoggerPtr log)
+      : log_(std::move(log)), resolver_thread_([this] { runResolver(); }) {}
+
+  ~Impl() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+    }
+    wakeup_cv_.notify_all();
+    resolver_thread_.join();
+  }
+
+  std::optional<std::string> tryGetResolved(const std::string &address) {
+    auto const host_port = splitHostPort(address);
+    if (not host_port or isNumericHost(host_port->first)) {
+      return std::nullopt;
+    }
+    auto const now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(host_port->first);
+    if (it == entries_.end()) {
+      // first sight of this host - queue it for background resolution
+      // and let the caller connect by name this time
+      entries_.emplace(host_port->first, Entry{});
+      have_new_hosts_ = true;
+      wakeup_cv_.notify_all();
+      return std::nullopt;
+    }
+    if (it->second.resolved_host.empty() or it->second.deadline <= now) {
+      return std::nullopt;
+    }
+    return fmt::format("{}:{}", it->second.resolved_host, host_port->second);
+  }
+
+ private:
+  struct Entry {
+    /// numeric host, IPv6 in brackets; empty until the first resolution
+    std::string resolved_host;
+    std::chrono::steady_clock::time_point deadline{};
+  };
+
+  void runResolver() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (not stopped_) {
+      have_new_hosts_ = false;
+      // refresh entries ahead of their expiry, so a fresh address is
+      // always in the cache while the host keeps resolving
+      auto const refresh_before = std::chrono::steady_clock::now()
+          + kRefreshPeriod + kRefreshPeriod;
+      std::vector<std::string> due;
+      for (auto const &entry : entries_) {
+        if (entry.second.deadline <= refresh_before) {
+          due.push_back(entry.first);
+        }
+      }
+      if (not due.empty()) {
+        lock.unlock();
+        std::vector<std::pair<std::string, std::optional<std::string>>>
+            resolutions;
+        resolutions.reserve(due.size());
+        for (auto const &host : due) {
+          resolutions.emplace_back(host, resolveHost(host));
+        }
+        lock.lock();
+        auto const now = std::chrono::steady_clock::now();
+        for (auto &resolution : resolutions) {
+          auto it = entries_.find(resolution.first);
+          if (it == entries_.end()) {
+            continue;
+          }
+          if (resolution.second) {
+            it->second.resolved_host = *std::move(resolution.second);
+            it->second.deadline = now + kAddressTtl;
+          } else if (it->second.deadline <= now) {
+            // the name no longer resolves and the cache has expired -
+            // callers fall back to connecting by name
+            log_->warn("could not resolve {}", resolution.first);
+          }
+        }
+      }
+      if (stopped_) {
+        break;
+      }
+      wakeup_cv_.wait_for(
+          lock, kRefreshPeriod, [this] { return stopped_ or have_new_hosts_; });
+    }
+  }
+
+  logger::LoggerPtr log_;
+
+  std::mutex mutex_;
+  std::condition_variable wakeup_cv_;
+  std::unordered_map<std::string, Entry> entries_;
+  bool have_new_hosts_{false};
+  bool stopped_{false};
+  std::thread resolver_thread_;
+};
+
+AddressResolver::AddressResolver(logger::LoggerPtr log)
+    : impl_(std::make_unique<Impl>(std::move(log))) {}
+
+AddressResolver::~AddressResolver() = default;
+
+std::optional<std::string> AddressResolver::tryGetResolved(
+    const std::string &address) {
+  return impl_->tryGetResolved(address);
+}
@@ -0,0 +1,64 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ADDRESS_RESOLVER_HPP
+#define IROHA_ADDRESS_RESOLVER_HPP
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Split a peer address into its host and port parts.
+     * @param address - address in "host:port" form, the host may be a
+     * name, an IPv4 literal or a bracketed IPv6 literal
+     * @return host (without brackets) and port, or nullopt when there is
+     * no port separator
+     */
+    std::optional<std::pair<std::string, std::string>> splitHostPort(
+        const std::string &address);
+
+    /// @return true when the host is an IPv4 or IPv6 literal which needs
+    /// no resolution
+    bool isNumericHost(const std::string &host);
+
+    /**
+     * Resolves peer host names on a background thread and caches the
+     * results, so channel creation on the round path never waits for
+     * DNS. A host name seen for the first time is queued for resolution
+     * and the caller proceeds with the name itself; once resolved, the
+     * cached address is served until its TTL lapses and is refreshed
+     * off-path before that happens.
+     */
+    class AddressResolver {
+     public:
+      explicit AddressResolver(logger::LoggerPtr log);
+
+      ~AddressResolver();
+
+      /**
+       * Look up the resolved form of a peer address without blocking.
+       * @param address - peer address in "host:port" form
+       * @return the "ip:port" to connect to when a fresh resolution is
+       * cached, nullopt when the host is numeric already, unknown yet or
+       * the cached entry expired - the caller then connects by name
+       */
+      std::optional<std::string> tryGetResolved(const std::string &address);
+
+     private:
+      class Impl;
+      std::unique_ptr<Impl> impl_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_ADDRESS_RESOLVER_HPP
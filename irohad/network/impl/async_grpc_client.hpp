@@ -6,35 +6,76 @@
 #ifndef IROHA_ASYNC_GRPC_CLIENT_HPP
 #define IROHA_ASYNC_GRPC_CLIENT_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <ciso646>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <google/protobuf/empty.pb.h>
 #include <grpc++/grpc++.h>
 #include <grpcpp/impl/codegen/async_unary_call.h>
 #include "logger/logger.hpp"
+#include "metrics/metrics_registry.hpp"
 
 namespace iroha {
   namespace network {
 
     /**
-     * Asynchronous gRPC client which does no processing of server responses
-     * @tparam Response type of server response
+     * Asynchronous gRPC client which does no processing of server responses.
+     * Responses are drained from a pool of completion queues, each polled by
+     * its own thread, so one slow callback or a burst of completions does
+     * not serialize all outbound traffic behind a single thread.
      */
     template <typename Response>
     class AsyncGrpcClient {
      public:
-      explicit AsyncGrpcClient(logger::LoggerPtr log)
-          : thread_(&AsyncGrpcClient::asyncCompleteRpc, this),
-            log_(std::move(log)) {}
+      /// calls to one destination in flight at once before new ones are
+      /// rejected; protects a dead peer from accumulating unbounded calls
+      static constexpr std::size_t kMaxOutstandingPerDestination = 256;
 
       /**
-       * Listen to gRPC server responses
+       * @param log - the logger to use
+       * @param completion_queue_count - number of completion queues and
+       * polling threads to spread the responses over
        */
-      void asyncCompleteRpc() {
+      explicit AsyncGrpcClient(logger::LoggerPtr log,
+                               std::size_t completion_queue_count = 1)
+          : log_(std::move(log)),
+            started_calls_(metrics::MetricsRegistry::instance().makeCounter(
+                "iroha_grpc_client_calls_started_total",
+                "Number of asynchronous gRPC calls started.")),
+            completed_calls_(metrics::MetricsRegistry::instance().makeCounter(
+                "iroha_grpc_client_calls_completed_total",
+                "Number of asynchronous gRPC calls completed.")),
+            rejected_calls_(metrics::MetricsRegistry::instance().makeCounter(
+                "iroha_grpc_client_calls_rejected_total",
+                "Number of asynchronous gRPC calls rejected by the "
+                "per-destination outstanding call limit.")) {
+        const auto queue_count =
+            std::max<std::size_t>(1, completion_queue_count);
+        queues_.reserve(queue_count);
+        for (std::size_t i = 0; i < queue_count; ++i) {
+          queues_.push_back(std::make_unique<grpc::CompletionQueue>());
+        }
+        threads_.reserve(queues_.size());
+        for (auto &queue : queues_) {
+          threads_.emplace_back(
+              [this, cq = queue.get()] { asyncCompleteRpc(*cq); });
+        }
+      }
+
+      /**
+       * Listen to gRPC server responses of one completion queue
+       */
+      void asyncCompleteRpc(grpc::CompletionQueue &cq) {
         void *got_tag;
         auto ok = false;
-        while (cq_.Next(&got_tag, &ok)) {
+        while (cq.Next(&got_tag, &ok)) {
           auto call = static_cast<AsyncClientCall *>(got_tag);
           if (not call->status.ok()) {
             log_->warn("RPC failed: {}", call->status.error_message());
@@ -42,20 +83,26 @@ namespace iroha {
           if (call->on_response) {
             call->on_response(call->status, call->reply);
           }
+          completed_calls_->inc();
+          if (not call->destination.empty()) {
+            std::lock_guard<std::mutex> lock(outstanding_mutex_);
+            --outstanding_calls_[call->destination];
+          }
           delete call;
         }
       }
 
       ~AsyncGrpcClient() {
-        cq_.Shutdown();
-        if (thread_.joinable()) {
-          thread_.join();
+        for (auto &queue : queues_) {
+          queue->Shutdown();
+        }
+        for (auto &thread : threads_) {
+          if (thread.joinable()) {
+            thread.join();
+          }
         }
       }
 
-      grpc::CompletionQueue cq_;
-      std::thread thread_;
-
       /**
        * State and data information of gRPC call
        */
@@ -70,6 +117,9 @@ namespace iroha {
             response_reader;
 
         std::function<void(grpc::Status &, Response &)> on_response;
+
+        /// key of the per-destination budget, empty for unbudgeted calls
+        std::string destination;
       };
 
       /**
@@ -81,14 +131,74 @@ namespace iroha {
       void Call(
           F &&lambda,
           std::function<void(grpc::Status &, Response &)> on_response = {}) {
+        startCall(std::string{},
+                  std::forward<F>(lambda),
+                  std::move(on_response));
+      }
+
+      /**
+       * Same as above, but accounted against a per-destination budget of
+       * outstanding calls. A call beyond the budget is not started; its
+       * on_response is invoked right away with RESOURCE_EXHAUSTED so the
+       * caller observes a failed send.
+       * @param destination - key of the budget, e.g. the peer address
+       */
+      template <typename F>
+      void Call(
+          const std::string &destination,
+          F &&lambda,
+          std::function<void(grpc::Status &, Response &)> on_response = {}) {
+        {
+          std::lock_guard<std::mutex> lock(outstanding_mutex_);
+          auto &outstanding = outstanding_calls_[destination];
+          if (outstanding >= kMaxOutstandingPerDestination) {
+            rejected_calls_->inc();
+            log_->warn("Dropping a call to {}: {} calls are outstanding",
+                       destination,
+                       outstanding);
+            if (on_response) {
+              grpc::Status status{grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                  "outstanding call limit reached"};
+              Response reply;
+              on_response(status, reply);
+            }
+            return;
+          }
+          ++outstanding;
+        }
+        startCall(
+            destination, std::forward<F>(lambda), std::move(on_response));
+      }
+
+     private:
+      template <typename F>
+      void startCall(
+          std::string destination,
+          F &&lambda,
+          std::function<void(grpc::Status &, Response &)> on_response) {
+        auto cq =
+            queues_[next_queue_.fetch_add(1, std::memory_order_relaxed)
+                    % queues_.size()]
+                .get();
         auto call = new AsyncClientCall;
+        call->destination = std::move(destination);
         call->on_response = std::move(on_response);
-        call->response_reader = lambda(&call->context, &cq_);
+        call->response_reader = lambda(&call->context, cq);
+        started_calls_->inc();
         call->response_reader->Finish(&call->reply, &call->status, call);
       }
 
-     private:
       logger::LoggerPtr log_;
+      std::vector<std::unique_ptr<grpc::CompletionQueue>> queues_;
+      std::vector<std::thread> threads_;
+      std::atomic<std::size_t> next_queue_{0};
+
+      std::mutex outstanding_mutex_;
+      std::unordered_map<std::string, std::size_t> outstanding_calls_;
+
+      std::shared_ptr<metrics::Counter> started_calls_;
+      std::shared_ptr<metrics::Counter> completed_calls_;
+      std::shared_ptr<metrics::Counter> rejected_calls_;
     };
   }  // namespace network
 }  // namespace iroha
@@ -11,6 +11,7 @@
 #include <fmt/core.h>
 #include <grpc++/create_channel.h>
 #include <rxcpp/rx-lite.hpp>
+#include "ametsuchi/impl/recent_blocks_cache.hpp"
 #include "backend/protobuf/block.hpp"
 #include "builders/protobuf/transport_builder.hpp"
 #include "common/bind.hpp"
@@ -29,10 +30,12 @@ BlockLoaderImpl::BlockLoaderImpl(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     std::shared_ptr<shared_model::proto::ProtoBlockFactory> factory,
     logger::LoggerPtr log,
-    std::unique_ptr<ClientFactory> client_factory)
+    std::unique_ptr<ClientFactory> client_factory,
+    std::shared_ptr<ametsuchi::RecentBlocksCache> pushed_blocks_cache)
     : peer_query_factory_(std::move(peer_query_factory)),
       block_factory_(std::move(factory)),
       client_factory_(std::move(client_factory)),
+      pushed_blocks_cache_(std::move(pushed_blocks_cache)),
       log_(std::move(log)) {}
 
 Result<rxcpp::observable<std::shared_ptr<Block>>, std::string>
@@ -45,14 +48,40 @@ BlockLoaderImpl::retrieveBlocks(
           std::move(client));
       return rxcpp::observable<std::shared_ptr<Block>>(
           rxcpp::observable<>::create<std::shared_ptr<Block>>(
-              [height, shared_client, block_factory = block_factory_](
-                  auto subscriber) {
+              [height,
+               shared_client,
+               block_factory = block_factory_,
+               pushed_blocks_cache = pushed_blocks_cache_,
+               log = log_](auto subscriber) {
+                auto next_height = height + 1;
+                if (pushed_blocks_cache) {
+                  // committing peers may have pushed the head of the
+                  // requested range already; those blocks were validated
+                  // at receipt, so serve them without the round trip and
+                  // only go to the network for the rest
+                  while (subscriber.is_subscribed()) {
+                    auto pushed_block = pushed_blocks_cache->get(next_height);
+                    if (not pushed_block) {
+                      break;
+                    }
+                    log->info("Block {} was served from the pushed blocks "
+                              "cache",
+                              next_height);
+                    subscriber.on_next(
+                        std::shared_ptr<Block>(clone(*pushed_block)));
+                    ++next_height;
+                  }
+                  if (not subscriber.is_subscribed()) {
+                    subscriber.on_completed();
+                    return;
+                  }
+                }
                 grpc::ClientContext context;
                 context.set_deadline(std::chrono::system_clock::now() + std::chrono::minutes(1ull));
 
                 proto::BlockRequest request;
-                request.set_height(height
-                                   + 1);  // request next block to our top
+                // request the first block above the cached run (or our top)
+                request.set_height(next_height);
                 auto reader = shared_client->retrieveBlocks(&context, request);
                 protocol::Block block;
                 while (subscriber.is_subscribed() and reader->Read(&block)) {
@@ -70,6 +99,11 @@ BlockLoaderImpl::retrieveBlocks(
                                     error.error))));
                           });
                 }
+                if (not subscriber.is_subscribed()) {
+                  // the consumer stopped early (e.g. a bounded stripe), so
+                  // cancel the call instead of draining the rest of the stream
+                  context.TryCancel();
+                }
                 reader->Finish();
                 subscriber.on_completed();
               }));
@@ -79,6 +113,15 @@ BlockLoaderImpl::retrieveBlocks(
 
 Result<std::unique_ptr<Block>, std::string> BlockLoaderImpl::retrieveBlock(
     types::PublicKeyHexStringView peer_pubkey, types::HeightType block_height) {
+  if (pushed_blocks_cache_) {
+    // a committing peer may have pushed the block already; it was
+    // validated at receipt, so the network round trip is skipped
+    if (auto pushed_block = pushed_blocks_cache_->get(block_height)) {
+      log_->info("Block {} was served from the pushed blocks cache",
+                 block_height);
+      return expected::makeValue(clone(*pushed_block));
+    }
+  }
   return findPeer(peer_pubkey) | [&](const auto &peer) {
     proto::BlockRequest request;
     grpc::ClientContext context;
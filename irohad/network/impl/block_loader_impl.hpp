@@ -17,6 +17,9 @@
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
+  namespace ametsuchi {
+    class RecentBlocksCache;
+  }
   namespace network {
     template <typename Service>
     class ClientFactory;
@@ -26,12 +29,19 @@ namespace iroha {
       using Service = proto::Loader;
       using ClientFactory = iroha::network::ClientFactory<Service>;
 
+      /**
+       * @param pushed_blocks_cache - blocks eagerly pushed by committing
+       * peers, validated at receipt; consulted before going to the
+       * network; may be null
+       */
       // TODO 30.01.2019 lebdron: IR-264 Remove PeerQueryFactory
       BlockLoaderImpl(
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           std::shared_ptr<shared_model::proto::ProtoBlockFactory> factory,
           logger::LoggerPtr log,
-          std::unique_ptr<ClientFactory> client_factory);
+          std::unique_ptr<ClientFactory> client_factory,
+          std::shared_ptr<ametsuchi::RecentBlocksCache> pushed_blocks_cache =
+              nullptr);
 
       iroha::expected::Result<
           rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>,
@@ -59,6 +69,7 @@ namespace iroha {
       std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
       std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory_;
       std::shared_ptr<ClientFactory> client_factory_;
+      std::shared_ptr<ametsuchi::RecentBlocksCache> pushed_blocks_cache_;
 
       logger::LoggerPtr log_;
     };
@@ -5,7 +5,9 @@
 
 #include "network/impl/block_loader_service.hpp"
 
+#include "ametsuchi/impl/recent_blocks_cache.hpp"
 #include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
 #include "common/bind.hpp"
 #include "logger/logger.hpp"
 
@@ -13,6 +15,27 @@ using namespace iroha;
 using namespace iroha::ametsuchi;
 using namespace iroha::network;
 
+/**
+ * Send the transport of a block over the stream without deep-copying it
+ * into the enclosing Block message: the Block_v1 is borrowed for the
+ * duration of the write (serialization does not mutate it) and released
+ * before the wrapper is destroyed. The synchronous Write serializes
+ * before returning, so the borrow cannot outlive the block.
+ */
+static bool writeBlockTransport(
+    grpc::ServerWriter<::iroha::protocol::Block> &writer,
+    const protocol::Block_v1 &transport) {
+  protocol::Block proto_block;
+  proto_block.unsafe_arena_set_allocated_block_v1(
+      const_cast<protocol::Block_v1 *>(&transport));
+  grpc::WriteOptions options;
+  // let the transport coalesce consecutive blocks into fewer frames
+  options.set_buffer_hint();
+  const bool ok = writer.Write(proto_block, options);
+  proto_block.unsafe_arena_release_block_v1();
+  return ok;
+}
+
 static grpc::Status handleGetBlockError(const BlockQuery::GetBlockError &error,
                                         const logger::LoggerPtr &log) {
   switch (error.code) {
@@ -36,10 +59,16 @@ BlockLoaderService::BlockLoaderService(
     std::shared_ptr<BlockQueryFactory> block_query_factory,
     std::shared_ptr<iroha::consensus::ConsensusResultCache>
         consensus_result_cache,
-    logger::LoggerPtr log)
+    std::shared_ptr<ametsuchi::RecentBlocksCache> recent_blocks_cache,
+    logger::LoggerPtr log,
+    std::shared_ptr<ametsuchi::RecentBlocksCache> pushed_blocks_cache,
+    std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory)
     : block_query_factory_(std::move(block_query_factory)),
       consensus_result_cache_(std::move(consensus_result_cache)),
-      log_(std::move(log)) {}
+      recent_blocks_cache_(std::move(recent_blocks_cache)),
+      log_(std::move(log)),
+      pushed_blocks_cache_(std::move(pushed_blocks_cache)),
+      block_factory_(std::move(block_factory)) {}
 
 grpc::Status BlockLoaderService::retrieveBlocks(
     ::grpc::ServerContext *context,
@@ -53,6 +82,22 @@ grpc::Status BlockLoaderService::retrieveBlocks(
 
   auto top_height = (*block_query)->getTopBlockHeight();
   for (decltype(top_height) i = request->height(); i <= top_height; ++i) {
+    if (recent_blocks_cache_) {
+      // recently committed blocks are served from memory, so that a crowd
+      // of syncing peers does not hit the disk for the same range
+      if (auto cached_block = recent_blocks_cache_->get(i)) {
+        if (not writeBlockTransport(
+                *writer,
+                std::static_pointer_cast<const shared_model::proto::Block>(
+                    cached_block)
+                    ->getTransport())) {
+          log_->error("Broken stream to {}", context->peer());
+          break;
+        }
+        continue;
+      }
+    }
+
     auto block_result = (*block_query)->getBlock(i);
 
     if (auto e = expected::resultToOptionalError(block_result)) {
@@ -65,11 +110,10 @@ grpc::Status BlockLoaderService::retrieveBlocks(
             block_result)
             .value;
 
-    protocol::Block proto_block;
-    *proto_block.mutable_block_v1() =
-        static_cast<shared_model::proto::Block *>(block.get())->getTransport();
-
-    if (not writer->Write(proto_block)) {
+    if (not writeBlockTransport(
+            *writer,
+            static_cast<shared_model::proto::Block *>(block.get())
+                ->getTransport())) {
       log_->error("Broken stream to {}", context->peer());
       break;
     }
@@ -107,6 +151,17 @@ grpc::Status BlockLoaderService::retrieveBlock(
         height);
   }
 
+  // then try the ring of recently committed blocks
+  if (recent_blocks_cache_) {
+    if (auto recent_block = recent_blocks_cache_->get(height)) {
+      *response->mutable_block_v1() =
+          std::static_pointer_cast<const shared_model::proto::Block>(
+              recent_block)
+              ->getTransport();
+      return grpc::Status::OK;
+    }
+  }
+
   // cache missed: notify and try to fetch the block from block storage itself
   auto block_query = block_query_factory_->createBlockQuery();
   if (not block_query) {
@@ -128,3 +183,33 @@ grpc::Status BlockLoaderService::retrieveBlock(
   *response->mutable_block_v1() = block_v1;
   return grpc::Status::OK;
 }
+
+grpc::Status BlockLoaderService::pushBlock(::grpc::ServerContext *context,
+                                           const protocol::Block *request,
+                                           proto::PushBlockResponse *response) {
+  if (not pushed_blocks_cache_ or not block_factory_) {
+    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "Block push is not enabled.");
+  }
+
+  // a pushed block goes through the same validation as a pulled one, so
+  // the local loader can serve it later without revalidating
+  return block_factory_->createBlock(protocol::Block{*request})
+      .match(
+          [&](auto &&result) {
+            log_->info("Received pushed block {} from {}",
+                       result.value->height(),
+                       context->peer());
+            pushed_blocks_cache_->push(std::shared_ptr<
+                                       const shared_model::interface::Block>(
+                std::move(result.value)));
+            return grpc::Status::OK;
+          },
+          [&](const auto &error) {
+            log_->warn("Rejected pushed block from {}: {}",
+                       context->peer(),
+                       error.error);
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                "Block validation failed.");
+          });
+}
@@ -11,15 +11,41 @@
 #include "loader.grpc.pb.h"
 #include "logger/logger_fwd.hpp"
 
+namespace shared_model {
+  namespace proto {
+    class ProtoBlockFactory;
+  }
+}  // namespace shared_model
+
 namespace iroha {
+  namespace ametsuchi {
+    class RecentBlocksCache;
+  }
   namespace network {
     class BlockLoaderService : public proto::Loader::Service {
      public:
+      /**
+       * @param block_query_factory - factory of queries to block storage
+       * @param consensus_result_cache - last block put by consensus
+       * @param recent_blocks_cache - ring of recently committed blocks used
+       * to serve syncing peers without disk reads; may be null
+       * @param log - service logger
+       * @param pushed_blocks_cache - ring of blocks eagerly pushed by the
+       * committing peers, consumed by the local block loader; when null,
+       * pushed blocks are refused
+       * @param block_factory - validates pushed blocks at receipt; must be
+       * set when pushed_blocks_cache is
+       */
       BlockLoaderService(
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<iroha::consensus::ConsensusResultCache>
               consensus_result_cache,
-          logger::LoggerPtr log);
+          std::shared_ptr<ametsuchi::RecentBlocksCache> recent_blocks_cache,
+          logger::LoggerPtr log,
+          std::shared_ptr<ametsuchi::RecentBlocksCache> pushed_blocks_cache =
+              nullptr,
+          std::shared_ptr<shared_model::proto::ProtoBlockFactory>
+              block_factory = nullptr);
 
       grpc::Status retrieveBlocks(
           ::grpc::ServerContext *context,
@@ -30,11 +56,18 @@ namespace iroha {
                                  const proto::BlockRequest *request,
                                  protocol::Block *response) override;
 
+      grpc::Status pushBlock(::grpc::ServerContext *context,
+                             const protocol::Block *request,
+                             proto::PushBlockResponse *response) override;
+
      private:
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<iroha::consensus::ConsensusResultCache>
           consensus_result_cache_;
+      std::shared_ptr<ametsuchi::RecentBlocksCache> recent_blocks_cache_;
       logger::LoggerPtr log_;
+      std::shared_ptr<ametsuchi::RecentBlocksCache> pushed_blocks_cache_;
+      std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory_;
     };
   }  // namespace network
 }  // namespace iroha
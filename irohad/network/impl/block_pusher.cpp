@@ -0,0 +1,108 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/block_pusher.hpp"
+
+#include <algorithm>
+
+#include "backend/protobuf/block.hpp"
+#include "common/bind.hpp"
+#include "interfaces/common_objects/peer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+#include "network/impl/client_factory.hpp"
+
+using namespace iroha::network;
+
+std::vector<std::shared_ptr<shared_model::interface::Peer>>
+iroha::network::selectPushTargets(
+    std::vector<std::shared_ptr<shared_model::interface::Peer>> peers,
+    const std::string &own_pubkey,
+    shared_model::interface::types::HeightType height,
+    size_t fanout) {
+  std::sort(peers.begin(), peers.end(), [](const auto &lhs, const auto &rhs) {
+    return lhs->pubkey() < rhs->pubkey();
+  });
+  const auto own = std::find_if(
+      peers.begin(), peers.end(), [&own_pubkey](const auto &peer) {
+        return peer->pubkey() == own_pubkey;
+      });
+  if (own == peers.end()) {
+    return {};
+  }
+  const size_t own_index = own - peers.begin();
+  const size_t others = peers.size() - 1;
+  if (others == 0) {
+    return {};
+  }
+
+  std::vector<std::shared_ptr<shared_model::interface::Peer>> targets;
+  targets.reserve(std::min(fanout, others));
+  for (size_t i = 0; i < std::min(fanout, others); ++i) {
+    // the offset stays within [1, others], so a target is never this
+    // node and never repeats within one round
+    const size_t offset = (height % others + i) % others + 1;
+    targets.push_back(peers[(own_index + offset) % peers.size()]);
+  }
+  return targets;
+}
+
+BlockPusher::BlockPusher(
+    std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+    std::unique_ptr<ClientFactory> client_factory,
+    std::string own_pubkey,
+    logger::LoggerPtr log)
+    : peer_query_factory_(std::move(peer_query_factory)),
+      client_factory_(std::move(client_factory)),
+      own_pubkey_(std::move(own_pubkey)),
+      log_(log),
+      async_call_(std::move(log)) {}
+
+BlockPusher::~BlockPusher() {
+  subscription_.unsubscribe();
+}
+
+void BlockPusher::subscribeTo(
+    rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
+        commits) {
+  subscription_ = commits.subscribe(
+      [this](const auto &block) { this->push(*block); });
+}
+
+void BlockPusher::push(const shared_model::interface::Block &block) {
+  auto opt_peers = peer_query_factory_->createPeerQuery() |
+      [](const auto &query) { return query->getLedgerPeers(); };
+  if (not opt_peers) {
+    log_->error("Could not get ledger peers to push block {}", block.height());
+    return;
+  }
+
+  auto targets = selectPushTargets(
+      std::move(*opt_peers), own_pubkey_, block.height(), kPushFanout);
+  if (targets.empty()) {
+    return;
+  }
+
+  protocol::Block request;
+  *request.mutable_block_v1() =
+      static_cast<const shared_model::proto::Block &>(block).getTransport();
+
+  for (const auto &peer : targets) {
+    client_factory_->createClient(*peer).match(
+        [&](auto client) {
+          log_->info("Pushing block {} to {}", block.height(), *peer);
+          async_call_.Call(peer->address(),
+                           [client = std::move(client.value), request](
+                               auto context, auto cq) {
+                             return client->AsyncpushBlock(
+                                 context, request, cq);
+                           });
+        },
+        [&](const auto &error) {
+          log_->error(
+              "Could not push block to {}: {}", *peer, error.error);
+        });
+  }
+}
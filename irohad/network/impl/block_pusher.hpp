@@ -0,0 +1,105 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_PUSHER_HPP
+#define IROHA_BLOCK_PUSHER_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <rxcpp/rx-lite.hpp>
+#include "ametsuchi/peer_query_factory.hpp"
+#include "loader.grpc.pb.h"
+#include "logger/logger_fwd.hpp"
+#include "network/impl/async_grpc_client.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+    class Peer;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace network {
+    template <typename Service>
+    class ClientFactory;
+
+    /**
+     * Deterministically pick the peers this node pushes a committed block
+     * to. The peers are ordered by public key into a ring, and every node
+     * pushes to the fanout peers following its own position, rotated by
+     * the block height so the pairs change from round to round. Run by
+     * every committing peer, the scheme covers the whole ring each round
+     * while any single peer receives only a handful of pushes.
+     * @param peers - current ledger peers, in any order
+     * @param own_pubkey - hex public key of this node
+     * @param height - height of the pushed block; rotates the targets
+     * @param fanout - number of peers to select
+     * @return the selected peers; empty when this node is not in the list
+     */
+    std::vector<std::shared_ptr<shared_model::interface::Peer>>
+    selectPushTargets(
+        std::vector<std::shared_ptr<shared_model::interface::Peer>> peers,
+        const std::string &own_pubkey,
+        shared_model::interface::types::HeightType height,
+        size_t fanout);
+
+    /**
+     * Eagerly pushes every committed block to a few other ledger peers, so
+     * a peer that missed the round receives the block right away instead
+     * of noticing the gap via consensus and pulling it over an extra round
+     * trip. The push is fire-and-forget: a peer that is up to date simply
+     * drops the duplicate, and a missed push costs nothing - the pull path
+     * still works as before.
+     */
+    class BlockPusher {
+     public:
+      using Service = proto::Loader;
+      using ClientFactory = iroha::network::ClientFactory<Service>;
+
+      /// number of peers each committing node pushes a block to
+      static constexpr size_t kPushFanout = 2;
+
+      /**
+       * @param peer_query_factory - to fetch the current ledger peers
+       * @param client_factory - a factory of loader client stubs
+       * @param own_pubkey - hex public key of this node, fixes its
+       * position in the push ring
+       * @param log - pusher logger
+       */
+      BlockPusher(
+          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+          std::unique_ptr<ClientFactory> client_factory,
+          std::string own_pubkey,
+          logger::LoggerPtr log);
+      ~BlockPusher();
+
+      BlockPusher(const BlockPusher &) = delete;
+      BlockPusher &operator=(const BlockPusher &) = delete;
+
+      /// push commits from the given observable for as long as this
+      /// object lives
+      void subscribeTo(
+          rxcpp::observable<
+              std::shared_ptr<const shared_model::interface::Block>> commits);
+
+      /// push one committed block to the selected peers
+      void push(const shared_model::interface::Block &block);
+
+     private:
+      std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
+      std::shared_ptr<ClientFactory> client_factory_;
+      const std::string own_pubkey_;
+      logger::LoggerPtr log_;
+      AsyncGrpcClient<proto::PushBlockResponse> async_call_;
+      rxcpp::composite_subscription subscription_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_PUSHER_HPP
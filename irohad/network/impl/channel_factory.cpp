@@ -12,6 +12,7 @@
 #include <boost/range/adaptor/transformed.hpp>
 #include "common/bind.hpp"
 #include "interfaces/common_objects/peer.hpp"
+#include "network/impl/address_resolver.hpp"
 
 using namespace iroha::expected;
 using namespace iroha::network;
@@ -38,9 +39,30 @@ std::unique_ptr<GrpcChannelParams> iroha::network::getDefaultChannelParams() {
   params->max_request_message_bytes = std::numeric_limits<int>::max();
   params->max_response_message_bytes = std::numeric_limits<int>::max();
   params->retry_policy = retry_policy;
+  // bulk transfer services carry large, highly redundant payloads and
+  // benefit from wire compression; the consensus vote service is left
+  // uncompressed to keep its latency
+  params->service_compression = {
+      {"iroha.network.proto.Loader", "gzip"},
+      {"iroha.network.transport.MstTransportGrpc", "gzip"}};
   return params;
 }
 
+void iroha::network::detail::applyServiceCompression(
+    grpc::ChannelArguments &args,
+    const std::string &service_full_name,
+    const GrpcChannelParams &params) {
+  auto it = params.service_compression.find(service_full_name);
+  if (it == params.service_compression.end()) {
+    return;
+  }
+  if (it->second == "gzip") {
+    args.SetCompressionAlgorithm(GRPC_COMPRESS_GZIP);
+  } else if (it->second == "deflate") {
+    args.SetCompressionAlgorithm(GRPC_COMPRESS_DEFLATE);
+  }
+}
+
 grpc::ChannelArguments iroha::network::detail::makeInterPeerChannelArguments(
     const std::set<std::string> &services, const GrpcChannelParams &params) {
   return detail::makeChannelArguments(services, params);
@@ -103,10 +125,10 @@ std::shared_ptr<grpc::Channel> iroha::network::createInsecureChannel(
     const shared_model::interface::types::AddressType &address,
     const std::string &service_full_name,
     const GrpcChannelParams &params) {
+  auto args = detail::makeInterPeerChannelArguments({service_full_name}, params);
+  detail::applyServiceCompression(args, service_full_name, params);
   return grpc::CreateCustomChannel(
-      address,
-      grpc::InsecureChannelCredentials(),
-      detail::makeInterPeerChannelArguments({service_full_name}, params));
+      address, grpc::InsecureChannelCredentials(), args);
 }
 
 class ChannelFactory::ChannelArgumentsProvider {
@@ -114,12 +136,16 @@ class ChannelFactory::ChannelArgumentsProvider {
   ChannelArgumentsProvider(std::shared_ptr<const GrpcChannelParams> params)
       : params_(std::move(params)) {}
 
-  const grpc::ChannelArguments &get(const std::string &service_full_name) {
+  grpc::ChannelArguments get(const std::string &service_full_name) {
     if (service_names_.count(service_full_name) == 0) {
       service_names_.emplace(service_full_name);
       args_ = detail::makeInterPeerChannelArguments(service_names_, *params_);
     }
-    return args_;
+    // compression is a channel-level default, so it is applied per
+    // requested service on a copy of the shared arguments
+    auto args = args_;
+    detail::applyServiceCompression(args, service_full_name, *params_);
+    return args;
   }
 
  private:
@@ -128,8 +154,11 @@ class ChannelFactory::ChannelArgumentsProvider {
   grpc::ChannelArguments args_;
 };
 
-ChannelFactory::ChannelFactory(std::shared_ptr<const GrpcChannelParams> params)
-    : args_(std::make_unique<ChannelArgumentsProvider>(std::move(params))) {}
+ChannelFactory::ChannelFactory(
+    std::shared_ptr<const GrpcChannelParams> params,
+    std::shared_ptr<AddressResolver> address_resolver)
+    : args_(std::make_unique<ChannelArgumentsProvider>(std::move(params))),
+      address_resolver_(std::move(address_resolver)) {}
 
 ChannelFactory::~ChannelFactory() = default;
 
@@ -137,8 +166,20 @@ Result<std::shared_ptr<grpc::Channel>, std::string> ChannelFactory::getChannel(
     const std::string &service_full_name,
     const shared_model::interface::Peer &peer) {
   return getChannelCredentials(peer) | [&](auto &&credentials) {
-    return grpc::CreateCustomChannel(
-        peer.address(), std::move(credentials), args_->get(service_full_name));
+    auto args = args_->get(service_full_name);
+    tuneChannelArguments(args);
+    auto target = peer.address();
+    if (address_resolver_) {
+      if (auto resolved = address_resolver_->tryGetResolved(target)) {
+        // connect to the cached numeric address, but keep verifying the
+        // TLS certificate against the configured host name
+        if (auto host_port = splitHostPort(target)) {
+          args.SetSslTargetNameOverride(host_port->first);
+        }
+        target = *std::move(resolved);
+      }
+    }
+    return grpc::CreateCustomChannel(target, std::move(credentials), args);
   };
 }
 
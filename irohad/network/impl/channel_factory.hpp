@@ -20,6 +20,8 @@
 
 namespace iroha {
   namespace network {
+    class AddressResolver;
+
     namespace detail {
       grpc::ChannelArguments makeChannelArguments(
           const std::set<std::string> &services,
@@ -28,6 +30,14 @@ namespace iroha {
       grpc::ChannelArguments makeInterPeerChannelArguments(
           const std::set<std::string> &services,
           const GrpcChannelParams &params);
+
+      /**
+       * Set the channel-default compression algorithm for the service if
+       * the params configure one; unknown algorithm names are ignored.
+       */
+      void applyServiceCompression(grpc::ChannelArguments &args,
+                                   const std::string &service_full_name,
+                                   const GrpcChannelParams &params);
     }  // namespace detail
 
     /**
@@ -107,8 +117,15 @@ namespace iroha {
 
     class ChannelFactory : public ChannelProvider {
      public:
-      /// @param params grpc channel params
-      ChannelFactory(std::shared_ptr<const GrpcChannelParams> params);
+      /**
+       * @param params grpc channel params
+       * @param address_resolver resolves peer host names off the round
+       * path, \see AddressResolver; channels connect by name and gRPC
+       * resolves in-call when not set
+       */
+      ChannelFactory(std::shared_ptr<const GrpcChannelParams> params,
+                     std::shared_ptr<AddressResolver> address_resolver =
+                         nullptr);
 
       ~ChannelFactory() override;
 
@@ -121,9 +138,13 @@ namespace iroha {
                                       std::string>
       getChannelCredentials(const shared_model::interface::Peer &) const;
 
+      /// Hook for derived factories to append their own channel arguments.
+      virtual void tuneChannelArguments(grpc::ChannelArguments &) const {}
+
      private:
       class ChannelArgumentsProvider;
       std::unique_ptr<ChannelArgumentsProvider> args_;
+      std::shared_ptr<AddressResolver> address_resolver_;
     };
 
   }  // namespace network
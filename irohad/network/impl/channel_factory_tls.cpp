@@ -5,6 +5,9 @@
 
 #include "network/impl/channel_factory_tls.hpp"
 
+#include <cstdlib>
+
+#include <grpc/grpc_security.h>
 #include "interfaces/common_objects/peer.hpp"
 #include "network/impl/grpc_channel_params.hpp"
 #include "network/impl/tls_credentials.hpp"
@@ -13,6 +16,36 @@
 using namespace iroha::expected;
 using namespace iroha::network;
 
+namespace {
+  /// sessions of this many recently contacted peers can be resumed
+  constexpr size_t kTlsSessionCacheSize = 32;
+
+  /// AES-GCM suites first - they run on AES-NI and carry block transfer
+  /// at wire speed
+  constexpr char kDefaultCipherSuites[] =
+      "ECDHE-ECDSA-AES128-GCM-SHA256:ECDHE-RSA-AES128-GCM-SHA256:"
+      "ECDHE-ECDSA-AES256-GCM-SHA384:ECDHE-RSA-AES256-GCM-SHA384";
+
+  void *sessionCacheArgCopy(void *cache) {
+    return cache;
+  }
+  void sessionCacheArgDestroy(void *) {}
+  int sessionCacheArgCmp(void *a, void *b) {
+    return a == b ? 0 : (a < b ? -1 : 1);
+  }
+
+  /**
+   * The channel arg does not take ownership of the cache - the factory
+   * owns it and outlives every channel it created.
+   */
+  const grpc_arg_pointer_vtable kSessionCacheArgVtable = {
+      sessionCacheArgCopy, sessionCacheArgDestroy, sessionCacheArgCmp};
+
+  /// how long a new channel is given to become ready before its
+  /// connection time stops being measured
+  constexpr std::chrono::seconds kConnectionWatchTimeout{60};
+}  // namespace
+
 ChannelFactoryTls::ChannelFactoryTls(
     std::shared_ptr<const GrpcChannelParams> params,
     boost::optional<std::shared_ptr<const PeerTlsCertificatesProvider>>
@@ -20,7 +53,43 @@ ChannelFactoryTls::ChannelFactoryTls(
     boost::optional<std::shared_ptr<const TlsCredentials>> my_creds)
     : ChannelFactory(std::move(params)),
       peer_cert_provider_(std::move(peer_cert_provider)),
-      my_creds_(std::move(my_creds)) {}
+      my_creds_(std::move(my_creds)),
+      session_cache_(grpc_ssl_session_cache_create_lru(kTlsSessionCacheSize)),
+      connect_duration_(
+          iroha::metrics::MetricsRegistry::instance().makeHistogram(
+              "tls_channel_connect_seconds",
+              "Time from TLS channel creation until the connection is ready",
+              iroha::metrics::Histogram::defaultDurationBounds())),
+      watcher_([this] { watchConnections(); }) {
+  // gRPC reads the cipher list once at SSL initialization; prefer the
+  // AES-GCM suites unless the operator has set their own
+  setenv("GRPC_SSL_CIPHER_SUITES", kDefaultCipherSuites, /*overwrite=*/0);
+}
+
+ChannelFactoryTls::~ChannelFactoryTls() {
+  {
+    std::lock_guard<std::mutex> lock(watcher_mutex_);
+    stop_ = true;
+  }
+  watcher_cv_.notify_one();
+  watcher_.join();
+  grpc_ssl_session_cache_destroy(session_cache_);
+}
+
+Result<std::shared_ptr<grpc::Channel>, std::string>
+ChannelFactoryTls::getChannel(const std::string &service_full_name,
+                              const shared_model::interface::Peer &peer) {
+  auto result = ChannelFactory::getChannel(service_full_name, peer);
+  if (auto channel = resultToOptionalValue(result)) {
+    {
+      std::lock_guard<std::mutex> lock(watcher_mutex_);
+      pending_connections_.push_back(
+          {*channel, std::chrono::steady_clock::now()});
+    }
+    watcher_cv_.notify_one();
+  }
+  return result;
+}
 
 Result<std::shared_ptr<grpc::ChannelCredentials>, std::string>
 ChannelFactoryTls::getChannelCredentials(
@@ -42,3 +111,35 @@ ChannelFactoryTls::getChannelCredentials(
   }
   return grpc::SslCredentials(options);
 }
+
+void ChannelFactoryTls::tuneChannelArguments(
+    grpc::ChannelArguments &args) const {
+  args.SetPointerWithVtable(
+      GRPC_SSL_SESSION_CACHE_ARG, session_cache_, &kSessionCacheArgVtable);
+}
+
+void ChannelFactoryTls::watchConnections() {
+  std::unique_lock<std::mutex> lock(watcher_mutex_);
+  while (true) {
+    watcher_cv_.wait(
+        lock, [this] { return stop_ or not pending_connections_.empty(); });
+    if (stop_) {
+      return;
+    }
+    auto pending = std::move(pending_connections_.front());
+    pending_connections_.pop_front();
+    lock.unlock();
+
+    if (auto channel = pending.channel.lock()) {
+      // start connecting right away - the channel would otherwise stay
+      // idle until its first call
+      channel->GetState(true);
+      auto deadline = pending.created_at + kConnectionWatchTimeout;
+      if (channel->WaitForConnected(deadline)) {
+        connect_duration_->observeSince(pending.created_at);
+      }
+    }
+
+    lock.lock();
+  }
+}
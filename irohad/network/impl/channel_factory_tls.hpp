@@ -8,7 +8,16 @@
 
 #include "network/impl/channel_factory.hpp"
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
+
+#include "metrics/metrics_registry.hpp"
+
+typedef struct grpc_ssl_session_cache grpc_ssl_session_cache;
 
 namespace iroha {
   namespace network {
@@ -24,16 +33,51 @@ namespace iroha {
               peer_cert_provider,
           boost::optional<std::shared_ptr<const TlsCredentials>> my_creds);
 
+      ~ChannelFactoryTls() override;
+
+      iroha::expected::Result<std::shared_ptr<grpc::Channel>, std::string>
+      getChannel(const std::string &service_full_name,
+                 const shared_model::interface::Peer &peer) override;
+
      protected:
       iroha::expected::Result<std::shared_ptr<grpc::ChannelCredentials>,
                               std::string>
       getChannelCredentials(
           const shared_model::interface::Peer &peer) const override;
 
+      /// Attaches the shared TLS session cache to the channel.
+      void tuneChannelArguments(grpc::ChannelArguments &args) const override;
+
      private:
+      struct PendingConnection {
+        std::weak_ptr<grpc::Channel> channel;
+        std::chrono::steady_clock::time_point created_at;
+      };
+
+      /// Kicks the connection of freshly created channels and observes the
+      /// time they take to become ready.
+      void watchConnections();
+
       boost::optional<std::shared_ptr<const PeerTlsCertificatesProvider>>
           peer_cert_provider_;
       boost::optional<std::shared_ptr<const TlsCredentials>> my_creds_;
+
+      /**
+       * Session cache shared by all channels of this factory, so that
+       * reconnects to a recently seen peer resume the TLS session instead
+       * of paying a full handshake. The factory owns the cache and
+       * outlives every channel it created.
+       */
+      grpc_ssl_session_cache *session_cache_;
+
+      /// time from channel creation until the TLS connection is ready
+      std::shared_ptr<iroha::metrics::Histogram> connect_duration_;
+
+      std::mutex watcher_mutex_;
+      std::condition_variable watcher_cv_;
+      std::deque<PendingConnection> pending_connections_;
+      bool stop_{false};
+      std::thread watcher_;
     };
 
   }  // namespace network
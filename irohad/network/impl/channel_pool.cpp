@@ -5,48 +5,135 @@
 
 #include "network/impl/channel_pool.hpp"
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <shared_mutex>
+#include <thread>
 #include <unordered_map>
 
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/common_objects/types.hpp"
+#include "logger/logger.hpp"
 #include "network/impl/channel_provider.hpp"
 
 using namespace iroha::expected;
 using namespace iroha::network;
 
+namespace {
+  /// how often the background thread inspects the cached channels
+  constexpr std::chrono::seconds kHealthCheckPeriod{5};
+}  // namespace
+
 class ChannelPool::Impl {
  public:
-  Impl(std::unique_ptr<ChannelProvider> channel_provider)
-      : channel_provider_(std::move(channel_provider)) {}
+  Impl(std::unique_ptr<ChannelProvider> channel_provider, logger::LoggerPtr log)
+      : channel_provider_(std::move(channel_provider)),
+        log_(std::move(log)),
+        health_check_thread_([this] { runHealthChecks(); }) {}
+
+  ~Impl() {
+    {
+      std::lock_guard<std::mutex> lock(stop_mutex_);
+      stopped_ = true;
+    }
+    stop_cv_.notify_all();
+    health_check_thread_.join();
+  }
 
   Result<std::shared_ptr<grpc::Channel>, std::string> getOrCreate(
       const std::string &service_full_name,
       const shared_model::interface::Peer &peer) {
-    std::shared_lock<std::shared_timed_mutex> read_lock(mutex_);
-    auto i = channels_.find(peer.pubkey());
-    if (i != channels_.end()) {
-      return i->second;
+    {
+      std::shared_lock<std::shared_timed_mutex> read_lock(mutex_);
+      auto i = channels_.find(peer.pubkey());
+      if (i != channels_.end()) {
+        auto &entry = i->second;
+        if (entry.address == peer.address()
+            and entry.channel->GetState(false) != GRPC_CHANNEL_SHUTDOWN) {
+          return entry.channel;
+        }
+        // the peer has moved or the channel is dead - make a new one below
+      }
     }
-    read_lock.unlock();
 
     return channel_provider_->getChannel(service_full_name, peer) |
         [this, &peer](auto &&new_channel) {
           std::unique_lock<std::shared_timed_mutex> write_lock(mutex_);
-          channels_[peer.pubkey()] = new_channel;
+          channels_[peer.pubkey()] = Entry{new_channel, peer.address()};
           return std::move(new_channel);
         };
   }
 
+  void warmup(const std::string &service_full_name,
+              const shared_model::interface::types::PeerList &peers) {
+    for (const auto &peer : peers) {
+      getOrCreate(service_full_name, *peer)
+          .match(
+              [](const auto &channel) {
+                // channels connect lazily, so ask this one to start
+                // establishing the connection right away
+                channel.value->GetState(true);
+              },
+              [&](const auto &error) {
+                log_->warn("could not warm up a channel to {}: {}",
+                           peer->address(),
+                           error.error);
+              });
+    }
+  }
+
  private:
+  struct Entry {
+    std::shared_ptr<grpc::Channel> channel;
+    /// the peer address the channel was created for - when it changes in
+    /// the WSV, the cached channel is dropped and resolved anew
+    shared_model::interface::types::AddressType address;
+  };
+
+  void runHealthChecks() {
+    std::unique_lock<std::mutex> stop_lock(stop_mutex_);
+    while (not stopped_) {
+      if (stop_cv_.wait_for(
+              stop_lock, kHealthCheckPeriod, [this] { return stopped_; })) {
+        break;
+      }
+      std::unique_lock<std::shared_timed_mutex> write_lock(mutex_);
+      for (auto it = channels_.begin(); it != channels_.end();) {
+        switch (it->second.channel->GetState(false)) {
+          case GRPC_CHANNEL_SHUTDOWN:
+            log_->info("evicting dead channel to {}", it->second.address);
+            it = channels_.erase(it);
+            continue;
+          case GRPC_CHANNEL_TRANSIENT_FAILURE:
+            // ask the channel to retry the connection in the background,
+            // so the next call does not pay for the reconnect
+            it->second.channel->GetState(true);
+            break;
+          default:
+            break;
+        }
+        ++it;
+      }
+    }
+  }
+
   std::unique_ptr<ChannelProvider> channel_provider_;
+  logger::LoggerPtr log_;
 
   std::shared_timed_mutex mutex_;
-  std::unordered_map<std::string, std::shared_ptr<grpc::Channel>> channels_;
+  std::unordered_map<std::string, Entry> channels_;
+
+  std::mutex stop_mutex_;
+  std::condition_variable stop_cv_;
+  bool stopped_{false};
+  std::thread health_check_thread_;
 };
 
-ChannelPool::ChannelPool(std::unique_ptr<ChannelProvider> channel_provider)
-    : impl_(std::make_unique<Impl>(std::move(channel_provider))) {}
+ChannelPool::ChannelPool(std::unique_ptr<ChannelProvider> channel_provider,
+                         logger::LoggerPtr log)
+    : impl_(std::make_unique<Impl>(std::move(channel_provider),
+                                   std::move(log))) {}
 
 ChannelPool::~ChannelPool() = default;
 
@@ -55,3 +142,8 @@ Result<std::shared_ptr<grpc::Channel>, std::string> ChannelPool::getChannel(
     const shared_model::interface::Peer &peer) {
   return impl_->getOrCreate(service_full_name, peer);
 }
+
+void ChannelPool::warmup(const std::string &service_full_name,
+                         const shared_model::interface::types::PeerList &peers) {
+  impl_->warmup(service_full_name, peers);
+}
@@ -8,16 +8,27 @@
 
 #include "network/impl/channel_provider.hpp"
 
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+
 namespace iroha {
   namespace network {
 
+    /**
+     * Caches one channel per peer and manages its lifecycle: a cached
+     * channel is dropped and recreated when the peer address in the WSV
+     * changes or when the channel dies, and a background thread nudges
+     * failed channels to reconnect.
+     */
     class ChannelPool : public ChannelProvider {
      public:
       /**
        * @param channel_provider - Factory that is used to create missing
        * channels.
+       * @param log - logger for channel lifecycle events
        */
-      explicit ChannelPool(std::unique_ptr<ChannelProvider> channel_provider);
+      ChannelPool(std::unique_ptr<ChannelProvider> channel_provider,
+                  logger::LoggerPtr log);
 
       ~ChannelPool();
 
@@ -25,6 +36,16 @@ namespace iroha {
       getChannel(const std::string &service_full_name,
                  const shared_model::interface::Peer &peer) override;
 
+      /**
+       * Create and start connecting channels to all the given peers, so that
+       * the first real call does not pay for connection establishment.
+       * @param service_full_name - gRPC service full name the channels will
+       * serve first, e.g. iroha.consensus.yac.proto.Yac
+       * @param peers - the current ledger peers
+       */
+      void warmup(const std::string &service_full_name,
+                  const shared_model::interface::types::PeerList &peers);
+
      private:
       class Impl;
       std::unique_ptr<Impl> impl_;
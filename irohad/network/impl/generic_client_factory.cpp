@@ -8,5 +8,16 @@
 using namespace iroha::network;
 
 GenericClientFactory::GenericClientFactory(
-    std::unique_ptr<ChannelProvider> channel_provider)
+    std::shared_ptr<ChannelProvider> channel_provider)
     : channel_provider_(std::move(channel_provider)) {}
+
+iroha::expected::Result<std::unique_ptr<grpc::GenericStub>, std::string>
+GenericClientFactory::createGenericStub(
+    const std::string &service_full_name,
+    const shared_model::interface::Peer &peer) const {
+  using iroha::expected::operator|;
+  return channel_provider_->getChannel(service_full_name, peer) |
+             [](auto &&channel) -> std::unique_ptr<grpc::GenericStub> {
+    return std::make_unique<grpc::GenericStub>(std::move(channel));
+  };
+}
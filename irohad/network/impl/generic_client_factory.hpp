@@ -8,6 +8,7 @@
 
 #include <memory>
 
+#include <grpcpp/generic/generic_stub.h>
 #include "common/result.hpp"
 #include "network/impl/channel_provider.hpp"
 
@@ -16,7 +17,7 @@ namespace iroha {
 
     class GenericClientFactory {
      public:
-      GenericClientFactory(std::unique_ptr<ChannelProvider> channel_provider);
+      GenericClientFactory(std::shared_ptr<ChannelProvider> channel_provider);
 
       /**
        * Creates client which is capable of sending and receiving
@@ -37,8 +38,21 @@ namespace iroha {
         };
       }
 
+      /**
+       * Creates a generic stub over the same channel createClient would
+       * use, for calls that send pre-serialized request bytes instead of
+       * a typed message
+       * @param service_full_name the full name of the grpc service whose
+       *  channel arguments apply, e.g. iroha.consensus.yac.proto.Yac
+       * @param peer the target peer
+       * @return generic stub connected to that peer
+       */
+      iroha::expected::Result<std::unique_ptr<grpc::GenericStub>, std::string>
+      createGenericStub(const std::string &service_full_name,
+                        const shared_model::interface::Peer &peer) const;
+
      private:
-      std::unique_ptr<ChannelProvider> channel_provider_;
+      std::shared_ptr<ChannelProvider> channel_provider_;
     };
 
   }  // namespace network
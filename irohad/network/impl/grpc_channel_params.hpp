@@ -8,6 +8,8 @@
 
 #include <chrono>
 #include <limits>
+#include <string>
+#include <unordered_map>
 
 #include <boost/optional/optional.hpp>
 
@@ -25,6 +27,10 @@ namespace iroha {
       unsigned int max_request_message_bytes;
       unsigned int max_response_message_bytes;
       boost::optional<RetryPolicy> retry_policy;
+      /// channel-default compression algorithm ("gzip" or "deflate") per
+      /// gRPC service full name; services not listed send uncompressed
+      /// messages
+      std::unordered_map<std::string, std::string> service_compression;
     };
 
   }  // namespace network
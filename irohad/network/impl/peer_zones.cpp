@@ -0,0 +1,54 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/peer_zones.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+namespace {
+  std::string toLower(const std::string &str) {
+    std::string result{str};
+    std::transform(
+        result.begin(), result.end(), result.begin(), [](unsigned char c) {
+          return std::tolower(c);
+        });
+    return result;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace network {
+
+    PeerZones::PeerZones(
+        std::string own_zone,
+        std::unordered_map<std::string, std::string> peer_zones)
+        : own_zone_(std::move(own_zone)) {
+      // the keys come from a hand-written config, the lookups from the
+      // WSV - normalize the case so the two spellings of a key meet
+      for (auto &entry : peer_zones) {
+        zones_.emplace(toLower(entry.first), entry.second);
+      }
+    }
+
+    bool PeerZones::sameZone(const std::string &public_key_hex) const {
+      auto it = zones_.find(toLower(public_key_hex));
+      return it != zones_.end() and it->second == own_zone_;
+    }
+
+    shared_model::interface::types::PublicKeyCollectionType
+    PeerZones::preferSameZone(
+        const shared_model::interface::types::PublicKeyCollectionType
+            &public_keys) const {
+      auto ordered = public_keys;
+      std::stable_partition(
+          ordered.begin(), ordered.end(), [this](const auto &key) {
+            return sameZone(key);
+          });
+      return ordered;
+    }
+
+  }  // namespace network
+}  // namespace iroha
@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PEER_ZONES_HPP
+#define IROHA_PEER_ZONES_HPP
+
+#include <string>
+#include <unordered_map>
+
+#include "interfaces/common_objects/types.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Operator-assigned failure-domain (zone or region) labels of the
+     * ledger peers. Bulk transfers - block synchronization and MST state
+     * gossip - consult them to prefer a peer in the same zone over one
+     * across an inter-region link. Peers missing from the map never match
+     * the own zone, so an incomplete map degrades to the plain ordering,
+     * and consensus traffic does not use the labels at all.
+     */
+    class PeerZones {
+     public:
+      /**
+       * @param own_zone label of the zone this node runs in
+       * @param peer_zones peer public key (hex) to zone label
+       */
+      PeerZones(std::string own_zone,
+                std::unordered_map<std::string, std::string> peer_zones);
+
+      /// @return true if the given peer is labeled with the own zone
+      bool sameZone(const std::string &public_key_hex) const;
+
+      /**
+       * Reorder peer candidates so that the same-zone ones come first,
+       * keeping the relative order inside both groups
+       */
+      shared_model::interface::types::PublicKeyCollectionType preferSameZone(
+          const shared_model::interface::types::PublicKeyCollectionType
+              &public_keys) const;
+
+     private:
+      std::string own_zone_;
+
+      /// peer public key (lowercase hex) to zone label
+      std::unordered_map<std::string, std::string> zones_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_PEER_ZONES_HPP
@@ -0,0 +1,218 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/wsv_diff_service.hpp"
+
+#include <set>
+
+#include "backend/protobuf/permissions.hpp"
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/call_engine.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/compare_and_set_account_detail.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_peer.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/set_setting_value.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::network;
+
+namespace {
+  /**
+   * Accumulates the WSV entities touched by the commands of one block.
+   * A committed block contains only stateful-valid transactions, so the
+   * command arguments name exactly the rows the executor wrote.
+   */
+  struct DiffBuilder {
+    std::set<std::string> accounts;
+    std::set<std::string> assets;
+    iroha::network::proto::BlockWsvDiff diff;
+
+    void permission(const std::string &account_id,
+                    const std::string &name,
+                    bool removed) {
+      auto *entry = diff.add_permission_diffs();
+      entry->set_account_id(account_id);
+      entry->set_permission(name);
+      entry->set_removed(removed);
+    }
+
+    void role(const std::string &account_id,
+              const std::string &name,
+              bool removed) {
+      auto *entry = diff.add_permission_diffs();
+      entry->set_account_id(account_id);
+      entry->set_role(name);
+      entry->set_removed(removed);
+    }
+
+    void command(const shared_model::interface::Command &command,
+                 const std::string &creator) {
+      using namespace shared_model::interface;
+      iroha::visit_in_place(
+          command.get(),
+          [&](const AddAssetQuantity &cmd) {
+            accounts.insert(creator);
+            assets.insert(cmd.assetId());
+          },
+          [&](const SubtractAssetQuantity &cmd) {
+            accounts.insert(creator);
+            assets.insert(cmd.assetId());
+          },
+          [&](const TransferAsset &cmd) {
+            accounts.insert(cmd.srcAccountId());
+            accounts.insert(cmd.destAccountId());
+            assets.insert(cmd.assetId());
+          },
+          [&](const CreateAccount &cmd) {
+            accounts.insert(cmd.accountName() + "@" + cmd.domainId());
+          },
+          [&](const CreateAsset &cmd) {
+            assets.insert(cmd.assetName() + "#" + cmd.domainId());
+          },
+          [&](const AddSignatory &cmd) { accounts.insert(cmd.accountId()); },
+          [&](const RemoveSignatory &cmd) { accounts.insert(cmd.accountId()); },
+          [&](const SetQuorum &cmd) { accounts.insert(cmd.accountId()); },
+          [&](const SetAccountDetail &cmd) {
+            accounts.insert(cmd.accountId());
+          },
+          [&](const CompareAndSetAccountDetail &cmd) {
+            accounts.insert(cmd.accountId());
+          },
+          [&](const AppendRole &cmd) {
+            accounts.insert(cmd.accountId());
+            role(cmd.accountId(), cmd.roleName(), false);
+          },
+          [&](const DetachRole &cmd) {
+            accounts.insert(cmd.accountId());
+            role(cmd.accountId(), cmd.roleName(), true);
+          },
+          [&](const GrantPermission &cmd) {
+            // the grantable permission row links the grantee to the
+            // creator's account, so both documents go stale
+            accounts.insert(creator);
+            accounts.insert(cmd.accountId());
+            permission(
+                cmd.accountId(),
+                shared_model::proto::permissions::toString(
+                    cmd.permissionName()),
+                false);
+          },
+          [&](const RevokePermission &cmd) {
+            accounts.insert(creator);
+            accounts.insert(cmd.accountId());
+            permission(
+                cmd.accountId(),
+                shared_model::proto::permissions::toString(
+                    cmd.permissionName()),
+                true);
+          },
+          [&](const CallEngine &cmd) {
+            accounts.insert(cmd.caller());
+            if (auto callee = cmd.callee()) {
+              accounts.insert(callee->get());
+            }
+          },
+          // domain, role, peer and settings changes do not touch any
+          // existing account or asset document
+          [](const AddPeer &) {},
+          [](const RemovePeer &) {},
+          [](const CreateDomain &) {},
+          [](const CreateRole &) {},
+          [](const SetSettingValue &) {});
+    }
+
+    proto::BlockWsvDiff build(
+        shared_model::interface::types::HeightType height) && {
+      diff.set_height(height);
+      for (auto &account : accounts) {
+        diff.add_account_ids(account);
+      }
+      for (auto &asset : assets) {
+        diff.add_asset_ids(asset);
+      }
+      return std::move(diff);
+    }
+  };
+}  // namespace
+
+WsvDiffService::WsvDiffService(logger::LoggerPtr log)
+    : log_(std::move(log)) {}
+
+WsvDiffService::~WsvDiffService() {
+  // the commit subscription captures this
+  subscription_.unsubscribe();
+}
+
+void WsvDiffService::subscribeTo(
+    rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
+        commits) {
+  commits.subscribe(subscription_,
+                    [this](const auto &block) { this->push(*block); });
+}
+
+void WsvDiffService::push(const shared_model::interface::Block &block) {
+  DiffBuilder builder;
+  for (const auto &transaction : block.transactions()) {
+    for (const auto &command : transaction.commands()) {
+      builder.command(command, transaction.creatorAccountId());
+    }
+  }
+  auto diff = std::move(builder).build(block.height());
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  diffs_.push_back(std::move(diff));
+  if (diffs_.size() > kRetainedDiffs) {
+    diffs_.pop_front();
+  }
+}
+
+grpc::Status WsvDiffService::retrieveDiffs(
+    ::grpc::ServerContext *context,
+    const proto::WsvDiffRequest *request,
+    ::grpc::ServerWriter<proto::BlockWsvDiff> *writer) {
+  std::vector<proto::BlockWsvDiff> to_send;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (not diffs_.empty() and request->height() < diffs_.front().height()) {
+      // the requested range has left the window; the feeder has to fall
+      // back to block retrieval for the evicted part
+      return grpc::Status(
+          grpc::StatusCode::NOT_FOUND,
+          "Diffs below height " + std::to_string(diffs_.front().height())
+              + " are no longer retained.");
+    }
+    for (const auto &diff : diffs_) {
+      if (diff.height() >= request->height()) {
+        to_send.push_back(diff);
+      }
+    }
+  }
+
+  for (const auto &diff : to_send) {
+    if (not writer->Write(diff)) {
+      log_->error("Broken stream to {}", context->peer());
+      break;
+    }
+  }
+  return grpc::Status::OK;
+}
@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_DIFF_SERVICE_HPP
+#define IROHA_WSV_DIFF_SERVICE_HPP
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include <rxcpp/rx-lite.hpp>
+#include "logger/logger_fwd.hpp"
+#include "wsv_diff.grpc.pb.h"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Serves per-block WSV diffs - the account ids, asset ids and
+     * permission changes touched by each committed block - to external
+     * read model feeders. The diff is derived from the decoded command
+     * objects of the block at commit time, where that information is
+     * already in memory, so the feeder does not have to run a second
+     * full decode of the chain to learn what to invalidate. Diffs for
+     * the most recent kRetainedDiffs blocks are retained; a request
+     * below the retained window is refused, telling the feeder to fall
+     * back to block retrieval for the gap.
+     */
+    class WsvDiffService : public proto::WsvDiff::Service {
+     public:
+      /// number of most recent block diffs retained
+      static constexpr size_t kRetainedDiffs = 256;
+
+      explicit WsvDiffService(logger::LoggerPtr log);
+      ~WsvDiffService() override;
+
+      WsvDiffService(const WsvDiffService &) = delete;
+      WsvDiffService &operator=(const WsvDiffService &) = delete;
+
+      /// retain diffs of commits from the given observable for as long
+      /// as this object lives
+      void subscribeTo(
+          rxcpp::observable<
+              std::shared_ptr<const shared_model::interface::Block>> commits);
+
+      /// build and store the diff of a committed block, evicting the
+      /// oldest one when full
+      void push(const shared_model::interface::Block &block);
+
+      grpc::Status retrieveDiffs(
+          ::grpc::ServerContext *context,
+          const proto::WsvDiffRequest *request,
+          ::grpc::ServerWriter<proto::BlockWsvDiff> *writer) override;
+
+     private:
+      logger::LoggerPtr log_;
+
+      mutable std::mutex mutex_;
+      std::deque<proto::BlockWsvDiff> diffs_;
+      rxcpp::composite_subscription subscription_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_WSV_DIFF_SERVICE_HPP
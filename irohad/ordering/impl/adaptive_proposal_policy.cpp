@@ -0,0 +1,104 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/adaptive_proposal_policy.hpp"
+
+#include <algorithm>
+
+#include "logger/logger.hpp"
+#include "ordering/impl/on_demand_common.hpp"
+
+using namespace iroha::ordering;
+
+namespace {
+  /// weight of the newest observation in the round interval average
+  constexpr uint32_t kEwmaNewWeight = 1;
+  constexpr uint32_t kEwmaTotalWeight = 8;
+  /// a round interval this many times above the average counts as a
+  /// congestion signal even when the round itself committed
+  constexpr uint32_t kSlowRoundFactor = 2;
+  /// the adaptive timeout never exceeds this multiple of the configured one
+  constexpr uint32_t kMaxTimeoutFactor = 4;
+}  // namespace
+
+AdaptiveProposalPolicy::AdaptiveProposalPolicy(
+    size_t max_transaction_limit,
+    std::chrono::milliseconds base_timeout,
+    logger::LoggerPtr log)
+    : max_transaction_limit_(max_transaction_limit),
+      min_transaction_limit_(std::max<size_t>(1, max_transaction_limit / 8)),
+      limit_increase_step_(std::max<size_t>(1, max_transaction_limit / 8)),
+      base_timeout_(base_timeout),
+      max_timeout_(base_timeout * kMaxTimeoutFactor),
+      log_(std::move(log)),
+      transaction_limit_(max_transaction_limit),
+      proposal_timeout_(base_timeout) {}
+
+void AdaptiveProposalPolicy::onRound(consensus::Round const &round,
+                                     size_t cached_txs_count) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  auto now = ClockType::now();
+  std::chrono::milliseconds interval{0};
+  if (has_last_round_time_) {
+    interval = std::chrono::duration_cast<std::chrono::milliseconds>(
+        now - last_round_time_);
+    round_interval_ewma_ =
+        (round_interval_ewma_ * (kEwmaTotalWeight - kEwmaNewWeight)
+         + interval * kEwmaNewWeight)
+        / kEwmaTotalWeight;
+  }
+  last_round_time_ = now;
+  has_last_round_time_ = true;
+
+  bool const is_reject_round = round.reject_round != kFirstRejectRound;
+  bool const is_slow_round = round_interval_ewma_.count() != 0
+      and interval > round_interval_ewma_ * kSlowRoundFactor;
+
+  auto const previous_limit = transaction_limit_;
+  auto const previous_timeout = proposal_timeout_;
+
+  if (is_reject_round or is_slow_round) {
+    // multiplicative decrease: the peers could not agree on (or deliver) a
+    // proposal of the current size in time
+    transaction_limit_ =
+        std::max(min_transaction_limit_, transaction_limit_ / 2);
+    proposal_timeout_ = std::min(max_timeout_, proposal_timeout_ * 3 / 2);
+  } else {
+    // additive increase only under actual demand, so an idle network does
+    // not inflate the limit just to have it collapse on the next burst
+    if (cached_txs_count > transaction_limit_) {
+      transaction_limit_ = std::min(
+          max_transaction_limit_, transaction_limit_ + limit_increase_step_);
+    }
+    proposal_timeout_ = std::max(
+        base_timeout_, (proposal_timeout_ + base_timeout_) / 2);
+  }
+
+  if (transaction_limit_ != previous_limit
+      or proposal_timeout_ != previous_timeout) {
+    log_->info(
+        "onRound {}: transaction limit {} -> {}, proposal timeout {} -> "
+        "{}ms (interval {}ms, average {}ms, cached {})",
+        round,
+        previous_limit,
+        transaction_limit_,
+        previous_timeout.count(),
+        proposal_timeout_.count(),
+        interval.count(),
+        round_interval_ewma_.count(),
+        cached_txs_count);
+  }
+}
+
+size_t AdaptiveProposalPolicy::transactionLimit() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return transaction_limit_;
+}
+
+std::chrono::milliseconds AdaptiveProposalPolicy::proposalTimeout() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return proposal_timeout_;
+}
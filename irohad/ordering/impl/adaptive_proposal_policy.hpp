@@ -0,0 +1,78 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ADAPTIVE_PROPOSAL_POLICY_HPP
+#define IROHA_ADAPTIVE_PROPOSAL_POLICY_HPP
+
+#include <chrono>
+#include <mutex>
+
+#include "consensus/round.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Feedback controller for proposal packing and proposal request
+     * deadlines. Observes the round outcomes reported by the ordering
+     * service: reject rounds and round intervals far above the smoothed
+     * average indicate that the network cannot digest the current proposal
+     * size in time, so the transaction limit is halved and the request
+     * timeout is stretched. Commit rounds with a deep batch cache grow the
+     * limit back additively towards the configured maximum, which stays a
+     * hard cap. All methods are thread-safe.
+     */
+    class AdaptiveProposalPolicy {
+     public:
+      /**
+       * @param max_transaction_limit configured maximum number of
+       * transactions in one proposal, upper bound for the adaptive limit
+       * @param base_timeout configured proposal request timeout, lower
+       * bound for the adaptive timeout
+       * @param log to print limit and timeout changes
+       */
+      AdaptiveProposalPolicy(size_t max_transaction_limit,
+                             std::chrono::milliseconds base_timeout,
+                             logger::LoggerPtr log);
+
+      /**
+       * Report a finished round
+       * @param round the round the consensus switched to
+       * @param cached_txs_count number of transactions waiting in the batch
+       * cache
+       */
+      void onRound(consensus::Round const &round, size_t cached_txs_count);
+
+      /// @return current number of transactions allowed in one proposal
+      size_t transactionLimit() const;
+
+      /// @return current proposal request timeout
+      std::chrono::milliseconds proposalTimeout() const;
+
+     private:
+      using ClockType = std::chrono::steady_clock;
+
+      size_t const max_transaction_limit_;
+      size_t const min_transaction_limit_;
+      size_t const limit_increase_step_;
+      std::chrono::milliseconds const base_timeout_;
+      std::chrono::milliseconds const max_timeout_;
+      logger::LoggerPtr log_;
+
+      mutable std::mutex mutex_;
+      size_t transaction_limit_;
+      std::chrono::milliseconds proposal_timeout_;
+      /// exponentially weighted moving average of the interval between
+      /// consecutive rounds, 0 until the second round is seen
+      std::chrono::milliseconds round_interval_ewma_{0};
+      ClockType::time_point last_round_time_;
+      bool has_last_round_time_{false};
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ADAPTIVE_PROPOSAL_POLICY_HPP
@@ -0,0 +1,262 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/batch_journal.hpp"
+
+#include <cstring>
+#include <fstream>
+
+#include <boost/filesystem.hpp>
+#include <boost/range/size.hpp>
+#include "cryptography/blob.hpp"
+#include "interfaces/iroha_internal/parse_and_create_batches.hpp"
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+#include "transaction.pb.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <fileapi.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+  constexpr char kBatchRecord = 'B';
+
+  template <typename IntType>
+  void putInt(std::string &buffer, IntType value) {
+    char bytes[sizeof(IntType)];
+    std::memcpy(bytes, &value, sizeof(IntType));
+    buffer.append(bytes, sizeof(IntType));
+  }
+
+  void putString(std::string &buffer, const std::string &value) {
+    putInt<uint32_t>(buffer, value.size());
+    buffer.append(value);
+  }
+
+  /// reads an integer, returns false on a truncated record
+  template <typename IntType>
+  bool getInt(std::istream &in, IntType &value) {
+    char bytes[sizeof(IntType)];
+    if (not in.read(bytes, sizeof(IntType))) {
+      return false;
+    }
+    std::memcpy(&value, bytes, sizeof(IntType));
+    return true;
+  }
+
+  bool getString(std::istream &in, std::string &value) {
+    uint32_t size{};
+    if (not getInt(in, size)) {
+      return false;
+    }
+    value.resize(size);
+    return static_cast<bool>(in.read(&value[0], size));
+  }
+
+  std::string serializeBatch(
+      const shared_model::interface::TransactionBatch &batch) {
+    std::string record;
+    record.push_back(kBatchRecord);
+    putInt<uint32_t>(record, boost::size(batch.transactions()));
+    for (const auto &tx : batch.transactions()) {
+      putString(record, shared_model::crypto::toBinaryString(tx->blob()));
+    }
+    return record;
+  }
+
+  bool fsyncHandle(
+      boost::iostreams::file_descriptor_sink::handle_type handle) {
+#ifdef _WIN32
+    return FlushFileBuffers(handle);
+#else
+    return fsync(handle) == 0;
+#endif
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ordering {
+
+    BatchJournal::BatchJournal(
+        std::string path,
+        std::shared_ptr<TransportFactoryType> transaction_factory,
+        std::shared_ptr<shared_model::interface::TransactionBatchParser>
+            batch_parser,
+        std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+            batch_factory,
+        logger::LoggerPtr log)
+        : path_(std::move(path)),
+          transaction_factory_(std::move(transaction_factory)),
+          batch_parser_(std::move(batch_parser)),
+          batch_factory_(std::move(batch_factory)),
+          log_(std::move(log)),
+          last_sync_(std::chrono::steady_clock::now()) {
+      load();
+      try {
+        out_.open(path_, std::ios::binary | std::ios::app);
+      } catch (const std::exception &e) {
+        log_->error(
+            "Cannot open batch journal {} for writing: {}", path_, e.what());
+      }
+      if (not out_.is_open()) {
+        log_->error("Cannot open batch journal {} for writing", path_);
+      }
+    }
+
+    void BatchJournal::append(
+        const shared_model::interface::TransactionBatch &batch) {
+      auto record = serializeBatch(batch);
+
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (not out_.is_open()) {
+        return;
+      }
+      out_.write(record.data(), record.size());
+      out_.flush();
+      if (not out_) {
+        log_->error("Cannot append to batch journal {}", path_);
+        return;
+      }
+      ++appends_since_sync_;
+      if (appends_since_sync_ >= kGroupAppends
+          or std::chrono::steady_clock::now() - last_sync_
+              >= kGroupInterval) {
+        sync();
+      }
+    }
+
+    void BatchJournal::rewrite(
+        const shared_model::interface::types::BatchesCollectionType
+            &batches) {
+      const auto tmp_path = path_ + ".tmp";
+      // the lock keeps concurrent appends off the file about to be
+      // replaced; they land in the compacted journal instead
+      std::lock_guard<std::mutex> guard(mutex_);
+      {
+        boost::iostreams::stream<boost::iostreams::file_descriptor_sink>
+            tmp_out;
+        try {
+          tmp_out.open(tmp_path, std::ios::binary | std::ios::trunc);
+        } catch (const std::exception &e) {
+          log_->error("Cannot open {} for journal compaction: {}",
+                      tmp_path,
+                      e.what());
+          return;
+        }
+        if (not tmp_out.is_open()) {
+          log_->error("Cannot open {} for journal compaction", tmp_path);
+          return;
+        }
+        for (const auto &batch : batches) {
+          auto record = serializeBatch(*batch);
+          tmp_out.write(record.data(), record.size());
+        }
+        tmp_out.flush();
+        if (not tmp_out or not fsyncHandle(tmp_out->handle())) {
+          log_->error("Cannot write the compacted batch journal {}",
+                      tmp_path);
+          return;
+        }
+      }
+      out_.close();
+      boost::system::error_code error_code;
+      boost::filesystem::rename(tmp_path, path_, error_code);
+      if (error_code != boost::system::errc::success) {
+        log_->error("Cannot compact batch journal {}: {}",
+                    path_,
+                    error_code.message());
+      }
+      try {
+        out_.open(path_, std::ios::binary | std::ios::app);
+      } catch (const std::exception &e) {
+        log_->error(
+            "Cannot reopen batch journal {}: {}", path_, e.what());
+      }
+      appends_since_sync_ = 0;
+      last_sync_ = std::chrono::steady_clock::now();
+    }
+
+    shared_model::interface::types::BatchesCollectionType
+    BatchJournal::takeReplayedBatches() {
+      std::lock_guard<std::mutex> guard(mutex_);
+      return std::move(replayed_);
+    }
+
+    void BatchJournal::load() {
+      std::ifstream in(path_, std::ios::binary);
+      if (not in.is_open()) {
+        return;
+      }
+      char record_type{};
+      while (in.get(record_type)) {
+        if (record_type != kBatchRecord) {
+          log_->error("Unknown record type in batch journal {}", path_);
+          break;
+        }
+        uint32_t tx_count{};
+        if (not getInt(in, tx_count)) {
+          break;
+        }
+        shared_model::interface::types::SharedTxsCollectionType transactions;
+        transactions.reserve(tx_count);
+        bool complete = true;
+        for (uint32_t i = 0; i < tx_count; ++i) {
+          std::string blob;
+          if (not getString(in, blob)) {
+            complete = false;
+            break;
+          }
+          iroha::protocol::Transaction proto_tx;
+          if (not proto_tx.ParseFromString(blob)) {
+            log_->error("Corrupt transaction in batch journal {}", path_);
+            complete = false;
+            break;
+          }
+          auto transaction = transaction_factory_->build(proto_tx);
+          if (auto e = expected::resultToOptionalError(transaction)) {
+            log_->warn("Journaled transaction rejected: hash {}, {}",
+                       e->hash,
+                       e->error);
+            complete = false;
+            break;
+          }
+          transactions.push_back(std::move(transaction).assumeValue());
+        }
+        if (not complete) {
+          // a truncated or rejected tail record, as after a crash
+          // mid-append; the complete prefix is still replayed
+          break;
+        }
+        auto batches = shared_model::interface::parseAndCreateBatches(
+            *batch_parser_, *batch_factory_, transactions);
+        if (auto e = expected::resultToOptionalError(batches)) {
+          log_->warn("Journaled batch rejected: {}", *e);
+          continue;
+        }
+        for (auto &batch : std::move(batches).assumeValue()) {
+          replayed_.push_back(std::move(batch));
+        }
+      }
+      if (not replayed_.empty()) {
+        log_->info("Replayed {} batches from the journal {}",
+                   replayed_.size(),
+                   path_);
+      }
+    }
+
+    void BatchJournal::sync() {
+      if (not fsyncHandle(out_->handle())) {
+        log_->warn("Cannot fsync batch journal {}", path_);
+      }
+      appends_since_sync_ = 0;
+      last_sync_ = std::chrono::steady_clock::now();
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ON_DEMAND_BATCH_JOURNAL_HPP
+#define IROHA_ON_DEMAND_BATCH_JOURNAL_HPP
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/iostreams/device/file_descriptor.hpp>
+#include <boost/iostreams/stream.hpp>
+#include "interfaces/iroha_internal/abstract_transport_factory.hpp"
+#include "interfaces/iroha_internal/transaction_batch_factory.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace protocol {
+    class Transaction;
+  }
+}  // namespace iroha
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Append-only journal of the batches accepted by the on demand
+     * ordering service but not yet committed, kept in a plain file next
+     * to the block store. After a crash the journal is replayed into the
+     * batch cache at startup, so the accepted-but-unordered transactions
+     * reenter the next proposal in milliseconds instead of waiting for
+     * client resubmission or MST re-propagation.
+     *
+     * Appends are group-fsynced: a group of appended batches costs one
+     * disk barrier instead of one per batch. At commit the journal is
+     * compacted to the still cached batches. The journal is a recovery
+     * aid, not a ledger structure - a record lost in the sync window or
+     * during a compaction only costs a resubmission after a crash.
+     */
+    class BatchJournal {
+     public:
+      using TransportFactoryType =
+          shared_model::interface::AbstractTransportFactory<
+              shared_model::interface::Transaction,
+              iroha::protocol::Transaction>;
+
+      /**
+       * Opens the journal, replaying the existing records, if any
+       * @param path of the journal file
+       * @param transaction_factory transport factory to rebuild the
+       * journaled transactions on replay
+       * @param batch_parser splits the replayed transactions into batches
+       * @param batch_factory rebuilds the batch candidates of the parser
+       * @param log to report read and write failures to
+       */
+      BatchJournal(
+          std::string path,
+          std::shared_ptr<TransportFactoryType> transaction_factory,
+          std::shared_ptr<shared_model::interface::TransactionBatchParser>
+              batch_parser,
+          std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+              batch_factory,
+          logger::LoggerPtr log);
+
+      /**
+       * Append an accepted batch to the journal. The record reaches the
+       * OS buffer before return; the disk barrier is deferred until
+       * kGroupAppends records or kGroupInterval has accumulated.
+       */
+      void append(const shared_model::interface::TransactionBatch &batch);
+
+      /**
+       * Replace the journal with the given still live batches. Called
+       * when a commit removes batches from the cache, so the journal
+       * does not grow with the ledger. The new journal is fsynced and
+       * atomically renamed over the old one.
+       */
+      void rewrite(
+          const shared_model::interface::types::BatchesCollectionType
+              &batches);
+
+      /**
+       * @return the batches replayed from the journal on open; the
+       * internal collection is left empty
+       */
+      shared_model::interface::types::BatchesCollectionType
+      takeReplayedBatches();
+
+     private:
+      /// replay the journal from disk into replayed_
+      void load();
+
+      /// issue the deferred disk barrier; requires mutex_
+      void sync();
+
+      /// number of appended batches fsynced with one barrier
+      static constexpr size_t kGroupAppends = 32;
+
+      /// longest time appended batches may stay without a barrier
+      static constexpr std::chrono::milliseconds kGroupInterval{100};
+
+      const std::string path_;
+      std::shared_ptr<TransportFactoryType> transaction_factory_;
+      std::shared_ptr<shared_model::interface::TransactionBatchParser>
+          batch_parser_;
+      std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+          batch_factory_;
+      logger::LoggerPtr log_;
+
+      std::mutex mutex_;
+      boost::iostreams::stream<boost::iostreams::file_descriptor_sink> out_;
+      size_t appends_since_sync_{0};
+      std::chrono::steady_clock::time_point last_sync_;
+      shared_model::interface::types::BatchesCollectionType replayed_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ON_DEMAND_BATCH_JOURNAL_HPP
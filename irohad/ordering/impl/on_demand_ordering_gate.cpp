@@ -13,6 +13,7 @@
 #include <boost/range/empty.hpp>
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "ametsuchi/tx_presence_cache_utils.hpp"
+#include "backend/protobuf/proposal_view.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
@@ -120,6 +121,21 @@ OnDemandOrderingGate::processProposalRequest(
   if (not proposal) {
     return boost::none;
   }
+  if (auto view = std::dynamic_pointer_cast<
+          const shared_model::proto::ProposalView>(*proposal)) {
+    // replay check over the shallow hashes: a typical reject round
+    // proposal repeats transactions which are already committed, and it
+    // is dropped here without materializing the transaction wrappers
+    auto const &hashes = view->transactionHashes();
+    auto all_processed =
+        std::all_of(hashes.begin(), hashes.end(), [this](auto const &hash) {
+          auto tx_result = tx_cache_->check(hash);
+          return tx_result and ametsuchi::isAlreadyProcessed(*tx_result);
+        });
+    if (all_processed) {
+      return boost::none;
+    }
+  }
   auto proposal_without_replays =
       removeReplaysAndDuplicates(*std::move(proposal));
   // no need to check empty proposal
@@ -5,6 +5,9 @@
 
 #include "ordering/impl/on_demand_ordering_service_impl.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <unordered_set>
 
 #include <boost/optional.hpp>
@@ -15,17 +18,93 @@
 #include <boost/range/size.hpp>
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "ametsuchi/tx_presence_cache_utils.hpp"
+#include "common/memory_budget.hpp"
 #include "common/visitor.hpp"
 #include "datetime/time.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "metrics/pipeline_snapshots.hpp"
+#include "metrics/tx_latency_tracer.hpp"
+#include "ordering/impl/adaptive_proposal_policy.hpp"
+#include "ordering/impl/batch_journal.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
 using TransactionBatchType = transport::OdOsNotification::TransactionBatchType;
 
+namespace {
+  std::atomic<size_t> next_staging_shard{0};
+
+  /// the staging shard an ingress thread inserts to; drawn round-robin
+  /// once per thread, so the inserts of one thread stay effectively
+  /// single-producer on its shard
+  size_t stagingShardIndex(size_t shard_count) {
+    static thread_local size_t index =
+        next_staging_shard.fetch_add(1, std::memory_order_relaxed);
+    return index % shard_count;
+  }
+
+  uint64_t accountBit(const std::string &account_id) {
+    return uint64_t{1} << (std::hash<std::string>{}(account_id) % 64);
+  }
+
+  /**
+   * Bitmask sketch of the accounts a batch touches: the creators and,
+   * for transfers, both transfer sides. Batches with disjoint sketches
+   * certainly touch disjoint accounts; an intersection means a possible
+   * conflict which serializes stateful validation of the neighbours.
+   */
+  uint64_t conflictSketch(
+      const shared_model::interface::TransactionBatch &batch) {
+    uint64_t sketch = 0;
+    for (const auto &tx : batch.transactions()) {
+      sketch |= accountBit(tx->creatorAccountId());
+      for (const auto &command : tx->commands()) {
+        iroha::visit_in_place(
+            command.get(),
+            [&](const shared_model::interface::TransferAsset &transfer) {
+              sketch |=
+                  accountBit(transfer.srcAccountId())
+                  | accountBit(transfer.destAccountId());
+            },
+            [](const auto &) {});
+      }
+    }
+    return sketch;
+  }
+
+  /**
+   * Reorder batches so that neighbours conflict as rarely as possible:
+   * when a batch conflicts with its predecessor, the first batch within
+   * the lookahead window with a disjoint sketch takes its place. A batch
+   * arriving by itself or a window full of one hot account keep their
+   * order, so the pass never starves a group - it only spreads it apart
+   * to widen what the validator can run in parallel. Deterministic for a
+   * given input order.
+   */
+  void spreadConflictGroups(std::vector<TransactionBatchType> &batches,
+                            std::vector<uint64_t> &sketches) {
+    constexpr size_t kLookahead = 8;
+    for (size_t pos = 1; pos < batches.size(); ++pos) {
+      if ((sketches[pos] & sketches[pos - 1]) == 0) {
+        continue;
+      }
+      const size_t limit = std::min(batches.size(), pos + kLookahead);
+      for (size_t probe = pos + 1; probe < limit; ++probe) {
+        if ((sketches[probe] & sketches[pos - 1]) == 0) {
+          std::swap(batches[pos], batches[probe]);
+          std::swap(sketches[pos], sketches[probe]);
+          break;
+        }
+      }
+    }
+  }
+}  // namespace
+
 OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     size_t transaction_limit,
     std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
@@ -33,13 +112,51 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
     logger::LoggerPtr log,
-    size_t number_of_proposals)
+    size_t number_of_proposals,
+    std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy,
+    size_t proposal_byte_limit,
+    std::function<void()> batches_arrived_callback,
+    std::shared_ptr<BatchJournal> batch_journal)
     : transaction_limit_(transaction_limit),
+      proposal_byte_limit_(proposal_byte_limit),
       number_of_proposals_(number_of_proposals),
       proposal_factory_(std::move(proposal_factory)),
       tx_cache_(std::move(tx_cache)),
       proposal_creation_strategy_(std::move(proposal_creation_strategy)),
-      log_(std::move(log)) {}
+      adaptive_policy_(std::move(adaptive_policy)),
+      batches_arrived_callback_(std::move(batches_arrived_callback)),
+      batch_journal_(std::move(batch_journal)),
+      log_(std::move(log)),
+      proposal_counter_(metrics::MetricsRegistry::instance().makeCounter(
+          "iroha_proposals_created_total",
+          "Proposals packed by the on demand ordering service")),
+      proposal_creation_duration_(
+          metrics::MetricsRegistry::instance().makeHistogram(
+              "iroha_proposal_creation_duration_seconds",
+              "Time spent packing one proposal",
+              metrics::Histogram::defaultDurationBounds())),
+      proposal_bytes_(metrics::MetricsRegistry::instance().makeHistogram(
+          "iroha_proposal_bytes",
+          "Serialized size of the transactions of one packed proposal",
+          {1024.,
+           4096.,
+           16384.,
+           65536.,
+           262144.,
+           1048576.,
+           4194304.,
+           16777216.})) {
+  if (batch_journal_) {
+    // batches accepted before a crash reenter the cache; the ones that
+    // got committed meanwhile are dropped by the presence check, same
+    // as a network duplicate
+    for (auto &batch : batch_journal_->takeReplayedBatches()) {
+      if (not batchAlreadyProcessed(*batch)) {
+        stageBatch(batch);
+      }
+    }
+  }
+}
 
 // -------------------------| OnDemandOrderingService |-------------------------
 
@@ -47,6 +164,20 @@ void OnDemandOrderingServiceImpl::onCollaborationOutcome(
     consensus::Round round) {
   log_->info("onCollaborationOutcome => {}", round);
   current_round_ = round;
+  size_t cached_batches_count = 0;
+  size_t cached_txs_count = 0;
+  forCachedBatches([&cached_batches_count, &cached_txs_count](
+                       auto const &batches) {
+    cached_batches_count = batches.size();
+    for (auto const &batch : batches) {
+      cached_txs_count += boost::size(batch->transactions());
+    }
+  });
+  iroha::metrics::PipelineSnapshots::instance().setOrderingCache(
+      cached_batches_count, cached_txs_count);
+  if (adaptive_policy_) {
+    adaptive_policy_->onRound(round, cached_txs_count);
+  }
   uploadProposal(round);
   tryErase(round);
 }
@@ -60,9 +191,16 @@ void OnDemandOrderingServiceImpl::onBatches(CollectionType batches) {
                     batch->reducedHash().hex());
         return not this->batchAlreadyProcessed(*batch);
       });
+  bool inserted_any = false;
   std::for_each(unprocessed_batches.begin(),
                 unprocessed_batches.end(),
-                [this](auto &obj) { insertBatchToCache(obj); });
+                [this, &inserted_any](auto &obj) {
+                  insertBatchToCache(obj);
+                  inserted_any = true;
+                });
+  if (inserted_any and batches_arrived_callback_) {
+    batches_arrived_callback_();
+  }
   log_->info("onBatches => collection size = {}", batches.size());
 }
 
@@ -82,27 +220,200 @@ OnDemandOrderingServiceImpl::onRequestProposal(consensus::Round round) {
 // ---------------------------------| Private |---------------------------------
 void OnDemandOrderingServiceImpl::insertBatchToCache(
     std::shared_ptr<shared_model::interface::TransactionBatch> const &batch) {
+  stageBatch(batch);
+  if (batch_journal_) {
+    batch_journal_->append(*batch);
+  }
+}
+
+void OnDemandOrderingServiceImpl::stageBatch(
+    std::shared_ptr<shared_model::interface::TransactionBatch> const &batch) {
+  for (const auto &tx : batch->transactions()) {
+    metrics::TxLatencyTracer::instance().recordStage(
+        tx->hash().hex(), metrics::TxStage::kOrderingCacheInserted);
+  }
+  // the round cache starts holding the batch right here, in the staging
+  // area; a duplicate is given back to the budget when it is dropped at
+  // drain time
+  MemoryBudget::instance().charge(batchMemoryUse(*batch));
+  // ingress threads only stage the batch; the cache itself is touched by
+  // its readers, so concurrent onBatches calls do not contend on
+  // batches_cache_cs_, and threads on different cores do not contend on
+  // one shard head either
+  staged_shards_[stagingShardIndex(kStagingShards)].push(batch);
+}
+
+bool OnDemandOrderingServiceImpl::hasStagedBatches() const {
+  for (auto const &shard : staged_shards_) {
+    if (not shard.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void OnDemandOrderingServiceImpl::drainStagedBatches() {
+  if (not hasStagedBatches()) {
+    return;
+  }
+  // take the staged portion of every shard; within one shard the order
+  // is the arrival order
+  std::array<std::vector<
+                 std::shared_ptr<shared_model::interface::TransactionBatch>>,
+             kStagingShards>
+      drained;
+  std::array<size_t, kStagingShards> heads{};
+  for (size_t i = 0; i < kStagingShards; ++i) {
+    staged_shards_[i].drain([&drained, i](auto &&batch) {
+      drained[i].push_back(std::move(batch));
+    });
+  }
+  // account sketches are computed off the lock, once per drained batch
+  std::array<std::vector<uint64_t>, kStagingShards> sketches;
+  for (size_t i = 0; i < kStagingShards; ++i) {
+    sketches[i].reserve(drained[i].size());
+    for (auto const &batch : drained[i]) {
+      sketches[i].push_back(conflictSketch(*batch));
+    }
+  }
   std::lock_guard<std::shared_timed_mutex> lock(batches_cache_cs_);
-  batches_cache_.insert(batch);
+  // merge the shard cursors: among the shard fronts the smallest
+  // reduced hash goes first, so the merged order depends on the batches
+  // only, not on which thread landed on which shard
+  std::vector<TransactionBatchType> appended;
+  std::vector<uint64_t> appended_sketches;
+  while (true) {
+    size_t next = kStagingShards;
+    for (size_t i = 0; i < kStagingShards; ++i) {
+      if (heads[i] == drained[i].size()) {
+        continue;
+      }
+      if (next == kStagingShards
+          or drained[i][heads[i]]->reducedHash().blob()
+              < drained[next][heads[next]]->reducedHash().blob()) {
+        next = i;
+      }
+    }
+    if (next == kStagingShards) {
+      break;
+    }
+    const auto head = heads[next]++;
+    auto batch = std::move(drained[next][head]);
+    auto bytes = batchMemoryUse(*batch);
+    auto result = batches_cache_.insert(std::move(batch));
+    if (result.second) {
+      appended.push_back(*result.first);
+      appended_sketches.push_back(sketches[next][head]);
+    } else {
+      // a duplicate was dropped, only one copy stays accounted
+      MemoryBudget::instance().release(bytes);
+    }
+  }
+  // conflicting batches are spread apart before they take their
+  // pre-packed slots, so the next proposal does not put transactions of
+  // one hot account back to back
+  spreadConflictGroups(appended, appended_sketches);
+  for (auto const &batch : appended) {
+    appendToPrepacked(batch);
+  }
+}
+
+void OnDemandOrderingServiceImpl::appendToPrepacked(
+    transport::OdOsNotification::TransactionBatchType const &batch) {
+  if (prepacked_stale_) {
+    return;
+  }
+  auto batch_size = boost::size(batch->transactions());
+  auto batch_bytes = batchMemoryUse(*batch);
+  auto packed_bytes =
+      prepacked_byte_ends_.empty() ? 0 : prepacked_byte_ends_.back();
+  if (prepacked_txs_.size() + batch_size > transaction_limit_
+      or (proposal_byte_limit_ != 0
+          and packed_bytes + batch_bytes > proposal_byte_limit_)) {
+    // the slots are full; the batch stays in the cache and gets its turn
+    // when a commit frees room and the slots are rebuilt
+    prepacked_stale_ = true;
+    return;
+  }
+  prepacked_txs_.insert(prepacked_txs_.end(),
+                        std::begin(batch->transactions()),
+                        std::end(batch->transactions()));
+  prepacked_batch_ends_.push_back(prepacked_txs_.size());
+  prepacked_byte_ends_.push_back(packed_bytes + batch_bytes);
+}
+
+void OnDemandOrderingServiceImpl::rebuildPrepacked() {
+  prepacked_txs_.clear();
+  prepacked_batch_ends_.clear();
+  prepacked_byte_ends_.clear();
+  prepacked_stale_ = false;
+  // collect the prefix that fits the limits, then spread its conflict
+  // groups the same way the incremental path does
+  std::vector<TransactionBatchType> fitting;
+  std::vector<uint64_t> sketches;
+  size_t packed_txs = 0;
+  size_t packed_bytes = 0;
+  for (auto it = batches_cache_.begin(); it != batches_cache_.end(); ++it) {
+    auto batch_bytes = batchMemoryUse(**it);
+    if (packed_txs + boost::size((*it)->transactions()) > transaction_limit_
+        or (proposal_byte_limit_ != 0
+            and packed_bytes + batch_bytes > proposal_byte_limit_)) {
+      break;
+    }
+    packed_txs += boost::size((*it)->transactions());
+    packed_bytes += batch_bytes;
+    fitting.push_back(*it);
+    sketches.push_back(conflictSketch(**it));
+  }
+  spreadConflictGroups(fitting, sketches);
+  for (auto const &batch : fitting) {
+    appendToPrepacked(batch);
+  }
 }
 
 void OnDemandOrderingServiceImpl::removeFromBatchesCache(
     const OnDemandOrderingService::HashesSetType &hashes) {
-  std::lock_guard<std::shared_timed_mutex> lock(batches_cache_cs_);
-  for (auto it = batches_cache_.begin(); it != batches_cache_.end();) {
-    if (std::any_of(it->get()->transactions().begin(),
-                    it->get()->transactions().end(),
-                    [&hashes](const auto &tx) {
-                      return hashes.find(tx->hash()) != hashes.end();
-                    })) {
-      it = batches_cache_.erase(it);
-    } else {
-      ++it;
+  // committed batches may still be in the staging area
+  drainStagedBatches();
+  // the last references of the removed batches are moved here and released
+  // on the disposer thread, outside of the exclusive lock
+  std::vector<std::shared_ptr<shared_model::interface::TransactionBatch>>
+      removed_batches;
+  shared_model::interface::types::BatchesCollectionType survivors;
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(batches_cache_cs_);
+    for (auto it = batches_cache_.begin(); it != batches_cache_.end();) {
+      if (std::any_of(it->get()->transactions().begin(),
+                      it->get()->transactions().end(),
+                      [&hashes](const auto &tx) {
+                        return hashes.find(tx->hash()) != hashes.end();
+                      })) {
+        MemoryBudget::instance().release(batchMemoryUse(**it));
+        removed_batches.push_back(std::move(batches_cache_.extract(it++)
+                                                .value()));
+        prepacked_stale_ = true;
+      } else {
+        ++it;
+      }
     }
+    if (batch_journal_ and not removed_batches.empty()) {
+      survivors.assign(batches_cache_.begin(), batches_cache_.end());
+    }
+  }
+  if (not removed_batches.empty()) {
+    if (batch_journal_) {
+      // drop the committed batches from the journal too, so it does not
+      // grow with the ledger and a restart does not replay them
+      batch_journal_->rewrite(survivors);
+    }
+    round_disposer_.dispose(std::move(removed_batches));
   }
 }
 
 bool OnDemandOrderingServiceImpl::isEmptyBatchesCache() const {
+  if (hasStagedBatches()) {
+    return false;
+  }
   std::shared_lock<std::shared_timed_mutex> lock(batches_cache_cs_);
   return batches_cache_.empty();
 }
@@ -110,6 +421,7 @@ bool OnDemandOrderingServiceImpl::isEmptyBatchesCache() const {
 void OnDemandOrderingServiceImpl::forCachedBatches(
     std::function<
         void(const transport::OdOsNotification::BatchesSetType &)> const &f) {
+  drainStagedBatches();
   std::shared_lock<std::shared_timed_mutex> lock(batches_cache_cs_);
   f(batches_cache_);
 }
@@ -117,21 +429,19 @@ void OnDemandOrderingServiceImpl::forCachedBatches(
 std::vector<std::shared_ptr<shared_model::interface::Transaction>>
 OnDemandOrderingServiceImpl::getTransactionsFromBatchesCache(
     size_t requested_tx_amount) {
-  std::vector<std::shared_ptr<shared_model::interface::Transaction>> collection;
-  collection.reserve(requested_tx_amount);
-
-  std::shared_lock<std::shared_timed_mutex> lock(batches_cache_cs_);
-  auto it = batches_cache_.begin();
-  for (; it != batches_cache_.end()
-       and collection.size() + boost::size((*it)->transactions())
-           <= requested_tx_amount;
-       ++it) {
-    collection.insert(std::end(collection),
-                      std::begin((*it)->transactions()),
-                      std::end((*it)->transactions()));
+  drainStagedBatches();
+  std::lock_guard<std::shared_timed_mutex> lock(batches_cache_cs_);
+  if (prepacked_stale_) {
+    rebuildPrepacked();
   }
 
-  return collection;
+  // largest whole-batch prefix of the pre-packed slots within the
+  // requested amount; the full prefix when the round limit is not lowered
+  auto end = std::upper_bound(prepacked_batch_ends_.begin(),
+                              prepacked_batch_ends_.end(),
+                              requested_tx_amount);
+  auto take = end == prepacked_batch_ends_.begin() ? 0 : *std::prev(end);
+  return {prepacked_txs_.begin(), prepacked_txs_.begin() + take};
 }
 
 boost::optional<
@@ -167,6 +477,10 @@ OnDemandOrderingServiceImpl::tryCreateProposal(
     shared_model::interface::types::TimestampType created_time) {
   boost::optional<std::shared_ptr<shared_model::interface::Proposal>> proposal;
   if (not txs.empty()) {
+    for (const auto &tx : txs) {
+      metrics::TxLatencyTracer::instance().recordStage(
+          tx->hash().hex(), metrics::TxStage::kProposalIncluded);
+    }
     proposal = proposal_factory_->unsafeCreateProposal(
         round.block_round, created_time, txs | boost::adaptors::indirected);
     log_->debug(
@@ -186,13 +500,29 @@ OnDemandOrderingServiceImpl::tryCreateProposal(
 
 boost::optional<std::shared_ptr<shared_model::interface::Proposal>>
 OnDemandOrderingServiceImpl::packNextProposals(const consensus::Round &round) {
+  const auto start = std::chrono::steady_clock::now();
   auto now = iroha::time::now();
+  auto transaction_limit = adaptive_policy_
+      ? std::min(transaction_limit_, adaptive_policy_->transactionLimit())
+      : transaction_limit_;
   std::vector<std::shared_ptr<shared_model::interface::Transaction>> txs;
   if (!isEmptyBatchesCache())
-    txs = getTransactionsFromBatchesCache(transaction_limit_);
+    txs = getTransactionsFromBatchesCache(transaction_limit);
 
   log_->debug("Packed proposal contains: {} transactions.", txs.size());
-  return tryCreateProposal(round, txs, now);
+  iroha::metrics::PipelineSnapshots::instance().setNextProposalTransactions(
+      txs.size());
+  auto proposal = tryCreateProposal(round, txs, now);
+  if (proposal) {
+    proposal_counter_->inc();
+    uint64_t packed_bytes = 0;
+    for (const auto &tx : txs) {
+      packed_bytes += tx->blob().size();
+    }
+    proposal_bytes_->observe(packed_bytes);
+  }
+  proposal_creation_duration_->observeSince(start);
+  return proposal;
 }
 
 void OnDemandOrderingServiceImpl::tryErase(
@@ -222,6 +552,9 @@ void OnDemandOrderingServiceImpl::tryErase(
   for (auto it = proposal_map.begin(); it != current_proposal_it; ++it) {
     log_->debug("tryErase: erased {}", it->first);
   }
+
+  // release the dropped proposals on the disposer thread
+  round_disposer_.dispose(std::move(proposal_map));
 }
 
 bool OnDemandOrderingServiceImpl::batchAlreadyProcessed(
@@ -8,6 +8,7 @@
 
 #include "ordering/on_demand_ordering_service.hpp"
 
+#include <array>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indirected.hpp>
 #include <map>
@@ -15,8 +16,11 @@
 #include <shared_mutex>
 
 #include <tbb/concurrent_unordered_set.h>
+#include "common/async_disposer.hpp"
+#include "common/lockfree_staging_queue.hpp"
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "metrics/metrics_registry.hpp"
 #include "multi_sig_transactions/hash.hpp"
 // TODO 2019-03-15 andrei: IR-403 Separate BatchHashEquality and MstState
 #include "multi_sig_transactions/state/mst_state.hpp"
@@ -28,6 +32,9 @@ namespace iroha {
     class TxPresenceCache;
   }
   namespace ordering {
+    class AdaptiveProposalPolicy;
+    class BatchJournal;
+
     namespace detail {
       using BatchSetType = tbb::concurrent_unordered_set<
           transport::OdOsNotification::TransactionBatchType,
@@ -52,6 +59,18 @@ namespace iroha {
        * @param number_of_proposals - number of stored proposals, older will be
        * removed. Default value is 3
        * @param creation_strategy - provides a strategy for creating proposals
+       * @param adaptive_policy - round feedback controller which may lower
+       * the packing limit below transaction_limit; static limit when not set
+       * @param proposal_byte_limit - serialized size cap of one proposal;
+       * a count cap alone lets a proposal of maximal transactions weigh
+       * orders of magnitude more than a typical one, 0 means no byte cap
+       * @param batches_arrived_callback - called when new unprocessed
+       * batches enter the cache, both from local clients and from other
+       * peers; used to snap the stretched empty-round cadence back
+       * @param batch_journal - persistent journal of the cached batches,
+       * replayed into the cache on construction so a crash does not lose
+       * the accepted-but-unordered transactions; no journaling when not
+       * set
        */
       OnDemandOrderingServiceImpl(
           size_t transaction_limit,
@@ -60,7 +79,11 @@ namespace iroha {
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
           logger::LoggerPtr log,
-          size_t number_of_proposals = 3);
+          size_t number_of_proposals = 3,
+          std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy = nullptr,
+          size_t proposal_byte_limit = 0,
+          std::function<void()> batches_arrived_callback = {},
+          std::shared_ptr<BatchJournal> batch_journal = nullptr);
 
       // --------------------- | OnDemandOrderingService |_---------------------
 
@@ -115,6 +138,28 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::TransactionBatch> const
               &batch);
 
+      /**
+       * Charge the batch to the memory budget and push it to the staging
+       * area. Shared by the ingress path, which also journals the batch,
+       * and the journal replay, which must not journal it again.
+       */
+      void stageBatch(
+          std::shared_ptr<shared_model::interface::TransactionBatch> const
+              &batch);
+
+      /**
+       * Merge batches staged by ingress threads into batches_cache_.
+       * Called by the readers of the cache, so ingress never takes
+       * batches_cache_cs_. The arrival order within one shard is
+       * preserved; across shards the batch with the smallest reduced
+       * hash goes first, so the merged order depends on the batches
+       * only, not on which thread landed on which shard.
+       */
+      void drainStagedBatches();
+
+      /// @return true when any staging shard holds batches
+      bool hasStagedBatches() const;
+
       void removeFromBatchesCache(
           const OnDemandOrderingService::HashesSetType &hashes);
 
@@ -127,11 +172,31 @@ namespace iroha {
       std::vector<std::shared_ptr<shared_model::interface::Transaction>>
       getTransactionsFromBatchesCache(size_t requested_tx_amount);
 
+      /**
+       * Append a newly cached batch to the pre-packed slots if it fits
+       * below transaction_limit_ and proposal_byte_limit_. Requires
+       * exclusive batches_cache_cs_.
+       */
+      void appendToPrepacked(
+          transport::OdOsNotification::TransactionBatchType const &batch);
+
+      /**
+       * Rebuild the pre-packed slots from batches_cache_ after committed
+       * batches were erased. Requires exclusive batches_cache_cs_.
+       */
+      void rebuildPrepacked();
+
       /**
        * Max number of transaction in one proposal
        */
       size_t transaction_limit_;
 
+      /**
+       * Max serialized size of the transactions of one proposal in bytes;
+       * 0 disables the byte cap
+       */
+      size_t proposal_byte_limit_;
+
       /**
        * Max number of available proposals in one OS
        */
@@ -150,6 +215,40 @@ namespace iroha {
       mutable std::shared_timed_mutex batches_cache_cs_;
       BatchesSetType batches_cache_;
 
+      /**
+       * Transactions of the cached batches, pre-packed up to
+       * transaction_limit_ as the batches are drained into the cache, so
+       * the round boundary only copies the prepared slots instead of
+       * walking the cache. prepacked_batch_ends_ holds the prefix sizes at
+       * whole-batch boundaries for truncation to a lower per-round limit;
+       * prepacked_byte_ends_ holds the serialized byte prefix sums at the
+       * same boundaries. Guarded by batches_cache_cs_; marked stale when
+       * committed batches leave the cache.
+       */
+      TransactionsCollectionType prepacked_txs_;
+      std::vector<size_t> prepacked_batch_ends_;
+      std::vector<size_t> prepacked_byte_ends_;
+      bool prepacked_stale_{false};
+
+      /**
+       * Number of staging shards. Even a lock-free queue keeps all
+       * producers spinning on one head under contention; spreading the
+       * ingress threads over this many core-local shards removes that
+       * single point, which is what lets ordering ingestion scale past
+       * eight cores.
+       */
+      static constexpr size_t kStagingShards = 16;
+
+      /**
+       * Sharded lock-free staging area filled by onBatches: an ingress
+       * thread draws a shard on its first batch and keeps it, so its
+       * inserts stay effectively single-producer on that shard. Merged
+       * into batches_cache_ when the cache is read.
+       */
+      using StagingShardType = containers::LockFreeStagingQueue<
+          std::shared_ptr<shared_model::interface::TransactionBatch>>;
+      std::array<StagingShardType, kStagingShards> staged_shards_;
+
       std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
           proposal_factory_;
 
@@ -163,15 +262,47 @@ namespace iroha {
        */
       std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy_;
 
+      /**
+       * Adjusts the packing limit to the observed round outcomes, may be
+       * nullptr
+       */
+      std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy_;
+
+      /**
+       * Notifies the consensus cadence about new batches, may be empty
+       */
+      std::function<void()> batches_arrived_callback_;
+
+      /**
+       * Crash recovery journal of the cached batches, may be nullptr
+       */
+      std::shared_ptr<BatchJournal> batch_journal_;
+
       /**
        * Logger instance
        */
       logger::LoggerPtr log_;
 
+      /// counts proposals packed by this service, exposed to the scraper
+      std::shared_ptr<iroha::metrics::Counter> proposal_counter_;
+
+      /// duration of packing one proposal, exposed to the scraper
+      std::shared_ptr<iroha::metrics::Histogram> proposal_creation_duration_;
+
+      /// serialized size of one packed proposal, exposed to the scraper
+      std::shared_ptr<iroha::metrics::Histogram> proposal_bytes_;
+
       /**
        * Current round
        */
       consensus::Round current_round_;
+
+      /**
+       * Destroys retired round state - dropped proposal maps, committed
+       * batches - off the ordering thread, so round teardown does not add
+       * to the lock hold time at the start of the next round
+       */
+      AsyncDisposer round_disposer_;
     };
   }  // namespace ordering
 }  // namespace iroha
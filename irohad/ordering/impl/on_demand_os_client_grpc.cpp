@@ -5,17 +5,131 @@
 
 #include "ordering/impl/on_demand_os_client_grpc.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include "backend/protobuf/deserialize_repeated_transactions.hpp"
 #include "backend/protobuf/proposal.hpp"
+#include "backend/protobuf/proposal_view.hpp"
 #include "backend/protobuf/transaction.hpp"
+#include "common/mem_operations.hpp"
 #include "interfaces/common_objects/peer.hpp"
+#include "interfaces/iroha_internal/parse_and_create_batches.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/client_factory.hpp"
+#include "network/impl/generic_client_factory.hpp"
+#include "ordering/impl/adaptive_proposal_policy.hpp"
+#include "ordering/on_demand_ordering_service.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
 
+namespace {
+  /// tag of the BatchesRequest.transactions field on the wire: field
+  /// number 1, length-delimited
+  constexpr uint32_t kTransactionsFieldTag = (1u << 3) | 2u;
+
+  /// full method name of the SendBatches call for the generic stub
+  const std::string &sendBatchesMethod() {
+    static const std::string method = std::string{"/"}
+        + proto::OnDemandOrdering::service_full_name() + "/SendBatches";
+    return method;
+  }
+
+  std::vector<shared_model::interface::types::HashType> makeKey(
+      OdOsNotification::CollectionType const &batches) {
+    std::vector<shared_model::interface::types::HashType> key;
+    key.reserve(batches.size());
+    for (auto const &batch : batches) {
+      key.push_back(batch->reducedHash());
+    }
+    return key;
+  }
+}  // namespace
+
+std::shared_ptr<proto::BatchesRequest const> BatchesRequestCache::get(
+    OdOsNotification::CollectionType const &batches) {
+  auto key = makeKey(batches);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (request_ and key_ == key) {
+    return request_;
+  }
+
+  auto request = std::make_shared<proto::BatchesRequest>();
+  for (auto const &batch : batches) {
+    for (auto const &transaction : batch->transactions()) {
+      *request->add_transactions() =
+          static_cast<shared_model::proto::Transaction *>(transaction.get())
+              ->getTransport();
+    }
+  }
+  if (key_ != key) {
+    key_ = std::move(key);
+    wire_.reset();
+  }
+  request_ = std::move(request);
+  return request_;
+}
+
+std::shared_ptr<grpc::ByteBuffer const> BatchesRequestCache::getWire(
+    OdOsNotification::CollectionType const &batches) {
+  auto key = makeKey(batches);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (wire_ and key_ == key) {
+    return wire_;
+  }
+
+  // each transaction still holds the bytes it arrived with, so the
+  // request is assembled by splicing them behind the repeated field tag
+  // instead of serializing the messages again; the exact size is known
+  // upfront, so the assembly buffer can sit on huge pages - at tens of
+  // megabytes the end-to-end walks otherwise churn the TLB
+  size_t wire_size = 0;
+  for (auto const &batch : batches) {
+    for (auto const &transaction : batch->transactions()) {
+      auto const blob_size =
+          static_cast<shared_model::proto::Transaction *>(transaction.get())
+              ->blob()
+              .size();
+      wire_size += google::protobuf::io::CodedOutputStream::VarintSize32(
+                       kTransactionsFieldTag)
+          + google::protobuf::io::CodedOutputStream::VarintSize32(
+                static_cast<uint32_t>(blob_size))
+          + blob_size;
+    }
+  }
+  iroha::HugePageBuffer bytes(wire_size);
+  {
+    google::protobuf::io::ArrayOutputStream raw(
+        bytes.data(), static_cast<int>(bytes.size()));
+    google::protobuf::io::CodedOutputStream out(&raw);
+    for (auto const &batch : batches) {
+      for (auto const &transaction : batch->transactions()) {
+        auto const &blob =
+            static_cast<shared_model::proto::Transaction *>(transaction.get())
+                ->blob();
+        out.WriteTag(kTransactionsFieldTag);
+        out.WriteVarint32(static_cast<uint32_t>(blob.size()));
+        out.WriteRaw(blob.blob().data(), static_cast<int>(blob.size()));
+      }
+    }
+  }
+  if (key_ != key) {
+    key_ = std::move(key);
+    request_.reset();
+  }
+  grpc::Slice slice(bytes.data(), bytes.size());
+  wire_ = std::make_shared<grpc::ByteBuffer>(&slice, 1);
+  return wire_;
+}
+
 OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     std::shared_ptr<proto::OnDemandOrdering::StubInterface> stub,
     std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
@@ -23,38 +137,90 @@ OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     std::shared_ptr<TransportFactoryType> proposal_factory,
     std::function<TimepointType()> time_provider,
     std::chrono::milliseconds proposal_request_timeout,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::shared_ptr<BatchesRequestCache> batches_request_cache,
+    std::shared_ptr<OnDemandOrderingService> local_ordering_service,
+    std::shared_ptr<TransactionFactoryType> transaction_factory,
+    std::shared_ptr<shared_model::interface::TransactionBatchParser>
+        batch_parser,
+    std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+        batch_factory,
+    std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy,
+    std::unique_ptr<grpc::GenericStub> generic_stub,
+    std::shared_ptr<network::AsyncGrpcClient<grpc::ByteBuffer>>
+        generic_async_call)
     : log_(std::move(log)),
       stub_(std::move(stub)),
       async_call_(std::move(async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(std::move(time_provider)),
-      proposal_request_timeout_(proposal_request_timeout) {}
+      proposal_request_timeout_(proposal_request_timeout),
+      batches_request_cache_(std::move(batches_request_cache)),
+      local_ordering_service_(std::move(local_ordering_service)),
+      transaction_factory_(std::move(transaction_factory)),
+      batch_parser_(std::move(batch_parser)),
+      batch_factory_(std::move(batch_factory)),
+      adaptive_policy_(std::move(adaptive_policy)),
+      generic_stub_(std::move(generic_stub)),
+      generic_async_call_(std::move(generic_async_call)) {}
+
+std::chrono::milliseconds OnDemandOsClientGrpc::proposalRequestTimeout()
+    const {
+  return adaptive_policy_ ? adaptive_policy_->proposalTimeout()
+                          : proposal_request_timeout_;
+}
 
 void OnDemandOsClientGrpc::onBatches(CollectionType batches) {
-  proto::BatchesRequest request;
-  for (auto &batch : batches) {
-    for (auto &transaction : batch->transactions()) {
-      *request.add_transactions() = std::move(
-          static_cast<shared_model::proto::Transaction *>(transaction.get())
-              ->getTransport());
-    }
+  if (generic_stub_ and generic_async_call_) {
+    // spliced once per collection from the retained transaction bytes and
+    // shared between the consumer peers; sending the buffer involves no
+    // protobuf serialization at all
+    auto request = batches_request_cache_->getWire(batches);
+
+    log_->debug("Propagating {} batches as {} pre-serialized bytes",
+                batches.size(),
+                request->Length());
+
+    generic_async_call_->Call([&](auto context, auto cq) {
+      auto reader = generic_stub_->PrepareUnaryCall(
+          context, sendBatchesMethod(), *request, cq);
+      // prepared calls do not start on their own
+      reader->StartCall();
+      return reader;
+    });
+    return;
   }
 
-  log_->debug("Propagating: '{}'", request.DebugString());
+  // serialized once per collection and shared between the consumer peers
+  auto request = batches_request_cache_->get(batches);
+
+  log_->debug("Propagating: '{}'", request->DebugString());
 
   async_call_->Call([&](auto context, auto cq) {
-    return stub_->AsyncSendBatches(context, request, cq);
+    return stub_->AsyncSendBatches(context, *request, cq);
   });
 }
 
 boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
 OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
-  grpc::ClientContext context;
-  context.set_deadline(time_provider_() + proposal_request_timeout_);
   proto::ProposalRequest request;
   request.mutable_round()->set_block_round(round.block_round);
   request.mutable_round()->set_reject_round(round.reject_round);
+
+  if (local_ordering_service_ and transaction_factory_ and batch_parser_
+      and batch_factory_) {
+    if (auto proposal = requestProposalByDigest(round, request)) {
+      return proposal;
+    }
+    // the digest path could not be completed (no digest served, a batch
+    // is unavailable or failed validation) - request the full proposal
+    log_->debug("Proposal digest unavailable for {}, requesting the full "
+                "proposal",
+                round);
+  }
+
+  grpc::ClientContext context;
+  context.set_deadline(time_provider_() + proposalRequestTimeout());
   proto::ProposalResponse response;
   auto status = stub_->RequestProposal(&context, request, &response);
   if (not status.ok()) {
@@ -64,7 +230,37 @@ OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
   if (not response.has_proposal()) {
     return boost::none;
   }
-  return proposal_factory_->build(response.proposal())
+
+  auto view = std::make_shared<shared_model::proto::ProposalView>(
+      std::move(*response.mutable_proposal()));
+  if (local_ordering_service_) {
+    // when every received transaction is already in the local batch
+    // cache, its bytes have passed validation on the way into that cache
+    // - hand over the lazy view instead of re-validating, deferring the
+    // wrapper construction until a consumer actually needs more than the
+    // hashes
+    std::unordered_set<std::string> known_hashes;
+    local_ordering_service_->forCachedBatches(
+        [&known_hashes](auto const &batches) {
+          for (auto const &batch : batches) {
+            for (auto const &tx : batch->transactions()) {
+              known_hashes.insert(tx->hash().hex());
+            }
+          }
+        });
+    auto const &hashes = view->transactionHashes();
+    if (not hashes.empty()
+        and std::all_of(hashes.begin(), hashes.end(), [&](auto const &hash) {
+              return known_hashes.count(hash.hex()) != 0;
+            })) {
+      log_->debug("Proposal for {} contains only locally known transactions",
+                  round);
+      return boost::make_optional(
+          std::shared_ptr<const OdOsNotification::ProposalType>(
+              std::move(view)));
+    }
+  }
+  return proposal_factory_->build(view->getTransport())
       .match(
           [&](auto &&v) {
             return boost::make_optional(
@@ -78,6 +274,109 @@ OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
           });
 }
 
+boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+OnDemandOsClientGrpc::requestProposalByDigest(
+    consensus::Round round, proto::ProposalRequest const &request) {
+  grpc::ClientContext context;
+  context.set_deadline(time_provider_() + proposalRequestTimeout());
+  proto::ProposalDigestResponse digest_response;
+  auto status =
+      stub_->RequestProposalDigest(&context, request, &digest_response);
+  if (not status.ok()) {
+    log_->warn("RequestProposalDigest RPC failed: {}", status.error_message());
+    return boost::none;
+  }
+  if (not digest_response.has_digest()) {
+    // either no proposal exists for the round or the issuer cannot serve
+    // the digest; both are resolved by the full proposal request
+    return boost::none;
+  }
+  auto const &digest = digest_response.digest();
+
+  // index the locally known batches by their reduced hashes
+  std::unordered_map<std::string, TransactionBatchType> local_batches;
+  local_ordering_service_->forCachedBatches([&local_batches](
+                                                auto const &batches) {
+    for (auto const &batch : batches) {
+      local_batches.emplace(batch->reducedHash().hex(), batch);
+    }
+  });
+
+  proto::BatchesByHashRequest missing;
+  for (auto const &hash : digest.batch_hashes()) {
+    if (local_batches.find(hash) == local_batches.end()) {
+      missing.add_reduced_hashes(hash);
+    }
+  }
+
+  if (missing.reduced_hashes_size() != 0) {
+    grpc::ClientContext batches_context;
+    batches_context.set_deadline(time_provider_() + proposalRequestTimeout());
+    proto::BatchesRequest batches_response;
+    status =
+        stub_->RequestBatches(&batches_context, missing, &batches_response);
+    if (not status.ok()) {
+      log_->warn("RequestBatches RPC failed: {}", status.error_message());
+      return boost::none;
+    }
+
+    auto transactions = shared_model::proto::deserializeTransactions(
+        *transaction_factory_,
+        std::move(*batches_response.mutable_transactions()));
+    if (auto e = expected::resultToOptionalError(transactions)) {
+      log_->warn("Transaction deserialization failed: hash {}, {}",
+                 e->hash,
+                 e->error);
+      return boost::none;
+    }
+    auto batches = shared_model::interface::parseAndCreateBatches(
+        *batch_parser_, *batch_factory_, std::move(transactions).assumeValue());
+    if (auto e = expected::resultToOptionalError(batches)) {
+      log_->warn("Batch deserialization failed: {}", *e);
+      return boost::none;
+    }
+    for (auto &batch : std::move(batches).assumeValue()) {
+      local_batches.emplace(batch->reducedHash().hex(), std::move(batch));
+    }
+  }
+
+  log_->debug("Rebuilding proposal for {}: {} batches, {} pulled",
+              round,
+              digest.batch_hashes_size(),
+              missing.reduced_hashes_size());
+
+  // rebuild the proposal transport in the announced order; with the same
+  // transactions and created time it is byte-identical to the issuer's one
+  iroha::protocol::Proposal proposal;
+  proposal.set_height(digest.round().block_round());
+  proposal.set_created_time(digest.created_time());
+  for (auto const &hash : digest.batch_hashes()) {
+    auto it = local_batches.find(hash);
+    if (it == local_batches.end()) {
+      log_->info("Batch {} is not available, proposal cannot be rebuilt",
+                 hash);
+      return boost::none;
+    }
+    for (auto const &tx : it->second->transactions()) {
+      *proposal.add_transactions() =
+          static_cast<shared_model::proto::Transaction *>(tx.get())
+              ->getTransport();
+    }
+  }
+
+  return proposal_factory_->build(proposal).match(
+      [&](auto &&v) {
+        return boost::make_optional(
+            std::shared_ptr<const OdOsNotification::ProposalType>(
+                std::move(v).value));
+      },
+      [this](const auto &error) {
+        log_->info("{}", error.error.error);  // error
+        return boost::optional<
+            std::shared_ptr<const OdOsNotification::ProposalType>>();
+      });
+}
+
 OnDemandOsClientGrpcFactory::OnDemandOsClientGrpcFactory(
     std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
         async_call,
@@ -85,23 +384,63 @@ OnDemandOsClientGrpcFactory::OnDemandOsClientGrpcFactory(
     std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
     OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
     logger::LoggerPtr client_log,
-    std::unique_ptr<ClientFactory> client_factory)
+    std::unique_ptr<ClientFactory> client_factory,
+    std::shared_ptr<OnDemandOrderingService> local_ordering_service,
+    std::shared_ptr<OnDemandOsClientGrpc::TransactionFactoryType>
+        transaction_factory,
+    std::shared_ptr<shared_model::interface::TransactionBatchParser>
+        batch_parser,
+    std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+        batch_factory,
+    std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy,
+    std::shared_ptr<const network::GenericClientFactory>
+        generic_client_factory,
+    std::shared_ptr<network::AsyncGrpcClient<grpc::ByteBuffer>>
+        generic_async_call)
     : async_call_(std::move(async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(time_provider),
       proposal_request_timeout_(proposal_request_timeout),
       client_log_(std::move(client_log)),
-      client_factory_(std::move(client_factory)) {}
+      client_factory_(std::move(client_factory)),
+      batches_request_cache_(std::make_shared<BatchesRequestCache>()),
+      local_ordering_service_(std::move(local_ordering_service)),
+      transaction_factory_(std::move(transaction_factory)),
+      batch_parser_(std::move(batch_parser)),
+      batch_factory_(std::move(batch_factory)),
+      adaptive_policy_(std::move(adaptive_policy)),
+      generic_client_factory_(std::move(generic_client_factory)),
+      generic_async_call_(std::move(generic_async_call)) {}
 
 expected::Result<std::unique_ptr<OdOsNotification>, std::string>
 OnDemandOsClientGrpcFactory::create(const shared_model::interface::Peer &to) {
   return client_factory_->createClient(to) |
              [&](auto &&client) -> std::unique_ptr<OdOsNotification> {
+    std::unique_ptr<grpc::GenericStub> generic_stub;
+    if (generic_client_factory_ and generic_async_call_) {
+      auto stub_result = generic_client_factory_->createGenericStub(
+          Service::service_full_name(), to);
+      if (auto e = expected::resultToOptionalError(stub_result)) {
+        // the client still works through the typed per-destination
+        // serialization path
+        client_log_->warn("Generic stub creation failed: {}", *e);
+      } else {
+        generic_stub = std::move(stub_result).assumeValue();
+      }
+    }
     return std::make_unique<OnDemandOsClientGrpc>(std::move(client),
                                                   async_call_,
                                                   proposal_factory_,
                                                   time_provider_,
                                                   proposal_request_timeout_,
-                                                  client_log_);
+                                                  client_log_,
+                                                  batches_request_cache_,
+                                                  local_ordering_service_,
+                                                  transaction_factory_,
+                                                  batch_parser_,
+                                                  batch_factory_,
+                                                  adaptive_policy_,
+                                                  std::move(generic_stub),
+                                                  generic_async_call_);
   };
 }
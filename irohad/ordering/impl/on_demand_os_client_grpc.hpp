@@ -8,8 +8,13 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+#include <mutex>
+
+#include <grpcpp/generic/generic_stub.h>
 #include "common/result.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
+#include "interfaces/iroha_internal/transaction_batch_factory.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "logger/logger_fwd.hpp"
 #include "network/impl/async_grpc_client.hpp"
 #include "ordering.grpc.pb.h"
@@ -18,10 +23,46 @@ namespace iroha {
   namespace network {
     template <typename Service>
     class ClientFactory;
+    class GenericClientFactory;
   }
   namespace ordering {
+    class AdaptiveProposalPolicy;
+    class OnDemandOrderingService;
     namespace transport {
 
+      /**
+       * Serialized batches request shared between the clients of one round's
+       * consumer peers. The connection manager fans the same batch collection
+       * out to several destinations; with the cache the transactions are
+       * serialized into a proto::BatchesRequest once and every client sends
+       * the same immutable message.
+       *
+       * getWire goes one step further: it splices the retained wire form of
+       * each transaction (the bytes it arrived with, kept by the proto
+       * backend) into the request bytes directly, so the ingress-to-ordering
+       * hop involves no protobuf serialization at all.
+       */
+      class BatchesRequestCache {
+       public:
+        /// @return the serialized request for the collection, built on the
+        /// first call and reused by the subsequent ones
+        std::shared_ptr<proto::BatchesRequest const> get(
+            OdOsNotification::CollectionType const &batches);
+
+        /// @return the request wire bytes for the collection, spliced from
+        /// the retained transaction bytes on the first call and reused by
+        /// the subsequent ones
+        std::shared_ptr<grpc::ByteBuffer const> getWire(
+            OdOsNotification::CollectionType const &batches);
+
+       private:
+        std::mutex mutex_;
+        /// reduced hashes of the batches request_ and wire_ were built from
+        std::vector<shared_model::interface::types::HashType> key_;
+        std::shared_ptr<proto::BatchesRequest const> request_;
+        std::shared_ptr<grpc::ByteBuffer const> wire_;
+      };
+
       /**
        * gRPC client for on demand ordering service
        */
@@ -31,6 +72,10 @@ namespace iroha {
             shared_model::interface::AbstractTransportFactory<
                 shared_model::interface::Proposal,
                 iroha::protocol::Proposal>;
+        using TransactionFactoryType =
+            shared_model::interface::AbstractTransportFactory<
+                shared_model::interface::Transaction,
+                iroha::protocol::Transaction>;
         using TimepointType = std::chrono::system_clock::time_point;
         using TimeoutType = std::chrono::milliseconds;
 
@@ -45,7 +90,21 @@ namespace iroha {
             std::shared_ptr<TransportFactoryType> proposal_factory,
             std::function<TimepointType()> time_provider,
             std::chrono::milliseconds proposal_request_timeout,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            std::shared_ptr<BatchesRequestCache> batches_request_cache =
+                std::make_shared<BatchesRequestCache>(),
+            std::shared_ptr<OnDemandOrderingService> local_ordering_service =
+                nullptr,
+            std::shared_ptr<TransactionFactoryType> transaction_factory =
+                nullptr,
+            std::shared_ptr<shared_model::interface::TransactionBatchParser>
+                batch_parser = nullptr,
+            std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+                batch_factory = nullptr,
+            std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy = nullptr,
+            std::unique_ptr<grpc::GenericStub> generic_stub = nullptr,
+            std::shared_ptr<network::AsyncGrpcClient<grpc::ByteBuffer>>
+                generic_async_call = nullptr);
 
         void onBatches(CollectionType batches) override;
 
@@ -53,6 +112,20 @@ namespace iroha {
             consensus::Round round) override;
 
        private:
+        /**
+         * Fetch the proposal of the round as a digest of batch hashes,
+         * rebuild it from the local ordering service cache and pull only the
+         * batches missing from it. Returns none when the digest path cannot
+         * be completed - the caller falls back to the full proposal request.
+         */
+        boost::optional<std::shared_ptr<const ProposalType>>
+        requestProposalByDigest(consensus::Round round,
+                                proto::ProposalRequest const &request);
+
+        /// @return the round feedback timeout when the policy is set, the
+        /// static one otherwise
+        std::chrono::milliseconds proposalRequestTimeout() const;
+
         logger::LoggerPtr log_;
         std::shared_ptr<proto::OnDemandOrdering::StubInterface> stub_;
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
@@ -60,6 +133,24 @@ namespace iroha {
         std::shared_ptr<TransportFactoryType> proposal_factory_;
         std::function<TimepointType()> time_provider_;
         std::chrono::milliseconds proposal_request_timeout_;
+        std::shared_ptr<BatchesRequestCache> batches_request_cache_;
+        /// local peer's ordering service; its batch cache seeds the digest
+        /// based proposal rebuild. The digest path is disabled when not set.
+        std::shared_ptr<OnDemandOrderingService> local_ordering_service_;
+        std::shared_ptr<TransactionFactoryType> transaction_factory_;
+        std::shared_ptr<shared_model::interface::TransactionBatchParser>
+            batch_parser_;
+        std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+            batch_factory_;
+        /// adapts the request deadline to the observed round feedback, may
+        /// be nullptr
+        std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy_;
+        /// generic stub over the same channel as stub_, sends the batches
+        /// request as pre-serialized bytes; the typed path is used when the
+        /// stub or its completion queue client is not set
+        std::unique_ptr<grpc::GenericStub> generic_stub_;
+        std::shared_ptr<network::AsyncGrpcClient<grpc::ByteBuffer>>
+            generic_async_call_;
       };
 
       class OnDemandOsClientGrpcFactory : public OdOsNotificationFactory {
@@ -75,7 +166,20 @@ namespace iroha {
             std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
             OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
             logger::LoggerPtr client_log,
-            std::unique_ptr<ClientFactory> client_factory);
+            std::unique_ptr<ClientFactory> client_factory,
+            std::shared_ptr<OnDemandOrderingService> local_ordering_service =
+                nullptr,
+            std::shared_ptr<OnDemandOsClientGrpc::TransactionFactoryType>
+                transaction_factory = nullptr,
+            std::shared_ptr<shared_model::interface::TransactionBatchParser>
+                batch_parser = nullptr,
+            std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+                batch_factory = nullptr,
+            std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy = nullptr,
+            std::shared_ptr<const network::GenericClientFactory>
+                generic_client_factory = nullptr,
+            std::shared_ptr<network::AsyncGrpcClient<grpc::ByteBuffer>>
+                generic_async_call = nullptr);
 
         iroha::expected::Result<std::unique_ptr<OdOsNotification>, std::string>
         create(const shared_model::interface::Peer &to) override;
@@ -88,6 +192,23 @@ namespace iroha {
         std::chrono::milliseconds proposal_request_timeout_;
         logger::LoggerPtr client_log_;
         std::unique_ptr<ClientFactory> client_factory_;
+        /// shared by all created clients, so a collection propagated to the
+        /// whole consumer set is serialized once
+        std::shared_ptr<BatchesRequestCache> batches_request_cache_;
+        std::shared_ptr<OnDemandOrderingService> local_ordering_service_;
+        std::shared_ptr<OnDemandOsClientGrpc::TransactionFactoryType>
+            transaction_factory_;
+        std::shared_ptr<shared_model::interface::TransactionBatchParser>
+            batch_parser_;
+        std::shared_ptr<shared_model::interface::TransactionBatchFactory>
+            batch_factory_;
+        std::shared_ptr<AdaptiveProposalPolicy> adaptive_policy_;
+        /// provides the generic stubs for the pre-serialized batches path,
+        /// may be nullptr - the clients then serialize per destination
+        std::shared_ptr<const network::GenericClientFactory>
+            generic_client_factory_;
+        std::shared_ptr<network::AsyncGrpcClient<grpc::ByteBuffer>>
+            generic_async_call_;
       };
 
     }  // namespace transport
@@ -7,10 +7,14 @@
 
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include "backend/protobuf/deserialize_repeated_transactions.hpp"
 #include "backend/protobuf/proposal.hpp"
+#include "backend/protobuf/transaction.hpp"
 #include "common/bind.hpp"
 #include "interfaces/iroha_internal/parse_and_create_batches.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -20,7 +24,7 @@ using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
 
 OnDemandOsServerGrpc::OnDemandOsServerGrpc(
-    std::shared_ptr<OdOsNotification> ordering_service,
+    std::shared_ptr<OnDemandOrderingService> ordering_service,
     std::shared_ptr<TransportFactoryType> transaction_factory,
     std::shared_ptr<shared_model::interface::TransactionBatchParser>
         batch_parser,
@@ -37,7 +41,7 @@ grpc::Status OnDemandOsServerGrpc::SendBatches(
     ::grpc::ServerContext *context,
     const proto::BatchesRequest *request,
     ::google::protobuf::Empty *response) {
-  auto transactions = shared_model::proto::deserializeTransactions(
+  auto transactions = shared_model::proto::deserializeTransactionsParallel(
       *transaction_factory_, request->transactions());
   if (auto e = expected::resultToOptionalError(transactions)) {
     log_->warn(
@@ -70,3 +74,73 @@ grpc::Status OnDemandOsServerGrpc::RequestProposal(
         };
   return ::grpc::Status::OK;
 }
+
+grpc::Status OnDemandOsServerGrpc::RequestProposalDigest(
+    ::grpc::ServerContext *context,
+    const proto::ProposalRequest *request,
+    proto::ProposalDigestResponse *response) {
+  auto opt_proposal = ordering_service_->onRequestProposal(
+      {request->round().block_round(), request->round().reject_round()});
+  if (not opt_proposal) {
+    return ::grpc::Status::OK;
+  }
+  auto const &proposal = **opt_proposal;
+
+  // map the cached batches by their transaction hashes to restore the batch
+  // boundaries of the proposal
+  std::unordered_map<shared_model::crypto::Hash,
+                     OdOsNotification::TransactionBatchType,
+                     shared_model::crypto::Hash::Hasher>
+      batch_by_tx_hash;
+  ordering_service_->forCachedBatches([&batch_by_tx_hash](auto const &batches) {
+    for (auto const &batch : batches) {
+      for (auto const &tx : batch->transactions()) {
+        batch_by_tx_hash.emplace(tx->hash(), batch);
+      }
+    }
+  });
+
+  auto *digest = response->mutable_digest();
+  digest->mutable_round()->set_block_round(request->round().block_round());
+  digest->mutable_round()->set_reject_round(request->round().reject_round());
+  digest->set_created_time(proposal.createdTime());
+  for (auto const &tx : proposal.transactions()) {
+    auto it = batch_by_tx_hash.find(tx.hash());
+    if (it == batch_by_tx_hash.end()) {
+      // a proposal batch is no longer cached and could not be served to the
+      // peer - it has to request the full proposal instead
+      log_->info("RequestProposalDigest: batch of transaction {} is not "
+                 "cached, digest is not served",
+                 tx.hash().hex());
+      response->clear_optional_digest();
+      return ::grpc::Status::OK;
+    }
+    auto hash = it->second->reducedHash().hex();
+    // transactions of one batch are contiguous in the proposal
+    if (digest->batch_hashes_size() == 0
+        or digest->batch_hashes(digest->batch_hashes_size() - 1) != hash) {
+      digest->add_batch_hashes(std::move(hash));
+    }
+  }
+  return ::grpc::Status::OK;
+}
+
+grpc::Status OnDemandOsServerGrpc::RequestBatches(
+    ::grpc::ServerContext *context,
+    const proto::BatchesByHashRequest *request,
+    proto::BatchesRequest *response) {
+  std::unordered_set<std::string> requested_hashes(
+      request->reduced_hashes().begin(), request->reduced_hashes().end());
+  ordering_service_->forCachedBatches([&](auto const &batches) {
+    for (auto const &batch : batches) {
+      if (requested_hashes.count(batch->reducedHash().hex()) != 0) {
+        for (auto const &tx : batch->transactions()) {
+          *response->add_transactions() =
+              static_cast<shared_model::proto::Transaction *>(tx.get())
+                  ->getTransport();
+        }
+      }
+    }
+  });
+  return ::grpc::Status::OK;
+}
@@ -6,7 +6,7 @@
 #ifndef IROHA_ON_DEMAND_OS_TRANSPORT_SERVER_GRPC_HPP
 #define IROHA_ON_DEMAND_OS_TRANSPORT_SERVER_GRPC_HPP
 
-#include "ordering/on_demand_os_transport.hpp"
+#include "ordering/on_demand_ordering_service.hpp"
 
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory.hpp"
@@ -29,7 +29,7 @@ namespace iroha {
                 iroha::protocol::Transaction>;
 
         OnDemandOsServerGrpc(
-            std::shared_ptr<OdOsNotification> ordering_service,
+            std::shared_ptr<OnDemandOrderingService> ordering_service,
             std::shared_ptr<TransportFactoryType> transaction_factory,
             std::shared_ptr<shared_model::interface::TransactionBatchParser>
                 batch_parser,
@@ -46,8 +46,25 @@ namespace iroha {
             const proto::ProposalRequest *request,
             proto::ProposalResponse *response) override;
 
+        /**
+         * Announce the proposal of the round as an ordered list of batch
+         * hashes, so that the peer can rebuild it from its own cache and
+         * pull only the missing batches. The digest is left unset when a
+         * proposal batch is no longer cached - the peer falls back to
+         * RequestProposal then.
+         */
+        grpc::Status RequestProposalDigest(
+            ::grpc::ServerContext *context,
+            const proto::ProposalRequest *request,
+            proto::ProposalDigestResponse *response) override;
+
+        /// Serve cached batches requested by their reduced hashes.
+        grpc::Status RequestBatches(::grpc::ServerContext *context,
+                                    const proto::BatchesByHashRequest *request,
+                                    proto::BatchesRequest *response) override;
+
        private:
-        std::shared_ptr<OdOsNotification> ordering_service_;
+        std::shared_ptr<OnDemandOrderingService> ordering_service_;
 
         std::shared_ptr<TransportFactoryType> transaction_factory_;
         std::shared_ptr<shared_model::interface::TransactionBatchParser>
@@ -15,8 +15,42 @@ using namespace iroha::ordering::cache;
 
 void OnDemandCache::addToBack(
     const OrderingGateCache::BatchesSetType &batches) {
+  // the bloom filter answers "definitely new" for most of the gossip
+  // stream without any locking; possible duplicates are confirmed against
+  // the exact hash set under a shared lock, so re-delivered batches never
+  // take the write lock
+  BatchesSetType new_batches;
+  BatchesSetType maybe_duplicates;
+  for (auto const &batch : batches) {
+    if (seen_batches_.maybeContains(batch->reducedHash())) {
+      maybe_duplicates.insert(batch);
+    } else {
+      new_batches.insert(batch);
+    }
+  }
+
+  if (not maybe_duplicates.empty()) {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    for (auto const &batch : maybe_duplicates) {
+      if (cached_hashes_.count(batch->reducedHash()) == 0) {
+        new_batches.insert(batch);
+      }
+    }
+  }
+
+  if (new_batches.empty()) {
+    return;
+  }
+
   std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-  circ_buffer.back().insert(batches.begin(), batches.end());
+  for (auto const &batch : new_batches) {
+    // recheck under the write lock - another thread may have inserted the
+    // same batch between the confirmation and here
+    if (cached_hashes_.insert(batch->reducedHash()).second) {
+      seen_batches_.add(batch->reducedHash());
+      circ_buffer.back().insert(batch);
+    }
+  }
 }
 
 void OnDemandCache::remove(const OrderingGateCache::HashesSetType &hashes) {
@@ -28,6 +62,7 @@ void OnDemandCache::remove(const OrderingGateCache::HashesSetType &hashes) {
                       [&hashes](const auto &tx) {
                         return hashes.find(tx->hash()) != hashes.end();
                       })) {
+        cached_hashes_.erase(it->get()->reducedHash());
         // returns iterator following the last removed element
         // hence there is no increment in loop iteration_expression
         it = batches.erase(it);
@@ -44,6 +79,15 @@ OrderingGateCache::BatchesSetType OnDemandCache::pop() {
   std::swap(res, circ_buffer.front());
   // push empty set to remove front element
   circ_buffer.push_back(BatchesSetType{});
+  for (auto const &batch : res) {
+    cached_hashes_.erase(batch->reducedHash());
+  }
+  // rebuild the filter from the remaining rounds, so the popped batches may
+  // be cached again if they are re-propagated later
+  seen_batches_.clear();
+  for (auto const &hash : cached_hashes_) {
+    seen_batches_.add(hash);
+  }
   return res;
 }
 
@@ -11,6 +11,7 @@
 #include <shared_mutex>
 
 #include <boost/circular_buffer.hpp>
+#include "cache/bloom_filter.hpp"
 
 namespace iroha {
   namespace ordering {
@@ -32,6 +33,16 @@ namespace iroha {
         mutable std::shared_timed_mutex mutex_;
         using BatchesQueueType = boost::circular_buffer<BatchesSetType>;
         BatchesQueueType circ_buffer{3, BatchesSetType{}};
+        /// reduced hashes of all batches in circ_buffer; the sets themselves
+        /// compare by pointer, so content duplicates are tracked here
+        HashesSetType cached_hashes_;
+        /// lock-free front over cached_hashes_: a negative answer means the
+        /// batch is definitely new, a positive one is confirmed against
+        /// cached_hashes_ under the lock. Rebuilt on pop so popped batches
+        /// may enter the cache again.
+        iroha::cache::BloomFilter<shared_model::crypto::Hash,
+                                  shared_model::crypto::Hash::Hasher>
+            seen_batches_{1u << 18};
       };
 
     }  // namespace cache
@@ -5,7 +5,10 @@
 
 #include "pending_txs_storage/impl/pending_txs_storage_impl.hpp"
 
+#include <vector>
+
 #include "ametsuchi/tx_presence_cache_utils.hpp"
+#include "common/memory_budget.hpp"
 #include "interfaces/transaction.hpp"
 #include "multi_sig_transactions/state/mst_state.hpp"
 
@@ -83,17 +86,22 @@ namespace iroha {
   PendingTransactionStorageImpl::SharedTxsCollectionType
   PendingTransactionStorageImpl::getPendingTransactions(
       const AccountIdType &account_id) const {
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    auto account_batches_iterator = storage_.find(account_id);
-    if (storage_.end() != account_batches_iterator) {
-      SharedTxsCollectionType result;
-      for (const auto &batch : account_batches_iterator->second.batches) {
-        auto &txs = batch->transactions();
-        result.insert(result.end(), txs.begin(), txs.end());
+    std::vector<std::shared_ptr<TransactionBatch>> account_batches;
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      auto account_batches_iterator = storage_.find(account_id);
+      if (storage_.end() == account_batches_iterator) {
+        return {};
       }
-      return result;
+      auto &batches = account_batches_iterator->second.batches;
+      account_batches.assign(batches.begin(), batches.end());
     }
-    return {};
+    SharedTxsCollectionType result;
+    for (const auto &batch : account_batches) {
+      auto &txs = batch->transactions();
+      result.insert(result.end(), txs.begin(), txs.end());
+    }
+    return result;
   }
 
   expected::Result<PendingTransactionStorage::Response,
@@ -104,53 +112,76 @@ namespace iroha {
       const std::optional<shared_model::interface::types::HashType>
           &first_tx_hash) const {
     BOOST_ASSERT_MSG(page_size > 0, "Page size has to be positive");
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    auto account_batches_iterator = storage_.find(account_id);
-    if (storage_.end() == account_batches_iterator) {
+    // only shared pointers to the batches are collected under the lock; the
+    // response transactions list is assembled after it is released, so
+    // readers do not keep the writers out while copying
+    std::vector<std::shared_ptr<TransactionBatch>> page_batches;
+    PendingTransactionStorage::Response response;
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      auto account_batches_iterator = storage_.find(account_id);
+      if (storage_.end() == account_batches_iterator) {
+        if (first_tx_hash) {
+          return iroha::expected::makeError(
+              PendingTransactionStorage::ErrorCode::kNotFound);
+        } else {
+          return iroha::expected::makeValue(
+              PendingTransactionStorage::Response{});
+        }
+      }
+      auto &account_batches = account_batches_iterator->second;
+      auto batch_iterator = account_batches.batches.begin();
       if (first_tx_hash) {
-        return iroha::expected::makeError(
-            PendingTransactionStorage::ErrorCode::kNotFound);
-      } else {
-        return iroha::expected::makeValue(
-            PendingTransactionStorage::Response{});
+        auto index_iterator = account_batches.index.find(*first_tx_hash);
+        if (account_batches.index.end() == index_iterator) {
+          return iroha::expected::makeError(
+              PendingTransactionStorage::ErrorCode::kNotFound);
+        }
+        batch_iterator = index_iterator->second;
       }
-    }
-    auto &account_batches = account_batches_iterator->second;
-    auto batch_iterator = account_batches.batches.begin();
-    if (first_tx_hash) {
-      auto index_iterator = account_batches.index.find(*first_tx_hash);
-      if (account_batches.index.end() == index_iterator) {
-        return iroha::expected::makeError(
-            PendingTransactionStorage::ErrorCode::kNotFound);
+      BOOST_ASSERT_MSG(account_batches.batches.end() != batch_iterator,
+                       "Empty account batches entry was not removed");
+
+      response.all_transactions_size =
+          account_batches.all_transactions_quantity;
+      auto remaining_space = page_size;
+      while (account_batches.batches.end() != batch_iterator
+             and remaining_space
+                 >= batch_iterator->get()->transactions().size()) {
+        page_batches.push_back(*batch_iterator);
+        remaining_space -= batch_iterator->get()->transactions().size();
+        ++batch_iterator;
+      }
+      if (account_batches.batches.end() != batch_iterator) {
+        shared_model::interface::PendingTransactionsPageResponse::BatchInfo
+            next_batch_info;
+        auto &txs = batch_iterator->get()->transactions();
+        next_batch_info.first_tx_hash = txs.front()->hash();
+        next_batch_info.batch_size = txs.size();
+        response.next_batch_info = std::move(next_batch_info);
       }
-      batch_iterator = index_iterator->second;
     }
-    BOOST_ASSERT_MSG(account_batches.batches.end() != batch_iterator,
-                     "Empty account batches entry was not removed");
-
-    PendingTransactionStorage::Response response;
-    response.all_transactions_size = account_batches.all_transactions_quantity;
-    auto remaining_space = page_size;
-    while (account_batches.batches.end() != batch_iterator
-           and remaining_space
-               >= batch_iterator->get()->transactions().size()) {
-      auto &txs = batch_iterator->get()->transactions();
+    for (const auto &batch : page_batches) {
+      auto &txs = batch->transactions();
       response.transactions.insert(
           response.transactions.end(), txs.begin(), txs.end());
-      remaining_space -= txs.size();
-      ++batch_iterator;
-    }
-    if (account_batches.batches.end() != batch_iterator) {
-      shared_model::interface::PendingTransactionsPageResponse::BatchInfo
-          next_batch_info;
-      auto &txs = batch_iterator->get()->transactions();
-      next_batch_info.first_tx_hash = txs.front()->hash();
-      next_batch_info.batch_size = txs.size();
-      response.next_batch_info = std::move(next_batch_info);
     }
     return iroha::expected::makeValue(std::move(response));
   }
 
+  rxcpp::observable<PendingTransactionStorageImpl::AccountIdType>
+  PendingTransactionStorageImpl::updates() const {
+    return updates_subject_.get_observable();
+  }
+
+  void PendingTransactionStorageImpl::notifyUpdates(
+      const std::set<AccountIdType> &accounts) {
+    auto subscriber = updates_subject_.get_subscriber();
+    for (const auto &account : accounts) {
+      subscriber.on_next(account);
+    }
+  }
+
   std::set<PendingTransactionStorageImpl::AccountIdType>
   PendingTransactionStorageImpl::batchCreators(const TransactionBatch &batch) {
     std::set<AccountIdType> creators;
@@ -162,44 +193,67 @@ namespace iroha {
 
   void PendingTransactionStorageImpl::updatedBatchesHandler(
       const SharedState &updated_batches) {
-    // need to test performance somehow - where to put the lock
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-    updated_batches->iterateBatches([this](const auto &batch) {
-      if (isReplay(*batch)) {
-        return;
-      }
-
-      auto first_tx_hash = batch->transactions().front()->hash();
-      auto batch_creators = batchCreators(*batch);
-      auto batch_size = batch->transactions().size();
-      for (const auto &creator : batch_creators) {
-        auto account_batches_iterator = storage_.find(creator);
-        if (storage_.end() == account_batches_iterator) {
-          auto insertion_result = storage_.emplace(
-              creator, PendingTransactionStorageImpl::AccountBatches{});
-          BOOST_ASSERT(insertion_result.second);
-          account_batches_iterator = insertion_result.first;
+    std::set<AccountIdType> updated_creators;
+    {
+      // need to test performance somehow - where to put the lock
+      std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+      updated_batches->iterateBatches([this, &updated_creators](
+                                          const auto &batch) {
+        if (isReplay(*batch)) {
+          return;
         }
 
-        auto &account_batches = account_batches_iterator->second;
-        auto index_iterator = account_batches.index.find(first_tx_hash);
-        if (index_iterator == account_batches.index.end()) {
-          // inserting the batch
-          account_batches.all_transactions_quantity += batch_size;
-          account_batches.batches.push_back(batch);
-          auto inserted_batch_iterator =
-              std::prev(account_batches.batches.end());
-          account_batches.index.emplace(first_tx_hash, inserted_batch_iterator);
-          for (auto &tx : batch->transactions()) {
-            account_batches.txs_to_batches.insert({tx->hash(), batch});
+        auto first_tx_hash = batch->transactions().front()->hash();
+        auto batch_creators = batchCreators(*batch);
+        auto batch_size = batch->transactions().size();
+        // one batch is indexed under each of its creators, but all the
+        // entries share one object, so the budget is charged once
+        bool inserted = false;
+        uint64_t replaced_bytes = 0;
+        for (const auto &creator : batch_creators) {
+          auto account_batches_iterator = storage_.find(creator);
+          if (storage_.end() == account_batches_iterator) {
+            auto insertion_result = storage_.emplace(
+                creator, PendingTransactionStorageImpl::AccountBatches{});
+            BOOST_ASSERT(insertion_result.second);
+            account_batches_iterator = insertion_result.first;
           }
-        } else {
-          // updating batch
-          auto &account_batch = index_iterator->second;
-          *account_batch = batch;
+
+          auto &account_batches = account_batches_iterator->second;
+          auto index_iterator = account_batches.index.find(first_tx_hash);
+          if (index_iterator == account_batches.index.end()) {
+            // inserting the batch
+            inserted = true;
+            account_batches.all_transactions_quantity += batch_size;
+            account_batches.batches.push_back(batch);
+            auto inserted_batch_iterator =
+                std::prev(account_batches.batches.end());
+            account_batches.index.emplace(first_tx_hash,
+                                          inserted_batch_iterator);
+            for (auto &tx : batch->transactions()) {
+              account_batches.txs_to_batches.insert({tx->hash(), batch});
+            }
+          } else {
+            // updating batch
+            auto &account_batch = index_iterator->second;
+            if (replaced_bytes == 0) {
+              replaced_bytes = batchMemoryUse(**account_batch);
+            }
+            *account_batch = batch;
+          }
+          updated_creators.insert(creator);
         }
-      }
-    });
+        if (inserted) {
+          MemoryBudget::instance().charge(batchMemoryUse(*batch));
+        } else if (replaced_bytes != 0) {
+          // the replacing batch differs only by its signatures, but the
+          // accounting has to stay exact for the release to balance
+          MemoryBudget::instance().charge(batchMemoryUse(*batch));
+          MemoryBudget::instance().release(replaced_bytes);
+        }
+      });
+    }
+    notifyUpdates(updated_creators);
   }
 
   bool PendingTransactionStorageImpl::isReplay(
@@ -225,11 +279,13 @@ namespace iroha {
     presence_cache_ = cache;
   }
 
-  inline void PendingTransactionStorageImpl::removeFromStorage(
+  std::set<PendingTransactionStorageImpl::AccountIdType>
+  PendingTransactionStorageImpl::removeFromStorage(
       const HashType &first_tx_hash,
       const std::set<AccountIdType> &batch_creators,
       uint64_t batch_size) {
     // outer scope has to acquire unique lock over mutex_
+    std::set<AccountIdType> removed_creators;
     for (const auto &creator : batch_creators) {
       auto account_batches_iterator = storage_.find(creator);
       if (account_batches_iterator != storage_.end()) {
@@ -242,26 +298,37 @@ namespace iroha {
           account_batches.batches.erase(batch_iterator);
           account_batches.index.erase(index_iterator);
           account_batches.all_transactions_quantity -= batch_size;
+          removed_creators.insert(creator);
         }
         if (0 == account_batches.all_transactions_quantity) {
           storage_.erase(account_batches_iterator);
         }
       }
     }
+    return removed_creators;
   }
 
   void PendingTransactionStorageImpl::removeBatch(const SharedBatch &batch) {
     auto creators = batchCreators(*batch);
     auto first_tx_hash = batch->transactions().front()->hash();
     auto batch_size = batch->transactions().size();
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-    removeFromStorage(first_tx_hash, creators, batch_size);
+    std::set<AccountIdType> removed_creators;
+    {
+      std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+      removed_creators =
+          removeFromStorage(first_tx_hash, creators, batch_size);
+    }
+    if (not removed_creators.empty()) {
+      MemoryBudget::instance().release(batchMemoryUse(*batch));
+    }
+    notifyUpdates(removed_creators);
   }
 
   void PendingTransactionStorageImpl::removeBatch(
       const PreparedTransactionDescriptor &prepared_transaction) {
     boost::optional<std::set<AccountIdType>> creators = boost::none;
     boost::optional<uint64_t> batch_size = boost::none;
+    uint64_t batch_bytes = 0;
     auto &creator_id = prepared_transaction.first;
     auto &first_transaction_hash = prepared_transaction.second;
     {
@@ -276,12 +343,21 @@ namespace iroha {
           BOOST_ASSERT(batch_iterator != account_batches.batches.end());
           creators = batchCreators(**batch_iterator);
           batch_size = boost::size((*batch_iterator)->transactions());
+          batch_bytes = batchMemoryUse(**batch_iterator);
         }
       }
     }
     if (creators and batch_size) {
-      std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-      removeFromStorage(first_transaction_hash, *creators, *batch_size);
+      std::set<AccountIdType> removed_creators;
+      {
+        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        removed_creators =
+            removeFromStorage(first_transaction_hash, *creators, *batch_size);
+      }
+      if (not removed_creators.empty()) {
+        MemoryBudget::instance().release(batch_bytes);
+      }
+      notifyUpdates(removed_creators);
     }
   }
 
@@ -298,9 +374,18 @@ namespace iroha {
         auto const &first_transaction_hash = transactions.front()->hash();
         auto const &creators = batchCreators(*batch);
         auto batch_size = transactions.size();
+        auto batch_bytes = batchMemoryUse(*batch);
         read_lock.unlock();
-        std::unique_lock<std::shared_timed_mutex> write_lock(mutex_);
-        removeFromStorage(first_transaction_hash, creators, batch_size);
+        std::set<AccountIdType> removed_creators;
+        {
+          std::unique_lock<std::shared_timed_mutex> write_lock(mutex_);
+          removed_creators =
+              removeFromStorage(first_transaction_hash, creators, batch_size);
+        }
+        if (not removed_creators.empty()) {
+          MemoryBudget::instance().release(batch_bytes);
+        }
+        notifyUpdates(removed_creators);
         return;
       }
     }
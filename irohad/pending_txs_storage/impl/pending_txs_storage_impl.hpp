@@ -68,6 +68,8 @@ namespace iroha {
         const std::optional<shared_model::interface::types::HashType>
             &first_tx_hash) const override;
 
+    rxcpp::observable<AccountIdType> updates() const override;
+
     void insertPresenceCache(
         std::shared_ptr<ametsuchi::TxPresenceCache> &cache) override;
 
@@ -78,12 +80,18 @@ namespace iroha {
 
     void removeBatch(const PreparedTransactionDescriptor &prepared_transaction);
 
-    void removeFromStorage(const HashType &first_tx_hash,
-                           const std::set<AccountIdType> &batch_creators,
-                           uint64_t batch_size);
+    /// @return creators whose pending transactions were actually removed
+    std::set<AccountIdType> removeFromStorage(
+        const HashType &first_tx_hash,
+        const std::set<AccountIdType> &batch_creators,
+        uint64_t batch_size);
 
     void removeTransaction(HashType const &hash);
 
+    /// notify the subscribers of updates(); must be called without mutex_
+    /// held, since a subscriber may query the storage from within on_next
+    void notifyUpdates(const std::set<AccountIdType> &accounts);
+
     static std::set<AccountIdType> batchCreators(const TransactionBatch &batch);
 
     bool isReplay(shared_model::interface::TransactionBatch const &batch);
@@ -132,6 +140,9 @@ namespace iroha {
      * Maps account names with its storages of pending transactions or batches.
      */
     std::unordered_map<AccountIdType, AccountBatches> storage_;
+
+    /// emits the creators affected by every storage modification
+    rxcpp::subjects::subject<AccountIdType> updates_subject_;
   };
 
 }  // namespace iroha
@@ -8,6 +8,7 @@
 
 #include <optional>
 
+#include <rxcpp/rx-observable-fwd.hpp>
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "common/result.hpp"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
@@ -81,6 +82,14 @@ namespace iroha {
         const std::optional<shared_model::interface::types::HashType>
             &first_tx_hash) const = 0;
 
+    /**
+     * Emits the id of an account whose set of pending transactions has
+     * changed. Lets the clients wait for a notification instead of polling
+     * the storage in a loop.
+     */
+    virtual rxcpp::observable<shared_model::interface::types::AccountIdType>
+    updates() const = 0;
+
     virtual ~PendingTransactionStorage() = default;
   };
 
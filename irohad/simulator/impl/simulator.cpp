@@ -6,7 +6,9 @@
 #include "simulator/impl/simulator.hpp"
 
 #include <boost/range/adaptor/transformed.hpp>
+#include <boost/range/size.hpp>
 #include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/temporary_wsv.hpp"
 #include "common/bind.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
@@ -35,13 +37,27 @@ namespace iroha {
       ordering_gate->onProposal().subscribe(
           proposal_subscription_, [this](const network::OrderingEvent &event) {
             if (event.proposal) {
+              // overlap block building with the stateful validation: the
+              // common outcome is that every transaction passes, so the
+              // block for that case is assembled concurrently and sealing
+              // after validation is reduced to adopting and signing it
+              this->startOptimisticBlockBuild(
+                  getProposalUnsafe(event),
+                  event.ledger_state->top_block_info);
               auto validated_proposal_and_errors =
-                  this->processProposal(*getProposalUnsafe(event));
+                  this->processProposal(getProposalUnsafe(event));
 
               notifier_.get_subscriber().on_next(
                   VerifiedProposalCreatorEvent{validated_proposal_and_errors,
                                                event.round,
                                                event.ledger_state});
+
+              // prepare the validated state only after the downstream
+              // subscribers have created the block and dispatched the votes,
+              // so that the database prepare overlaps consensus voting
+              if (wsv_to_prepare_) {
+                ametsuchi_factory_->prepareBlock(std::move(wsv_to_prepare_));
+              }
             } else {
               notifier_.get_subscriber().on_next(VerifiedProposalCreatorEvent{
                   boost::none, event.round, event.ledger_state});
@@ -82,19 +98,36 @@ namespace iroha {
 
     std::shared_ptr<validation::VerifiedProposalAndErrors>
     Simulator::processProposal(
-        const shared_model::interface::Proposal &proposal) {
-      log_->info("process proposal: {}", proposal);
+        std::shared_ptr<const shared_model::interface::Proposal> proposal) {
+      log_->info("process proposal: {}", *proposal);
 
       auto storage = ametsuchi_factory_->createTemporaryWsv(command_executor_);
 
       std::shared_ptr<iroha::validation::VerifiedProposalAndErrors>
           validated_proposal_and_errors =
-              validator_->validate(proposal, *storage);
-      ametsuchi_factory_->prepareBlock(std::move(storage));
+              validator_->validate(std::move(proposal), *storage);
+      // the state is prepared by the ordering event subscription once the
+      // block built on top of it has been handed to consensus
+      wsv_to_prepare_ = std::move(storage);
 
       return validated_proposal_and_errors;
     }
 
+    void Simulator::startOptimisticBlockBuild(
+        std::shared_ptr<const shared_model::interface::Proposal> proposal,
+        const TopBlockInfo &top_block_info) {
+      optimistic_block_ = std::async(
+          std::launch::async, [this, proposal, top_block_info] {
+            return std::shared_ptr<shared_model::interface::Block>{
+                block_factory_->unsafeCreateBlock(
+                    top_block_info.height + 1,
+                    top_block_info.top_hash,
+                    proposal->createdTime(),
+                    proposal->transactions(),
+                    std::vector<shared_model::crypto::Hash>{})};
+          });
+    }
+
     boost::optional<std::shared_ptr<shared_model::interface::Block>>
     Simulator::processVerifiedProposal(
         const std::shared_ptr<iroha::validation::VerifiedProposalAndErrors>
@@ -110,12 +143,32 @@ namespace iroha {
            verified_proposal_and_errors->rejected_transactions) {
         rejected_hashes.push_back(rejected_tx.tx_hash);
       }
-      std::shared_ptr<shared_model::interface::Block> block =
-          block_factory_->unsafeCreateBlock(top_block_info.height + 1,
-                                            top_block_info.top_hash,
-                                            proposal->createdTime(),
-                                            proposal->transactions(),
-                                            rejected_hashes);
+
+      // the build started together with the validation must be collected
+      // in any case, so that it never runs into the next round
+      std::shared_ptr<shared_model::interface::Block> optimistic_block;
+      if (optimistic_block_.valid()) {
+        optimistic_block = optimistic_block_.get();
+      }
+
+      std::shared_ptr<shared_model::interface::Block> block;
+      if (optimistic_block and rejected_hashes.empty()
+          and optimistic_block->height() == top_block_info.height + 1
+          and optimistic_block->prevHash() == top_block_info.top_hash
+          and optimistic_block->txsNumber()
+              == boost::size(proposal->transactions())) {
+        // every transaction passed, so the block assembled during the
+        // validation is exactly the one to vote on - sealing is just
+        // signing it
+        block = std::move(optimistic_block);
+      } else {
+        block =
+            block_factory_->unsafeCreateBlock(top_block_info.height + 1,
+                                              top_block_info.top_hash,
+                                              proposal->createdTime(),
+                                              proposal->transactions(),
+                                              rejected_hashes);
+      }
       crypto_signer_->sign(*block);
       log_->info("Created block: {}", *block);
       return block;
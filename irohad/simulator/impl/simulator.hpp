@@ -9,6 +9,8 @@
 #include "simulator/block_creator.hpp"
 #include "simulator/verified_proposal_creator.hpp"
 
+#include <future>
+
 #include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/temporary_factory.hpp"
@@ -45,7 +47,8 @@ namespace iroha {
       ~Simulator() override;
 
       std::shared_ptr<validation::VerifiedProposalAndErrors> processProposal(
-          const shared_model::interface::Proposal &proposal) override;
+          std::shared_ptr<const shared_model::interface::Proposal> proposal)
+          override;
 
       rxcpp::observable<VerifiedProposalCreatorEvent> onVerifiedProposal()
           override;
@@ -59,6 +62,15 @@ namespace iroha {
       rxcpp::observable<BlockCreatorEvent> onBlock() override;
 
      private:
+      /**
+       * Start assembling the block for the every-transaction-passes
+       * outcome of the stateful validation running on the caller thread,
+       * so that the transaction composition, serialization and hashing of
+       * the block overlap the validation instead of following it
+       */
+      void startOptimisticBlockBuild(
+          std::shared_ptr<const shared_model::interface::Proposal> proposal,
+          const TopBlockInfo &top_block_info);
       // internal
       std::shared_ptr<iroha::ametsuchi::CommandExecutor> command_executor_;
 
@@ -72,10 +84,17 @@ namespace iroha {
 
       std::shared_ptr<validation::StatefulValidator> validator_;
       std::shared_ptr<ametsuchi::TemporaryFactory> ametsuchi_factory_;
+      /// validated state waiting to be prepared after the block is dispatched
+      std::unique_ptr<ametsuchi::TemporaryWsv> wsv_to_prepare_;
       std::shared_ptr<CryptoSignerType> crypto_signer_;
       std::unique_ptr<shared_model::interface::UnsafeBlockFactory>
           block_factory_;
 
+      /// block assembled concurrently with the stateful validation; it is
+      /// adopted at sealing when every proposal transaction passed
+      std::future<std::shared_ptr<shared_model::interface::Block>>
+          optimistic_block_;
+
       logger::LoggerPtr log_;
     };
   }  // namespace simulator
@@ -6,6 +6,8 @@
 #ifndef IROHA_VERIFIED_PROPOSAL_CREATOR_HPP
 #define IROHA_VERIFIED_PROPOSAL_CREATOR_HPP
 
+#include <memory>
+
 #include <rxcpp/rx-observable-fwd.hpp>
 #include "simulator/verified_proposal_creator_common.hpp"
 
@@ -31,7 +33,9 @@ namespace iroha {
        * Execute stateful validation for given proposal
        */
       virtual std::shared_ptr<validation::VerifiedProposalAndErrors>
-      processProposal(const shared_model::interface::Proposal &proposal) = 0;
+      processProposal(
+          std::shared_ptr<const shared_model::interface::Proposal>
+              proposal) = 0;
 
       /**
        * Emit proposals which were verified by stateful validator
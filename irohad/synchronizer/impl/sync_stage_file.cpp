@@ -0,0 +1,158 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/impl/sync_stage_file.hpp"
+
+#include <cstring>
+
+#include "backend/protobuf/block.hpp"
+#include "cryptography/blob.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  constexpr char kBlockRecord = 'B';
+  constexpr char kFloorRecord = 'F';
+
+  template <typename IntType>
+  void putInt(std::string &buffer, IntType value) {
+    char bytes[sizeof(IntType)];
+    std::memcpy(bytes, &value, sizeof(IntType));
+    buffer.append(bytes, sizeof(IntType));
+  }
+
+  void putString(std::string &buffer, const std::string &value) {
+    putInt<uint32_t>(buffer, value.size());
+    buffer.append(value);
+  }
+
+  /// reads an integer, returns false on a truncated record
+  template <typename IntType>
+  bool getInt(std::istream &in, IntType &value) {
+    char bytes[sizeof(IntType)];
+    if (not in.read(bytes, sizeof(IntType))) {
+      return false;
+    }
+    std::memcpy(&value, bytes, sizeof(IntType));
+    return true;
+  }
+
+  bool getString(std::istream &in, std::string &value) {
+    uint32_t size{};
+    if (not getInt(in, size)) {
+      return false;
+    }
+    value.resize(size);
+    return static_cast<bool>(in.read(&value[0], size));
+  }
+}  // namespace
+
+namespace iroha {
+  namespace synchronizer {
+
+    SyncStageFile::SyncStageFile(std::string path, logger::LoggerPtr log)
+        : path_(std::move(path)), log_(std::move(log)) {
+      load();
+      out_.open(path_, std::ios::binary | std::ios::app);
+      if (not out_.is_open()) {
+        log_->error("Cannot open sync stage file {} for writing", path_);
+      }
+    }
+
+    void SyncStageFile::stage(const shared_model::interface::Block &block) {
+      auto serialized = shared_model::crypto::toBinaryString(block.blob());
+      std::string record;
+      record.push_back(kBlockRecord);
+      putInt<uint64_t>(record, block.height());
+      putString(record, serialized);
+
+      std::lock_guard<std::mutex> guard(mutex_);
+      staged_[block.height()] = std::move(serialized);
+      append(record);
+    }
+
+    std::vector<std::shared_ptr<shared_model::interface::Block>>
+    SyncStageFile::takeContiguous(
+        shared_model::interface::types::HeightType above_height) {
+      std::vector<std::shared_ptr<shared_model::interface::Block>> chain;
+
+      std::lock_guard<std::mutex> guard(mutex_);
+      auto expected_height = above_height + 1;
+      for (auto it = staged_.find(expected_height); it != staged_.end()
+           and it->first == expected_height;
+           ++it, ++expected_height) {
+        iroha::protocol::Block_v1 proto_block;
+        if (not proto_block.ParseFromString(it->second)) {
+          log_->warn("Staged block {} in {} does not parse, dropping the rest",
+                     it->first,
+                     path_);
+          break;
+        }
+        chain.push_back(
+            std::make_shared<shared_model::proto::Block>(
+                std::move(proto_block)));
+      }
+      return chain;
+    }
+
+    void SyncStageFile::markApplied(
+        shared_model::interface::types::HeightType height) {
+      std::lock_guard<std::mutex> guard(mutex_);
+      staged_.erase(staged_.begin(), staged_.upper_bound(height));
+      if (staged_.empty()) {
+        // everything staged has been applied - reclaim the disk space
+        // instead of journalling a floor record
+        out_.close();
+        out_.open(path_, std::ios::binary | std::ios::trunc);
+        if (not out_.is_open()) {
+          log_->error("Cannot truncate sync stage file {}", path_);
+        }
+        return;
+      }
+      std::string record;
+      record.push_back(kFloorRecord);
+      putInt<uint64_t>(record, height);
+      append(record);
+    }
+
+    void SyncStageFile::load() {
+      std::ifstream in(path_, std::ios::binary);
+      if (not in.is_open()) {
+        return;
+      }
+      char record_type{};
+      while (in.get(record_type)) {
+        if (record_type == kBlockRecord) {
+          uint64_t height{};
+          std::string block;
+          if (not getInt(in, height) or not getString(in, block)) {
+            break;
+          }
+          staged_[height] = std::move(block);
+        } else if (record_type == kFloorRecord) {
+          uint64_t height{};
+          if (not getInt(in, height)) {
+            break;
+          }
+          staged_.erase(staged_.begin(), staged_.upper_bound(height));
+        } else {
+          log_->error("Unknown record type in sync stage file {}", path_);
+          break;
+        }
+      }
+    }
+
+    void SyncStageFile::append(const std::string &record) {
+      if (not out_.is_open()) {
+        return;
+      }
+      out_.write(record.data(), record.size());
+      out_.flush();
+      if (not out_) {
+        log_->error("Cannot append to sync stage file {}", path_);
+      }
+    }
+
+  }  // namespace synchronizer
+}  // namespace iroha
@@ -5,21 +5,91 @@
 
 #include "synchronizer/impl/synchronizer_impl.hpp"
 
+#include <algorithm>
+#include <future>
+#include <thread>
 #include <utility>
 
+#include <rxcpp/operators/rx-take_while.hpp>
 #include <rxcpp/operators/rx-tap.hpp>
 #include "ametsuchi/block_query_factory.hpp"
 #include "ametsuchi/command_executor.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "common/bind.hpp"
+#include "common/spsc_channel.hpp"
 #include "common/result.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/common_objects/string_view_types.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
+#include "network/impl/peer_zones.hpp"
+#include "synchronizer/impl/sync_stage_file.hpp"
 
 using namespace shared_model::interface::types;
 
+namespace {
+  /// number of consecutive blocks asked from one peer in striped download
+  constexpr shared_model::interface::types::HeightType kSyncStripeSize = 500;
+
+  /// upper bound on the stripes downloaded concurrently
+  constexpr size_t kMaxParallelStripes = 4;
+
+  /// blocks buffered between the download and the apply stages, power of two
+  constexpr size_t kPrefetchBufferSize = 16;
+
+  using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+
+  /**
+   * Run the chain through a bounded channel filled from a separate
+   * thread, so that the network transfer of further blocks overlaps with
+   * validation and application of the current one. Blocks are yielded
+   * strictly in the upstream order; an upstream error is forwarded after
+   * the buffered blocks are consumed. The channel parks whichever side
+   * outpaces the other instead of spinning, so a slow download does not
+   * burn the apply core and vice versa.
+   */
+  rxcpp::observable<BlockPtr> prefetchChain(rxcpp::observable<BlockPtr> chain) {
+    return rxcpp::observable<>::create<BlockPtr>(
+        [chain](rxcpp::subscriber<BlockPtr> subscriber) {
+          iroha::containers::SpscChannel<BlockPtr, kPrefetchBufferSize>
+              channel;
+          std::exception_ptr upstream_error;
+
+          rxcpp::composite_subscription upstream_lifetime;
+          std::thread producer([&] {
+            chain.subscribe(
+                upstream_lifetime,
+                [&](BlockPtr block) {
+                  if (not channel.push(std::move(block))) {
+                    // the consumer has gone, drop the rest of the stream
+                    upstream_lifetime.unsubscribe();
+                  }
+                },
+                [&](std::exception_ptr error) { upstream_error = error; });
+            // also covers errors and unsubscription in the middle of the
+            // stream; buffered blocks stay poppable after close
+            channel.close();
+          });
+
+          BlockPtr block;
+          while (subscriber.is_subscribed() and channel.pop(block)) {
+            subscriber.on_next(std::move(block));
+          }
+          channel.close();
+          upstream_lifetime.unsubscribe();
+          producer.join();
+
+          if (subscriber.is_subscribed()) {
+            if (upstream_error) {
+              subscriber.on_error(upstream_error);
+            } else {
+              subscriber.on_completed();
+            }
+          }
+        });
+  }
+}  // namespace
+
 namespace iroha {
   namespace synchronizer {
 
@@ -30,12 +100,16 @@ namespace iroha {
         std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
         std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
         std::shared_ptr<network::BlockLoader> block_loader,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<network::PeerZones> peer_zones,
+        std::shared_ptr<SyncStageFile> stage_file)
         : command_executor_(std::move(command_executor)),
           validator_(std::move(validator)),
           mutable_factory_(std::move(mutable_factory)),
           block_query_factory_(std::move(block_query_factory)),
           block_loader_(std::move(block_loader)),
+          peer_zones_(std::move(peer_zones)),
+          stage_file_(std::move(stage_file)),
           notifier_(notifier_lifetime_),
           log_(std::move(log)) {
       consensus_gate->onOutcome().subscribe(
@@ -98,9 +172,77 @@ namespace iroha {
       auto storage = std::move(storage_result).assumeValue();
       shared_model::interface::types::HeightType my_height = start_height;
 
+      // same-zone peers first: a bulk transfer from a peer in the same
+      // failure domain pays neither inter-region round-trips nor egress,
+      // and the commit signers all hold the same blocks anyway
+      const auto ordered_keys = peer_zones_
+          ? peer_zones_->preferSameZone(public_keys)
+          : public_keys;
+
       // TODO andrei 17.10.18 IR-1763 Add delay strategy for loading blocks
       using namespace iroha::expected;
-      for (const auto &public_key : public_keys) {
+
+      // a previous catch-up may have been interrupted after some stripes
+      // were already downloaded; apply the staged range first, so only
+      // the blocks past it are asked from the network again
+      if (stage_file_) {
+        auto staged_chain = stage_file_->takeContiguous(my_height);
+        if (not staged_chain.empty()) {
+          const auto applied =
+              validator_->validateAndApplyWindow(staged_chain, *storage);
+          if (applied > 0) {
+            my_height = staged_chain[applied - 1]->height();
+          }
+          // blocks past the applied prefix failed verification and will
+          // be re-downloaded and re-staged below
+          stage_file_->markApplied(my_height);
+          if (my_height >= target_height) {
+            return mutable_factory_->commit(std::move(storage));
+          }
+        }
+      }
+
+      // when we are far behind and several peers signed the commit, fetch
+      // consecutive stripes of the missing range from different peers in
+      // parallel; the reassembled chain is still validated and applied in
+      // order, only the network transfer is parallelized
+      while (ordered_keys.size() > 1
+             and target_height - my_height > kSyncStripeSize) {
+        auto striped_chain =
+            downloadStripes(my_height, target_height, ordered_keys);
+        if (striped_chain.empty()) {
+          break;
+        }
+        if (stage_file_) {
+          // spill the reassembled window before applying it, so that a
+          // restart resumes from here instead of downloading it again
+          for (const auto &block : striped_chain) {
+            stage_file_->stage(*block);
+          }
+        }
+        // the reassembled window is verified as a whole before being
+        // applied, so a corrupt block is rejected before any WSV write
+        // and the apply loop runs with validation already done
+        const auto applied =
+            validator_->validateAndApplyWindow(striped_chain, *storage);
+        if (applied > 0) {
+          my_height = striped_chain[applied - 1]->height();
+          if (stage_file_) {
+            stage_file_->markApplied(my_height);
+          }
+        }
+        if (applied == striped_chain.size()) {
+          if (my_height >= target_height) {
+            return mutable_factory_->commit(std::move(storage));
+          }
+        } else {
+          // the rest of the window did not verify or apply - ask it again
+          // from single peers below
+          break;
+        }
+      }
+
+      for (const auto &public_key : ordered_keys) {
         while (true) {
           bool got_some_blocks_from_this_peer = false;
           log_->debug(
@@ -113,7 +255,7 @@ namespace iroha {
 
           if (hasValue(retrieve_blocks_result)) {
             auto network_chain_with_updates =
-                retrieve_blocks_result.assumeValue().tap(
+                prefetchChain(retrieve_blocks_result.assumeValue()).tap(
                     [&my_height, &got_some_blocks_from_this_peer](
                         const std::shared_ptr<shared_model::interface::Block>
                             &block) {
@@ -149,6 +291,87 @@ namespace iroha {
           "Failed to download and commit any blocks from given peers");
     }
 
+    std::vector<std::shared_ptr<shared_model::interface::Block>>
+    SynchronizerImpl::downloadStripes(
+        const shared_model::interface::types::HeightType from_height,
+        const shared_model::interface::types::HeightType target_height,
+        const PublicKeyCollectionType &public_keys) {
+      const auto missing_blocks = target_height - from_height;
+      const auto stripes = std::min(
+          {kMaxParallelStripes,
+           public_keys.size(),
+           static_cast<size_t>((missing_blocks + kSyncStripeSize - 1)
+                               / kSyncStripeSize)});
+
+      std::vector<std::future<std::vector<BlockPtr>>> stripe_futures;
+      stripe_futures.reserve(stripes);
+      for (size_t i = 0; i < stripes; ++i) {
+        const auto stripe_from = from_height + i * kSyncStripeSize;
+        const auto stripe_top =
+            std::min(stripe_from + kSyncStripeSize, target_height);
+        const auto &public_key = public_keys[i];
+        log_->debug(
+            "trying to download blocks from {} to {} from peer with key {}",
+            stripe_from + 1,
+            stripe_top,
+            public_key);
+        stripe_futures.push_back(std::async(
+            std::launch::async,
+            [this, stripe_from, stripe_top, &public_key] {
+              std::vector<BlockPtr> stripe;
+              block_loader_
+                  ->retrieveBlocks(stripe_from,
+                                   PublicKeyHexStringView{public_key})
+                  .match(
+                      [&](const auto &blocks) {
+                        blocks.value
+                            .take_while([stripe_top](const BlockPtr &block) {
+                              return block->height() <= stripe_top;
+                            })
+                            .as_blocking()
+                            .subscribe(
+                                [&stripe](BlockPtr block) {
+                                  stripe.push_back(std::move(block));
+                                },
+                                [](std::exception_ptr) {
+                                  // a failed stripe just comes out shorter;
+                                  // the gap is detected during reassembly
+                                });
+                      },
+                      [&](const auto &error) {
+                        log_->warn(
+                            "failed to retrieve blocks starting from {} from "
+                            "peer {}: {}",
+                            stripe_from,
+                            public_key,
+                            error.error);
+                      });
+              return stripe;
+            }));
+      }
+
+      // reassemble in order, keeping only the contiguous prefix; all futures
+      // are drained even after a gap so that no download outlives this call
+      std::vector<BlockPtr> chain;
+      auto expected_height = from_height + 1;
+      bool gap = false;
+      for (auto &stripe_future : stripe_futures) {
+        auto stripe = stripe_future.get();
+        if (gap) {
+          continue;
+        }
+        for (auto &block : stripe) {
+          if (block->height() != expected_height) {
+            gap = true;
+            break;
+          }
+          chain.push_back(std::move(block));
+          ++expected_height;
+        }
+      }
+      return chain;
+    }
+
     iroha::expected::Result<std::unique_ptr<ametsuchi::MutableStorage>,
                             std::string>
     SynchronizerImpl::getStorage() {
@@ -8,6 +8,9 @@
 
 #include "synchronizer/synchronizer.hpp"
 
+#include <memory>
+#include <vector>
+
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/commit_result.hpp"
 #include "ametsuchi/mutable_factory.hpp"
@@ -25,8 +28,14 @@ namespace iroha {
     class CommandExecutor;
   }  // namespace ametsuchi
 
+  namespace network {
+    class PeerZones;
+  }  // namespace network
+
   namespace synchronizer {
 
+    class SyncStageFile;
+
     class SynchronizerImpl : public Synchronizer {
      public:
       SynchronizerImpl(
@@ -36,7 +45,9 @@ namespace iroha {
           std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<network::BlockLoader> block_loader,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<network::PeerZones> peer_zones = nullptr,
+          std::shared_ptr<SyncStageFile> stage_file = nullptr);
 
       ~SynchronizerImpl() override;
 
@@ -58,6 +69,22 @@ namespace iroha {
           const shared_model::interface::types::PublicKeyCollectionType
               &public_keys);
 
+      /**
+       * Download consecutive stripes of the missing height range from
+       * different peers concurrently and reassemble them in order
+       * @param from_height - the last block height we already have
+       * @param target_height - the block height that must be reached
+       * @param public_keys - public keys of peers from which to ask the blocks
+       * @return the longest contiguous chain starting at from_height + 1 that
+       * the peers provided; blocks past the first gap are discarded
+       */
+      std::vector<std::shared_ptr<shared_model::interface::Block>>
+      downloadStripes(
+          const shared_model::interface::types::HeightType from_height,
+          const shared_model::interface::types::HeightType target_height,
+          const shared_model::interface::types::PublicKeyCollectionType
+              &public_keys);
+
       void processNext(const consensus::PairValid &msg);
 
       /**
@@ -80,6 +107,14 @@ namespace iroha {
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<network::BlockLoader> block_loader_;
 
+      /// failure-domain labels of the peers; when set, same-zone peers
+      /// are asked for the missing blocks first
+      std::shared_ptr<network::PeerZones> peer_zones_;
+
+      /// when set, downloaded stripes are staged here before the apply,
+      /// so an interrupted catch-up resumes without re-downloading them
+      std::shared_ptr<SyncStageFile> stage_file_;
+
       // internal
       rxcpp::composite_subscription notifier_lifetime_;
       rxcpp::subjects::subject<SynchronizationEvent> notifier_;
@@ -0,0 +1,82 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_COMMAND_ASYNC_CLIENT_HPP
+#define TORII_COMMAND_ASYNC_CLIENT_HPP
+
+#include <endpoint.grpc.pb.h>
+#include <grpc++/grpc++.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "logger/logger_fwd.hpp"
+#include "network/impl/async_grpc_client.hpp"
+
+namespace torii {
+
+  /**
+   * Multiplexed command client. All calls share one channel and are
+   * issued asynchronously over completion queues, so any number of
+   * submissions and status polls can be in flight concurrently without a
+   * thread per call, and a large transaction list is split into chunks
+   * pipelined as concurrent calls instead of one oversized message.
+   */
+  class CommandAsyncClient {
+   public:
+    using Service = iroha::protocol::CommandService_v1;
+
+    /// transactions per pipelined ListTorii chunk
+    static constexpr size_t kDefaultListChunkSize = 100;
+
+    /**
+     * @param stub - the stub of the shared channel the calls multiplex on
+     * @param log - the logger to use
+     * @param completion_queue_count - number of completion queues and
+     * polling threads draining the call completions
+     */
+    CommandAsyncClient(std::shared_ptr<Service::StubInterface> stub,
+                       logger::LoggerPtr log,
+                       std::size_t completion_queue_count = 1);
+
+    /**
+     * Asynchronously submits a transaction
+     * @param on_sent - invoked on a completion queue thread
+     */
+    void Torii(const iroha::protocol::Transaction &tx,
+               std::function<void(grpc::Status)> on_sent = {});
+
+    /**
+     * Splits the list into chunks of chunk_size transactions and submits
+     * them as concurrent calls pipelined on the shared channel
+     * @param on_sent - invoked per chunk with its transaction count
+     */
+    void ListTorii(const iroha::protocol::TxList &tx_list,
+                   std::function<void(grpc::Status, size_t)> on_sent = {},
+                   size_t chunk_size = kDefaultListChunkSize);
+
+    /**
+     * Asynchronously requests the status of a transaction; the response
+     * carries the transaction hash, which correlates it to the request
+     * when many polls are in flight
+     */
+    void Status(const iroha::protocol::TxStatusRequest &request,
+                std::function<void(grpc::Status,
+                                   const iroha::protocol::ToriiResponse &)>
+                    on_status);
+
+    /// @return the chunks ListTorii would pipeline for the given list
+    static std::vector<iroha::protocol::TxList> splitList(
+        const iroha::protocol::TxList &tx_list, size_t chunk_size);
+
+   private:
+    std::shared_ptr<Service::StubInterface> stub_;
+    iroha::network::AsyncGrpcClient<google::protobuf::Empty> submissions_;
+    iroha::network::AsyncGrpcClient<iroha::protocol::ToriiResponse> statuses_;
+  };
+
+}  // namespace torii
+
+#endif  // TORII_COMMAND_ASYNC_CLIENT_HPP
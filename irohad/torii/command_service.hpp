@@ -20,6 +20,12 @@ namespace shared_model {
   }  // namespace crypto
 }  // namespace shared_model
 
+namespace iroha {
+  namespace protocol {
+    class ToriiResponse;
+  }
+}  // namespace iroha
+
 namespace iroha {
   namespace torii {
 
@@ -44,6 +50,22 @@ namespace iroha {
       virtual std::shared_ptr<shared_model::interface::TransactionResponse>
       getStatus(const shared_model::crypto::Hash &request) = 0;
 
+      /**
+       * Fast path of getStatus: fill the transport response for the
+       * transaction with the given hash in place, without constructing
+       * any shared_model wrapper objects on the way. Status polls
+       * outnumber submissions by an order of magnitude, so they deserve
+       * to skip the wrapper construction of getStatus.
+       * @param request - hash which identifies transaction uniquely
+       * @param response - transport response to fill
+       * @return true when the response was filled; false sends the
+       * caller to getStatus. The default implementation always refuses
+       */
+      virtual bool fillStatusTransport(const shared_model::crypto::Hash &,
+                                       iroha::protocol::ToriiResponse &) {
+        return false;
+      }
+
       /**
        * Streaming call which will repeatedly send all statuses of requested
        * transaction from its status at the moment of receiving this request to
@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/command_async_client.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "transaction.pb.h"
+
+namespace torii {
+
+  CommandAsyncClient::CommandAsyncClient(
+      std::shared_ptr<Service::StubInterface> stub,
+      logger::LoggerPtr log,
+      std::size_t completion_queue_count)
+      : stub_(std::move(stub)),
+        submissions_(log, completion_queue_count),
+        statuses_(log, completion_queue_count) {}
+
+  void CommandAsyncClient::Torii(const iroha::protocol::Transaction &tx,
+                                 std::function<void(grpc::Status)> on_sent) {
+    submissions_.Call(
+        [&](auto *context, auto *cq) {
+          return stub_->AsyncTorii(context, tx, cq);
+        },
+        [on_sent = std::move(on_sent)](grpc::Status &status, auto &) {
+          if (on_sent) {
+            on_sent(status);
+          }
+        });
+  }
+
+  void CommandAsyncClient::ListTorii(
+      const iroha::protocol::TxList &tx_list,
+      std::function<void(grpc::Status, size_t)> on_sent,
+      size_t chunk_size) {
+    for (auto &chunk : splitList(tx_list, chunk_size)) {
+      const auto chunk_transactions =
+          static_cast<size_t>(chunk.transactions_size());
+      submissions_.Call(
+          [&](auto *context, auto *cq) {
+            return stub_->AsyncListTorii(context, chunk, cq);
+          },
+          [on_sent, chunk_transactions](grpc::Status &status, auto &) {
+            if (on_sent) {
+              on_sent(status, chunk_transactions);
+            }
+          });
+    }
+  }
+
+  void CommandAsyncClient::Status(
+      const iroha::protocol::TxStatusRequest &request,
+      std::function<void(grpc::Status, const iroha::protocol::ToriiResponse &)>
+          on_status) {
+    statuses_.Call(
+        [&](auto *context, auto *cq) {
+          return stub_->AsyncStatus(context, request, cq);
+        },
+        [on_status = std::move(on_status)](
+            grpc::Status &status, iroha::protocol::ToriiResponse &response) {
+          if (on_status) {
+            on_status(status, response);
+          }
+        });
+  }
+
+  std::vector<iroha::protocol::TxList> CommandAsyncClient::splitList(
+      const iroha::protocol::TxList &tx_list, size_t chunk_size) {
+    chunk_size = std::max<size_t>(1, chunk_size);
+    const auto size = static_cast<size_t>(tx_list.transactions_size());
+
+    std::vector<iroha::protocol::TxList> chunks;
+    chunks.reserve((size + chunk_size - 1) / chunk_size);
+    for (size_t begin = 0; begin < size; begin += chunk_size) {
+      const auto end = std::min(begin + chunk_size, size);
+      iroha::protocol::TxList chunk;
+      for (size_t i = begin; i < end; ++i) {
+        *chunk.add_transactions() =
+            tx_list.transactions(static_cast<int>(i));
+      }
+      chunks.push_back(std::move(chunk));
+    }
+    return chunks;
+  }
+
+}  // namespace torii
@@ -0,0 +1,345 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/command_service_async_transport_grpc.hpp"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+#include <boost/format.hpp>
+#include <boost/optional.hpp>
+#include <rxcpp/operators/rx-start_with.hpp>
+#include <rxcpp/operators/rx-take_while.hpp>
+#include "backend/protobuf/transaction_responses/proto_tx_response.hpp"
+#include "common/combine_latest_until_first_completed.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /// method index of StatusStream within CommandService_v1, in the
+  /// declaration order of endpoint.proto
+  constexpr int kStatusStreamMethodIndex = 4;
+}  // namespace
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * One open StatusStream call. The object lives on the completion
+     * queue: every asynchronous operation it starts carries a tag
+     * holding a shared_ptr back to it, so the call stays alive exactly
+     * until its last outstanding operation has been delivered. Status
+     * updates arrive on an event loop worker and are queued under the
+     * mutex; at most one Write is in flight at any time, the next one
+     * is started when a queue poller reports the previous completed
+     */
+    class CommandServiceAsyncTransportGrpc::StreamCall final
+        : public std::enable_shared_from_this<StreamCall> {
+     public:
+      StreamCall(CommandServiceAsyncTransportGrpc &transport,
+                 grpc::ServerCompletionQueue &cq)
+          : transport_(transport), cq_(cq), writer_(&context_) {}
+
+      /// makes a call object waiting for the next incoming call
+      static void spawn(CommandServiceAsyncTransportGrpc &transport,
+                        grpc::ServerCompletionQueue &cq) {
+        auto call = std::make_shared<StreamCall>(transport, cq);
+        // must precede the call request, fires once the call ends for
+        // whatever reason
+        call->context_.AsyncNotifyWhenDone(call->makeTag(&StreamCall::onDone));
+        transport.requestStatusStreamCall(
+            &call->context_,
+            &call->request_,
+            &call->writer_,
+            &cq,
+            call->makeTag(&StreamCall::onRequested));
+      }
+
+     private:
+      using Handler = void (StreamCall::*)(bool);
+
+      /// queue tag keeping the call alive until it is delivered
+      struct Tag final : network::AsyncCqTag {
+        std::shared_ptr<StreamCall> call;
+        Handler handler;
+
+        Tag(std::shared_ptr<StreamCall> call, Handler handler)
+            : call(std::move(call)), handler(handler) {}
+
+        void proceed(bool ok) override {
+          auto kept_alive = std::move(call);
+          auto method = handler;
+          delete this;
+          ((*kept_alive).*method)(ok);
+        }
+      };
+
+      network::AsyncCqTag *makeTag(Handler handler) {
+        return new Tag(shared_from_this(), handler);
+      }
+
+      /// an incoming call has been matched to this object
+      void onRequested(bool ok) {
+        if (not ok) {
+          // the server is shutting down, no call was matched
+          return;
+        }
+        // wait for the next client with a fresh call object
+        spawn(transport_, cq_);
+
+        auto hash =
+            shared_model::crypto::Hash::fromHexString(request_.tx_hash());
+        auto client_id_format = boost::format("Peer: '%s', %s");
+        client_id_ =
+            (client_id_format % context_.peer() % hash.toString()).str();
+        started_.store(true);
+
+        auto status_bus = transport_.command_service_->getStatusStream(hash);
+        auto consensus_gate_observable =
+            transport_.consensus_gate_objects_
+                // a dummy start_with lets us don't wait for the consensus
+                // event on further combine_latest
+                .start_with(CommandServiceTransportGrpc::ConsensusGateEvent{});
+
+        auto self = shared_from_this();
+        // a shared event loop worker replaces the per-stream handler
+        // thread of the synchronous service: the events of one stream
+        // are serialized on it, the writes complete on the queue
+        // pollers
+        makeCombineLatestUntilFirstCompleted(
+            status_bus,
+            rxcpp::observe_on_event_loop(),
+            [](auto status, auto) { return status; },
+            consensus_gate_observable)
+            // complete the observable if client is disconnected or too
+            // many rounds have passed without tx status change
+            .take_while([self](const auto &response) {
+              return self->onStatus(response);
+            })
+            .subscribe(subscription_,
+                       [](const auto &) {},
+                       [self](std::exception_ptr ep) {
+                         self->transport_.log_->error(
+                             "something bad happened, client_id {}",
+                             self->client_id_);
+                         self->complete();
+                       },
+                       [self] {
+                         self->transport_.log_->debug("stream done, {}",
+                                                      self->client_id_);
+                         self->complete();
+                       });
+      }
+
+      /// decides on one status update; mirrors the predicate of the
+      /// synchronous StatusStream. Runs serialized on the event loop
+      /// worker of the subscription, so the round counting state needs
+      /// no locking
+      bool onStatus(
+          const std::shared_ptr<shared_model::interface::TransactionResponse>
+              &response) {
+        const auto &proto_response =
+            std::static_pointer_cast<shared_model::proto::TransactionResponse>(
+                response)
+                ->getTransport();
+
+        if (cancelled_.load()) {
+          transport_.log_->debug("client unsubscribed, {}", client_id_);
+          return false;
+        }
+
+        // increment round counter when the same status arrived again.
+        auto status = proto_response.tx_status();
+        auto status_is_same =
+            last_tx_status_ and (status == *last_tx_status_);
+        if (status_is_same) {
+          ++rounds_counter_;
+          if (rounds_counter_ >= transport_.maximum_rounds_without_update_) {
+            // we stop the stream when round counter is greater than
+            // allowed.
+            return false;
+          }
+          // omit the received status, but do not stop the stream
+          return true;
+        }
+        rounds_counter_ = 0;
+        last_tx_status_ = status;
+
+        enqueueWrite(proto_response);
+        return true;
+      }
+
+      /// queue a new status for the client
+      void enqueueWrite(const iroha::protocol::ToriiResponse &response) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (broken_ or finish_started_) {
+          return;
+        }
+        if (write_in_flight_) {
+          pending_.push_back(response);
+          return;
+        }
+        write_in_flight_ = true;
+        writer_.Write(response, makeTag(&StreamCall::onWritten));
+      }
+
+      /// a Write has been delivered (or has failed) on the queue
+      void onWritten(bool ok) {
+        bool drop_subscription = false;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          write_in_flight_ = false;
+          if (not ok) {
+            transport_.log_->error("write to stream has failed to client {}",
+                                   client_id_);
+            pending_.clear();
+            broken_ = true;
+            drop_subscription = true;
+          } else if (not pending_.empty()) {
+            write_in_flight_ = true;
+            writer_.Write(pending_.front(), makeTag(&StreamCall::onWritten));
+            pending_.pop_front();
+          } else {
+            maybeFinishLocked();
+          }
+        }
+        if (drop_subscription) {
+          subscription_.unsubscribe();
+        }
+      }
+
+      /// no more statuses will arrive, finish once the queued writes
+      /// have been delivered
+      void complete() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        done_ = true;
+        maybeFinishLocked();
+      }
+
+      /// requires mutex_ to be held
+      void maybeFinishLocked() {
+        if (done_ and not broken_ and not finish_started_
+            and not write_in_flight_ and pending_.empty()) {
+          finish_started_ = true;
+          writer_.Finish(grpc::Status::OK, makeTag(&StreamCall::onFinished));
+        }
+      }
+
+      /// the call has ended: the client disconnected, the final status
+      /// was delivered or the server is shutting down
+      void onDone(bool) {
+        cancelled_.store(true);
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          broken_ = true;
+          pending_.clear();
+        }
+        subscription_.unsubscribe();
+        if (started_.load()) {
+          transport_.log_->debug("status stream done, {}", client_id_);
+        }
+      }
+
+      /// the final status has been delivered, nothing left to do
+      void onFinished(bool) {}
+
+      CommandServiceAsyncTransportGrpc &transport_;
+      grpc::ServerCompletionQueue &cq_;
+      grpc::ServerContext context_;
+      iroha::protocol::TxStatusRequest request_;
+      grpc::ServerAsyncWriter<iroha::protocol::ToriiResponse> writer_;
+      std::string client_id_;
+      std::atomic<bool> started_{false};
+      std::atomic<bool> cancelled_{false};
+
+      /// round counting state of onStatus, touched only on the event
+      /// loop worker
+      boost::optional<iroha::protocol::TxStatus> last_tx_status_;
+      int rounds_counter_{0};
+
+      rxcpp::composite_subscription subscription_;
+
+      std::mutex mutex_;
+      std::deque<iroha::protocol::ToriiResponse> pending_;
+      bool write_in_flight_{false};
+      bool done_{false};
+      bool finish_started_{false};
+      bool broken_{false};
+    };
+
+    CommandServiceAsyncTransportGrpc::CommandServiceAsyncTransportGrpc(
+        std::shared_ptr<CommandServiceTransportGrpc> sync_transport,
+        std::shared_ptr<CommandService> command_service,
+        rxcpp::observable<CommandServiceTransportGrpc::ConsensusGateEvent>
+            consensus_gate_objects,
+        int maximum_rounds_without_update,
+        logger::LoggerPtr log)
+        : sync_transport_(std::move(sync_transport)),
+          command_service_(std::move(command_service)),
+          consensus_gate_objects_(std::move(consensus_gate_objects)),
+          maximum_rounds_without_update_(maximum_rounds_without_update),
+          log_(std::move(log)) {
+      // the server matches StatusStream calls to the completion queue
+      // instead of the synchronous handler
+      MarkMethodAsync(kStatusStreamMethodIndex);
+    }
+
+    grpc::Status CommandServiceAsyncTransportGrpc::Torii(
+        grpc::ServerContext *context,
+        const iroha::protocol::Transaction *request,
+        google::protobuf::Empty *response) {
+      return sync_transport_->Torii(context, request, response);
+    }
+
+    grpc::Status CommandServiceAsyncTransportGrpc::ListTorii(
+        grpc::ServerContext *context,
+        const iroha::protocol::TxList *request,
+        google::protobuf::Empty *response) {
+      return sync_transport_->ListTorii(context, request, response);
+    }
+
+    grpc::Status CommandServiceAsyncTransportGrpc::ListToriiStream(
+        grpc::ServerContext *context,
+        const iroha::protocol::TxList *request,
+        grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer) {
+      return sync_transport_->ListToriiStream(
+          context, request, response_writer);
+    }
+
+    grpc::Status CommandServiceAsyncTransportGrpc::Status(
+        grpc::ServerContext *context,
+        const iroha::protocol::TxStatusRequest *request,
+        iroha::protocol::ToriiResponse *response) {
+      return sync_transport_->Status(context, request, response);
+    }
+
+    grpc::Status CommandServiceAsyncTransportGrpc::StatusStream(
+        grpc::ServerContext *,
+        const iroha::protocol::TxStatusRequest *,
+        grpc::ServerWriter<iroha::protocol::ToriiResponse> *) {
+      return grpc::Status(grpc::StatusCode::INTERNAL,
+                          "StatusStream is served asynchronously");
+    }
+
+    grpc::Service &CommandServiceAsyncTransportGrpc::service() {
+      return *this;
+    }
+
+    void CommandServiceAsyncTransportGrpc::start(
+        grpc::ServerCompletionQueue &cq) {
+      StreamCall::spawn(*this, cq);
+    }
+
+    void CommandServiceAsyncTransportGrpc::requestStatusStreamCall(
+        grpc::ServerContext *context,
+        iroha::protocol::TxStatusRequest *request,
+        grpc::ServerAsyncWriter<iroha::protocol::ToriiResponse> *writer,
+        grpc::ServerCompletionQueue *cq,
+        void *tag) {
+      RequestAsyncServerStreaming(
+          kStatusStreamMethodIndex, context, request, writer, cq, cq, tag);
+    }
+  }  // namespace torii
+}  // namespace iroha
@@ -0,0 +1,107 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_COMMAND_SERVICE_ASYNC_TRANSPORT_GRPC_HPP
+#define TORII_COMMAND_SERVICE_ASYNC_TRANSPORT_GRPC_HPP
+
+#include "torii/impl/command_service_transport_grpc.hpp"
+
+#include "network/async_cq_service.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * CommandService_v1 transport with an asynchronous StatusStream.
+     * The synchronous service parks one handler thread per open
+     * stream, which on gateway-facing nodes with thousands of watching
+     * clients is the dominant memory and context-switch cost. This
+     * transport keeps the short unary methods synchronous and serves
+     * StatusStream over the server completion queue of ServerRunner,
+     * so all open streams multiplex over its small poller thread set.
+     * gRPC allows a service with asynchronous methods to be registered
+     * with a single server only, so every server needs an instance of
+     * its own; the per-call logic is delegated to one shared
+     * synchronous transport
+     */
+    class CommandServiceAsyncTransportGrpc final
+        : public iroha::protocol::CommandService_v1::Service,
+          public iroha::network::AsyncCqService {
+     public:
+      /**
+       * @param sync_transport - the shared transport the delegated
+       * calls are forwarded to
+       * @param command_service - source of the status streams
+       * @param consensus_gate_objects - events from consensus gate,
+       * they pace the staleness rounds of a stream
+       * @param maximum_rounds_without_update - defines how long a
+       * status stream is kept alive when no new tx statuses appear
+       * @param log to print progress
+       */
+      CommandServiceAsyncTransportGrpc(
+          std::shared_ptr<CommandServiceTransportGrpc> sync_transport,
+          std::shared_ptr<CommandService> command_service,
+          rxcpp::observable<CommandServiceTransportGrpc::ConsensusGateEvent>
+              consensus_gate_objects,
+          int maximum_rounds_without_update,
+          logger::LoggerPtr log);
+
+      /// forwarded to the shared synchronous transport
+      grpc::Status Torii(grpc::ServerContext *context,
+                         const iroha::protocol::Transaction *request,
+                         google::protobuf::Empty *response) override;
+
+      /// forwarded to the shared synchronous transport
+      grpc::Status ListTorii(grpc::ServerContext *context,
+                             const iroha::protocol::TxList *request,
+                             google::protobuf::Empty *response) override;
+
+      /// forwarded to the shared synchronous transport
+      grpc::Status ListToriiStream(
+          grpc::ServerContext *context,
+          const iroha::protocol::TxList *request,
+          grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer)
+          override;
+
+      /// forwarded to the shared synchronous transport
+      grpc::Status Status(grpc::ServerContext *context,
+                          const iroha::protocol::TxStatusRequest *request,
+                          iroha::protocol::ToriiResponse *response) override;
+
+      /// not reachable: the method is marked asynchronous and served
+      /// through the completion queue
+      grpc::Status StatusStream(
+          grpc::ServerContext *context,
+          const iroha::protocol::TxStatusRequest *request,
+          grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer)
+          override;
+
+      // AsyncCqService
+      grpc::Service &service() override;
+      void start(grpc::ServerCompletionQueue &cq) override;
+
+     private:
+      class StreamCall;
+
+      /// forwards to the protected asynchronous request API of
+      /// grpc::Service on behalf of the call objects
+      void requestStatusStreamCall(
+          grpc::ServerContext *context,
+          iroha::protocol::TxStatusRequest *request,
+          grpc::ServerAsyncWriter<iroha::protocol::ToriiResponse> *writer,
+          grpc::ServerCompletionQueue *cq,
+          void *tag);
+
+      std::shared_ptr<CommandServiceTransportGrpc> sync_transport_;
+      std::shared_ptr<CommandService> command_service_;
+      rxcpp::observable<CommandServiceTransportGrpc::ConsensusGateEvent>
+          consensus_gate_objects_;
+      const int maximum_rounds_without_update_;
+      logger::LoggerPtr log_;
+    };
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_COMMAND_SERVICE_ASYNC_TRANSPORT_GRPC_HPP
@@ -5,20 +5,100 @@
 
 #include "torii/impl/command_service_impl.hpp"
 
+#include <limits>
+
 #include <rxcpp/operators/rx-filter.hpp>
 #include <rxcpp/operators/rx-start_with.hpp>
 #include "ametsuchi/block_query.hpp"
+#include "backend/protobuf/transaction_responses/proto_tx_response.hpp"
 #include "common/byteutils.hpp"
 #include "common/is_any.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
+#include "metrics/tx_latency_tracer.hpp"
 #include "interfaces/transaction_responses/not_received_tx_response.hpp"
 #include "logger/logger.hpp"
+#include "torii/impl/status_cache_snapshot.hpp"
 
 namespace iroha {
   namespace torii {
 
+    namespace {
+      /// priority of a status for the keep-the-latest rule of the cache;
+      /// mirrors shared_model::proto::TransactionResponse::priority()
+      int statusPriority(iroha::protocol::TxStatus status) {
+        switch (status) {
+          // not received can be changed to any response
+          case iroha::protocol::TxStatus::NOT_RECEIVED:
+            return 0;
+          // following statuses are sequential in pipeline
+          case iroha::protocol::TxStatus::STATELESS_VALIDATION_SUCCESS:
+            return 1;
+          case iroha::protocol::TxStatus::MST_PENDING:
+            return 2;
+          case iroha::protocol::TxStatus::ENOUGH_SIGNATURES_COLLECTED:
+            return 3;
+          case iroha::protocol::TxStatus::STATEFUL_VALIDATION_SUCCESS:
+            return 4;
+          // following statuses are local on this peer and can be
+          // substituted by final ones, if consensus decides so
+          case iroha::protocol::TxStatus::STATELESS_VALIDATION_FAILED:
+          case iroha::protocol::TxStatus::STATEFUL_VALIDATION_FAILED:
+          case iroha::protocol::TxStatus::MST_EXPIRED:
+            return 5;
+          // following statuses are the final ones
+          case iroha::protocol::TxStatus::COMMITTED:
+          case iroha::protocol::TxStatus::REJECTED:
+            return std::numeric_limits<int>::max();
+          default:
+            return 0;
+        }
+      }
+
+      /// record counterpart of FinalStatusValue below
+      bool isFinalStatus(iroha::protocol::TxStatus status) {
+        return status == iroha::protocol::TxStatus::STATELESS_VALIDATION_FAILED
+            or status == iroha::protocol::TxStatus::COMMITTED
+            or status == iroha::protocol::TxStatus::REJECTED;
+      }
+    }  // namespace
+
+    CommandServiceImpl::TxStatusRecord CommandServiceImpl::makeRecord(
+        const shared_model::interface::TransactionResponse &response) {
+      // the status pipeline only ever produces proto-backed responses
+      return fromTransport(
+          static_cast<const shared_model::proto::TransactionResponse &>(
+              response)
+              .getTransport());
+    }
+
+    std::shared_ptr<shared_model::interface::TransactionResponse>
+    CommandServiceImpl::makeResponse(const TxStatusRecord &record) {
+      return std::make_shared<shared_model::proto::TransactionResponse>(
+          toTransport(record));
+    }
+
+    iroha::protocol::ToriiResponse CommandServiceImpl::toTransport(
+        const TxStatusRecord &record) {
+      iroha::protocol::ToriiResponse transport;
+      transport.set_tx_status(record.tx_status);
+      transport.set_tx_hash(record.tx_hash_hex);
+      transport.set_err_or_cmd_name(record.err_or_cmd_name);
+      transport.set_failed_cmd_index(record.failed_cmd_index);
+      transport.set_error_code(record.error_code);
+      return transport;
+    }
+
+    CommandServiceImpl::TxStatusRecord CommandServiceImpl::fromTransport(
+        const iroha::protocol::ToriiResponse &transport) {
+      return TxStatusRecord{transport.tx_status(),
+                            transport.tx_hash(),
+                            transport.err_or_cmd_name(),
+                            transport.failed_cmd_index(),
+                            transport.error_code()};
+    }
+
     CommandServiceImpl::CommandServiceImpl(
         std::shared_ptr<iroha::torii::TransactionProcessor> tx_processor,
         std::shared_ptr<iroha::ametsuchi::Storage> storage,
@@ -27,6 +107,7 @@ namespace iroha {
             status_factory,
         std::shared_ptr<iroha::torii::CommandServiceImpl::CacheType> cache,
         std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_presence_cache,
+        boost::optional<std::string> status_cache_snapshot_path,
         logger::LoggerPtr log)
         : tx_processor_(std::move(tx_processor)),
           storage_(std::move(storage)),
@@ -34,40 +115,108 @@ namespace iroha {
           cache_(std::move(cache)),
           status_factory_(std::move(status_factory)),
           tx_presence_cache_(std::move(tx_presence_cache)),
+          status_cache_snapshot_path_(std::move(status_cache_snapshot_path)),
+          recent_final_(std::make_shared<RecentFinalIndex>()),
           log_(std::move(log)) {
+      if (status_cache_snapshot_path_) {
+        loadStatusCacheSnapshot(*cache_, *status_cache_snapshot_path_, log_);
+      }
+      recent_final_->buckets.emplace_front();
       // Notifier for all clients
       status_subscription_ = status_bus_->statuses().subscribe(
           // TODO mboldyrev IR-426 research approaches to the problem of member
           // observer lifetime.
-          [cache = cache_](auto response) {
-            // find response for this tx in cache; if status of received
+          [cache = cache_, recent_final = recent_final_](auto response) {
+            // remember the hashes of finalized transactions, so a status
+            // poll right after finalization does not have to hit the
+            // database even when the response cache has evicted the entry
+            iroha::visit_in_place(
+                response->get(),
+                [&](const shared_model::interface::CommittedTxResponse &) {
+                  std::lock_guard<std::mutex> lock(recent_final->mutex);
+                  recent_final->hashes[response->transactionHash()] = true;
+                  recent_final->buckets.front().push_back(
+                      response->transactionHash());
+                },
+                [&](const shared_model::interface::RejectedTxResponse &) {
+                  std::lock_guard<std::mutex> lock(recent_final->mutex);
+                  recent_final->hashes[response->transactionHash()] = false;
+                  recent_final->buckets.front().push_back(
+                      response->transactionHash());
+                },
+                [](const auto &) {});
+            // find record for this tx in cache; if status of received
             // response isn't "greater" than cached one, dismiss received one
             auto tx_hash = response->transactionHash();
+            auto record = makeRecord(*response);
             auto cached_tx_state = cache->findItem(tx_hash);
             if (cached_tx_state
-                and response->comparePriorities(**cached_tx_state)
-                    != shared_model::interface::TransactionResponse::
-                           PrioritiesComparisonResult::kGreater) {
+                and statusPriority(record.tx_status)
+                    <= statusPriority(cached_tx_state->tx_status)) {
               return;
             }
-            cache->addItem(tx_hash, response);
+            cache->addItem(tx_hash, std::move(record));
+          });
+      commit_subscription_ = storage_->on_commit().subscribe(
+          [recent_final = recent_final_](const auto &) {
+            // a block boundary: open a fresh bucket and forget the hashes
+            // finalized more than kRecentFinalBlocksWindow blocks ago
+            std::lock_guard<std::mutex> lock(recent_final->mutex);
+            recent_final->buckets.emplace_front();
+            while (recent_final->buckets.size() > kRecentFinalBlocksWindow) {
+              for (const auto &hash : recent_final->buckets.back()) {
+                recent_final->hashes.erase(hash);
+              }
+              recent_final->buckets.pop_back();
+            }
           });
     }
 
     CommandServiceImpl::~CommandServiceImpl() {
       status_subscription_.unsubscribe();
+      commit_subscription_.unsubscribe();
+      if (status_cache_snapshot_path_) {
+        saveStatusCacheSnapshot(*cache_, *status_cache_snapshot_path_, log_);
+      }
     }
 
     void CommandServiceImpl::handleTransactionBatch(
         std::shared_ptr<shared_model::interface::TransactionBatch> batch) {
+      for (const auto &tx : batch->transactions()) {
+        iroha::metrics::TxLatencyTracer::instance().recordStage(
+            tx->hash().hex(), iroha::metrics::TxStage::kToriiReceived);
+      }
       processBatch(batch);
     }
 
+    bool CommandServiceImpl::fillStatusTransport(
+        const shared_model::crypto::Hash &request,
+        iroha::protocol::ToriiResponse &response) {
+      auto cached = cache_->findItem(request);
+      if (not cached) {
+        return false;
+      }
+      response = toTransport(*cached);
+      return true;
+    }
+
     std::shared_ptr<shared_model::interface::TransactionResponse>
     CommandServiceImpl::getStatus(const shared_model::crypto::Hash &request) {
       auto cached = cache_->findItem(request);
       if (cached) {
-        return cached.value();
+        return makeResponse(*cached);
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(recent_final_->mutex);
+        auto recent = recent_final_->hashes.find(request);
+        if (recent != recent_final_->hashes.end()) {
+          std::shared_ptr<shared_model::interface::TransactionResponse>
+              response = recent->second ? status_factory_->makeCommitted(request)
+                                        : status_factory_->makeRejected(request);
+          cache_->addItem(request, makeRecord(*response));
+          return response;
+        }
       }
 
       auto block_query = storage_->getBlockQuery();
@@ -98,7 +247,7 @@ namespace iroha {
                       &) {
                 std::shared_ptr<shared_model::interface::TransactionResponse>
                     response = status_factory_->makeRejected(request);
-                cache_->addItem(request, response);
+                cache_->addItem(request, makeRecord(*response));
                 return response;
               },
               [this, &request](
@@ -106,7 +255,7 @@ namespace iroha {
                       &) {
                 std::shared_ptr<shared_model::interface::TransactionResponse>
                     response = status_factory_->makeCommitted(request);
-                cache_->addItem(request, response);
+                cache_->addItem(request, makeRecord(*response));
                 return response;
               }),
           *status);
@@ -143,9 +292,18 @@ namespace iroha {
         const shared_model::crypto::Hash &hash) {
       using ResponsePtrType =
           std::shared_ptr<shared_model::interface::TransactionResponse>;
-      auto initial_status = cache_->findItem(hash).value_or([&] {
+      auto cached = cache_->findItem(hash);
+      auto initial_status = cached ? makeResponse(*cached) : [&] {
         // if cache_ doesn't contain some status there is required to check
-        // persistent cache
+        // the recently finalized hashes and then the persistent cache
+        {
+          std::lock_guard<std::mutex> lock(recent_final_->mutex);
+          auto recent = recent_final_->hashes.find(hash);
+          if (recent != recent_final_->hashes.end()) {
+            return recent->second ? status_factory_->makeCommitted(hash)
+                                  : status_factory_->makeRejected(hash);
+          }
+        }
 
         log_->debug("tx {} isn't present in cache", hash);
         auto from_persistent_cache = tx_presence_cache_->check(hash);
@@ -166,15 +324,13 @@ namespace iroha {
                     const iroha::ametsuchi::tx_cache_status_responses::Missing
                         &) { return status_factory_->makeNotReceived(hash); }),
             *from_persistent_cache);
-      }());
+      }();
       return status_bus_
-          ->statuses()
+          // the bus routes by hash, so only the statuses of the requested
+          // transaction reach this stream
+          ->statuses(hash)
           // prepend initial status
           .start_with(initial_status)
-          // select statuses with requested hash
-          .filter([hash](auto response) {
-            return response->transactionHash() == hash;
-          })
           // successfully complete the observable if final status is received.
           // final status is included in the observable
           .template lift<ResponsePtrType>(
@@ -214,17 +370,10 @@ namespace iroha {
       for (auto tx : txs) {
         const auto &tx_hash = tx->hash();
         if (auto found = cache_->findItem(tx_hash)) {
-          log_->debug("Found in cache: {}", **found);
-          has_final_status = iroha::visit_in_place(
-              (*found)->get(),
-              [](const auto &final_responses)
-                  -> std::enable_if_t<
-                      FinalStatusValue<decltype(final_responses)>,
-                      bool> { return true; },
-              [](const auto &rest_responses)
-                  -> std::enable_if_t<
-                      not FinalStatusValue<decltype(rest_responses)>,
-                      bool> { return false; });
+          log_->debug("Found in cache: tx {} with status {}",
+                      found->tx_hash_hex,
+                      iroha::protocol::TxStatus_Name(found->tx_status));
+          has_final_status = isFinalStatus(found->tx_status);
         }
 
         if (has_final_status) {
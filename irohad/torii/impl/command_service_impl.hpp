@@ -8,11 +8,19 @@
 
 #include "torii/command_service.hpp"
 
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/storage.hpp"
 #include "ametsuchi/tx_presence_cache.hpp"
-#include "cache/cache.hpp"
+#include "cache/sharded_cache.hpp"
 #include "cryptography/hash.hpp"
+#include "endpoint.pb.h"
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "logger/logger_fwd.hpp"
 #include "torii/processor/transaction_processor.hpp"
@@ -25,11 +33,48 @@ namespace iroha {
      */
     class CommandServiceImpl : public CommandService {
      public:
+      /**
+       * Compact per-transaction record kept in the status cache instead of
+       * a full response object. A response object carries the transport
+       * message plus the materialized response variant and a parsed hash,
+       * which for every in-window transaction adds up to hundreds of
+       * megabytes; only the transport fields are worth remembering, and a
+       * response object is rebuilt from them on demand when a status is
+       * actually served.
+       */
+      struct TxStatusRecord {
+        iroha::protocol::TxStatus tx_status;
+        /// hex hash of the transaction, same value as the cache key; kept
+        /// here because the cache does not give the keys back
+        std::string tx_hash_hex;
+        std::string err_or_cmd_name;
+        uint64_t failed_cmd_index;
+        uint32_t error_code;
+      };
+
       // TODO: 2019-03-13 @muratovv fix with abstract cache type IR-397
-      using CacheType = iroha::cache::Cache<
-          shared_model::crypto::Hash,
-          std::shared_ptr<shared_model::interface::TransactionResponse>,
-          shared_model::crypto::Hash::Hasher>;
+      // sharded cache: the status cache is hit concurrently by every
+      // status poll and every status bus publication
+      using CacheType =
+          iroha::cache::ShardedCache<shared_model::crypto::Hash,
+                                     TxStatusRecord,
+                                     shared_model::crypto::Hash::Hasher>;
+
+      /// Extract a compact cache record from a response object
+      static TxStatusRecord makeRecord(
+          const shared_model::interface::TransactionResponse &response);
+
+      /// Rebuild a full response object from a compact cache record
+      static std::shared_ptr<shared_model::interface::TransactionResponse>
+      makeResponse(const TxStatusRecord &record);
+
+      /// Transport form of a record, used by the status cache snapshot
+      static iroha::protocol::ToriiResponse toTransport(
+          const TxStatusRecord &record);
+
+      /// Inverse of toTransport
+      static TxStatusRecord fromTransport(
+          const iroha::protocol::ToriiResponse &transport);
 
       /**
        * Creates a new instance of CommandService
@@ -39,6 +84,9 @@ namespace iroha {
        * @param cache - non-persistent cache, an instance of type
        * CommandServiceImpl::CacheType
        * @param tx_presence_cache a cache over persistent storage
+       * @param status_cache_snapshot_path when set, the cache is loaded
+       * from a snapshot file at this path on construction and dumped back
+       * on destruction, so the statuses survive a restart
        * @param log to print progress
        */
       CommandServiceImpl(
@@ -49,6 +97,7 @@ namespace iroha {
               status_factory,
           std::shared_ptr<iroha::torii::CommandServiceImpl::CacheType> cache,
           std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_presence_cache,
+          boost::optional<std::string> status_cache_snapshot_path,
           logger::LoggerPtr log);
 
       ~CommandServiceImpl() override;
@@ -66,6 +115,9 @@ namespace iroha {
 
       std::shared_ptr<shared_model::interface::TransactionResponse> getStatus(
           const shared_model::crypto::Hash &request) override;
+      bool fillStatusTransport(const shared_model::crypto::Hash &request,
+                               iroha::protocol::ToriiResponse &response)
+          override;
       rxcpp::observable<
           std::shared_ptr<shared_model::interface::TransactionResponse>>
       getStatusStream(const shared_model::crypto::Hash &hash) override;
@@ -98,14 +150,41 @@ namespace iroha {
       void processBatch(
           std::shared_ptr<shared_model::interface::TransactionBatch> batch);
 
+      /**
+       * Hashes of transactions finalized (committed or rejected) within the
+       * last kRecentFinalBlocksWindow blocks. Populated from the status bus
+       * as the statuses are published, so an aggressive poll right after
+       * submission is answered from memory without the per-request trip to
+       * the persistent tx cache or the database. Shared with the bus and
+       * commit subscriptions, which may outlive this object for a moment
+       * (see IR-426).
+       */
+      struct RecentFinalIndex {
+        std::mutex mutex;
+        /// hash of a finalized transaction -> true when committed,
+        /// false when rejected
+        std::unordered_map<shared_model::crypto::Hash,
+                           bool,
+                           shared_model::crypto::Hash::Hasher>
+            hashes;
+        /// per-block insertion buckets, front is the current block;
+        /// the oldest bucket is evicted from "hashes" on every commit
+        std::deque<std::vector<shared_model::crypto::Hash>> buckets;
+      };
+
+      static constexpr size_t kRecentFinalBlocksWindow = 32;
+
       std::shared_ptr<iroha::torii::TransactionProcessor> tx_processor_;
       std::shared_ptr<iroha::ametsuchi::Storage> storage_;
       std::shared_ptr<iroha::torii::StatusBus> status_bus_;
       std::shared_ptr<CacheType> cache_;
       std::shared_ptr<shared_model::interface::TxStatusFactory> status_factory_;
       std::shared_ptr<iroha::ametsuchi::TxPresenceCache> tx_presence_cache_;
+      boost::optional<std::string> status_cache_snapshot_path_;
+      std::shared_ptr<RecentFinalIndex> recent_final_;
 
       rxcpp::composite_subscription status_subscription_;
+      rxcpp::composite_subscription commit_subscription_;
 
       logger::LoggerPtr log_;
     };
@@ -7,21 +7,30 @@
 
 #include "torii/impl/command_service_transport_grpc.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <iterator>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/format.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include <rxcpp/operators/rx-flat_map.hpp>
 #include <rxcpp/operators/rx-start_with.hpp>
 #include <rxcpp/operators/rx-take_while.hpp>
 #include "backend/protobuf/deserialize_repeated_transactions.hpp"
 #include "backend/protobuf/transaction_responses/proto_tx_response.hpp"
 #include "backend/protobuf/util.hpp"
 #include "common/combine_latest_until_first_completed.hpp"
+#include "common/memory_budget.hpp"
 #include "common/run_loop_handler.hpp"
+#include "common/thread_affinity.hpp"
+#include "cryptography/blob.hpp"
 #include "cryptography/hash_providers/sha3_256.hpp"
 #include "interfaces/iroha_internal/parse_and_create_batches.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -32,6 +41,28 @@
 #include "logger/logger.hpp"
 #include "torii/status_bus.hpp"
 
+namespace {
+  /// ingress queue depth beyond which new batches are shed with a
+  /// backpressure status instead of being enqueued; the remaining
+  /// quarter absorbs the lists that were in flight when the threshold
+  /// was crossed
+  constexpr size_t kIngressShedDepth = iroha::torii::
+      CommandServiceTransportGrpc::kIngressQueueCapacity * 3 / 4;
+
+  /// rough single-batch service time used to turn the queue depth into
+  /// a drain estimate for the retry-after hint
+  constexpr auto kBatchServiceEstimate = std::chrono::milliseconds(1);
+
+  constexpr auto kMinRetryAfter = std::chrono::milliseconds(100);
+  constexpr auto kMaxRetryAfter = std::chrono::milliseconds(5000);
+
+  std::chrono::milliseconds computeRetryAfter(size_t queue_depth) {
+    const auto drain_estimate =
+        kBatchServiceEstimate * static_cast<int64_t>(queue_depth);
+    return std::max(kMinRetryAfter, std::min(kMaxRetryAfter, drain_estimate));
+  }
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
@@ -55,8 +86,53 @@ namespace iroha {
           batch_parser_(std::move(batch_parser)),
           batch_factory_(std::move(transaction_batch_factory)),
           log_(std::move(log)),
+          received_tx_counter_(
+              iroha::metrics::MetricsRegistry::instance().makeCounter(
+                  "iroha_torii_transactions_total",
+                  "Transactions received over the torii interface")),
           consensus_gate_objects_(std::move(consensus_gate_objects)),
-          maximum_rounds_without_update_(maximum_rounds_without_update) {}
+          maximum_rounds_without_update_(maximum_rounds_without_update),
+          ingress_thread_([this] { processIngress(); }) {}
+
+    CommandServiceTransportGrpc::~CommandServiceTransportGrpc() {
+      stop_.store(true);
+      ingress_cv_.notify_one();
+      ingress_thread_.join();
+    }
+
+    void CommandServiceTransportGrpc::enqueueBatch(
+        std::shared_ptr<shared_model::interface::TransactionBatch> batch) {
+      while (not ingress_queue_.tryPush(batch)) {
+        // the ingress is saturated - hold the caller instead of dropping
+        // the batch, backpressure propagates to the client
+        std::this_thread::yield();
+        if (stop_.load()) {
+          return;
+        }
+      }
+      ingress_cv_.notify_one();
+    }
+
+    void CommandServiceTransportGrpc::processIngress() {
+      iroha::affinity::pinThisThread(iroha::affinity::stage::kTorii);
+      auto handle_batch =
+          [this](
+              std::shared_ptr<shared_model::interface::TransactionBatch> &&
+                  batch) {
+            command_service_->handleTransactionBatch(std::move(batch));
+          };
+      while (not stop_.load()) {
+        ingress_queue_.popAll(handle_batch);
+        std::unique_lock<std::mutex> lock(ingress_mutex_);
+        // producers notify without the mutex, so a wakeup can be missed;
+        // the timeout bounds the resulting processing delay
+        ingress_cv_.wait_for(lock, std::chrono::milliseconds(1), [this] {
+          return stop_.load() or not ingress_queue_.empty();
+        });
+      }
+      // process what was accepted before the shutdown
+      ingress_queue_.popAll(handle_batch);
+    }
 
     grpc::Status CommandServiceTransportGrpc::Torii(
         grpc::ServerContext *context,
@@ -71,9 +147,83 @@ namespace iroha {
         grpc::ServerContext *context,
         const iroha::protocol::TxList *request,
         google::protobuf::Empty *response) {
-      auto publish_stateless_fail = [&](auto &&message) {
-        using HashProvider = shared_model::crypto::Sha3_256;
+      using HashProvider = shared_model::crypto::Sha3_256;
+
+      received_tx_counter_->inc(request->transactions_size());
+
+      // coordinated shedding: while the pipeline caches together hold
+      // more than the memory budget or the ingress queue is close to
+      // full, no new batches are accepted. The call fails with an
+      // explicit backpressure status carrying a retry-after hint, so a
+      // well-behaved client backs off instead of piling retries onto the
+      // overload; the NOT_RECEIVED status records that the node never
+      // took the transaction, so it is resubmitted instead of being lost
+      const auto queue_depth = ingress_queue_.size();
+      const bool over_budget = iroha::MemoryBudget::instance().overBudget();
+      if (over_budget or queue_depth >= kIngressShedDepth) {
+        // the budget drains at a rate no queue depth predicts, so its
+        // exhaustion hints the longest backoff; a saturated queue hints
+        // its own drain estimate
+        const auto retry_after =
+            over_budget ? kMaxRetryAfter : computeRetryAfter(queue_depth);
+        log_->warn("overloaded ({}), shedding {} transactions, retry in {}ms",
+                   over_budget ? "memory budget" : "ingress queue",
+                   request->transactions_size(),
+                   retry_after.count());
+        for (const auto &tx : request->transactions()) {
+          status_bus_->publish(status_factory_->makeNotReceived(
+              HashProvider::makeHash(
+                  shared_model::proto::makeBlob(tx.payload())),
+              {fmt::format("overloaded, retry in {}ms", retry_after.count()),
+               0,
+               static_cast<uint32_t>(retry_after.count())}));
+        }
+        context->AddTrailingMetadata("retry-after-ms",
+                                     std::to_string(retry_after.count()));
+        return grpc::Status(
+            grpc::StatusCode::RESOURCE_EXHAUSTED,
+            fmt::format("overloaded, retry in {}ms", retry_after.count()));
+      }
 
+      // client SDKs resend the same signed transaction when an ack times
+      // out, and every copy used to go through deserialization and
+      // stateless validation again just to be rejected downstream; the
+      // retransmissions are dropped here on a digest of the raw
+      // transport bytes instead. The status cache keeps answering the
+      // Status polls of a retransmitting client with the original
+      // acknowledgement. The cache compares the full digest on lookup,
+      // so only an exact byte-for-byte resend classifies as a
+      // retransmission - a fresh transaction whose digest merely
+      // hash-collides with a seen one must not be dropped.
+      std::vector<bool> is_retransmission(request->transactions_size(), false);
+      size_t retransmissions = 0;
+      for (int i = 0; i < request->transactions_size(); ++i) {
+        auto digest = shared_model::crypto::toBinaryString(
+            HashProvider::makeHash(
+                shared_model::proto::makeBlob(request->transactions(i))));
+        if (recently_seen_.findItem(digest)) {
+          is_retransmission[i] = true;
+          ++retransmissions;
+        } else {
+          recently_seen_.addItem(digest, true);
+        }
+      }
+      iroha::protocol::TxList deduplicated;
+      if (retransmissions != 0) {
+        log_->info("dropped {} retransmitted transactions", retransmissions);
+        if (retransmissions
+            == static_cast<size_t>(request->transactions_size())) {
+          return grpc::Status::OK;
+        }
+        for (int i = 0; i < request->transactions_size(); ++i) {
+          if (not is_retransmission[i]) {
+            *deduplicated.add_transactions() = request->transactions(i);
+          }
+        }
+        request = &deduplicated;
+      }
+
+      auto publish_stateless_fail = [&](auto &&message) {
         log_->warn("{}", message);
         for (const auto &tx : request->transactions()) {
           status_bus_->publish(status_factory_->makeStatelessFail(
@@ -85,7 +235,10 @@ namespace iroha {
         return grpc::Status::OK;
       };
 
-      auto transactions = shared_model::proto::deserializeTransactions(
+      // deserialization and stateless validation of large lists is spread
+      // over a worker pool, so one big list does not hold this handler
+      // thread for the whole validation duration
+      auto transactions = shared_model::proto::deserializeTransactionsParallel(
           *transaction_factory_, request->transactions());
       if (auto e = expected::resultToOptionalError(transactions)) {
         return publish_stateless_fail(
@@ -94,19 +247,131 @@ namespace iroha {
                         e->error));
       }
 
+      auto valid_transactions = std::move(transactions).assumeValue();
       auto batches = shared_model::interface::parseAndCreateBatches(
-          *batch_parser_,
-          *batch_factory_,
-          std::move(transactions).assumeValue());
+          *batch_parser_, *batch_factory_, valid_transactions);
       if (auto e = expected::resultToOptionalError(batches)) {
         return publish_stateless_fail(
             fmt::format("Batch deserialization failed: {}", *e));
       }
 
       for (auto &batch : std::move(batches).assumeValue()) {
-        this->command_service_->handleTransactionBatch(std::move(batch));
+        // transactions of one batch stay together in the queue; batches
+        // are independent, so their relative order does not matter
+        enqueueBatch(std::move(batch));
       }
 
+      // the acceptance acknowledgement carries the current ingress queue
+      // depth as a position hint, so during a load spike a client can
+      // tell a batch waiting for processing from one that was shed
+      const auto position = static_cast<uint32_t>(ingress_queue_.size());
+      std::vector<StatusBus::Objects> queued;
+      queued.reserve(valid_transactions.size());
+      for (const auto &tx : valid_transactions) {
+        queued.push_back(status_factory_->makeStatelessValid(
+            tx->hash(),
+            {fmt::format("queued at ingress position {}", position),
+             0,
+             position}));
+      }
+      status_bus_->publish(queued);
+
+      return grpc::Status::OK;
+    }
+
+    grpc::Status CommandServiceTransportGrpc::ListToriiStream(
+        grpc::ServerContext *context,
+        const iroha::protocol::TxList *request,
+        grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer) {
+      using HashProvider = shared_model::crypto::Sha3_256;
+
+      // the statuses are subscribed to before submission, so no
+      // transition published during processing can be missed; the whole
+      // list is hashed in one batch over the hashing lanes
+      std::vector<shared_model::crypto::Blob> payloads;
+      payloads.reserve(request->transactions_size());
+      for (const auto &tx : request->transactions()) {
+        payloads.push_back(shared_model::proto::makeBlob(tx.payload()));
+      }
+      auto hashes = HashProvider::makeHashes(payloads);
+      auto status_bus =
+          rxcpp::observable<>::iterate(hashes).flat_map([this](auto hash) {
+            return command_service_->getStatusStream(hash);
+          });
+
+      google::protobuf::Empty empty_response;
+      ListTorii(context, request, &empty_response);
+
+      rxcpp::schedulers::run_loop rl;
+      auto current_thread = rxcpp::synchronize_in_one_worker(
+          rxcpp::schedulers::make_run_loop(rl));
+      rxcpp::composite_subscription subscription;
+
+      std::string client_id =
+          (boost::format("Peer: '%s', %d transactions") % context->peer()
+           % request->transactions_size())
+              .str();
+      auto consensus_gate_observable =
+          consensus_gate_objects_
+              // a dummy start_with lets us don't wait for the consensus event
+              // on further combine_latest
+              .start_with(ConsensusGateEvent{});
+
+      // per-hash last seen status; rounds are counted like in
+      // StatusStream, but any transaction changing its status resets the
+      // counter
+      std::unordered_map<std::string, iroha::protocol::TxStatus>
+          last_tx_statuses;
+      auto rounds_counter{0};
+      makeCombineLatestUntilFirstCompleted(
+          status_bus,
+          current_thread,
+          [](auto status, auto) { return status; },
+          consensus_gate_observable)
+          .take_while([=, &rounds_counter, &last_tx_statuses](
+                          const auto &response) {
+            const auto &proto_response =
+                std::static_pointer_cast<
+                    shared_model::proto::TransactionResponse>(response)
+                    ->getTransport();
+
+            if (context->IsCancelled()) {
+              log_->debug("client unsubscribed, {}", client_id);
+              return false;
+            }
+
+            auto status = proto_response.tx_status();
+            auto it = last_tx_statuses.find(proto_response.tx_hash());
+            if (it != last_tx_statuses.end() and it->second == status) {
+              ++rounds_counter;
+              if (rounds_counter >= maximum_rounds_without_update_) {
+                return false;
+              }
+              // omit the received status, but do not stop the stream
+              return true;
+            }
+            rounds_counter = 0;
+            last_tx_statuses[proto_response.tx_hash()] = status;
+
+            if (not response_writer->Write(proto_response)) {
+              log_->error("write to stream has failed to client {}",
+                          client_id);
+              return false;
+            }
+            log_->debug("status written, {}", client_id);
+            return true;
+          })
+          .subscribe(subscription,
+                     [](const auto &) {},
+                     [&](std::exception_ptr ep) {
+                       log_->error("something bad happened, client_id {}",
+                                   client_id);
+                     },
+                     [&] { log_->debug("stream done, {}", client_id); });
+
+      iroha::schedulers::handleEvents(subscription, rl);
+
+      log_->debug("list torii stream done, {}", client_id);
       return grpc::Status::OK;
     }
 
@@ -114,11 +379,16 @@ namespace iroha {
         grpc::ServerContext *context,
         const iroha::protocol::TxStatusRequest *request,
         iroha::protocol::ToriiResponse *response) {
+      auto hash =
+          shared_model::crypto::Hash::fromHexString(request->tx_hash());
+      // a cached status is written into the response in place, without
+      // constructing any shared_model wrapper objects on the way
+      if (command_service_->fillStatusTransport(hash, *response)) {
+        return grpc::Status::OK;
+      }
       *response =
           std::static_pointer_cast<shared_model::proto::TransactionResponse>(
-              command_service_->getStatus(
-                  shared_model::crypto::Hash::fromHexString(
-                      request->tx_hash())))
+              command_service_->getStatus(hash))
               ->getTransport();
       return grpc::Status::OK;
     }
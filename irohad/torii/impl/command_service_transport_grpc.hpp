@@ -8,12 +8,22 @@
 
 #include "torii/command_service.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
 #include <rxcpp/rx-lite.hpp>
+#include "cache/sharded_cache.hpp"
+#include "common/mpmc_ring_buffer.hpp"
 #include "endpoint.grpc.pb.h"
 #include "endpoint.pb.h"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "metrics/metrics_registry.hpp"
 
 namespace iroha {
   namespace torii {
@@ -41,6 +51,10 @@ namespace iroha {
 
       struct ConsensusGateEvent {};
 
+      /// capacity of the queue of parsed batches waiting for the ingress
+      /// thread; the backpressure threshold is derived from it
+      static constexpr size_t kIngressQueueCapacity = 8192;
+
       /**
        * Creates a new instance of CommandServiceTransportGrpc
        * @param command_service - to delegate logic work
@@ -68,6 +82,8 @@ namespace iroha {
           int maximum_rounds_without_update,
           logger::LoggerPtr log);
 
+      ~CommandServiceTransportGrpc() override;
+
       /**
        * Torii call via grpc
        * @param context - call context (see grpc docs for details)
@@ -84,12 +100,31 @@ namespace iroha {
        * @param context - call context (see grpc docs for details)
        * @param request - list of transactions received
        * @param response - no actual response (grpc stub for empty answer)
-       * @return status
+       * @return status; RESOURCE_EXHAUSTED with a retry-after-ms hint in
+       * the trailing metadata when the node is overloaded and sheds the
+       * list instead of accepting it
        */
       grpc::Status ListTorii(grpc::ServerContext *context,
                              const iroha::protocol::TxList *request,
                              google::protobuf::Empty *response) override;
 
+      /**
+       * ListToriiStream call via grpc: submits the transaction list the
+       * same way as ListTorii and streams the status updates of all its
+       * transactions back over the same call, saving clients the
+       * per-hash Status polling
+       * @param context - call context
+       * @param request - list of transactions received
+       * @param response_writer - grpc::ServerWriter which can repeatedly
+       * send transaction statuses back to the client
+       * @return status
+       */
+      grpc::Status ListToriiStream(
+          grpc::ServerContext *context,
+          const iroha::protocol::TxList *request,
+          grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer)
+          override;
+
       /**
        * Status call via grpc
        * @param context - call context
@@ -119,6 +154,13 @@ namespace iroha {
           override;
 
      private:
+      /// hand a parsed batch over to the ingress thread
+      void enqueueBatch(
+          std::shared_ptr<shared_model::interface::TransactionBatch> batch);
+
+      /// feeds the queued batches to the command service until shutdown
+      void processIngress();
+
       std::shared_ptr<CommandService> command_service_;
       std::shared_ptr<iroha::torii::StatusBus> status_bus_;
       std::shared_ptr<shared_model::interface::TxStatusFactory> status_factory_;
@@ -128,9 +170,30 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::TransactionBatchFactory>
           batch_factory_;
       logger::LoggerPtr log_;
+      /// counts transactions received over torii, exposed to the scraper
+      std::shared_ptr<iroha::metrics::Counter> received_tx_counter_;
 
       rxcpp::observable<ConsensusGateEvent> consensus_gate_objects_;
       const int maximum_rounds_without_update_;
+
+      /// digests of the recently accepted transaction transports; client
+      /// SDKs resend a transaction when its acknowledgement times out,
+      /// and such retransmissions are dropped before any shared_model
+      /// construction. The digest covers the signatures, so an MST
+      /// re-submission carrying new signatures passes through
+      cache::ShardedCache<std::string, bool> recently_seen_{
+          std::chrono::seconds(10)};
+
+      /// parsed batches waiting for the ingress thread, so a large list
+      /// does not keep its gRPC handler thread busy with processing
+      containers::MpmcRingBuffer<
+          std::shared_ptr<shared_model::interface::TransactionBatch>,
+          kIngressQueueCapacity>
+          ingress_queue_;
+      std::atomic<bool> stop_{false};
+      std::mutex ingress_mutex_;
+      std::condition_variable ingress_cv_;
+      std::thread ingress_thread_;
     };
   }  // namespace torii
 }  // namespace iroha
@@ -5,6 +5,10 @@
 
 #include "torii/query_service.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+
 #include <rxcpp/operators/rx-observe_on.hpp>
 #include <rxcpp/operators/rx-take_while.hpp>
 #include "backend/protobuf/query_responses/proto_block_query_response.hpp"
@@ -16,6 +20,70 @@
 #include "logger/logger.hpp"
 #include "validators/default_validator.hpp"
 
+namespace {
+  /// upper bound on the cached responses; enough for the hot polling
+  /// queries, and the whole cache lives only until the next commit anyway
+  constexpr size_t kResponseCacheMaxSize = 10000;
+
+  /// concurrent query executions allowed in total; has to stay below the
+  /// database session budget so block commit always finds a free session
+  constexpr size_t kMaxConcurrentQueries = 32;
+
+  /// sublimit for history scans and other queries which hold a session for
+  /// a long time
+  constexpr size_t kMaxConcurrentHeavyQueries = 8;
+
+  /// concurrent executions allowed for a single creator account
+  constexpr size_t kMaxConcurrentQueriesPerClient = 8;
+
+  /// history scans and block fetches touch many rows per request, unlike
+  /// the point lookups of account state
+  bool isHeavyQuery(const iroha::protocol::Query &request) {
+    switch (request.payload().query_case()) {
+      case iroha::protocol::Query::Payload::kGetAccountTransactions:
+      case iroha::protocol::Query::Payload::kGetAccountAssetTransactions:
+      case iroha::protocol::Query::Payload::kGetTransactions:
+      case iroha::protocol::Query::Payload::kGetBlock:
+      case iroha::protocol::Query::Payload::kGetEngineReceipts:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  /**
+   * Digest of the query payload with the per-request meta fields zeroed
+   * out. Polling clients resend the same query with a fresh created_time
+   * and query_counter, so the plain payload hash never repeats; the
+   * creator account id is kept, since permissions make the response
+   * depend on who asks.
+   *
+   * The signing public key is part of the key as well: only the stateful
+   * path binds the key to the creator's signatories, so a cached verdict
+   * may be served solely for the exact key it was produced with - the
+   * same payload signed by any other key has to take the full path and
+   * earn its own signatory and permission check. The signature bytes
+   * change with the meta fields and are left out; stateless validation
+   * has already proven possession of the key they came from.
+   */
+  shared_model::crypto::Hash makeResponseCacheKey(
+      const iroha::protocol::Query &request) {
+    iroha::protocol::Query normalized;
+    *normalized.mutable_payload() = request.payload();
+    normalized.mutable_payload()->mutable_meta()->set_created_time(0);
+    normalized.mutable_payload()->mutable_meta()->set_query_counter(0);
+    // the key is hex and case-insensitive, as in account_has_signatory
+    std::string public_key = request.signature().public_key();
+    std::transform(public_key.begin(),
+                   public_key.end(),
+                   public_key.begin(),
+                   [](char c) { return std::tolower(c); });
+    normalized.mutable_signature()->set_public_key(public_key);
+    return shared_model::crypto::DefaultHashProvider::makeHash(
+        shared_model::proto::makeBlob(normalized));
+  }
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
@@ -23,13 +91,60 @@ namespace iroha {
         std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
         std::shared_ptr<QueryFactoryType> query_factory,
         std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory,
+        rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
+            commits,
         logger::LoggerPtr log)
         : query_processor_{std::move(query_processor)},
           query_factory_{std::move(query_factory)},
           blocks_query_factory_{std::move(blocks_query_factory)},
-          log_{std::move(log)} {}
+          log_{std::move(log)} {
+      commits.subscribe(commits_subscription_, [this](const auto &) {
+        // the WSV has changed, cached responses may be stale now
+        std::lock_guard<std::shared_timed_mutex> lock(response_cache_mutex_);
+        response_cache_.clear();
+      });
+    }
 
-    void QueryService::Find(iroha::protocol::Query const &request,
+    QueryService::~QueryService() {
+      commits_subscription_.unsubscribe();
+    }
+
+    bool QueryService::AdmissionControl::tryAdmit(
+        const std::string &client_account, bool heavy) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (total_ >= kMaxConcurrentQueries) {
+        return false;
+      }
+      if (heavy and heavy_ >= kMaxConcurrentHeavyQueries) {
+        return false;
+      }
+      auto &client_count = per_client_[client_account];
+      if (client_count >= kMaxConcurrentQueriesPerClient) {
+        return false;
+      }
+      ++total_;
+      if (heavy) {
+        ++heavy_;
+      }
+      ++client_count;
+      return true;
+    }
+
+    void QueryService::AdmissionControl::release(
+        const std::string &client_account, bool heavy) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --total_;
+      if (heavy) {
+        --heavy_;
+      }
+      auto client = per_client_.find(client_account);
+      assert(client != per_client_.end());
+      if (--client->second == 0) {
+        per_client_.erase(client);
+      }
+    }
+
+    bool QueryService::Find(iroha::protocol::Query const &request,
                             iroha::protocol::QueryResponse &response) {
       shared_model::crypto::Hash hash;
       auto blobPayload = shared_model::proto::makeBlob(request.payload());
@@ -39,11 +154,39 @@ namespace iroha {
         // Query was already processed
         response.mutable_error_response()->set_reason(
             iroha::protocol::ErrorResponse::STATELESS_INVALID);
-        return;
+        return true;
       }
 
+      bool admitted = true;
       query_factory_->build(request).match(
-          [this, &hash, &response](const auto &query) {
+          [this, &request, &hash, &response, &admitted](const auto &query) {
+            // pending transactions come and go between commits, so their
+            // responses cannot be served from the per-commit cache
+            const bool cacheable =
+                not request.payload().has_get_pending_transactions();
+            auto cache_key = makeResponseCacheKey(request);
+            if (cacheable) {
+              std::shared_lock<std::shared_timed_mutex> lock(
+                  response_cache_mutex_);
+              auto cached = response_cache_.find(cache_key);
+              if (cached != response_cache_.end()) {
+                response = cached->second;
+                // the stored copy carries the hash of the query which
+                // populated it
+                response.set_query_hash(hash.hex());
+                cache_.addItem(hash, 0);
+                return;
+              }
+            }
+            const auto &client_account =
+                request.payload().meta().creator_account_id();
+            const bool heavy = isHeavyQuery(request);
+            if (not admission_control_.tryAdmit(client_account, heavy)) {
+              log_->warn("shedding query from {}: too many queries in flight",
+                         client_account);
+              admitted = false;
+              return;
+            }
             query_processor_->queryHandle(*query.value) |
                 [&](auto &&iface_response) {
                   // Send query to iroha
@@ -53,8 +196,16 @@ namespace iroha {
                   // TODO 18.02.2019 lebdron: IR-336 Replace cache
                   // 0 is used as a dummy value
                   cache_.addItem(hash, 0);
+                  if (cacheable and not response.has_error_response()) {
+                    std::lock_guard<std::shared_timed_mutex> lock(
+                        response_cache_mutex_);
+                    if (response_cache_.size() < kResponseCacheMaxSize) {
+                      response_cache_.emplace(cache_key, response);
+                    }
+                  }
                   return iroha::expected::Value<void>{};
                 };
+            admission_control_.release(client_account, heavy);
           },
           [&hash, &response](auto &&error) {
             response.set_query_hash(hash.hex());
@@ -63,12 +214,16 @@ namespace iroha {
             response.mutable_error_response()->set_message(
                 std::move(error.error.error));
           });
+      return admitted;
     }
 
     grpc::Status QueryService::Find(grpc::ServerContext *context,
                                     const iroha::protocol::Query *request,
                                     iroha::protocol::QueryResponse *response) {
-      Find(*request, *response);
+      if (not Find(*request, *response)) {
+        return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                            "too many queries in flight, try again later");
+      }
       return grpc::Status::OK;
     }
 
@@ -0,0 +1,199 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/query_service_async_transport_grpc.hpp"
+
+#include <vector>
+
+#include "logger/logger.hpp"
+
+namespace {
+  /// method index of Find within QueryService_v1, in the declaration
+  /// order of endpoint.proto
+  constexpr int kFindMethodIndex = 0;
+}  // namespace
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * One Find call in flight. The object lives on the completion
+     * queue: every asynchronous operation it starts carries a tag
+     * holding a shared_ptr back to it, so the call stays alive exactly
+     * until its last outstanding operation has been delivered. The
+     * request arrives and the response leaves as raw wire bytes, the
+     * typed (de)serialization is done here, once, with the size
+     * computed up front
+     */
+    class QueryServiceAsyncTransportGrpc::FindCall final
+        : public std::enable_shared_from_this<FindCall> {
+     public:
+      FindCall(QueryServiceAsyncTransportGrpc &transport,
+               grpc::ServerCompletionQueue &cq)
+          : transport_(transport), cq_(cq), responder_(&context_) {}
+
+      /// makes a call object waiting for the next incoming call
+      static void spawn(QueryServiceAsyncTransportGrpc &transport,
+                        grpc::ServerCompletionQueue &cq) {
+        auto call = std::make_shared<FindCall>(transport, cq);
+        transport.requestFindCall(&call->context_,
+                                  &call->request_,
+                                  &call->responder_,
+                                  &cq,
+                                  call->makeTag(&FindCall::onRequested));
+      }
+
+     private:
+      using Handler = void (FindCall::*)(bool);
+
+      /// queue tag keeping the call alive until it is delivered
+      struct Tag final : network::AsyncCqTag {
+        std::shared_ptr<FindCall> call;
+        Handler handler;
+
+        Tag(std::shared_ptr<FindCall> call, Handler handler)
+            : call(std::move(call)), handler(handler) {}
+
+        void proceed(bool ok) override {
+          auto kept_alive = std::move(call);
+          auto method = handler;
+          delete this;
+          ((*kept_alive).*method)(ok);
+        }
+      };
+
+      network::AsyncCqTag *makeTag(Handler handler) {
+        return new Tag(shared_from_this(), handler);
+      }
+
+      /// an incoming call has been matched to this object
+      void onRequested(bool ok) {
+        if (not ok) {
+          // the server is shutting down, no call was matched
+          return;
+        }
+        // wait for the next client with a fresh call object
+        spawn(transport_, cq_);
+
+        // the database read behind the query must not park the queue
+        // pollers shared with the status streams
+        auto self = shared_from_this();
+        transport_.task_scheduler_->post(
+            TaskScheduler::Priority::kValidation, [self] { self->execute(); });
+      }
+
+      /// parse the request, run the query and serialize the response;
+      /// runs on a worker of the shared pool
+      void execute() {
+        iroha::protocol::Query query;
+        if (not parseRequest(query)) {
+          transport_.log_->warn("failed to parse a query from client {}",
+                                context_.peer());
+          responder_.FinishWithError(
+              grpc::Status(grpc::StatusCode::INTERNAL,
+                           "failed to parse the query request"),
+              makeTag(&FindCall::onFinished));
+          return;
+        }
+
+        iroha::protocol::QueryResponse response;
+        if (not transport_.query_service_->Find(query, response)) {
+          responder_.FinishWithError(
+              grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                           "too many queries in flight, try again later"),
+              makeTag(&FindCall::onFinished));
+          return;
+        }
+
+        // the size is computed once, the message is serialized into one
+        // exactly-sized slice and the slice is handed to gRPC as the
+        // wire buffer, so a large page costs one allocation and one
+        // serialization pass
+        const size_t byte_size = response.ByteSizeLong();
+        grpc::Slice slice(byte_size);
+        response.SerializeWithCachedSizesToArray(
+            const_cast<uint8_t *>(slice.begin()));
+        grpc::ByteBuffer wire(&slice, 1);
+        responder_.Finish(
+            wire, grpc::Status::OK, makeTag(&FindCall::onFinished));
+      }
+
+      /// assemble the request bytes and parse them in a single pass;
+      /// queries are small, so flattening a fragmented buffer is cheap
+      bool parseRequest(iroha::protocol::Query &query) {
+        std::vector<grpc::Slice> slices;
+        if (not request_.Dump(&slices).ok()) {
+          return false;
+        }
+        if (slices.size() == 1) {
+          return query.ParseFromArray(slices.front().begin(),
+                                      slices.front().size());
+        }
+        std::string flat;
+        flat.reserve(request_.Length());
+        for (const auto &slice : slices) {
+          flat.append(reinterpret_cast<const char *>(slice.begin()),
+                      slice.size());
+        }
+        return query.ParseFromString(flat);
+      }
+
+      /// the response has been delivered, nothing left to do
+      void onFinished(bool) {}
+
+      QueryServiceAsyncTransportGrpc &transport_;
+      grpc::ServerCompletionQueue &cq_;
+      grpc::ServerContext context_;
+      grpc::ByteBuffer request_;
+      grpc::ServerAsyncResponseWriter<grpc::ByteBuffer> responder_;
+    };
+
+    QueryServiceAsyncTransportGrpc::QueryServiceAsyncTransportGrpc(
+        std::shared_ptr<QueryService> query_service,
+        std::shared_ptr<TaskScheduler> task_scheduler,
+        logger::LoggerPtr log)
+        : query_service_(std::move(query_service)),
+          task_scheduler_(std::move(task_scheduler)),
+          log_(std::move(log)) {
+      // the server passes Find calls to the completion queue as raw
+      // byte buffers instead of the synchronous typed handler
+      MarkMethodRaw(kFindMethodIndex);
+    }
+
+    grpc::Status QueryServiceAsyncTransportGrpc::Find(
+        grpc::ServerContext *,
+        const iroha::protocol::Query *,
+        iroha::protocol::QueryResponse *) {
+      return grpc::Status(grpc::StatusCode::INTERNAL,
+                          "Find is served asynchronously");
+    }
+
+    grpc::Status QueryServiceAsyncTransportGrpc::FetchCommits(
+        grpc::ServerContext *context,
+        const iroha::protocol::BlocksQuery *request,
+        grpc::ServerWriter<iroha::protocol::BlockQueryResponse> *writer) {
+      return query_service_->FetchCommits(context, request, writer);
+    }
+
+    grpc::Service &QueryServiceAsyncTransportGrpc::service() {
+      return *this;
+    }
+
+    void QueryServiceAsyncTransportGrpc::start(
+        grpc::ServerCompletionQueue &cq) {
+      FindCall::spawn(*this, cq);
+    }
+
+    void QueryServiceAsyncTransportGrpc::requestFindCall(
+        grpc::ServerContext *context,
+        grpc::ByteBuffer *request,
+        grpc::ServerAsyncResponseWriter<grpc::ByteBuffer> *responder,
+        grpc::ServerCompletionQueue *cq,
+        void *tag) {
+      RequestAsyncUnary(
+          kFindMethodIndex, context, request, responder, cq, cq, tag);
+    }
+  }  // namespace torii
+}  // namespace iroha
@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_QUERY_SERVICE_ASYNC_TRANSPORT_GRPC_HPP
+#define TORII_QUERY_SERVICE_ASYNC_TRANSPORT_GRPC_HPP
+
+#include "torii/query_service.hpp"
+
+#include "common/task_scheduler.hpp"
+#include "network/async_cq_service.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * QueryService_v1 transport serving Find as a raw asynchronous
+     * unary call. The generated typed handler serializes a response
+     * through a chunked buffer writer which allocates slice after slice
+     * as the output grows; on transaction and asset pages of thousands
+     * of entries that is a visible allocation and memcpy cost. This
+     * transport computes ByteSizeLong once, serializes the response
+     * into a single exactly-sized slice and hands that slice to gRPC
+     * as the wire buffer, with no further copies. Query execution is
+     * posted to the shared worker pool, so the completion queue
+     * pollers are not parked behind database reads. gRPC allows a
+     * service with asynchronous methods to be registered with a single
+     * server only, so every server needs an instance of its own; the
+     * per-call logic is delegated to one shared synchronous service
+     */
+    class QueryServiceAsyncTransportGrpc final
+        : public iroha::protocol::QueryService_v1::Service,
+          public iroha::network::AsyncCqService {
+     public:
+      /**
+       * @param query_service - the shared service the calls are
+       * delegated to
+       * @param task_scheduler - pool running the query executions
+       * @param log to print progress
+       */
+      QueryServiceAsyncTransportGrpc(
+          std::shared_ptr<QueryService> query_service,
+          std::shared_ptr<TaskScheduler> task_scheduler,
+          logger::LoggerPtr log);
+
+      /// not reachable: the method is marked raw and served through the
+      /// completion queue
+      grpc::Status Find(grpc::ServerContext *context,
+                        const iroha::protocol::Query *request,
+                        iroha::protocol::QueryResponse *response) override;
+
+      /// forwarded to the shared synchronous service
+      grpc::Status FetchCommits(
+          grpc::ServerContext *context,
+          const iroha::protocol::BlocksQuery *request,
+          grpc::ServerWriter<iroha::protocol::BlockQueryResponse> *writer)
+          override;
+
+      // AsyncCqService
+      grpc::Service &service() override;
+      void start(grpc::ServerCompletionQueue &cq) override;
+
+     private:
+      class FindCall;
+
+      /// forwards to the protected asynchronous request API of
+      /// grpc::Service on behalf of the call objects
+      void requestFindCall(
+          grpc::ServerContext *context,
+          grpc::ByteBuffer *request,
+          grpc::ServerAsyncResponseWriter<grpc::ByteBuffer> *responder,
+          grpc::ServerCompletionQueue *cq,
+          void *tag);
+
+      std::shared_ptr<QueryService> query_service_;
+      std::shared_ptr<TaskScheduler> task_scheduler_;
+      logger::LoggerPtr log_;
+    };
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_QUERY_SERVICE_ASYNC_TRANSPORT_GRPC_HPP
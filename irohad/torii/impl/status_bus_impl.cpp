@@ -5,21 +5,114 @@
 
 #include "torii/impl/status_bus_impl.hpp"
 
+#include <chrono>
+#include <thread>
+
+#include "common/thread_affinity.hpp"
+
 namespace iroha {
   namespace torii {
-    StatusBusImpl::StatusBusImpl(rxcpp::observe_on_one_worker worker)
-        : worker_(worker), subject_(worker_, cs_) {}
+    StatusBusImpl::StatusBusImpl() : dispatcher_([this] { dispatch(); }) {}
 
     StatusBusImpl::~StatusBusImpl() {
-      cs_.unsubscribe();
+      stop_.store(true);
+      dispatch_cv_.notify_one();
+      dispatcher_.join();
+      subject_.get_subscriber().on_completed();
+      std::lock_guard<std::mutex> lock(routes_mutex_);
+      for (auto &route : routes_) {
+        route.second.subject.get_subscriber().on_completed();
+      }
     }
 
     void StatusBusImpl::publish(StatusBus::Objects resp) {
-      subject_.get_subscriber().on_next(resp);
+      while (not queue_.tryPush(resp)) {
+        // the bus is saturated - let the dispatcher catch up instead of
+        // dropping the status; publication stays non-blocking in every
+        // realistic case, since the ring holds thousands of statuses
+        std::this_thread::yield();
+        if (stop_.load()) {
+          return;
+        }
+      }
+      dispatch_cv_.notify_one();
+    }
+
+    void StatusBusImpl::publish(std::vector<StatusBus::Objects> const &resps) {
+      auto it = resps.begin();
+      while (it != resps.end()) {
+        it += queue_.tryPushBatch(it, resps.end());
+        if (it != resps.end()) {
+          // the bus is saturated - wake the dispatcher and let it catch up
+          dispatch_cv_.notify_one();
+          std::this_thread::yield();
+          if (stop_.load()) {
+            return;
+          }
+        }
+      }
+      dispatch_cv_.notify_one();
     }
 
     rxcpp::observable<StatusBus::Objects> StatusBusImpl::statuses() {
       return subject_.get_observable();
     }
+
+    rxcpp::observable<StatusBus::Objects> StatusBusImpl::statuses(
+        const shared_model::interface::types::HashType &tx_hash) {
+      std::lock_guard<std::mutex> lock(routes_mutex_);
+      return routes_[tx_hash].subject.get_observable();
+    }
+
+    void StatusBusImpl::dispatch() {
+      iroha::affinity::pinThisThread(iroha::affinity::stage::kTorii);
+      auto subscriber = subject_.get_subscriber();
+      while (not stop_.load()) {
+        queue_.popAll([this, &subscriber](StatusBus::Objects &&resp) {
+          deliver(subscriber, std::move(resp));
+        });
+        pruneRoutes();
+        std::unique_lock<std::mutex> lock(dispatch_mutex_);
+        // producers notify without the mutex, so a wakeup can be missed;
+        // the timeout bounds the resulting delivery delay
+        dispatch_cv_.wait_for(lock, std::chrono::milliseconds(1), [this] {
+          return stop_.load() or not queue_.empty();
+        });
+      }
+      // deliver what was published before the shutdown
+      queue_.popAll([this, &subscriber](StatusBus::Objects &&resp) {
+        deliver(subscriber, std::move(resp));
+      });
+    }
+
+    void StatusBusImpl::deliver(
+        rxcpp::subscriber<StatusBus::Objects> &subscriber,
+        StatusBus::Objects resp) {
+      {
+        // only the route of this transaction is touched, so the delivery
+        // cost does not depend on how many other streams are open
+        std::lock_guard<std::mutex> lock(routes_mutex_);
+        auto it = routes_.find(resp->transactionHash());
+        if (it != routes_.end()) {
+          it->second.had_observers |= it->second.subject.has_observers();
+          it->second.subject.get_subscriber().on_next(resp);
+        }
+      }
+      subscriber.on_next(std::move(resp));
+    }
+
+    void StatusBusImpl::pruneRoutes() {
+      std::lock_guard<std::mutex> lock(routes_mutex_);
+      for (auto it = routes_.begin(); it != routes_.end();) {
+        auto &route = it->second;
+        route.had_observers |= route.subject.has_observers();
+        if (route.had_observers and not route.subject.has_observers()) {
+          // the last interested stream is done (e.g. got its final status)
+          it = routes_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
   }  // namespace torii
 }  // namespace iroha
@@ -8,31 +8,71 @@
 
 #include "torii/status_bus.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 #include <rxcpp/rx-lite.hpp>
 
-#include <rxcpp/operators/rx-observe_on.hpp>
+#include "common/mpmc_ring_buffer.hpp"
+#include "cryptography/hash.hpp"
 
 namespace iroha {
   namespace torii {
     /**
-     * StatusBus implementation
+     * StatusBus implementation. Publishers enqueue into a lock-free ring
+     * and return immediately; a dedicated dispatcher thread drains the
+     * ring and delivers the statuses to the subscribers, so concurrent
+     * publications do not contend on the rx subject.
      */
     class StatusBusImpl : public StatusBus {
      public:
-      StatusBusImpl(
-          rxcpp::observe_on_one_worker worker = rxcpp::observe_on_new_thread());
+      StatusBusImpl();
 
       ~StatusBusImpl() override;
 
       void publish(StatusBus::Objects) override;
-      /// Subscribers will be invoked in separate thread
+      /// enqueues the whole group with one dispatcher wakeup
+      void publish(std::vector<StatusBus::Objects> const &) override;
+      /// Subscribers will be invoked in the dispatcher thread
       rxcpp::observable<StatusBus::Objects> statuses() override;
+      rxcpp::observable<StatusBus::Objects> statuses(
+          const shared_model::interface::types::HashType &tx_hash) override;
+
+     private:
+      /// a dedicated subject for the subscribers of one transaction
+      struct HashRoute {
+        rxcpp::subjects::subject<StatusBus::Objects> subject;
+        /// set once somebody subscribes - an entry that had observers and
+        /// lost them is safe to prune, while a just created one is not
+        bool had_observers{false};
+      };
+
+      /// drains the queue and feeds the subject until shutdown
+      void dispatch();
+
+      /// pass one status to the global subject and the interested route
+      void deliver(rxcpp::subscriber<StatusBus::Objects> &subscriber,
+                   StatusBus::Objects resp);
+
+      /// drop the routes whose last subscriber is gone
+      void pruneRoutes();
+
+      containers::MpmcRingBuffer<StatusBus::Objects, 8192> queue_;
+      rxcpp::subjects::subject<StatusBus::Objects> subject_;
+
+      std::mutex routes_mutex_;
+      std::unordered_map<shared_model::interface::types::HashType,
+                         HashRoute,
+                         shared_model::crypto::Hash::Hasher>
+          routes_;
 
-      // Need to create once, otherwise will create thread for each subscriber
-      rxcpp::observe_on_one_worker worker_;
-      rxcpp::composite_subscription cs_;
-      rxcpp::subjects::synchronize<StatusBus::Objects, decltype(worker_)>
-          subject_;
+      std::atomic<bool> stop_{false};
+      std::mutex dispatch_mutex_;
+      std::condition_variable dispatch_cv_;
+      std::thread dispatcher_;
     };
   }  // namespace torii
 }  // namespace iroha
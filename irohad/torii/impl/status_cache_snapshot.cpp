@@ -0,0 +1,107 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/status_cache_snapshot.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "cryptography/hash.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /// identifies the snapshot file format
+  constexpr char kSnapshotMagic[] = {'i', 'r', 's', 't', 'a', 't', 's', '1'};
+
+  /// upper bound on one serialized response, to reject corrupt length
+  /// fields without attempting a huge allocation
+  constexpr uint32_t kMaxRecordSize = 1u << 20;
+}  // namespace
+
+void iroha::torii::saveStatusCacheSnapshot(
+    const CommandServiceImpl::CacheType &cache,
+    const std::string &path,
+    const logger::LoggerPtr &log) {
+  // serialize under the cache locks, write to disk outside of them
+  std::vector<std::string> records;
+  cache.forEach([&records](const auto &record) {
+    records.push_back(
+        CommandServiceImpl::toTransport(record).SerializeAsString());
+  });
+
+  std::ofstream file(path, std::ofstream::binary | std::ofstream::trunc);
+  if (not file) {
+    log->warn("Cannot open status cache snapshot for writing: {}", path);
+    return;
+  }
+  file.write(kSnapshotMagic, sizeof(kSnapshotMagic));
+  const uint64_t count = records.size();
+  file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+  for (const auto &record : records) {
+    const uint32_t size = static_cast<uint32_t>(record.size());
+    file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    file.write(record.data(), record.size());
+  }
+  file.flush();
+  if (not file) {
+    log->warn("Failed to write status cache snapshot: {}", path);
+    return;
+  }
+  log->info("Wrote status cache snapshot with {} statuses: {}", count, path);
+}
+
+void iroha::torii::loadStatusCacheSnapshot(
+    CommandServiceImpl::CacheType &cache,
+    const std::string &path,
+    const logger::LoggerPtr &log) {
+  std::ifstream file(path, std::ifstream::binary);
+  if (not file) {
+    // normal on the first start
+    log->debug("No status cache snapshot found: {}", path);
+    return;
+  }
+  char magic[sizeof(kSnapshotMagic)];
+  if (not file.read(magic, sizeof(magic))
+      or 0 != std::memcmp(magic, kSnapshotMagic, sizeof(magic))) {
+    log->warn("Status cache snapshot has wrong format, ignoring it: {}", path);
+    return;
+  }
+  uint64_t count{};
+  if (not file.read(reinterpret_cast<char *>(&count), sizeof(count))) {
+    log->warn("Status cache snapshot is truncated, ignoring it: {}", path);
+    return;
+  }
+  uint64_t loaded = 0;
+  std::string record;
+  for (; loaded < count; ++loaded) {
+    uint32_t size{};
+    if (not file.read(reinterpret_cast<char *>(&size), sizeof(size))
+        or size > kMaxRecordSize) {
+      break;
+    }
+    record.resize(size);
+    if (not file.read(&record[0], size)) {
+      break;
+    }
+    iroha::protocol::ToriiResponse transport;
+    if (not transport.ParseFromArray(record.data(),
+                                     static_cast<int>(record.size()))) {
+      break;
+    }
+    cache.addItem(
+        shared_model::crypto::Hash::fromHexString(transport.tx_hash()),
+        CommandServiceImpl::fromTransport(transport));
+  }
+  if (loaded != count) {
+    log->warn("Status cache snapshot is corrupt after {} of {} statuses: {}",
+              loaded,
+              count,
+              path);
+    return;
+  }
+  log->info("Loaded {} statuses from status cache snapshot: {}", count, path);
+}
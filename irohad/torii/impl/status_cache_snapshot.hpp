@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_STATUS_CACHE_SNAPSHOT_HPP
+#define TORII_STATUS_CACHE_SNAPSHOT_HPP
+
+#include <string>
+
+#include "logger/logger_fwd.hpp"
+#include "torii/impl/command_service_impl.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Write the current contents of the status cache to a snapshot file.
+     * Expired entries are skipped. The previous snapshot at this path, if
+     * any, is replaced. Failures are logged and otherwise ignored - the
+     * snapshot is an optimization, losing it only costs cache misses.
+     * @param cache - the status cache to dump
+     * @param path - snapshot file location
+     * @param log to report progress and failures
+     */
+    void saveStatusCacheSnapshot(const CommandServiceImpl::CacheType &cache,
+                                 const std::string &path,
+                                 const logger::LoggerPtr &log);
+
+    /**
+     * Fill the status cache from a snapshot file written by
+     * saveStatusCacheSnapshot on a previous shutdown. A missing file is
+     * not an error - it is the normal first start. A corrupt file is
+     * logged and the rest of it is skipped; the entries loaded so far
+     * stay in the cache.
+     * @param cache - the status cache to fill
+     * @param path - snapshot file location
+     * @param log to report progress and failures
+     */
+    void loadStatusCacheSnapshot(CommandServiceImpl::CacheType &cache,
+                                 const std::string &path,
+                                 const logger::LoggerPtr &log);
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_STATUS_CACHE_SNAPSHOT_HPP
@@ -5,7 +5,10 @@
 
 #include "torii/processor/transaction_processor_impl.hpp"
 
+#include <vector>
+
 #include <boost/format.hpp>
+#include <boost/range/size.hpp>
 
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
@@ -67,38 +70,53 @@ namespace iroha {
 
             const auto &proposal_and_errors = getVerifiedProposalUnsafe(event);
 
-            // notify about failed txs
+            // all transitions of the proposal go to the bus as one batch
             const auto &errors = proposal_and_errors->rejected_transactions;
+            std::vector<iroha::torii::StatusBus::Objects> statuses;
+            statuses.reserve(
+                errors.size()
+                + boost::size(
+                    proposal_and_errors->verified_proposal->transactions()));
+            // notify about failed txs
             for (const auto &tx_error : errors) {
               log_->info("{}", composeErrorMessage(tx_error));
-              this->publishStatus(TxStatusType::kStatefulFailed,
-                                  tx_error.tx_hash,
-                                  tx_error.error);
+              statuses.push_back(makeStatusResponse(TxStatusType::kStatefulFailed,
+                                                    tx_error.tx_hash,
+                                                    tx_error.error));
             }
             // notify about success txs
             for (const auto &successful_tx :
                  proposal_and_errors->verified_proposal->transactions()) {
               log_->info("VerifiedProposalCreatorEvent StatefulValid: {}",
                          successful_tx.hash().hex());
-              this->publishStatus(TxStatusType::kStatefulValid,
-                                  successful_tx.hash());
+              statuses.push_back(makeStatusResponse(
+                  TxStatusType::kStatefulValid, successful_tx.hash(), {}));
             }
+            status_bus_->publish(statuses);
           });
 
       // commit transactions
       commits.subscribe(
           // on next
           [this](auto block) {
+            // one bus batch per block instead of a wakeup per transaction
+            std::vector<iroha::torii::StatusBus::Objects> statuses;
+            statuses.reserve(
+                boost::size(block->transactions())
+                + boost::size(block->rejected_transactions_hashes()));
             for (const auto &tx : block->transactions()) {
               const auto &hash = tx.hash();
               log_->debug("Committed transaction: {}", hash.hex());
-              this->publishStatus(TxStatusType::kCommitted, hash);
+              statuses.push_back(
+                  makeStatusResponse(TxStatusType::kCommitted, hash, {}));
             }
             for (const auto &rejected_tx_hash :
                  block->rejected_transactions_hashes()) {
               log_->debug("Rejected transaction: {}", rejected_tx_hash.hex());
-              this->publishStatus(TxStatusType::kRejected, rejected_tx_hash);
+              statuses.push_back(makeStatusResponse(
+                  TxStatusType::kRejected, rejected_tx_hash, {}));
             }
+            status_bus_->publish(statuses);
           });
 
       mst_processor_->onStateUpdate().subscribe([this](auto &&state) {
@@ -135,7 +153,8 @@ namespace iroha {
       }
     }
 
-    void TransactionProcessorImpl::publishStatus(
+    iroha::torii::StatusBus::Objects
+    TransactionProcessorImpl::makeStatusResponse(
         TxStatusType tx_status,
         const shared_model::crypto::Hash &hash,
         const validation::CommandError &cmd_error) const {
@@ -144,62 +163,49 @@ namespace iroha {
           : shared_model::interface::TxStatusFactory::TransactionError{
                 cmd_error.name, cmd_error.index, cmd_error.error_code};
       switch (tx_status) {
-        case TxStatusType::kStatelessFailed: {
-          status_bus_->publish(
-              status_factory_->makeStatelessFail(hash, tx_error));
-          return;
-        };
-        case TxStatusType::kStatelessValid: {
-          status_bus_->publish(
-              status_factory_->makeStatelessValid(hash, tx_error));
-          return;
-        };
-        case TxStatusType::kStatefulFailed: {
-          status_bus_->publish(
-              status_factory_->makeStatefulFail(hash, tx_error));
-          return;
-        };
-        case TxStatusType::kStatefulValid: {
-          status_bus_->publish(
-              status_factory_->makeStatefulValid(hash, tx_error));
-          return;
-        };
-        case TxStatusType::kRejected: {
-          status_bus_->publish(status_factory_->makeRejected(hash, tx_error));
-          return;
-        };
-        case TxStatusType::kCommitted: {
-          status_bus_->publish(status_factory_->makeCommitted(hash, tx_error));
-          return;
-        };
-        case TxStatusType::kMstExpired: {
-          status_bus_->publish(status_factory_->makeMstExpired(hash, tx_error));
-          return;
-        };
-        case TxStatusType::kNotReceived: {
-          status_bus_->publish(
-              status_factory_->makeNotReceived(hash, tx_error));
-          return;
-        };
-        case TxStatusType::kMstPending: {
-          status_bus_->publish(status_factory_->makeMstPending(hash, tx_error));
-          return;
-        };
-        case TxStatusType::kEnoughSignaturesCollected: {
-          status_bus_->publish(
-              status_factory_->makeEnoughSignaturesCollected(hash, tx_error));
-          return;
-        };
+        case TxStatusType::kStatelessFailed:
+          return status_factory_->makeStatelessFail(hash, tx_error);
+        case TxStatusType::kStatelessValid:
+          return status_factory_->makeStatelessValid(hash, tx_error);
+        case TxStatusType::kStatefulFailed:
+          return status_factory_->makeStatefulFail(hash, tx_error);
+        case TxStatusType::kStatefulValid:
+          return status_factory_->makeStatefulValid(hash, tx_error);
+        case TxStatusType::kRejected:
+          return status_factory_->makeRejected(hash, tx_error);
+        case TxStatusType::kCommitted:
+          return status_factory_->makeCommitted(hash, tx_error);
+        case TxStatusType::kMstExpired:
+          return status_factory_->makeMstExpired(hash, tx_error);
+        case TxStatusType::kNotReceived:
+          return status_factory_->makeNotReceived(hash, tx_error);
+        case TxStatusType::kMstPending:
+          return status_factory_->makeMstPending(hash, tx_error);
+        case TxStatusType::kEnoughSignaturesCollected:
+          return status_factory_->makeEnoughSignaturesCollected(hash,
+                                                                tx_error);
       }
+      // unreachable: the switch above covers all status types
+      return status_factory_->makeNotReceived(hash, tx_error);
+    }
+
+    void TransactionProcessorImpl::publishStatus(
+        TxStatusType tx_status,
+        const shared_model::crypto::Hash &hash,
+        const validation::CommandError &cmd_error) const {
+      status_bus_->publish(makeStatusResponse(tx_status, hash, cmd_error));
     }
 
     void TransactionProcessorImpl::publishEnoughSignaturesStatus(
         const shared_model::interface::types::SharedTxsCollectionType &txs)
         const {
+      std::vector<iroha::torii::StatusBus::Objects> statuses;
+      statuses.reserve(txs.size());
       for (const auto &tx : txs) {
-        this->publishStatus(TxStatusType::kEnoughSignaturesCollected,
-                            tx->hash());
+        statuses.push_back(makeStatusResponse(
+            TxStatusType::kEnoughSignaturesCollected, tx->hash(), {}));
       }
+      status_bus_->publish(statuses);
     }
   }  // namespace torii
 }  // namespace iroha
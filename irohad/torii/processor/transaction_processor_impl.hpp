@@ -83,6 +83,18 @@ namespace iroha {
         kMstPending,
         kEnoughSignaturesCollected
       };
+      /**
+       * Build the status response of a transaction
+       * @param tx_status of the response
+       * @param hash of that transaction
+       * @param cmd_error, which can appear during validation
+       * @return response ready for publication on the status bus
+       */
+      iroha::torii::StatusBus::Objects makeStatusResponse(
+          TxStatusType tx_status,
+          const shared_model::crypto::Hash &hash,
+          const validation::CommandError &cmd_error) const;
+
       /**
        * Publish status of transaction
        * @param tx_status to be published
@@ -6,7 +6,12 @@
 #ifndef TORII_QUERY_SERVICE_HPP
 #define TORII_QUERY_SERVICE_HPP
 
+#include <mutex>
+#include <shared_mutex>
+#include <string>
 #include <unordered_map>
+
+#include <rxcpp/rx-lite.hpp>
 #include "endpoint.grpc.pb.h"
 #include "endpoint.pb.h"
 #include "qry_responses.pb.h"
@@ -20,9 +25,10 @@
 
 namespace shared_model {
   namespace interface {
+    class Block;
     template <typename Interface, typename Transport>
     class AbstractTransportFactory;
-  }
+  }  // namespace interface
 }  // namespace shared_model
 
 namespace iroha {
@@ -43,21 +49,35 @@ namespace iroha {
               shared_model::interface::BlocksQuery,
               iroha::protocol::BlocksQuery>;
 
+      /**
+       * @param query_processor - executes the queries
+       * @param query_factory - builds and validates incoming queries
+       * @param blocks_query_factory - builds and validates block queries
+       * @param commits - block commit notifications; each commit invalidates
+       * the cached query responses, since they may refer to an older WSV state
+       * @param log to print progress
+       */
       QueryService(
           std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
           std::shared_ptr<QueryFactoryType> query_factory,
           std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory,
+          rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
+              commits,
           logger::LoggerPtr log);
 
       QueryService(const QueryService &) = delete;
       QueryService &operator=(const QueryService &) = delete;
 
+      ~QueryService() override;
+
       /**
        * actual implementation of async Find in QueryService
        * @param request - Query
        * @param response - QueryResponse
+       * @return false if the query was shed by admission control and the
+       * response was not filled, true otherwise
        */
-      void Find(iroha::protocol::Query const &request,
+      bool Find(iroha::protocol::Query const &request,
                 iroha::protocol::QueryResponse &response);
 
       grpc::Status Find(grpc::ServerContext *context,
@@ -71,16 +91,48 @@ namespace iroha {
           override;
 
      private:
+      /**
+       * Bounds the queries executing concurrently against the database, so
+       * that one analytics client issuing heavy history scans cannot exhaust
+       * the session pool shared with the commit path. Cache hits bypass it.
+       */
+      class AdmissionControl {
+       public:
+        /// try to reserve an execution slot; false means the query is shed
+        bool tryAdmit(const std::string &client_account, bool heavy);
+
+        /// return the slot taken by tryAdmit
+        void release(const std::string &client_account, bool heavy);
+
+       private:
+        std::mutex mutex_;
+        size_t total_{0};
+        size_t heavy_{0};
+        std::unordered_map<std::string, size_t> per_client_;
+      };
+
       std::shared_ptr<iroha::torii::QueryProcessor> query_processor_;
       std::shared_ptr<QueryFactoryType> query_factory_;
       std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory_;
 
+      AdmissionControl admission_control_;
+
       // TODO 18.02.2019 lebdron: IR-336 Replace cache
       iroha::cache::Cache<shared_model::crypto::Hash,
                           int,
                           shared_model::crypto::Hash::Hasher>
           cache_;
 
+      /// responses of already executed queries, valid until the next commit;
+      /// keyed by a digest of the query payload with the per-request meta
+      /// fields zeroed out, so identical polls from the same account hit
+      std::unordered_map<shared_model::crypto::Hash,
+                         iroha::protocol::QueryResponse,
+                         shared_model::crypto::Hash::Hasher>
+          response_cache_;
+      std::shared_timed_mutex response_cache_mutex_;
+      rxcpp::composite_subscription commits_subscription_;
+
       logger::LoggerPtr log_;
     };
   }  // namespace torii
@@ -6,6 +6,8 @@
 #ifndef TORII_STATUS_BUS
 #define TORII_STATUS_BUS
 
+#include <vector>
+
 #include <rxcpp/rx-observable-fwd.hpp>
 #include "interfaces/transaction_responses/tx_response.hpp"
 
@@ -29,10 +31,31 @@ namespace iroha {
        */
       virtual void publish(Objects) = 0;
 
+      /**
+       * Shares a group of objects among the bus subscribers in one call,
+       * e.g. all status transitions caused by one proposal or block;
+       * implementations may coalesce the dispatcher wakeups of the group
+       * @param objects to share
+       * note: guaranteed to be non-blocking call
+       */
+      virtual void publish(std::vector<Objects> const &objects) {
+        for (auto const &object : objects) {
+          publish(object);
+        }
+      }
+
       /**
        * @return observable over objects in bus
        */
       virtual rxcpp::observable<Objects> statuses() = 0;
+
+      /**
+       * @return observable over the statuses of one transaction only; the
+       * delivery cost does not depend on the number of subscribers waiting
+       * for other transactions
+       */
+      virtual rxcpp::observable<Objects> statuses(
+          const shared_model::interface::types::HashType &tx_hash) = 0;
     };
   }  // namespace torii
 }  // namespace iroha
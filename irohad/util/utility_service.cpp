@@ -14,6 +14,7 @@
 #include <rxcpp/rx.hpp>
 #include "common/run_loop_handler.hpp"
 #include "logger/logger.hpp"
+#include "metrics/pipeline_snapshots.hpp"
 #include "util/status.hpp"
 
 using namespace iroha::utility_service;
@@ -40,6 +41,32 @@ void UtilityService::notify(enum Status status) {
   impl_->status_observable.get_subscriber().on_next(status);
 }
 
+grpc::Status UtilityService::Diagnostics(
+    ::grpc::ServerContext *context,
+    const ::google::protobuf::Empty * /* request */,
+    proto::Diagnostics *response) {
+  log_->trace("Got diagnostics request from client {}.", context->peer());
+
+  const auto snapshot =
+      iroha::metrics::PipelineSnapshots::instance().snapshot();
+  response->set_consensus_block_round(snapshot.consensus_block_round);
+  response->set_consensus_reject_round(snapshot.consensus_reject_round);
+  response->set_consensus_votes(snapshot.consensus_votes);
+  response->set_ordering_cache_batches(snapshot.ordering_cache_batches);
+  response->set_ordering_cache_transactions(
+      snapshot.ordering_cache_transactions);
+  response->set_next_proposal_transactions(
+      snapshot.next_proposal_transactions);
+  response->set_mst_pending_batches(snapshot.mst_pending_batches);
+  for (const auto &round : snapshot.recent_rounds) {
+    auto *timing = response->add_recent_rounds();
+    timing->set_block_round(round.block_round);
+    timing->set_reject_round(round.reject_round);
+    timing->set_duration_us(round.duration_us);
+  }
+  return ::grpc::Status::OK;
+}
+
 grpc::Status UtilityService::Shutdown(
     ::grpc::ServerContext *context,
     const ::google::protobuf::Empty * /* request */,
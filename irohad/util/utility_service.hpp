@@ -34,6 +34,11 @@ namespace iroha {
           const ::google::protobuf::Empty * /* request */,
           ::google::protobuf::Empty * /* response */) override;
 
+      ::grpc::Status Diagnostics(
+          ::grpc::ServerContext *context,
+          const ::google::protobuf::Empty * /* request */,
+          ::iroha::utility_service::proto::Diagnostics *response) override;
+
       void notify(enum Status status) override;
 
      private:
@@ -7,6 +7,7 @@
 #define IROHA_CHAIN_VALIDATOR_HPP
 
 #include <memory>
+#include <vector>
 
 #include <rxcpp/rx-observable-fwd.hpp>
 
@@ -47,6 +48,25 @@ namespace iroha {
           rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
               blocks,
           ametsuchi::MutableStorage &storage) const = 0;
+
+      /**
+       * Validate and apply a fully downloaded window of blocks.
+       *
+       * Unlike validateAndApply, the window is verified up front - height
+       * continuity, previous hash linkage and signature supermajority -
+       * so validation of the tail does not interleave with the apply of
+       * the leading blocks and a corrupt block is rejected before
+       * anything is written.
+       * @param blocks - the downloaded window, ordered by height
+       * @param storage - storage to which the blocks are applied
+       * @return the number of leading blocks of the window which were
+       * verified and applied; equal to the window size iff the whole
+       * window was applied
+       */
+      virtual size_t validateAndApplyWindow(
+          const std::vector<std::shared_ptr<shared_model::interface::Block>>
+              &blocks,
+          ametsuchi::MutableStorage &storage) const = 0;
     };
   }  // namespace validation
 }  // namespace iroha
@@ -7,6 +7,7 @@
 
 #include <boost/algorithm/string/join.hpp>
 #include <rxcpp/rx-lite.hpp>
+#include "ametsuchi/impl/touches_peer_set.hpp"
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "consensus/yac/supermajority_checker.hpp"
@@ -35,6 +36,81 @@ namespace iroha {
                            });
     }
 
+    size_t ChainValidatorImpl::validateAndApplyWindow(
+        const std::vector<std::shared_ptr<shared_model::interface::Block>>
+            &blocks,
+        ametsuchi::MutableStorage &storage) const {
+      log_->info("validate chain window of {} blocks...", blocks.size());
+      if (blocks.empty()) {
+        return 0;
+      }
+
+      // verify the internal linkage of the window up front; the hashes are
+      // already computed on the download threads, so a corrupt or
+      // out-of-order block is rejected here before anything is applied
+      size_t verified = 1;
+      while (verified < blocks.size()
+             and validatePreviousHash(*blocks[verified],
+                                      blocks[verified - 1]->hash())
+             and validateHeight(*blocks[verified],
+                                blocks[verified - 1]->height())) {
+        ++verified;
+      }
+      if (verified < blocks.size()) {
+        log_->info("chain window linkage breaks after {} of {} blocks",
+                   verified,
+                   blocks.size());
+      }
+
+      // the ledger peer set against which supermajority is checked stays
+      // the one at the start of the window until the first block which
+      // modifies it, so that whole stable prefix can be verified in one
+      // pass once the initial ledger state is known
+      size_t stable_peers_until = 0;
+      while (stable_peers_until < verified
+             and not ametsuchi::touchesPeerSet(*blocks[stable_peers_until])) {
+        ++stable_peers_until;
+      }
+      if (stable_peers_until < verified) {
+        // peer changes take effect for the blocks after the modifying one
+        ++stable_peers_until;
+      }
+
+      size_t applied = 0;
+      size_t supermajority_verified_until = 0;
+      auto window = rxcpp::observable<>::iterate(
+          std::vector<std::shared_ptr<shared_model::interface::Block>>(
+              blocks.begin(), blocks.begin() + verified));
+      storage.apply(
+          window, [&](auto block, const auto &ledger_state) {
+            if (applied == 0) {
+              // linkage of the window onto the current top of the storage
+              if (not validatePreviousHash(
+                      *block, ledger_state.top_block_info.top_hash)
+                  or not validateHeight(*block,
+                                        ledger_state.top_block_info.height)) {
+                return false;
+              }
+              while (supermajority_verified_until < stable_peers_until
+                     and validatePeerSupermajority(
+                         *blocks[supermajority_verified_until],
+                         ledger_state.ledger_peers)) {
+                ++supermajority_verified_until;
+              }
+            }
+            // blocks behind a peer set change are verified one by one
+            // against the peer set they were actually committed under
+            if (applied >= supermajority_verified_until
+                and not validatePeerSupermajority(*block,
+                                                  ledger_state.ledger_peers)) {
+              return false;
+            }
+            ++applied;
+            return true;
+          });
+      return applied;
+    }
+
     bool ChainValidatorImpl::validatePreviousHash(
         const shared_model::interface::Block &block,
         const shared_model::interface::types::HashType &top_hash) const {
@@ -41,6 +41,11 @@ namespace iroha {
               blocks,
           ametsuchi::MutableStorage &storage) const override;
 
+      size_t validateAndApplyWindow(
+          const std::vector<std::shared_ptr<shared_model::interface::Block>>
+              &blocks,
+          ametsuchi::MutableStorage &storage) const override;
+
      private:
       /// Verifies whether previous hash of block matches top_hash
       bool validatePreviousHash(
@@ -5,40 +5,91 @@
 
 #include "validation/impl/stateful_validator_impl.hpp"
 
+#include <functional>
 #include <string>
 
 #include <boost/algorithm/cxx11/all_of.hpp>
 #include <boost/format.hpp>
-#include <boost/range/adaptor/filtered.hpp>
-#include <boost/range/adaptor/indexed.hpp>
-#include <boost/range/adaptor/transformed.hpp>
+#include <boost/optional.hpp>
+#include <boost/range/size.hpp>
 #include "common/result.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "logger/logger.hpp"
+#include "metrics/tx_latency_tracer.hpp"
+#include "validation/impl/tx_dependency_analysis.hpp"
+#include "validation/impl/verified_proposal_view.hpp"
 
 namespace iroha {
   namespace validation {
 
     /**
-     * Complements initial transaction check with command-by-command check
-     * @param temporary_wsv to apply commands on
+     * Logs the result of a transaction check
+     * @param apply_result of the transaction application
      * @param transactions_errors_log to write errors to
-     * @param tx to be checked
-     * @return empty result, if check is successful, command error otherwise
+     * @param tx which was checked
+     * @return true, if check is successful, false otherwise
      */
-    static bool checkTransactions(
-        ametsuchi::TemporaryWsv &temporary_wsv,
+    static bool checkResult(
+        expected::Result<void, validation::CommandError> apply_result,
         validation::TransactionsErrors &transactions_errors_log,
         const shared_model::interface::Transaction &tx) {
-      return temporary_wsv.apply(tx).match(
-          [](const auto &) { return true; },
-          [&tx, &transactions_errors_log](auto &&error) {
-            transactions_errors_log.emplace_back(validation::TransactionError{
-                tx.hash(), std::move(error.error)});
-            return false;
-          });
+      return std::move(apply_result)
+          .match(
+              [](const auto &) { return true; },
+              [&tx, &transactions_errors_log](auto &&error) {
+                transactions_errors_log.emplace_back(
+                    validation::TransactionError{tx.hash(),
+                                                 std::move(error.error)});
+                return false;
+              });
     };
 
+    /**
+     * Check up front, in one query, the signatures of transactions whose
+     * verification does not depend on the effects of preceding transactions
+     * of the proposal
+     * @param txs to be checked
+     * @param temporary_wsv to check signatures on
+     * @return per-transaction results in proposal order; empty optionals for
+     * transactions which have to be checked during application
+     */
+    static std::vector<
+        boost::optional<expected::Result<void, validation::CommandError>>>
+    prevalidateSignatures(
+        const shared_model::interface::types::TransactionsCollectionType &txs,
+        ametsuchi::TemporaryWsv &temporary_wsv) {
+      auto independent = signatureCheckIndependence(txs);
+      std::vector<std::reference_wrapper<
+          const shared_model::interface::Transaction>>
+          candidates;
+      std::vector<std::reference_wrapper<
+          const shared_model::interface::Transaction>>
+          all_transactions;
+      size_t index = 0;
+      for (const auto &tx : txs) {
+        all_transactions.emplace_back(tx);
+        if (independent[index++]) {
+          candidates.emplace_back(tx);
+        }
+      }
+
+      // warm up the creator accounts of the whole proposal in one round
+      // trip, including those whose checks are deferred to application time
+      temporary_wsv.prefetchSignatories(all_transactions);
+
+      std::vector<
+          boost::optional<expected::Result<void, validation::CommandError>>>
+          prechecked(independent.size());
+      auto results = temporary_wsv.validateSignatures(candidates);
+      auto result = std::make_move_iterator(results.begin());
+      for (index = 0; index < independent.size(); ++index) {
+        if (independent[index]) {
+          prechecked[index] = *result++;
+        }
+      }
+      return prechecked;
+    }
+
     /**
      * Validate all transactions supplied; includes special rules, such as batch
      * validation etc
@@ -46,9 +97,10 @@ namespace iroha {
      * @param temporary_wsv to apply transactions on
      * @param transactions_errors_log to write errors to
      * @param batch_parser to parse batches from transaction range
-     * @return range of transactions, which passed stateful validation
+     * @return positions of transactions, which passed stateful validation,
+     * in proposal order
      */
-    static auto validateTransactions(
+    static std::vector<size_t> validateTransactions(
         const shared_model::interface::types::TransactionsCollectionType &txs,
         ametsuchi::TemporaryWsv &temporary_wsv,
         validation::TransactionsErrors &transactions_errors_log,
@@ -56,9 +108,25 @@ namespace iroha {
       std::vector<bool> validation_results;
       validation_results.reserve(boost::size(txs));
 
+      auto prechecked = prevalidateSignatures(txs, temporary_wsv);
+
+      size_t batch_start = 0;
       for (auto batch : batch_parser.parseBatches(txs)) {
+        size_t batch_offset = 0;
         auto validation = [&](auto &tx) {
-          return checkTransactions(temporary_wsv, transactions_errors_log, tx);
+          auto index = batch_start + batch_offset++;
+          if (prechecked[index]) {
+            if (expected::hasError(*prechecked[index])) {
+              // reject the transaction without applying it
+              return checkResult(
+                  std::move(*prechecked[index]), transactions_errors_log, tx);
+            }
+            return checkResult(temporary_wsv.applyPrevalidated(tx),
+                               transactions_errors_log,
+                               tx);
+          }
+          return checkResult(
+              temporary_wsv.apply(tx), transactions_errors_log, tx);
         };
         if (batch.front().batchMeta()
             and batch.front().batchMeta()->get()->type()
@@ -98,52 +166,60 @@ namespace iroha {
             validation_results.push_back(validation(tx));
           }
         }
+        batch_start += boost::size(batch);
       }
 
-      return txs | boost::adaptors::indexed()
-          | boost::adaptors::filtered(
-                 [validation_results =
-                      std::move(validation_results)](const auto &el) {
-                   return validation_results.at(el.index());
-                 })
-          | boost::adaptors::transformed(
-                 [](const auto &el) -> decltype(auto) { return el.value(); });
+      std::vector<size_t> accepted_indices;
+      accepted_indices.reserve(validation_results.size());
+      for (size_t index = 0; index < validation_results.size(); ++index) {
+        if (validation_results[index]) {
+          accepted_indices.push_back(index);
+        }
+      }
+      return accepted_indices;
     }
 
     StatefulValidatorImpl::StatefulValidatorImpl(
-        std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory,
         std::shared_ptr<shared_model::interface::TransactionBatchParser>
             batch_parser,
         logger::LoggerPtr log)
-        : factory_(std::move(factory)),
-          batch_parser_(std::move(batch_parser)),
-          log_(std::move(log)) {}
+        : batch_parser_(std::move(batch_parser)),
+          log_(std::move(log)),
+          validation_duration_(
+              metrics::MetricsRegistry::instance().makeHistogram(
+                  "iroha_stateful_validation_duration_seconds",
+                  "Time spent on stateful validation of one proposal",
+                  metrics::Histogram::defaultDurationBounds())) {}
 
     std::unique_ptr<validation::VerifiedProposalAndErrors>
     StatefulValidatorImpl::validate(
-        const shared_model::interface::Proposal &proposal,
+        std::shared_ptr<const shared_model::interface::Proposal> proposal,
         ametsuchi::TemporaryWsv &temporaryWsv) {
+      const auto start = std::chrono::steady_clock::now();
       log_->info("transactions in proposal: {}",
-                 proposal.transactions().size());
+                 proposal->transactions().size());
 
       auto validation_result = std::make_unique<VerifiedProposalAndErrors>();
-      auto valid_txs =
-          validateTransactions(proposal.transactions(),
+      auto accepted_indices =
+          validateTransactions(proposal->transactions(),
                                temporaryWsv,
                                validation_result->rejected_transactions,
                                *batch_parser_);
 
-      // Since proposal came from ordering gate it was already validated.
-      // All transactions are validated as well
-      // This allows for unsafe construction of proposal
+      // the view shares the proposal which came from the ordering gate
+      // instead of copying the accepted transactions into a new one
       validation_result->verified_proposal =
-          std::const_pointer_cast<const shared_model::interface::Proposal>(
-              std::shared_ptr<shared_model::interface::Proposal>(
-                  factory_->unsafeCreateProposal(
-                      proposal.height(), proposal.createdTime(), valid_txs)));
+          std::make_shared<const VerifiedProposalView>(
+              std::move(proposal), std::move(accepted_indices));
 
       log_->info("transactions in verified proposal: {}",
                  validation_result->verified_proposal->transactions().size());
+      for (const auto &tx :
+           validation_result->verified_proposal->transactions()) {
+        metrics::TxLatencyTracer::instance().recordStage(
+            tx.hash().hex(), metrics::TxStage::kVerifiedProposal);
+      }
+      validation_duration_->observeSince(start);
       return validation_result;
     }
   }  // namespace validation
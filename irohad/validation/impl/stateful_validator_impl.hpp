@@ -9,8 +9,8 @@
 #include "validation/stateful_validator.hpp"
 
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
-#include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "metrics/metrics_registry.hpp"
 
 namespace iroha {
   namespace validation {
@@ -21,21 +21,20 @@ namespace iroha {
     class StatefulValidatorImpl : public StatefulValidator {
      public:
       StatefulValidatorImpl(
-          std::unique_ptr<shared_model::interface::UnsafeProposalFactory>
-              factory,
           std::shared_ptr<shared_model::interface::TransactionBatchParser>
               batch_parser,
           logger::LoggerPtr log);
 
       std::unique_ptr<validation::VerifiedProposalAndErrors> validate(
-          const shared_model::interface::Proposal &proposal,
+          std::shared_ptr<const shared_model::interface::Proposal> proposal,
           ametsuchi::TemporaryWsv &temporaryWsv) override;
 
      private:
-      std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory_;
       std::shared_ptr<shared_model::interface::TransactionBatchParser>
           batch_parser_;
       logger::LoggerPtr log_;
+      /// duration of validating one proposal, exposed to the scraper
+      std::shared_ptr<iroha::metrics::Histogram> validation_duration_;
     };
 
   }  // namespace validation
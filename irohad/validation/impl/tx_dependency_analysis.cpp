@@ -0,0 +1,60 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/tx_dependency_analysis.hpp"
+
+#include <unordered_set>
+
+#include <boost/range/size.hpp>
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace validation {
+
+    std::vector<bool> signatureCheckIndependence(
+        const shared_model::interface::types::TransactionsCollectionType
+            &txs) {
+      std::vector<bool> independent;
+      independent.reserve(boost::size(txs));
+      // accounts whose signatory set or quorum is written by a preceding
+      // transaction of the proposal
+      std::unordered_set<std::string> written_accounts;
+      for (const auto &tx : txs) {
+        independent.push_back(written_accounts.count(tx.creatorAccountId())
+                              == 0);
+        for (const auto &command : tx.commands()) {
+          iroha::visit_in_place(
+              command.get(),
+              [&written_accounts](
+                  const shared_model::interface::AddSignatory &cmd) {
+                written_accounts.insert(cmd.accountId());
+              },
+              [&written_accounts](
+                  const shared_model::interface::RemoveSignatory &cmd) {
+                written_accounts.insert(cmd.accountId());
+              },
+              [&written_accounts](
+                  const shared_model::interface::SetQuorum &cmd) {
+                written_accounts.insert(cmd.accountId());
+              },
+              [&written_accounts](
+                  const shared_model::interface::CreateAccount &cmd) {
+                written_accounts.insert(cmd.accountName() + "@"
+                                        + cmd.domainId());
+              },
+              [](const auto &) {});
+        }
+      }
+      return independent;
+    }
+
+  }  // namespace validation
+}  // namespace iroha
@@ -0,0 +1,34 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TX_DEPENDENCY_ANALYSIS_HPP
+#define IROHA_TX_DEPENDENCY_ANALYSIS_HPP
+
+#include <vector>
+
+#include "interfaces/common_objects/range_types.hpp"
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Tell for each transaction of a proposal whether its signature
+     * verification reads only the state before the proposal. The
+     * verification reads the signatory set and the quorum of the creator
+     * account, so a transaction depends on a preceding one iff that one
+     * writes them: AddSignatory, RemoveSignatory or SetQuorum targeting the
+     * creator, or CreateAccount creating it. Independent verifications may
+     * be checked against the base state in one batch before any transaction
+     * of the proposal is executed.
+     * @param txs proposal transactions, in proposal order
+     * @return flags in the same order, true for independent transactions
+     */
+    std::vector<bool> signatureCheckIndependence(
+        const shared_model::interface::types::TransactionsCollectionType &txs);
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_TX_DEPENDENCY_ANALYSIS_HPP
@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/default_constructible_unary_fn.hpp"  // non-copyable value workaround
+
+#include "validation/impl/verified_proposal_view.hpp"
+
+#include <boost/range/adaptor/transformed.hpp>
+
+namespace iroha {
+  namespace validation {
+
+    VerifiedProposalView::VerifiedProposalView(
+        std::shared_ptr<const shared_model::interface::Proposal> source,
+        std::vector<size_t> accepted_indices)
+        : source_(std::move(source)),
+          source_transactions_(source_->transactions()),
+          accepted_indices_(std::move(accepted_indices)) {}
+
+    shared_model::interface::types::TransactionsCollectionType
+    VerifiedProposalView::transactions() const {
+      return accepted_indices_
+          | boost::adaptors::transformed(
+                 [this](size_t index) -> shared_model::interface::Transaction & {
+                   return source_transactions_[index];
+                 });
+    }
+
+    shared_model::interface::types::HeightType VerifiedProposalView::height()
+        const {
+      return source_->height();
+    }
+
+    shared_model::interface::types::TimestampType
+    VerifiedProposalView::createdTime() const {
+      return source_->createdTime();
+    }
+
+    const shared_model::interface::types::BlobType &VerifiedProposalView::blob()
+        const {
+      return source_->blob();
+    }
+
+    const shared_model::interface::types::HashType &VerifiedProposalView::hash()
+        const {
+      return source_->hash();
+    }
+
+  }  // namespace validation
+}  // namespace iroha
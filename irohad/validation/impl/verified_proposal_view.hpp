@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_VERIFIED_PROPOSAL_VIEW_HPP
+#define IROHA_VERIFIED_PROPOSAL_VIEW_HPP
+
+#include <memory>
+#include <vector>
+
+#include "interfaces/iroha_internal/proposal.hpp"
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Immutable view of a proposal restricted to the transactions which
+     * passed stateful validation. Shares the source proposal instead of
+     * copying the accepted transactions into a new one, so the handoff from
+     * the ordering gate through the simulator is allocation-free.
+     *
+     * blob() and hash() are forwarded to the source proposal: the hash
+     * identifies the ordering round's proposal in consensus votes, while
+     * the validated content is covered by the hash of the block built from
+     * transactions().
+     */
+    class VerifiedProposalView final : public shared_model::interface::Proposal {
+     public:
+      /**
+       * @param source the proposal the view is restricted from
+       * @param accepted_indices positions of the transactions which passed
+       * stateful validation, in proposal order
+       */
+      VerifiedProposalView(
+          std::shared_ptr<const shared_model::interface::Proposal> source,
+          std::vector<size_t> accepted_indices);
+
+      shared_model::interface::types::TransactionsCollectionType transactions()
+          const override;
+
+      shared_model::interface::types::HeightType height() const override;
+
+      shared_model::interface::types::TimestampType createdTime()
+          const override;
+
+      const shared_model::interface::types::BlobType &blob() const override;
+
+      const shared_model::interface::types::HashType &hash() const override;
+
+     private:
+      std::shared_ptr<const shared_model::interface::Proposal> source_;
+      shared_model::interface::types::TransactionsCollectionType
+          source_transactions_;
+      std::vector<size_t> accepted_indices_;
+    };
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_VERIFIED_PROPOSAL_VIEW_HPP
@@ -25,7 +25,8 @@ namespace iroha {
       /**
        * Function perform stateful validation on proposal
        * and return proposal with valid transactions
-       * @param proposal - proposal for validation
+       * @param proposal - shared proposal for validation; the returned
+       * verified proposal may share it instead of copying the transactions
        * @param wsv  - temporary wsv for validation,
        * this wsv not affected on ledger,
        * all changes after removing wsv will be ignored
@@ -33,7 +34,7 @@ namespace iroha {
        * a process of validating
        */
       virtual std::unique_ptr<VerifiedProposalAndErrors> validate(
-          const shared_model::interface::Proposal &proposal,
+          std::shared_ptr<const shared_model::interface::Proposal> proposal,
           ametsuchi::TemporaryWsv &temporaryWsv) = 0;
     };
   }  // namespace validation
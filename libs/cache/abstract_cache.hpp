@@ -69,6 +69,16 @@ namespace iroha {
         return constUnderlying().findItemImpl(key);
       }
 
+      /**
+       * Iterate over the cached values under a shared lock.
+       * @param func - callback taking ValueType const &
+       */
+      template <typename Func>
+      void forEach(Func &&func) const {
+        std::shared_lock<std::shared_timed_mutex> lock(access_mutex_);
+        constUnderlying().forEachImpl(std::forward<Func>(func));
+      }
+
      private:
       const T &constUnderlying() const {
         return static_cast<const T &>(*this);
@@ -0,0 +1,118 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOOM_FILTER_HPP
+#define IROHA_BLOOM_FILTER_HPP
+
+#include <atomic>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace iroha {
+  namespace cache {
+
+    /**
+     * Sharded bloom filter for membership pre-checks on hot paths.
+     *
+     * A negative answer is definitive, a positive answer may be a false
+     * positive and must be confirmed by the authoritative source. Keys are
+     * spread over independent shards to keep concurrent insertions from
+     * contending on the same cache lines; the bit arrays use relaxed atomics,
+     * so lookups and insertions are safe from any thread without locks.
+     *
+     * @tparam KeyType - type of the stored keys
+     * @tparam KeyHasher - type producing a size_t digest of a key; probe
+     * positions are derived from it by double hashing, which is adequate
+     * when the digest is well distributed (e.g. keys are already
+     * cryptographic hashes)
+     * @tparam kShards - number of independent shards
+     */
+    template <typename KeyType,
+              typename KeyHasher = std::hash<KeyType>,
+              size_t kShards = 16>
+    class BloomFilter {
+     public:
+      /// number of bits probed per key
+      static constexpr size_t kProbes = 4;
+
+      /**
+       * @param bits_per_shard - size of each shard's bit array; the default
+       * of 2^23 bits (1 MiB) per shard keeps the false positive rate under
+       * 1% up to ~10M keys per shard
+       */
+      explicit BloomFilter(size_t bits_per_shard = (1u << 23))
+          : bits_per_shard_(bits_per_shard) {
+        for (auto &shard : shards_) {
+          shard = std::make_unique<std::atomic<uint64_t>[]>(wordCount());
+          clearShard(shard.get());
+        }
+      }
+
+      void add(const KeyType &key) {
+        const auto h1 = hasher_(key);
+        const auto h2 = mix(h1);
+        auto *shard = shards_[h1 % kShards].get();
+        for (size_t i = 0; i < kProbes; ++i) {
+          const auto bit = (h1 + i * h2) % bits_per_shard_;
+          shard[bit / 64].fetch_or(uint64_t{1} << (bit % 64),
+                                   std::memory_order_relaxed);
+        }
+      }
+
+      /**
+       * @return false if the key was definitely never added, true if it may
+       * have been
+       */
+      bool maybeContains(const KeyType &key) const {
+        const auto h1 = hasher_(key);
+        const auto h2 = mix(h1);
+        const auto *shard = shards_[h1 % kShards].get();
+        for (size_t i = 0; i < kProbes; ++i) {
+          const auto bit = (h1 + i * h2) % bits_per_shard_;
+          if (not(shard[bit / 64].load(std::memory_order_relaxed)
+                  & (uint64_t{1} << (bit % 64)))) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      void clear() {
+        for (auto &shard : shards_) {
+          clearShard(shard.get());
+        }
+      }
+
+     private:
+      size_t wordCount() const {
+        return (bits_per_shard_ + 63) / 64;
+      }
+
+      void clearShard(std::atomic<uint64_t> *shard) {
+        for (size_t i = 0; i < wordCount(); ++i) {
+          shard[i].store(0, std::memory_order_relaxed);
+        }
+      }
+
+      /// finalizer from splitmix64, decorrelates the second probe offset
+      static uint64_t mix(uint64_t x) {
+        x += 0x9e3779b97f4a7c15ull;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+      }
+
+      const size_t bits_per_shard_;
+      std::array<std::unique_ptr<std::atomic<uint64_t>[]>, kShards> shards_;
+      KeyHasher hasher_;
+    };
+
+  }  // namespace cache
+}  // namespace iroha
+
+#endif  // IROHA_BLOOM_FILTER_HPP
@@ -95,6 +95,13 @@ namespace iroha {
         }
       }
 
+      template <typename Func>
+      void forEachImpl(Func &&func) const {
+        for (auto const &key_and_handle : keys_) {
+          func(values_.getItem(key_and_handle.second).value);
+        }
+      }
+
      private:
       KeyValuesBuffer keys_;
       ValuesBuffer values_;
@@ -0,0 +1,117 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARDED_CACHE_HPP
+#define IROHA_SHARDED_CACHE_HPP
+
+#include "cache/cache.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <utility>
+
+namespace iroha {
+  namespace cache {
+
+    /**
+     * Concurrent cache which splits the keys over independently locked
+     * shards, so that accesses to different keys do not contend on one
+     * mutex. Entries can additionally expire after a time-to-live, and
+     * hit and miss counts are kept for monitoring. Every entry carries
+     * its full key and a lookup compares it, so a key-hash collision
+     * reads as a miss - never as the value cached under another key.
+     * @tparam KeyType type of cache keys
+     * @tparam ValueType type of cache values
+     * @tparam KeyHash hasher for keys, also used to pick the shard
+     * @tparam ShardCount number of independently locked shards
+     * @tparam Count capacity of every shard
+     */
+    template <typename KeyType,
+              typename ValueType,
+              typename KeyHash = std::hash<KeyType>,
+              size_t ShardCount = 16,
+              size_t Count = 20000ull / ShardCount>
+    class ShardedCache final {
+      using Clock = std::chrono::steady_clock;
+
+      /// the underlying Cache indexes entries by the key hash alone, so
+      /// the key is stored with the value and checked on lookup
+      struct Entry {
+        KeyType key;
+        ValueType value;
+        Clock::time_point expires_at;
+      };
+      using Shard = Cache<KeyType, Entry, KeyHash, Count>;
+
+     public:
+      /// @param ttl entry lifetime; zero means entries do not expire
+      explicit ShardedCache(Clock::duration ttl = Clock::duration::zero())
+          : ttl_(ttl) {}
+
+      void addItem(const KeyType &key, const ValueType &value) {
+        shards_[shardOf(key)].addItem(key,
+                                      Entry{key, value, Clock::now() + ttl_});
+      }
+
+      boost::optional<ValueType> findItem(const KeyType &key) const {
+        auto entry = shards_[shardOf(key)].findItem(key);
+        if (entry and entry->key == key
+            and (ttl_ == Clock::duration::zero()
+                 or Clock::now() < entry->expires_at)) {
+          hits_.fetch_add(1, std::memory_order_relaxed);
+          return entry->value;
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return boost::none;
+      }
+
+      uint64_t getHitCount() const {
+        return hits_.load(std::memory_order_relaxed);
+      }
+
+      uint64_t getMissCount() const {
+        return misses_.load(std::memory_order_relaxed);
+      }
+
+      uint32_t getCacheItemCount() const {
+        uint32_t count = 0;
+        for (const auto &shard : shards_) {
+          count += shard.getCacheItemCount();
+        }
+        return count;
+      }
+
+      /**
+       * Iterate over the currently valid cached values, shard by shard,
+       * under the shard locks.
+       * @param func - callback taking ValueType const &
+       */
+      template <typename Func>
+      void forEach(Func &&func) const {
+        const auto now = Clock::now();
+        for (const auto &shard : shards_) {
+          shard.forEach([&](const Entry &entry) {
+            if (ttl_ == Clock::duration::zero() or now < entry.expires_at) {
+              func(entry.value);
+            }
+          });
+        }
+      }
+
+     private:
+      size_t shardOf(const KeyType &key) const {
+        return KeyHash()(key) % ShardCount;
+      }
+
+      Clock::duration ttl_;
+      mutable std::atomic<uint64_t> hits_{0};
+      mutable std::atomic<uint64_t> misses_{0};
+      std::array<Shard, ShardCount> shards_;
+    };
+  }  // namespace cache
+}  // namespace iroha
+
+#endif  // IROHA_SHARDED_CACHE_HPP
@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/async_disposer.hpp"
+
+namespace iroha {
+
+  AsyncDisposer::AsyncDisposer() : worker_([this] { run(); }) {}
+
+  AsyncDisposer::~AsyncDisposer() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    worker_cv_.notify_one();
+    worker_.join();
+  }
+
+  void AsyncDisposer::enqueue(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back(std::move(task));
+    }
+    worker_cv_.notify_one();
+  }
+
+  void AsyncDisposer::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      worker_cv_.wait(lock, [this] { return stop_ or not queue_.empty(); });
+      if (queue_.empty()) {
+        break;
+      }
+      {
+        auto task = std::move(queue_.front());
+        queue_.pop_front();
+        lock.unlock();
+        // the capture of the task is destroyed when it leaves this scope,
+        // outside of the lock
+      }
+      lock.lock();
+    }
+  }
+
+}  // namespace iroha
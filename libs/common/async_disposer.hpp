@@ -0,0 +1,54 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_DISPOSER_HPP
+#define IROHA_ASYNC_DISPOSER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace iroha {
+
+  /**
+   * Single background thread which destroys retired objects, so that
+   * releasing large containers - per-round proposal maps, erased batch
+   * sets - does not run on a latency-sensitive thread or inside a locked
+   * section. The handed-over object owns all its data; the disposer never
+   * touches the donor again.
+   */
+  class AsyncDisposer {
+   public:
+    AsyncDisposer();
+
+    AsyncDisposer(const AsyncDisposer &) = delete;
+    AsyncDisposer &operator=(const AsyncDisposer &) = delete;
+
+    /// Destroys all pending objects and stops the worker.
+    ~AsyncDisposer();
+
+    /// Schedule destruction of the given object on the disposer thread.
+    template <typename T>
+    void dispose(T &&object) {
+      enqueue([retired = std::forward<T>(object)] {});
+    }
+
+   private:
+    void enqueue(std::function<void()> task);
+
+    void run();
+
+    std::mutex mutex_;
+    std::condition_variable worker_cv_;
+    std::deque<std::function<void()>> queue_;
+    bool stop_{false};
+    std::thread worker_;
+  };
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_DISPOSER_HPP
@@ -23,8 +23,28 @@ namespace {
           fmt::format("File '{}' could not be read.", path.string()));
     }
 
-    T contents((std::istreambuf_iterator<char>(file)),
-               std::istreambuf_iterator<char>());
+    // size the buffer up front and read in bulk instead of growing the
+    // container character by character through istreambuf_iterator - large
+    // inputs such as genesis blocks reallocate many times otherwise
+    file.seekg(0, std::ios_base::end);
+    const auto file_end = file.tellg();
+    if (file_end == decltype(file_end)(-1)) {
+      return iroha::expected::makeError(
+          fmt::format("Size of file '{}' could not be determined.",
+                      path.string()));
+    }
+    file.seekg(0, std::ios_base::beg);
+
+    T contents;
+    contents.resize(static_cast<size_t>(file_end));
+    file.read(reinterpret_cast<char *>(contents.data()), contents.size());
+    if (file.bad()) {
+      return iroha::expected::makeError(
+          fmt::format("File '{}' could not be read.", path.string()));
+    }
+    // in text mode newline translation may shrink the payload below the
+    // on-disk size
+    contents.resize(static_cast<size_t>(file.gcount()));
     return iroha::expected::makeValue(std::move(contents));
   }
 }  // namespace
@@ -5,16 +5,205 @@
 #ifndef IROHA_HEXUTILS_HPP
 #define IROHA_HEXUTILS_HPP
 
+#include <array>
+#include <cstdint>
 #include <iterator>
 #include <string>
 
-#include <boost/algorithm/hex.hpp>
+#if defined(__AVX2__) or defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+
 #include <boost/optional.hpp>
 #include "common/result.hpp"
 #include "interfaces/common_objects/byte_range.hpp"
 
 namespace iroha {
 
+  namespace detail {
+    /// lowercase hex digit per nibble value
+    constexpr char kHexDigits[] = "0123456789abcdef";
+
+    /// 0xff marks characters which are not hex digits
+    constexpr uint8_t kInvalidNibble = 0xff;
+
+    constexpr std::array<uint8_t, 256> makeHexDecodeTable() {
+      std::array<uint8_t, 256> table{};
+      for (auto &entry : table) {
+        entry = kInvalidNibble;
+      }
+      for (uint8_t i = 0; i < 10; ++i) {
+        table['0' + i] = i;
+      }
+      for (uint8_t i = 0; i < 6; ++i) {
+        table['a' + i] = 10 + i;
+        table['A' + i] = 10 + i;
+      }
+      return table;
+    }
+
+    constexpr std::array<uint8_t, 256> kHexDecodeTable = makeHexDecodeTable();
+
+#if defined(__AVX2__)
+    /**
+     * Encode a prefix of the input to hex with vector nibble lookups, 32
+     * input bytes per step. @return the number of input bytes consumed,
+     * the tail is left to the scalar loop of the caller.
+     */
+    inline size_t bytestringToHexstringSimd(const uint8_t *input,
+                                            size_t size,
+                                            char *out) {
+      const auto digits = _mm256_broadcastsi128_si256(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(kHexDigits)));
+      const auto low_nibble = _mm256_set1_epi8(0x0f);
+      size_t done = 0;
+      for (; done + 32 <= size; done += 32) {
+        const auto chunk = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(input + done));
+        const auto hi =
+            _mm256_and_si256(_mm256_srli_epi16(chunk, 4), low_nibble);
+        const auto lo = _mm256_and_si256(chunk, low_nibble);
+        // unpack interleaves within the two 128-bit lanes, the permutes
+        // restore the byte order across them
+        const auto unpacked_lo = _mm256_unpacklo_epi8(hi, lo);
+        const auto unpacked_hi = _mm256_unpackhi_epi8(hi, lo);
+        const auto first =
+            _mm256_permute2x128_si256(unpacked_lo, unpacked_hi, 0x20);
+        const auto second =
+            _mm256_permute2x128_si256(unpacked_lo, unpacked_hi, 0x31);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 2 * done),
+                            _mm256_shuffle_epi8(digits, first));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 2 * done + 32),
+                            _mm256_shuffle_epi8(digits, second));
+      }
+      return done;
+    }
+#elif defined(__SSSE3__)
+    /**
+     * Encode a prefix of the input to hex with vector nibble lookups, 16
+     * input bytes per step. @return the number of input bytes consumed,
+     * the tail is left to the scalar loop of the caller.
+     */
+    inline size_t bytestringToHexstringSimd(const uint8_t *input,
+                                            size_t size,
+                                            char *out) {
+      const auto digits =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(kHexDigits));
+      const auto low_nibble = _mm_set1_epi8(0x0f);
+      size_t done = 0;
+      for (; done + 16 <= size; done += 16) {
+        const auto chunk =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + done));
+        const auto hi = _mm_and_si128(_mm_srli_epi16(chunk, 4), low_nibble);
+        const auto lo = _mm_and_si128(chunk, low_nibble);
+        const auto first = _mm_unpacklo_epi8(hi, lo);
+        const auto second = _mm_unpackhi_epi8(hi, lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * done),
+                         _mm_shuffle_epi8(digits, first));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * done + 16),
+                         _mm_shuffle_epi8(digits, second));
+      }
+      return done;
+    }
+#endif
+
+#if defined(__AVX2__)
+    /**
+     * Decode a prefix of the hex input, 32 characters to 16 bytes per
+     * step. Stops at the first chunk holding a non-hex character.
+     * @param input - hex characters, 2 * out_size of them
+     * @param out_size - size of the decoded output
+     * @return the number of bytes decoded, the tail (and the error
+     * reporting on invalid input) is left to the scalar loop of the
+     * caller.
+     */
+    inline size_t hexstringToBytestringSimd(const char *input,
+                                            size_t out_size,
+                                            uint8_t *out) {
+      const auto before_zero = _mm256_set1_epi8('0' - 1);
+      const auto after_nine = _mm256_set1_epi8('9' + 1);
+      const auto before_a = _mm256_set1_epi8('a' - 1);
+      const auto after_f = _mm256_set1_epi8('f' + 1);
+      const auto to_lower = _mm256_set1_epi8(0x20);
+      // 16 * high nibble character value + low nibble character value
+      const auto nibble_weights = _mm256_set1_epi16(0x0110);
+      size_t done = 0;
+      for (; done + 16 <= out_size; done += 16) {
+        const auto chunk = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i *>(input + 2 * done));
+        const auto lower = _mm256_or_si256(chunk, to_lower);
+        const auto is_digit =
+            _mm256_and_si256(_mm256_cmpgt_epi8(chunk, before_zero),
+                             _mm256_cmpgt_epi8(after_nine, chunk));
+        const auto is_alpha =
+            _mm256_and_si256(_mm256_cmpgt_epi8(lower, before_a),
+                             _mm256_cmpgt_epi8(after_f, lower));
+        const auto valid = _mm256_or_si256(is_digit, is_alpha);
+        if (_mm256_movemask_epi8(valid) != -1) {
+          break;
+        }
+        const auto digit_values =
+            _mm256_sub_epi8(chunk, _mm256_set1_epi8('0'));
+        const auto alpha_values =
+            _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10));
+        const auto nibbles =
+            _mm256_blendv_epi8(digit_values, alpha_values, is_alpha);
+        const auto bytes = _mm256_maddubs_epi16(nibbles, nibble_weights);
+        // pack duplicates each lane result, the permute compacts the two
+        // lanes into the lower half
+        const auto packed = _mm256_permute4x64_epi64(
+            _mm256_packus_epi16(bytes, bytes), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + done),
+                         _mm256_castsi256_si128(packed));
+      }
+      return done;
+    }
+#elif defined(__SSE4_1__)
+    /**
+     * Decode a prefix of the hex input, 16 characters to 8 bytes per
+     * step. Stops at the first chunk holding a non-hex character.
+     * @param input - hex characters, 2 * out_size of them
+     * @param out_size - size of the decoded output
+     * @return the number of bytes decoded, the tail (and the error
+     * reporting on invalid input) is left to the scalar loop of the
+     * caller.
+     */
+    inline size_t hexstringToBytestringSimd(const char *input,
+                                            size_t out_size,
+                                            uint8_t *out) {
+      const auto before_zero = _mm_set1_epi8('0' - 1);
+      const auto after_nine = _mm_set1_epi8('9' + 1);
+      const auto before_a = _mm_set1_epi8('a' - 1);
+      const auto after_f = _mm_set1_epi8('f' + 1);
+      const auto to_lower = _mm_set1_epi8(0x20);
+      // 16 * high nibble character value + low nibble character value
+      const auto nibble_weights = _mm_set1_epi16(0x0110);
+      size_t done = 0;
+      for (; done + 8 <= out_size; done += 8) {
+        const auto chunk = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(input + 2 * done));
+        const auto lower = _mm_or_si128(chunk, to_lower);
+        const auto is_digit = _mm_and_si128(_mm_cmpgt_epi8(chunk, before_zero),
+                                            _mm_cmpgt_epi8(after_nine, chunk));
+        const auto is_alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, before_a),
+                                            _mm_cmpgt_epi8(after_f, lower));
+        const auto valid = _mm_or_si128(is_digit, is_alpha);
+        if (_mm_movemask_epi8(valid) != 0xffff) {
+          break;
+        }
+        const auto digit_values = _mm_sub_epi8(chunk, _mm_set1_epi8('0'));
+        const auto alpha_values = _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10));
+        const auto nibbles =
+            _mm_blendv_epi8(digit_values, alpha_values, is_alpha);
+        const auto bytes = _mm_maddubs_epi16(nibbles, nibble_weights);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + done),
+                         _mm_packus_epi16(bytes, bytes));
+      }
+      return done;
+    }
+#endif
+  }  // namespace detail
+
   template <typename Container>
   inline auto hexstringToBytestringSize(Container const &c)
       -> decltype(c.size()) {
@@ -38,9 +227,21 @@ namespace iroha {
       OutputContainer &destination) {
     static_assert(sizeof(*input.data()) == sizeof(uint8_t), "type mismatch");
     const auto beg = reinterpret_cast<const uint8_t *>(input.data());
-    const auto end = beg + input.size();
-    destination.reserve(destination.size() + bytestringToHexstringSize(input));
-    boost::algorithm::hex_lower(beg, end, std::back_inserter(destination));
+    const auto offset = destination.size();
+    destination.resize(offset + bytestringToHexstringSize(input));
+    // branch-free table lookups instead of a general-purpose encoder: hex
+    // conversion sits on the commit path for every hash, pubkey and
+    // signature
+    auto *out = &destination[offset];
+    size_t i = 0;
+#if defined(__AVX2__) or defined(__SSSE3__)
+    i = detail::bytestringToHexstringSimd(beg, input.size(), out);
+    out += 2 * i;
+#endif
+    for (; i < input.size(); ++i) {
+      *out++ = detail::kHexDigits[beg[i] >> 4];
+      *out++ = detail::kHexDigits[beg[i] & 0x0f];
+    }
   }
 
   /**
@@ -71,12 +272,21 @@ namespace iroha {
       return makeError("Hex string contains uneven number of characters.");
     }
     std::string result;
-    result.reserve(hexstringToBytestringSize(str));
-    try {
-      boost::algorithm::unhex(
-          str.begin(), str.end(), std::back_inserter(result));
-    } catch (const boost::algorithm::hex_decode_error &e) {
-      return makeError(e.what());
+    result.resize(hexstringToBytestringSize(str));
+    size_t i = 0;
+#if defined(__AVX2__) or defined(__SSE4_1__)
+    i = detail::hexstringToBytestringSimd(
+        str.data(), result.size(), reinterpret_cast<uint8_t *>(&result[0]));
+#endif
+    for (; i < result.size(); ++i) {
+      const uint8_t high =
+          detail::kHexDecodeTable[static_cast<uint8_t>(str[2 * i])];
+      const uint8_t low =
+          detail::kHexDecodeTable[static_cast<uint8_t>(str[2 * i + 1])];
+      if ((high | low) == detail::kInvalidNibble) {
+        return makeError("Invalid hex character.");
+      }
+      result[i] = static_cast<char>((high << 4) | low);
     }
     return iroha::expected::makeValue(std::move(result));
   }
@@ -0,0 +1,35 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/interned_string.hpp"
+
+#include <array>
+#include <mutex>
+#include <unordered_set>
+
+namespace {
+  constexpr size_t kShardCount = 16;
+
+  struct Shard {
+    std::mutex mutex;
+    // node-based, so element addresses survive rehashing
+    std::unordered_set<std::string> values;
+  };
+
+  Shard &shardFor(const std::string &value) {
+    static std::array<Shard, kShardCount> shards;
+    return shards[std::hash<std::string>{}(value) % kShardCount];
+  }
+}  // namespace
+
+namespace iroha {
+
+  InternedString::InternedString(const std::string &value) {
+    auto &shard = shardFor(value);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    value_ = &*shard.values.insert(value).first;
+  }
+
+}  // namespace iroha
@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_INTERNED_STRING_HPP
+#define IROHA_INTERNED_STRING_HPP
+
+#include <functional>
+#include <string>
+
+namespace iroha {
+
+  /**
+   * Handle to a string interned in a process-wide sharded pool. Interning
+   * the same value twice yields handles pointing at the same storage, so
+   * equality is a pointer comparison and hashing hashes the pointer
+   * instead of the characters. Intended for ledger identifiers (account,
+   * asset and domain ids), which repeat across the transactions of a
+   * block by design: containers keyed by them become cheaper and the
+   * per-command key copies collapse into one allocation per distinct
+   * identifier.
+   *
+   * The pool only grows; its size is bounded by the set of distinct
+   * identifiers ever seen, which for a ledger is bounded by the world
+   * state. Interning is thread safe, sharded to keep writers from
+   * contending on one lock.
+   */
+  class InternedString {
+   public:
+    /// intern the value, copying it into the pool only on first sight
+    explicit InternedString(const std::string &value);
+
+    /// the interned value; the reference stays valid for process lifetime
+    const std::string &str() const {
+      return *value_;
+    }
+
+    operator const std::string &() const {
+      return *value_;
+    }
+
+    bool operator==(const InternedString &rhs) const {
+      return value_ == rhs.value_;
+    }
+
+    bool operator!=(const InternedString &rhs) const {
+      return value_ != rhs.value_;
+    }
+
+   private:
+    friend struct std::hash<InternedString>;
+
+    const std::string *value_;
+  };
+
+}  // namespace iroha
+
+namespace std {
+  template <>
+  struct hash<iroha::InternedString> {
+    size_t operator()(const iroha::InternedString &value) const {
+      return hash<const string *>{}(value.value_);
+    }
+  };
+}  // namespace std
+
+#endif  // IROHA_INTERNED_STRING_HPP
@@ -0,0 +1,89 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_LOCKFREE_STAGING_QUEUE_HPP
+#define IROHA_COMMON_LOCKFREE_STAGING_QUEUE_HPP
+
+#include <atomic>
+#include <utility>
+
+namespace iroha {
+  namespace containers {
+    /**
+     * Unbounded multi-producer staging queue. Producers push with a single
+     * CAS and never block each other; consumers take the whole staged
+     * portion at once with an atomic exchange, so concurrent drains receive
+     * disjoint portions. Elements of one drained portion are delivered in
+     * push order.
+     * @tparam T - type of element of the queue
+     */
+    template <typename T>
+    class LockFreeStagingQueue final {
+     public:
+      using Type = T;
+
+      LockFreeStagingQueue() = default;
+      LockFreeStagingQueue(LockFreeStagingQueue const &) = delete;
+      LockFreeStagingQueue &operator=(LockFreeStagingQueue const &) = delete;
+
+      ~LockFreeStagingQueue() {
+        drain([](Type &&) {});
+      }
+
+      /// Stage a value. Wait-free except for CAS retries under contention.
+      void push(Type value) {
+        auto *node =
+            new Node{std::move(value), head_.load(std::memory_order_relaxed)};
+        while (not head_.compare_exchange_weak(node->next,
+                                               node,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+        }
+      }
+
+      /// @return true if nothing is staged at the moment of the call
+      bool empty() const {
+        return head_.load(std::memory_order_acquire) == nullptr;
+      }
+
+      /**
+       * Consume everything staged before this call, invoking f on each
+       * element in push order. Values pushed concurrently with the drain
+       * stay staged for the next one.
+       */
+      template <typename Func>
+      void drain(Func &&f) {
+        auto *node = head_.exchange(nullptr, std::memory_order_acquire);
+
+        // the stack is taken in LIFO order - reverse it to restore the
+        // push order
+        Node *reversed = nullptr;
+        while (node != nullptr) {
+          auto *next = node->next;
+          node->next = reversed;
+          reversed = node;
+          node = next;
+        }
+
+        while (reversed != nullptr) {
+          auto *next = reversed->next;
+          std::forward<Func>(f)(std::move(reversed->value));
+          delete reversed;
+          reversed = next;
+        }
+      }
+
+     private:
+      struct Node {
+        Type value;
+        Node *next;
+      };
+
+      std::atomic<Node *> head_{nullptr};
+    };
+  }  // namespace containers
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_LOCKFREE_STAGING_QUEUE_HPP
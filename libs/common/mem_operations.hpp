@@ -6,7 +6,15 @@
 #ifndef IROHA_COMMON_MEM_OPERATIONS_HPP
 #define IROHA_COMMON_MEM_OPERATIONS_HPP
 
+#include <cstddef>
 #include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
 
 namespace iroha {
 
@@ -21,6 +29,147 @@ namespace iroha {
     static_assert(std::is_pod<T>::value, "T must be POD.");
     std::memcpy(&dst, &src, sizeof(src));
   }
+
+  /// the common huge page size; buffers of at least this size are worth
+  /// backing with huge pages
+  constexpr size_t kHugePageSize = size_t{2} << 20;
+
+  namespace detail {
+    /// round the size up to whole huge pages
+    inline size_t roundToHugePages(size_t size) {
+      return (size + kHugePageSize - 1) & ~(kHugePageSize - 1);
+    }
+
+#ifndef _WIN32
+    /**
+     * Map an anonymous region of the given whole-page size, on huge
+     * pages when the system grants them: explicitly reserved ones
+     * first, a transparent huge page advice on a normal mapping
+     * otherwise
+     */
+    inline void *mapLarge(size_t rounded_size) {
+#ifdef MAP_HUGETLB
+      void *huge_pages = ::mmap(nullptr,
+                                rounded_size,
+                                PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                                -1,
+                                0);
+      if (huge_pages != MAP_FAILED) {
+        return huge_pages;
+      }
+#endif
+      void *pages = ::mmap(nullptr,
+                           rounded_size,
+                           PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS,
+                           -1,
+                           0);
+      if (pages == MAP_FAILED) {
+        throw std::bad_alloc{};
+      }
+#ifdef MADV_HUGEPAGE
+      ::madvise(pages, rounded_size, MADV_HUGEPAGE);
+#endif
+      return pages;
+    }
+#endif
+  }  // namespace detail
+
+  /**
+   * Allocator backing large allocations with huge pages and deferring
+   * to the general heap for small ones. A multi-megabyte serialized
+   * proposal or block walked end to end churns the TLB when it sits on
+   * 4 KiB pages; one huge page entry covers 2 MiB of it. Falls back
+   * transparently where huge pages are unavailable.
+   */
+  template <typename T>
+  class HugePageAllocator {
+   public:
+    using value_type = T;
+
+    HugePageAllocator() = default;
+
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U> &) {}
+
+    T *allocate(size_t n) {
+      const auto size = n * sizeof(T);
+#ifndef _WIN32
+      if (size >= kHugePageSize) {
+        return static_cast<T *>(
+            detail::mapLarge(detail::roundToHugePages(size)));
+      }
+#endif
+      return static_cast<T *>(::operator new(size));
+    }
+
+    void deallocate(T *ptr, size_t n) noexcept {
+      const auto size = n * sizeof(T);
+#ifndef _WIN32
+      if (size >= kHugePageSize) {
+        ::munmap(ptr, detail::roundToHugePages(size));
+        return;
+      }
+#endif
+      ::operator delete(ptr);
+    }
+  };
+
+  template <typename T, typename U>
+  bool operator==(const HugePageAllocator<T> &, const HugePageAllocator<U> &) {
+    return true;
+  }
+
+  template <typename T, typename U>
+  bool operator!=(const HugePageAllocator<T> &, const HugePageAllocator<U> &) {
+    return false;
+  }
+
+  /**
+   * Fixed-size contiguous byte buffer on the same backing strategy, for
+   * assembly buffers whose size is known upfront
+   */
+  class HugePageBuffer {
+   public:
+    explicit HugePageBuffer(size_t size)
+        : size_(size), data_(HugePageAllocator<char>{}.allocate(size)) {}
+
+    HugePageBuffer(HugePageBuffer &&other) noexcept
+        : size_(std::exchange(other.size_, 0)),
+          data_(std::exchange(other.data_, nullptr)) {}
+
+    HugePageBuffer &operator=(HugePageBuffer &&other) noexcept {
+      std::swap(size_, other.size_);
+      std::swap(data_, other.data_);
+      return *this;
+    }
+
+    HugePageBuffer(const HugePageBuffer &) = delete;
+    HugePageBuffer &operator=(const HugePageBuffer &) = delete;
+
+    ~HugePageBuffer() {
+      if (data_) {
+        HugePageAllocator<char>{}.deallocate(data_, size_);
+      }
+    }
+
+    char *data() {
+      return data_;
+    }
+
+    const char *data() const {
+      return data_;
+    }
+
+    size_t size() const {
+      return size_;
+    }
+
+   private:
+    size_t size_{0};
+    char *data_{nullptr};
+  };
 }  // namespace iroha
 
 #endif  // IROHA_COMMON_MEM_OPERATIONS_HPP
@@ -0,0 +1,48 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/memory_budget.hpp"
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+
+  MemoryBudget &MemoryBudget::instance() {
+    static MemoryBudget budget;
+    return budget;
+  }
+
+  void MemoryBudget::setLimit(uint64_t limit_bytes) {
+    limit_.store(limit_bytes, std::memory_order_relaxed);
+  }
+
+  void MemoryBudget::charge(uint64_t bytes) {
+    used_.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  void MemoryBudget::release(uint64_t bytes) {
+    used_.fetch_sub(bytes, std::memory_order_relaxed);
+  }
+
+  uint64_t MemoryBudget::used() const {
+    return used_.load(std::memory_order_relaxed);
+  }
+
+  bool MemoryBudget::overBudget() const {
+    auto limit = limit_.load(std::memory_order_relaxed);
+    return limit != 0 and used() > limit;
+  }
+
+  uint64_t batchMemoryUse(
+      const shared_model::interface::TransactionBatch &batch) {
+    uint64_t bytes = 0;
+    for (const auto &tx : batch.transactions()) {
+      bytes += tx->blob().size();
+    }
+    return bytes;
+  }
+
+}  // namespace iroha
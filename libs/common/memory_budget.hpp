@@ -0,0 +1,63 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MEMORY_BUDGET_HPP
+#define IROHA_MEMORY_BUDGET_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace shared_model {
+  namespace interface {
+    class TransactionBatch;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+
+  /**
+   * Process-wide byte budget shared by the pipeline caches. The round
+   * cache of ordering, the MST state, the pending transactions storage
+   * and the status cache each grow independently, so under sustained
+   * overload their combined footprint is unbounded. A cache charges the
+   * serialized size of a batch when it starts holding it and releases
+   * the same amount when it lets go; torii consults the budget before
+   * accepting new batches and sheds them with a retryable status while
+   * it is exhausted, so saturation degrades into client retries instead
+   * of the OOM killer.
+   */
+  class MemoryBudget {
+   public:
+    static MemoryBudget &instance();
+
+    /// @param limit_bytes - total budget; zero disables the accounting
+    void setLimit(uint64_t limit_bytes);
+
+    void charge(uint64_t bytes);
+
+    void release(uint64_t bytes);
+
+    /// @return currently charged bytes
+    uint64_t used() const;
+
+    /// @return true if a limit is set and the charges exceed it
+    bool overBudget() const;
+
+   private:
+    std::atomic<uint64_t> used_{0};
+    std::atomic<uint64_t> limit_{0};
+  };
+
+  /**
+   * The accounting unit of the pipeline caches: the serialized size of
+   * the transactions of a batch. The bookkeeping structures around a
+   * batch are not counted - the blobs dominate the footprint.
+   */
+  uint64_t batchMemoryUse(
+      const shared_model::interface::TransactionBatch &batch);
+
+}  // namespace iroha
+
+#endif  // IROHA_MEMORY_BUDGET_HPP
@@ -0,0 +1,173 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_MPMC_RING_BUFFER_HPP
+#define IROHA_COMMON_MPMC_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace iroha {
+  namespace containers {
+    /**
+     * Bounded lock-free multi-producer multi-consumer ring buffer after
+     * the classic sequence-number scheme: every cell carries a sequence
+     * which tells whether it is free for the next producer or holds a
+     * value for the next consumer, so a push or pop is one CAS on the
+     * position counter plus one store. Batch helpers amortize the call
+     * overhead of draining or filling several elements.
+     * @tparam T - type of element of the buffer
+     * @tparam Count - capacity, must be a power of two
+     */
+    template <typename T, size_t Count>
+    class MpmcRingBuffer final {
+      static_assert(Count >= 2 and (Count & (Count - 1)) == 0,
+                    "Count must be a power of two");
+
+     public:
+      using Type = T;
+
+      MpmcRingBuffer() {
+        for (size_t i = 0; i < Count; ++i) {
+          cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+      }
+
+      MpmcRingBuffer(MpmcRingBuffer const &) = delete;
+      MpmcRingBuffer &operator=(MpmcRingBuffer const &) = delete;
+
+      ~MpmcRingBuffer() {
+        popAll([](Type &&) {});
+      }
+
+      /**
+       * Try to enqueue a value.
+       * @return false when the buffer is full
+       */
+      bool tryPush(Type value) {
+        Cell *cell;
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+          cell = &cells_[pos & kMask];
+          const size_t sequence =
+              cell->sequence.load(std::memory_order_acquire);
+          const intptr_t difference = static_cast<intptr_t>(sequence)
+              - static_cast<intptr_t>(pos);
+          if (difference == 0) {
+            if (enqueue_pos_.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed)) {
+              break;
+            }
+          } else if (difference < 0) {
+            return false;
+          } else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+          }
+        }
+        new (&cell->storage) Type(std::move(value));
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+
+      /**
+       * Try to dequeue a value.
+       * @return false when the buffer is empty
+       */
+      bool tryPop(Type &value) {
+        Cell *cell;
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+          cell = &cells_[pos & kMask];
+          const size_t sequence =
+              cell->sequence.load(std::memory_order_acquire);
+          const intptr_t difference = static_cast<intptr_t>(sequence)
+              - static_cast<intptr_t>(pos + 1);
+          if (difference == 0) {
+            if (dequeue_pos_.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed)) {
+              break;
+            }
+          } else if (difference < 0) {
+            return false;
+          } else {
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+          }
+        }
+        auto *stored = reinterpret_cast<Type *>(&cell->storage);
+        value = std::move(*stored);
+        stored->~Type();
+        cell->sequence.store(pos + Count, std::memory_order_release);
+        return true;
+      }
+
+      /**
+       * Enqueue a range of values, stopping when the buffer fills up.
+       * @return the number of enqueued values
+       */
+      template <typename Iterator>
+      size_t tryPushBatch(Iterator begin, Iterator end) {
+        size_t pushed = 0;
+        for (; begin != end and tryPush(*begin); ++begin) {
+          ++pushed;
+        }
+        return pushed;
+      }
+
+      /**
+       * Dequeue and invoke f on every available value until the buffer
+       * is empty.
+       * @return the number of dequeued values
+       */
+      template <typename Func>
+      size_t popAll(Func &&f) {
+        size_t popped = 0;
+        Type value;
+        while (tryPop(value)) {
+          std::forward<Func>(f)(std::move(value));
+          ++popped;
+        }
+        return popped;
+      }
+
+      /// @return an instantaneous estimate of the number of enqueued
+      /// values; exact only while no push or pop is in flight
+      size_t size() const {
+        const size_t enqueue = enqueue_pos_.load(std::memory_order_relaxed);
+        const size_t dequeue = dequeue_pos_.load(std::memory_order_relaxed);
+        return enqueue >= dequeue ? enqueue - dequeue : 0;
+      }
+
+      /// @return true if nothing is enqueued at the moment of the call
+      bool empty() const {
+        const size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        const size_t sequence =
+            cells_[pos & kMask].sequence.load(std::memory_order_acquire);
+        return static_cast<intptr_t>(sequence)
+            - static_cast<intptr_t>(pos + 1) < 0;
+      }
+
+     private:
+      enum : size_t { kMask = Count - 1 };
+
+      struct Cell {
+        std::atomic<size_t> sequence;
+        typename std::aligned_storage<sizeof(Type), alignof(Type)>::type
+            storage;
+      };
+
+      /// producers and consumers bump separate counters to avoid false
+      /// sharing between the two sides
+      alignas(64) std::atomic<size_t> enqueue_pos_{0};
+      alignas(64) std::atomic<size_t> dequeue_pos_{0};
+      alignas(64) Cell cells_[Count];
+    };
+  }  // namespace containers
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_MPMC_RING_BUFFER_HPP
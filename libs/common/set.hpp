@@ -6,9 +6,33 @@
 #ifndef IROHA_SET_HPP
 #define IROHA_SET_HPP
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
 
 namespace iroha {
+  namespace detail {
+    template <typename T, typename = void>
+    struct HasReserve : std::false_type {};
+    template <typename T>
+    struct HasReserve<
+        T,
+        std::void_t<decltype(std::declval<T &>().reserve(size_t{}))>>
+        : std::true_type {};
+
+    /// pre-size hash-based containers so the inserts below never rehash;
+    /// no-op for node-based containers without reserve
+    template <typename Container>
+    void reserveIfPossible(Container &container, size_t size) {
+      if constexpr (HasReserve<Container>::value) {
+        container.reserve(size);
+      }
+    }
+  }  // namespace detail
+
   /**
    * Merge collections with unique elements
    * @tparam Collection - type of collection
@@ -23,10 +47,40 @@ namespace iroha {
             typename Collection,
             typename TargetType = typename Collection::value_type>
   auto merge_unique(Collection left, Collection right) {
-    std::unordered_set<TargetType, Hasher> unique_set(left.begin(), left.end());
+    std::unordered_set<TargetType, Hasher> unique_set;
+    unique_set.reserve(left.size() + right.size());
+    unique_set.insert(std::make_move_iterator(left.begin()),
+                      std::make_move_iterator(left.end()));
+    unique_set.insert(std::make_move_iterator(right.begin()),
+                      std::make_move_iterator(right.end()));
+    return Collection(std::make_move_iterator(unique_set.begin()),
+                      std::make_move_iterator(unique_set.end()));
+  }
 
-    unique_set.insert(right.begin(), right.end());
-    return Collection(unique_set.begin(), unique_set.end());
+  /**
+   * Merge two sorted collections into a sorted collection of unique
+   * elements in one pass, without intermediate hashing
+   * @tparam Collection - type of collection
+   * @tparam Compare - strict weak ordering both inputs are sorted by
+   * @param left - first sorted collection, wins over equivalent elements
+   * of the second
+   * @param right - second sorted collection
+   * @return sorted collection of type Collection with the unique union of
+   * elements
+   */
+  template <typename Collection, typename Compare = std::less<>>
+  Collection merge_unique_sorted(Collection left,
+                                 Collection right,
+                                 Compare compare = {}) {
+    Collection result;
+    detail::reserveIfPossible(result, left.size() + right.size());
+    std::set_union(std::make_move_iterator(left.begin()),
+                   std::make_move_iterator(left.end()),
+                   std::make_move_iterator(right.begin()),
+                   std::make_move_iterator(right.end()),
+                   std::back_inserter(result),
+                   compare);
+    return result;
   }
 
   /**
@@ -42,6 +96,7 @@ namespace iroha {
   template <typename Set, typename Merge>
   Set set_union(const Set &left, const Set &right, Merge &&merge) {
     Set out;
+    detail::reserveIfPossible(out, left.size() + right.size());
     out.insert(left.begin(), left.end());
     for (auto &&tx : right) {
       auto iter = out.find(tx);
@@ -54,6 +109,30 @@ namespace iroha {
     return out;
   }
 
+  /**
+   * Destructive \see set_union: consumes both sets and reuses their
+   * nodes, so no element is copied or reallocated
+   * @tparam Set - type of set
+   * @tparam Merge - type of merge predicate
+   * @param left - first set, becomes the result
+   * @param right - second set, its nodes are spliced into the result
+   * @param merge - merge predicate, called for elements present in both
+   * @return set with the union of elements, same elements merged inside
+   */
+  template <typename Set, typename Merge>
+  Set set_union_move(Set left, Set right, Merge &&merge) {
+    while (not right.empty()) {
+      auto node = right.extract(right.begin());
+      auto iter = left.find(node.value());
+      if (iter != left.end()) {
+        merge(*iter, node.value());
+      } else {
+        left.insert(std::move(node));
+      }
+    }
+    return left;
+  }
+
   /**
    * Provide difference operation on set
    * @tparam Set - type of set
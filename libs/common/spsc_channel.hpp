@@ -0,0 +1,197 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_SPSC_CHANNEL_HPP
+#define IROHA_COMMON_SPSC_CHANNEL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace iroha {
+  namespace containers {
+    /**
+     * Bounded single-producer single-consumer channel for handing values
+     * between two pipeline stages, each owned by exactly one thread. The
+     * fast path is a wait-free Lamport ring: a push or pop is one store
+     * and one load on the uncontended counters. A side that cannot
+     * proceed first busy-polls for a bounded number of iterations — this
+     * keeps the handoff latency in the sub-microsecond range when the
+     * peer thread is active — and only then parks on a condition
+     * variable, so an idle pipeline does not burn a core.
+     * @tparam T - type of element of the channel
+     * @tparam Count - capacity, must be a power of two
+     */
+    template <typename T, size_t Count>
+    class SpscChannel final {
+      static_assert(Count >= 2 and (Count & (Count - 1)) == 0,
+                    "Count must be a power of two");
+
+     public:
+      using Type = T;
+
+      SpscChannel() = default;
+
+      SpscChannel(SpscChannel const &) = delete;
+      SpscChannel &operator=(SpscChannel const &) = delete;
+
+      ~SpscChannel() {
+        Type value;
+        while (tryPop(value)) {
+        }
+      }
+
+      /**
+       * Try to enqueue a value. Must only be called from the producer
+       * thread.
+       * @return false when the channel is full or closed
+       */
+      bool tryPush(Type value) {
+        if (closed_.load(std::memory_order_acquire)) {
+          return false;
+        }
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == Count) {
+          return false;
+        }
+        new (&cells_[tail & kMask]) Type(std::move(value));
+        tail_.store(tail + 1, std::memory_order_release);
+        wakeParked();
+        return true;
+      }
+
+      /**
+       * Try to dequeue a value. Must only be called from the consumer
+       * thread.
+       * @return false when the channel is empty
+       */
+      bool tryPop(Type &value) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+          return false;
+        }
+        auto *stored = reinterpret_cast<Type *>(&cells_[head & kMask]);
+        value = std::move(*stored);
+        stored->~Type();
+        head_.store(head + 1, std::memory_order_release);
+        wakeParked();
+        return true;
+      }
+
+      /**
+       * Enqueue a value, waiting for free space when the channel is
+       * full. Must only be called from the producer thread.
+       * @return false when the channel was closed; the value is dropped
+       */
+      bool push(Type value) {
+        while (true) {
+          for (size_t spins = 0; spins < kSpinLimit; ++spins) {
+            if (closed_.load(std::memory_order_acquire)) {
+              return false;
+            }
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail - head_.load(std::memory_order_acquire) != Count) {
+              new (&cells_[tail & kMask]) Type(std::move(value));
+              tail_.store(tail + 1, std::memory_order_release);
+              wakeParked();
+              return true;
+            }
+            std::this_thread::yield();
+          }
+          park([this] {
+            return closed_.load(std::memory_order_relaxed)
+                or tail_.load(std::memory_order_relaxed)
+                    - head_.load(std::memory_order_relaxed)
+                != Count;
+          });
+        }
+      }
+
+      /**
+       * Dequeue a value, waiting for one to arrive when the channel is
+       * empty. Must only be called from the consumer thread.
+       * @return false when the channel is closed and fully drained
+       */
+      bool pop(Type &value) {
+        while (true) {
+          for (size_t spins = 0; spins < kSpinLimit; ++spins) {
+            if (tryPop(value)) {
+              return true;
+            }
+            if (closed_.load(std::memory_order_acquire)) {
+              // a value pushed right before close() must still be served
+              return tryPop(value);
+            }
+            std::this_thread::yield();
+          }
+          park([this] {
+            return closed_.load(std::memory_order_relaxed)
+                or head_.load(std::memory_order_relaxed)
+                != tail_.load(std::memory_order_relaxed);
+          });
+        }
+      }
+
+      /**
+       * Close the channel and wake the parked sides. Values already in
+       * the channel remain poppable; either side may call this.
+       */
+      void close() {
+        closed_.store(true, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(park_mutex_);
+        park_cv_.notify_all();
+      }
+
+      /// @return true once close() has been called
+      bool closed() const {
+        return closed_.load(std::memory_order_acquire);
+      }
+
+     private:
+      enum : size_t { kMask = Count - 1 };
+
+      /// busy-poll budget before a stalled side parks; long enough to
+      /// cover a peer thread which reacts within a scheduling quantum
+      static constexpr size_t kSpinLimit = 1024;
+
+      template <typename Predicate>
+      void park(Predicate &&predicate) {
+        std::unique_lock<std::mutex> lock(park_mutex_);
+        parked_.store(true, std::memory_order_seq_cst);
+        park_cv_.wait(lock, std::forward<Predicate>(predicate));
+        parked_.store(false, std::memory_order_relaxed);
+      }
+
+      void wakeParked() {
+        // pairs with the seq_cst store in park(): either this side sees
+        // the parked flag and notifies under the mutex, or the parked
+        // side sees the counter update in its wait predicate
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked_.load(std::memory_order_relaxed)) {
+          std::lock_guard<std::mutex> lock(park_mutex_);
+          park_cv_.notify_all();
+        }
+      }
+
+      /// producer and consumer bump separate counters to avoid false
+      /// sharing between the two sides
+      alignas(64) std::atomic<size_t> tail_{0};
+      alignas(64) std::atomic<size_t> head_{0};
+      alignas(64) std::atomic<bool> closed_{false};
+      std::atomic<bool> parked_{false};
+      std::mutex park_mutex_;
+      std::condition_variable park_cv_;
+      typename std::aligned_storage<sizeof(Type), alignof(Type)>::type
+          cells_[Count];
+    };
+  }  // namespace containers
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_SPSC_CHANNEL_HPP
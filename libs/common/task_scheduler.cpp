@@ -0,0 +1,150 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/task_scheduler.hpp"
+
+#include <fmt/core.h>
+#include "common/thread_affinity.hpp"
+#include "logger/logger.hpp"
+#include "metrics/metrics_registry.hpp"
+
+namespace {
+  /// metric name suffixes, indexed by TaskScheduler::Priority
+  constexpr char const *kPriorityNames[] = {
+      "consensus", "validation", "background"};
+
+  /// index of the own worker of the calling thread, or kNotAWorker
+  thread_local size_t tls_worker_index = SIZE_MAX;
+  constexpr size_t kNotAWorker = SIZE_MAX;
+}  // namespace
+
+namespace iroha {
+
+  TaskScheduler::TaskScheduler(size_t worker_count, logger::LoggerPtr log)
+      : log_(std::move(log)) {
+    if (worker_count == 0) {
+      worker_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    for (size_t i = 0; i < kPriorityCount; ++i) {
+      posted_[i] = metrics::MetricsRegistry::instance().makeCounter(
+          fmt::format("iroha_scheduler_{}_tasks_posted_total",
+                      kPriorityNames[i]),
+          "Tasks handed to the shared scheduler; minus the executed "
+          "counter this is the queue depth");
+      executed_[i] = metrics::MetricsRegistry::instance().makeCounter(
+          fmt::format("iroha_scheduler_{}_tasks_executed_total",
+                      kPriorityNames[i]),
+          "Tasks completed by the shared scheduler");
+    }
+    stolen_ = metrics::MetricsRegistry::instance().makeCounter(
+        "iroha_scheduler_tasks_stolen_total",
+        "Tasks a worker took from the queue of another worker");
+    workers_.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+      workers_.push_back(std::make_unique<Worker>());
+    }
+    threads_.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; ++i) {
+      threads_.emplace_back([this, i] { run(i); });
+    }
+    log_->info("started {} workers", worker_count);
+  }
+
+  TaskScheduler::~TaskScheduler() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wakeup_.notify_all();
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void TaskScheduler::post(Priority priority, std::function<void()> task) {
+    const auto priority_index = static_cast<size_t>(priority);
+    // a worker queues to itself for cache locality, outside threads are
+    // spread round-robin
+    const auto worker_index = tls_worker_index != kNotAWorker
+        ? tls_worker_index
+        : next_queue_.fetch_add(1, std::memory_order_relaxed)
+            % workers_.size();
+    {
+      std::lock_guard<std::mutex> lock(workers_[worker_index]->mutex);
+      workers_[worker_index]->queues[priority_index].push_back(
+          std::move(task));
+    }
+    pending_.fetch_add(1, std::memory_order_release);
+    posted_[priority_index]->inc();
+    wakeup_.notify_one();
+  }
+
+  size_t TaskScheduler::workerCount() const {
+    return workers_.size();
+  }
+
+  std::function<void()> TaskScheduler::popOwn(Worker &worker,
+                                              size_t &priority) {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    for (size_t i = 0; i < kPriorityCount; ++i) {
+      if (not worker.queues[i].empty()) {
+        auto task = std::move(worker.queues[i].front());
+        worker.queues[i].pop_front();
+        priority = i;
+        return task;
+      }
+    }
+    return {};
+  }
+
+  std::function<void()> TaskScheduler::steal(size_t thief, size_t &priority) {
+    for (size_t offset = 1; offset < workers_.size(); ++offset) {
+      auto &victim = *workers_[(thief + offset) % workers_.size()];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      for (size_t i = 0; i < kPriorityCount; ++i) {
+        if (not victim.queues[i].empty()) {
+          // the victim pops its queue from the front, so stealing from
+          // the back avoids contending on the same end
+          auto task = std::move(victim.queues[i].back());
+          victim.queues[i].pop_back();
+          priority = i;
+          return task;
+        }
+      }
+    }
+    return {};
+  }
+
+  void TaskScheduler::run(size_t index) {
+    affinity::pinThisThread(affinity::stage::kScheduler);
+    tls_worker_index = index;
+    while (true) {
+      size_t priority = 0;
+      auto task = popOwn(*workers_[index], priority);
+      if (not task) {
+        task = steal(index, priority);
+        if (task) {
+          stolen_->inc();
+        }
+      }
+      if (task) {
+        pending_.fetch_sub(1, std::memory_order_acquire);
+        task();
+        executed_[priority]->inc();
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      if (stop_ and pending_.load(std::memory_order_acquire) == 0) {
+        break;
+      }
+      if (not stop_) {
+        wakeup_.wait(lock, [this] {
+          return stop_ or pending_.load(std::memory_order_acquire) > 0;
+        });
+      }
+    }
+  }
+
+}  // namespace iroha
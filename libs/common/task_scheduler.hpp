@@ -0,0 +1,110 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TASK_SCHEDULER_HPP
+#define IROHA_TASK_SCHEDULER_HPP
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+
+  namespace metrics {
+    class Counter;
+  }
+
+  /**
+   * Process-wide pool of worker threads shared by the parallel parts of
+   * the pipeline. When every subsystem spawns workers of its own the host
+   * is oversubscribed as soon as two of them are busy at once, so the
+   * stages share one pool sized to the hardware instead. Every worker
+   * owns a queue per priority and steals from the queues of the others
+   * when its own run dry, so a burst in one stage spreads over the whole
+   * pool without a central queue all workers contend on.
+   */
+  class TaskScheduler {
+   public:
+    /// urgency classes of the pipeline stages; lower values run first
+    enum class Priority : size_t {
+      /// consensus votes and the block application path
+      kConsensus = 0,
+      /// stateless validation, signature checks, deserialization
+      kValidation = 1,
+      /// indexing, cache maintenance and other deferrable work
+      kBackground = 2,
+    };
+
+    static constexpr size_t kPriorityCount = 3;
+
+    /**
+     * @param worker_count - number of worker threads, 0 sizes the pool
+     * to the number of hardware threads
+     * @param log to report the pool lifecycle
+     */
+    explicit TaskScheduler(size_t worker_count, logger::LoggerPtr log);
+
+    /// Completes the already queued tasks and joins the workers.
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler &) = delete;
+    TaskScheduler &operator=(const TaskScheduler &) = delete;
+
+    /**
+     * Queue a task to run on some worker after the more urgent tasks that
+     * worker can see. A task posted from a worker thread lands on the
+     * queue of that worker, so nested fan-outs stay cache-local until
+     * another worker runs out of work and steals them.
+     */
+    void post(Priority priority, std::function<void()> task);
+
+    /// Number of worker threads, for sizing parallel fan-outs.
+    size_t workerCount() const;
+
+   private:
+    struct Worker {
+      std::mutex mutex;
+      std::array<std::deque<std::function<void()>>, kPriorityCount> queues;
+    };
+
+    /// most urgent task of the own queues, empty when they are all empty
+    std::function<void()> popOwn(Worker &worker, size_t &priority);
+
+    /// most urgent task stolen from another worker, scanning them all
+    std::function<void()> steal(size_t thief, size_t &priority);
+
+    void run(size_t index);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::mutex sleep_mutex_;
+    std::condition_variable wakeup_;
+    /// tasks posted and not yet taken by a worker
+    std::atomic<size_t> pending_{0};
+    /// round-robin cursor for posts from non-worker threads
+    std::atomic<size_t> next_queue_{0};
+    /// set once in the destructor, guarded by sleep_mutex_
+    bool stop_{false};
+
+    logger::LoggerPtr log_;
+
+    std::array<std::shared_ptr<metrics::Counter>, kPriorityCount> posted_;
+    std::array<std::shared_ptr<metrics::Counter>, kPriorityCount> executed_;
+    std::shared_ptr<metrics::Counter> stolen_;
+
+    /// started last, so the workers see the members above initialized
+    std::vector<std::thread> threads_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_TASK_SCHEDULER_HPP
@@ -0,0 +1,56 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/thread_affinity.hpp"
+
+#include <mutex>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+  std::mutex &stagesMutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  iroha::affinity::StageCpuMap &configuredStages() {
+    static iroha::affinity::StageCpuMap stages;
+    return stages;
+  }
+}  // namespace
+
+void iroha::affinity::configureStages(StageCpuMap stages) {
+  std::lock_guard<std::mutex> lock(stagesMutex());
+  configuredStages() = std::move(stages);
+}
+
+void iroha::affinity::pinThisThread(char const *stage) {
+#ifdef __linux__
+  std::vector<uint16_t> cpus;
+  {
+    std::lock_guard<std::mutex> lock(stagesMutex());
+    auto const it = configuredStages().find(stage);
+    if (it == configuredStages().end()) {
+      return;
+    }
+    cpus = it->second;
+  }
+  if (cpus.empty()) {
+    return;
+  }
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (auto const cpu : cpus) {
+    CPU_SET(cpu, &cpu_set);
+  }
+  // failure leaves the thread on the default mask, which is safe
+  pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+#else
+  (void)stage;
+#endif
+}
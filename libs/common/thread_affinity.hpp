@@ -0,0 +1,46 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_THREAD_AFFINITY_HPP
+#define IROHA_COMMON_THREAD_AFFINITY_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace iroha {
+  namespace affinity {
+
+    /// pipeline stage names accepted in the thread_affinity config section
+    namespace stage {
+      constexpr char const *kTorii = "torii";
+      constexpr char const *kConsensus = "consensus";
+      constexpr char const *kStorage = "storage";
+      constexpr char const *kScheduler = "scheduler";
+    }  // namespace stage
+
+    /// stage name -> CPUs its worker threads are pinned to
+    using StageCpuMap = std::unordered_map<std::string, std::vector<uint16_t>>;
+
+    /**
+     * Set the process-wide stage-to-CPU mapping. Called once at startup
+     * from the loaded configuration, before the pipeline threads exist.
+     * Threads of stages absent from the map are left unpinned.
+     */
+    void configureStages(StageCpuMap stages);
+
+    /**
+     * Pin the calling thread to the CPU set configured for the given stage.
+     * Called by a worker thread as its first action, so the buffers it
+     * allocates afterwards are placed NUMA-locally by first touch. No-op
+     * when the stage is not configured or the platform does not support
+     * thread affinity.
+     */
+    void pinThisThread(char const *stage);
+
+  }  // namespace affinity
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_THREAD_AFFINITY_HPP
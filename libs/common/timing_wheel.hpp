@@ -0,0 +1,168 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_TIMING_WHEEL_HPP
+#define IROHA_COMMON_TIMING_WHEEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace iroha {
+  namespace containers {
+    /**
+     * Hierarchical timing wheel: entries are bucketed by deadline into a
+     * hierarchy of levels of kSlots slots each, where a slot of level N
+     * spans kSlots^N ticks. Advancing the wheel yields the entries of the
+     * elapsed level-zero slots and cascades coarser slots down as their
+     * window begins, so extracting due entries costs O(due) instead of a
+     * scan or an ordered index, and inserting is O(1).
+     *
+     * The wheel is a plain single-threaded container; the time unit of
+     * deadlines is up to the caller and only has to be consistent across
+     * calls. It initializes itself lazily: entries inserted before the
+     * first advance are kept aside and placed relative to the time of
+     * that advance.
+     * @tparam T - type of the entry payload
+     */
+    template <typename T>
+    class TimingWheel final {
+     public:
+      using Type = T;
+
+      /**
+       * Insert an entry due at the given deadline. Deadlines in the past
+       * are yielded by the next advance.
+       */
+      void insert(uint64_t deadline, T value) {
+        if (not initialized_) {
+          pending_.emplace_back(Entry{deadline, std::move(value)});
+          return;
+        }
+        place(Entry{deadline, std::move(value)});
+        ++size_;
+      }
+
+      /**
+       * Advance the wheel up to the given time and pass every entry with
+       * deadline <= now to the visitor. Time never goes backwards: calls
+       * with an earlier time than a previous advance do nothing.
+       */
+      template <typename Visitor>
+      void advanceTo(uint64_t now, const Visitor &visitor) {
+        if (not initialized_) {
+          current_ = now + 1;
+          initialized_ = true;
+          for (auto &entry : pending_) {
+            dispatch(std::move(entry), now, visitor);
+          }
+          pending_.clear();
+          return;
+        }
+        if (size_ == 0) {
+          // nothing to yield or cascade, the cursor can jump
+          current_ = std::max(current_, now + 1);
+          return;
+        }
+        while (current_ <= now) {
+          if ((current_ & kMask) == 0) {
+            cascade();
+          }
+          flushSlot(levels_[0], current_ & kMask, now, visitor);
+          ++current_;
+        }
+      }
+
+      std::size_t size() const {
+        return size_ + pending_.size();
+      }
+
+     private:
+      struct Entry {
+        uint64_t deadline;
+        T value;
+      };
+
+      using Level = std::unordered_map<uint64_t, std::vector<Entry>>;
+
+      static constexpr std::size_t kSlotBits = 8;
+      static constexpr std::size_t kLevels = 4;
+      static constexpr uint64_t kSlots = uint64_t{1} << kSlotBits;
+      static constexpr uint64_t kMask = kSlots - 1;
+      static constexpr uint64_t kSpan = uint64_t{1} << (kSlotBits * kLevels);
+
+      /// Put the entry into the slot its remaining delay belongs to.
+      void place(Entry &&entry) {
+        const uint64_t delta = entry.deadline <= current_
+            ? 0
+            : std::min(entry.deadline - current_, kSpan - 1);
+        std::size_t level = 0;
+        while (delta >> (kSlotBits * (level + 1)) != 0) {
+          ++level;
+        }
+        const uint64_t slot =
+            ((current_ + delta) >> (kSlotBits * level)) & kMask;
+        levels_[level][slot].emplace_back(std::move(entry));
+      }
+
+      /// Re-place the slot of the next coarser window into finer levels.
+      void cascade() {
+        for (std::size_t level = 1; level < kLevels; ++level) {
+          const uint64_t slot = (current_ >> (kSlotBits * level)) & kMask;
+          auto it = levels_[level].find(slot);
+          if (it != levels_[level].end()) {
+            auto entries = std::move(it->second);
+            levels_[level].erase(it);
+            for (auto &entry : entries) {
+              place(std::move(entry));
+            }
+          }
+          if (slot != 0) {
+            break;
+          }
+        }
+      }
+
+      template <typename Visitor>
+      void flushSlot(Level &level,
+                     uint64_t slot,
+                     uint64_t now,
+                     const Visitor &visitor) {
+        auto it = level.find(slot);
+        if (it == level.end()) {
+          return;
+        }
+        auto entries = std::move(it->second);
+        level.erase(it);
+        size_ -= entries.size();
+        for (auto &entry : entries) {
+          dispatch(std::move(entry), now, visitor);
+        }
+      }
+
+      /// Yield the entry if it is due, put it back into the wheel otherwise.
+      template <typename Visitor>
+      void dispatch(Entry &&entry, uint64_t now, const Visitor &visitor) {
+        if (entry.deadline <= now) {
+          visitor(std::move(entry.value));
+        } else {
+          place(std::move(entry));
+          ++size_;
+        }
+      }
+
+      Level levels_[kLevels];
+      std::vector<Entry> pending_;
+      uint64_t current_{0};
+      std::size_t size_{0};
+      bool initialized_{false};
+    };
+  }  // namespace containers
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_TIMING_WHEEL_HPP
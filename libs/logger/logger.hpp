@@ -38,6 +38,16 @@ namespace fmt {
   };
 }  // namespace fmt
 
+/**
+ * Compile-time logging verbosity floor. Calls below this level are removed
+ * by the compiler together with the formatting of their arguments. The
+ * value is the integer of the corresponding LogLevel enumerator (0 is
+ * trace, 1 is debug, ...). See the IROHA_MIN_LOG_LEVEL cache variable.
+ */
+#ifndef IROHA_MIN_LOG_LEVEL
+#define IROHA_MIN_LOG_LEVEL 0
+#endif
+
 namespace logger {
 
   enum class LogLevel;
@@ -96,6 +106,11 @@ namespace logger {
     void log(Level level,
              const std::string &format,
              const Args &... args) const {
+      // the level is a literal at every call site, so the check below is
+      // folded at compile time and elides the whole call
+      if (static_cast<int>(level) < IROHA_MIN_LOG_LEVEL) {
+        return;
+      }
       if (shouldLog(level)) {
         try {
           logInternal(level, fmt::format(format, args...));
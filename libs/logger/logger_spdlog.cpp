@@ -9,6 +9,7 @@
 #include <ciso646>
 #include <mutex>
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 #include <boost/assert.hpp>
@@ -35,10 +36,19 @@ namespace {
     }
   }
 
-  std::shared_ptr<spdlog::logger> getOrCreateLogger(const std::string tag) {
+  std::shared_ptr<spdlog::logger> getOrCreateLogger(const std::string tag,
+                                                    bool async) {
     std::shared_ptr<spdlog::logger> logger;
     try {
-      logger = spdlog::stdout_color_mt(tag);
+      if (async) {
+        static std::atomic_flag is_thread_pool_initialized = ATOMIC_FLAG_INIT;
+        if (not is_thread_pool_initialized.test_and_set()) {
+          spdlog::init_thread_pool(8192, 1);
+        }
+        logger = spdlog::stdout_color_mt<spdlog::async_factory>(tag);
+      } else {
+        logger = spdlog::stdout_color_mt(tag);
+      }
     } catch (const spdlog::spdlog_ex &) {
       logger = spdlog::get(tag);
     }
@@ -89,7 +99,9 @@ namespace logger {
   }
 
   LoggerSpdlog::LoggerSpdlog(std::string tag, ConstLoggerConfigPtr config)
-      : tag_(tag), config_(std::move(config)), logger_(getOrCreateLogger(tag)) {
+      : tag_(tag),
+        config_(std::move(config)),
+        logger_(getOrCreateLogger(tag, config_->async)) {
     setupLogger();
   }
 
@@ -49,6 +49,9 @@ namespace logger {
   struct LoggerConfig {
     LogLevel log_level;
     LogPatterns patterns;
+    /// When set, log messages are formatted and written by a dedicated
+    /// spdlog thread pool instead of the calling thread.
+    bool async{false};
   };
 
   class LoggerSpdlog : public Logger {
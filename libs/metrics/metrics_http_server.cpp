@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics_http_server.hpp"
+
+#include <ciso646>
+#include <cstring>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <fmt/core.h>
+
+#include "logger/logger.hpp"
+#include "metrics/metrics_registry.hpp"
+#include "metrics/tx_latency_tracer.hpp"
+
+namespace {
+
+  constexpr char kNotFoundResponse[] =
+      "HTTP/1.1 404 Not Found\r\n"
+      "Connection: close\r\n"
+      "Content-Length: 0\r\n"
+      "\r\n";
+
+  void sendAll(int fd, const char *data, size_t size) {
+    while (size > 0) {
+      const ssize_t written = ::send(fd, data, size, 0);
+      if (written <= 0) {
+        return;
+      }
+      data += written;
+      size -= written;
+    }
+  }
+
+}  // namespace
+
+namespace iroha {
+  namespace metrics {
+
+    MetricsHttpServer::MetricsHttpServer(const std::string &listen_ip,
+                                         uint16_t port,
+                                         MetricsRegistry &registry,
+                                         logger::LoggerPtr log)
+        : registry_(registry), log_(std::move(log)), listen_fd_(-1) {
+      listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+      if (listen_fd_ < 0) {
+        throw std::runtime_error("cannot create metrics listen socket");
+      }
+      const int reuse = 1;
+      ::setsockopt(
+          listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+      sockaddr_in address;
+      std::memset(&address, 0, sizeof(address));
+      address.sin_family = AF_INET;
+      address.sin_port = htons(port);
+      if (::inet_pton(AF_INET, listen_ip.c_str(), &address.sin_addr) != 1
+          or ::bind(listen_fd_,
+                    reinterpret_cast<const sockaddr *>(&address),
+                    sizeof(address))
+              != 0
+          or ::listen(listen_fd_, 8) != 0) {
+        ::close(listen_fd_);
+        throw std::runtime_error(fmt::format(
+            "cannot listen on {}:{} for metrics", listen_ip, port));
+      }
+
+      log_->info("metrics endpoint listening on {}:{}", listen_ip, port);
+      server_thread_ = std::thread([this] { serve(); });
+    }
+
+    MetricsHttpServer::~MetricsHttpServer() {
+      stop_.store(true);
+      // unblocks the accept call in the server thread
+      ::shutdown(listen_fd_, SHUT_RDWR);
+      ::close(listen_fd_);
+      server_thread_.join();
+    }
+
+    void MetricsHttpServer::serve() {
+      while (not stop_.load()) {
+        const int client_fd = ::accept(listen_fd_, nullptr, nullptr);
+        if (client_fd < 0) {
+          continue;
+        }
+        char request[1024];
+        const ssize_t read_size =
+            ::recv(client_fd, request, sizeof(request) - 1, 0);
+        if (read_size > 0) {
+          request[read_size] = '\0';
+          auto respond = [client_fd](const std::string &body,
+                                     const char *content_type) {
+            const std::string header = fmt::format(
+                "HTTP/1.1 200 OK\r\n"
+                "Connection: close\r\n"
+                "Content-Type: {}\r\n"
+                "Content-Length: {}\r\n"
+                "\r\n",
+                content_type,
+                body.size());
+            sendAll(client_fd, header.data(), header.size());
+            sendAll(client_fd, body.data(), body.size());
+          };
+          // only the request line matters: "GET /metrics HTTP/1.x"
+          if (std::strncmp(request, "GET /metrics", 12) == 0) {
+            respond(registry_.render(), "text/plain; version=0.0.4");
+          } else if (std::strncmp(request, "GET /traces", 11) == 0) {
+            respond(TxLatencyTracer::instance().render(), "text/plain");
+          } else {
+            sendAll(client_fd, kNotFoundResponse, sizeof(kNotFoundResponse) - 1);
+          }
+        }
+        ::close(client_fd);
+      }
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
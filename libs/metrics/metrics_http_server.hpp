@@ -0,0 +1,60 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_HTTP_SERVER_HPP
+#define IROHA_METRICS_HTTP_SERVER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    class MetricsRegistry;
+
+    /**
+     * Minimal HTTP server exposing the metrics registry at /metrics in the
+     * Prometheus text exposition format and the sampled transaction
+     * latency traces at /traces. Scrapes are infrequent and the response
+     * is small, so requests are served one at a time by a single thread;
+     * no external HTTP dependency is required.
+     */
+    class MetricsHttpServer {
+     public:
+      /**
+       * Start listening immediately.
+       * @param listen_ip - the address to bind to
+       * @param port - the TCP port to bind to
+       * @param registry - the registry rendered on each scrape
+       * @param log - logger
+       */
+      MetricsHttpServer(const std::string &listen_ip,
+                        uint16_t port,
+                        MetricsRegistry &registry,
+                        logger::LoggerPtr log);
+
+      MetricsHttpServer(const MetricsHttpServer &) = delete;
+      MetricsHttpServer &operator=(const MetricsHttpServer &) = delete;
+
+      ~MetricsHttpServer();
+
+     private:
+      void serve();
+
+      MetricsRegistry &registry_;
+      logger::LoggerPtr log_;
+      int listen_fd_;
+      std::atomic<bool> stop_{false};
+      std::thread server_thread_;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_HTTP_SERVER_HPP
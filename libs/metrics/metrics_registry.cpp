@@ -0,0 +1,140 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics_registry.hpp"
+
+#include <algorithm>
+#include <ciso646>
+#include <functional>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+  size_t threadStripe(size_t stripes) {
+    static thread_local const size_t stripe =
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) % stripes;
+    return stripe;
+  }
+
+  /// fetch_add for atomic<double> is not available until C++20
+  void atomicAdd(std::atomic<double> &target, double delta) {
+    double expected = target.load(std::memory_order_relaxed);
+    while (not target.compare_exchange_weak(
+        expected, expected + delta, std::memory_order_relaxed)) {
+    }
+  }
+
+}  // namespace
+
+namespace iroha {
+  namespace metrics {
+
+    void Counter::inc(uint64_t delta) {
+      cells_[threadStripe(kStripes)].value.fetch_add(
+          delta, std::memory_order_relaxed);
+    }
+
+    uint64_t Counter::value() const {
+      uint64_t sum = 0;
+      for (const auto &cell : cells_) {
+        sum += cell.value.load(std::memory_order_relaxed);
+      }
+      return sum;
+    }
+
+    Histogram::Histogram(std::vector<double> bounds)
+        : bounds_(std::move(bounds)) {
+      buckets_.reserve(bounds_.size() + 1);
+      for (size_t i = 0; i < bounds_.size() + 1; ++i) {
+        buckets_.emplace_back(std::make_unique<std::atomic<uint64_t>>(0));
+      }
+    }
+
+    void Histogram::observe(double value) {
+      const size_t bucket =
+          std::lower_bound(bounds_.begin(), bounds_.end(), value)
+          - bounds_.begin();
+      buckets_[bucket]->fetch_add(1, std::memory_order_relaxed);
+      count_.fetch_add(1, std::memory_order_relaxed);
+      atomicAdd(sum_, value);
+    }
+
+    void Histogram::observeSince(
+        std::chrono::steady_clock::time_point start) {
+      observe(std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                            - start)
+                  .count());
+    }
+
+    std::vector<double> Histogram::defaultDurationBounds() {
+      return {0.001, 0.005, 0.01, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10};
+    }
+
+    MetricsRegistry &MetricsRegistry::instance() {
+      static MetricsRegistry registry;
+      return registry;
+    }
+
+    std::shared_ptr<Counter> MetricsRegistry::makeCounter(std::string name,
+                                                          std::string help) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto &counter : counters_) {
+        if (counter.name == name) {
+          return counter.counter;
+        }
+      }
+      counters_.push_back(NamedCounter{
+          std::move(name), std::move(help), std::make_shared<Counter>()});
+      return counters_.back().counter;
+    }
+
+    std::shared_ptr<Histogram> MetricsRegistry::makeHistogram(
+        std::string name, std::string help, std::vector<double> bounds) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto &histogram : histograms_) {
+        if (histogram.name == name) {
+          return histogram.histogram;
+        }
+      }
+      histograms_.push_back(
+          NamedHistogram{std::move(name),
+                         std::move(help),
+                         std::make_shared<Histogram>(std::move(bounds))});
+      return histograms_.back().histogram;
+    }
+
+    std::string MetricsRegistry::render() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::ostringstream out;
+      for (const auto &counter : counters_) {
+        out << "# HELP " << counter.name << " " << counter.help << "\n";
+        out << "# TYPE " << counter.name << " counter\n";
+        out << counter.name << " " << counter.counter->value() << "\n";
+      }
+      for (const auto &histogram : histograms_) {
+        const auto &impl = *histogram.histogram;
+        out << "# HELP " << histogram.name << " " << histogram.help << "\n";
+        out << "# TYPE " << histogram.name << " histogram\n";
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < impl.bounds_.size(); ++i) {
+          cumulative += impl.buckets_[i]->load(std::memory_order_relaxed);
+          out << histogram.name << "_bucket{le=\"" << impl.bounds_[i]
+              << "\"} " << cumulative << "\n";
+        }
+        cumulative +=
+            impl.buckets_.back()->load(std::memory_order_relaxed);
+        out << histogram.name << "_bucket{le=\"+Inf\"} " << cumulative
+            << "\n";
+        out << histogram.name << "_sum "
+            << impl.sum_.load(std::memory_order_relaxed) << "\n";
+        out << histogram.name << "_count "
+            << impl.count_.load(std::memory_order_relaxed) << "\n";
+      }
+      return out.str();
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_REGISTRY_HPP
+#define IROHA_METRICS_REGISTRY_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace iroha {
+  namespace metrics {
+
+    /**
+     * Monotonically increasing counter. The value is striped over several
+     * cache-line-sized cells indexed by the calling thread, so increments
+     * from different threads do not contend on one atomic; the cells are
+     * summed when the counter is scraped.
+     */
+    class Counter {
+     public:
+      void inc(uint64_t delta = 1);
+
+      /// Sum of all increments so far. Used when rendering a scrape.
+      uint64_t value() const;
+
+     private:
+      static constexpr size_t kStripes = 16;
+
+      struct alignas(64) Cell {
+        std::atomic<uint64_t> value{0};
+      };
+
+      std::array<Cell, kStripes> cells_;
+    };
+
+    /**
+     * Histogram with a fixed set of upper bucket bounds. Observations only
+     * touch atomics, aggregation happens when the histogram is scraped.
+     */
+    class Histogram {
+     public:
+      /// @param bounds - upper bucket bounds in ascending order, in the
+      /// unit of the observed values (seconds for durations)
+      explicit Histogram(std::vector<double> bounds);
+
+      void observe(double value);
+
+      /// Observe the duration since the given steady clock time point.
+      void observeSince(std::chrono::steady_clock::time_point start);
+
+      /// Default bounds for durations of pipeline stages, in seconds.
+      static std::vector<double> defaultDurationBounds();
+
+     private:
+      friend class MetricsRegistry;
+
+      const std::vector<double> bounds_;
+      /// one counter per bound plus the overflow bucket
+      std::vector<std::unique_ptr<std::atomic<uint64_t>>> buckets_;
+      std::atomic<uint64_t> count_{0};
+      std::atomic<double> sum_{0.0};
+    };
+
+    /**
+     * Process-wide collection of metrics. Instrumented components fetch
+     * their counters and histograms by name at construction time; the
+     * maintenance endpoint renders the whole collection in the Prometheus
+     * text exposition format on every scrape.
+     */
+    class MetricsRegistry {
+     public:
+      /// The single registry of the process.
+      static MetricsRegistry &instance();
+
+      /**
+       * Get or create a counter. Thread safe.
+       * @param name - the metric name, as exposed to the scraper
+       * @param help - one line describing the metric
+       */
+      std::shared_ptr<Counter> makeCounter(std::string name,
+                                           std::string help);
+
+      /**
+       * Get or create a histogram. Thread safe.
+       * @param name - the metric name, as exposed to the scraper
+       * @param help - one line describing the metric
+       * @param bounds - upper bucket bounds in ascending order
+       */
+      std::shared_ptr<Histogram> makeHistogram(std::string name,
+                                               std::string help,
+                                               std::vector<double> bounds);
+
+      /// Render all metrics in the Prometheus text exposition format.
+      std::string render() const;
+
+     private:
+      struct NamedCounter {
+        std::string name;
+        std::string help;
+        std::shared_ptr<Counter> counter;
+      };
+
+      struct NamedHistogram {
+        std::string name;
+        std::string help;
+        std::shared_ptr<Histogram> histogram;
+      };
+
+      mutable std::mutex mutex_;
+      std::vector<NamedCounter> counters_;
+      std::vector<NamedHistogram> histograms_;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_REGISTRY_HPP
@@ -0,0 +1,94 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/pipeline_snapshots.hpp"
+
+#include <algorithm>
+
+using namespace iroha::metrics;
+
+PipelineSnapshots &PipelineSnapshots::instance() {
+  static PipelineSnapshots snapshots;
+  return snapshots;
+}
+
+void PipelineSnapshots::setConsensusRound(uint64_t block_round,
+                                          uint32_t reject_round) {
+  consensus_block_round_.store(block_round, std::memory_order_relaxed);
+  consensus_reject_round_.store(reject_round, std::memory_order_relaxed);
+}
+
+void PipelineSnapshots::setConsensusVotes(uint32_t votes) {
+  consensus_votes_.store(votes, std::memory_order_relaxed);
+}
+
+void PipelineSnapshots::setOrderingCache(uint64_t batches,
+                                         uint64_t transactions) {
+  ordering_cache_batches_.store(batches, std::memory_order_relaxed);
+  ordering_cache_transactions_.store(transactions, std::memory_order_relaxed);
+}
+
+void PipelineSnapshots::setNextProposalTransactions(uint64_t transactions) {
+  next_proposal_transactions_.store(transactions, std::memory_order_relaxed);
+}
+
+void PipelineSnapshots::setMstPendingBatches(uint64_t batches) {
+  mst_pending_batches_.store(batches, std::memory_order_relaxed);
+}
+
+void PipelineSnapshots::recordRound(uint64_t block_round,
+                                    uint32_t reject_round,
+                                    std::chrono::microseconds duration) {
+  const auto index =
+      recorded_rounds_.fetch_add(1, std::memory_order_relaxed) % rounds_.size();
+  auto &slot = rounds_[index];
+  // the slot sequence is odd for the duration of the write; rounds finish
+  // one at a time, so two writers never race on one slot in practice
+  slot.sequence.fetch_add(1, std::memory_order_acq_rel);
+  slot.block_round = block_round;
+  slot.reject_round = reject_round;
+  slot.duration_us = static_cast<uint64_t>(duration.count());
+  slot.sequence.fetch_add(1, std::memory_order_release);
+}
+
+PipelineSnapshots::Snapshot PipelineSnapshots::snapshot() const {
+  Snapshot result;
+  result.consensus_block_round =
+      consensus_block_round_.load(std::memory_order_relaxed);
+  result.consensus_reject_round =
+      consensus_reject_round_.load(std::memory_order_relaxed);
+  result.consensus_votes = consensus_votes_.load(std::memory_order_relaxed);
+  result.ordering_cache_batches =
+      ordering_cache_batches_.load(std::memory_order_relaxed);
+  result.ordering_cache_transactions =
+      ordering_cache_transactions_.load(std::memory_order_relaxed);
+  result.next_proposal_transactions =
+      next_proposal_transactions_.load(std::memory_order_relaxed);
+  result.mst_pending_batches =
+      mst_pending_batches_.load(std::memory_order_relaxed);
+
+  const auto recorded = recorded_rounds_.load(std::memory_order_acquire);
+  const auto count = std::min<uint64_t>(recorded, rounds_.size());
+  result.recent_rounds.reserve(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    // walk backwards from the most recently written slot
+    const auto &slot = rounds_[(recorded - 1 - i) % rounds_.size()];
+    RoundTiming timing;
+    while (true) {
+      const auto before = slot.sequence.load(std::memory_order_acquire);
+      if (before % 2 != 0) {
+        continue;  // a write is in progress
+      }
+      timing.block_round = slot.block_round;
+      timing.reject_round = slot.reject_round;
+      timing.duration_us = slot.duration_us;
+      if (slot.sequence.load(std::memory_order_acquire) == before) {
+        break;
+      }
+    }
+    result.recent_rounds.push_back(timing);
+  }
+  return result;
+}
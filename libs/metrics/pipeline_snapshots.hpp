@@ -0,0 +1,103 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PIPELINE_SNAPSHOTS_HPP
+#define IROHA_PIPELINE_SNAPSHOTS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace iroha {
+  namespace metrics {
+
+    /**
+     * Process-wide snapshot of the pipeline state for operational
+     * diagnosis. Unlike the counters and histograms of MetricsRegistry,
+     * which accumulate history for a scraper, this holds the current
+     * numbers: the round consensus is in, how deep the ordering cache is,
+     * how many batches wait for multisignature quorum, and how long the
+     * last few rounds took. Each subsystem stores its values into plain
+     * atomics as it works, so publishing a value never blocks the
+     * pipeline; readers get a consistent per-round timing record through
+     * a per-slot seqlock and at worst a momentarily stale scalar.
+     */
+    class PipelineSnapshots {
+     public:
+      /// number of most recent round timings retained
+      static constexpr size_t kRetainedRounds = 10;
+
+      struct RoundTiming {
+        uint64_t block_round;
+        uint32_t reject_round;
+        /// time from casting a vote to the round outcome
+        uint64_t duration_us;
+      };
+
+      struct Snapshot {
+        uint64_t consensus_block_round;
+        uint32_t consensus_reject_round;
+        uint32_t consensus_votes;
+        uint64_t ordering_cache_batches;
+        uint64_t ordering_cache_transactions;
+        uint64_t next_proposal_transactions;
+        uint64_t mst_pending_batches;
+        /// most recent first
+        std::vector<RoundTiming> recent_rounds;
+      };
+
+      /// The single snapshot collection of the process.
+      static PipelineSnapshots &instance();
+
+      /// the round consensus currently votes in; set by the consensus gate
+      void setConsensusRound(uint64_t block_round, uint32_t reject_round);
+
+      /// number of votes seen in the last round outcome
+      void setConsensusVotes(uint32_t votes);
+
+      /// depth of the ordering batch cache; set once per round
+      void setOrderingCache(uint64_t batches, uint64_t transactions);
+
+      /// number of transactions packed into the latest proposal
+      void setNextProposalTransactions(uint64_t transactions);
+
+      /// number of batches waiting for multisignature quorum
+      void setMstPendingBatches(uint64_t batches);
+
+      /// store the timing of a finished round, evicting the oldest one
+      void recordRound(uint64_t block_round,
+                       uint32_t reject_round,
+                       std::chrono::microseconds duration);
+
+      Snapshot snapshot() const;
+
+     private:
+      /// one retained round timing; sequence is odd while a write is in
+      /// progress, so a reader can detect and retry a torn read
+      struct Slot {
+        std::atomic<uint64_t> sequence{0};
+        uint64_t block_round{0};
+        uint32_t reject_round{0};
+        uint64_t duration_us{0};
+      };
+
+      std::atomic<uint64_t> consensus_block_round_{0};
+      std::atomic<uint32_t> consensus_reject_round_{0};
+      std::atomic<uint32_t> consensus_votes_{0};
+      std::atomic<uint64_t> ordering_cache_batches_{0};
+      std::atomic<uint64_t> ordering_cache_transactions_{0};
+      std::atomic<uint64_t> next_proposal_transactions_{0};
+      std::atomic<uint64_t> mst_pending_batches_{0};
+
+      std::array<Slot, kRetainedRounds> rounds_;
+      std::atomic<uint64_t> recorded_rounds_{0};
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_PIPELINE_SNAPSHOTS_HPP
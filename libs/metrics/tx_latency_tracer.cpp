@@ -0,0 +1,104 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/tx_latency_tracer.hpp"
+
+#include <ciso646>
+#include <functional>
+#include <sstream>
+
+namespace iroha {
+  namespace metrics {
+
+    char const *toString(TxStage stage) {
+      switch (stage) {
+        case TxStage::kToriiReceived:
+          return "torii_received";
+        case TxStage::kMstPending:
+          return "mst_pending";
+        case TxStage::kOrderingCacheInserted:
+          return "ordering_cache_inserted";
+        case TxStage::kProposalIncluded:
+          return "proposal_included";
+        case TxStage::kVerifiedProposal:
+          return "verified_proposal";
+        case TxStage::kCommitted:
+          return "committed";
+        default:
+          return "unknown";
+      }
+    }
+
+    TxLatencyTracer &TxLatencyTracer::instance() {
+      static TxLatencyTracer tracer;
+      return tracer;
+    }
+
+    TxLatencyTracer::TxLatencyTracer(size_t sample_rate)
+        : sample_rate_(sample_rate) {}
+
+    void TxLatencyTracer::recordStage(std::string_view tx_hash,
+                                      TxStage stage) {
+      const size_t hash = std::hash<std::string_view>{}(tx_hash);
+      if (hash % sample_rate_ != 0) {
+        return;
+      }
+      const auto now = Clock::now();
+
+      auto &shard = shards_[(hash / sample_rate_) % kShards];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto it = shard.pending.find(std::string{tx_hash});
+      if (it == shard.pending.end()) {
+        if (shard.pending.size() >= kMaxPendingPerShard) {
+          // transactions which never commit would otherwise accumulate
+          shard.pending.clear();
+        }
+        Trace trace;
+        trace.tx_hash = std::string{tx_hash};
+        it = shard.pending.emplace(trace.tx_hash, std::move(trace)).first;
+      }
+      it->second.stages[static_cast<size_t>(stage)] = now;
+
+      if (stage == TxStage::kCommitted) {
+        Trace finished = std::move(it->second);
+        shard.pending.erase(it);
+        finish(std::move(finished));
+      }
+    }
+
+    void TxLatencyTracer::finish(Trace trace) {
+      std::lock_guard<std::mutex> lock(finished_mutex_);
+      if (finished_.size() < kMaxFinished) {
+        finished_.push_back(std::move(trace));
+      } else {
+        finished_[next_finished_slot_] = std::move(trace);
+        next_finished_slot_ = (next_finished_slot_ + 1) % kMaxFinished;
+      }
+    }
+
+    std::string TxLatencyTracer::render() const {
+      std::lock_guard<std::mutex> lock(finished_mutex_);
+      std::ostringstream out;
+      for (const auto &trace : finished_) {
+        out << trace.tx_hash << "\n";
+        const auto start =
+            trace.stages[static_cast<size_t>(TxStage::kToriiReceived)];
+        for (size_t stage = 0; stage < trace.stages.size(); ++stage) {
+          const auto stamp = trace.stages[stage];
+          if (stamp == Clock::time_point{}) {
+            continue;  // the transaction skipped this stage
+          }
+          out << "  " << toString(static_cast<TxStage>(stage)) << " +"
+              << std::chrono::duration_cast<std::chrono::microseconds>(
+                     stamp - start)
+                     .count()
+              << "us\n";
+        }
+      }
+      return out.str();
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TX_LATENCY_TRACER_HPP
+#define IROHA_TX_LATENCY_TRACER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace iroha {
+  namespace metrics {
+
+    /// Pipeline stages a transaction passes on its way to a block.
+    enum class TxStage {
+      kToriiReceived,
+      kMstPending,
+      kOrderingCacheInserted,
+      kProposalIncluded,
+      kVerifiedProposal,
+      kCommitted,
+      COUNT
+    };
+
+    char const *toString(TxStage stage);
+
+    /**
+     * Stamps sampled transactions with a monotonic timestamp at every
+     * pipeline stage, so the time a transaction spent between torii and
+     * commit can be broken down per stage. Sampling is deterministic on
+     * the transaction hash, hence every stage of the pipeline picks the
+     * same transactions without any coordination, and the hot-path cost
+     * for the transactions that are not sampled is one string hash.
+     */
+    class TxLatencyTracer {
+     public:
+      /// default denominator of the hash-based sampling
+      static constexpr size_t kDefaultSampleRate = 1000;
+
+      /// The single tracer of the process.
+      static TxLatencyTracer &instance();
+
+      /// @param sample_rate - trace one transaction out of this many
+      explicit TxLatencyTracer(size_t sample_rate = kDefaultSampleRate);
+
+      /**
+       * Record that the transaction has reached the given stage. No-op
+       * for transactions outside the sample.
+       * @param tx_hash - hex hash of the transaction
+       * @param stage - the stage just reached
+       */
+      void recordStage(std::string_view tx_hash, TxStage stage);
+
+      /**
+       * Render the finished traces, most recent first, one line per
+       * stage with the offset from the torii ingress in microseconds.
+       * The output maps one to one onto OpenTelemetry spans: the trace
+       * id is the transaction hash and each stage is a span starting at
+       * the previous stage's timestamp.
+       */
+      std::string render() const;
+
+     private:
+      using Clock = std::chrono::steady_clock;
+      static constexpr size_t kShards = 16;
+      /// in-flight traces kept per shard before the oldest are dropped
+      static constexpr size_t kMaxPendingPerShard = 1000;
+      /// finished traces kept for the diagnostic endpoint
+      static constexpr size_t kMaxFinished = 100;
+
+      struct Trace {
+        std::string tx_hash;
+        std::array<Clock::time_point, static_cast<size_t>(TxStage::COUNT)>
+            stages{};
+      };
+
+      struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, Trace> pending;
+      };
+
+      void finish(Trace trace);
+
+      const size_t sample_rate_;
+      std::array<Shard, kShards> shards_;
+
+      mutable std::mutex finished_mutex_;
+      std::vector<Trace> finished_;
+      size_t next_finished_slot_{0};
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_TX_LATENCY_TRACER_HPP
@@ -5,8 +5,70 @@
 
 #include "multihash/multihash.hpp"
 
+#include <algorithm>
+#include <array>
+
 using shared_model::interface::types::ByteRange;
 
+namespace {
+  using iroha::multihash::Multihash;
+  using iroha::multihash::Type;
+
+  /// number of varint bytes needed to encode the given value
+  constexpr size_t varIntLength(uint64_t number) {
+    size_t length = 1;
+    while (number >>= 7) {
+      ++length;
+    }
+    return length;
+  }
+
+  /// varint encoding of a constant, computed at compile time
+  template <uint64_t kNumber>
+  constexpr std::array<std::byte, varIntLength(kNumber)> encodedVarInt() {
+    std::array<std::byte, varIntLength(kNumber)> bytes{};
+    uint64_t number = kNumber;
+    for (size_t i = 0; i < bytes.size(); ++i) {
+      bytes[i] = static_cast<std::byte>((number & 0x7F)
+                                        | (i + 1 < bytes.size() ? 0x80 : 0));
+      number >>= 7;
+    }
+    return bytes;
+  }
+
+  /**
+   * Match a buffer against one known multihash layout with fixed-size
+   * comparisons instead of the generic varint loops: the type tag is a
+   * compile-time byte pattern, and the payloads we deploy (32 byte keys,
+   * 64 byte signatures) always fit a single-byte length varint. Key
+   * parsing runs once per signature verification, so these two
+   * predictable branches replace the data-dependent decoding for every
+   * key in the deployed formats.
+   */
+  template <Type kType>
+  bool tryParseKnownType(ByteRange buffer, Multihash &result) {
+    constexpr auto kTag = encodedVarInt<static_cast<uint64_t>(kType)>();
+    if (buffer.size() < kTag.size() + 1) {
+      return false;
+    }
+    if (not std::equal(kTag.begin(), kTag.end(), buffer.begin())) {
+      return false;
+    }
+    const std::byte length_byte = buffer[kTag.size()];
+    if ((length_byte & std::byte{0x80}) != std::byte{0}) {
+      // multi-byte length varint, not a layout we specialize
+      return false;
+    }
+    const size_t length = std::to_integer<size_t>(length_byte);
+    if (buffer.size() != kTag.size() + 1 + length) {
+      return false;
+    }
+    result.type = kType;
+    result.data = buffer.substr(kTag.size() + 1);
+    return true;
+  }
+}  // namespace
+
 namespace iroha {
   namespace multihash {
 
@@ -14,6 +76,15 @@ namespace iroha {
         ByteRange buffer) {
       Multihash result;
 
+      // fast path for the two deployed key formats; raw ed25519 keys are
+      // told apart by size before multihash parsing in CryptoVerifier,
+      // so a multihash buffer here almost always carries one of these
+      // tags
+      if (tryParseKnownType<Type::ed25519pub>(buffer, result)
+          or tryParseKnownType<Type::ed25519_sha3_256>(buffer, result)) {
+        return result;
+      }
+
       if (not readVarInt(
               buffer,
               reinterpret_cast<std::underlying_type_t<Type> &>(result.type))) {
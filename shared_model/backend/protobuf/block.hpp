@@ -56,6 +56,7 @@ namespace shared_model {
 
      private:
       struct Impl;
+      explicit Block(std::unique_ptr<Impl> impl);
       std::unique_ptr<Impl> impl_;
     };
   }  // namespace proto
@@ -25,6 +25,34 @@ namespace shared_model {
         const TransactionFactoryType &transaction_factory,
         const google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
             &transactions);
+
+    /**
+     * Same as above, but takes ownership of the transports, moving each
+     * one into the built object instead of deep-copying it. To be used
+     * when the caller owns the enclosing message and does not need it
+     * afterwards.
+     */
+    iroha::expected::Result<interface::types::SharedTxsCollectionType,
+                            TransactionFactoryType::Error>
+    deserializeTransactions(
+        const TransactionFactoryType &transaction_factory,
+        google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
+            &&transactions);
+
+    /**
+     * Same as deserializeTransactions, but splits large collections into
+     * evenly sized chunks which are built through the factory on parallel
+     * tasks and re-concatenated in the original order; the first
+     * validation error wins, matching the serial semantics. The factory
+     * only runs stateless validators, so concurrent builds are safe.
+     * Small collections stay on the calling thread.
+     */
+    iroha::expected::Result<interface::types::SharedTxsCollectionType,
+                            TransactionFactoryType::Error>
+    deserializeTransactionsParallel(
+        const TransactionFactoryType &transaction_factory,
+        const google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
+            &transactions);
   }  // namespace proto
 }  // namespace shared_model
 
@@ -5,6 +5,8 @@
 
 #include "backend/protobuf/block.hpp"
 
+#include <memory>
+
 #include <boost/range/adaptors.hpp>
 #include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/transaction.hpp"
@@ -20,6 +22,22 @@ namespace shared_model {
       Impl(Impl &&o) noexcept = delete;
       Impl &operator=(Impl &&o) noexcept = delete;
 
+      /**
+       * Copy for clone(): the canonical serialized blobs and the hashes are
+       * carried over from the source instead of being recomputed from the
+       * transport, so a committed block is serialized exactly once however
+       * many times it is cloned on its way through the pipeline. The
+       * transaction and signature wrappers point into proto_ and are rebuilt
+       * by their default member initializers.
+       */
+      Impl(const Impl &o)
+          : proto_(o.proto_),
+            blob_(o.blob_),
+            prev_hash_(o.prev_hash_),
+            rejected_transactions_hashes_(o.rejected_transactions_hashes_),
+            payload_blob_(o.payload_blob_),
+            hash_(o.hash_) {}
+
       TransportType proto_;
       iroha::protocol::Block_v1::Payload &payload_{*proto_.mutable_payload()};
 
@@ -29,7 +47,12 @@ namespace shared_model {
             payload_.mutable_transactions()->end());
       }()};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      // shared with clones, so every reader of the canonical serialized
+      // form - storage append, gossip, the recent-block ring - sees the
+      // same bytes without another serialization pass
+      std::shared_ptr<const interface::types::BlobType> blob_{
+          std::make_shared<const interface::types::BlobType>(
+              makeBlob(proto_))};
 
       interface::types::HashType prev_hash_{[this] {
         return interface::types::HashType(
@@ -55,10 +78,11 @@ namespace shared_model {
             return hashes;
           }()};
 
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
+      std::shared_ptr<const interface::types::BlobType> payload_blob_{
+          std::make_shared<const interface::types::BlobType>(
+              makeBlob(payload_))};
 
-      interface::types::HashType hash_ = makeHash(payload_blob_);
+      interface::types::HashType hash_ = makeHash(*payload_blob_);
     };
 
     Block::Block(Block &&o) noexcept = default;
@@ -71,6 +95,8 @@ namespace shared_model {
       impl_ = std::make_unique<Block::Impl>(std::move(ref));
     }
 
+    Block::Block(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
     interface::types::TransactionsCollectionType Block::transactions() const {
       return impl_->transactions_;
     }
@@ -84,7 +110,7 @@ namespace shared_model {
     }
 
     const interface::types::BlobType &Block::blob() const {
-      return impl_->blob_;
+      return *impl_->blob_;
     }
 
     interface::types::SignatureRangeType Block::signatures() const {
@@ -117,7 +143,8 @@ namespace shared_model {
         return SignatureSetType<proto::Signature>(signatures.begin(),
                                                   signatures.end());
       }();
-      impl_->blob_ = makeBlob(impl_->proto_);
+      impl_->blob_ = std::make_shared<const interface::types::BlobType>(
+          makeBlob(impl_->proto_));
 
       return true;
     }
@@ -140,7 +167,7 @@ namespace shared_model {
     }
 
     const interface::types::BlobType &Block::payload() const {
-      return impl_->payload_blob_;
+      return *impl_->payload_blob_;
     }
 
     const iroha::protocol::Block_v1 &Block::getTransport() const {
@@ -148,7 +175,7 @@ namespace shared_model {
     }
 
     Block::ModelType *Block::clone() const {
-      return new Block(impl_->proto_);
+      return new Block(std::make_unique<Impl>(*impl_));
     }
 
     Block::~Block() = default;
@@ -5,9 +5,23 @@
 
 #include "backend/protobuf/deserialize_repeated_transactions.hpp"
 
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <thread>
+
+#include <boost/optional.hpp>
+
 using namespace shared_model;
 using namespace shared_model::proto;
 
+namespace {
+  /// minimal number of transactions per deserialization task; smaller
+  /// collections are handled on the calling thread to avoid spawning
+  /// tasks for nothing
+  constexpr size_t kDeserializationChunkSize = 256;
+}  // namespace
+
 iroha::expected::Result<interface::types::SharedTxsCollectionType,
                         TransactionFactoryType::Error>
 shared_model::proto::deserializeTransactions(
@@ -15,6 +29,7 @@ shared_model::proto::deserializeTransactions(
     const google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
         &transactions) {
   interface::types::SharedTxsCollectionType tx_collection;
+  tx_collection.reserve(transactions.size());
   for (const auto &tx : transactions) {
     auto model_tx = transaction_factory.build(tx);
     if (auto e = iroha::expected::resultToOptionalError(model_tx)) {
@@ -24,3 +39,89 @@ shared_model::proto::deserializeTransactions(
   }
   return tx_collection;
 }
+
+iroha::expected::Result<interface::types::SharedTxsCollectionType,
+                        TransactionFactoryType::Error>
+shared_model::proto::deserializeTransactionsParallel(
+    const TransactionFactoryType &transaction_factory,
+    const google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
+        &transactions) {
+  using DeserializationResult =
+      iroha::expected::Result<interface::types::SharedTxsCollectionType,
+                              TransactionFactoryType::Error>;
+
+  const size_t size = transactions.size();
+  const size_t hardware_tasks =
+      std::max<size_t>(1, std::thread::hardware_concurrency());
+  const size_t tasks = std::min(
+      hardware_tasks,
+      (size + kDeserializationChunkSize - 1) / kDeserializationChunkSize);
+  if (tasks <= 1) {
+    return deserializeTransactions(transaction_factory, transactions);
+  }
+
+  std::vector<std::future<DeserializationResult>> chunks;
+  chunks.reserve(tasks);
+  for (size_t task = 0; task < tasks; ++task) {
+    const size_t begin = task * size / tasks;
+    const size_t end = (task + 1) * size / tasks;
+    chunks.push_back(std::async(
+        std::launch::async,
+        [&transaction_factory, &transactions, begin, end]()
+            -> DeserializationResult {
+          interface::types::SharedTxsCollectionType part;
+          part.reserve(end - begin);
+          for (size_t i = begin; i < end; ++i) {
+            auto model_tx =
+                transaction_factory.build(transactions[static_cast<int>(i)]);
+            if (auto e = iroha::expected::resultToOptionalError(model_tx)) {
+              return *e;
+            }
+            part.emplace_back(std::move(model_tx).assumeValue());
+            // compute the cached hash on this worker, so the chunks hash
+            // in parallel and the later pipeline stages get a cache hit
+            part.back()->hash();
+          }
+          return part;
+        }));
+  }
+
+  interface::types::SharedTxsCollectionType tx_collection;
+  tx_collection.reserve(size);
+  boost::optional<TransactionFactoryType::Error> error;
+  for (auto &chunk : chunks) {
+    auto part = chunk.get();
+    if (error) {
+      // all chunks are joined even after a failure
+      continue;
+    }
+    if (auto e = iroha::expected::resultToOptionalError(part)) {
+      error = *e;
+      continue;
+    }
+    auto &&txs = std::move(part).assumeValue();
+    std::move(txs.begin(), txs.end(), std::back_inserter(tx_collection));
+  }
+  if (error) {
+    return *error;
+  }
+  return tx_collection;
+}
+
+iroha::expected::Result<interface::types::SharedTxsCollectionType,
+                        TransactionFactoryType::Error>
+shared_model::proto::deserializeTransactions(
+    const TransactionFactoryType &transaction_factory,
+    google::protobuf::RepeatedPtrField<iroha::protocol::Transaction>
+        &&transactions) {
+  interface::types::SharedTxsCollectionType tx_collection;
+  tx_collection.reserve(transactions.size());
+  for (auto &tx : transactions) {
+    auto model_tx = transaction_factory.build(std::move(tx));
+    if (auto e = iroha::expected::resultToOptionalError(model_tx)) {
+      return *e;
+    }
+    tx_collection.emplace_back(std::move(model_tx).assumeValue());
+  }
+  return tx_collection;
+}
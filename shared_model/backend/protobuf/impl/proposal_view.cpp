@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/proposal_view.hpp"
+
+#include <mutex>
+
+#include <boost/optional.hpp>
+#include "backend/protobuf/transaction.hpp"
+#include "backend/protobuf/util.hpp"
+
+namespace shared_model {
+  namespace proto {
+    using namespace interface::types;
+
+    struct ProposalView::Impl {
+      explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
+
+      TransportType proto_;
+
+      std::once_flag transaction_hashes_once_;
+      std::vector<HashType> transaction_hashes_;
+
+      std::once_flag transactions_once_;
+      std::vector<proto::Transaction> transactions_;
+
+      std::once_flag blob_once_;
+      boost::optional<BlobType> blob_;
+
+      std::once_flag hash_once_;
+      boost::optional<HashType> hash_;
+    };
+
+    ProposalView::ProposalView(TransportType &&ref)
+        : impl_(std::make_unique<Impl>(std::move(ref))) {}
+
+    HeightType ProposalView::height() const {
+      return impl_->proto_.height();
+    }
+
+    TimestampType ProposalView::createdTime() const {
+      return impl_->proto_.created_time();
+    }
+
+    size_t ProposalView::transactionsCount() const {
+      return impl_->proto_.transactions_size();
+    }
+
+    const std::vector<HashType> &ProposalView::transactionHashes() const {
+      std::call_once(impl_->transaction_hashes_once_, [this] {
+        impl_->transaction_hashes_.reserve(impl_->proto_.transactions_size());
+        for (const auto &tx : impl_->proto_.transactions()) {
+          impl_->transaction_hashes_.push_back(
+              Transaction::payloadHash(makeBlob(tx.payload())));
+        }
+      });
+      return impl_->transaction_hashes_;
+    }
+
+    TransactionsCollectionType ProposalView::transactions() const {
+      std::call_once(impl_->transactions_once_, [this] {
+        impl_->transactions_ = std::vector<proto::Transaction>(
+            impl_->proto_.mutable_transactions()->begin(),
+            impl_->proto_.mutable_transactions()->end());
+      });
+      return impl_->transactions_;
+    }
+
+    const BlobType &ProposalView::blob() const {
+      std::call_once(impl_->blob_once_,
+                     [this] { impl_->blob_ = makeBlob(impl_->proto_); });
+      return *impl_->blob_;
+    }
+
+    const HashType &ProposalView::hash() const {
+      std::call_once(impl_->hash_once_, [this] {
+        impl_->hash_ = crypto::DefaultHashProvider::makeHash(blob());
+      });
+      return *impl_->hash_;
+    }
+
+    const ProposalView::TransportType &ProposalView::getTransport() const {
+      return impl_->proto_;
+    }
+
+    ProposalView::~ProposalView() = default;
+
+  }  // namespace proto
+}  // namespace shared_model
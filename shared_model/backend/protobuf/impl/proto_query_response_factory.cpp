@@ -5,6 +5,12 @@
 
 #include "backend/protobuf/proto_query_response_factory.hpp"
 
+#include <mutex>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/util/json_util.h>
+
 #include "backend/protobuf/block.hpp"
 #include "backend/protobuf/permissions.hpp"
 #include "backend/protobuf/query_responses/proto_block_query_response.hpp"
@@ -14,6 +20,81 @@
 #include "interfaces/common_objects/peer.hpp"
 
 namespace {
+  /**
+   * A bounded pool of protobuf arenas for query response transports. A
+   * response with transaction or asset pages allocates each repeated
+   * sub-message separately when built on the heap; on an arena they all
+   * come from the same recycled blocks. Responses are created on query
+   * processing threads but destroyed on the torii thread once written to
+   * the wire, so the arenas are recycled through a shared pool instead of
+   * being kept thread-local.
+   */
+  class ArenaPool {
+   public:
+    static ArenaPool &instance() {
+      static ArenaPool pool;
+      return pool;
+    }
+
+    /// Take an arena from the pool (or create one); it returns itself to
+    /// the pool when the last shared_ptr to it is dropped.
+    std::shared_ptr<google::protobuf::Arena> acquire() {
+      std::unique_ptr<PooledArena> pooled;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (not free_.empty()) {
+          pooled = std::move(free_.back());
+          free_.pop_back();
+        }
+      }
+      if (not pooled) {
+        pooled = std::make_unique<PooledArena>();
+      }
+      // a shared_ptr deleter must be copyable, so the slot cannot be
+      // captured in it; the arena is exposed through the aliasing
+      // constructor instead
+      std::shared_ptr<PooledArena> slot{
+          pooled.release(), [](PooledArena *returned) {
+            // Reset() keeps the user-owned initial block, so a recycled
+            // arena serves small responses without touching the heap
+            returned->arena.Reset();
+            instance().release(std::unique_ptr<PooledArena>{returned});
+          }};
+      auto *arena = &slot->arena;
+      return std::shared_ptr<google::protobuf::Arena>{std::move(slot), arena};
+    }
+
+   private:
+    /// an arena owning its initial block, so that Reset() retains it
+    struct PooledArena {
+      static constexpr size_t kInitialBlockSize = 8192;
+
+      PooledArena()
+          : initial_block{std::make_unique<char[]>(kInitialBlockSize)},
+            arena{[this] {
+              google::protobuf::ArenaOptions options;
+              options.initial_block = initial_block.get();
+              options.initial_block_size = kInitialBlockSize;
+              return options;
+            }()} {}
+
+      std::unique_ptr<char[]> initial_block;
+      google::protobuf::Arena arena;
+    };
+
+    static constexpr size_t kMaxPooledArenas = 32;
+
+    void release(std::unique_ptr<PooledArena> pooled) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (free_.size() < kMaxPooledArenas) {
+        free_.push_back(std::move(pooled));
+      }
+    }
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<PooledArena>> free_;
+  };
+
   /**
    * Creates a query response using provided lambda and returns unique_ptr to it
    * @tparam QueryResponseCreatorLambda - lambda, which specifies, how to create
@@ -26,13 +107,16 @@ namespace {
   std::unique_ptr<shared_model::interface::QueryResponse> createQueryResponse(
       QueryResponseCreatorLambda response_creator,
       const shared_model::crypto::Hash &query_hash) {
-    iroha::protocol::QueryResponse protocol_query_response;
-    protocol_query_response.set_query_hash(query_hash.hex());
+    auto arena = ArenaPool::instance().acquire();
+    auto *protocol_query_response =
+        google::protobuf::Arena::CreateMessage<iroha::protocol::QueryResponse>(
+            arena.get());
+    protocol_query_response->set_query_hash(query_hash.hex());
 
-    response_creator(protocol_query_response);
+    response_creator(*protocol_query_response);
 
     return std::make_unique<shared_model::proto::QueryResponse>(
-        std::move(protocol_query_response));
+        protocol_query_response, std::move(arena));
   }
 
   /**
@@ -153,6 +237,30 @@ shared_model::proto::ProtoQueryResponseFactory::createBlockResponse(
       query_hash);
 }
 
+std::unique_ptr<shared_model::interface::QueryResponse>
+shared_model::proto::ProtoQueryResponseFactory::createRawBlockResponse(
+    std::string serialized_block, const crypto::Hash &query_hash) const {
+  // the stored form is the JSON of iroha.protocol.Block (see
+  // ProtoBlockJsonConverter); it is parsed straight into the response
+  // transport, so no shared_model block with its hashing and
+  // re-serialization is built on the way
+  iroha::protocol::Block block;
+  auto status =
+      google::protobuf::util::JsonStringToMessage(serialized_block, &block);
+  if (not status.ok()) {
+    return nullptr;
+  }
+  return createQueryResponse(
+      [block = std::move(block)](
+          iroha::protocol::QueryResponse &protocol_query_response) mutable {
+        protocol_query_response.mutable_block_response()
+            ->mutable_block()
+            ->mutable_block_v1()
+            ->Swap(block.mutable_block_v1());
+      },
+      query_hash);
+}
+
 std::unique_ptr<shared_model::interface::QueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createErrorQueryResponse(
     ErrorQueryType error_type,
@@ -5,6 +5,11 @@
 
 #include "backend/protobuf/transaction.hpp"
 
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <boost/container/small_vector.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include "backend/protobuf/batch_meta.hpp"
 #include "backend/protobuf/commands/proto_command.hpp"
@@ -22,6 +27,43 @@ namespace shared_model {
 
       explicit Impl(TransportType &ref) : proto_{ref} {}
 
+      /**
+       * Computes the hash of given payload bytes, memoizing the result
+       * across all transaction objects built from the same bytes. The same
+       * transaction is typically rebuilt several times between torii
+       * arrival and block commit (MST, ordering, validation), and hashing
+       * the payload dominates the cost of each rebuild.
+       *
+       * The map compares the full payload on lookup - a transaction must
+       * never receive the hash of a different one, so a structure that
+       * matches entries by the key hash alone is not usable here.
+       */
+      static interface::types::HashType memoizedHash(
+          const interface::types::BlobType &payload) {
+        constexpr size_t kCacheSizeHigh = 20000;
+        static std::mutex mutex;
+        static std::unordered_map<std::string, interface::types::HashType>
+            hash_cache;
+
+        auto hex = payload.hex();
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          auto it = hash_cache.find(hex);
+          if (it != hash_cache.end()) {
+            return it->second;
+          }
+        }
+        auto hash = makeHash(payload);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (hash_cache.size() >= kCacheSizeHigh) {
+          // the pipeline revisits only recent transactions, so a full
+          // reset is an adequate eviction policy
+          hash_cache.clear();
+        }
+        hash_cache.emplace(std::move(hex), hash);
+        return hash;
+      }
+
       detail::ReferenceHolder<TransportType> proto_;
 
       iroha::protocol::Transaction::Payload &payload_{
@@ -38,9 +80,11 @@ namespace shared_model {
       interface::types::BlobType reduced_payload_blob_{
           [this] { return makeBlob(reduced_payload_); }()};
 
-      interface::types::HashType reduced_hash_{makeHash(reduced_payload_blob_)};
+      interface::types::HashType reduced_hash_{
+          memoizedHash(reduced_payload_blob_)};
 
-      std::vector<proto::Command> commands_{
+      /// the 1-3 commands of a typical transaction fit the inline storage
+      boost::container::small_vector<proto::Command, 4> commands_{
           reduced_payload_.mutable_commands()->begin(),
           reduced_payload_.mutable_commands()->end()};
 
@@ -62,7 +106,7 @@ namespace shared_model {
                                                   signatures.end());
       }()};
 
-      interface::types::HashType hash_{makeHash(payload_blob_)};
+      interface::types::HashType hash_{memoizedHash(payload_blob_)};
     };
 
     Transaction::Transaction(const TransportType &transaction) {
@@ -87,6 +131,11 @@ namespace shared_model {
 
     Transaction::~Transaction() = default;
 
+    interface::types::HashType Transaction::payloadHash(
+        const interface::types::BlobType &payload) {
+      return Impl::memoizedHash(payload);
+    }
+
     const interface::types::AccountIdType &Transaction::creatorAccountId()
         const {
       return impl_->reduced_payload_.creator_account_id();
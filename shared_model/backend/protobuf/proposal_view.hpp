@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_PROTO_PROPOSAL_VIEW_HPP
+#define IROHA_SHARED_MODEL_PROTO_PROPOSAL_VIEW_HPP
+
+#include <vector>
+
+#include "interfaces/common_objects/types.hpp"
+#include "interfaces/iroha_internal/proposal.hpp"
+#include "proposal.pb.h"
+
+namespace shared_model {
+  namespace proto {
+
+    /**
+     * Proposal backed by its transport without an eagerly built wrapper
+     * tree. The envelope fields, the number of transactions and their
+     * hashes are served by a shallow pass over the transport, so a
+     * consumer which drops the proposal after a hash comparison never
+     * pays for the per-transaction wrappers; those are materialized on
+     * the first transactions() call. All accessors are thread-safe.
+     */
+    class ProposalView final : public interface::Proposal {
+     public:
+      using TransportType = iroha::protocol::Proposal;
+
+      explicit ProposalView(TransportType &&ref);
+
+      interface::types::HeightType height() const override;
+
+      interface::types::TimestampType createdTime() const override;
+
+      /// number of transactions, without materializing the wrappers
+      size_t transactionsCount() const;
+
+      /// transaction hashes computed from the serialized payloads,
+      /// without materializing the wrappers
+      const std::vector<interface::types::HashType> &transactionHashes()
+          const;
+
+      interface::types::TransactionsCollectionType transactions()
+          const override;
+
+      const interface::types::BlobType &blob() const override;
+
+      const interface::types::HashType &hash() const override;
+
+      const TransportType &getTransport() const;
+
+      ~ProposalView() override;
+
+     private:
+      struct Impl;
+      std::unique_ptr<Impl> impl_;
+    };
+  }  // namespace proto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_PROTO_PROPOSAL_VIEW_HPP
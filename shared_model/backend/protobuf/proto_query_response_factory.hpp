@@ -42,6 +42,10 @@ namespace shared_model {
           std::unique_ptr<interface::Block> block,
           const crypto::Hash &query_hash) const override;
 
+      std::unique_ptr<interface::QueryResponse> createRawBlockResponse(
+          std::string serialized_block,
+          const crypto::Hash &query_hash) const override;
+
       std::unique_ptr<interface::QueryResponse> createErrorQueryResponse(
           ErrorQueryType error_type,
           interface::ErrorQueryResponse::ErrorMessageType error_msg,
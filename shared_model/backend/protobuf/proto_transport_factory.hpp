@@ -72,6 +72,65 @@ namespace shared_model {
       ProtoValidatorType proto_validator_;
     };
 
+    /**
+     * Transport factory with validators composed at compile time. Unlike
+     * ProtoTransportFactory, which dispatches each validation through
+     * AbstractValidator pointers, here the validator types are template
+     * parameters held by value, so the whole validation pass over an
+     * object can be inlined. Use it where the validation profile is fixed
+     * at the instantiation site; ProtoTransportFactory remains for callers
+     * which select validators at runtime.
+     */
+    template <typename Interface,
+              typename Proto,
+              typename InterfaceValidator,
+              typename ProtoValidator>
+    class StaticProtoTransportFactory final
+        : public interface::AbstractTransportFactory<
+              Interface,
+              typename Proto::TransportType> {
+     public:
+      using typename interface::AbstractTransportFactory<
+          Interface,
+          typename Proto::TransportType>::Error;
+
+      explicit StaticProtoTransportFactory(
+          InterfaceValidator interface_validator,
+          ProtoValidator proto_validator = {})
+          : interface_validator_(std::move(interface_validator)),
+            proto_validator_(std::move(proto_validator)) {}
+
+      iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
+          typename Proto::TransportType m) const override {
+        if (auto error = proto_validator_.validate(m)) {
+          auto payload_field_descriptor =
+              m.GetDescriptor()->FindFieldByLowercaseName("payload");
+          shared_model::crypto::Hash hash;
+          if (payload_field_descriptor) {
+            const auto &payload =
+                m.GetReflection()->GetMessage(m, payload_field_descriptor);
+            hash = HashProvider::makeHash(makeBlob(payload));
+          }
+          return iroha::expected::makeError(Error{hash, error->toString()});
+        }
+
+        std::unique_ptr<Interface> result =
+            std::make_unique<Proto>(std::move(m));
+        if (auto error = interface_validator_.validate(*result)) {
+          return iroha::expected::makeError(
+              Error{result->hash(), error->toString()});
+        }
+
+        return iroha::expected::makeValue(std::move(result));
+      }
+
+     private:
+      using HashProvider = shared_model::crypto::Sha3_256;
+
+      InterfaceValidator interface_validator_;
+      ProtoValidator proto_validator_;
+    };
+
   }  // namespace proto
 }  // namespace shared_model
 
@@ -35,3 +35,21 @@ std::optional<types::HashType> TxPaginationMeta::firstTxHash() const {
 shared_model::interface::Ordering const &TxPaginationMeta::ordering() const {
   return ordering_;
 }
+
+std::optional<types::TimestampType> TxPaginationMeta::firstTxTime() const {
+  if (meta_.opt_first_tx_time_case()
+      == iroha::protocol::TxPaginationMeta::OptFirstTxTimeCase::
+             OPT_FIRST_TX_TIME_NOT_SET) {
+    return std::nullopt;
+  }
+  return meta_.first_tx_time();
+}
+
+std::optional<types::TimestampType> TxPaginationMeta::lastTxTime() const {
+  if (meta_.opt_last_tx_time_case()
+      == iroha::protocol::TxPaginationMeta::OptLastTxTimeCase::
+             OPT_LAST_TX_TIME_NOT_SET) {
+    return std::nullopt;
+  }
+  return meta_.last_tx_time();
+}
@@ -26,6 +26,12 @@ namespace shared_model {
       std::optional<interface::types::HashType> firstTxHash() const override;
       interface::Ordering const &ordering() const override;
 
+      std::optional<interface::types::TimestampType> firstTxTime()
+          const override;
+
+      std::optional<interface::types::TimestampType> lastTxTime()
+          const override;
+
      private:
       const iroha::protocol::TxPaginationMeta &meta_;
       OrderingImpl ordering_;
@@ -5,6 +5,7 @@
 
 #include "backend/protobuf/query_responses/proto_query_response.hpp"
 
+#include <boost/optional.hpp>
 #include "backend/protobuf/query_responses/proto_account_asset_response.hpp"
 #include "backend/protobuf/query_responses/proto_account_detail_response.hpp"
 #include "backend/protobuf/query_responses/proto_account_response.hpp"
@@ -50,9 +51,18 @@ namespace {
 namespace shared_model::proto {
 
   struct QueryResponse::Impl {
-    explicit Impl(TransportType &&ref) : proto_{std::move(ref)} {}
+    explicit Impl(TransportType &&ref)
+        : owned_{std::move(ref)}, proto_{owned_.value()} {}
 
-    TransportType proto_;
+    Impl(TransportType *arena_response,
+         std::shared_ptr<google::protobuf::Arena> arena)
+        : arena_{std::move(arena)}, proto_{*arena_response} {}
+
+    // set only when the transport is held by value; arena-allocated
+    // transports live in arena_ and are referenced through proto_
+    boost::optional<TransportType> owned_;
+    std::shared_ptr<google::protobuf::Arena> arena_;
+    TransportType &proto_;
 
     const ProtoQueryResponseVariantType variant_{[this]() -> decltype(
                                                               variant_) {
@@ -92,6 +102,11 @@ namespace shared_model::proto {
     impl_ = std::make_unique<Impl>(std::move(ref));
   }
 
+  QueryResponse::QueryResponse(TransportType *arena_response,
+                               std::shared_ptr<google::protobuf::Arena> arena) {
+    impl_ = std::make_unique<Impl>(arena_response, std::move(arena));
+  }
+
   QueryResponse::~QueryResponse() = default;
 
   const QueryResponse::QueryResponseVariantType &QueryResponse::get() const {
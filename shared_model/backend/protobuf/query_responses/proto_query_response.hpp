@@ -8,8 +8,16 @@
 
 #include "interfaces/query_responses/query_response.hpp"
 
+#include <memory>
+
 #include "qry_responses.pb.h"
 
+namespace google {
+  namespace protobuf {
+    class Arena;
+  }
+}  // namespace google
+
 namespace shared_model {
   namespace proto {
     class QueryResponse final : public interface::QueryResponse {
@@ -18,6 +26,15 @@ namespace shared_model {
 
       explicit QueryResponse(TransportType &&queryResponse);
 
+      /**
+       * Wrap a transport allocated on @a arena. The response does not own
+       * the message directly - it keeps @a arena alive instead, so the
+       * message and all its sub-messages are freed in one go when the last
+       * response referencing the arena is destroyed.
+       */
+      QueryResponse(TransportType *arena_response,
+                    std::shared_ptr<google::protobuf::Arena> arena);
+
       ~QueryResponse() override;
 
       const QueryResponseVariantType &get() const override;
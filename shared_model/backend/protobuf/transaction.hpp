@@ -47,6 +47,15 @@ namespace shared_model {
 
       const interface::types::HashType &hash() const override;
 
+      /**
+       * Hash of the given serialized transaction payload. Memoized across
+       * all transaction objects built from the same bytes, so scanning
+       * the hashes of incoming bytes also warms the cache for the
+       * wrappers which may be built from them later.
+       */
+      static interface::types::HashType payloadHash(
+          const interface::types::BlobType &payload);
+
       std::unique_ptr<interface::Transaction> moveTo() override;
 
       const TransportType &getTransport() const;
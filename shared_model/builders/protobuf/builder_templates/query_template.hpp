@@ -89,7 +89,11 @@ namespace shared_model {
           interface::types::TransactionsNumberType page_size,
           const std::optional<interface::types::HashType> &first_hash =
               std::nullopt,
-          const interface::Ordering *ordering = nullptr) {
+          const interface::Ordering *ordering = nullptr,
+          const std::optional<interface::types::TimestampType> &first_tx_time =
+              std::nullopt,
+          const std::optional<interface::types::TimestampType> &last_tx_time =
+              std::nullopt) {
         auto from_interface_2_proto_field =
             [](interface::Ordering::Field value) {
               switch (value) {
@@ -123,6 +127,12 @@ namespace shared_model {
         if (first_hash) {
           page_meta_payload->set_first_tx_hash(first_hash->hex());
         }
+        if (first_tx_time) {
+          page_meta_payload->set_first_tx_time(*first_tx_time);
+        }
+        if (last_tx_time) {
+          page_meta_payload->set_last_tx_time(*last_tx_time);
+        }
         if (ordering) {
           interface::Ordering::OrderingEntry const *ptr = nullptr;
           size_t count = 0;
@@ -190,14 +200,20 @@ namespace shared_model {
           interface::types::TransactionsNumberType page_size,
           const std::optional<interface::types::HashType> &first_hash =
               std::nullopt,
-          const interface::Ordering *ordering = nullptr) const {
+          const interface::Ordering *ordering = nullptr,
+          const std::optional<interface::types::TimestampType> &first_tx_time =
+              std::nullopt,
+          const std::optional<interface::types::TimestampType> &last_tx_time =
+              std::nullopt) const {
         return queryField([&](auto proto_query) {
           auto query = proto_query->mutable_get_account_transactions();
           query->set_account_id(account_id);
           setTxPaginationMeta(query->mutable_pagination_meta(),
                               page_size,
                               first_hash,
-                              ordering);
+                              ordering,
+                              first_tx_time,
+                              last_tx_time);
         });
       }
 
@@ -207,7 +223,11 @@ namespace shared_model {
           interface::types::TransactionsNumberType page_size,
           const std::optional<interface::types::HashType> &first_hash =
               std::nullopt,
-          const interface::Ordering *ordering = nullptr) const {
+          const interface::Ordering *ordering = nullptr,
+          const std::optional<interface::types::TimestampType> &first_tx_time =
+              std::nullopt,
+          const std::optional<interface::types::TimestampType> &last_tx_time =
+              std::nullopt) const {
         return queryField([&](auto proto_query) {
           auto query = proto_query->mutable_get_account_asset_transactions();
           query->set_account_id(account_id);
@@ -215,7 +235,9 @@ namespace shared_model {
           setTxPaginationMeta(query->mutable_pagination_meta(),
                               page_size,
                               first_hash,
-                              ordering);
+                              ordering,
+                              first_tx_time,
+                              last_tx_time);
         });
       }
 
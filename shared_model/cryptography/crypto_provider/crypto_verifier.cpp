@@ -5,6 +5,10 @@
 
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
 #include "common/hexutils.hpp"
 #include "common/result.hpp"
 #include "cryptography/ed25519_sha3_impl/crypto_provider.hpp"
@@ -83,6 +87,9 @@ namespace {
           return verifyMultihash(signature, source, public_key);
         };
   }
+
+  /// batches smaller than this are verified on the calling thread
+  constexpr size_t kParallelBatchChunkSize = 16;
 }  // namespace
 
 Result<void, const char *> CryptoVerifier::verify(
@@ -107,3 +114,42 @@ Result<void, const char *> CryptoVerifier::verify(
             };
       };
 }
+
+std::vector<Result<void, const char *>> CryptoVerifier::verifyBatch(
+    const std::vector<BatchItem> &batch) {
+  // the underlying ed25519 engine exposes no batch primitive, so the cost
+  // of a large batch is amortized by spreading the independent checks over
+  // a pool of workers
+  std::vector<Result<void, const char *>> results(batch.size());
+  auto verify_range = [&](size_t begin, size_t end) {
+    for (size_t index = begin; index < end; ++index) {
+      const auto &item = batch[index];
+      results[index] =
+          verify(item.signature, item.source.get(), item.public_key);
+    }
+  };
+
+  const size_t size = batch.size();
+  const size_t hardware_tasks =
+      std::max<size_t>(1, std::thread::hardware_concurrency());
+  const size_t tasks = std::min(hardware_tasks, size / kParallelBatchChunkSize);
+  if (tasks <= 1) {
+    verify_range(0, size);
+    return results;
+  }
+
+  std::vector<std::future<void>> chunks;
+  chunks.reserve(tasks);
+  for (size_t task = 0; task < tasks; ++task) {
+    const size_t begin = task * size / tasks;
+    const size_t end = (task + 1) * size / tasks;
+    chunks.push_back(std::async(
+        std::launch::async, [&verify_range, begin, end] {
+          verify_range(begin, end);
+        }));
+  }
+  for (auto &chunk : chunks) {
+    chunk.get();
+  }
+  return results;
+}
@@ -6,6 +6,9 @@
 #ifndef IROHA_CRYPTO_VERIFIER_HPP
 #define IROHA_CRYPTO_VERIFIER_HPP
 
+#include <functional>
+#include <vector>
+
 #include "common/result_fwd.hpp"
 #include "interfaces/common_objects/string_view_types.hpp"
 
@@ -33,6 +36,23 @@ namespace shared_model {
           const Blob &source,
           shared_model::interface::types::PublicKeyHexStringView public_key);
 
+      /// one signature check of a batch passed to verifyBatch
+      struct BatchItem {
+        shared_model::interface::types::SignedHexStringView signature;
+        std::reference_wrapper<const Blob> source;
+        shared_model::interface::types::PublicKeyHexStringView public_key;
+      };
+
+      /**
+       * Verify a batch of independent signatures, fanning the checks out
+       * over worker threads when the batch is large enough to amortize
+       * their cost
+       * @param batch - signature checks to perform
+       * @return one verification result per batch item, in order
+       */
+      static std::vector<iroha::expected::Result<void, const char *>>
+      verifyBatch(const std::vector<BatchItem> &batch);
+
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
 
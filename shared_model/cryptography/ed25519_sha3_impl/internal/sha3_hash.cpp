@@ -3,11 +3,21 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
 #include <ed25519/ed25519/sha256.h>
 #include <ed25519/ed25519/sha512.h>
 
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 
+namespace {
+  /// minimal number of digests per hashing task; smaller batches are not
+  /// worth a thread handoff and stay on the calling thread
+  constexpr size_t kBatchHashChunkSize = 64;
+}  // namespace
+
 namespace iroha {
 
   void sha3_256(uint8_t *output, const uint8_t *input, size_t in_size) {
@@ -55,4 +65,41 @@ namespace iroha {
     sha3_256(h.data(), msg.data(), msg.size());
     return h;
   }
+
+  std::vector<hash256_t> sha3_256_batch(
+      const std::vector<std::pair<const uint8_t *, size_t>> &inputs) {
+    const size_t size = inputs.size();
+    std::vector<hash256_t> digests(size);
+    const auto hash_range = [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        sha3_256(digests[i].data(), inputs[i].first, inputs[i].second);
+      }
+    };
+
+    const size_t hardware_tasks =
+        std::max<size_t>(1, std::thread::hardware_concurrency());
+    const size_t tasks = std::min(
+        hardware_tasks, (size + kBatchHashChunkSize - 1) / kBatchHashChunkSize);
+    if (tasks <= 1) {
+      hash_range(0, size);
+      return digests;
+    }
+
+    std::vector<std::future<void>> chunks;
+    chunks.reserve(tasks - 1);
+    for (size_t task = 1; task < tasks; ++task) {
+      const size_t begin = task * size / tasks;
+      const size_t end = (task + 1) * size / tasks;
+      chunks.push_back(std::async(
+          std::launch::async, [&hash_range, begin, end] {
+            hash_range(begin, end);
+          }));
+    }
+    // the first chunk is hashed here instead of idling on the joins
+    hash_range(0, size / tasks);
+    for (auto &chunk : chunks) {
+      chunk.get();
+    }
+    return digests;
+  }
 }  // namespace iroha
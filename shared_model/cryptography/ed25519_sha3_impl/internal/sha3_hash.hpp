@@ -7,6 +7,7 @@
 #define IROHA_HASH_H
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "crypto/hash_types.hpp"
@@ -22,6 +23,16 @@ namespace iroha {
   hash512_t sha3_512(const uint8_t *input, size_t in_size);
   hash512_t sha3_512(const std::string &msg);
   hash512_t sha3_512(const std::vector<uint8_t> &msg);
+
+  /**
+   * Compute the sha3-256 digests of many independent payloads at once.
+   * Large batches are spread over hardware threads, small ones are hashed
+   * on the calling thread; the result order matches the input order.
+   * @param inputs - (pointer, size) views of the payloads
+   * @return digest per input payload
+   */
+  std::vector<hash256_t> sha3_256_batch(
+      const std::vector<std::pair<const uint8_t *, size_t>> &inputs);
 }  // namespace iroha
 
 #endif  // IROHA_HASH_H
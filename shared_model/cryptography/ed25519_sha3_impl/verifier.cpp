@@ -5,20 +5,69 @@
 
 #include "cryptography/ed25519_sha3_impl/verifier.hpp"
 
+#include <string>
+
+#include "cache/sharded_cache.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 
+using shared_model::interface::types::ByteRange;
 using shared_model::interface::types::PublicKeyByteRangeView;
 using shared_model::interface::types::SignatureByteRangeView;
 
+namespace {
+  /**
+   * Verification results keyed by (message hash, public key, signature).
+   * The same transaction signature is verified several times on its way
+   * through the pipeline - at torii, on the proposal from ordering and
+   * during chain validation - and the validator sees the same few
+   * thousand signatory keys all day, so the repeats skip the curve
+   * arithmetic entirely. Ed25519 verification is deterministic, which
+   * makes the result cacheable.
+   *
+   * Caching this decision is sound only because ShardedCache compares
+   * the full key on lookup: a crafted triple whose key merely collides
+   * with a cached one must never inherit its positive verdict.
+   */
+  using VerificationCache = iroha::cache::ShardedCache<std::string, bool>;
+
+  VerificationCache &verificationCache() {
+    static VerificationCache cache;
+    return cache;
+  }
+
+  std::string makeCacheKey(const iroha::hash256_t &msg_hash,
+                           const ByteRange &pub,
+                           const ByteRange &sig) {
+    // the hash size is fixed and the public key length is encoded into
+    // the key, so two distinct triples can never concatenate to the
+    // same key whatever their field sizes are
+    const uint32_t pub_size = static_cast<uint32_t>(pub.size());
+    std::string key;
+    key.reserve(msg_hash.size() + sizeof(pub_size) + pub.size() + sig.size());
+    key.append(reinterpret_cast<const char *>(msg_hash.data()),
+               msg_hash.size());
+    key.append(reinterpret_cast<const char *>(&pub_size), sizeof(pub_size));
+    key.append(reinterpret_cast<const char *>(pub.data()), pub.size());
+    key.append(reinterpret_cast<const char *>(sig.data()), sig.size());
+    return key;
+  }
+}  // namespace
+
 namespace shared_model {
   namespace crypto {
     bool Verifier::verify(SignatureByteRangeView signature,
                           const Blob &orig,
                           PublicKeyByteRangeView public_key) {
       auto blob_hash = iroha::sha3_256(orig.blob());
-      return iroha::verify(
+      auto cache_key = makeCacheKey(blob_hash, public_key, signature);
+      if (auto cached = verificationCache().findItem(cache_key)) {
+        return *cached;
+      }
+      bool result = iroha::verify(
           blob_hash.data(), blob_hash.size(), public_key, signature);
+      verificationCache().addItem(cache_key, result);
+      return result;
     }
   }  // namespace crypto
 }  // namespace shared_model
@@ -6,6 +6,9 @@
 #ifndef IROHA_SHARED_MODEL_SHA3_256_HPP
 #define IROHA_SHARED_MODEL_SHA3_256_HPP
 
+#include <utility>
+#include <vector>
+
 #include "crypto/hash_types.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 #include "cryptography/hash.hpp"
@@ -18,6 +21,26 @@ namespace shared_model {
       static Hash makeHash(const Blob &blob) {
         return Hash(iroha::sha3_256(blob.blob()).to_string());
       }
+
+      /**
+       * Compute the hashes of many independent blobs at once; large
+       * batches are spread over hardware threads, the result order
+       * matches the input order
+       */
+      static std::vector<Hash> makeHashes(const std::vector<Blob> &blobs) {
+        std::vector<std::pair<const uint8_t *, size_t>> views;
+        views.reserve(blobs.size());
+        for (const auto &blob : blobs) {
+          views.emplace_back(blob.blob().data(), blob.blob().size());
+        }
+        auto digests = iroha::sha3_256_batch(views);
+        std::vector<Hash> hashes;
+        hashes.reserve(digests.size());
+        for (const auto &digest : digests) {
+          hashes.emplace_back(digest.to_string());
+        }
+        return hashes;
+      }
     };
   }  // namespace crypto
 }  // namespace shared_model
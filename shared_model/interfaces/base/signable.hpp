@@ -8,9 +8,11 @@
 
 #include "interfaces/base/model_primitive.hpp"
 
-#include <boost/functional/hash.hpp>
+#include <algorithm>
+#include <boost/container/small_vector.hpp>
+#include <initializer_list>
 #include <optional>
-#include <unordered_set>
+#include <utility>
 #include "cryptography/default_hash_provider.hpp"
 #include "interfaces/common_objects/range_types.hpp"
 #include "interfaces/common_objects/signature.hpp"
@@ -94,40 +96,75 @@ namespace shared_model {
 
      protected:
       /**
-       * Type of set of signatures
+       * Set of signatures, unique by the public key.
        *
-       * Note: we can't use const SignatureType due to unordered_set
-       * limitations: it requires to have write access for elements for some
-       * internal operations.
+       * A typical transaction carries one or two signatures, so the set
+       * lives in inline storage and building it does not allocate, and
+       * uniqueness is kept by a linear public key scan, which at these
+       * sizes beats hashing into buckets.
        */
+      template <typename T>
+      class SignatureSetType {
+        /// covers the common quorums without a heap allocation
+        static constexpr size_t kInlineCapacity = 4;
+
+        using StorageType = boost::container::small_vector<T, kInlineCapacity>;
 
-     protected:
-      class SignatureSetTypeOps {
        public:
-        /**
-         * @param sig is item to find hash from
-         * @return calculated hash of public key
-         */
-        template <typename T>
-        size_t operator()(const T &sig) const {
-          return std::hash<std::string>{}(sig.publicKey());
+        using value_type = T;
+        using const_iterator = typename StorageType::const_iterator;
+
+        SignatureSetType() = default;
+
+        template <typename Iterator>
+        SignatureSetType(Iterator begin, Iterator end) {
+          for (; begin != end; ++begin) {
+            emplace(*begin);
+          }
         }
 
+        SignatureSetType(std::initializer_list<T> signatures)
+            : SignatureSetType(signatures.begin(), signatures.end()) {}
+
         /**
-         * Function for set elements uniqueness by public key
-         * @param lhs
-         * @param rhs
-         * @return true, if public keys are the same
+         * Add a signature unless one with the same public key is present
+         * @return true, if the signature was added
          */
-        template <typename T>
-        bool operator()(const T &lhs, const T &rhs) const {
-          return lhs.publicKey() == rhs.publicKey();
+        template <typename... Args>
+        bool emplace(Args &&... args) {
+          T signature(std::forward<Args>(args)...);
+          if (std::find_if(storage_.begin(),
+                           storage_.end(),
+                           [&signature](const auto &existing) {
+                             return existing.publicKey()
+                                 == signature.publicKey();
+                           })
+              != storage_.end()) {
+            return false;
+          }
+          storage_.push_back(std::move(signature));
+          return true;
         }
-      };
 
-      template <typename T>
-      using SignatureSetType =
-          std::unordered_set<T, SignatureSetTypeOps, SignatureSetTypeOps>;
+        const_iterator begin() const {
+          return storage_.begin();
+        }
+
+        const_iterator end() const {
+          return storage_.end();
+        }
+
+        size_t size() const {
+          return storage_.size();
+        }
+
+        bool empty() const {
+          return storage_.empty();
+        }
+
+       private:
+        StorageType storage_;
+      };
 
      protected:
       static auto makeHash(const types::BlobType &payload) {
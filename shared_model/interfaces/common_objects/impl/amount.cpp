@@ -5,6 +5,8 @@
 
 #include "interfaces/common_objects/amount.hpp"
 
+#include <cstdint>
+
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
 #include "utils/string_builder.hpp"
@@ -49,15 +51,13 @@ struct Amount::Impl {
       } else {
         // we have nonzero digits and no dot. reuse the original string.
         string_repr_.append(first_nonzero_digit_pos, end);
-        multiprecision_repr_ =
-            boost::multiprecision::uint256_t(first_nonzero_digit_pos);
+        parseSignificantDigits(first_nonzero_digit_pos, dot_pos, end);
       }
     } else if (first_nonzero_digit_pos > dot_pos) {
       // we have a dot preceded by zeroes only. reuse the original string.
       assert(dot_pos > start and dot_pos < end);
       string_repr_.append(dot_pos - 1, end);
-      multiprecision_repr_ =
-          boost::multiprecision::uint256_t(first_nonzero_digit_pos);
+      parseSignificantDigits(first_nonzero_digit_pos, dot_pos, end);
     } else {
       // we have a decimal separator with at least one nonzero digit before it.
       assert(dot_pos < end);
@@ -65,15 +65,50 @@ struct Amount::Impl {
       // build a copy of amount string, starting with nonzero digit and having
       // no decimal separator
       string_repr_.append(first_nonzero_digit_pos, end);
-      std::string amount_without_dot;
-      amount_without_dot.append(first_nonzero_digit_pos, dot_pos);
-      amount_without_dot.append(dot_pos + 1, end);
-      multiprecision_repr_ =
-          boost::multiprecision::uint256_t(amount_without_dot);
+      parseSignificantDigits(first_nonzero_digit_pos, dot_pos, end);
     }
     precision_ = dot_pos == end ? 0 : end - dot_pos - 1;
   }
 
+  /**
+   * Parse the significant digits in [begin, end), skipping the decimal
+   * separator at dot when it falls into the range, into the
+   * multiprecision value. Amounts in practice almost always fit into one
+   * machine word, so such ones are accumulated directly; the
+   * multiprecision decimal parser and the intermediate dot-free string
+   * copy are only paid for wider amounts.
+   */
+  void parseSignificantDigits(const char *begin,
+                              const char *dot,
+                              const char *end) {
+    const bool has_dot = dot >= begin and dot < end;
+    const size_t digits = (end - begin) - (has_dot ? 1 : 0);
+
+    // 19 decimal digits always fit into 64 bits
+    static constexpr size_t kFastPathDigits = 19;
+    if (digits <= kFastPathDigits) {
+      uint64_t value = 0;
+      for (const char *c = begin; c < end; ++c) {
+        if (c != dot) {
+          value = value * 10 + static_cast<uint64_t>(*c - kZero);
+        }
+      }
+      multiprecision_repr_ = value;
+      return;
+    }
+
+    if (not has_dot) {
+      multiprecision_repr_ = boost::multiprecision::uint256_t(
+          std::string{begin, end});
+      return;
+    }
+    std::string amount_without_dot;
+    amount_without_dot.reserve(digits);
+    amount_without_dot.append(begin, dot);
+    amount_without_dot.append(dot + 1, end);
+    multiprecision_repr_ = boost::multiprecision::uint256_t(amount_without_dot);
+  }
+
   std::string string_repr_;
   interface::types::PrecisionType precision_;
   boost::multiprecision::uint256_t multiprecision_repr_;
@@ -19,7 +19,7 @@ shared_model::interface::parseAndCreateBatches(
 
   types::BatchesCollectionType batches;
   for (auto &cand : batch_candidates) {
-    auto batch = batch_factory.createTransactionBatch(cand);
+    auto batch = batch_factory.createTransactionBatch(std::move(cand));
     if (auto e = iroha::expected::resultToOptionalError(batch)) {
       return *e;
     }
@@ -104,6 +104,19 @@ namespace shared_model {
           std::unique_ptr<Block> block,
           const crypto::Hash &query_hash) const = 0;
 
+      /**
+       * Create response for get block query from the serialized form of
+       * the block as kept by BlockStorage, without constructing a block
+       * object
+       * @param serialized_block - stored serialized block
+       * @param query_hash - hash of the query, for which response is created
+       * @return block response, or nullptr if the serialized form could
+       * not be parsed - the caller falls back to createBlockResponse
+       */
+      virtual std::unique_ptr<QueryResponse> createRawBlockResponse(
+          std::string serialized_block,
+          const crypto::Hash &query_hash) const = 0;
+
       /**
        * Describes type of error to be placed inside the error query response
        */
@@ -30,12 +30,13 @@ namespace shared_model {
       /**
        * Create transaction batch out of collection of transactions
        * @param transactions collection of transactions, should be from the same
-       * batch
+       * batch; taken by value so that a caller which does not need its copy
+       * can move it all the way into the batch without refcount traffic
        * @return valid batch of transactions or string error
        */
       virtual FactoryResult<std::unique_ptr<TransactionBatch>>
       createTransactionBatch(
-          const types::SharedTxsCollectionType &transactions) const = 0;
+          types::SharedTxsCollectionType transactions) const = 0;
 
       /**
        * Creates transaction batch from single transaction
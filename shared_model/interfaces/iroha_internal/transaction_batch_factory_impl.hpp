@@ -22,7 +22,7 @@ namespace shared_model {
               batch_validator);
 
       FactoryImplResult createTransactionBatch(
-          const types::SharedTxsCollectionType &transactions) const override;
+          types::SharedTxsCollectionType transactions) const override;
 
       FactoryImplResult createTransactionBatch(
           std::shared_ptr<Transaction> transaction) const override;
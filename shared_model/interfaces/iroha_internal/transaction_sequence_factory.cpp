@@ -90,9 +90,9 @@ namespace shared_model {
                 });
       }
 
-      for (const auto &it : extracted_batches) {
+      for (auto &it : extracted_batches) {
         validation::ValidationErrorCreator batch_error_creator;
-        batch_factory->createTransactionBatch(it.second).match(
+        batch_factory->createTransactionBatch(std::move(it.second)).match(
             insert_batch, [&batch_error_creator](const auto &err) {
               batch_error_creator.addReason(fmt::format(
                   "Could not create transaction batch: {}.", err.error));
@@ -6,9 +6,11 @@
 #ifndef IROHA_SHARED_MODEL_PERMISSIONS_HPP
 #define IROHA_SHARED_MODEL_PERMISSIONS_HPP
 
-#include <bitset>
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <stdexcept>
 #include <string>
 
 namespace shared_model {
@@ -98,41 +100,164 @@ namespace shared_model {
       bool isValid(interface::permissions::Grantable perm) noexcept;
     }  // namespace permissions
 
+    /**
+     * Set of permissions over a fixed word array, so that sets of known
+     * permissions can be built at compile time. The bitstring format is
+     * the one of std::bitset, which backed this class before and is
+     * stored in the WSV: the leftmost character is the highest bit.
+     */
     template <typename Perm>
     class PermissionSet {
      public:
-      PermissionSet();
-      PermissionSet(std::initializer_list<Perm> list);
-      explicit PermissionSet(const std::string &bitstring);
+      constexpr PermissionSet() = default;
+
+      constexpr PermissionSet(std::initializer_list<Perm> list) {
+        for (auto p : list) {
+          set(p);
+        }
+      }
+
+      explicit PermissionSet(const std::string &bitstring) {
+        const size_t length = bitstring.size();
+        for (size_t i = 0; i < length; ++i) {
+          const char c = bitstring[length - 1 - i];
+          if (c != '0' and c != '1') {
+            throw std::invalid_argument(
+                "PermissionSet bitstring may contain only '0' and '1'");
+          }
+          if (c == '1' and i < size()) {
+            words_[i / kWordBits] |= kOne << (i % kWordBits);
+          }
+        }
+      }
 
       // TODO [IR-1889] Akvinikym 21.11.18: introduce toString() method
-      std::string toBitstring() const;
+      std::string toBitstring() const {
+        std::string bitstring(size(), '0');
+        for (size_t i = 0; i < size(); ++i) {
+          if (test(i)) {
+            bitstring[size() - 1 - i] = '1';
+          }
+        }
+        return bitstring;
+      }
 
       static constexpr size_t size() {
         return static_cast<size_t>(Perm::COUNT);
       }
 
-      PermissionSet &unsetAll();
-      PermissionSet &setAll();
-      PermissionSet &set(Perm p);
-      PermissionSet &unset(Perm p);
+      constexpr PermissionSet &unsetAll() {
+        for (auto &word : words_) {
+          word = 0;
+        }
+        return *this;
+      }
+
+      constexpr PermissionSet &setAll() {
+        for (auto &word : words_) {
+          word = ~kZero;
+        }
+        // bits above Perm::COUNT must stay unset for the comparison
+        // operators and toBitstring to be correct
+        const size_t tail = size() % kWordBits;
+        if (tail != 0) {
+          words_[kWords - 1] &= (kOne << tail) - 1;
+        }
+        return *this;
+      }
+
+      constexpr PermissionSet &set(Perm p) {
+        words_[bit(p) / kWordBits] |= kOne << (bit(p) % kWordBits);
+        return *this;
+      }
+
+      constexpr PermissionSet &unset(Perm p) {
+        words_[bit(p) / kWordBits] &= ~(kOne << (bit(p) % kWordBits));
+        return *this;
+      }
+
+      constexpr bool isSet(Perm p) const {
+        return test(bit(p));
+      }
 
-      bool isSet(Perm p) const;
-      bool isEmpty() const;
+      constexpr bool isEmpty() const {
+        for (auto word : words_) {
+          if (word != 0) {
+            return false;
+          }
+        }
+        return true;
+      }
 
       /// @return true if this PermissionSet is subset of given one.
-      bool isSubsetOf(const PermissionSet<Perm> &r) const;
+      constexpr bool isSubsetOf(const PermissionSet<Perm> &r) const {
+        for (size_t i = 0; i < kWords; ++i) {
+          if ((words_[i] & r.words_[i]) != words_[i]) {
+            return false;
+          }
+        }
+        return true;
+      }
 
-      bool operator==(const PermissionSet<Perm> &r) const;
-      bool operator!=(const PermissionSet<Perm> &r) const;
-      PermissionSet<Perm> &operator&=(const PermissionSet<Perm> &r);
-      PermissionSet<Perm> &operator|=(const PermissionSet<Perm> &r);
-      PermissionSet<Perm> &operator^=(const PermissionSet<Perm> &r);
+      constexpr bool operator==(const PermissionSet<Perm> &r) const {
+        for (size_t i = 0; i < kWords; ++i) {
+          if (words_[i] != r.words_[i]) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      constexpr bool operator!=(const PermissionSet<Perm> &r) const {
+        return not(*this == r);
+      }
+
+      constexpr PermissionSet<Perm> &operator&=(const PermissionSet<Perm> &r) {
+        for (size_t i = 0; i < kWords; ++i) {
+          words_[i] &= r.words_[i];
+        }
+        return *this;
+      }
+
+      constexpr PermissionSet<Perm> &operator|=(const PermissionSet<Perm> &r) {
+        for (size_t i = 0; i < kWords; ++i) {
+          words_[i] |= r.words_[i];
+        }
+        return *this;
+      }
 
-      void iterate(std::function<void(Perm)> f) const;
+      constexpr PermissionSet<Perm> &operator^=(const PermissionSet<Perm> &r) {
+        for (size_t i = 0; i < kWords; ++i) {
+          words_[i] ^= r.words_[i];
+        }
+        return *this;
+      }
+
+      void iterate(std::function<void(Perm)> f) const {
+        for (size_t i = 0; i < size(); ++i) {
+          auto perm = static_cast<Perm>(i);
+          if (isSet(perm)) {
+            f(perm);
+          }
+        }
+      }
 
      private:
-      std::bitset<static_cast<size_t>(Perm::COUNT)> perms_bitset_;
+      static constexpr size_t kWordBits = 64;
+      static constexpr size_t kWords =
+          (static_cast<size_t>(Perm::COUNT) + kWordBits - 1) / kWordBits;
+      static constexpr uint64_t kZero = 0;
+      static constexpr uint64_t kOne = 1;
+
+      static constexpr size_t bit(Perm p) {
+        return static_cast<size_t>(p);
+      }
+
+      constexpr bool test(size_t i) const {
+        return (words_[i / kWordBits] >> (i % kWordBits)) & 1;
+      }
+
+      std::array<uint64_t, kWords> words_{};
     };
 
     using RolePermissionSet = PermissionSet<permissions::Role>;
@@ -10,7 +10,9 @@
 using namespace shared_model::interface;
 
 bool TxPaginationMeta::operator==(const ModelType &rhs) const {
-  return pageSize() == rhs.pageSize() and firstTxHash() == rhs.firstTxHash();
+  return pageSize() == rhs.pageSize() and firstTxHash() == rhs.firstTxHash()
+      and firstTxTime() == rhs.firstTxTime()
+      and lastTxTime() == rhs.lastTxTime();
 }
 
 std::string TxPaginationMeta::toString() const {
@@ -21,5 +23,11 @@ std::string TxPaginationMeta::toString() const {
   if (first_tx_hash) {
     pretty_builder.appendNamed("first_tx_hash", first_tx_hash);
   }
+  if (auto first_tx_time = firstTxTime()) {
+    pretty_builder.appendNamed("first_tx_time", *first_tx_time);
+  }
+  if (auto last_tx_time = lastTxTime()) {
+    pretty_builder.appendNamed("last_tx_time", *last_tx_time);
+  }
   return pretty_builder.finalize();
 }
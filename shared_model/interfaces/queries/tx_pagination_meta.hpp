@@ -25,6 +25,12 @@ namespace shared_model {
       virtual std::optional<types::HashType> firstTxHash() const = 0;
       virtual Ordering const &ordering() const = 0;
 
+      /// Get the inclusive lower created time bound, if provided.
+      virtual std::optional<types::TimestampType> firstTxTime() const = 0;
+
+      /// Get the inclusive upper created time bound, if provided.
+      virtual std::optional<types::TimestampType> lastTxTime() const = 0;
+
       std::string toString() const override;
 
       bool operator==(const ModelType &rhs) const override;
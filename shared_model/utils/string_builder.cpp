@@ -46,5 +46,10 @@ namespace shared_model {
       return result_;
     }
 
+    void PrettyStringBuilder::clear() {
+      result_.clear();
+      need_field_separator_ = false;
+    }
+
   }  // namespace detail
 }  // namespace shared_model
@@ -62,6 +62,11 @@ namespace shared_model {
        */
       std::string finalize();
 
+      /**
+       * Discards the contents, keeping the allocated buffer for reuse.
+       */
+      void clear();
+
      private:
       std::string result_;
       bool need_field_separator_;
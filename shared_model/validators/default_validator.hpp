@@ -131,6 +131,51 @@ namespace shared_model {
                                const interface::Block &,
                                FieldValidator>;
 
+    // ---------------------| Certified data validation |----------------------
+
+    /**
+     * Transaction validator for data whose per-transaction integrity is
+     * already certified upstream - e.g. transactions inside a block carrying
+     * a supermajority commit certificate. Field and signature checks are
+     * skipped; the containing block's signatures are what is verified.
+     */
+    class CertifiedTransactionValidator {
+     public:
+      explicit CertifiedTransactionValidator(
+          std::shared_ptr<ValidatorsConfig>) {}
+
+      std::optional<ValidationError> validate(
+          const interface::Transaction &) const {
+        return std::nullopt;
+      }
+
+      std::optional<ValidationError> validate(
+          const interface::Transaction &,
+          interface::types::TimestampType) const {
+        return std::nullopt;
+      }
+    };
+
+    /**
+     * Transactions collection validator for certified data: batch structure
+     * and duplicates are still checked, the transactions themselves are not
+     */
+    using CertifiedTransactionsValidator =
+        TransactionsCollectionValidator<CertifiedTransactionValidator,
+                                        BatchOrderValidator,
+                                        true>;
+
+    /**
+     * Block validator for blocks whose contents are certified by a
+     * supermajority of peer signatures, which it verifies. Block-level
+     * fields, rejected hashes and batch structure are checked as usual,
+     * but the stateless re-validation of each transaction is skipped.
+     */
+    using CertifiedBlockValidator = SignableModelValidator<
+        BlockValidator<FieldValidator, CertifiedTransactionsValidator>,
+        const interface::Block &,
+        FieldValidator>;
+
     using DefaultBatchValidator = BatchValidator<BatchOrderValidator>;
 
   }  // namespace validation
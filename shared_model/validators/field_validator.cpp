@@ -5,13 +5,18 @@
 
 #include "validators/field_validator.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <limits>
 #include <string_view>
+#include <unordered_map>
 
 #include <fmt/core.h>
 #include <boost/algorithm/string_regex.hpp>
 #include <boost/format.hpp>
-#include <boost/range/adaptor/indexed.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/range/end.hpp>
 #include "common/bind.hpp"
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
 #include "interfaces/common_objects/account.hpp"
@@ -34,23 +39,134 @@
 using iroha::operator|;
 
 namespace {
+  // Hand-rolled matchers for the fixed grammars below. Stateless
+  // validation runs on every transaction at torii, ordering and block
+  // apply, and these fields are simple enough that a character scan beats
+  // a general regex engine by a wide margin. The regex patterns are kept
+  // as the authoritative grammar description and for the error messages.
+
+  constexpr bool isLowerAlpha(char c) {
+    return c >= 'a' and c <= 'z';
+  }
+
+  constexpr bool isAlpha(char c) {
+    return isLowerAlpha(c) or (c >= 'A' and c <= 'Z');
+  }
+
+  constexpr bool isDigit(char c) {
+    return c >= '0' and c <= '9';
+  }
+
+  constexpr bool isAlnum(char c) {
+    return isAlpha(c) or isDigit(c);
+  }
+
+  constexpr bool isHexDigit(char c) {
+    return isDigit(c) or (c >= 'a' and c <= 'f') or (c >= 'A' and c <= 'F');
+  }
+
+  /// [a-z_0-9]{1,32} - account, asset and role names
+  bool matchName(std::string_view value) {
+    return value.size() >= 1 and value.size() <= 32
+        and std::all_of(value.begin(), value.end(), [](char c) {
+             return isLowerAlpha(c) or isDigit(c) or c == '_';
+           });
+  }
+
+  /// [A-Za-z0-9_]{1,64}
+  bool matchDetailKey(std::string_view value) {
+    return value.size() >= 1 and value.size() <= 64
+        and std::all_of(value.begin(), value.end(), [](char c) {
+             return isAlnum(c) or c == '_';
+           });
+  }
+
+  /// [a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])? - one RFC1035 label
+  bool matchDomainLabel(std::string_view label) {
+    if (label.empty() or label.size() > 63) {
+      return false;
+    }
+    if (not isAlpha(label.front())) {
+      return false;
+    }
+    if (label.size() == 1) {
+      return true;
+    }
+    if (not isAlnum(label.back())) {
+      return false;
+    }
+    return std::all_of(label.begin() + 1, label.end() - 1, [](char c) {
+      return isAlnum(c) or c == '-';
+    });
+  }
+
+  /// dot-separated RFC1035 labels
+  bool matchDomain(std::string_view value) {
+    while (true) {
+      const auto dot = value.find('.');
+      if (not matchDomainLabel(value.substr(0, dot))) {
+        return false;
+      }
+      if (dot == std::string_view::npos) {
+        return true;
+      }
+      value.remove_prefix(dot + 1);
+    }
+  }
+
+  /// name, separator and domain, as in account and asset ids
+  template <char kSeparator>
+  bool matchNameAtDomain(std::string_view value) {
+    const auto separator = value.find(kSeparator);
+    return separator != std::string_view::npos
+        and matchName(value.substr(0, separator))
+        and matchDomain(value.substr(separator + 1));
+  }
+
+  /// ([0-9a-fA-F][0-9a-fA-F])* - whole bytes in hex
+  bool matchHexPairs(std::string_view value) {
+    return value.size() % 2 == 0
+        and std::all_of(value.begin(), value.end(), isHexDigit);
+  }
+
+  /// [A-Fa-f0-9]{1,kMaxLength}
+  template <size_t kMaxLength>
+  bool matchBoundedHex(std::string_view value) {
+    return value.size() >= 1 and value.size() <= kMaxLength
+        and std::all_of(value.begin(), value.end(), isHexDigit);
+  }
+
+  /// [0-9a-fA-F]{40}
+  bool matchEvmAddress(std::string_view value) {
+    return value.size() == 40
+        and std::all_of(value.begin(), value.end(), isHexDigit);
+  }
+
   class RegexValidator {
    public:
+    /// matcher equivalent to the pattern, bypassing the regex engine
+    using FastMatcher = bool (*)(std::string_view);
+
     RegexValidator(
         std::string name,
         std::string pattern,
-        std::optional<const char *> format_description = std::nullopt)
+        std::optional<const char *> format_description = std::nullopt,
+        FastMatcher fast_matcher = nullptr)
         : name_(std::move(name)),
           pattern_(std::move(pattern)),
           regex_(pattern_),
           format_description_(
               std::move(format_description) | [](std::string description) {
                 return std::string{" "} + std::move(description);
-              }) {}
+              }),
+          fast_matcher_(fast_matcher) {}
 
     std::optional<shared_model::validation::ValidationError> validate(
         std::string_view value) const {
-      if (not std::regex_match(value.begin(), value.end(), regex_)) {
+      const bool matched = fast_matcher_
+          ? fast_matcher_(value)
+          : std::regex_match(value.begin(), value.end(), regex_);
+      if (not matched) {
         return shared_model::validation::ValidationError(
             name_,
             {fmt::format("passed value: '{}' does not match regex '{}'.{}",
@@ -70,15 +186,19 @@ namespace {
     std::string pattern_;
     std::regex regex_;
     std::string format_description_;
+    FastMatcher fast_matcher_;
   };
 
-  const RegexValidator kAccountNameValidator{"AccountName",
-                                             R"#([a-z_0-9]{1,32})#"};
-  const RegexValidator kAssetNameValidator{"AssetName", R"#([a-z_0-9]{1,32})#"};
+  const RegexValidator kAccountNameValidator{
+      "AccountName", R"#([a-z_0-9]{1,32})#", std::nullopt, matchName};
+  const RegexValidator kAssetNameValidator{
+      "AssetName", R"#([a-z_0-9]{1,32})#", std::nullopt, matchName};
   const RegexValidator kDomainValidator{
       "Domain",
       R"#(([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*)#"
-      R"#([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#"};
+      R"#([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#",
+      std::nullopt,
+      matchDomain};
   static const std::string kIpV4Pattern{
       R"#(^((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\.){3})#"
       R"#(([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])))#"};
@@ -95,28 +215,42 @@ namespace {
   const RegexValidator kAccountIdValidator{"AccountId",
                                            kAccountNameValidator.getPattern()
                                                + R"#(\@)#"
-                                               + kDomainValidator.getPattern()};
+                                               + kDomainValidator.getPattern(),
+                                           std::nullopt,
+                                           matchNameAtDomain<'@'>};
   const RegexValidator kAssetIdValidator{"AssetId",
                                          kAssetNameValidator.getPattern()
                                              + R"#(\#)#"
-                                             + kDomainValidator.getPattern()};
-  const RegexValidator kAccountDetailKeyValidator{"DetailKey",
-                                                  R"([A-Za-z0-9_]{1,64})"};
-  const RegexValidator kRoleIdValidator{"RoleId", R"#([a-z_0-9]{1,32})#"};
-  const RegexValidator kHexValidator{
-      "Hex", R"#(([0-9a-fA-F][0-9a-fA-F])*)#", "Hex encoded string expected"};
+                                             + kDomainValidator.getPattern(),
+                                         std::nullopt,
+                                         matchNameAtDomain<'#'>};
+  const RegexValidator kAccountDetailKeyValidator{
+      "DetailKey", R"([A-Za-z0-9_]{1,64})", std::nullopt, matchDetailKey};
+  const RegexValidator kRoleIdValidator{
+      "RoleId", R"#([a-z_0-9]{1,32})#", std::nullopt, matchName};
+  const RegexValidator kHexValidator{"Hex",
+                                     R"#(([0-9a-fA-F][0-9a-fA-F])*)#",
+                                     "Hex encoded string expected",
+                                     matchHexPairs};
   const RegexValidator kPublicKeyHexValidator{
       "PublicKeyHex",
       fmt::format("[A-Fa-f0-9]{{1,{}}}",
-                  shared_model::crypto::CryptoVerifier::kMaxPublicKeySize * 2)};
+                  shared_model::crypto::CryptoVerifier::kMaxPublicKeySize * 2),
+      std::nullopt,
+      matchBoundedHex<shared_model::crypto::CryptoVerifier::kMaxPublicKeySize
+                      * 2>};
   const RegexValidator kSignatureHexValidator{
       "SignatureHex",
       fmt::format("[A-Fa-f0-9]{{1,{}}}",
-                  shared_model::crypto::CryptoVerifier::kMaxSignatureSize * 2)};
-  const RegexValidator kEvmAddressValidator{
-      "EvmHexAddress",
-      R"#([0-9a-fA-F]{40})#",
-      "Hex encoded 20-byte address expected"};
+                  shared_model::crypto::CryptoVerifier::kMaxSignatureSize * 2),
+      std::nullopt,
+      matchBoundedHex<shared_model::crypto::CryptoVerifier::kMaxSignatureSize
+                      * 2>};
+  const RegexValidator kEvmAddressValidator{"EvmHexAddress",
+                                            R"#([0-9a-fA-F]{40})#",
+                                            "Hex encoded 20-byte address "
+                                            "expected",
+                                            matchEvmAddress};
 }  // namespace
 
 namespace shared_model {
@@ -323,27 +457,61 @@ namespace shared_model {
         error_creator.addReason("Signatures are empty.");
       }
 
-      for (auto signature : signatures | boost::adaptors::indexed(1)) {
-        ValidationErrorCreator sig_error_creator;
+      std::vector<std::reference_wrapper<const interface::Signature>> sig_refs(
+          boost::begin(signatures), boost::end(signatures));
+      const size_t size = sig_refs.size();
+
+      // all signatures of a multisignature transaction or a block sign the
+      // same payload, so the cryptographic checks of the well-formed ones
+      // are batched into a single verifier call; identical (public key,
+      // signature) pairs - which only adversarial over-signed submissions
+      // contain - are verified once and the result is shared between the
+      // occurrences
+      using namespace shared_model::interface::types;
+      constexpr size_t kNotInBatch = std::numeric_limits<size_t>::max();
+      std::vector<std::optional<ValidationError>> form_errors(size);
+      std::vector<shared_model::crypto::CryptoVerifier::BatchItem> batch;
+      std::vector<size_t> batch_slots(size, kNotInBatch);
+      std::unordered_map<std::string, size_t> slot_of_pair;
+      for (size_t index = 0; index < size; ++index) {
+        const interface::Signature &signature = sig_refs[index];
+        form_errors[index] = validateSignatureForm(signature);
+        if (not form_errors[index]) {
+          // '/' cannot occur in the hex strings, so the key is unambiguous
+          auto pair_key = signature.publicKey() + "/" + signature.signedData();
+          auto emplaced = slot_of_pair.emplace(std::move(pair_key), batch.size());
+          if (emplaced.second) {
+            batch.push_back({SignedHexStringView{signature.signedData()},
+                             source,
+                             PublicKeyHexStringView{signature.publicKey()}});
+          }
+          batch_slots[index] = emplaced.first->second;
+        }
+      }
 
-        auto sig_format_error = validateSignatureForm(signature.value());
-        sig_error_creator |= sig_format_error;
-
-        if (not sig_format_error) {
-          using namespace shared_model::interface::types;
-          if (auto e = resultToOptionalError(
-                  shared_model::crypto::CryptoVerifier::verify(
-                      SignedHexStringView{signature.value().signedData()},
-                      source,
-                      PublicKeyHexStringView{signature.value().publicKey()}))) {
-            sig_error_creator.addReason(e.value());
+      auto batch_results =
+          shared_model::crypto::CryptoVerifier::verifyBatch(batch);
+      std::vector<const char *> crypto_errors(size, nullptr);
+      for (size_t index = 0; index < size; ++index) {
+        if (batch_slots[index] != kNotInBatch) {
+          if (auto e = resultToOptionalError(batch_results[batch_slots[index]])) {
+            crypto_errors[index] = e.value();
           }
         }
+      }
+
+      for (size_t index = 0; index < size; ++index) {
+        ValidationErrorCreator sig_error_creator;
+        sig_error_creator |= std::move(form_errors[index]);
+        if (crypto_errors[index]) {
+          sig_error_creator.addReason(crypto_errors[index]);
+        }
         error_creator |= std::move(sig_error_creator)
                              .getValidationErrorWithGeneratedName([&] {
-                               return fmt::format("Signature #{} ({})",
-                                                  signature.index(),
-                                                  signature.value().toString());
+                               return fmt::format(
+                                   "Signature #{} ({})",
+                                   index + 1,
+                                   sig_refs[index].get().toString());
                              });
       }
       return std::move(error_creator).getValidationError("Signatures list");
@@ -408,6 +576,19 @@ namespace shared_model {
       return std::nullopt;
     }
 
+    std::optional<ValidationError> validatePaginationMetaTimeWindow(
+        const std::optional<interface::types::TimestampType> &first_tx_time,
+        const std::optional<interface::types::TimestampType> &last_tx_time) {
+      if (first_tx_time and last_tx_time and *first_tx_time > *last_tx_time) {
+        return ValidationError(
+            "TimeWindow",
+            {fmt::format("first_tx_time {} is after last_tx_time {}.",
+                         *first_tx_time,
+                         *last_tx_time)});
+      }
+      return std::nullopt;
+    }
+
     std::optional<ValidationError> validatePaginationOrdering(
         const interface::Ordering &ordering) {
       using Field = interface::Ordering::Field;
@@ -445,6 +626,8 @@ namespace shared_model {
                [this](const auto &first_hash) {
                  return this->validateHash(first_hash);
                },
+           validatePaginationMetaTimeWindow(tx_pagination_meta.firstTxTime(),
+                                            tx_pagination_meta.lastTxTime()),
            validatePaginationOrdering(tx_pagination_meta.ordering())});
     }
 
@@ -6,7 +6,11 @@
 #include "validators/transactions_collection/transactions_collection_validator.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <future>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/core.h>
 #include <boost/range/adaptor/indexed.hpp>
@@ -20,6 +24,11 @@
 #include "validators/transactions_collection/batch_order_validator.hpp"
 #include "validators/validation_error_helpers.hpp"
 
+namespace {
+  /// collections smaller than this are validated on the calling thread
+  constexpr size_t kParallelValidationChunkSize = 16;
+}  // namespace
+
 namespace shared_model {
   namespace validation {
 
@@ -55,27 +64,65 @@ namespace shared_model {
         return std::move(error_creator).getValidationError("Transaction list");
       }
 
+      std::vector<std::reference_wrapper<const interface::Transaction>> txs;
+      for (const auto &tx : transactions) {
+        txs.emplace_back(tx);
+      }
+      const size_t size = txs.size();
+
+      // per-transaction stateless validation is independent of the other
+      // transactions, so a large collection is sharded over a pool of
+      // workers; the errors are assembled sequentially below to keep their
+      // order deterministic
+      std::vector<std::optional<ValidationError>> tx_errors(size);
+      auto validate_range = [&](size_t begin, size_t end) {
+        for (size_t index = begin; index < end; ++index) {
+          tx_errors[index] = validator(txs[index].get());
+        }
+      };
+      const size_t hardware_tasks =
+          std::max<size_t>(1, std::thread::hardware_concurrency());
+      const size_t tasks =
+          std::min(hardware_tasks, size / kParallelValidationChunkSize);
+      if (tasks <= 1) {
+        validate_range(0, size);
+      } else {
+        std::vector<std::future<void>> chunks;
+        chunks.reserve(tasks);
+        for (size_t task = 0; task < tasks; ++task) {
+          const size_t begin = task * size / tasks;
+          const size_t end = (task + 1) * size / tasks;
+          chunks.push_back(std::async(std::launch::async,
+                                      [&validate_range, begin, end] {
+                                        validate_range(begin, end);
+                                      }));
+        }
+        for (auto &chunk : chunks) {
+          chunk.get();
+        }
+      }
+
       std::unordered_map<shared_model::crypto::Hash,
                          size_t,
                          shared_model::crypto::Hash::Hasher>
           tx_number_by_hash;
-      for (auto tx : transactions | boost::adaptors::indexed(1)) {
+      for (size_t index = 0; index < size; ++index) {
+        const auto &tx = txs[index].get();
         ValidationErrorCreator tx_error_creator;
         if (not txs_duplicates_allowed_) {
-          auto emplace_result =
-              tx_number_by_hash.emplace(tx.value().hash(), tx.index());
+          auto emplace_result = tx_number_by_hash.emplace(tx.hash(), index + 1);
           if (not emplace_result.second) {
             tx_error_creator.addReason(fmt::format(
                 "Duplicates transaction #{}.", emplace_result.first->second));
           }
         }
-        tx_error_creator |= std::forward<Validator>(validator)(tx.value());
+        tx_error_creator |= std::move(tx_errors[index]);
         error_creator |=
             std::move(tx_error_creator)
                 .getValidationErrorWithGeneratedName([&] {
                   return fmt::format("Transaction #{} with hash {}",
-                                     tx.index(),
-                                     tx.value().hash().hex());
+                                     index + 1,
+                                     tx.hash().hex());
                 });
       }
 
@@ -172,5 +219,10 @@ namespace shared_model {
         BatchOrderValidator,
         false>;
 
+    template class TransactionsCollectionValidator<
+        CertifiedTransactionValidator,
+        BatchOrderValidator,
+        true>;
+
   }  // namespace validation
 }  // namespace shared_model
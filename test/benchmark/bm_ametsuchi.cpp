@@ -0,0 +1,160 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmark of the storage commit path: blocks of transfer commands between
+ * a configurable number of accounts are executed and committed through the
+ * whole pipeline, exercising PostgresCommandExecutor, the block index and
+ * MutableStorageImpl::commit. Transfer pairs follow a Zipf distribution, so
+ * a few hot accounts absorb most of the traffic as they do in production.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <boost/filesystem.hpp>
+#include "backend/protobuf/transaction.hpp"
+#include "benchmark/bm_utils.hpp"
+#include "builders/protobuf/unsigned_proto.hpp"
+#include "datetime/time.hpp"
+#include "framework/integration_framework/integration_test_framework.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "module/shared_model/cryptography/crypto_defaults.hpp"
+
+using namespace benchmark::utils;
+using namespace common_constants;
+using shared_model::interface::types::PublicKeyHexStringView;
+
+namespace {
+  /// transactions per block; the proposal timeouts are set to hours, so
+  /// every sent chunk must fill a proposal exactly
+  constexpr int kBlockSize = 100;
+
+  constexpr const char *kInitialBalance = "1000000.0";
+  constexpr const char *kTransferAmount = "0.1";
+
+  /// Zipf-distributed ranks over [0, size); lower ranks are sampled more
+  /// often. Sampling is an inverse-CDF lookup over precomputed cumulative
+  /// weights, seeded deterministically so runs are comparable.
+  class ZipfGenerator {
+   public:
+    explicit ZipfGenerator(size_t size, double exponent = 1.0) : rng_(1) {
+      cumulative_.reserve(size);
+      double sum = 0;
+      for (size_t rank = 1; rank <= size; ++rank) {
+        sum += 1.0 / std::pow(static_cast<double>(rank), exponent);
+        cumulative_.push_back(sum);
+      }
+    }
+
+    size_t operator()() {
+      std::uniform_real_distribution<double> dist(0, cumulative_.back());
+      auto it = std::lower_bound(
+          cumulative_.begin(), cumulative_.end(), dist(rng_));
+      return it - cumulative_.begin();
+    }
+
+   private:
+    std::vector<double> cumulative_;
+    std::mt19937 rng_;
+  };
+}  // namespace
+
+/**
+ * Measures committed transfer commands per second with the given number of
+ * accounts (state.range(0), must be a multiple of kBlockSize / 2 so account
+ * setup fills whole proposals).
+ */
+static void BM_TransferCommit(benchmark::State &state) {
+  const auto accounts_count = static_cast<size_t>(state.range(0));
+
+  integration_framework::IntegrationTestFramework itf(
+      kBlockSize,
+      boost::none,
+      iroha::StartupWsvDataPolicy::kDrop,
+      false,
+      false,
+      (boost::filesystem::temp_directory_path()
+       / boost::filesystem::unique_path())
+          .string(),
+      std::chrono::hours(1),
+      std::chrono::hours(1));
+  itf.setInitialState(kAdminKeypair);
+
+  std::vector<shared_model::crypto::Keypair> keypairs;
+  std::vector<std::string> account_ids;
+  keypairs.reserve(accounts_count);
+  account_ids.reserve(accounts_count);
+
+  // each account takes two transactions: creation with a transfer-capable
+  // role, and crediting the initial balance; kBlockSize / 2 accounts per
+  // committed block
+  for (size_t i = 0; i < accounts_count; ++i) {
+    const auto name = "user" + std::to_string(i);
+    keypairs.push_back(
+        shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair());
+    account_ids.push_back(name + "@" + kDomain);
+    itf.sendTx(createUserWithPerms(
+                   name,
+                   PublicKeyHexStringView{keypairs.back().publicKey()},
+                   kRole + std::to_string(i),
+                   {shared_model::interface::permissions::Role::kAddAssetQty,
+                    shared_model::interface::permissions::Role::kTransfer,
+                    shared_model::interface::permissions::Role::kReceive})
+                   .build()
+                   .signAndAddSignature(kAdminKeypair)
+                   .finish());
+    itf.sendTx(TestUnsignedTransactionBuilder()
+                   .creatorAccountId(account_ids.back())
+                   .createdTime(iroha::time::now())
+                   .quorum(1)
+                   .addAssetQuantity(kAssetId, kInitialBalance)
+                   .build()
+                   .signAndAddSignature(keypairs.back())
+                   .finish());
+    if ((i + 1) % (kBlockSize / 2) == 0) {
+      itf.skipProposal().skipBlock();
+    }
+  }
+
+  ZipfGenerator pick_account(accounts_count);
+
+  while (state.KeepRunning()) {
+    for (int i = 0; i < kBlockSize; ++i) {
+      auto src = pick_account();
+      auto dest = pick_account();
+      if (dest == src) {
+        dest = (src + 1) % accounts_count;
+      }
+      itf.sendTx(TestUnsignedTransactionBuilder()
+                     .creatorAccountId(account_ids[src])
+                     .createdTime(iroha::time::now())
+                     .quorum(1)
+                     .transferAsset(account_ids[src],
+                                    account_ids[dest],
+                                    kAssetId,
+                                    "transfer",
+                                    kTransferAmount)
+                     .build()
+                     .signAndAddSignature(keypairs[src])
+                     .finish());
+    }
+    itf.skipProposal().skipBlock();
+  }
+  state.SetItemsProcessed(state.iterations() * kBlockSize);
+  itf.done();
+}
+
+BENCHMARK(BM_TransferCommit)
+    ->Arg(50)
+    ->Arg(200)
+    ->Arg(800)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
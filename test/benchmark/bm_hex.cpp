@@ -0,0 +1,48 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstdlib>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "common/hexutils.hpp"
+
+/**
+ * Hex conversion sits on the commit path of every hash, public key and
+ * signature and dominates the JSON round-trips of the genesis tooling.
+ * These benchmarks cover the sizes of those payloads: 32/64 byte keys and
+ * signatures up to whole serialized transactions.
+ */
+
+static std::string ConstructRandomBytes(size_t size) {
+  std::string s(size, '\0');
+  for (auto &c : s) {
+    c = static_cast<char>(std::rand() % 256);
+  }
+  return s;
+}
+
+static void BM_BytestringToHexstring(benchmark::State &state) {
+  auto data = ConstructRandomBytes(state.range(0));
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(iroha::bytestringToHexstring(data));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BytestringToHexstring)->RangeMultiplier(4)->Range(1 << 5, 1 << 20);
+
+static void BM_HexstringToBytestring(benchmark::State &state) {
+  auto hex = iroha::bytestringToHexstring(ConstructRandomBytes(state.range(0)));
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(iroha::hexstringToBytestringResult(hex));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HexstringToBytestring)->RangeMultiplier(4)->Range(1 << 5, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,156 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Benchmarks of the on-demand ordering service hot path: batch ingest,
+ * proposal packing on collaboration outcome, and erasure of committed
+ * transactions from the batch cache. Transaction generation and signing
+ * are kept outside of the measured sections.
+ */
+
+#include <memory>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/irohad/ordering/mock_proposal_creation_strategy.hpp"
+#include "module/shared_model/cryptography/crypto_defaults.hpp"
+#include "module/shared_model/validators/validators.hpp"
+#include "ordering/impl/on_demand_common.hpp"
+#include "ordering/impl/on_demand_ordering_service_impl.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+
+using shared_model::interface::Proposal;
+using shared_model::validation::MockValidator;
+using MockProposalValidator = MockValidator<Proposal>;
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+
+namespace {
+  constexpr uint64_t kTransactionLimit = 10000;
+  constexpr uint32_t kProposalLimit = 5;
+
+  std::shared_ptr<OnDemandOrderingService> makeOrderingService() {
+    auto factory = std::make_unique<
+        shared_model::proto::ProtoProposalFactory<MockProposalValidator>>(
+        iroha::test::kTestsValidatorsConfig);
+    auto tx_cache =
+        std::make_unique<NiceMock<iroha::ametsuchi::MockTxPresenceCache>>();
+    // every batch is new
+    ON_CALL(
+        *tx_cache,
+        check(
+            testing::Matcher<const shared_model::interface::TransactionBatch &>(
+                _)))
+        .WillByDefault(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+            iroha::ametsuchi::tx_cache_status_responses::Missing()}));
+    auto proposal_creation_strategy =
+        std::make_shared<NiceMock<MockProposalCreationStrategy>>();
+    ON_CALL(*proposal_creation_strategy, shouldCreateRound(_))
+        .WillByDefault(Return(true));
+    return std::make_shared<OnDemandOrderingServiceImpl>(
+        kTransactionLimit,
+        std::move(factory),
+        std::move(tx_cache),
+        proposal_creation_strategy,
+        getTestLogger("OdOrderingService"),
+        kProposalLimit);
+  }
+
+  /// single-transaction batches with distinct creation times, so no two
+  /// batches are ever deduplicated against each other
+  OnDemandOrderingService::CollectionType generateBatches(
+      uint64_t count, shared_model::interface::types::TimestampType base_time) {
+    OnDemandOrderingService::CollectionType collection;
+    collection.reserve(count);
+    for (uint64_t i = 0; i < count; ++i) {
+      collection.push_back(
+          std::make_unique<shared_model::interface::TransactionBatchImpl>(
+              shared_model::interface::types::SharedTxsCollectionType{
+                  std::make_unique<shared_model::proto::Transaction>(
+                      shared_model::proto::TransactionBuilder()
+                          .createdTime(base_time + i)
+                          .creatorAccountId("foo@bar")
+                          .createAsset("asset", "domain", 1)
+                          .quorum(1)
+                          .build()
+                          .signAndAddSignature(
+                              shared_model::crypto::DefaultCryptoAlgorithmType::
+                                  generateKeypair())
+                          .finish())}));
+    }
+    return collection;
+  }
+}  // namespace
+
+/// cost of accepting a burst of batches into the batch cache
+static void BM_OnBatchesIngest(benchmark::State &state) {
+  const auto batches_count = static_cast<uint64_t>(state.range(0));
+  auto base_time = iroha::time::now();
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    auto os = makeOrderingService();
+    auto batches = generateBatches(batches_count, base_time);
+    base_time += batches_count;
+    state.ResumeTiming();
+
+    os->onBatches(std::move(batches));
+  }
+  state.SetItemsProcessed(state.iterations() * batches_count);
+}
+BENCHMARK(BM_OnBatchesIngest)->RangeMultiplier(4)->Range(8, 512);
+
+/// cost of packing the cached batches into proposals when a round closes
+static void BM_ProposalPacking(benchmark::State &state) {
+  const auto batches_count = static_cast<uint64_t>(state.range(0));
+  auto os = makeOrderingService();
+  os->onBatches(generateBatches(batches_count, iroha::time::now()));
+
+  consensus::BlockRoundType height = 2;
+  while (state.KeepRunning()) {
+    os->onCollaborationOutcome({height++, kFirstRejectRound});
+  }
+  state.SetItemsProcessed(state.iterations() * batches_count);
+}
+BENCHMARK(BM_ProposalPacking)->RangeMultiplier(4)->Range(8, 512);
+
+/// cost of erasing committed transactions from the batch cache
+static void BM_CommittedBatchesErase(benchmark::State &state) {
+  const auto batches_count = static_cast<uint64_t>(state.range(0));
+  auto base_time = iroha::time::now();
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    auto os = makeOrderingService();
+    auto batches = generateBatches(batches_count, base_time);
+    base_time += batches_count;
+    OnDemandOrderingService::HashesSetType hashes;
+    for (const auto &batch : batches) {
+      for (const auto &tx : batch->transactions()) {
+        hashes.insert(tx->hash());
+      }
+    }
+    os->onBatches(std::move(batches));
+    state.ResumeTiming();
+
+    os->onTxsCommitted(hashes);
+  }
+  state.SetItemsProcessed(state.iterations() * batches_count);
+}
+BENCHMARK(BM_CommittedBatchesErase)->RangeMultiplier(4)->Range(8, 512);
+
+BENCHMARK_MAIN();
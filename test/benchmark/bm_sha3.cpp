@@ -0,0 +1,43 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstdlib>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+
+auto ConstructRandomVector(size_t size) {
+  using T = uint8_t;
+  std::vector<T> v;
+  v.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    v.push_back(static_cast<T>(std::rand() % 256));
+  }
+  return v;
+}
+
+static void BM_Sha3_256(benchmark::State &state) {
+  auto data = ConstructRandomVector(state.range(0));
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(iroha::sha3_256(data.data(), data.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Sha3_256)->RangeMultiplier(4)->Range(1 << 6, 1 << 20);
+
+static void BM_Sha3_512(benchmark::State &state) {
+  auto data = ConstructRandomVector(state.range(0));
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(iroha::sha3_512(data.data(), data.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Sha3_512)->RangeMultiplier(4)->Range(1 << 6, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,306 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Deterministic in-process simulation of a YAC cluster. N Yac instances
+ * exchange votes through a simulated transport with configurable latency,
+ * jitter and loss, driven by a single virtual-time event queue, so timeout
+ * and peer-count effects can be evaluated without a real deployment. The
+ * benchmark reports rounds per second of simulation throughput and the
+ * virtual time until the first and the last peer commit as counters.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include "consensus/yac/cluster_order.hpp"
+#include "consensus/yac/storage/buffered_cleanup_strategy.hpp"
+#include "consensus/yac/supermajority_checker.hpp"
+#include "consensus/yac/timer.hpp"
+#include "consensus/yac/transport/yac_network_interface.hpp"
+#include "consensus/yac/yac.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "module/irohad/consensus/yac/mock_yac_crypto_provider.hpp"
+#include "module/irohad/consensus/yac/yac_test_util.hpp"
+
+using namespace iroha::consensus;
+using namespace iroha::consensus::yac;
+
+namespace {
+  /// virtual-time event queue; ties are broken by insertion order so runs
+  /// are fully reproducible
+  class EventQueue {
+   public:
+    void schedule(double delay_ms, std::function<void()> action) {
+      events_.push(Event{now_ms_ + delay_ms, seq_++, std::move(action)});
+    }
+
+    bool runOne() {
+      if (events_.empty()) {
+        return false;
+      }
+      auto event = events_.top();
+      events_.pop();
+      now_ms_ = event.time_ms;
+      event.action();
+      return true;
+    }
+
+    void clear() {
+      events_ = {};
+    }
+
+    double nowMs() const {
+      return now_ms_;
+    }
+
+   private:
+    struct Event {
+      double time_ms;
+      uint64_t seq;
+      std::function<void()> action;
+
+      bool operator>(const Event &other) const {
+        return std::tie(time_ms, seq) > std::tie(other.time_ms, other.seq);
+      }
+    };
+
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>>
+        events_;
+    double now_ms_{0};
+    uint64_t seq_{0};
+  };
+
+  struct DelayModel {
+    double latency_ms;
+    double jitter_ms;
+    double loss_probability;
+  };
+
+  /// per-peer timer firing through the virtual clock; deny() invalidates
+  /// the pending invocation, as the real timer does
+  class SimTimer : public Timer {
+   public:
+    SimTimer(EventQueue &queue, double timeout_ms)
+        : queue_(queue), timeout_ms_(timeout_ms) {}
+
+    void invokeAfterDelay(std::function<void()> handler) override {
+      auto generation = ++generation_;
+      queue_.schedule(timeout_ms_,
+                      [this, generation, handler = std::move(handler)] {
+                        if (generation == generation_) {
+                          handler();
+                        }
+                      });
+    }
+
+    void deny() override {
+      ++generation_;
+    }
+
+   private:
+    EventQueue &queue_;
+    double timeout_ms_;
+    uint64_t generation_{0};
+  };
+
+  /// delivers votes between the in-process peers with sampled delay and
+  /// loss; peers are addressed by the address field of the mock peer
+  class SimNetwork : public YacNetwork {
+   public:
+    SimNetwork(EventQueue &queue,
+               const DelayModel &delay,
+               std::mt19937 &rng,
+               const std::unordered_map<std::string, size_t> &peer_index,
+               std::vector<std::shared_ptr<YacNetworkNotifications>> &handlers)
+        : queue_(queue),
+          delay_(delay),
+          rng_(rng),
+          peer_index_(peer_index),
+          handlers_(handlers) {}
+
+    void subscribe(
+        std::shared_ptr<YacNetworkNotifications> handler) override {
+      handlers_.push_back(std::move(handler));
+    }
+
+    void sendState(const shared_model::interface::Peer &to,
+                   const std::vector<VoteMessage> &state) override {
+      if (stopped_) {
+        return;
+      }
+      if (std::bernoulli_distribution(delay_.loss_probability)(rng_)) {
+        return;
+      }
+      auto target = peer_index_.at(to.address());
+      std::uniform_real_distribution<double> jitter(-delay_.jitter_ms,
+                                                    delay_.jitter_ms);
+      auto delay_ms = std::max(0.1, delay_.latency_ms + jitter(rng_));
+      queue_.schedule(delay_ms, [this, target, state] {
+        handlers_.at(target)->onState(state);
+      });
+    }
+
+    void stop() override {
+      stopped_ = true;
+    }
+
+   private:
+    EventQueue &queue_;
+    DelayModel delay_;
+    std::mt19937 &rng_;
+    const std::unordered_map<std::string, size_t> &peer_index_;
+    std::vector<std::shared_ptr<YacNetworkNotifications>> &handlers_;
+    bool stopped_{false};
+  };
+
+  class YacCluster {
+   public:
+    YacCluster(size_t peers_count, DelayModel delay, double vote_timeout_ms)
+        : rng_(1) {
+      std::vector<std::shared_ptr<shared_model::interface::Peer>> peers;
+      for (size_t i = 0; i < peers_count; ++i) {
+        peers.push_back(makePeer(std::to_string(i)));
+        peer_index_[peers.back()->address()] = i;
+      }
+      auto ordering = ClusterOrdering::create(peers);
+      assert(ordering);
+      order_ = std::make_unique<ClusterOrdering>(ordering.value());
+
+      for (size_t i = 0; i < peers_count; ++i) {
+        auto crypto =
+            std::make_shared<testing::NiceMock<MockYacCryptoProvider>>(
+                shared_model::interface::types::PublicKeyHexStringView{
+                    peers[i]->pubkey()});
+        ON_CALL(*crypto, verify(testing::_))
+            .WillByDefault(testing::Return(true));
+        auto network = std::make_shared<SimNetwork>(
+            queue_, delay, rng_, peer_index_, handlers_);
+        auto yac = Yac::create(
+            YacVoteStorage(
+                std::make_shared<BufferedCleanupStrategy>(),
+                getSupermajorityChecker(ConsistencyModel::kBft),
+                getTestLoggerManager()->getChild("YacVoteStorage")),
+            network,
+            crypto,
+            std::make_shared<SimTimer>(queue_, vote_timeout_ms),
+            *order_,
+            Round{1, 1},
+            rxcpp::observe_on_one_worker(
+                rxcpp::schedulers::make_current_thread()),
+            getTestLogger("Yac"));
+        network->subscribe(yac);
+        yac->onOutcome().subscribe([this](const auto &) {
+          ++outcomes_;
+          if (first_outcome_ms_ < 0) {
+            first_outcome_ms_ = queue_.nowMs();
+          }
+          last_outcome_ms_ = queue_.nowMs();
+        });
+        yacs_.push_back(std::move(yac));
+      }
+    }
+
+    /// votes on all peers and drains the event queue until every peer
+    /// reports an outcome; returns false if the round did not converge
+    bool runRound(BlockRoundType height) {
+      outcomes_ = 0;
+      first_outcome_ms_ = -1;
+      auto round_start_ms = queue_.nowMs();
+
+      YacHash hash(Round{height, 1},
+                   "proposal_" + std::to_string(height),
+                   "block_" + std::to_string(height));
+      hash.block_signature = createSig();
+      for (auto &yac : yacs_) {
+        yac->vote(hash, *order_);
+      }
+
+      // vote retries reschedule themselves, so the queue never drains on
+      // its own; the step cap bails out of rounds which cannot converge
+      constexpr size_t kMaxEventsPerRound = 1 << 20;
+      for (size_t steps = 0;
+           outcomes_ < yacs_.size() and steps < kMaxEventsPerRound;
+           ++steps) {
+        if (not queue_.runOne()) {
+          break;
+        }
+      }
+      queue_.clear();
+
+      first_commit_latency_ms_ = first_outcome_ms_ - round_start_ms;
+      last_commit_latency_ms_ = last_outcome_ms_ - round_start_ms;
+      return outcomes_ == yacs_.size();
+    }
+
+    double firstCommitLatencyMs() const {
+      return first_commit_latency_ms_;
+    }
+
+    double lastCommitLatencyMs() const {
+      return last_commit_latency_ms_;
+    }
+
+   private:
+    EventQueue queue_;
+    std::mt19937 rng_;
+    std::unordered_map<std::string, size_t> peer_index_;
+    std::vector<std::shared_ptr<YacNetworkNotifications>> handlers_;
+    std::vector<std::shared_ptr<Yac>> yacs_;
+    std::unique_ptr<ClusterOrdering> order_;
+
+    size_t outcomes_{0};
+    double first_outcome_ms_{-1};
+    double last_outcome_ms_{-1};
+    double first_commit_latency_ms_{0};
+    double last_commit_latency_ms_{0};
+  };
+
+  void runSimulation(benchmark::State &state, DelayModel delay) {
+    const auto peers_count = static_cast<size_t>(state.range(0));
+    constexpr double kVoteTimeoutMs = 100;
+    YacCluster cluster(peers_count, delay, kVoteTimeoutMs);
+
+    BlockRoundType height = 1;
+    double first_sum = 0, last_sum = 0;
+    while (state.KeepRunning()) {
+      if (not cluster.runRound(height++)) {
+        state.SkipWithError("round did not converge");
+        return;
+      }
+      first_sum += cluster.firstCommitLatencyMs();
+      last_sum += cluster.lastCommitLatencyMs();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["sim_first_commit_ms"] = first_sum / state.iterations();
+    state.counters["sim_last_commit_ms"] = last_sum / state.iterations();
+  }
+}  // namespace
+
+/// ideal network: uniform low latency, no loss
+static void BM_YacRound(benchmark::State &state) {
+  runSimulation(state, DelayModel{5.0, 1.0, 0.0});
+}
+BENCHMARK(BM_YacRound)->Arg(4)->Arg(7)->Arg(13)->Arg(25)->Arg(49);
+
+/// degraded network: WAN-like latency with jitter and packet loss, which
+/// exercises the timer-driven vote retransmissions
+static void BM_YacRoundLossy(benchmark::State &state) {
+  runSimulation(state, DelayModel{50.0, 20.0, 0.05});
+}
+BENCHMARK(BM_YacRoundLossy)->Arg(4)->Arg(7)->Arg(13)->Arg(25);
+
+BENCHMARK_MAIN();
@@ -227,7 +227,7 @@ namespace framework {
               batch_validator);
       auto txs =
           createBatchOneSignTransactions(transaction_fields, created_time);
-      auto result_batch = batch_factory->createTransactionBatch(txs);
+      auto result_batch = batch_factory->createTransactionBatch(std::move(txs));
 
       return framework::expected::val(result_batch).value().value;
     }
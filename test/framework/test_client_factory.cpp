@@ -46,7 +46,9 @@ namespace iroha {
           std::make_unique<ChannelFactory>(params);
 
       return std::make_unique<GenericClientFactory>(
-          std::make_unique<ChannelPool>(std::move(channel_factory)));
+          std::make_unique<ChannelPool>(
+              std::move(channel_factory),
+              log_manager->getChild("ChannelPool")->getLogger()));
     }
 
     std::shared_ptr<grpc::Channel> createSecureChannel(
@@ -98,6 +98,8 @@ struct QueryFixture {
         qry_processor_,
         query_factory,
         blocks_query_factory,
+        rxcpp::observable<>::empty<
+            std::shared_ptr<const shared_model::interface::Block>>(),
         logger::getDummyLoggerPtr());
   }
 };
@@ -127,6 +127,7 @@ struct CommandFixture {
         status_factory,
         cache_,
         tx_presence_cache_,
+        boost::none,
         logger::getDummyLoggerPtr());
     service_transport_ =
         std::make_shared<iroha::torii::CommandServiceTransportGrpc>(
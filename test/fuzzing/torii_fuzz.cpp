@@ -92,6 +92,7 @@ struct CommandFixture {
         status_factory,
         cache_,
         tx_presence_cache_,
+        boost::none,
         logger::getDummyLoggerPtr());
 
     std::unique_ptr<shared_model::validation::AbstractValidator<
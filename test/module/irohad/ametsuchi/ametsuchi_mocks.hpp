@@ -104,6 +104,14 @@ namespace iroha {
       MOCK_METHOD1(apply,
                    expected::Result<void, validation::CommandError>(
                        const shared_model::interface::Transaction &));
+      MOCK_METHOD1(
+          validateSignatures,
+          std::vector<expected::Result<void, validation::CommandError>>(
+              const std::vector<std::reference_wrapper<
+                  const shared_model::interface::Transaction>> &));
+      MOCK_METHOD1(applyPrevalidated,
+                   expected::Result<void, validation::CommandError>(
+                       const shared_model::interface::Transaction &));
       MOCK_METHOD1(
           createSavepoint,
           std::unique_ptr<TemporaryWsv::SavepointWrapper>(const std::string &));
@@ -415,6 +415,7 @@ TEST_F(AmetsuchiTest, TestingStorageWhenInsertBlock) {
 
   ASSERT_NE(0, wsv->getPeers().value().size());
 
+  ASSERT_TRUE(storage->flushCommitNotifications(std::chrono::seconds(10)));
   ASSERT_TRUE(wrapper.validate());
   wrapper.unsubscribe();
 }
@@ -441,6 +442,7 @@ TEST_F(AmetsuchiTest, TestingStorageWhenCommitBlock) {
 
   ASSERT_TRUE(val(storage->commit(std::move(mutable_storage))));
 
+  ASSERT_TRUE(storage->flushCommitNotifications(std::chrono::seconds(10)));
   ASSERT_TRUE(wrapper.validate());
   wrapper.unsubscribe();
 }
@@ -736,6 +738,7 @@ TEST_F(AmetsuchiTest, TestingWsvAfterCommitBlock) {
 
   apply(storage, expected_block);
 
+  ASSERT_TRUE(storage->flushCommitNotifications(std::chrono::seconds(10)));
   ASSERT_TRUE(wrapper.validate());
   wrapper.unsubscribe();
 }
@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/async_commit_notifier.hpp"
+
+#include <atomic>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+/**
+ * @given a notifier with a recording subscriber
+ * @when several blocks are enqueued
+ * @then all of them are delivered in their enqueue order
+ */
+TEST(AsyncCommitNotifierTest, DeliversAllInOrder) {
+  std::vector<uint64_t> heights;
+  AsyncCommitNotifier notifier(
+      [&](auto block) { heights.push_back(block->height()); },
+      getTestLogger("AsyncCommitNotifier"));
+
+  for (uint64_t height = 1; height <= 5; ++height) {
+    auto block = std::make_shared<NiceMock<MockBlock>>();
+    ON_CALL(*block, height()).WillByDefault(Return(height));
+    notifier.enqueue(block);
+  }
+
+  ASSERT_TRUE(notifier.waitUntilDelivered(10s));
+  ASSERT_EQ(heights, std::vector<uint64_t>({1, 2, 3, 4, 5}));
+}
+
+/**
+ * @given a notifier whose subscriber throws on the first block
+ * @when another block is enqueued afterwards
+ * @then the following block is still delivered
+ */
+TEST(AsyncCommitNotifierTest, SubscriberExceptionDoesNotStopDelivery) {
+  std::atomic<int> delivered{0};
+  AsyncCommitNotifier notifier(
+      [&](auto) {
+        if (delivered.fetch_add(1) == 0) {
+          throw std::runtime_error("subscriber failed");
+        }
+      },
+      getTestLogger("AsyncCommitNotifier"));
+
+  notifier.enqueue(std::make_shared<NiceMock<MockBlock>>());
+  notifier.enqueue(std::make_shared<NiceMock<MockBlock>>());
+
+  ASSERT_TRUE(notifier.waitUntilDelivered(10s));
+  ASSERT_EQ(delivered.load(), 2);
+}
@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/backoff_reconnection_strategy.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+
+/**
+ * @given initialized strategy with k limit
+ * @when  canReconnect is invoked k + 1 times
+ * @then  it returns true k times
+ *        @and returns false last time
+ */
+TEST(BackoffReconnectionStrategyTest, FirstUse) {
+  size_t K = 5;
+  ExponentialBackoffReconnectionStrategyFactory factory(K, 1ms, 2ms);
+  auto strategy = factory.create();
+
+  for (size_t i = 0; i < K; ++i) {
+    ASSERT_TRUE(strategy->canReconnect());
+  }
+  ASSERT_FALSE(strategy->canReconnect());
+}
+
+/**
+ * @given initialized strategy with k limit
+ *        @and canReconnect is invoked k times
+ * @when  reset method is invoked
+ *        @and canReconnect is invoked k + 1 times
+ * @then  checks that strategy returns true k times
+ *        @and it returns false last time
+ */
+TEST(BackoffReconnectionStrategyTest, UseAfterReset) {
+  size_t K = 5;
+  ExponentialBackoffReconnectionStrategyFactory factory(K, 1ms, 2ms);
+  auto strategy = factory.create();
+  for (size_t i = 0; i < K; ++i) {
+    strategy->canReconnect();
+  }
+  strategy->reset();
+  for (size_t i = 0; i < K; ++i) {
+    ASSERT_TRUE(strategy->canReconnect());
+  }
+  ASSERT_FALSE(strategy->canReconnect());
+}
+
+/**
+ * @given two strategies of one pool, the first one probing
+ * @when  the second one asks for reconnection
+ * @then  it is held back until the prober reports its verdict via reset
+ */
+TEST(BackoffReconnectionStrategyTest, SecondSessionWaitsForProber) {
+  ExponentialBackoffReconnectionStrategyFactory factory(5, 1ms, 1s);
+  auto prober = factory.create();
+  auto waiter = factory.create();
+
+  ASSERT_TRUE(prober->canReconnect());
+
+  std::chrono::steady_clock::duration waited{};
+  std::thread side([&] {
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(waiter->canReconnect());
+    waited = std::chrono::steady_clock::now() - start;
+  });
+
+  std::this_thread::sleep_for(50ms);
+  prober->reset();
+  side.join();
+
+  ASSERT_GE(waited, 40ms);
+}
@@ -311,3 +311,29 @@ TEST_F(BlockQueryTest, GetTopBlockFail) {
   ASSERT_EQ(top_block_error.value().code,
             BlockQuery::GetBlockError::Code::kNoBlock);
 }
+
+/**
+ * @given block store with 2 blocks totally containing 3 txs created by
+ * user1@test AND 1 tx created by user2@test
+ * @when getTransactions is invoked with all four hashes
+ * @then all four transactions are returned in chain order
+ */
+TEST_F(BlockQueryTest, GetTransactionsBatched) {
+  auto txs = blocks->getTransactions(tx_hashes);
+  ASSERT_EQ(txs.size(), tx_hashes.size());
+  for (size_t i = 0; i < txs.size(); ++i) {
+    EXPECT_EQ(txs[i]->hash(), tx_hashes[i]);
+  }
+}
+
+/**
+ * @given block store with preinserted blocks
+ * @when getTransactions is invoked with an existing and a missing hash
+ * @then only the existing transaction is returned
+ */
+TEST_F(BlockQueryTest, GetTransactionsWithMissingHash) {
+  shared_model::crypto::Hash missing_tx_hash(zero_string);
+  auto txs = blocks->getTransactions({tx_hashes.front(), missing_tx_hash});
+  ASSERT_EQ(txs.size(), 1);
+  EXPECT_EQ(txs.front()->hash(), tx_hashes.front());
+}
@@ -0,0 +1,71 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/caching_wsv_query.hpp"
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+#include "module/irohad/ametsuchi/mock_wsv_query.hpp"
+
+using namespace iroha::ametsuchi;
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class CachingWsvQueryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    source_ = std::make_shared<NiceMock<MockWsvQuery>>();
+    cache_ = std::make_shared<CachingWsvQuery>(
+        source_, getTestLogger("CachingWsvQuery"));
+  }
+
+  std::shared_ptr<MockWsvQuery> source_;
+  std::shared_ptr<CachingWsvQuery> cache_;
+  const std::string account_id_ = "account@domain";
+  const std::vector<std::string> signatories_{"signatory"};
+};
+
+/**
+ * @given a caching wsv query
+ * @when signatories of the same account are requested twice
+ * @then the underlying query is hit only once and both results match
+ */
+TEST_F(CachingWsvQueryTest, ReadThrough) {
+  EXPECT_CALL(*source_, getSignatories(account_id_))
+      .WillOnce(Return(boost::make_optional(signatories_)));
+
+  ASSERT_EQ(cache_->getSignatories(account_id_), signatories_);
+  ASSERT_EQ(cache_->getSignatories(account_id_), signatories_);
+}
+
+/**
+ * @given a caching wsv query with a cached account
+ * @when the account is invalidated
+ * @then the next request goes to the underlying query again
+ */
+TEST_F(CachingWsvQueryTest, Invalidation) {
+  EXPECT_CALL(*source_, getSignatories(account_id_))
+      .Times(2)
+      .WillRepeatedly(Return(boost::make_optional(signatories_)));
+
+  ASSERT_EQ(cache_->getSignatories(account_id_), signatories_);
+  cache_->invalidateAccount(account_id_);
+  ASSERT_EQ(cache_->getSignatories(account_id_), signatories_);
+}
+
+/**
+ * @given a caching wsv query
+ * @when the underlying query fails
+ * @then the failure is not cached and the next request retries
+ */
+TEST_F(CachingWsvQueryTest, FailureNotCached) {
+  EXPECT_CALL(*source_, getSignatories(account_id_))
+      .WillOnce(Return(boost::none))
+      .WillOnce(Return(boost::make_optional(signatories_)));
+
+  ASSERT_FALSE(cache_->getSignatories(account_id_));
+  ASSERT_EQ(cache_->getSignatories(account_id_), signatories_);
+}
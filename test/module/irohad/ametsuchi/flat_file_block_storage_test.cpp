@@ -102,6 +102,67 @@ TEST_F(FlatFileBlockStorageTest, FetchExisting) {
   ASSERT_EQ(raw_block, block_var.get());
 }
 
+/**
+ * @given block storage with compression enabled, single block inserted
+ * @when the block is fetched
+ * @then the deserializer receives the original JSON transparently
+ */
+TEST_F(FlatFileBlockStorageTest, FetchCompressed) {
+  const std::string block_json{"{\"some\": \"block\"}"};
+  auto flat_file =
+      FlatFile::create(block_store_path_,
+                       log_manager_->getChild("FlatFile")->getLogger())
+          .assumeValue();
+  FlatFileBlockStorage block_storage(
+      std::move(flat_file),
+      converter_,
+      log_manager_->getChild("FlatFileBlockFactory")->getLogger(),
+      true);
+
+  EXPECT_CALL(*converter_, serialize(_))
+      .WillOnce(Return(iroha::expected::makeValue(block_json)));
+  ASSERT_TRUE(block_storage.insert(block_));
+
+  EXPECT_CALL(*converter_, deserialize(block_json))
+      .WillOnce(Invoke([&](const shared_model::interface::types::JsonType &)
+                           -> iroha::expected::Result<
+                               std::unique_ptr<shared_model::interface::Block>,
+                               std::string> {
+        return iroha::expected::makeValue<
+            std::unique_ptr<shared_model::interface::Block>>(
+            std::make_unique<MockBlock>());
+      }));
+  ASSERT_TRUE(block_storage.fetch(height_));
+}
+
+/**
+ * @given block storage with compression enabled, single block inserted
+ * @when the raw stored form of the block is fetched
+ * @then the original JSON is returned without the deserializer being used
+ */
+TEST_F(FlatFileBlockStorageTest, FetchRaw) {
+  const std::string block_json{"{\"some\": \"block\"}"};
+  auto flat_file =
+      FlatFile::create(block_store_path_,
+                       log_manager_->getChild("FlatFile")->getLogger())
+          .assumeValue();
+  FlatFileBlockStorage block_storage(
+      std::move(flat_file),
+      converter_,
+      log_manager_->getChild("FlatFileBlockFactory")->getLogger(),
+      true);
+
+  EXPECT_CALL(*converter_, serialize(_))
+      .WillOnce(Return(iroha::expected::makeValue(block_json)));
+  ASSERT_TRUE(block_storage.insert(block_));
+
+  EXPECT_CALL(*converter_, deserialize(_)).Times(0);
+  auto raw_block = block_storage.fetchRaw(height_);
+  ASSERT_TRUE(raw_block);
+  ASSERT_EQ(*raw_block, block_json);
+  ASSERT_FALSE(block_storage.fetchRaw(height_ + 1));
+}
+
 /**
  * @given initialized block storage without blocks
  * @when block with height_ is fetched
@@ -53,6 +53,30 @@ TEST_F(BlStore_Test, Read_Write_Test) {
   ASSERT_EQ(*res, block);
 }
 
+/**
+ * @given initialized FlatFile storage with an inserted block
+ * @when the block is read through the zero-copy view
+ * @then the view exposes exactly the stored bytes, and a view of a
+ * non-existing id is none
+ */
+TEST_F(BlStore_Test, GetView) {
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  IROHA_ASSERT_RESULT_VALUE(store);
+  auto bl_store = std::move(store).assumeValue();
+  auto id = 1u;
+  bl_store->add(id, block);
+
+  auto view = bl_store->getView(id);
+  ASSERT_TRUE(view);
+  auto bytes = view->view();
+  ASSERT_EQ(bytes.size(), block.size());
+  ASSERT_TRUE(std::equal(block.begin(),
+                         block.end(),
+                         reinterpret_cast<const uint8_t *>(bytes.data())));
+
+  ASSERT_FALSE(bl_store->getView(2u));
+}
+
 /**
  * @given initialized FlatFile storage and 3 blocks are inserted into it
  * @when storage removed, file for a second block removed and new storage is
@@ -260,3 +284,102 @@ TEST_F(BlStore_Test, RemoveAndCreateNew) {
   ASSERT_TRUE(bl_store->get(7));
   ASSERT_FALSE(bl_store->get(1));
 }
+
+/**
+ * @given a block store folder with blocks and a manifest lagging behind the
+ * stored files, as after a crash between the block rename and the manifest
+ * update
+ * @when a new block store is initialized over the folder
+ * @then the missing tail is picked up
+ */
+TEST_F(BlStore_Test, StaleManifestRollsForward) {
+  {
+    auto store = FlatFile::create(block_store_path, flat_file_log_);
+    IROHA_ASSERT_RESULT_VALUE(store);
+    auto bl_store = std::move(store).assumeValue();
+    bl_store->add(1u, block);
+    bl_store->add(2u, block);
+  }
+
+  // simulate a block appended without a manifest update
+  fs::copy_file(fs::path(block_store_path) / FlatFile::id_to_name(2),
+                fs::path(block_store_path) / FlatFile::id_to_name(3));
+
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  IROHA_ASSERT_RESULT_VALUE(store);
+  auto bl_store = std::move(store).assumeValue();
+  ASSERT_EQ(bl_store->last_id(), 3);
+  ASSERT_TRUE(bl_store->get(3));
+}
+
+/**
+ * @given a block store folder with blocks whose manifest was removed
+ * @when a new block store is initialized over the folder
+ * @then the blocks are recovered by the directory scan and the manifest is
+ * recreated
+ */
+TEST_F(BlStore_Test, MissingManifestFallsBackToScan) {
+  {
+    auto store = FlatFile::create(block_store_path, flat_file_log_);
+    IROHA_ASSERT_RESULT_VALUE(store);
+    auto bl_store = std::move(store).assumeValue();
+    bl_store->add(1u, block);
+    bl_store->add(2u, block);
+  }
+
+  fs::remove(fs::path(block_store_path) / FlatFile::kManifestFileName);
+
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  IROHA_ASSERT_RESULT_VALUE(store);
+  auto bl_store = std::move(store).assumeValue();
+  ASSERT_EQ(bl_store->last_id(), 2);
+  ASSERT_TRUE(
+      fs::exists(fs::path(block_store_path) / FlatFile::kManifestFileName));
+}
+
+/**
+ * @given a block store with a group commit durability policy
+ * @when blocks are appended below, at and above the group size
+ * @then every block is readable, the automatic barrier fires at the group
+ * size, and the explicit barrier succeeds for a partial group
+ */
+TEST_F(BlStore_Test, GroupCommitPolicy) {
+  FlatFileSyncPolicy policy;
+  policy.group_blocks = 3;
+  auto store = FlatFile::create(block_store_path, flat_file_log_, policy);
+  IROHA_ASSERT_RESULT_VALUE(store);
+  auto bl_store = std::move(store).assumeValue();
+
+  for (Identifier id = 1; id <= 4; ++id) {
+    ASSERT_TRUE(bl_store->add(id, block));
+    ASSERT_TRUE(bl_store->get(id));
+  }
+
+  // one block is pending after the automatic barrier at three
+  ASSERT_TRUE(bl_store->sync());
+  ASSERT_EQ(bl_store->last_id(), 4);
+}
+
+/**
+ * @given a block store with a group commit policy holding pending blocks
+ * @when the store is destroyed and reopened
+ * @then the destructor barrier made all appended blocks visible
+ */
+TEST_F(BlStore_Test, GroupCommitFlushedOnDestruction) {
+  {
+    FlatFileSyncPolicy policy;
+    policy.group_blocks = 10;
+    auto store = FlatFile::create(block_store_path, flat_file_log_, policy);
+    IROHA_ASSERT_RESULT_VALUE(store);
+    auto bl_store = std::move(store).assumeValue();
+    bl_store->add(1u, block);
+    bl_store->add(2u, block);
+  }
+
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  IROHA_ASSERT_RESULT_VALUE(store);
+  auto bl_store = std::move(store).assumeValue();
+  ASSERT_EQ(bl_store->last_id(), 2);
+  ASSERT_TRUE(bl_store->get(1));
+  ASSERT_TRUE(bl_store->get(2));
+}
@@ -22,6 +22,11 @@ namespace iroha {
                   checkTxPresence,
                   (const shared_model::crypto::Hash &),
                   (override));
+      MOCK_METHOD(
+          std::vector<std::unique_ptr<shared_model::interface::Transaction>>,
+          getTransactions,
+          (const std::vector<shared_model::crypto::Hash> &),
+          (override));
       MOCK_METHOD0(getTopBlockHeight,
                    shared_model::interface::types::HeightType());
       MOCK_METHOD0(reloadBlockstore, void());
@@ -0,0 +1,132 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/parallel_wave_applier.hpp"
+
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "framework/result_gtest_checkers.hpp"
+#include "framework/test_logger.hpp"
+#include "module/irohad/ametsuchi/mock_command_executor.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using ::testing::_;
+using ::testing::Invoke;
+
+namespace {
+  auto makeTransfer(const std::string &creator,
+                    const std::string &src,
+                    const std::string &dest) {
+    return TestTransactionBuilder()
+        .creatorAccountId(creator)
+        .createdTime(iroha::time::now())
+        .quorum(1)
+        .transferAsset(src, dest, "coin#domain", "", "1.0")
+        .build();
+  }
+}  // namespace
+
+class ParallelWaveApplierTest : public ::testing::Test {
+ public:
+  /// applier over the given number of mock executors, all recording the
+  /// creator account of every executed command into applied_creators
+  std::unique_ptr<ParallelWaveApplier> makeApplier(size_t workers) {
+    std::vector<std::shared_ptr<CommandExecutor>> executors;
+    for (size_t i = 0; i < workers; ++i) {
+      auto executor = std::make_shared<MockCommandExecutor>();
+      EXPECT_CALL(*executor, execute(_, _, _, _, _))
+          .WillRepeatedly(Invoke([this](const auto &,
+                                        const auto &creator,
+                                        const auto &,
+                                        auto,
+                                        auto) -> CommandResult {
+            std::lock_guard<std::mutex> lock(mutex);
+            applied_creators.push_back(creator);
+            return iroha::expected::Value<void>{};
+          }));
+      executors.push_back(std::move(executor));
+    }
+    return std::make_unique<ParallelWaveApplier>(
+        std::move(executors), getTestLogger("ParallelWaveApplier"));
+  }
+
+  std::mutex mutex;
+  std::vector<std::string> applied_creators;
+};
+
+/**
+ * @given transfers with pairwise disjoint accounts
+ * @when they are applied through the wave applier
+ * @then every transaction is executed exactly once
+ */
+TEST_F(ParallelWaveApplierTest, AppliesAllTransactions) {
+  std::vector<shared_model::proto::Transaction> txs;
+  for (char c = 'a'; c < 'a' + 6; ++c) {
+    txs.push_back(makeTransfer(std::string(1, c) + "@domain",
+                               std::string(1, c) + "@domain",
+                               std::string(1, c + 6) + "@domain"));
+  }
+  auto applier = makeApplier(3);
+
+  framework::expected::expectResultValue(applier->apply(txs));
+
+  std::multiset<std::string> applied(applied_creators.begin(),
+                                     applied_creators.end());
+  std::multiset<std::string> expected;
+  for (const auto &tx : txs) {
+    expected.insert(tx.creatorAccountId());
+  }
+  ASSERT_EQ(applied, expected);
+}
+
+/**
+ * @given two transfers touching the same account
+ * @when they are applied through the wave applier
+ * @then the dependent transaction executes strictly after the first one
+ */
+TEST_F(ParallelWaveApplierTest, ConflictingTransactionsKeepBlockOrder) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(makeTransfer("a@domain", "a@domain", "b@domain"));
+  txs.push_back(makeTransfer("b@domain", "b@domain", "c@domain"));
+  auto applier = makeApplier(2);
+
+  framework::expected::expectResultValue(applier->apply(txs));
+
+  ASSERT_EQ(applied_creators,
+            (std::vector<std::string>{"a@domain", "b@domain"}));
+}
+
+/**
+ * @given an executor which fails a command
+ * @when a block is applied through the wave applier
+ * @then the error carries the failed transaction hash
+ */
+TEST_F(ParallelWaveApplierTest, ReportsFailedTransaction) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(makeTransfer("a@domain", "a@domain", "b@domain"));
+
+  auto executor = std::make_shared<MockCommandExecutor>();
+  EXPECT_CALL(*executor, execute(_, _, _, _, _))
+      .WillRepeatedly(Invoke([](const auto &,
+                                const auto &,
+                                const auto &,
+                                auto,
+                                auto) -> CommandResult {
+        return iroha::expected::makeError(
+            CommandError{"TransferAsset", 1, "no such account"});
+      }));
+  std::vector<std::shared_ptr<CommandExecutor>> executors{std::move(executor)};
+  ParallelWaveApplier applier{std::move(executors),
+                              getTestLogger("ParallelWaveApplier")};
+
+  auto result = applier.apply(txs);
+  IROHA_ASSERT_RESULT_ERROR(result);
+  ASSERT_NE(result.assumeError().find(txs.front().hash().hex()),
+            std::string::npos);
+}
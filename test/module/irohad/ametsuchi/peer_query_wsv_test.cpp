@@ -6,6 +6,7 @@
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 
 #include <gtest/gtest.h>
+#include "ametsuchi/impl/ledger_peers_snapshot.hpp"
 #include "backend/plain/peer.hpp"
 #include "module/irohad/ametsuchi/mock_wsv_query.hpp"
 
@@ -42,3 +43,56 @@ TEST_F(PeerQueryWSVTest, GetPeers) {
   ASSERT_THAT(result.get(),
               testing::ElementsAreArray(peers.cbegin(), peers.cend()));
 }
+
+/**
+ * @given peer query with a published peer list snapshot
+ * @when trying to get all peers and a peer by public key
+ * @then the snapshot is served without querying the database
+ */
+TEST_F(PeerQueryWSVTest, GetPeersFromSnapshot) {
+  using namespace shared_model::interface::types;
+  std::shared_ptr<shared_model::interface::Peer> peer1 =
+      std::make_shared<shared_model::plain::Peer>(
+          "some-address", "0a", std::nullopt);
+  std::shared_ptr<shared_model::interface::Peer> peer2 =
+      std::make_shared<shared_model::plain::Peer>(
+          "another-address", "0b", std::nullopt);
+
+  auto snapshot = std::make_shared<iroha::ametsuchi::LedgerPeersSnapshot>();
+  snapshot->set(std::make_shared<const PeerList>(PeerList{peer1, peer2}));
+  peer_query_ =
+      std::make_unique<iroha::ametsuchi::PeerQueryWsv>(wsv_query_, snapshot);
+
+  EXPECT_CALL(*wsv_query_, getPeers()).Times(0);
+  EXPECT_CALL(*wsv_query_, getPeerByPublicKey(::testing::_)).Times(0);
+
+  auto result = peer_query_->getLedgerPeers();
+  ASSERT_TRUE(result);
+  ASSERT_THAT(result.get(), testing::ElementsAre(peer1, peer2));
+
+  auto by_key = peer_query_->getLedgerPeerByPublicKey(
+      PublicKeyHexStringView{std::string_view{"0b"}});
+  ASSERT_TRUE(by_key);
+  ASSERT_EQ(by_key.get(), peer2);
+}
+
+/**
+ * @given peer query with a snapshot holder which has no published peer list
+ * @when trying to get all peers
+ * @then the query falls back to the database
+ */
+TEST_F(PeerQueryWSVTest, FallsBackToWsvWithoutSnapshot) {
+  std::vector<std::shared_ptr<shared_model::interface::Peer>> peers{
+      std::make_shared<shared_model::plain::Peer>(
+          "some-address", "0a", std::nullopt)};
+  auto snapshot = std::make_shared<iroha::ametsuchi::LedgerPeersSnapshot>();
+  peer_query_ =
+      std::make_unique<iroha::ametsuchi::PeerQueryWsv>(wsv_query_, snapshot);
+
+  EXPECT_CALL(*wsv_query_, getPeers()).WillOnce(::testing::Return(peers));
+
+  auto result = peer_query_->getLedgerPeers();
+  ASSERT_TRUE(result);
+  ASSERT_THAT(result.get(),
+              testing::ElementsAreArray(peers.cbegin(), peers.cend()));
+}
@@ -153,3 +153,57 @@ TEST_F(PostgresBurrowStorageTest, StoreLogWith3Topics) {
   checkEngineCalls();
   checkLogs({log1});
 }
+
+TEST_F(PostgresBurrowStorageTest, StorageOverlayReadYourWrites) {
+  // given
+  const std::string addr{"mytischi"};
+  const std::string key{"klucz"};
+  const std::string value{"semki"};
+
+  // when
+  IROHA_ASSERT_RESULT_VALUE(storage_.setStorage(addr, key, value));
+
+  // then the write is visible through the overlay before any flush
+  auto cached = storage_.getStorage(addr, key);
+  IROHA_ASSERT_RESULT_VALUE(cached);
+  ASSERT_EQ(std::move(cached).assumeValue(), value);
+
+  // and is not in the database until flush
+  size_t count = 0;
+  *sql_ << "select count(1) from burrow_account_key_value",
+      soci::into(count);
+  ASSERT_EQ(count, 0);
+
+  // when
+  IROHA_ASSERT_RESULT_VALUE(storage_.flush());
+
+  // then
+  std::string stored_value;
+  *sql_ << "select value from burrow_account_key_value "
+           "where address = :address and key = :key",
+      soci::use(addr, "address"), soci::use(key, "key"),
+      soci::into(stored_value);
+  ASSERT_EQ(stored_value, value);
+}
+
+TEST_F(PostgresBurrowStorageTest, RemoveAccountDropsSlotsOnFlush) {
+  // given an account with data and one storage slot
+  const std::string addr{"mytischi"};
+  IROHA_ASSERT_RESULT_VALUE(storage_.updateAccount(addr, "achtung"));
+  IROHA_ASSERT_RESULT_VALUE(storage_.setStorage(addr, "klucz", "semki"));
+  IROHA_ASSERT_RESULT_VALUE(storage_.flush());
+
+  // when the account is removed and the overlay flushed
+  IROHA_ASSERT_RESULT_VALUE(storage_.removeAccount(addr));
+  auto removed_slot = storage_.getStorage(addr, "klucz");
+  IROHA_ASSERT_RESULT_VALUE(removed_slot);
+  ASSERT_FALSE(std::move(removed_slot).assumeValue());
+  IROHA_ASSERT_RESULT_VALUE(storage_.flush());
+
+  // then neither the account nor its slots remain
+  size_t count = 0;
+  *sql_ << "select count(1) from burrow_account_data", soci::into(count);
+  ASSERT_EQ(count, 0);
+  *sql_ << "select count(1) from burrow_account_key_value", soci::into(count);
+  ASSERT_EQ(count, 0);
+}
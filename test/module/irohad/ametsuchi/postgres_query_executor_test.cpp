@@ -683,9 +683,11 @@ namespace iroha {
         auto target_txs = Impl::makeTargetTransactions(transactions_amount);
 
         tx_hashes_.reserve(target_txs.size());
+        tx_created_times_.reserve(target_txs.size());
         initial_txs.reserve(initial_txs.size() + target_txs.size());
         for (auto &tx : target_txs) {
           tx_hashes_.emplace_back(tx.hash());
+          tx_created_times_.emplace_back(tx.createdTime());
           initial_txs.emplace_back(std::move(tx));
         }
 
@@ -697,8 +699,13 @@ namespace iroha {
       auto queryPage(
           types::TransactionsNumberType page_size,
           const std::optional<types::HashType> &first_hash = std::nullopt,
-          const shared_model::interface::Ordering *ordering = nullptr) {
-        auto query = Impl::makeQuery(page_size, first_hash, ordering);
+          const shared_model::interface::Ordering *ordering = nullptr,
+          const std::optional<types::TimestampType> &first_tx_time =
+              std::nullopt,
+          const std::optional<types::TimestampType> &last_tx_time =
+              std::nullopt) {
+        auto query = Impl::makeQuery(
+            page_size, first_hash, ordering, first_tx_time, last_tx_time);
         return executeQuery(query);
       }
 
@@ -761,6 +768,7 @@ namespace iroha {
       }
 
       std::vector<types::HashType> tx_hashes_;
+      std::vector<types::TimestampType> tx_created_times_;
     };
 
     struct GetAccountTxPaginationImpl {
@@ -792,11 +800,20 @@ namespace iroha {
       static shared_model::proto::Query makeQuery(
           types::TransactionsNumberType page_size,
           const std::optional<types::HashType> &first_hash = std::nullopt,
-          const shared_model::interface::Ordering *ordering = nullptr) {
+          const shared_model::interface::Ordering *ordering = nullptr,
+          const std::optional<types::TimestampType> &first_tx_time =
+              std::nullopt,
+          const std::optional<types::TimestampType> &last_tx_time =
+              std::nullopt) {
         return TestQueryBuilder()
             .creatorAccountId(account_id)
             .createdTime(iroha::time::now())
-            .getAccountTransactions(account_id, page_size, first_hash, ordering)
+            .getAccountTransactions(account_id,
+                                    page_size,
+                                    first_hash,
+                                    ordering,
+                                    first_tx_time,
+                                    last_tx_time)
             .build();
       }
     };
@@ -846,12 +863,21 @@ namespace iroha {
       static shared_model::proto::Query makeQuery(
           types::TransactionsNumberType page_size,
           const std::optional<types::HashType> &first_hash = std::nullopt,
-          const shared_model::interface::Ordering *ordering = nullptr) {
+          const shared_model::interface::Ordering *ordering = nullptr,
+          const std::optional<types::TimestampType> &first_tx_time =
+              std::nullopt,
+          const std::optional<types::TimestampType> &last_tx_time =
+              std::nullopt) {
         return TestQueryBuilder()
             .creatorAccountId(account_id)
             .createdTime(iroha::time::now())
-            .getAccountAssetTransactions(
-                account_id, asset_id, page_size, first_hash, ordering)
+            .getAccountAssetTransactions(account_id,
+                                         asset_id,
+                                         page_size,
+                                         first_hash,
+                                         ordering,
+                                         first_tx_time,
+                                         last_tx_time)
             .build();
       }
     };
@@ -1398,6 +1424,50 @@ namespace iroha {
           });
     }
 
+    /**
+     * @given initialized storage, user has 3 transactions committed
+     * @when query contains a created time window covering the last two
+     * transactions
+     * @then response contains exactly those 2 transactions
+     * @and total size counts only the windowed transactions
+     * @and next transaction hash is not present
+     */
+    TYPED_TEST(GetPagedTransactionsExecutorTest, ValidTimeWindow) {
+      this->createTransactionsAndCommit(3);
+      auto first_tx_time = this->tx_created_times_.at(1);
+      auto last_tx_time = this->tx_created_times_.at(2);
+      auto query_response = this->queryPage(
+          3, std::nullopt, nullptr, first_tx_time, last_tx_time);
+      checkSuccessfulResult<TransactionsPageResponse>(
+          std::move(query_response), [this](const auto &tx_page_response) {
+            EXPECT_EQ(tx_page_response.transactions().size(), 2);
+            EXPECT_EQ(tx_page_response.allTransactionsSize(), 2);
+            EXPECT_EQ(tx_page_response.transactions()[0].hash(),
+                      this->tx_hashes_.at(1));
+            EXPECT_EQ(tx_page_response.transactions()[1].hash(),
+                      this->tx_hashes_.at(2));
+            EXPECT_FALSE(tx_page_response.nextTxHash());
+          });
+    }
+
+    /**
+     * @given initialized storage, user has 3 transactions committed
+     * @when query contains a created time window that precedes all of them
+     * @then response does not contain any transactions
+     * @and total size is 0
+     */
+    TYPED_TEST(GetPagedTransactionsExecutorTest, TimeWindowNoTransactions) {
+      this->createTransactionsAndCommit(3);
+      auto query_response = this->queryPage(
+          3, std::nullopt, nullptr, 0, this->tx_created_times_.at(0) - 1);
+      checkSuccessfulResult<TransactionsPageResponse>(
+          std::move(query_response), [](const auto &tx_page_response) {
+            EXPECT_EQ(tx_page_response.transactions().size(), 0);
+            EXPECT_EQ(tx_page_response.allTransactionsSize(), 0);
+            EXPECT_FALSE(tx_page_response.nextTxHash());
+          });
+    }
+
     // --------------------\ end of tx pagination tests /-------------------- //
 
     class GetTransactionsHashExecutorTest : public GetTransactionsExecutorTest {
@@ -0,0 +1,70 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/query_permission_cache.hpp"
+
+#include <gtest/gtest.h>
+
+using iroha::ametsuchi::QueryPermissionCache;
+
+/**
+ * @given an empty permission cache
+ * @when a decision is requested
+ * @then there is none
+ */
+TEST(QueryPermissionCacheTest, MissOnEmptyCache) {
+  QueryPermissionCache cache;
+  ASSERT_FALSE(cache.get("admin@test can get accounts"));
+}
+
+/**
+ * @given a cache with remembered decisions
+ * @when they are requested again
+ * @then the stored decisions are returned per key
+ */
+TEST(QueryPermissionCacheTest, ServesStoredDecisions) {
+  QueryPermissionCache cache;
+  cache.put("admin@test can get accounts", true);
+  cache.put("user@test can get accounts", false);
+
+  auto allowed = cache.get("admin@test can get accounts");
+  ASSERT_TRUE(allowed);
+  ASSERT_TRUE(allowed.value());
+
+  auto denied = cache.get("user@test can get accounts");
+  ASSERT_TRUE(denied);
+  ASSERT_FALSE(denied.value());
+}
+
+/**
+ * @given a cache with a remembered decision
+ * @when the decision for its key is stored again with another value
+ * @then the latest value is returned
+ */
+TEST(QueryPermissionCacheTest, OverwritesDecision) {
+  QueryPermissionCache cache;
+  cache.put("admin@test can get accounts", false);
+  cache.put("admin@test can get accounts", true);
+
+  auto decision = cache.get("admin@test can get accounts");
+  ASSERT_TRUE(decision);
+  ASSERT_TRUE(decision.value());
+}
+
+/**
+ * @given a cache with remembered decisions
+ * @when the cache is invalidated
+ * @then no decision is remembered any more
+ */
+TEST(QueryPermissionCacheTest, InvalidateForgetsEverything) {
+  QueryPermissionCache cache;
+  cache.put("admin@test can get accounts", true);
+  cache.put("user@test can get accounts", false);
+
+  cache.invalidate();
+
+  ASSERT_FALSE(cache.get("admin@test can get accounts"));
+  ASSERT_FALSE(cache.get("user@test can get accounts"));
+}
@@ -0,0 +1,110 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/read_ahead_block_reader.hpp"
+
+#include <gtest/gtest.h>
+#include "common/result.hpp"
+#include "framework/test_logger.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha;
+using namespace iroha::ametsuchi;
+
+using shared_model::interface::types::HeightType;
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace {
+  /**
+   * Block query stub which serves a mock block for every height below the
+   * given failing height and an error from there on, counting the reads.
+   */
+  class SequenceBlockQuery : public BlockQuery {
+   public:
+    explicit SequenceBlockQuery(HeightType failing_height = 0)
+        : failing_height_(failing_height) {}
+
+    BlockResult getBlock(HeightType height) override {
+      ++fetched_;
+      if (failing_height_ != 0 and height >= failing_height_) {
+        return expected::makeError(
+            GetBlockError{GetBlockError::Code::kNoBlock, "no block"});
+      }
+      auto block = std::make_unique<NiceMock<MockBlock>>();
+      ON_CALL(*block, height()).WillByDefault(Return(height));
+      return std::unique_ptr<shared_model::interface::Block>(std::move(block));
+    }
+
+    HeightType getTopBlockHeight() override {
+      return 0;
+    }
+
+    void reloadBlockstore() override {}
+
+    std::vector<std::unique_ptr<shared_model::interface::Transaction>>
+    getTransactions(const std::vector<shared_model::crypto::Hash> &) override {
+      return {};
+    }
+
+    std::optional<TxCacheStatusType> checkTxPresence(
+        const shared_model::crypto::Hash &) override {
+      return std::nullopt;
+    }
+
+    size_t fetched_{0};
+    const HeightType failing_height_;
+  };
+}  // namespace
+
+/**
+ * @given a reader over a range of available blocks
+ * @when the whole range is consumed
+ * @then the blocks come out in height order
+ */
+TEST(ReadAheadBlockReaderTest, DeliversBlocksInOrder) {
+  SequenceBlockQuery block_query;
+  ReadAheadBlockReader reader(
+      block_query, 1, 5, 2, getTestLogger("ReadAheadBlockReader"));
+
+  for (HeightType height = 1; height <= 5; ++height) {
+    auto result = reader.next();
+    ASSERT_TRUE(expected::hasValue(result));
+    ASSERT_EQ(std::move(result).assumeValue()->height(), height);
+  }
+}
+
+/**
+ * @given a reader over a range whose third block cannot be read
+ * @when the range is consumed up to the error
+ * @then the error arrives in order and no further heights are fetched
+ */
+TEST(ReadAheadBlockReaderTest, StopsFetchingAfterError) {
+  auto block_query = std::make_unique<SequenceBlockQuery>(3);
+  {
+    ReadAheadBlockReader reader(
+        *block_query, 1, 10, 4, getTestLogger("ReadAheadBlockReader"));
+    ASSERT_TRUE(expected::hasValue(reader.next()));
+    ASSERT_TRUE(expected::hasValue(reader.next()));
+    ASSERT_TRUE(expected::hasError(reader.next()));
+  }
+  ASSERT_EQ(block_query->fetched_, 3);
+}
+
+/**
+ * @given a reader with a full prefetch queue and most of its range unread
+ * @when the reader is destroyed early
+ * @then destruction completes without draining the range
+ */
+TEST(ReadAheadBlockReaderTest, EarlyDestructionDoesNotBlock) {
+  SequenceBlockQuery block_query;
+  {
+    ReadAheadBlockReader reader(
+        block_query, 1, 1000, 2, getTestLogger("ReadAheadBlockReader"));
+    ASSERT_TRUE(expected::hasValue(reader.next()));
+  }
+  ASSERT_LT(block_query.fetched_, 1000);
+}
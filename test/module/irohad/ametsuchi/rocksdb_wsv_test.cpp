@@ -0,0 +1,117 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gmock/gmock.h>
+
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/rocksdb_common.hpp"
+#include "ametsuchi/impl/rocksdb_wsv_command.hpp"
+#include "ametsuchi/impl/rocksdb_wsv_query.hpp"
+#include "ametsuchi/ledger_state.hpp"
+#include "cryptography/hash.hpp"
+#include "framework/result_gtest_checkers.hpp"
+#include "framework/test_logger.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::PublicKeyHexStringView;
+
+namespace fs = boost::filesystem;
+
+class RocksDbWsvTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto context = RocksDbContext::create(db_path_);
+    IROHA_ASSERT_RESULT_VALUE(context);
+    db_context_ = std::move(context).assumeValue();
+    command = std::make_unique<RocksDbWsvCommand>(db_context_);
+    query = std::make_unique<RocksDbWsvQuery>(db_context_,
+                                              getTestLogger("RocksDbWsvQuery"));
+  }
+
+  void TearDown() override {
+    command.reset();
+    query.reset();
+    db_context_.reset();
+    fs::remove_all(db_path_);
+  }
+
+  std::string db_path_ =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  std::shared_ptr<RocksDbContext> db_context_;
+  std::unique_ptr<WsvCommand> command;
+  std::unique_ptr<WsvQuery> query;
+};
+
+/**
+ * @given an empty rocksdb WSV
+ * @when a peer is inserted with wsv command
+ * @then it is returned by getPeers and getPeerByPublicKey
+ *       @and deleting it makes both queries come up empty
+ */
+TEST_F(RocksDbWsvTest, InsertAndDeletePeer) {
+  auto peer = makePeer("127.0.0.1:50541", PublicKeyHexStringView{"pubkey"});
+  framework::expected::expectResultValue(command->insertPeer(*peer));
+
+  auto peers = query->getPeers();
+  ASSERT_TRUE(peers);
+  ASSERT_EQ(peers->size(), 1);
+  ASSERT_EQ(peers->at(0)->address(), peer->address());
+  ASSERT_EQ(peers->at(0)->pubkey(), peer->pubkey());
+
+  auto found = query->getPeerByPublicKey(PublicKeyHexStringView{"pubkey"});
+  ASSERT_TRUE(found);
+  ASSERT_EQ((*found)->address(), peer->address());
+
+  framework::expected::expectResultValue(command->deletePeer(*peer));
+  peers = query->getPeers();
+  ASSERT_TRUE(peers);
+  ASSERT_TRUE(peers->empty());
+  ASSERT_FALSE(query->getPeerByPublicKey(PublicKeyHexStringView{"pubkey"}));
+}
+
+/**
+ * @given an empty rocksdb WSV
+ * @when two account signatories are inserted and one is deleted
+ * @then getSignatories returns exactly the remaining one
+ */
+TEST_F(RocksDbWsvTest, AccountSignatories) {
+  framework::expected::expectResultValue(
+      command->insertAccountSignatory("user@domain",
+                                      PublicKeyHexStringView{"key_one"}));
+  framework::expected::expectResultValue(
+      command->insertAccountSignatory("user@domain",
+                                      PublicKeyHexStringView{"key_two"}));
+
+  auto signatories = query->getSignatories("user@domain");
+  ASSERT_TRUE(signatories);
+  ASSERT_THAT(*signatories,
+              testing::UnorderedElementsAre("key_one", "key_two"));
+
+  framework::expected::expectResultValue(
+      command->deleteAccountSignatory("user@domain",
+                                      PublicKeyHexStringView{"key_one"}));
+  signatories = query->getSignatories("user@domain");
+  ASSERT_TRUE(signatories);
+  ASSERT_THAT(*signatories, testing::ElementsAre("key_two"));
+}
+
+/**
+ * @given an empty rocksdb WSV
+ * @when top block info is set with wsv command
+ * @then the same top block info is read back with wsv query
+ */
+TEST_F(RocksDbWsvTest, SetAndGetTopBlockInfo) {
+  iroha::TopBlockInfo top_block_info_set{1234,
+                                         shared_model::crypto::Hash{"hash"}};
+  framework::expected::expectResultValue(
+      command->setTopBlockInfo(top_block_info_set));
+  auto top_block_info_read = query->getTopBlockInfo();
+  IROHA_ASSERT_RESULT_VALUE(top_block_info_read);
+  EXPECT_EQ(top_block_info_set.top_hash,
+            top_block_info_read.assumeValue().top_hash);
+  EXPECT_EQ(top_block_info_set.height,
+            top_block_info_read.assumeValue().height);
+}
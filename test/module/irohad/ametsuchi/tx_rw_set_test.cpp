@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/tx_rw_set.hpp"
+
+#include <set>
+
+#include <gtest/gtest.h>
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+
+namespace {
+  auto makeTransfer(const std::string &creator,
+                    const std::string &src,
+                    const std::string &dest) {
+    return TestTransactionBuilder()
+        .creatorAccountId(creator)
+        .createdTime(iroha::time::now())
+        .quorum(1)
+        .transferAsset(src, dest, "coin#domain", "", "1.0")
+        .build();
+  }
+}  // namespace
+
+/**
+ * @given a transfer transaction
+ * @when its read/write set is extracted
+ * @then it contains the creator, source and destination accounts and is not
+ * global
+ */
+TEST(TxRwSetTest, TransferRwSet) {
+  auto tx = makeTransfer("admin@domain", "a@domain", "b@domain");
+  auto rw_set = extractRwSet(tx);
+  ASSERT_FALSE(rw_set.global);
+  std::set<std::string> accounts;
+  for (const auto &account : rw_set.accounts) {
+    accounts.insert(account.str());
+  }
+  ASSERT_EQ(accounts,
+            (std::set<std::string>{"admin@domain", "a@domain", "b@domain"}));
+}
+
+/**
+ * @given a transaction with a global command
+ * @when its read/write set is extracted
+ * @then the global flag is set
+ */
+TEST(TxRwSetTest, GlobalCommand) {
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId("admin@domain")
+                .createdTime(iroha::time::now())
+                .quorum(1)
+                .createDomain("other", "user")
+                .build();
+  ASSERT_TRUE(extractRwSet(tx).global);
+}
+
+/**
+ * @given transfers with disjoint and overlapping accounts and a global
+ * transaction
+ * @when they are scheduled
+ * @then disjoint transfers share a wave, the dependent transfer and the
+ * global transaction are placed in later waves
+ */
+TEST(TxRwSetTest, ScheduleWaves) {
+  auto tx0 = makeTransfer("a@domain", "a@domain", "b@domain");
+  auto tx1 = makeTransfer("c@domain", "c@domain", "d@domain");
+  auto tx2 = makeTransfer("b@domain", "b@domain", "e@domain");
+  auto tx3 = TestTransactionBuilder()
+                 .creatorAccountId("x@domain")
+                 .createdTime(iroha::time::now())
+                 .quorum(1)
+                 .createDomain("other", "user")
+                 .build();
+  auto tx4 = makeTransfer("f@domain", "f@domain", "g@domain");
+
+  std::vector<std::reference_wrapper<const shared_model::interface::Transaction>>
+      txs{tx0, tx1, tx2, tx3, tx4};
+  auto waves = scheduleIndependentWaves(txs);
+
+  ASSERT_EQ(waves.size(), 4u);
+  // tx0 and tx1 are independent
+  ASSERT_EQ(waves[0], (std::vector<size_t>{0, 1}));
+  // tx2 conflicts with tx0 on b@domain
+  ASSERT_EQ(waves[1], (std::vector<size_t>{2}));
+  // the global tx runs alone
+  ASSERT_EQ(waves[2], (std::vector<size_t>{3}));
+  // anything after the barrier starts a new wave
+  ASSERT_EQ(waves[3], (std::vector<size_t>{4}));
+}
@@ -0,0 +1,105 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_state_digest.hpp"
+
+#include <gtest/gtest.h>
+
+using iroha::ametsuchi::WsvStateDigest;
+
+namespace {
+  WsvStateDigest makeSampleDigest() {
+    WsvStateDigest digest;
+    digest.update("account:alice@test", "test\t1\t{}");
+    digest.update("account:bob@test", "test\t2\t{}");
+    digest.update("balance:alice@test:coin#test", "100.0");
+    digest.update("balance:bob@test:coin#test", "5.5");
+    digest.update("signatory:alice@test:deadbeef", "");
+    return digest;
+  }
+}  // namespace
+
+/**
+ * @given WSV state entries
+ * @when they are inserted in different orders
+ * @then the roots match, and change with any entry change
+ */
+TEST(WsvStateDigestTest, RootIsAFunctionOfTheEntrySet) {
+  auto digest = makeSampleDigest();
+
+  WsvStateDigest reordered;
+  reordered.update("signatory:alice@test:deadbeef", "");
+  reordered.update("balance:bob@test:coin#test", "5.5");
+  reordered.update("account:bob@test", "test\t2\t{}");
+  reordered.update("balance:alice@test:coin#test", "100.0");
+  reordered.update("account:alice@test", "test\t1\t{}");
+  EXPECT_EQ(digest.root(), reordered.root());
+
+  reordered.update("balance:bob@test:coin#test", "6.5");
+  EXPECT_NE(digest.root(), reordered.root());
+
+  EXPECT_NE(digest.root(), WsvStateDigest{}.root());
+}
+
+/**
+ * @given a digest of some entries
+ * @when an entry is added, updated and removed again
+ * @then the root returns to the one of the original entry set
+ */
+TEST(WsvStateDigestTest, RemovalRestoresTheRoot) {
+  auto digest = makeSampleDigest();
+  auto const original_root = digest.root();
+  auto const original_size = digest.size();
+
+  digest.update("balance:carol@test:coin#test", "7");
+  EXPECT_NE(original_root, digest.root());
+  digest.update("balance:carol@test:coin#test", "8");
+  digest.remove("balance:carol@test:coin#test");
+
+  EXPECT_EQ(original_root, digest.root());
+  EXPECT_EQ(original_size, digest.size());
+}
+
+/**
+ * @given a digest with the entries of several accounts
+ * @when the entries of one account are removed by prefix
+ * @then only the other accounts' entries remain
+ */
+TEST(WsvStateDigestTest, RemovePrefixDropsTheGroup) {
+  auto digest = makeSampleDigest();
+
+  WsvStateDigest without_alice;
+  without_alice.update("account:alice@test", "test\t1\t{}");
+  without_alice.update("account:bob@test", "test\t2\t{}");
+  without_alice.update("balance:bob@test:coin#test", "5.5");
+  without_alice.update("signatory:alice@test:deadbeef", "");
+
+  digest.removePrefix("balance:alice@test:");
+  EXPECT_EQ(without_alice.root(), digest.root());
+}
+
+/**
+ * @given a digest of some entries
+ * @when a membership proof of an entry is taken
+ * @then it verifies against the root and only for the proven entry
+ */
+TEST(WsvStateDigestTest, ProofsVerify) {
+  auto digest = makeSampleDigest();
+  auto root = digest.root();
+
+  auto proof = digest.proof("balance:alice@test:coin#test");
+  ASSERT_TRUE(proof);
+  EXPECT_TRUE(WsvStateDigest::verifyProof(
+      root, "balance:alice@test:coin#test", "100.0", *proof));
+  EXPECT_FALSE(WsvStateDigest::verifyProof(
+      root, "balance:alice@test:coin#test", "100.1", *proof));
+  EXPECT_FALSE(WsvStateDigest::verifyProof(
+      root, "balance:bob@test:coin#test", "100.0", *proof));
+  EXPECT_FALSE(WsvStateDigest::verifyProof(
+      WsvStateDigest{}.root(), "balance:alice@test:coin#test", "100.0",
+      *proof));
+
+  EXPECT_FALSE(digest.proof("balance:carol@test:coin#test"));
+}
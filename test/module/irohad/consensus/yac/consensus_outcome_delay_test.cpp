@@ -0,0 +1,121 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/impl/consensus_outcome_delay.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace iroha::consensus::yac;
+using namespace std::chrono_literals;
+
+/**
+ * @given a delay with 3000 ms maximum
+ * @when a sequence of empty round outcomes is reported
+ * @then the first rounds are free, then the delay doubles up to the
+ * maximum
+ */
+TEST(ConsensusOutcomeDelayTest, EmptyRoundsStretchExponentially) {
+  ConsensusOutcomeDelay delay(3000ms);
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(0ms, delay(ConsensusOutcomeType::kNothing)) << "round " << i;
+  }
+  EXPECT_EQ(125ms, delay(ConsensusOutcomeType::kNothing));
+  EXPECT_EQ(250ms, delay(ConsensusOutcomeType::kNothing));
+  EXPECT_EQ(500ms, delay(ConsensusOutcomeType::kNothing));
+  EXPECT_EQ(1000ms, delay(ConsensusOutcomeType::kNothing));
+  EXPECT_EQ(2000ms, delay(ConsensusOutcomeType::kNothing));
+  EXPECT_EQ(3000ms, delay(ConsensusOutcomeType::kNothing));
+  // bounded by the configured maximum from here on
+  EXPECT_EQ(3000ms, delay(ConsensusOutcomeType::kNothing));
+}
+
+/**
+ * @given a delay stretched by a long sequence of empty rounds
+ * @when a commit outcome is reported
+ * @then the following empty rounds start from the free cadence again
+ */
+TEST(ConsensusOutcomeDelayTest, CommitResetsTheStretch) {
+  ConsensusOutcomeDelay delay(3000ms);
+
+  for (int i = 0; i < 20; ++i) {
+    delay(ConsensusOutcomeType::kNothing);
+  }
+  EXPECT_EQ(0ms, delay(ConsensusOutcomeType::kCommit));
+  EXPECT_EQ(0ms, delay(ConsensusOutcomeType::kNothing));
+}
+
+/**
+ * @given a delay stretched by a long sequence of empty rounds
+ * @when batch arrival is reported through a copy of the delay
+ * @then the shared stretch state is reset
+ */
+TEST(ConsensusOutcomeDelayTest, BatchArrivalSnapsTheCadenceBack) {
+  ConsensusOutcomeDelay delay(3000ms);
+  ConsensusOutcomeDelay ordering_side_copy = delay;
+
+  for (int i = 0; i < 20; ++i) {
+    delay(ConsensusOutcomeType::kNothing);
+  }
+  ordering_side_copy.onBatchesArrived();
+  EXPECT_EQ(0ms, delay(ConsensusOutcomeType::kNothing));
+}
+
+/**
+ * @given a delay observing reject outcomes
+ * @when rejects are reported
+ * @then the delay grows linearly by 1000 ms every second reject
+ */
+TEST(ConsensusOutcomeDelayTest, RejectsKeepTheLinearBackoff) {
+  ConsensusOutcomeDelay delay(3000ms);
+
+  EXPECT_EQ(0ms, delay(ConsensusOutcomeType::kReject));
+  EXPECT_EQ(1000ms, delay(ConsensusOutcomeType::kReject));
+  EXPECT_EQ(1000ms, delay(ConsensusOutcomeType::kReject));
+  EXPECT_EQ(2000ms, delay(ConsensusOutcomeType::kReject));
+}
+
+/**
+ * @given a delay whose consumer never reported readiness
+ * @when outcomes await the consumer
+ * @then they pass through without blocking
+ */
+TEST(ConsensusOutcomeDelayTest, HandshakeInactiveWithoutConsumer) {
+  ConsensusOutcomeDelay delay(3000ms);
+
+  auto const start = std::chrono::steady_clock::now();
+  delay.awaitConsumerReady();
+  delay.awaitConsumerReady();
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 500ms);
+}
+
+/**
+ * @given a delay with the readiness handshake active
+ * @when an outcome awaits a consumer that is still processing
+ * @then it is released as soon as the consumer reports readiness
+ */
+TEST(ConsensusOutcomeDelayTest, OutcomeWaitsForConsumerReadiness) {
+  ConsensusOutcomeDelay delay(3000ms);
+  ConsensusOutcomeDelay synchronizer_side_copy = delay;
+
+  // activates the handshake and releases the first awaiting outcome
+  synchronizer_side_copy.onOutcomeProcessed();
+  delay.awaitConsumerReady();
+
+  std::thread consumer([&synchronizer_side_copy] {
+    std::this_thread::sleep_for(50ms);
+    synchronizer_side_copy.onOutcomeProcessed();
+  });
+  auto const start = std::chrono::steady_clock::now();
+  delay.awaitConsumerReady();
+  auto const waited = std::chrono::steady_clock::now() - start;
+  consumer.join();
+
+  EXPECT_GE(waited, 50ms);
+  // well below the lost-signal bound - the signal released the outcome
+  EXPECT_LT(waited, 500ms);
+}
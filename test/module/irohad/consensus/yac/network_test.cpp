@@ -7,6 +7,10 @@
 
 #include <grpc++/grpc++.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include "consensus/yac/transport/yac_pb_converters.hpp"
 #include "framework/mock_stream.h"
 #include "framework/test_logger.hpp"
@@ -123,6 +127,68 @@ namespace iroha {
         auto response = network->SendState(&context, &request, nullptr);
         ASSERT_EQ(response.error_code(), grpc::StatusCode::CANCELLED);
       }
+
+      /**
+       * @given network with a non-zero send window
+       * @when two states are sent to the same peer within the window
+       * @then the votes are coalesced into a single message without duplicates
+       */
+      TEST_F(YacNetworkTest, VotesBundledWithinSendWindow) {
+        auto *bundling_client_factory =
+            new iroha::network::MockClientFactory<NetworkImpl::Service>();
+        auto bundling_network = std::make_shared<NetworkImpl>(
+            async_call,
+            std::unique_ptr<NetworkImpl::ClientFactory>(
+                bundling_client_factory),
+            getTestLogger("YacNetwork"),
+            std::chrono::milliseconds(50));
+
+        proto::State request;
+        std::atomic<bool> sent{false};
+        auto r = std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+            google::protobuf::Empty>>();
+        auto stub =
+            std::make_unique<iroha::consensus::yac::proto::MockYacStub>();
+        EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+            .WillOnce(DoAll(SaveArg<1>(&request),
+                            InvokeWithoutArgs([&sent] { sent = true; }),
+                            Return(r.get())));
+        EXPECT_CALL(*bundling_client_factory, createClient(_))
+            .WillOnce(Return(ByMove(std::move(stub))));
+
+        auto second_message = message;
+        second_message.hash.vote_round.block_round = 2;
+
+        bundling_network->sendState(*peer, {message});
+        // the first vote is outstanding and must not be duplicated
+        bundling_network->sendState(*peer, {message, second_message});
+
+        for (int i = 0; not sent and i < 100; ++i) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_TRUE(sent);
+        ASSERT_EQ(request.votes_size(), 2);
+      }
+
+      /**
+       * @given initialized network
+       * @when a bundled message with votes of two different rounds arrives
+       * @then each round's votes are handed to the pipeline separately
+       */
+      TEST_F(YacNetworkTest, MixedRoundsSplitOnReceive) {
+        proto::State request;
+        grpc::ServerContext context;
+
+        *request.add_votes() = PbConverters::serializeVote(message);
+        auto second_message = message;
+        second_message.hash.vote_round.block_round = 2;
+        *request.add_votes() = PbConverters::serializeVote(second_message);
+
+        EXPECT_CALL(*notifications, onState(_)).Times(2);
+
+        auto response = network->SendState(&context, &request, nullptr);
+        ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
+      }
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
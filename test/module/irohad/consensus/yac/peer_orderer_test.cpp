@@ -80,6 +80,23 @@ TEST_F(YacPeerOrdererTest, PeerOrdererOrderingWhenEmptyPeerList) {
   ASSERT_EQ(order, boost::none);
 }
 
+/**
+ * @given an orderer which has already served orderings for other hashes
+ * @when calling ordering function repeatedly with the same hash
+ * @then the same peer order is returned every time
+ */
+TEST_F(YacPeerOrdererTest, PeerOrdererOrderingIsDeterministic) {
+  auto hash = YacHash(iroha::consensus::Round{1, 1}, "proposal", "block");
+  auto other_hash = YacHash(iroha::consensus::Round{1, 2}, "other", "other");
+
+  auto first = orderer.getOrdering(hash, s_peers).value().getPeers();
+  // a different seed in between must not corrupt the order for the original
+  orderer.getOrdering(other_hash, s_peers);
+  auto second = orderer.getOrdering(hash, s_peers).value().getPeers();
+
+  ASSERT_EQ(first, second);
+}
+
 /**
  * @given initial peer list in the ledger
  * @when calling ordering function on hash ["1" to "N"] k times
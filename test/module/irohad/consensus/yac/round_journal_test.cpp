@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/storage/round_journal.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "framework/test_logger.hpp"
+#include "module/irohad/consensus/yac/yac_test_util.hpp"
+
+using namespace iroha::consensus;
+using namespace iroha::consensus::yac;
+
+class RoundJournalTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    path = "round_journal_test.bin";
+    std::remove(path.c_str());
+  }
+
+  void TearDown() override {
+    std::remove(path.c_str());
+  }
+
+  auto makeJournal() {
+    return std::make_unique<RoundJournal>(path,
+                                          getTestLogger("RoundJournal"));
+  }
+
+  std::string path;
+};
+
+/**
+ * @given an empty journal
+ * @when nothing has been recorded
+ * @then no round and no certificate are restored
+ */
+TEST_F(RoundJournalTest, EmptyJournal) {
+  auto journal = makeJournal();
+  ASSERT_FALSE(journal->lastVotedRound());
+  ASSERT_FALSE(journal->lastCertificate());
+}
+
+/**
+ * @given a journal with several recorded votes and certificates
+ * @when the journal is reopened, as happens on restart
+ * @then the last voted round and the last certificate are restored
+ */
+TEST_F(RoundJournalTest, RestoresLastRecords) {
+  std::vector<VoteMessage> certificate{
+      createVote(YacHash(Round{2, 1}, "proposal", "block"), "one"),
+      createVote(YacHash(Round{2, 1}, "proposal", "block"), "two")};
+  {
+    auto journal = makeJournal();
+    journal->recordVote(Round{2, 1});
+    journal->recordCertificate(certificate);
+    journal->recordVote(Round{3, 4});
+  }
+
+  auto journal = makeJournal();
+  ASSERT_TRUE(journal->lastVotedRound());
+  EXPECT_EQ(*journal->lastVotedRound(), (Round{3, 4}));
+
+  ASSERT_TRUE(journal->lastCertificate());
+  auto restored = *journal->lastCertificate();
+  ASSERT_EQ(restored.size(), certificate.size());
+  for (size_t i = 0; i < restored.size(); ++i) {
+    EXPECT_EQ(restored[i], certificate[i]);
+  }
+}
+
+/**
+ * @given a journal whose last record is truncated, as happens after a
+ * crash mid-write
+ * @when the journal is reopened
+ * @then the previous complete records are restored
+ */
+TEST_F(RoundJournalTest, ToleratesTruncatedTail) {
+  {
+    auto journal = makeJournal();
+    journal->recordVote(Round{5, 2});
+  }
+  {
+    // append an incomplete vote record
+    std::ofstream out(path, std::ios::binary | std::ios::app);
+    out.put('V');
+    out.put('\x01');
+  }
+
+  auto journal = makeJournal();
+  ASSERT_TRUE(journal->lastVotedRound());
+  EXPECT_EQ(*journal->lastVotedRound(), (Round{5, 2}));
+}
@@ -66,6 +66,45 @@ namespace iroha {
         ASSERT_TRUE(crypto_provider->verify({vote}));
       }
 
+      /**
+       * @given a vote which has already been verified once
+       * @when the same vote is verified again, as happens on redelivery
+       * during state propagation
+       * @then verification succeeds, this time via the cache
+       */
+      TEST_F(YacCryptoProviderTest, ValidWhenRedelivered) {
+        YacHash hash(Round{1, 1}, "1", "1");
+
+        hash.block_signature = makeSignature();
+
+        auto vote = crypto_provider->getVote(hash);
+
+        ASSERT_TRUE(crypto_provider->verify({vote}));
+        ASSERT_TRUE(crypto_provider->verify({vote}));
+      }
+
+      /**
+       * @given a bundle large enough to be fanned out over several workers
+       * @when all its votes are valid
+       * @then verification succeeds
+       * @when one vote of the bundle is tampered with
+       * @then verification fails
+       */
+      TEST_F(YacCryptoProviderTest, LargeBundle) {
+        std::vector<VoteMessage> votes;
+        for (size_t i = 0; i < 64; ++i) {
+          YacHash hash(Round{i, 0}, "proposal", "block");
+          hash.block_signature = makeSignature();
+          votes.push_back(crypto_provider->getVote(hash));
+        }
+
+        ASSERT_TRUE(crypto_provider->verify(votes));
+
+        votes.at(votes.size() / 2).hash.vote_hashes.block_hash =
+            "hash changed";
+        ASSERT_FALSE(crypto_provider->verify(votes));
+      }
+
       TEST_F(YacCryptoProviderTest, InvalidWhenMessageChanged) {
         YacHash hash(Round{1, 1}, "1", "1");
 
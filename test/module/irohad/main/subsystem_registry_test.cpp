@@ -0,0 +1,43 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "main/subsystem_registry.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+  /// a distinct interface keeps this test away from the registries of
+  /// the real engines, which live for the whole binary
+  struct TestEngine {
+    virtual ~TestEngine() = default;
+    virtual int id() const = 0;
+  };
+
+  struct EngineA : TestEngine {
+    int id() const override {
+      return 1;
+    }
+  };
+}  // namespace
+
+using Registry = iroha::SubsystemRegistry<TestEngine>;
+
+/**
+ * @given a registry with one registered engine
+ * @when the registered and an unknown engine are requested
+ * @then the registered one is created and the unknown one is absent
+ */
+TEST(SubsystemRegistryTest, CreatesRegisteredEngines) {
+  Registry::instance().add("a", [] { return std::make_unique<EngineA>(); });
+
+  auto engine = Registry::instance().create("a");
+  ASSERT_TRUE(engine);
+  EXPECT_EQ(engine->id(), 1);
+
+  EXPECT_FALSE(Registry::instance().create("absent"));
+
+  auto names = Registry::instance().registered();
+  EXPECT_EQ(names, std::vector<std::string>{"a"});
+}
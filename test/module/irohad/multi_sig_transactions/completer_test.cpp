@@ -109,6 +109,23 @@ TEST(CompleterTest, BatchExpirationTestExpired) {
       batch, time + std::chrono::minutes(2) / std::chrono::milliseconds(1)));
 }
 
+/**
+ * @given batch with a transaction with now() creation time and completer
+ * with 1 minute expiration time
+ * @when the expiration deadline of the batch is requested
+ * @then the batch is not expired right before the deadline and expired at it
+ */
+TEST(CompleterTest, BatchExpirationDeadlineMatchesIsExpired) {
+  auto completer = std::make_shared<DefaultCompleter>(std::chrono::minutes(1));
+  auto time = iroha::time::now();
+  auto tx = std::make_shared<MockTransaction>();
+  EXPECT_CALL(*tx, createdTime()).WillRepeatedly(Return(time));
+  auto batch = createMockBatchWithTransactions({tx}, "");
+  auto deadline = completer->expirationDeadline(batch);
+  ASSERT_FALSE(completer->isExpired(batch, deadline - 1));
+  ASSERT_TRUE(completer->isExpired(batch, deadline));
+}
+
 /**
  * @given batch with 3 transactions: first one in 2 minutes from now,
  * second one in 3 minutes from now, third one in 4 minutes from now and
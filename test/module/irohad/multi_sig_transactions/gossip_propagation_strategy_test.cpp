@@ -170,6 +170,102 @@ TEST(GossipPropagationStrategyTest, ErrorEmitting) {
   ASSERT_EQ(emitted.size(), 0);
 }
 
+/**
+ * @given strategy that was told the pending state is empty
+ * @when several emission periods pass
+ * @then no peers are emitted
+ */
+TEST(GossipPropagationStrategyTest, IdleSuppressesEmission) {
+  auto peers_size = 10;
+  std::vector<std::string> peersId;
+  PropagationData peers = generate(peersId, peers_size);
+
+  auto query = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*query, getLedgerPeers()).WillRepeatedly(testing::Return(peers));
+  auto pbfactory = std::make_shared<MockPeerQueryFactory>();
+  EXPECT_CALL(*pbfactory, createPeerQuery())
+      .WillRepeatedly(testing::Return(boost::make_optional(
+          std::shared_ptr<iroha::ametsuchi::PeerQuery>(query))));
+  iroha::GossipPropagationStrategyParams gossip_params;
+  gossip_params.emission_period = 1ms;
+  gossip_params.amount_per_once = 2;
+  GossipPropagationStrategy strategy(
+      pbfactory, rxcpp::observe_on_event_loop(), gossip_params);
+
+  strategy.onStateChange(0, false);
+  auto emitted = subscribeAndEmit(strategy, 3);
+
+  ASSERT_EQ(emitted.size(), 0);
+}
+
+/**
+ * @given strategy that was told about a large pending backlog
+ * @when an emission period passes
+ * @then the emission is widened up to the boost cap
+ */
+TEST(GossipPropagationStrategyTest, BacklogWidensEmission) {
+  auto peers_size = 10;
+  std::vector<std::string> peersId;
+  PropagationData peers = generate(peersId, peers_size);
+
+  auto query = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*query, getLedgerPeers()).WillRepeatedly(testing::Return(peers));
+  auto pbfactory = std::make_shared<MockPeerQueryFactory>();
+  EXPECT_CALL(*pbfactory, createPeerQuery())
+      .WillRepeatedly(testing::Return(boost::make_optional(
+          std::shared_ptr<iroha::ametsuchi::PeerQuery>(query))));
+  iroha::GossipPropagationStrategyParams gossip_params;
+  gossip_params.emission_period = 1ms;
+  gossip_params.amount_per_once = 1;
+  GossipPropagationStrategy strategy(
+      pbfactory, rxcpp::observe_on_event_loop(), gossip_params);
+
+  // 64 pending batches hit the x4 boost cap with one peer per once
+  strategy.onStateChange(64, false);
+  auto emitted = subscribeAndEmit(strategy, 2);
+
+  ASSERT_EQ(emitted.size(), 2 * 4);
+  ASSERT_TRUE(validateEmitted(emitted, peersId));
+}
+
+/**
+ * @given strategy with a long emission period and an active subscriber
+ * @when a quorum completion is reported
+ * @then peers are emitted immediately instead of on the next period tick
+ */
+TEST(GossipPropagationStrategyTest, ImmediateEmissionOnQuorumCompletion) {
+  auto peers_size = 10;
+  uint32_t amount = 2;
+  std::vector<std::string> peersId;
+  PropagationData peers = generate(peersId, peers_size);
+
+  auto query = std::make_shared<MockPeerQuery>();
+  EXPECT_CALL(*query, getLedgerPeers()).WillRepeatedly(testing::Return(peers));
+  auto pbfactory = std::make_shared<MockPeerQueryFactory>();
+  EXPECT_CALL(*pbfactory, createPeerQuery())
+      .WillRepeatedly(testing::Return(boost::make_optional(
+          std::shared_ptr<iroha::ametsuchi::PeerQuery>(query))));
+  iroha::GossipPropagationStrategyParams gossip_params;
+  gossip_params.emission_period = std::chrono::hours(1);
+  gossip_params.amount_per_once = amount;
+  GossipPropagationStrategy strategy(
+      pbfactory, rxcpp::observe_on_new_thread(), gossip_params);
+
+  // the initial tick of the interval observable fires right at
+  // subscription; an empty pending state turns it into a no-op
+  strategy.onStateChange(0, false);
+
+  PropagationData emitted;
+  std::thread subscriber(
+      [&emitted, &strategy] { emitted = subscribeAndEmit(strategy, 2); });
+  std::this_thread::sleep_for(100ms);
+  strategy.onStateChange(1, true);
+  subscriber.join();
+
+  ASSERT_EQ(emitted.size(), amount);
+  ASSERT_TRUE(validateEmitted(emitted, peersId));
+}
+
 /**
  * @given list of peers and
  *        strategy that emits two peers
@@ -122,6 +122,29 @@ TEST_F(StorageTest, StorageDoesNotFindNonExistingBatch) {
   EXPECT_FALSE(storage->batchInStorage(distinct_batch));
 }
 
+/**
+ * @given storage with three batches, all already acknowledged by a peer
+ * @when diff states for that peer are requested repeatedly
+ * @then the diffs stay empty until the anti-entropy interval passes, after
+ * which the full own state is offered again
+ */
+TEST_F(StorageTest, StoragePeriodicallyResendsAcknowledgedState) {
+  const shared_model::interface::types::PublicKeyHexStringView peer_key{
+      std::string_view{"0B"}};
+
+  // the peer acknowledged everything we have
+  auto acknowledged = storage->getDiffState(peer_key, creation_time);
+  ASSERT_EQ(3, acknowledged.getBatches().size());
+  storage->apply(peer_key, acknowledged);
+
+  bool got_full_resend = false;
+  for (auto i = 0; i < 20 and not got_full_resend; ++i) {
+    got_full_resend =
+        storage->getDiffState(peer_key, creation_time).getBatches().size() == 3;
+  }
+  EXPECT_TRUE(got_full_resend);
+}
+
 /**
  * @given storage with a batch from peer A (quorum = 3, 1 signature)
  * @when the batch gets updated with a new signature from Torii
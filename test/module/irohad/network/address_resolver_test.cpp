@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/address_resolver.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::network;
+
+/**
+ * @given peer addresses of every supported form
+ * @when they are split into host and port
+ * @then names, IPv4 and bracketed IPv6 literals are parsed and broken
+ * addresses are rejected
+ */
+TEST(AddressResolverTest, SplitHostPort) {
+  auto name = splitHostPort("example.com:50541");
+  ASSERT_TRUE(name);
+  EXPECT_EQ("example.com", name->first);
+  EXPECT_EQ("50541", name->second);
+
+  auto v6 = splitHostPort("[::1]:50541");
+  ASSERT_TRUE(v6);
+  EXPECT_EQ("::1", v6->first);
+  EXPECT_EQ("50541", v6->second);
+
+  EXPECT_FALSE(splitHostPort("noport"));
+  EXPECT_FALSE(splitHostPort("trailing:"));
+  EXPECT_FALSE(splitHostPort(":50541"));
+}
+
+/**
+ * @given IPv4, IPv6 and name hosts
+ * @when they are checked for being numeric
+ * @then only the literals need no resolution
+ */
+TEST(AddressResolverTest, IsNumericHost) {
+  EXPECT_TRUE(isNumericHost("127.0.0.1"));
+  EXPECT_TRUE(isNumericHost("::1"));
+  EXPECT_FALSE(isNumericHost("localhost"));
+  EXPECT_FALSE(isNumericHost("example.com"));
+}
+
+/**
+ * @given an address resolver
+ * @when a numeric address is looked up
+ * @then no substitution is offered
+ */
+TEST(AddressResolverTest, NumericAddressesPassThrough) {
+  AddressResolver resolver(getTestLogger("AddressResolver"));
+  EXPECT_FALSE(resolver.tryGetResolved("127.0.0.1:50541"));
+  EXPECT_FALSE(resolver.tryGetResolved("[::1]:50541"));
+}
+
+/**
+ * @given an address resolver
+ * @when a resolvable host name is looked up
+ * @then the first lookup does not block or produce a result, and the
+ * background resolution makes a numeric address available soon after
+ */
+TEST(AddressResolverTest, NameIsResolvedInBackground) {
+  AddressResolver resolver(getTestLogger("AddressResolver"));
+  EXPECT_FALSE(resolver.tryGetResolved("localhost:50541"));
+
+  std::optional<std::string> resolved;
+  for (int i = 0; i < 100 and not resolved; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    resolved = resolver.tryGetResolved("localhost:50541");
+  }
+  ASSERT_TRUE(resolved);
+  EXPECT_TRUE(*resolved == "127.0.0.1:50541" or *resolved == "[::1]:50541")
+      << *resolved;
+}
@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/async_grpc_client.hpp"
+
+#include <gtest/gtest.h>
+#include "framework/mock_stream.h"
+#include "framework/test_logger.hpp"
+
+using iroha::network::AsyncGrpcClient;
+
+namespace {
+  auto makeMockReader() {
+    auto reader = std::make_unique<
+        grpc::testing::MockClientAsyncResponseReader<google::protobuf::Empty>>();
+    // started calls never complete in this test, so their state objects,
+    // including the readers, are intentionally not reclaimed
+    ::testing::Mock::AllowLeak(reader.get());
+    return reader;
+  }
+}  // namespace
+
+/**
+ * @given an async client and a destination with a full outstanding budget
+ * @when one more call to that destination is requested
+ * @then the call is not started and its callback observes a failed status
+ */
+TEST(AsyncGrpcClientTest, RejectsCallsBeyondDestinationBudget) {
+  AsyncGrpcClient<google::protobuf::Empty> client(
+      getTestLogger("AsyncGrpcClient"));
+  const std::string destination{"peer:50541"};
+
+  for (size_t i = 0;
+       i < AsyncGrpcClient<google::protobuf::Empty>::
+               kMaxOutstandingPerDestination;
+       ++i) {
+    client.Call(destination, [](auto, auto) { return makeMockReader(); });
+  }
+
+  bool rejected = false;
+  client.Call(
+      destination,
+      [](auto, auto) { return makeMockReader(); },
+      [&rejected](grpc::Status &status, google::protobuf::Empty &) {
+        rejected = true;
+        EXPECT_EQ(status.error_code(), grpc::StatusCode::RESOURCE_EXHAUSTED);
+      });
+  EXPECT_TRUE(rejected);
+
+  // another destination is not affected by the exhausted budget
+  bool other_rejected = false;
+  client.Call(
+      "peer:50542",
+      [](auto, auto) { return makeMockReader(); },
+      [&other_rejected](grpc::Status &status, google::protobuf::Empty &) {
+        other_rejected = not status.ok();
+      });
+  EXPECT_FALSE(other_rejected);
+}
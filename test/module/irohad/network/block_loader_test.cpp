@@ -3,11 +3,13 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <grpc++/create_channel.h>
 #include <grpc++/security/server_credentials.h>
 #include <grpc++/server.h>
 #include <grpc++/server_builder.h>
 #include <gtest/gtest.h>
 
+#include "ametsuchi/impl/recent_blocks_cache.hpp"
 #include "builders/protobuf/builder_templates/transaction_template.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "cryptography/hash.hpp"
@@ -62,6 +64,7 @@ class BlockLoaderTest : public testing::Test {
     auto validator_ptr =
         std::make_unique<MockValidator<shared_model::interface::Block>>();
     validator = validator_ptr.get();
+    pushed_blocks_cache = std::make_shared<RecentBlocksCache>();
     loader = std::make_shared<BlockLoaderImpl>(
         peer_query_factory,
         std::make_shared<shared_model::proto::ProtoBlockFactory>(
@@ -69,9 +72,18 @@ class BlockLoaderTest : public testing::Test {
             std::make_unique<MockValidator<iroha::protocol::Block>>()),
         getTestLogger("BlockLoader"),
         std::make_unique<ClientFactoryImpl<BlockLoaderImpl::Service>>(
-            getTestInsecureClientFactory(getDefaultTestChannelParams())));
+            getTestInsecureClientFactory(getDefaultTestChannelParams())),
+        pushed_blocks_cache);
+    recent_blocks_cache = std::make_shared<RecentBlocksCache>();
     service = std::make_shared<BlockLoaderService>(
-        block_query_factory, block_cache, getTestLogger("BlockLoaderService"));
+        block_query_factory,
+        block_cache,
+        recent_blocks_cache,
+        getTestLogger("BlockLoaderService"),
+        pushed_blocks_cache,
+        std::make_shared<shared_model::proto::ProtoBlockFactory>(
+            std::make_unique<MockValidator<shared_model::interface::Block>>(),
+            std::make_unique<MockValidator<iroha::protocol::Block>>()));
 
     grpc::ServerBuilder builder;
     int port = 0;
@@ -135,6 +147,8 @@ class BlockLoaderTest : public testing::Test {
   std::shared_ptr<MockBlockQuery> storage;
   std::shared_ptr<MockBlockQueryFactory> block_query_factory;
   std::shared_ptr<BlockLoaderImpl> loader;
+  std::shared_ptr<RecentBlocksCache> recent_blocks_cache;
+  std::shared_ptr<RecentBlocksCache> pushed_blocks_cache;
   std::shared_ptr<BlockLoaderService> service;
   std::unique_ptr<grpc::Server> server;
   std::shared_ptr<iroha::consensus::ConsensusResultCache> block_cache;
@@ -237,6 +251,48 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given the head of the missing range pushed by committing peers
+ * @when retrieveBlocks is called
+ * @then the pushed blocks are served from the ring @and only the rest of
+ * the range is fetched from the network
+ */
+TEST_F(BlockLoaderTest, RetrieveBlocksServesPushedPrefix) {
+  shared_model::interface::types::HeightType my_height = 1;
+  for (auto i = my_height + 1; i <= my_height + 2; ++i) {
+    pushed_blocks_cache->push(std::make_shared<shared_model::proto::Block>(
+        getBaseBlockBuilder()
+            .height(i)
+            .build()
+            .signAndAddSignature(key)
+            .finish()));
+  }
+  auto top_height = my_height + 3;
+  auto top_block = getBaseBlockBuilder()
+                       .height(top_height)
+                       .build()
+                       .signAndAddSignature(key)
+                       .finish();
+
+  setPeerQuery();
+  EXPECT_CALL(*storage, getTopBlockHeight()).WillOnce(Return(top_height));
+  // the pushed blocks must not be requested again over the network
+  EXPECT_CALL(*storage, getBlock(my_height + 1)).Times(0);
+  EXPECT_CALL(*storage, getBlock(my_height + 2)).Times(0);
+  EXPECT_CALL(*storage, getBlock(top_height))
+      .WillOnce(Return(ByMove(iroha::expected::makeValue(
+          clone<shared_model::interface::Block>(top_block)))));
+
+  auto retrieved_blocks =
+      loader->retrieveBlocks(my_height, peer_key).assumeValue();
+  auto wrapper = make_test_subscriber<CallExact>(retrieved_blocks, 3);
+  auto height = my_height + 1;
+  wrapper.subscribe(
+      [&height](auto block) { ASSERT_EQ(block->height(), height++); });
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 MATCHER_P(RefAndPointerEq, arg1, "") {
   return arg == *arg1;
 }
@@ -285,6 +341,44 @@ TEST_F(BlockLoaderTest, ValidWhenBlockMissing) {
   EXPECT_EQ(*prev_block, *retrieveBlockAndCompare(prev_block->height()));
 }
 
+/**
+ * @given block loader @and empty consensus cache @and ring of recent blocks
+ * with a block
+ * @when retrieveBlock is called with the related height
+ * @then the block is served from the ring @and storage is not asked
+ */
+TEST_F(BlockLoaderTest, ValidWhenBlockInRecentRing) {
+  auto block = std::make_shared<shared_model::proto::Block>(
+      getBaseBlockBuilder().build().signAndAddSignature(key).finish());
+  recent_blocks_cache->push(block);
+
+  setPeerQuery();
+  EXPECT_CALL(*storage, getBlock(_)).Times(0);
+
+  EXPECT_EQ(*block, *retrieveBlockAndCompare(block->height()));
+}
+
+/**
+ * @given a block pushed to the service by a committing peer
+ * @when retrieveBlock is called with its height
+ * @then the block is served from the pushed blocks cache @and neither the
+ * peer list nor the network is touched
+ */
+TEST_F(BlockLoaderTest, ValidWhenBlockPushed) {
+  auto block = getBaseBlockBuilder().build().signAndAddSignature(key).finish();
+
+  auto stub = proto::Loader::NewStub(
+      grpc::CreateChannel(address, grpc::InsecureChannelCredentials()));
+  grpc::ClientContext context;
+  iroha::protocol::Block request;
+  *request.mutable_block_v1() = block.getTransport();
+  proto::PushBlockResponse response;
+  ASSERT_TRUE(stub->pushBlock(&context, request, &response).ok());
+
+  // no peer query expectations: a lookup going to the network would fail
+  EXPECT_EQ(block, *retrieveBlockAndCompare(block.height()));
+}
+
 /**
  * @given block loader @and empty consensus cache @and two blocks in storage
  * @when retrieveBlock is called with first block's height
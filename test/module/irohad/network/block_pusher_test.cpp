@@ -0,0 +1,100 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/block_pusher.hpp"
+
+#include <set>
+
+#include <gtest/gtest.h>
+#include "module/shared_model/interface_mocks.hpp"
+
+using iroha::network::selectPushTargets;
+using shared_model::interface::types::PublicKeyHexStringView;
+
+namespace {
+  std::string pubkeyOf(size_t index) {
+    return std::string(64, static_cast<char>('0' + index));
+  }
+
+  std::vector<std::shared_ptr<shared_model::interface::Peer>> makePeers(
+      size_t count) {
+    std::vector<std::shared_ptr<shared_model::interface::Peer>> peers;
+    for (size_t i = 0; i < count; ++i) {
+      const auto pubkey = pubkeyOf(i);
+      peers.push_back(makePeer("127.0.0.1:1055" + std::to_string(i),
+                               PublicKeyHexStringView{pubkey}));
+    }
+    return peers;
+  }
+}  // namespace
+
+/**
+ * @given five ledger peers including this node
+ * @when targets are selected with fanout two
+ * @then two distinct other peers are returned, and the same input yields
+ * the same targets again
+ */
+TEST(BlockPusherTest, SelectsDistinctOtherPeers) {
+  auto peers = makePeers(5);
+  auto targets = selectPushTargets(peers, pubkeyOf(2), 10, 2);
+  ASSERT_EQ(targets.size(), 2);
+  std::set<std::string> pubkeys;
+  for (const auto &target : targets) {
+    EXPECT_NE(target->pubkey(), pubkeyOf(2));
+    pubkeys.insert(target->pubkey());
+  }
+  EXPECT_EQ(pubkeys.size(), 2);
+
+  auto again = selectPushTargets(peers, pubkeyOf(2), 10, 2);
+  ASSERT_EQ(again.size(), 2);
+  for (size_t i = 0; i < targets.size(); ++i) {
+    EXPECT_EQ(targets[i]->pubkey(), again[i]->pubkey());
+  }
+}
+
+/**
+ * @given five ledger peers including this node
+ * @when targets are selected for consecutive heights
+ * @then the selection rotates, and every other peer is targeted within a
+ * window of heights
+ */
+TEST(BlockPusherTest, RotatesTargetsWithHeight) {
+  auto peers = makePeers(5);
+  std::set<std::string> seen;
+  for (size_t height = 0; height < peers.size() - 1; ++height) {
+    for (const auto &target :
+         selectPushTargets(peers, pubkeyOf(0), height, 1)) {
+      seen.insert(target->pubkey());
+    }
+  }
+  // with fanout one and rotation, the heights spread over all the others
+  EXPECT_EQ(seen.size(), peers.size() - 1);
+}
+
+/**
+ * @given three ledger peers including this node
+ * @when the requested fanout exceeds the number of other peers
+ * @then each other peer is selected exactly once
+ */
+TEST(BlockPusherTest, FanoutClampedToOtherPeers) {
+  auto peers = makePeers(3);
+  auto targets = selectPushTargets(peers, pubkeyOf(1), 7, 10);
+  ASSERT_EQ(targets.size(), 2);
+  std::set<std::string> pubkeys;
+  for (const auto &target : targets) {
+    pubkeys.insert(target->pubkey());
+  }
+  EXPECT_EQ(pubkeys, (std::set<std::string>{pubkeyOf(0), pubkeyOf(2)}));
+}
+
+/**
+ * @given ledger peers which do not include this node, or this node alone
+ * @when targets are selected
+ * @then nothing is selected
+ */
+TEST(BlockPusherTest, NoTargetsWithoutRingPosition) {
+  EXPECT_TRUE(selectPushTargets(makePeers(4), pubkeyOf(7), 1, 2).empty());
+  EXPECT_TRUE(selectPushTargets(makePeers(1), pubkeyOf(0), 1, 2).empty());
+}
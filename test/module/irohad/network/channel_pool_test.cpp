@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/channel_pool.hpp"
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using iroha::network::ChannelPool;
+using iroha::network::ChannelProvider;
+using shared_model::interface::types::PublicKeyHexStringView;
+
+namespace {
+  constexpr auto kServiceName = "test.Service";
+
+  struct CountingChannelProvider : public ChannelProvider {
+    iroha::expected::Result<std::shared_ptr<grpc::Channel>, std::string>
+    getChannel(const std::string &,
+               const shared_model::interface::Peer &peer) override {
+      ++channels_created;
+      return iroha::expected::makeValue<std::shared_ptr<grpc::Channel>>(
+          grpc::CreateChannel(peer.address(),
+                              grpc::InsecureChannelCredentials()));
+    }
+
+    size_t channels_created{0};
+  };
+}  // namespace
+
+/**
+ * @given a channel pool over a counting channel provider
+ * @when a channel to the same peer is requested twice
+ * @then the cached channel is reused
+ */
+TEST(ChannelPoolTest, ReusesCachedChannel) {
+  auto provider = std::make_unique<CountingChannelProvider>();
+  auto *counter = provider.get();
+  ChannelPool pool(std::move(provider), getTestLogger("ChannelPool"));
+
+  const std::string pubkey(64, '1');
+  auto peer = makePeer("127.0.0.1:50551", PublicKeyHexStringView{pubkey});
+
+  auto first = pool.getChannel(kServiceName, *peer);
+  auto second = pool.getChannel(kServiceName, *peer);
+  ASSERT_TRUE(iroha::expected::hasValue(first));
+  ASSERT_TRUE(iroha::expected::hasValue(second));
+  EXPECT_EQ(first.assumeValue(), second.assumeValue());
+  EXPECT_EQ(counter->channels_created, 1);
+}
+
+/**
+ * @given a channel pool with a cached channel to a peer
+ * @when the peer reappears under another address
+ * @then the stale channel is dropped and a new one is created
+ */
+TEST(ChannelPoolTest, RecreatesChannelWhenPeerAddressChanges) {
+  auto provider = std::make_unique<CountingChannelProvider>();
+  auto *counter = provider.get();
+  ChannelPool pool(std::move(provider), getTestLogger("ChannelPool"));
+
+  const std::string pubkey(64, '1');
+  auto peer = makePeer("127.0.0.1:50551", PublicKeyHexStringView{pubkey});
+  auto moved_peer = makePeer("127.0.0.1:50552", PublicKeyHexStringView{pubkey});
+
+  auto first = pool.getChannel(kServiceName, *peer);
+  auto second = pool.getChannel(kServiceName, *moved_peer);
+  ASSERT_TRUE(iroha::expected::hasValue(first));
+  ASSERT_TRUE(iroha::expected::hasValue(second));
+  EXPECT_NE(first.assumeValue(), second.assumeValue());
+  EXPECT_EQ(counter->channels_created, 2);
+}
+
+/**
+ * @given a channel pool and a list of peers
+ * @when the pool is warmed up with the list
+ * @then a channel per peer exists and later lookups hit the cache
+ */
+TEST(ChannelPoolTest, WarmupCreatesChannelsForAllPeers) {
+  auto provider = std::make_unique<CountingChannelProvider>();
+  auto *counter = provider.get();
+  ChannelPool pool(std::move(provider), getTestLogger("ChannelPool"));
+
+  shared_model::interface::types::PeerList peers;
+  for (int i = 0; i < 3; ++i) {
+    peers.push_back(makePeer("127.0.0.1:5055" + std::to_string(i),
+                             PublicKeyHexStringView{std::string(64, '1' + i)}));
+  }
+
+  pool.warmup(kServiceName, peers);
+  EXPECT_EQ(counter->channels_created, peers.size());
+
+  auto cached = pool.getChannel(kServiceName, *peers.front());
+  ASSERT_TRUE(iroha::expected::hasValue(cached));
+  EXPECT_EQ(counter->channels_created, peers.size());
+}
@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/peer_zones.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::network;
+using shared_model::interface::types::PublicKeyCollectionType;
+
+/**
+ * @given zone labels where two of three peers share the own zone
+ * @when peer candidates are ordered for a bulk transfer
+ * @then the same-zone peers come first
+ *       @and the relative order inside both groups is kept
+ */
+TEST(PeerZonesTest, SameZonePeersComeFirst) {
+  PeerZones zones{"eu-1",
+                  {{"aa", "eu-1"}, {"bb", "us-1"}, {"cc", "eu-1"}}};
+
+  auto ordered = zones.preferSameZone(PublicKeyCollectionType{
+      "bb", "aa", "cc"});
+  ASSERT_EQ(ordered, (PublicKeyCollectionType{"aa", "cc", "bb"}));
+}
+
+/**
+ * @given zone labels which cover none of the candidates
+ * @when peer candidates are ordered
+ * @then the unlabeled peers are treated as remote and keep their order
+ */
+TEST(PeerZonesTest, UnlabeledPeersKeepTheirOrder) {
+  PeerZones zones{"eu-1", {}};
+
+  auto ordered = zones.preferSameZone(PublicKeyCollectionType{
+      "bb", "aa", "cc"});
+  ASSERT_EQ(ordered, (PublicKeyCollectionType{"bb", "aa", "cc"}));
+  ASSERT_FALSE(zones.sameZone("aa"));
+}
+
+/**
+ * @given a zone map keyed with an upper-case hex key
+ * @when the zone of the lower-case spelling of that key is checked
+ * @then the configured label is found
+ */
+TEST(PeerZonesTest, KeyLookupIgnoresHexCase) {
+  PeerZones zones{"eu-1", {{"AB01", "eu-1"}}};
+
+  ASSERT_TRUE(zones.sameZone("ab01"));
+  ASSERT_TRUE(zones.sameZone("AB01"));
+}
@@ -0,0 +1,128 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/wsv_diff_service.hpp"
+
+#include <grpc++/security/server_credentials.h>
+#include <grpc++/server.h>
+#include <grpc++/server_builder.h>
+#include <gtest/gtest.h>
+
+#include "datetime/time.hpp"
+#include "framework/test_client_factory.hpp"
+#include "framework/test_logger.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::network;
+
+class WsvDiffServiceTest : public testing::Test {
+ public:
+  void SetUp() override {
+    service = std::make_shared<WsvDiffService>(getTestLogger("WsvDiff"));
+
+    grpc::ServerBuilder builder;
+    int port = 0;
+    builder.AddListeningPort(
+        "127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(service.get());
+    server = builder.BuildAndStart();
+    ASSERT_TRUE(server);
+    ASSERT_NE(port, 0);
+
+    stub = createInsecureClient<proto::WsvDiff>(
+        "127.0.0.1", port, *getDefaultTestChannelParams());
+  }
+
+  auto makeBlock(shared_model::interface::types::HeightType height,
+                 const shared_model::proto::Transaction &tx) {
+    return TestBlockBuilder()
+        .height(height)
+        .createdTime(iroha::time::now())
+        .transactions(std::vector<shared_model::proto::Transaction>{tx})
+        .build();
+  }
+
+  std::vector<proto::BlockWsvDiff> retrieveDiffs(uint64_t height,
+                                                 grpc::Status &status) {
+    grpc::ClientContext context;
+    proto::WsvDiffRequest request;
+    request.set_height(height);
+    auto reader = stub->retrieveDiffs(&context, request);
+    std::vector<proto::BlockWsvDiff> diffs;
+    proto::BlockWsvDiff diff;
+    while (reader->Read(&diff)) {
+      diffs.push_back(diff);
+    }
+    status = reader->Finish();
+    return diffs;
+  }
+
+  std::shared_ptr<WsvDiffService> service;
+  std::unique_ptr<grpc::Server> server;
+  std::unique_ptr<proto::WsvDiff::StubInterface> stub;
+};
+
+/**
+ * @given wsv diff service which observed two committed blocks
+ * @when  diffs are requested from the second height
+ * @then  only the second diff is streamed
+ *        @and it names the accounts, the asset and the permission change
+ *        touched by the block commands
+ */
+TEST_F(WsvDiffServiceTest, DiffsStreamedFromRequestedHeight) {
+  service->push(makeBlock(1,
+                          TestTransactionBuilder()
+                              .creatorAccountId("admin@test")
+                              .setAccountQuorum("admin@test", 1)
+                              .build()));
+  service->push(
+      makeBlock(2,
+                TestTransactionBuilder()
+                    .creatorAccountId("admin@test")
+                    .transferAsset(
+                        "admin@test", "user@test", "coin#test", "", "1.0")
+                    .grantPermission(
+                        "user@test",
+                        shared_model::interface::permissions::Grantable::
+                            kSetMyQuorum)
+                    .build()));
+
+  grpc::Status status;
+  auto diffs = retrieveDiffs(2, status);
+  ASSERT_TRUE(status.ok());
+  ASSERT_EQ(diffs.size(), 1);
+  EXPECT_EQ(diffs[0].height(), 2);
+
+  std::vector<std::string> accounts{diffs[0].account_ids().begin(),
+                                    diffs[0].account_ids().end()};
+  EXPECT_EQ(accounts,
+            (std::vector<std::string>{"admin@test", "user@test"}));
+  ASSERT_EQ(diffs[0].asset_ids_size(), 1);
+  EXPECT_EQ(diffs[0].asset_ids(0), "coin#test");
+  ASSERT_EQ(diffs[0].permission_diffs_size(), 1);
+  EXPECT_EQ(diffs[0].permission_diffs(0).account_id(), "user@test");
+  EXPECT_EQ(diffs[0].permission_diffs(0).permission(), "can_set_my_quorum");
+  EXPECT_FALSE(diffs[0].permission_diffs(0).removed());
+}
+
+/**
+ * @given wsv diff service whose retained window starts at the first block
+ * @when  diffs are requested below the window
+ * @then  the request is refused so that the feeder falls back to block
+ *        retrieval
+ */
+TEST_F(WsvDiffServiceTest, RequestBelowWindowRefused) {
+  service->push(makeBlock(5,
+                          TestTransactionBuilder()
+                              .creatorAccountId("admin@test")
+                              .setAccountQuorum("admin@test", 1)
+                              .build()));
+
+  grpc::Status status;
+  auto diffs = retrieveDiffs(4, status);
+  ASSERT_EQ(status.error_code(), grpc::StatusCode::NOT_FOUND);
+  ASSERT_TRUE(diffs.empty());
+}
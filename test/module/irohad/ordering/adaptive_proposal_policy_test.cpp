@@ -0,0 +1,86 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/adaptive_proposal_policy.hpp"
+
+#include <gtest/gtest.h>
+
+#include "framework/test_logger.hpp"
+#include "ordering/impl/on_demand_common.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+struct AdaptiveProposalPolicyTest : public ::testing::Test {
+  const size_t kMaxLimit = 1000;
+  const std::chrono::milliseconds kBaseTimeout = 100ms;
+
+  AdaptiveProposalPolicy policy{
+      kMaxLimit, kBaseTimeout, getTestLogger("AdaptiveProposalPolicy")};
+};
+
+/**
+ * @given fresh policy
+ * @when nothing has been reported yet
+ * @then the configured limit and timeout are in effect
+ */
+TEST_F(AdaptiveProposalPolicyTest, InitialValues) {
+  ASSERT_EQ(policy.transactionLimit(), kMaxLimit);
+  ASSERT_EQ(policy.proposalTimeout(), kBaseTimeout);
+}
+
+/**
+ * @given policy with the configured limit in effect
+ * @when a sequence of reject rounds is reported
+ * @then the limit is halved down to its floor and the timeout grows up to
+ * its cap
+ */
+TEST_F(AdaptiveProposalPolicyTest, RejectRoundsShrinkProposals) {
+  policy.onRound({1, kFirstRejectRound + 1}, 0);
+  ASSERT_EQ(policy.transactionLimit(), kMaxLimit / 2);
+  ASSERT_GT(policy.proposalTimeout(), kBaseTimeout);
+
+  for (consensus::RejectRoundType reject_round = 2; reject_round < 20;
+       ++reject_round) {
+    policy.onRound({1, reject_round}, 0);
+  }
+  ASSERT_EQ(policy.transactionLimit(), kMaxLimit / 8);
+  ASSERT_EQ(policy.proposalTimeout(), kBaseTimeout * 4);
+}
+
+/**
+ * @given policy shrunk by reject rounds
+ * @when commit rounds with a deep batch cache are reported
+ * @then the limit grows back to the configured maximum and the timeout
+ * decays to the configured one
+ */
+TEST_F(AdaptiveProposalPolicyTest, CommitRoundsRestoreProposals) {
+  for (consensus::RejectRoundType reject_round = 1; reject_round < 20;
+       ++reject_round) {
+    policy.onRound({1, reject_round}, 0);
+  }
+  ASSERT_LT(policy.transactionLimit(), kMaxLimit);
+
+  for (consensus::BlockRoundType block_round = 2; block_round < 20;
+       ++block_round) {
+    policy.onRound({block_round, kFirstRejectRound}, kMaxLimit);
+  }
+  ASSERT_EQ(policy.transactionLimit(), kMaxLimit);
+  ASSERT_EQ(policy.proposalTimeout(), kBaseTimeout);
+}
+
+/**
+ * @given policy shrunk by a reject round
+ * @when commit rounds arrive while the batch cache stays shallow
+ * @then the limit is not inflated without demand
+ */
+TEST_F(AdaptiveProposalPolicyTest, NoGrowthWithoutDemand) {
+  policy.onRound({1, kFirstRejectRound + 1}, 0);
+  auto limit = policy.transactionLimit();
+
+  policy.onRound({2, kFirstRejectRound}, limit / 2);
+  ASSERT_EQ(policy.transactionLimit(), limit);
+}
@@ -0,0 +1,182 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/batch_journal.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/proto_transport_factory.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "module/shared_model/cryptography/crypto_defaults.hpp"
+#include "module/shared_model/interface/mock_transaction_batch_factory.hpp"
+#include "module/shared_model/validators/validators.hpp"
+
+using namespace iroha::ordering;
+
+using ::testing::A;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+class BatchJournalTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    path = "batch_journal_test.bin";
+    std::remove(path.c_str());
+  }
+
+  void TearDown() override {
+    std::remove(path.c_str());
+  }
+
+  auto makeJournal() {
+    std::unique_ptr<shared_model::validation::AbstractValidator<
+        shared_model::interface::Transaction>>
+        interface_transaction_validator =
+            std::make_unique<shared_model::validation::MockValidator<
+                shared_model::interface::Transaction>>();
+    std::unique_ptr<shared_model::validation::AbstractValidator<
+        iroha::protocol::Transaction>>
+        proto_transaction_validator =
+            std::make_unique<shared_model::validation::MockValidator<
+                iroha::protocol::Transaction>>();
+    auto transaction_factory =
+        std::make_shared<shared_model::proto::ProtoTransportFactory<
+            shared_model::interface::Transaction,
+            shared_model::proto::Transaction>>(
+            std::move(interface_transaction_validator),
+            std::move(proto_transaction_validator));
+    auto batch_parser =
+        std::make_shared<shared_model::interface::TransactionBatchParserImpl>();
+    auto batch_factory =
+        std::make_shared<NiceMock<MockTransactionBatchFactory>>();
+    ON_CALL(
+        *batch_factory,
+        createTransactionBatch(
+            A<shared_model::interface::types::SharedTxsCollectionType>()))
+        .WillByDefault(Invoke(
+            [](const shared_model::interface::types::SharedTxsCollectionType
+                   &cand)
+                -> shared_model::interface::TransactionBatchFactory::
+                    FactoryResult<std::unique_ptr<
+                        shared_model::interface::TransactionBatch>> {
+                      return iroha::expected::makeValue<std::unique_ptr<
+                          shared_model::interface::TransactionBatch>>(
+                          std::make_unique<
+                              shared_model::interface::TransactionBatchImpl>(
+                              cand));
+                    }));
+    return std::make_unique<BatchJournal>(path,
+                                          transaction_factory,
+                                          batch_parser,
+                                          batch_factory,
+                                          getTestLogger("BatchJournal"));
+  }
+
+  std::shared_ptr<shared_model::interface::TransactionBatch> makeBatch(
+      uint64_t seed) {
+    return std::make_shared<shared_model::interface::TransactionBatchImpl>(
+        shared_model::interface::types::SharedTxsCollectionType{
+            std::make_unique<shared_model::proto::Transaction>(
+                shared_model::proto::TransactionBuilder()
+                    .createdTime(iroha::time::now() + seed)
+                    .creatorAccountId("foo@bar")
+                    .createAsset("asset", "domain", 1)
+                    .quorum(1)
+                    .build()
+                    .signAndAddSignature(
+                        shared_model::crypto::DefaultCryptoAlgorithmType::
+                            generateKeypair())
+                    .finish())});
+  }
+
+  std::string path;
+};
+
+/**
+ * @given an empty journal
+ * @when nothing has been appended
+ * @then no batches are replayed
+ */
+TEST_F(BatchJournalTest, EmptyJournal) {
+  auto journal = makeJournal();
+  ASSERT_TRUE(journal->takeReplayedBatches().empty());
+}
+
+/**
+ * @given a journal with two appended batches
+ * @when the journal is reopened, as happens on restart
+ * @then both batches are replayed in the appended order
+ */
+TEST_F(BatchJournalTest, RestoresAppendedBatches) {
+  auto first = makeBatch(1);
+  auto second = makeBatch(2);
+  {
+    auto journal = makeJournal();
+    journal->append(*first);
+    journal->append(*second);
+  }
+
+  auto journal = makeJournal();
+  auto replayed = journal->takeReplayedBatches();
+  ASSERT_EQ(replayed.size(), 2);
+  EXPECT_EQ(replayed[0]->reducedHash(), first->reducedHash());
+  EXPECT_EQ(replayed[1]->reducedHash(), second->reducedHash());
+  // the replayed collection is handed out once
+  ASSERT_TRUE(journal->takeReplayedBatches().empty());
+}
+
+/**
+ * @given a journal with two appended batches
+ * @when the journal is rewritten with only the second, as happens when
+ * the first commits
+ * @then only the second batch is replayed on reopen
+ */
+TEST_F(BatchJournalTest, RewriteDropsCommittedBatches) {
+  auto first = makeBatch(1);
+  auto second = makeBatch(2);
+  {
+    auto journal = makeJournal();
+    journal->append(*first);
+    journal->append(*second);
+    journal->rewrite({second});
+  }
+
+  auto journal = makeJournal();
+  auto replayed = journal->takeReplayedBatches();
+  ASSERT_EQ(replayed.size(), 1);
+  EXPECT_EQ(replayed[0]->reducedHash(), second->reducedHash());
+}
+
+/**
+ * @given a journal whose last record is truncated, as happens after a
+ * crash mid-append
+ * @when the journal is reopened
+ * @then the complete records are replayed and appending still works
+ */
+TEST_F(BatchJournalTest, ToleratesTruncatedTail) {
+  auto first = makeBatch(1);
+  {
+    auto journal = makeJournal();
+    journal->append(*first);
+  }
+  {
+    // append an incomplete batch record
+    std::ofstream out(path, std::ios::binary | std::ios::app);
+    out.put('B');
+    out.put('\x02');
+  }
+
+  auto journal = makeJournal();
+  auto replayed = journal->takeReplayedBatches();
+  ASSERT_EQ(replayed.size(), 1);
+  EXPECT_EQ(replayed[0]->reducedHash(), first->reducedHash());
+}
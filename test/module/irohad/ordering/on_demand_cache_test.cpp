@@ -37,6 +37,34 @@ TEST(OnDemandCacheTest, TestAddToBack) {
   ASSERT_THAT(cache.tail(), UnorderedElementsAre(batch1, batch2));
 }
 
+/**
+ * @given cache with a batch
+ * @when a batch with the same reduced hash is added again, from the same or
+ * another delivery
+ * @then the duplicate is suppressed until the original is popped
+ */
+TEST(OnDemandCacheTest, TestDuplicateSuppression) {
+  OnDemandCache cache;
+
+  shared_model::interface::types::HashType hash1("hash1");
+  auto batch1 = createMockBatchWithHash(hash1);
+  // same content redelivered as a distinct object
+  auto batch1_copy = createMockBatchWithHash(hash1);
+
+  cache.addToBack({batch1});
+  cache.addToBack({batch1, batch1_copy});
+
+  ASSERT_THAT(cache.tail(), ElementsAre(batch1));
+
+  cache.pop();
+  cache.pop();
+  ASSERT_THAT(cache.pop(), ElementsAre(batch1));
+
+  // once popped, the batch may enter the cache again
+  cache.addToBack({batch1_copy});
+  ASSERT_THAT(cache.tail(), ElementsAre(batch1_copy));
+}
+
 /**
  * @given cache with batch1 in the head, batch2 in the middle and batch3 in the
  * tail
@@ -106,6 +106,83 @@ TEST_F(OnDemandOsClientGrpcTest, onBatches) {
             creator);
 }
 
+/**
+ * @given a batches request cache shared by the clients of one round
+ * @when the same collection is requested twice and then another one
+ * @then the serialized request is built once per collection
+ */
+TEST_F(OnDemandOsClientGrpcTest, BatchesRequestSerializedOnce) {
+  auto make_collection = [](const std::string &creator) {
+    protocol::Transaction tx;
+    tx.mutable_payload()->mutable_reduced_payload()->set_creator_account_id(
+        creator);
+    OdOsNotification::CollectionType collection;
+    collection.push_back(
+        std::make_unique<shared_model::interface::TransactionBatchImpl>(
+            shared_model::interface::types::SharedTxsCollectionType{
+                std::make_unique<shared_model::proto::Transaction>(tx)}));
+    return collection;
+  };
+
+  BatchesRequestCache cache;
+  auto first_collection = make_collection("first");
+  auto first_request = cache.get(first_collection);
+  ASSERT_EQ(first_request->transactions()
+                .Get(0)
+                .payload()
+                .reduced_payload()
+                .creator_account_id(),
+            "first");
+
+  // same collection, possibly another destination - the same message
+  ASSERT_EQ(cache.get(first_collection), first_request);
+
+  auto second_request = cache.get(make_collection("second"));
+  ASSERT_NE(second_request, first_request);
+  ASSERT_EQ(second_request->transactions()
+                .Get(0)
+                .payload()
+                .reduced_payload()
+                .creator_account_id(),
+            "second");
+}
+
+/**
+ * @given a batches request cache
+ * @when the wire form of a collection is requested
+ * @then the spliced bytes parse back into the message form of the request
+ */
+TEST_F(OnDemandOsClientGrpcTest, BatchesRequestWireFormRoundTrip) {
+  OdOsNotification::CollectionType collection;
+  for (auto creator : {"alice@test", "bob@test"}) {
+    protocol::Transaction tx;
+    tx.mutable_payload()->mutable_reduced_payload()->set_creator_account_id(
+        creator);
+    collection.push_back(
+        std::make_unique<shared_model::interface::TransactionBatchImpl>(
+            shared_model::interface::types::SharedTxsCollectionType{
+                std::make_unique<shared_model::proto::Transaction>(tx)}));
+  }
+
+  BatchesRequestCache cache;
+  auto request = cache.get(collection);
+  auto wire = cache.getWire(collection);
+  ASSERT_TRUE(wire);
+
+  // the buffer is reused for the same collection
+  ASSERT_EQ(cache.getWire(collection), wire);
+
+  std::vector<grpc::Slice> slices;
+  ASSERT_TRUE(wire->Dump(&slices).ok());
+  std::string bytes;
+  for (auto const &slice : slices) {
+    bytes.append(reinterpret_cast<const char *>(slice.begin()), slice.size());
+  }
+  proto::BatchesRequest parsed;
+  ASSERT_TRUE(parsed.ParseFromString(bytes));
+  ASSERT_EQ(parsed.SerializeAsString(), request->SerializeAsString());
+}
+
 /**
  * Separate action required because ClientContext is non-copyable
  */
@@ -12,7 +12,7 @@
 #include "framework/test_logger.hpp"
 #include "interfaces/iroha_internal/transaction_batch_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
-#include "module/irohad/ordering/mock_on_demand_os_notification.hpp"
+#include "module/irohad/ordering/ordering_mocks.hpp"
 #include "module/shared_model/interface/mock_transaction_batch_factory.hpp"
 #include "module/shared_model/validators/validators.hpp"
 
@@ -28,7 +28,7 @@ using ::testing::Return;
 
 struct OnDemandOsServerGrpcTest : public ::testing::Test {
   void SetUp() override {
-    notification = std::make_shared<MockOdOsNotification>();
+    notification = std::make_shared<MockOnDemandOrderingService>();
     std::unique_ptr<shared_model::validation::AbstractValidator<
         shared_model::interface::Transaction>>
         interface_transaction_validator =
@@ -55,7 +55,7 @@ struct OnDemandOsServerGrpcTest : public ::testing::Test {
                                                getTestLogger("OdOsServerGrpc"));
   }
 
-  std::shared_ptr<MockOdOsNotification> notification;
+  std::shared_ptr<MockOnDemandOrderingService> notification;
   std::shared_ptr<MockTransactionBatchFactory> batch_factory;
   std::shared_ptr<OnDemandOsServerGrpc> server;
   consensus::Round round{1, 2};
@@ -80,7 +80,7 @@ TEST_F(OnDemandOsServerGrpcTest, SendBatches) {
   EXPECT_CALL(
       *batch_factory,
       createTransactionBatch(
-          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+          A<shared_model::interface::types::SharedTxsCollectionType>()))
       .WillOnce(Invoke(
           [](const shared_model::interface::types::SharedTxsCollectionType
                  &cand)
@@ -106,6 +106,50 @@ TEST_F(OnDemandOsServerGrpcTest, SendBatches) {
             creator);
 }
 
+/**
+ * @given server
+ * @when a collection large enough for parallel deserialization is received
+ * @then all transactions are deserialized in the original order
+ */
+TEST_F(OnDemandOsServerGrpcTest, SendBatchesParallelDeserialization) {
+  constexpr size_t kTransactionsCount = 600;
+  OdOsNotification::CollectionType collection;
+
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<shared_model::interface::types::SharedTxsCollectionType>()))
+      .WillRepeatedly(Invoke(
+          [](const shared_model::interface::types::SharedTxsCollectionType
+                 &cand)
+              -> shared_model::interface::TransactionBatchFactory::
+                  FactoryResult<std::unique_ptr<
+                      shared_model::interface::TransactionBatch>> {
+                    return iroha::expected::makeValue<std::unique_ptr<
+                        shared_model::interface::TransactionBatch>>(
+                        std::make_unique<
+                            shared_model::interface::TransactionBatchImpl>(
+                            cand));
+                  }));
+  EXPECT_CALL(*notification, onBatches(_)).WillOnce(SaveArg0Move(&collection));
+
+  proto::BatchesRequest request;
+  for (size_t i = 0; i < kTransactionsCount; ++i) {
+    request.add_transactions()
+        ->mutable_payload()
+        ->mutable_reduced_payload()
+        ->set_creator_account_id("creator_" + std::to_string(i));
+  }
+
+  server->SendBatches(nullptr, &request, nullptr);
+
+  ASSERT_EQ(collection.size(), kTransactionsCount);
+  for (size_t i = 0; i < kTransactionsCount; ++i) {
+    ASSERT_EQ(collection.at(i)->transactions().at(0)->creatorAccountId(),
+              "creator_" + std::to_string(i));
+  }
+}
+
 /**
  * @given server
  * @when proposal is requested
@@ -141,6 +185,103 @@ TEST_F(OnDemandOsServerGrpcTest, RequestProposal) {
             creator);
 }
 
+/**
+ * @given server with a proposal whose batch is cached
+ * @when the proposal digest is requested
+ * @then the digest announces the batch hash instead of the payload
+ */
+TEST_F(OnDemandOsServerGrpcTest, RequestProposalDigest) {
+  auto creator = "test";
+  protocol::Transaction tx;
+  tx.mutable_payload()->mutable_reduced_payload()->set_creator_account_id(
+      creator);
+  auto batch = std::make_shared<shared_model::interface::TransactionBatchImpl>(
+      shared_model::interface::types::SharedTxsCollectionType{
+          std::make_shared<shared_model::proto::Transaction>(tx)});
+  OdOsNotification::BatchesSetType cached_batches{batch};
+
+  protocol::Proposal proposal;
+  proposal.set_created_time(12345);
+  *proposal.add_transactions() = tx;
+  std::shared_ptr<const shared_model::interface::Proposal> iproposal(
+      std::make_shared<const shared_model::proto::Proposal>(proposal));
+  EXPECT_CALL(*notification, onRequestProposal(round))
+      .WillOnce(Return(ByMove(std::move(iproposal))));
+  EXPECT_CALL(*notification, forCachedBatches(_))
+      .WillOnce(Invoke([&cached_batches](auto const &f) { f(cached_batches); }));
+
+  proto::ProposalRequest request;
+  request.mutable_round()->set_block_round(round.block_round);
+  request.mutable_round()->set_reject_round(round.reject_round);
+  proto::ProposalDigestResponse response;
+  server->RequestProposalDigest(nullptr, &request, &response);
+
+  ASSERT_TRUE(response.has_digest());
+  ASSERT_EQ(response.digest().created_time(), 12345);
+  ASSERT_EQ(response.digest().batch_hashes_size(), 1);
+  ASSERT_EQ(response.digest().batch_hashes(0), batch->reducedHash().hex());
+}
+
+/**
+ * @given server with a proposal whose batch is not cached any more
+ * @when the proposal digest is requested
+ * @then no digest is served, the peer falls back to the full proposal
+ */
+TEST_F(OnDemandOsServerGrpcTest, RequestProposalDigestNotCached) {
+  protocol::Proposal proposal;
+  proposal.add_transactions()
+      ->mutable_payload()
+      ->mutable_reduced_payload()
+      ->set_creator_account_id("test");
+  std::shared_ptr<const shared_model::interface::Proposal> iproposal(
+      std::make_shared<const shared_model::proto::Proposal>(proposal));
+  EXPECT_CALL(*notification, onRequestProposal(round))
+      .WillOnce(Return(ByMove(std::move(iproposal))));
+  EXPECT_CALL(*notification, forCachedBatches(_))
+      .WillOnce(Invoke([](auto const &f) {
+        OdOsNotification::BatchesSetType empty;
+        f(empty);
+      }));
+
+  proto::ProposalRequest request;
+  request.mutable_round()->set_block_round(round.block_round);
+  request.mutable_round()->set_reject_round(round.reject_round);
+  proto::ProposalDigestResponse response;
+  server->RequestProposalDigest(nullptr, &request, &response);
+
+  ASSERT_FALSE(response.has_digest());
+}
+
+/**
+ * @given server with a cached batch
+ * @when the batch is requested by its reduced hash
+ * @then its transactions are served
+ */
+TEST_F(OnDemandOsServerGrpcTest, RequestBatches) {
+  auto creator = "test";
+  protocol::Transaction tx;
+  tx.mutable_payload()->mutable_reduced_payload()->set_creator_account_id(
+      creator);
+  auto batch = std::make_shared<shared_model::interface::TransactionBatchImpl>(
+      shared_model::interface::types::SharedTxsCollectionType{
+          std::make_shared<shared_model::proto::Transaction>(tx)});
+  OdOsNotification::BatchesSetType cached_batches{batch};
+  EXPECT_CALL(*notification, forCachedBatches(_))
+      .WillOnce(Invoke([&cached_batches](auto const &f) { f(cached_batches); }));
+
+  proto::BatchesByHashRequest request;
+  request.add_reduced_hashes(batch->reducedHash().hex());
+  proto::BatchesRequest response;
+  server->RequestBatches(nullptr, &request, &response);
+
+  ASSERT_EQ(response.transactions_size(), 1);
+  ASSERT_EQ(response.transactions(0)
+                .payload()
+                .reduced_payload()
+                .creator_account_id(),
+            creator);
+}
+
 /**
  * @given server
  * @when proposal is requested
@@ -6,6 +6,7 @@
 #include "ordering/impl/on_demand_ordering_service_impl.hpp"
 
 #include <memory>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include "backend/protobuf/proto_proposal_factory.hpp"
@@ -167,6 +168,77 @@ TEST_F(OnDemandOsTest, OverflowRound) {
             (*os->onRequestProposal(target_round))->transactions().size());
 }
 
+/**
+ * @given initialized on-demand OS with a proposal byte limit fitting
+ *        three of six equally sized transactions
+ * @when  the transactions are sent
+ * AND initiate next round
+ * @then  the proposal contains only the transactions within the byte cap
+ */
+TEST_F(OnDemandOsTest, ByteLimitedRound) {
+  auto now = iroha::time::now();
+  auto probe = generateTransactions({1, 2}, now);
+  const auto tx_bytes = probe.front()->transactions().front()->blob().size();
+
+  auto factory = std::make_unique<
+      shared_model::proto::ProtoProposalFactory<MockProposalValidator>>(
+      iroha::test::kTestsValidatorsConfig);
+  auto tx_cache =
+      std::make_unique<NiceMock<iroha::ametsuchi::MockTxPresenceCache>>();
+  ON_CALL(
+      *tx_cache,
+      check(
+          testing::Matcher<const shared_model::interface::TransactionBatch &>(
+              _)))
+      .WillByDefault(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
+          iroha::ametsuchi::tx_cache_status_responses::Missing()}));
+  os = std::make_shared<OnDemandOrderingServiceImpl>(
+      transaction_limit,
+      std::move(factory),
+      std::move(tx_cache),
+      proposal_creation_strategy,
+      getTestLogger("OdOrderingService"),
+      proposal_limit,
+      nullptr,
+      3 * tx_bytes);
+
+  os->onBatches(generateTransactions({1, 7}, now));
+
+  os->onCollaborationOutcome(commit_round);
+
+  ASSERT_TRUE(os->onRequestProposal(target_round));
+  ASSERT_EQ(3u, (*os->onRequestProposal(target_round))->transactions().size());
+}
+
+/**
+ * @given initialized on-demand OS
+ * @when  several threads insert batches concurrently, landing on
+ *        different staging shards
+ * AND initiate next round
+ * @then  the proposal contains every inserted transaction
+ */
+TEST_F(OnDemandOsTest, ShardedStagingKeepsAllBatches) {
+  constexpr size_t kThreads = 4;
+  constexpr uint64_t kPerThread = 5;
+  auto now = iroha::time::now();
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([this, t, now] {
+      os->onBatches(generateTransactions(
+          {1 + t * kPerThread, 1 + (t + 1) * kPerThread}, now));
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(kThreads * kPerThread, (*proposal)->transactions().size());
+}
+
 /**
  * @given initialized on-demand OS
  * @when  insert commit round and then proposal_limit + 2 reject rounds
@@ -380,3 +452,42 @@ TEST_F(OnDemandOsTest, FailOnCreationStrategy) {
 
   ASSERT_TRUE(os->onRequestProposal(target_round));
 }
+
+/**
+ * @given initialized on-demand OS with single-transaction batches of two
+ *        hot accounts inserted grouped by account
+ * @when a proposal is packed
+ * @then all transactions are present and no two consecutive transactions
+ *       share a creator account
+ */
+TEST_F(OnDemandOsTest, ConflictGroupsSpreadInProposal) {
+  auto now = iroha::time::now();
+  OnDemandOrderingService::CollectionType collection;
+  for (size_t i = 0; i < 4; ++i) {
+    const char *creator = i < 2 ? "alice@conflict" : "bob@conflict";
+    collection.push_back(
+        std::make_unique<shared_model::interface::TransactionBatchImpl>(
+            shared_model::interface::types::SharedTxsCollectionType{
+                std::make_unique<shared_model::proto::Transaction>(
+                    shared_model::proto::TransactionBuilder()
+                        .createdTime(now + i)
+                        .creatorAccountId(creator)
+                        .createAsset("asset", "domain", 1)
+                        .quorum(1)
+                        .build()
+                        .signAndAddSignature(
+                            shared_model::crypto::DefaultCryptoAlgorithmType::
+                                generateKeypair())
+                        .finish())}));
+  }
+  os->onBatches(std::move(collection));
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  const auto &txs = (*proposal)->transactions();
+  ASSERT_EQ(4, boost::size(txs));
+  for (auto it = std::next(txs.begin()); it != txs.end(); ++it) {
+    EXPECT_NE(it->creatorAccountId(), std::prev(it)->creatorAccountId());
+  }
+}
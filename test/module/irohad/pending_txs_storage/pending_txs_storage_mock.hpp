@@ -7,6 +7,7 @@
 #define IROHA_PENDING_TXS_STORAGE_MOCK_HPP
 
 #include <gmock/gmock.h>
+#include <rxcpp/rx-lite.hpp>
 #include "pending_txs_storage/pending_txs_storage.hpp"
 
 namespace iroha {
@@ -25,6 +26,9 @@ namespace iroha {
                 page_size,
             const std::optional<shared_model::interface::types::HashType>
                 &first_tx_hash));
+    MOCK_CONST_METHOD0(
+        updates,
+        rxcpp::observable<shared_model::interface::types::AccountIdType>());
     MOCK_METHOD1(insertPresenceCache,
                  void(std::shared_ptr<ametsuchi::TxPresenceCache> &cache));
   };
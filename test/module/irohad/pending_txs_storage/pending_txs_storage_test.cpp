@@ -662,3 +662,45 @@ TEST_F(PendingTxsStorageFixture, QueryAllTheBatches) {
     checkResponse(second_page.assumeValue(), second_page_expected);
   }
 }
+
+/**
+ * Storage notifies about changes of accounts pending transactions
+ * @given a storage and a subscriber to its updates
+ * @when a batch is inserted and later expires
+ * @then the subscriber receives a notification per batch creator on both
+ * events
+ */
+TEST_F(PendingTxsStorageFixture, UpdatesNotification) {
+  auto state = emptyState();
+  auto transactions = twoTransactionsBatch();
+  *state += transactions;
+
+  rxcpp::subjects::subject<std::shared_ptr<iroha::MstState>> state_updates;
+  rxcpp::subjects::subject<std::shared_ptr<Batch>> expired_batches;
+
+  auto storage = iroha::PendingTransactionStorageImpl::create(
+      state_updates.get_observable(),
+      dummyObservable(),
+      expired_batches.get_observable(),
+      dummyPreparedTxsObservable(),
+      dummyFinalizedTxs());
+  auto pc = dummyPresenceCache();
+  storage->insertPresenceCache(pc);
+
+  std::vector<std::string> notified_accounts;
+  auto subscription =
+      storage->updates().subscribe([&notified_accounts](const auto &account) {
+        notified_accounts.push_back(account);
+      });
+
+  state_updates.get_subscriber().on_next(state);
+  // batchCreators are iterated in the sorted order
+  ASSERT_EQ(notified_accounts.size(), 2);
+  EXPECT_EQ(notified_accounts[0], "alice@iroha");
+  EXPECT_EQ(notified_accounts[1], "bob@iroha");
+
+  expired_batches.get_subscriber().on_next(transactions);
+  ASSERT_EQ(notified_accounts.size(), 4);
+
+  subscription.unsubscribe();
+}
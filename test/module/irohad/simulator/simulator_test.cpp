@@ -16,6 +16,7 @@
 #include "framework/crypto_literals.hpp"
 #include "framework/test_logger.hpp"
 #include "framework/test_subscriber.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 #include "module/irohad/ametsuchi/mock_command_executor.hpp"
 #include "module/irohad/ametsuchi/mock_temporary_factory.hpp"
 #include "module/irohad/network/network_mocks.hpp"
@@ -179,6 +180,54 @@ TEST_F(SimulatorTest, ValidWhenPreviousBlock) {
   EXPECT_TRUE(block_wrapper.validate());
 }
 
+
+/**
+ * @given simulator subscribed to ordering events
+ * @when a proposal arrives from the ordering gate
+ * @then the validated state is prepared only after the block has been emitted
+ * downstream, so that the database prepare overlaps consensus voting
+ */
+TEST_F(SimulatorTest, StatePreparedAfterBlockEmission) {
+  std::vector<shared_model::proto::Transaction> txs = {makeTx()};
+
+  auto validation_result =
+      std::make_unique<iroha::validation::VerifiedProposalAndErrors>();
+  validation_result->verified_proposal =
+      std::make_unique<shared_model::proto::Proposal>(
+          shared_model::proto::ProposalBuilder()
+              .height(2)
+              .createdTime(iroha::time::now())
+              .transactions(txs)
+              .build());
+  const auto &proposal = validation_result->verified_proposal;
+
+  EXPECT_CALL(*factory, createTemporaryWsv(_))
+      .WillOnce(Return(ByMove(std::make_unique<NiceMock<MockTemporaryWsv>>())));
+
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Invoke([&validation_result](const auto &p, auto &v) {
+        return std::move(validation_result);
+      }));
+
+  EXPECT_CALL(*crypto_signer, sign(A<shared_model::interface::Block &>()))
+      .Times(1);
+
+  bool block_emitted = false;
+  auto block_wrapper = make_test_subscriber<CallExact>(simulator->onBlock(), 1);
+  block_wrapper.subscribe([&](auto) { block_emitted = true; });
+
+  EXPECT_CALL(*factory, prepareBlock_(_)).WillOnce(Invoke([&](auto &) {
+    EXPECT_TRUE(block_emitted);
+  }));
+
+  auto ledger_state = std::make_shared<LedgerState>(
+      ledger_peers, proposal->height() - 1, shared_model::crypto::Hash{"hash"});
+  ordering_events.get_subscriber().on_next(
+      OrderingEvent{proposal, consensus::Round{}, ledger_state});
+
+  EXPECT_TRUE(block_wrapper.validate());
+}
+
 /**
  * Checks, that after failing a certain number of transactions in a proposal,
  * returned verified proposal will have only valid transactions
@@ -230,7 +279,7 @@ TEST_F(SimulatorTest, SomeFailingTxs) {
         return std::move(verified_proposal_and_errors);
       }));
 
-  auto verification_result = simulator->processProposal(*proposal);
+  auto verification_result = simulator->processProposal(proposal);
   ASSERT_TRUE(verification_result);
   auto verified_proposal = verification_result->verified_proposal;
 
@@ -324,6 +324,39 @@ TEST_F(SynchronizerTest, ValidWhenValidChainMultipleBlocks) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given a commit from consensus many blocks ahead of the local top block
+ * @when the blocks pass through the bounded prefetch buffer of the downloader
+ * @then they are validated and applied strictly in the original order
+ */
+TEST_F(SynchronizerTest, PrefetchedChainKeepsOrder) {
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(1);
+
+  // enough blocks to wrap the prefetch buffer several times
+  const size_t kConsensusHeight = kInitTopBlockHeight + 100;
+  std::vector<std::shared_ptr<shared_model::interface::Block>> chain;
+  for (auto height = kInitTopBlockHeight + 1; height <= kConsensusHeight;
+       ++height) {
+    chain.emplace_back(makeCommit(height));
+  }
+
+  EXPECT_CALL(*block_loader, retrieveBlocks(kInitTopBlockHeight, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(chain)));
+  EXPECT_CALL(*chain_validator, validateAndApply(ChainEq(chain), _))
+      .WillOnce(Return(true));
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe();
+
+  gate_outcome.get_subscriber().on_next(consensus::Future{
+      consensus::Round{kConsensusHeight + 1, 1}, ledger_state, public_keys});
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 /**
  * @given A commit from consensus and initialized components
  * @when gate have voted for other block
@@ -577,6 +610,96 @@ TEST_F(SynchronizerTest, AbruptInMiddleOfChainThenSuccessWithSamePeer) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+// keep in sync with kSyncStripeSize in synchronizer_impl.cpp
+static constexpr size_t kSyncStripeSize = 500;
+
+/**
+ * @given a commit from consensus more than a stripe size ahead of the local top
+ * block
+ * @when gate has voted for a block in the future
+ * @then the missing range is downloaded in stripes from several peers and
+ * committed as a single ordered chain
+ */
+TEST_F(SynchronizerTest, StripedDownloadReassemblesChainInOrder) {
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(1);
+
+  const size_t kConsensusHeight = kInitTopBlockHeight + kSyncStripeSize + 1;
+  std::vector<std::shared_ptr<shared_model::interface::Block>> chain;
+  for (auto height = kInitTopBlockHeight + 1; height <= kConsensusHeight;
+       ++height) {
+    chain.emplace_back(makeCommit(height));
+  }
+  std::vector<std::shared_ptr<shared_model::interface::Block>> first_stripe(
+      chain.begin(), chain.end() - 1);
+  std::vector<std::shared_ptr<shared_model::interface::Block>> second_stripe(
+      chain.end() - 1, chain.end());
+
+  EXPECT_CALL(*block_loader, retrieveBlocks(kInitTopBlockHeight, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(first_stripe)));
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(kInitTopBlockHeight + kSyncStripeSize, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(second_stripe)));
+  EXPECT_CALL(*chain_validator, validateAndApplyWindow(Eq(chain), _))
+      .WillOnce(Return(chain.size()));
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe();
+
+  gate_outcome.get_subscriber().on_next(consensus::Future{
+      consensus::Round{kConsensusHeight + 1, 1}, ledger_state, public_keys});
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given a commit from consensus more than a stripe size ahead of the local top
+ * block, and a peer that cannot provide its stripe
+ * @when gate has voted for a block in the future
+ * @then the contiguous prefix from the stripes is applied and the remainder is
+ * downloaded through the per-peer fallback
+ */
+TEST_F(SynchronizerTest, StripedDownloadFallsBackOnShortStripe) {
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(1);
+
+  const size_t kConsensusHeight = kInitTopBlockHeight + kSyncStripeSize + 1;
+  std::vector<std::shared_ptr<shared_model::interface::Block>> first_stripe;
+  for (auto height = kInitTopBlockHeight + 1;
+       height <= kInitTopBlockHeight + kSyncStripeSize;
+       ++height) {
+    first_stripe.emplace_back(makeCommit(height));
+  }
+  std::vector<std::shared_ptr<shared_model::interface::Block>> last_block{
+      makeCommit(kConsensusHeight)};
+
+  EXPECT_CALL(*block_loader, retrieveBlocks(kInitTopBlockHeight, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(first_stripe)));
+  // the second stripe owner has nothing, then the per-peer fallback asks the
+  // same range again and succeeds
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(kInitTopBlockHeight + kSyncStripeSize, _))
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Block>>()))
+      .WillOnce(Return(rxcpp::observable<>::iterate(last_block)));
+  EXPECT_CALL(*chain_validator, validateAndApplyWindow(Eq(first_stripe), _))
+      .WillOnce(Return(first_stripe.size()));
+  EXPECT_CALL(*chain_validator, validateAndApply(ChainEq(last_block), _))
+      .WillOnce(Return(true));
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe();
+
+  gate_outcome.get_subscriber().on_next(consensus::Future{
+      consensus::Round{kConsensusHeight + 1, 1}, ledger_state, public_keys});
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 /**
  * @given commit from the consensus and initialized components
  * @when synchronizer fails to download blocks from all the peers in the list
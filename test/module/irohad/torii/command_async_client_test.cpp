@@ -0,0 +1,66 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/command_async_client.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+  iroha::protocol::TxList makeList(size_t transactions) {
+    iroha::protocol::TxList tx_list;
+    for (size_t i = 0; i < transactions; ++i) {
+      tx_list.add_transactions()
+          ->mutable_payload()
+          ->mutable_reduced_payload()
+          ->set_creator_account_id(std::to_string(i));
+    }
+    return tx_list;
+  }
+}  // namespace
+
+/**
+ * @given a transaction list larger than the chunk size
+ * @when it is split for pipelined submission
+ * @then full chunks are followed by the remainder
+ *       @and the transaction order is preserved across the chunks
+ */
+TEST(CommandAsyncClientTest, SplitsListIntoOrderedChunks) {
+  auto chunks = torii::CommandAsyncClient::splitList(makeList(7), 3);
+
+  ASSERT_EQ(chunks.size(), 3);
+  EXPECT_EQ(chunks[0].transactions_size(), 3);
+  EXPECT_EQ(chunks[1].transactions_size(), 3);
+  EXPECT_EQ(chunks[2].transactions_size(), 1);
+
+  size_t index = 0;
+  for (const auto &chunk : chunks) {
+    for (const auto &transaction : chunk.transactions()) {
+      EXPECT_EQ(transaction.payload().reduced_payload().creator_account_id(),
+                std::to_string(index++));
+    }
+  }
+}
+
+/**
+ * @given a transaction list not exceeding the chunk size
+ * @when it is split for pipelined submission
+ * @then it goes out as a single call
+ */
+TEST(CommandAsyncClientTest, SmallListStaysOneChunk) {
+  auto chunks = torii::CommandAsyncClient::splitList(makeList(3), 3);
+  ASSERT_EQ(chunks.size(), 1);
+  EXPECT_EQ(chunks[0].transactions_size(), 3);
+}
+
+/**
+ * @given an empty transaction list and a degenerate chunk size
+ * @when they are split for pipelined submission
+ * @then no chunk is produced for the empty list
+ *       @and a zero chunk size degrades to one transaction per chunk
+ */
+TEST(CommandAsyncClientTest, DegenerateInputs) {
+  EXPECT_TRUE(torii::CommandAsyncClient::splitList(makeList(0), 3).empty());
+  EXPECT_EQ(torii::CommandAsyncClient::splitList(makeList(2), 0).size(), 2);
+}
@@ -51,6 +51,7 @@ class CommandServiceReplayTest : public ::testing::Test {
         tx_status_factory,
         cache,
         tx_presence_cache,
+        boost::none,
         log);
   }
 
@@ -106,7 +107,9 @@ TEST_F(CommandServiceReplayTest, ReplayWhenPendingAndRejectedTest) {
   auto batch = prepareBatch();
   auto hash = batch->transactions().front()->hash();
 
-  cache->addItem(hash, tx_status_factory->makeMstPending(hash));
+  cache->addItem(hash,
+                 iroha::torii::CommandServiceImpl::makeRecord(
+                     *tx_status_factory->makeMstPending(hash)));
 
   EXPECT_CALL(*tx_presence_cache, check(batchRef(*batch)))
       .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>(
@@ -127,7 +130,9 @@ TEST_F(CommandServiceReplayTest, ReplayWhenPendingAndMissingTest) {
   auto batch = prepareBatch();
   auto hash = batch->transactions().front()->hash();
 
-  cache->addItem(hash, tx_status_factory->makeMstPending(hash));
+  cache->addItem(hash,
+                 iroha::torii::CommandServiceImpl::makeRecord(
+                     *tx_status_factory->makeMstPending(hash)));
 
   EXPECT_CALL(*tx_presence_cache, check(batchRef(*batch)))
       .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>(
@@ -6,8 +6,10 @@
 #include "torii/impl/command_service_impl.hpp"
 
 #include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
 #include "backend/protobuf/proto_tx_status_factory.hpp"
 #include "cryptography/hash.hpp"
+#include "endpoint.pb.h"
 #include "framework/test_logger.hpp"
 #include "framework/test_subscriber.hpp"
 #include "module/irohad/ametsuchi/mock_block_query.hpp"
@@ -44,6 +46,7 @@ class CommandServiceTest : public Test {
         tx_status_factory_,
         cache_,
         tx_presence_cache_,
+        snapshot_path_,
         log_);
   }
 
@@ -54,6 +57,7 @@ class CommandServiceTest : public Test {
   std::shared_ptr<shared_model::interface::TxStatusFactory> tx_status_factory_;
   std::shared_ptr<iroha::ametsuchi::MockTxPresenceCache> tx_presence_cache_;
   logger::LoggerPtr log_;
+  boost::optional<std::string> snapshot_path_;
   std::shared_ptr<iroha::torii::CommandServiceImpl::CacheType> cache_;
   std::shared_ptr<iroha::torii::CommandService> command_service_;
 };
@@ -80,6 +84,10 @@ TEST_F(CommandServiceTest, getStatusStreamWithAbsentHash) {
   EXPECT_CALL(*status_bus_, statuses())
       .WillRepeatedly(Return(
           rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
+  EXPECT_CALL(*status_bus_,
+              statuses(Matcher<const shared_model::crypto::Hash &>(hash)))
+      .WillRepeatedly(Return(
+          rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
 
   initCommandService();
   auto wrapper = framework::test_subscriber::make_test_subscriber<
@@ -154,3 +162,96 @@ TEST_F(CommandServiceTest, RejectedTxStatus) {
   }) << "Wrong response. Expected: RejectedTxResponse, Received: "
      << response->toString();
 }
+
+/**
+ * @given initialized command service which observed a committed status of a
+ *        transaction
+ *        @and a response cache whose entries expire immediately
+ * @when  status of that transaction is queried
+ * @then  the committed status is served from the recently-finalized index
+ *        without touching the storage
+ */
+TEST_F(CommandServiceTest, RecentlyFinalizedStatusServedWithoutStorage) {
+  auto hash = shared_model::crypto::Hash("a");
+  rxcpp::subjects::subject<iroha::torii::StatusBus::Objects> statuses;
+  EXPECT_CALL(*status_bus_, statuses())
+      .WillRepeatedly(Return(statuses.get_observable()));
+  EXPECT_CALL(*storage_, getBlockQuery()).Times(0);
+
+  // instantly expiring entries force every lookup past the response cache
+  cache_ = std::make_shared<iroha::torii::CommandServiceImpl::CacheType>(
+      std::chrono::nanoseconds(-1));
+  initCommandService();
+
+  statuses.get_subscriber().on_next(tx_status_factory_->makeCommitted(hash));
+
+  auto response = command_service_->getStatus(hash);
+  ASSERT_NO_THROW({
+    boost::get<const shared_model::interface::CommittedTxResponse &>(
+        response->get());
+  }) << "Wrong response. Expected: CommittedTxResponse, Received: "
+     << response->toString();
+}
+
+/**
+ * @given initialized command service which observed a committed status of a
+ *        transaction
+ * @when  the transport response for that transaction is requested over the
+ *        fast path
+ * @then  the response is filled from the status cache in place
+ *        @and an unknown hash is refused to the slow path
+ */
+TEST_F(CommandServiceTest, FillStatusTransportFastPath) {
+  auto hash = shared_model::crypto::Hash("a");
+  rxcpp::subjects::subject<iroha::torii::StatusBus::Objects> statuses;
+  EXPECT_CALL(*status_bus_, statuses())
+      .WillRepeatedly(Return(statuses.get_observable()));
+  EXPECT_CALL(*storage_, getBlockQuery()).Times(0);
+  initCommandService();
+
+  statuses.get_subscriber().on_next(tx_status_factory_->makeCommitted(hash));
+
+  iroha::protocol::ToriiResponse response;
+  ASSERT_TRUE(command_service_->fillStatusTransport(hash, response));
+  ASSERT_EQ(response.tx_status(), iroha::protocol::TxStatus::COMMITTED);
+  ASSERT_EQ(response.tx_hash(), hash.hex());
+
+  ASSERT_FALSE(command_service_->fillStatusTransport(
+      shared_model::crypto::Hash("b"), response));
+}
+
+/**
+ * @given command service with a status cache snapshot path
+ *        @and a committed status observed from the status bus
+ * @when  the service is destroyed and a new one with an empty cache is
+ *        created over the same snapshot path
+ * @then  the committed status is served from the restored cache without
+ *        touching the storage
+ */
+TEST_F(CommandServiceTest, StatusCacheSnapshotRoundTrip) {
+  auto hash = shared_model::crypto::Hash("a");
+  rxcpp::subjects::subject<iroha::torii::StatusBus::Objects> statuses;
+  EXPECT_CALL(*status_bus_, statuses())
+      .WillRepeatedly(Return(statuses.get_observable()));
+  EXPECT_CALL(*storage_, getBlockQuery()).Times(0);
+
+  snapshot_path_ = (boost::filesystem::temp_directory_path()
+                    / boost::filesystem::unique_path())
+                       .string();
+  initCommandService();
+  statuses.get_subscriber().on_next(tx_status_factory_->makeCommitted(hash));
+  // destruction writes the snapshot
+  command_service_.reset();
+
+  cache_ = std::make_shared<iroha::torii::CommandServiceImpl::CacheType>();
+  initCommandService();
+
+  auto response = command_service_->getStatus(hash);
+  ASSERT_NO_THROW({
+    boost::get<const shared_model::interface::CommittedTxResponse &>(
+        response->get());
+  }) << "Wrong response. Expected: CommittedTxResponse, Received: "
+     << response->toString();
+
+  boost::filesystem::remove(*snapshot_path_);
+}
@@ -0,0 +1,158 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/query_service_async_transport_grpc.hpp"
+
+#include <gmock/gmock.h>
+
+#include "backend/protobuf/proto_query_response_factory.hpp"
+#include "backend/protobuf/proto_transport_factory.hpp"
+#include "builders/protobuf/queries.hpp"
+#include "framework/test_client_factory.hpp"
+#include "framework/test_logger.hpp"
+#include "main/server_runner.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/irohad/torii/processor/mock_query_processor.hpp"
+#include "module/shared_model/cryptography/crypto_defaults.hpp"
+#include "torii/query_client.hpp"
+#include "validators/protobuf/proto_query_validator.hpp"
+
+using ::testing::_;
+using ::testing::Invoke;
+
+using namespace iroha;
+using namespace iroha::torii;
+
+class QueryAsyncTransportTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    query_processor = std::make_shared<MockQueryProcessor>();
+    query = std::make_shared<shared_model::proto::Query>(
+        shared_model::proto::QueryBuilder()
+            .creatorAccountId("user@domain")
+            .createdTime(iroha::time::now())
+            .queryCounter(1)
+            .getAccount("user@domain")
+            .build()
+            .signAndAddSignature(
+                shared_model::crypto::DefaultCryptoAlgorithmType::
+                    generateKeypair())
+            .finish());
+
+    std::unique_ptr<shared_model::validation::AbstractValidator<
+        shared_model::interface::Query>>
+        query_validator = std::make_unique<
+            shared_model::validation::DefaultSignedQueryValidator>(
+            iroha::test::kTestsValidatorsConfig);
+    std::unique_ptr<
+        shared_model::validation::AbstractValidator<iroha::protocol::Query>>
+        proto_query_validator =
+            std::make_unique<shared_model::validation::ProtoQueryValidator>();
+    auto query_factory =
+        std::make_shared<shared_model::proto::ProtoTransportFactory<
+            shared_model::interface::Query,
+            shared_model::proto::Query>>(std::move(query_validator),
+                                         std::move(proto_query_validator));
+
+    auto blocks_query_validator = std::make_unique<
+        shared_model::validation::DefaultSignedBlocksQueryValidator>(
+        iroha::test::kTestsValidatorsConfig);
+    auto proto_blocks_query_validator =
+        std::make_unique<shared_model::validation::ProtoBlocksQueryValidator>();
+    auto blocks_query_factory =
+        std::make_shared<shared_model::proto::ProtoTransportFactory<
+            shared_model::interface::BlocksQuery,
+            shared_model::proto::BlocksQuery>>(
+            std::move(blocks_query_validator),
+            std::move(proto_blocks_query_validator));
+
+    query_service =
+        std::make_shared<QueryService>(query_processor,
+                                       query_factory,
+                                       blocks_query_factory,
+                                       commits.get_observable(),
+                                       getTestLogger("QueryService"));
+
+    task_scheduler = std::make_shared<TaskScheduler>(
+        1, getTestLogger("TaskScheduler"));
+
+    runner = std::make_unique<iroha::network::ServerRunner>(
+        ip + ":0", getTestLogger("ServerRunner"));
+    runner
+        ->appendAsync(std::make_shared<QueryServiceAsyncTransportGrpc>(
+            query_service,
+            task_scheduler,
+            getTestLogger("QueryServiceAsyncTransportGrpc")))
+        .run()
+        .match([this](auto port) { this->port = port.value; },
+               [](const auto &err) { FAIL() << err.error; });
+
+    stub_ = iroha::network::createInsecureClient<
+        ::torii_utils::QuerySyncClient::Service>(
+        ip, port, *iroha::network::getDefaultTestChannelParams());
+
+    runner->waitForServersReady();
+  }
+
+  std::unique_ptr<shared_model::interface::QueryResponse> getResponse() {
+    return shared_model::proto::ProtoQueryResponseFactory()
+        .createAccountResponse("a", "ru", 2, "", {"user"}, query->hash());
+  }
+
+  std::shared_ptr<shared_model::proto::Query> query;
+  std::shared_ptr<QueryService> query_service;
+  std::shared_ptr<MockQueryProcessor> query_processor;
+  std::shared_ptr<TaskScheduler> task_scheduler;
+  rxcpp::subjects::subject<std::shared_ptr<const shared_model::interface::Block>>
+      commits;
+
+  std::unique_ptr<iroha::network::ServerRunner> runner;
+  std::shared_ptr<::torii_utils::QuerySyncClient::Service::StubInterface> stub_;
+
+  const std::string ip = "127.0.0.1";
+  int port;
+};
+
+/**
+ * @given a torii server with the asynchronous query transport
+ * @when a client calls Find
+ * @then the query is executed on the shared worker pool
+ *       @and the raw-serialized response parses back to the expected one
+ */
+TEST_F(QueryAsyncTransportTest, FindOverCompletionQueue) {
+  EXPECT_CALL(*query_processor, queryHandle(_)).WillOnce(Invoke([this](auto &) {
+    return this->getResponse();
+  }));
+
+  iroha::protocol::QueryResponse response;
+  auto client = ::torii_utils::QuerySyncClient(stub_);
+  ASSERT_TRUE(client.Find(query->getTransport(), response).ok());
+
+  shared_model::proto::QueryResponse resp{
+      iroha::protocol::QueryResponse{response}};
+  ASSERT_EQ(resp, *getResponse());
+}
+
+/**
+ * @given a torii server with the asynchronous query transport
+ *        which has already served a query
+ * @when a client sends the very same query again
+ * @then the error response also arrives through the raw path
+ */
+TEST_F(QueryAsyncTransportTest, DuplicateQueryGetsErrorResponse) {
+  EXPECT_CALL(*query_processor, queryHandle(_)).WillOnce(Invoke([this](auto &) {
+    return this->getResponse();
+  }));
+
+  auto client = ::torii_utils::QuerySyncClient(stub_);
+  iroha::protocol::QueryResponse response;
+  ASSERT_TRUE(client.Find(query->getTransport(), response).ok());
+
+  iroha::protocol::QueryResponse duplicate_response;
+  ASSERT_TRUE(client.Find(query->getTransport(), duplicate_response).ok());
+  ASSERT_TRUE(duplicate_response.has_error_response());
+  ASSERT_EQ(duplicate_response.error_response().reason(),
+            iroha::protocol::ErrorResponse::STATELESS_INVALID);
+}
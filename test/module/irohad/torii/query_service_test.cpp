@@ -37,9 +37,7 @@ class QueryServiceTest : public ::testing::Test {
             .queryCounter(1)
             .getAccount("user@domain")
             .build()
-            .signAndAddSignature(
-                shared_model::crypto::DefaultCryptoAlgorithmType::
-                    generateKeypair())
+            .signAndAddSignature(keypair)
             .finish());
 
     std::unique_ptr<shared_model::validation::AbstractValidator<
@@ -75,6 +73,7 @@ class QueryServiceTest : public ::testing::Test {
         std::make_shared<QueryService>(query_processor,
                                        query_factory,
                                        blocks_query_factory,
+                                       commits.get_observable(),
                                        getTestLogger("QueryService"));
   }
 
@@ -83,11 +82,34 @@ class QueryServiceTest : public ::testing::Test {
         .createAccountResponse("a", "ru", 2, "", {"user"}, query->hash());
   }
 
+  /// same query body as the fixture one, but fresh meta, as a polling
+  /// client would resend it, signed with the given keypair
+  std::shared_ptr<shared_model::proto::Query> makeRepeatedQuery(
+      const shared_model::crypto::Keypair &kp) {
+    return std::make_shared<shared_model::proto::Query>(
+        shared_model::proto::QueryBuilder()
+            .creatorAccountId("user@domain")
+            .createdTime(iroha::time::now() + 1)
+            .queryCounter(2)
+            .getAccount("user@domain")
+            .build()
+            .signAndAddSignature(kp)
+            .finish());
+  }
+
+  std::shared_ptr<shared_model::proto::Query> makeRepeatedQuery() {
+    return makeRepeatedQuery(keypair);
+  }
+
+  shared_model::crypto::Keypair keypair =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
   std::shared_ptr<shared_model::proto::Query> query;
   std::shared_ptr<QueryService> query_service;
   std::shared_ptr<QueryService::QueryFactoryType> query_factory;
   std::shared_ptr<QueryService::BlocksQueryFactoryType> blocks_query_factory;
   std::shared_ptr<MockQueryProcessor> query_processor;
+  rxcpp::subjects::subject<std::shared_ptr<const shared_model::interface::Block>>
+      commits;
 };
 
 /**
@@ -138,3 +160,76 @@ TEST_F(QueryServiceTest, InvalidWhenDuplicateHash) {
           shared_model::interface::StatelessFailedErrorResponse>(),
       resp.get()));
 }
+
+/**
+ * @given query service which has already executed a query
+ * @when the same query body is sent again with fresh meta fields
+ * @then the response is served from the cache without the query processor
+ *       @and carries the hash of the repeated query
+ */
+TEST_F(QueryServiceTest, ServesRepeatedQueryFromResponseCache) {
+  EXPECT_CALL(*query_processor, queryHandle(_)).WillOnce(Invoke([this](auto &) {
+    return this->getResponse();
+  }));
+
+  init();
+
+  protocol::QueryResponse response;
+  query_service->Find(query->getTransport(), response);
+
+  auto repeated_query = makeRepeatedQuery();
+  protocol::QueryResponse repeated_response;
+  query_service->Find(repeated_query->getTransport(), repeated_response);
+
+  ASSERT_FALSE(repeated_response.has_error_response());
+  ASSERT_EQ(repeated_response.query_hash(), repeated_query->hash().hex());
+}
+
+/**
+ * @given query service which has already executed and cached a query
+ * @when the same query body is resent signed with a different keypair
+ * @then the cached response is not served and the query processor runs
+ *       the full validation path for the second request
+ */
+TEST_F(QueryServiceTest, CachedResponseNotServedToDifferentKey) {
+  EXPECT_CALL(*query_processor, queryHandle(_))
+      .Times(2)
+      .WillRepeatedly(Invoke([this](auto &) { return this->getResponse(); }));
+
+  init();
+
+  protocol::QueryResponse response;
+  query_service->Find(query->getTransport(), response);
+
+  // the signatory and permission checks live in the stateful path, so a
+  // requester with another key must never inherit the cached verdict
+  auto other_key_query = makeRepeatedQuery(
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair());
+  protocol::QueryResponse other_response;
+  query_service->Find(other_key_query->getTransport(), other_response);
+}
+
+/**
+ * @given query service which has already executed a query
+ * @when a block is committed and the same query body is sent again
+ * @then the cached response is discarded and the query processor is invoked
+ *       for the second time
+ */
+TEST_F(QueryServiceTest, CommitInvalidatesResponseCache) {
+  EXPECT_CALL(*query_processor, queryHandle(_))
+      .Times(2)
+      .WillRepeatedly(Invoke([this](auto &) { return this->getResponse(); }));
+
+  init();
+
+  protocol::QueryResponse response;
+  query_service->Find(query->getTransport(), response);
+
+  commits.get_subscriber().on_next(
+      std::shared_ptr<const shared_model::interface::Block>{});
+
+  auto repeated_query = makeRepeatedQuery();
+  protocol::QueryResponse repeated_response;
+  query_service->Find(repeated_query->getTransport(), repeated_response);
+  ASSERT_FALSE(repeated_response.has_error_response());
+}
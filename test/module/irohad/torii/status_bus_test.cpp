@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/status_bus_impl.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/proto_tx_status_factory.hpp"
+
+using namespace std::literals::chrono_literals;
+
+/**
+ * @given a status bus with a global subscriber and a subscriber to the
+ * statuses of one transaction
+ * @when statuses of two different transactions are published
+ * @then the global subscriber gets both and the per-transaction subscriber
+ * gets only the status of its transaction
+ */
+TEST(StatusBusTest, RoutesStatusesByHash) {
+  shared_model::crypto::Hash hash_a{std::string(32, 'a')};
+  shared_model::crypto::Hash hash_b{std::string(32, 'b')};
+  shared_model::proto::ProtoTxStatusFactory factory;
+
+  iroha::torii::StatusBusImpl bus;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<iroha::torii::StatusBus::Objects> routed;
+  size_t total_delivered = 0;
+
+  auto routed_subscription =
+      bus.statuses(hash_a).subscribe([&](const auto &resp) {
+        std::lock_guard<std::mutex> lock(mutex);
+        routed.push_back(resp);
+      });
+  auto global_subscription = bus.statuses().subscribe([&](const auto &) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++total_delivered;
+    }
+    cv.notify_one();
+  });
+
+  bus.publish(factory.makeNotReceived(hash_a));
+  bus.publish(factory.makeNotReceived(hash_b));
+
+  std::unique_lock<std::mutex> lock(mutex);
+  ASSERT_TRUE(cv.wait_for(lock, 5s, [&] { return total_delivered == 2; }));
+  // the route is fed before the global subject, so by now it is consistent
+  ASSERT_EQ(routed.size(), 1);
+  EXPECT_EQ(routed.front()->transactionHash(), hash_a);
+
+  routed_subscription.unsubscribe();
+  global_subscription.unsubscribe();
+}
+
+/**
+ * @given a status bus with a global subscriber
+ * @when a group of statuses is published as one batch
+ * @then every status of the batch is delivered
+ */
+TEST(StatusBusTest, DeliversBatchPublication) {
+  shared_model::proto::ProtoTxStatusFactory factory;
+
+  iroha::torii::StatusBusImpl bus;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t total_delivered = 0;
+
+  auto subscription = bus.statuses().subscribe([&](const auto &) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++total_delivered;
+    }
+    cv.notify_one();
+  });
+
+  constexpr size_t kStatuses = 100;
+  std::vector<iroha::torii::StatusBus::Objects> statuses;
+  statuses.reserve(kStatuses);
+  for (size_t i = 0; i < kStatuses; ++i) {
+    statuses.push_back(factory.makeNotReceived(shared_model::crypto::Hash{
+        std::string(32, static_cast<char>('a' + (i % 26)))}));
+  }
+  bus.publish(statuses);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  ASSERT_TRUE(
+      cv.wait_for(lock, 5s, [&] { return total_delivered == kStatuses; }));
+
+  subscription.unsubscribe();
+}
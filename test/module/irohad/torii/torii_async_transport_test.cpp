@@ -0,0 +1,141 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/command_service_async_transport_grpc.hpp"
+
+#include <gmock/gmock.h>
+
+#include "backend/protobuf/proto_transport_factory.hpp"
+#include "backend/protobuf/proto_tx_status_factory.hpp"
+#include "endpoint.pb.h"
+#include "framework/test_client_factory.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "main/server_runner.hpp"
+#include "module/irohad/torii/torii_mocks.hpp"
+#include "module/shared_model/interface/mock_transaction_batch_factory.hpp"
+#include "module/shared_model/validators/validators.hpp"
+#include "torii/command_client.hpp"
+
+using ::testing::_;
+using ::testing::Return;
+
+using namespace iroha::torii;
+
+class ToriiAsyncTransportTest : public ::testing::Test {
+ public:
+  using ProtoTxTransportFactory = shared_model::proto::ProtoTransportFactory<
+      shared_model::interface::Transaction,
+      shared_model::proto::Transaction>;
+  using MockTxValidator = shared_model::validation::MockValidator<
+      shared_model::interface::Transaction>;
+  using MockProtoTxValidator =
+      shared_model::validation::MockValidator<iroha::protocol::Transaction>;
+
+  void SetUp() override {
+    status_factory =
+        std::make_shared<shared_model::proto::ProtoTxStatusFactory>();
+    status_bus = std::make_shared<MockStatusBus>();
+    command_service = std::make_shared<MockCommandService>();
+
+    auto transport_grpc = std::make_shared<CommandServiceTransportGrpc>(
+        command_service,
+        status_bus,
+        status_factory,
+        std::make_shared<ProtoTxTransportFactory>(
+            std::make_unique<MockTxValidator>(),
+            std::make_unique<MockProtoTxValidator>()),
+        std::make_shared<
+            shared_model::interface::TransactionBatchParserImpl>(),
+        std::make_shared<MockTransactionBatchFactory>(),
+        rxcpp::observable<>::iterate(gate_objects),
+        gate_objects.size(),
+        getTestLogger("CommandServiceTransportGrpc"));
+
+    runner = std::make_unique<iroha::network::ServerRunner>(
+        ip + ":0", getTestLogger("ServerRunner"));
+    runner
+        ->appendAsync(std::make_shared<CommandServiceAsyncTransportGrpc>(
+            transport_grpc,
+            command_service,
+            rxcpp::observable<>::iterate(gate_objects),
+            gate_objects.size(),
+            getTestLogger("CommandServiceAsyncTransportGrpc")))
+        .run()
+        .match([this](auto port) { this->port = port.value; },
+               [](const auto &err) { FAIL() << err.error; });
+
+    stub_ = iroha::network::createInsecureClient<
+        ::torii::CommandSyncClient::Service>(
+        ip, port, *iroha::network::getDefaultTestChannelParams());
+
+    runner->waitForServersReady();
+  }
+
+  std::shared_ptr<shared_model::interface::TxStatusFactory> status_factory;
+  std::shared_ptr<MockStatusBus> status_bus;
+  std::shared_ptr<MockCommandService> command_service;
+
+  std::vector<iroha::torii::CommandServiceTransportGrpc::ConsensusGateEvent>
+      gate_objects{2};
+
+  std::unique_ptr<iroha::network::ServerRunner> runner;
+  std::shared_ptr<::torii::CommandSyncClient::Service::StubInterface> stub_;
+
+  const std::string ip = "127.0.0.1";
+  int port;
+};
+
+/**
+ * @given a torii server with the asynchronous transport
+ *        and a status stream with one NotReceived status
+ * @when a client calls StatusStream
+ * @then the status is delivered over the completion queue
+ *       and the stream completes cleanly
+ */
+TEST_F(ToriiAsyncTransportTest, StatusStreamOverCompletionQueue) {
+  std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+      responses;
+  shared_model::crypto::Hash hash("1");
+  responses.emplace_back(status_factory->makeNotReceived(hash, {}));
+  EXPECT_CALL(*command_service, getStatusStream(_))
+      .WillOnce(Return(rxcpp::observable<>::iterate(responses)));
+
+  iroha::protocol::TxStatusRequest request;
+  request.set_tx_hash(hash.hex());
+
+  auto client = ::torii::CommandSyncClient(
+      stub_, getTestLogger("CommandSyncClient"));
+  std::vector<iroha::protocol::ToriiResponse> received;
+  client.StatusStream(request, received);
+
+  ASSERT_EQ(received.size(), 1);
+  ASSERT_EQ(received.at(0).tx_hash(), hash.hex());
+  ASSERT_EQ(received.at(0).tx_status(),
+            iroha::protocol::TxStatus::NOT_RECEIVED);
+}
+
+/**
+ * @given a torii server with the asynchronous transport
+ * @when a client calls the unary Status
+ * @then the call is delegated to the synchronous transport
+ */
+TEST_F(ToriiAsyncTransportTest, StatusDelegatedToSyncTransport) {
+  shared_model::crypto::Hash hash(std::string(32, '1'));
+  std::shared_ptr<shared_model::interface::TransactionResponse> response =
+      status_factory->makeEnoughSignaturesCollected(hash, {});
+  EXPECT_CALL(*command_service, getStatus(hash)).WillOnce(Return(response));
+
+  iroha::protocol::TxStatusRequest request;
+  request.set_tx_hash(hash.hex());
+
+  auto client = ::torii::CommandSyncClient(
+      stub_, getTestLogger("CommandSyncClient"));
+  iroha::protocol::ToriiResponse torii_response;
+  ASSERT_TRUE(client.Status(request, torii_response).ok());
+  ASSERT_EQ(torii_response.tx_status(),
+            iroha::protocol::TxStatus::ENOUGH_SIGNATURES_COLLECTED);
+}
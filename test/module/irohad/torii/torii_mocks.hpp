@@ -25,6 +25,9 @@ namespace iroha {
      public:
       MOCK_METHOD1(publish, void(StatusBus::Objects));
       MOCK_METHOD0(statuses, rxcpp::observable<StatusBus::Objects>());
+      MOCK_METHOD1(statuses,
+                   rxcpp::observable<StatusBus::Objects>(
+                       const shared_model::interface::types::HashType &));
     };
 
     class MockCommandService : public iroha::torii::CommandService {
@@ -41,6 +44,9 @@ namespace iroha {
           rxcpp::observable<
               std::shared_ptr<shared_model::interface::TransactionResponse>>(
               const shared_model::crypto::Hash &));
+      MOCK_METHOD2(fillStatusTransport,
+                   bool(const shared_model::crypto::Hash &,
+                        iroha::protocol::ToriiResponse &));
     };
 
     class MockTransactionProcessor : public TransactionProcessor {
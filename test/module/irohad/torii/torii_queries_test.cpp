@@ -88,10 +88,13 @@ class ToriiQueriesTest : public testing::Test {
     //----------- Server run ----------------
     initQueryFactory();
     runner
-        ->append(std::make_unique<QueryService>(qpi,
-                                                query_factory,
-                                                blocks_query_factory,
-                                                getTestLogger("QueryService")))
+        ->append(std::make_unique<QueryService>(
+            qpi,
+            query_factory,
+            blocks_query_factory,
+            rxcpp::observable<>::empty<
+                std::shared_ptr<const shared_model::interface::Block>>(),
+            getTestLogger("QueryService")))
         .run()
         .match([this](auto port) { this->port = port.value; },
                [](const auto &err) { FAIL() << err.error; });
@@ -46,6 +46,8 @@ class ToriiQueryServiceTest : public ::testing::Test {
             query_processor,
             query_factory,
             blocks_query_factory,
+            rxcpp::observable<>::empty<
+                std::shared_ptr<const shared_model::interface::Block>>(),
             getTestLogger("QueryService")))
         .run()
         .match([this](auto port) { this->port = port.value; },
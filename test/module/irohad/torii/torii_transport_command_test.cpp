@@ -14,6 +14,7 @@
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "backend/protobuf/proto_tx_status_factory.hpp"
 #include "backend/protobuf/transaction.hpp"
+#include "common/memory_budget.hpp"
 #include "endpoint.pb.h"
 #include "endpoint_mock.grpc.pb.h"
 #include "framework/test_logger.hpp"
@@ -114,6 +115,16 @@ class CommandServiceTransportGrpcTest : public testing::Test {
 
   const size_t kHashLength = 32;
   const size_t kTimes = 5;
+
+  /// transactions equal byte for byte are treated as retransmissions, so
+  /// the tests submitting several transactions have to distinguish them
+  static void addDistinctTransaction(iroha::protocol::TxList &request,
+                                     size_t index) {
+    request.add_transactions()
+        ->mutable_payload()
+        ->mutable_reduced_payload()
+        ->set_created_time(index + 1);
+  }
 };
 
 /**
@@ -132,6 +143,8 @@ TEST_F(CommandServiceTransportGrpcTest, Status) {
   std::shared_ptr<shared_model::interface::TransactionResponse> response =
       status_factory->makeEnoughSignaturesCollected(hash, {});
 
+  EXPECT_CALL(*command_service, fillStatusTransport(hash, _))
+      .WillOnce(Return(false));
   EXPECT_CALL(*command_service, getStatus(hash)).WillOnce(Return(response));
 
   transport_grpc->Status(&context, &tx_request, &toriiResponse);
@@ -140,6 +153,32 @@ TEST_F(CommandServiceTransportGrpcTest, Status) {
             iroha::protocol::TxStatus::ENOUGH_SIGNATURES_COLLECTED);
 }
 
+/**
+ * @given torii service whose command service has a cached status
+ * @when transaction status for the cached hash is requested
+ * @then the response is filled on the fast path in place
+ *       and no shared_model response object is constructed
+ */
+TEST_F(CommandServiceTransportGrpcTest, StatusFastPath) {
+  grpc::ServerContext context;
+
+  iroha::protocol::TxStatusRequest tx_request;
+  const shared_model::crypto::Hash hash(std::string(kHashLength, '1'));
+  tx_request.set_tx_hash(hash.hex());
+
+  iroha::protocol::ToriiResponse toriiResponse;
+  EXPECT_CALL(*command_service, fillStatusTransport(hash, _))
+      .WillOnce(Invoke([](const auto &, auto &response) {
+        response.set_tx_status(iroha::protocol::TxStatus::COMMITTED);
+        return true;
+      }));
+  EXPECT_CALL(*command_service, getStatus(_)).Times(0);
+
+  transport_grpc->Status(&context, &tx_request, &toriiResponse);
+
+  ASSERT_EQ(toriiResponse.tx_status(), iroha::protocol::TxStatus::COMMITTED);
+}
+
 /**
  * @given torii service and number of transactions
  * @when calling ListTorii
@@ -151,7 +190,7 @@ TEST_F(CommandServiceTransportGrpcTest, ListTorii) {
 
   iroha::protocol::TxList request;
   for (size_t i = 0; i < kTimes; ++i) {
-    request.add_transactions();
+    addDistinctTransaction(request, i);
   }
 
   EXPECT_CALL(*proto_tx_validator, validate(_))
@@ -163,7 +202,7 @@ TEST_F(CommandServiceTransportGrpcTest, ListTorii) {
   EXPECT_CALL(
       *batch_factory,
       createTransactionBatch(
-          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+          A<shared_model::interface::types::SharedTxsCollectionType>()))
       .Times(kTimes);
 
   EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(kTimes);
@@ -182,7 +221,7 @@ TEST_F(CommandServiceTransportGrpcTest, ListToriiInvalid) {
 
   iroha::protocol::TxList request;
   for (size_t i = 0; i < kTimes; ++i) {
-    request.add_transactions();
+    addDistinctTransaction(request, i);
   }
 
   shared_model::validation::ValidationError error{"some error", {}};
@@ -213,7 +252,7 @@ TEST_F(CommandServiceTransportGrpcTest, ListToriiPartialInvalid) {
 
   iroha::protocol::TxList request{};
   for (size_t i = 0; i < kTimes; ++i) {
-    request.add_transactions();
+    addDistinctTransaction(request, i);
   }
 
   size_t counter = 0;
@@ -233,7 +272,7 @@ TEST_F(CommandServiceTransportGrpcTest, ListToriiPartialInvalid) {
   EXPECT_CALL(
       *batch_factory,
       createTransactionBatch(
-          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+          A<shared_model::interface::types::SharedTxsCollectionType>()))
       .Times(0);
 
   EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(0);
@@ -247,6 +286,129 @@ TEST_F(CommandServiceTransportGrpcTest, ListToriiPartialInvalid) {
   transport_grpc->ListTorii(&context, &request, &response);
 }
 
+/**
+ * @given torii service and an exhausted memory budget
+ * @when calling ListTorii
+ * @then the batch is shed with a backpressure grpc status
+ *       and a retryable transaction status carrying a retry-after hint
+ *       and nothing reaches the command service
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiShedsOverBudget) {
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+
+  iroha::protocol::TxList request;
+  addDistinctTransaction(request, 0);
+
+  auto &budget = iroha::MemoryBudget::instance();
+  budget.setLimit(1);
+  budget.charge(2);
+
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(0);
+  EXPECT_CALL(*status_bus, publish(_)).WillOnce(Invoke([](auto status) {
+    EXPECT_GT(status->errorCode(), 0u);
+  }));
+
+  auto status = transport_grpc->ListTorii(&context, &request, &response);
+  EXPECT_EQ(status.error_code(), grpc::StatusCode::RESOURCE_EXHAUSTED);
+
+  budget.release(2);
+  budget.setLimit(0);
+}
+
+/**
+ * @given torii service and a list of valid transactions
+ * @when calling ListTorii
+ * @then an acknowledgement with an ingress queue position is published
+ *       for every accepted transaction
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiPublishesQueuePosition) {
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+
+  iroha::protocol::TxList request;
+  for (size_t i = 0; i < kTimes; ++i) {
+    addDistinctTransaction(request, i);
+  }
+
+  EXPECT_CALL(*proto_tx_validator, validate(_))
+      .Times(kTimes)
+      .WillRepeatedly(Return(std::nullopt));
+  EXPECT_CALL(*tx_validator, validate(_))
+      .Times(kTimes)
+      .WillRepeatedly(Return(std::nullopt));
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<shared_model::interface::types::SharedTxsCollectionType>()))
+      .Times(kTimes);
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(kTimes);
+  EXPECT_CALL(*status_bus, publish(_))
+      .Times(kTimes)
+      .WillRepeatedly(Invoke([](auto status) {
+        EXPECT_THAT(status->statelessErrorOrCommandName(),
+                    testing::HasSubstr("queued at ingress position"));
+      }));
+
+  ASSERT_TRUE(transport_grpc->ListTorii(&context, &request, &response).ok());
+}
+
+/**
+ * @given torii service which has already accepted a transaction
+ * @when the very same serialized transaction is submitted again
+ * @then the retransmission is dropped before deserialization
+ *       and only the first copy reaches the command service
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiDropsRetransmission) {
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+
+  iroha::protocol::TxList request;
+  addDistinctTransaction(request, 0);
+
+  EXPECT_CALL(*proto_tx_validator, validate(_)).WillOnce(Return(std::nullopt));
+  EXPECT_CALL(*tx_validator, validate(_)).WillOnce(Return(std::nullopt));
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<shared_model::interface::types::SharedTxsCollectionType>()))
+      .Times(1);
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(1);
+
+  ASSERT_TRUE(transport_grpc->ListTorii(&context, &request, &response).ok());
+  ASSERT_TRUE(transport_grpc->ListTorii(&context, &request, &response).ok());
+}
+
+/**
+ * @given torii service which has already accepted a transaction
+ * @when the same transaction is submitted again with one more signature
+ * @then the new copy is not treated as a retransmission
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiKeepsNewSignatures) {
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+
+  iroha::protocol::TxList request;
+  addDistinctTransaction(request, 0);
+
+  EXPECT_CALL(*proto_tx_validator, validate(_))
+      .Times(2)
+      .WillRepeatedly(Return(std::nullopt));
+  EXPECT_CALL(*tx_validator, validate(_))
+      .Times(2)
+      .WillRepeatedly(Return(std::nullopt));
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<shared_model::interface::types::SharedTxsCollectionType>()))
+      .Times(2);
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(2);
+
+  ASSERT_TRUE(transport_grpc->ListTorii(&context, &request, &response).ok());
+  request.mutable_transactions(0)->add_signatures()->set_public_key("key");
+  ASSERT_TRUE(transport_grpc->ListTorii(&context, &request, &response).ok());
+}
+
 /**
  * @given torii service and command_service with empty status stream
  * @when calling StatusStream on transport
@@ -264,6 +426,67 @@ TEST_F(CommandServiceTransportGrpcTest, StatusStreamEmpty) {
   ASSERT_TRUE(transport_grpc->StatusStream(&context, &request, nullptr).ok());
 }
 
+/**
+ * @given torii service and an empty transaction list
+ * @when calling ListToriiStream
+ * @then Ok status is eventually returned without any fault
+ *       and nothing is written to the status stream
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiStreamEmpty) {
+  grpc::ServerContext context;
+  iroha::protocol::TxList request;
+
+  EXPECT_CALL(*command_service, getStatusStream(_)).Times(0);
+
+  ASSERT_TRUE(
+      transport_grpc->ListToriiStream(&context, &request, nullptr).ok());
+}
+
+/**
+ * @given torii service and a list with one transaction
+ * @when calling ListToriiStream
+ * @then the transaction is handed to the command service
+ *       and its status is written to the stream
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiStreamWritesStatuses) {
+  grpc::ServerContext context;
+  iroha::MockServerWriter<iroha::protocol::ToriiResponse> response_writer;
+
+  iroha::protocol::TxList request;
+  request.add_transactions();
+
+  EXPECT_CALL(*proto_tx_validator, validate(_))
+      .WillOnce(Return(std::nullopt));
+  EXPECT_CALL(*tx_validator, validate(_)).WillOnce(Return(std::nullopt));
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<shared_model::interface::types::SharedTxsCollectionType>()))
+      .Times(1);
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(1);
+
+  std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+      responses;
+  shared_model::crypto::Hash hash("1");
+  responses.emplace_back(status_factory->makeNotReceived(hash, {}));
+  EXPECT_CALL(*command_service, getStatusStream(_))
+      .WillOnce(Return(rxcpp::observable<>::iterate(responses)));
+  EXPECT_CALL(response_writer,
+              Write(Property(&iroha::protocol::ToriiResponse::tx_hash,
+                             StrEq(hash.hex())),
+                    _))
+      .WillOnce(Return(true));
+
+  ASSERT_TRUE(transport_grpc
+                  ->ListToriiStream(
+                      &context,
+                      &request,
+                      reinterpret_cast<
+                          grpc::ServerWriter<iroha::protocol::ToriiResponse> *>(
+                          &response_writer))
+                  .ok());
+}
+
 /**
  * @given torii service with changed timeout, a transaction
  *        and a status stream with one NotRecieved status
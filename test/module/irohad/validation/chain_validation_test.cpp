@@ -132,3 +132,93 @@ TEST_F(ChainValidationTest, FailWhenNoSupermajority) {
   ASSERT_FALSE(validator->validateAndApply(blocks, *storage));
   ASSERT_EQ(boost::size(block->signatures()), block_signatures_amount);
 }
+
+/**
+ * @given a window of two correctly linked blocks signed by peers
+ * @when the window is validated and applied in bulk
+ * @then linkage and supermajority are verified up front and both blocks are
+ * applied
+ */
+TEST_F(ChainValidationTest, ValidWindow) {
+  shared_model::crypto::Hash first_hash("hash");
+  auto second_block = std::make_shared<MockBlock>();
+  EXPECT_CALL(*second_block, height()).WillRepeatedly(Return(height + 1));
+  EXPECT_CALL(*second_block, prevHash())
+      .WillRepeatedly(testing::ReturnRef(first_hash));
+  EXPECT_CALL(*second_block, hash())
+      .WillRepeatedly(
+          testing::ReturnRefOfCopy(shared_model::crypto::Hash("hash2")));
+  EXPECT_CALL(*second_block, signatures())
+      .WillRepeatedly(Return(signatures | boost::adaptors::indirected));
+  EXPECT_CALL(*block, transactions())
+      .WillRepeatedly(
+          Return<shared_model::interface::types::TransactionsCollectionType>(
+              {}));
+  EXPECT_CALL(*second_block, transactions())
+      .WillRepeatedly(
+          Return<shared_model::interface::types::TransactionsCollectionType>(
+              {}));
+  EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _))
+      .WillRepeatedly(Return(true));
+
+  std::vector<std::shared_ptr<shared_model::interface::Block>> window{
+      block, second_block};
+
+  EXPECT_CALL(*storage, apply(_, _))
+      .WillOnce(testing::Invoke([&](auto window_blocks, auto predicate) {
+        auto top_height = prev_height;
+        auto top_hash = prev_hash;
+        bool all = true;
+        window_blocks.as_blocking().subscribe(
+            [&](std::shared_ptr<shared_model::interface::Block> b) {
+              if (all
+                  and predicate(b, LedgerState{peers, top_height, top_hash})) {
+                top_height = b->height();
+                top_hash = b->hash();
+              } else {
+                all = false;
+              }
+            });
+        return all;
+      }));
+
+  ASSERT_EQ(2, validator->validateAndApplyWindow(window, *storage));
+}
+
+/**
+ * @given a window whose second block does not link to the first one
+ * @when the window is validated and applied in bulk
+ * @then only the verified prefix of one block is applied
+ */
+TEST_F(ChainValidationTest, WindowTruncatedAtBrokenLinkage) {
+  shared_model::crypto::Hash another_hash(std::string(32, '1'));
+  auto second_block = std::make_shared<MockBlock>();
+  EXPECT_CALL(*second_block, height()).WillRepeatedly(Return(height + 1));
+  EXPECT_CALL(*second_block, prevHash())
+      .WillRepeatedly(testing::ReturnRef(another_hash));
+  EXPECT_CALL(*block, transactions())
+      .WillRepeatedly(
+          Return<shared_model::interface::types::TransactionsCollectionType>(
+              {}));
+  EXPECT_CALL(*supermajority_checker, hasSupermajority(_, _))
+      .WillRepeatedly(Return(true));
+
+  std::vector<std::shared_ptr<shared_model::interface::Block>> window{
+      block, second_block};
+
+  EXPECT_CALL(*storage, apply(_, _))
+      .WillOnce(testing::Invoke([&](auto window_blocks, auto predicate) {
+        bool all = true;
+        size_t count = 0;
+        window_blocks.as_blocking().subscribe(
+            [&](std::shared_ptr<shared_model::interface::Block> b) {
+              all = all
+                  and predicate(b, LedgerState{peers, prev_height, prev_hash});
+              ++count;
+            });
+        EXPECT_EQ(1, count);
+        return all;
+      }));
+
+  ASSERT_EQ(1, validator->validateAndApplyWindow(window, *storage));
+}
@@ -15,10 +15,11 @@ namespace iroha {
 
     class MockStatefulValidator : public StatefulValidator {
      public:
-      MOCK_METHOD2(validate,
-                   std::unique_ptr<VerifiedProposalAndErrors>(
-                       const shared_model::interface::Proposal &,
-                       ametsuchi::TemporaryWsv &));
+      MOCK_METHOD2(
+          validate,
+          std::unique_ptr<VerifiedProposalAndErrors>(
+              std::shared_ptr<const shared_model::interface::Proposal>,
+              ametsuchi::TemporaryWsv &));
     };
 
   }  // namespace validation
@@ -6,14 +6,13 @@
 #include "validation/impl/stateful_validator_impl.hpp"
 
 #include <gtest/gtest.h>
-#include "backend/protobuf/proto_proposal_factory.hpp"
+#include "backend/protobuf/proposal.hpp"
 #include "common/result.hpp"
 #include "framework/test_logger.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "interfaces/transaction.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
-#include "module/irohad/common/validators_config.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 #include "module/shared_model/cryptography/crypto_defaults.hpp"
@@ -28,6 +27,7 @@ using ::testing::A;
 using ::testing::ByMove;
 using ::testing::ByRef;
 using ::testing::Eq;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::ReturnArg;
 
@@ -111,15 +111,10 @@ TEST_F(SignaturesSubset, PublickeyUniqueness) {
 class Validator : public testing::Test {
  public:
   void SetUp() override {
-    factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
-        shared_model::validation::DefaultProposalValidator>>(
-        iroha::test::kTestsValidatorsConfig);
     parser =
         std::make_shared<shared_model::interface::TransactionBatchParserImpl>();
     sfv = std::make_shared<StatefulValidatorImpl>(
-        std::move(factory),
-        std::move(parser),
-        getTestLogger("StatefulValidator"));
+        std::move(parser), getTestLogger("StatefulValidator"));
     temp_wsv_mock = std::make_shared<iroha::ametsuchi::MockTemporaryWsv>();
   }
 
@@ -151,8 +146,14 @@ class Validator : public testing::Test {
     return txs;
   }
 
+  auto allSignaturesValid() {
+    return Invoke([](const auto &txs) {
+      return std::vector<iroha::expected::Result<void, CommandError>>(
+          txs.size(), iroha::expected::Value<void>{});
+    });
+  }
+
   std::shared_ptr<StatefulValidator> sfv;
-  std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory;
   std::shared_ptr<iroha::ametsuchi::MockTemporaryWsv> temp_wsv_mock;
   std::shared_ptr<shared_model::interface::TransactionBatchParser> parser;
 
@@ -185,13 +186,18 @@ TEST_F(Validator, AllTxsValid) {
                     .quorum(1)
                     .createAsset("doge", "coin", 1)
                     .build());
-  auto proposal = TestProposalBuilder()
-                      .createdTime(iroha::time::now())
-                      .height(3)
-                      .transactions(txs)
-                      .build();
+  auto proposal = std::make_shared<shared_model::proto::Proposal>(
+      TestProposalBuilder()
+          .createdTime(iroha::time::now())
+          .height(3)
+          .transactions(txs)
+          .build());
 
-  EXPECT_CALL(*temp_wsv_mock, apply(_))
+  // none of the transactions writes signatories, so all signatures are
+  // checked in one batch up front
+  EXPECT_CALL(*temp_wsv_mock, validateSignatures(_))
+      .WillOnce(allSignaturesValid());
+  EXPECT_CALL(*temp_wsv_mock, applyPrevalidated(_))
       .WillRepeatedly(Return(iroha::expected::Value<void>({})));
 
   auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
@@ -232,24 +238,32 @@ TEST_F(Validator, SomeTxsFail) {
                     .quorum(1)
                     .createAsset("doge", "coin", 1)
                     .build());
-  auto proposal = TestProposalBuilder()
-                      .createdTime(iroha::time::now())
-                      .height(3)
-                      .transactions(txs)
-                      .build();
+  auto proposal = std::make_shared<shared_model::proto::Proposal>(
+      TestProposalBuilder()
+          .createdTime(iroha::time::now())
+          .height(3)
+          .transactions(txs)
+          .build());
 
-  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs.at(0)))))
+  EXPECT_CALL(*temp_wsv_mock, validateSignatures(_))
+      .WillOnce(allSignaturesValid());
+  EXPECT_CALL(*temp_wsv_mock, applyPrevalidated(Eq(ByRef(txs.at(0)))))
       .WillRepeatedly(Return(iroha::expected::Value<void>({})));
-  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs.at(1)))))
+  EXPECT_CALL(*temp_wsv_mock, applyPrevalidated(Eq(ByRef(txs.at(1)))))
       .WillOnce(Return(iroha::expected::makeError(
           CommandError{"", sample_error_code, sample_error_extra, true})));
-  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs.at(2)))))
+  EXPECT_CALL(*temp_wsv_mock, applyPrevalidated(Eq(ByRef(txs.at(2)))))
       .WillRepeatedly(Return(iroha::expected::Value<void>({})));
 
   auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
   ASSERT_EQ(
       verified_proposal_and_errors->verified_proposal->transactions().size(),
       2);
+  // the verified proposal is a view over the source one
+  EXPECT_EQ(verified_proposal_and_errors->verified_proposal->hash(),
+            proposal->hash());
+  EXPECT_EQ(verified_proposal_and_errors->verified_proposal->createdTime(),
+            proposal->createdTime());
   ASSERT_EQ(verified_proposal_and_errors->rejected_transactions.size(), 1);
   EXPECT_EQ(verified_proposal_and_errors->rejected_transactions.begin()
                 ->error.error_code,
@@ -259,6 +273,57 @@ TEST_F(Validator, SomeTxsFail) {
             sample_error_extra);
 }
 
+
+/**
+ * @given a transaction adding a signatory to an account @and a following
+ * transaction created by that account
+ * @when statefully validating these transactions
+ * @then only the first transaction is checked in the prevalidation batch
+ * @and the second one is checked during application
+ */
+TEST_F(Validator, SignatureDependentTxs) {
+  using namespace std::literals;
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(
+      TestTransactionBuilder()
+          .creatorAccountId("doge@master")
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .addSignatory(
+              "cate@master",
+              shared_model::interface::types::PublicKeyHexStringView{"0a"sv})
+          .build());
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("cate@master")
+                    .createdTime(iroha::time::now())
+                    .quorum(1)
+                    .createAsset("cate", "coin", 1)
+                    .build());
+  auto proposal = std::make_shared<shared_model::proto::Proposal>(
+      TestProposalBuilder()
+          .createdTime(iroha::time::now())
+          .height(3)
+          .transactions(txs)
+          .build());
+
+  EXPECT_CALL(*temp_wsv_mock, validateSignatures(_))
+      .WillOnce(Invoke([&](const auto &prevalidated_txs) {
+        EXPECT_EQ(prevalidated_txs.size(), 1);
+        return std::vector<iroha::expected::Result<void, CommandError>>(
+            prevalidated_txs.size(), iroha::expected::Value<void>{});
+      }));
+  EXPECT_CALL(*temp_wsv_mock, applyPrevalidated(Eq(ByRef(txs.at(0)))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs.at(1)))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+
+  auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
+  ASSERT_EQ(
+      verified_proposal_and_errors->verified_proposal->transactions().size(),
+      2);
+  ASSERT_TRUE(verified_proposal_and_errors->rejected_transactions.empty());
+}
+
 /**
  * @given two atomic batches @and one ordered @and several single transactions
  * @when failing one of the atomic batched @and transaction from ordered batch
@@ -293,11 +358,12 @@ TEST_F(Validator, Batches) {
   txs.push_back(success_atomic_batch[0]);
   txs.push_back(success_atomic_batch[1]);
 
-  auto proposal = TestProposalBuilder()
-                      .createdTime(iroha::time::now())
-                      .height(1)
-                      .transactions(txs)
-                      .build();
+  auto proposal = std::make_shared<shared_model::proto::Proposal>(
+      TestProposalBuilder()
+          .createdTime(iroha::time::now())
+          .height(1)
+          .transactions(txs)
+          .build());
 
   // calls to create savepoints, one per each atomic batch
   EXPECT_CALL(*temp_wsv_mock,
@@ -314,18 +380,20 @@ TEST_F(Validator, Batches) {
   // calls to validate transactions, one per each transaction except those,
   // which are in failed atomic batch - there only calls before the failed
   // transaction are needed
-  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[0]))))
+  EXPECT_CALL(*temp_wsv_mock, validateSignatures(_))
+      .WillOnce(allSignaturesValid());
+  EXPECT_CALL(*temp_wsv_mock, applyPrevalidated(Eq(ByRef(txs[0]))))
       .WillOnce(Return(iroha::expected::Value<void>({})));
-  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[1]))))
+  EXPECT_CALL(*temp_wsv_mock, applyPrevalidated(Eq(ByRef(txs[1]))))
       .WillOnce(Return(iroha::expected::Value<void>({})));
-  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[2]))))
+  EXPECT_CALL(*temp_wsv_mock, applyPrevalidated(Eq(ByRef(txs[2]))))
       .WillOnce(Return(iroha::expected::Value<void>({})));
-  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[3]))))
+  EXPECT_CALL(*temp_wsv_mock, applyPrevalidated(Eq(ByRef(txs[3]))))
       .WillOnce(Return(iroha::expected::makeError(
           CommandError({"", sample_error_code, sample_error_extra, false}))));
-  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[5]))))
+  EXPECT_CALL(*temp_wsv_mock, applyPrevalidated(Eq(ByRef(txs[5]))))
       .WillOnce(Return(iroha::expected::Value<void>({})));
-  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs[6]))))
+  EXPECT_CALL(*temp_wsv_mock, applyPrevalidated(Eq(ByRef(txs[6]))))
       .WillOnce(Return(iroha::expected::Value<void>({})));
 
   auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
@@ -23,6 +23,11 @@ namespace iroha {
           bool(rxcpp::observable<
                    std::shared_ptr<shared_model::interface::Block>>,
                ametsuchi::MutableStorage &));
+      MOCK_CONST_METHOD2(
+          validateAndApplyWindow,
+          size_t(const std::vector<
+                     std::shared_ptr<shared_model::interface::Block>> &,
+                 ametsuchi::MutableStorage &));
     };
   }  // namespace validation
 }  // namespace iroha
@@ -0,0 +1,53 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cache/bloom_filter.hpp"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using iroha::cache::BloomFilter;
+
+/**
+ * @given an empty bloom filter
+ * @when keys are added
+ * @then every added key is reported as maybe present and a key that was
+ * never added is reported as definitely absent
+ */
+TEST(BloomFilterTest, AddAndQuery) {
+  BloomFilter<std::string> filter;
+
+  for (int i = 0; i < 1000; ++i) {
+    filter.add("added_key_" + std::to_string(i));
+  }
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(filter.maybeContains("added_key_" + std::to_string(i)));
+  }
+
+  size_t false_positives = 0;
+  for (int i = 0; i < 1000; ++i) {
+    if (filter.maybeContains("absent_key_" + std::to_string(i))) {
+      ++false_positives;
+    }
+  }
+  // 1000 keys in a 1 MiB shard array gives a negligible false positive
+  // rate; allow a little slack to keep the test deterministic in spirit
+  ASSERT_LE(false_positives, 10u);
+}
+
+/**
+ * @given a bloom filter with added keys
+ * @when the filter is cleared
+ * @then previously added keys are reported as definitely absent
+ */
+TEST(BloomFilterTest, Clear) {
+  BloomFilter<std::string> filter;
+  filter.add("some_key");
+  ASSERT_TRUE(filter.maybeContains("some_key"));
+
+  filter.clear();
+  ASSERT_FALSE(filter.maybeContains("some_key"));
+}
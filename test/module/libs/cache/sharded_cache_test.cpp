@@ -0,0 +1,95 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cache/sharded_cache.hpp"
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using iroha::cache::ShardedCache;
+
+/**
+ * @given an empty sharded cache
+ * @when items are inserted and looked up
+ * @then the inserted values are found, absent keys are not, and the hit
+ * and miss counters reflect the lookups
+ */
+TEST(ShardedCacheTest, InsertAndFind) {
+  ShardedCache<std::string, int> cache;
+  cache.addItem("one", 1);
+  cache.addItem("two", 2);
+
+  auto one = cache.findItem("one");
+  ASSERT_TRUE(one);
+  ASSERT_EQ(*one, 1);
+  auto two = cache.findItem("two");
+  ASSERT_TRUE(two);
+  ASSERT_EQ(*two, 2);
+  ASSERT_FALSE(cache.findItem("three"));
+
+  ASSERT_EQ(cache.getHitCount(), 2);
+  ASSERT_EQ(cache.getMissCount(), 1);
+  ASSERT_EQ(cache.getCacheItemCount(), 2);
+}
+
+/**
+ * @given a cache with a short time-to-live
+ * @when an item is looked up before and after the time-to-live passes
+ * @then it is found before and gone after
+ */
+TEST(ShardedCacheTest, TtlExpiry) {
+  ShardedCache<std::string, int> cache(std::chrono::milliseconds(50));
+  cache.addItem("key", 42);
+  ASSERT_TRUE(cache.findItem("key"));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  ASSERT_FALSE(cache.findItem("key"));
+}
+
+namespace {
+  /// collides every key with every other one
+  struct ConstantHash {
+    size_t operator()(const std::string &) const {
+      return 0;
+    }
+  };
+}  // namespace
+
+/**
+ * @given a cache whose hasher collides all keys
+ * @when a second key with the same hash is looked up and inserted
+ * @then the first key's value is never served for the second key
+ */
+TEST(ShardedCacheTest, HashCollisionIsAMiss) {
+  ShardedCache<std::string, int, ConstantHash> cache;
+  cache.addItem("stored", 1);
+
+  ASSERT_FALSE(cache.findItem("colliding"));
+
+  cache.addItem("colliding", 2);
+  auto colliding = cache.findItem("colliding");
+  ASSERT_TRUE(colliding);
+  ASSERT_EQ(*colliding, 2);
+  ASSERT_FALSE(cache.findItem("stored"));
+}
+
+/**
+ * @given a cache without a time-to-live
+ * @when an updated value is inserted under an existing key
+ * @then the lookup returns the updated value
+ */
+TEST(ShardedCacheTest, Update) {
+  ShardedCache<std::string, int> cache;
+  cache.addItem("key", 1);
+  cache.addItem("key", 2);
+
+  auto value = cache.findItem("key");
+  ASSERT_TRUE(value);
+  ASSERT_EQ(*value, 2);
+  ASSERT_EQ(cache.getCacheItemCount(), 1);
+}
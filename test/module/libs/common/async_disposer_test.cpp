@@ -0,0 +1,49 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/async_disposer.hpp"
+
+#include <atomic>
+#include <future>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+/**
+ * @given a disposer and an object whose destructor records its thread
+ * @when the object is handed over for disposal
+ * @then it is destroyed, and not on the donating thread
+ */
+TEST(AsyncDisposerTest, DestroysOffTheDonorThread) {
+  std::promise<std::thread::id> destroyed_on;
+  iroha::AsyncDisposer disposer;
+
+  disposer.dispose(std::shared_ptr<void>(nullptr, [&destroyed_on](void *) {
+    destroyed_on.set_value(std::this_thread::get_id());
+  }));
+
+  auto future = destroyed_on.get_future();
+  ASSERT_EQ(future.wait_for(10s), std::future_status::ready);
+  ASSERT_NE(future.get(), std::this_thread::get_id());
+}
+
+/**
+ * @given a disposer with many objects pending
+ * @when the disposer is destroyed
+ * @then every pending object has been destroyed
+ */
+TEST(AsyncDisposerTest, DrainsAllBeforeStopping) {
+  std::atomic<int> destroyed{0};
+  {
+    iroha::AsyncDisposer disposer;
+    for (int i = 0; i < 100; ++i) {
+      disposer.dispose(std::shared_ptr<void>(
+          nullptr, [&destroyed](void *) { ++destroyed; }));
+    }
+  }
+  ASSERT_EQ(destroyed.load(), 100);
+}
@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/hexutils.hpp"
+
+#include <gtest/gtest.h>
+
+#include "framework/result_gtest_checkers.hpp"
+
+using namespace iroha;
+
+/// reference scalar encoder to check the vector path against
+static std::string referenceEncode(const std::string &raw) {
+  std::string result;
+  for (unsigned char c : raw) {
+    result += detail::kHexDigits[c >> 4];
+    result += detail::kHexDigits[c & 0x0f];
+  }
+  return result;
+}
+
+/**
+ * @given raw byte strings of every size around the vector chunk widths
+ * @when they are encoded to hex and decoded back
+ * @then the encoding matches the scalar reference and the round-trip is
+ * the identity
+ */
+TEST(HexUtilsTest, RoundTripAllSizes) {
+  for (size_t size = 1; size <= 100; ++size) {
+    std::string raw(size, '\0');
+    for (size_t i = 0; i < size; ++i) {
+      raw[i] = static_cast<char>(i * 37 + size);
+    }
+    auto hex = bytestringToHexstring(raw);
+    ASSERT_EQ(referenceEncode(raw), hex) << "size " << size;
+    auto decoded = hexstringToBytestringResult(hex);
+    IROHA_ASSERT_RESULT_VALUE(decoded) << "size " << size;
+    ASSERT_EQ(raw, std::move(decoded).assumeValue()) << "size " << size;
+  }
+}
+
+/**
+ * @given an uppercase hex string
+ * @when it is decoded
+ * @then the result equals the decoding of its lowercase equivalent
+ */
+TEST(HexUtilsTest, UppercaseDecodes) {
+  auto upper = hexstringToBytestringResult("00FFAA11BB22CC33DD44EE55FF667788");
+  auto lower = hexstringToBytestringResult("00ffaa11bb22cc33dd44ee55ff667788");
+  IROHA_ASSERT_RESULT_VALUE(upper);
+  IROHA_ASSERT_RESULT_VALUE(lower);
+  ASSERT_EQ(std::move(upper).assumeValue(), std::move(lower).assumeValue());
+}
+
+/**
+ * @given hex strings with one invalid character at every position
+ * @when they are decoded
+ * @then an error is returned no matter which chunk the character lands in
+ */
+TEST(HexUtilsTest, InvalidCharacterAnywhereIsAnError) {
+  for (size_t pos = 0; pos < 64; ++pos) {
+    std::string bad(64, 'a');
+    bad[pos] = 'x';
+    IROHA_ASSERT_RESULT_ERROR(hexstringToBytestringResult(bad));
+    bad[pos] = static_cast<char>(0xe9);
+    IROHA_ASSERT_RESULT_ERROR(hexstringToBytestringResult(bad));
+  }
+}
+
+/**
+ * @given an empty string and a string of uneven length
+ * @when they are decoded
+ * @then both are errors
+ */
+TEST(HexUtilsTest, DegenerateInputs) {
+  IROHA_ASSERT_RESULT_ERROR(hexstringToBytestringResult(""));
+  IROHA_ASSERT_RESULT_ERROR(hexstringToBytestringResult("abc"));
+}
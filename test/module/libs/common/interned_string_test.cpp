@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/interned_string.hpp"
+
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using iroha::InternedString;
+
+/**
+ * @given two handles interned from equal values and one from a different
+ * value
+ * @when they are compared
+ * @then equal values share storage, different values do not
+ */
+TEST(InternedStringTest, EqualValuesShareStorage) {
+  InternedString a{"admin@test"};
+  InternedString b{"admin@test"};
+  InternedString c{"other@test"};
+
+  ASSERT_EQ(a, b);
+  ASSERT_EQ(&a.str(), &b.str());
+  ASSERT_NE(a, c);
+  ASSERT_EQ(c.str(), "other@test");
+}
+
+/**
+ * @given many threads interning an overlapping set of values
+ * @when they run concurrently
+ * @then every value maps to exactly one storage address
+ */
+TEST(InternedStringTest, ConcurrentInterningIsConsistent) {
+  constexpr size_t kThreads = 8;
+  constexpr size_t kValues = 100;
+
+  std::vector<std::vector<const std::string *>> seen(kThreads);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (size_t i = 0; i < kValues; ++i) {
+        seen[t].push_back(
+            &InternedString{"account" + std::to_string(i) + "@test"}.str());
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < kValues; ++i) {
+    for (size_t t = 1; t < kThreads; ++t) {
+      ASSERT_EQ(seen[0][i], seen[t][i]);
+    }
+  }
+}
+
+/**
+ * @given interned handles used as keys of an unordered container
+ * @when equal values are inserted repeatedly
+ * @then the container holds one entry per distinct value
+ */
+TEST(InternedStringTest, WorksAsUnorderedKey) {
+  std::unordered_set<InternedString> keys;
+  keys.emplace("a@test");
+  keys.emplace("b@test");
+  keys.emplace("a@test");
+  ASSERT_EQ(keys.size(), 2u);
+  ASSERT_EQ(keys.count(InternedString{"b@test"}), 1u);
+}
@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/lockfree_staging_queue.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using iroha::containers::LockFreeStagingQueue;
+
+/**
+ * @given a staging queue with several pushed values
+ * @when the queue is drained
+ * @then the values come out in push order and the queue becomes empty
+ */
+TEST(LockFreeStagingQueueTest, DrainPreservesPushOrder) {
+  LockFreeStagingQueue<int> queue;
+  ASSERT_TRUE(queue.empty());
+
+  for (int value = 0; value < 10; ++value) {
+    queue.push(value);
+  }
+  ASSERT_FALSE(queue.empty());
+
+  std::vector<int> drained;
+  queue.drain([&drained](int &&value) { drained.push_back(value); });
+
+  std::vector<int> expected(10);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(drained, expected);
+  EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * @given several producer threads pushing into one queue
+ * @when a consumer drains concurrently with the producers and once after
+ *       they join
+ * @then every pushed value is consumed exactly once
+ */
+TEST(LockFreeStagingQueueTest, ConcurrentProducersLoseNothing) {
+  constexpr size_t kProducers = 4;
+  constexpr size_t kValuesPerProducer = 1000;
+
+  LockFreeStagingQueue<size_t> queue;
+  std::vector<size_t> consumed;
+
+  std::vector<std::thread> producers;
+  for (size_t producer = 0; producer < kProducers; ++producer) {
+    producers.emplace_back([&queue, producer] {
+      for (size_t i = 0; i < kValuesPerProducer; ++i) {
+        queue.push(producer * kValuesPerProducer + i);
+      }
+    });
+  }
+
+  while (consumed.size() < kProducers * kValuesPerProducer) {
+    queue.drain([&consumed](size_t &&value) { consumed.push_back(value); });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  queue.drain([&consumed](size_t &&value) { consumed.push_back(value); });
+
+  ASSERT_EQ(consumed.size(), kProducers * kValuesPerProducer);
+  std::sort(consumed.begin(), consumed.end());
+  for (size_t i = 0; i < consumed.size(); ++i) {
+    EXPECT_EQ(consumed[i], i);
+  }
+}
@@ -0,0 +1,78 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/mem_operations.hpp"
+
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace iroha;
+
+/**
+ * @given a buffer below the huge page threshold
+ * @when it is written and read back
+ * @then the bytes round-trip
+ */
+TEST(HugePageBufferTest, SmallBuffer) {
+  HugePageBuffer buffer(64);
+  ASSERT_EQ(buffer.size(), 64);
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    buffer.data()[i] = static_cast<char>(i);
+  }
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    EXPECT_EQ(buffer.data()[i], static_cast<char>(i));
+  }
+}
+
+/**
+ * @given a buffer above the huge page threshold, mapped or fallen back
+ * depending on the system
+ * @when every page of it is written and read back
+ * @then the bytes round-trip
+ */
+TEST(HugePageBufferTest, LargeBuffer) {
+  const size_t size = 3 * kHugePageSize;
+  HugePageBuffer buffer(size);
+  ASSERT_EQ(buffer.size(), size);
+  for (size_t i = 0; i < size; i += 4096) {
+    buffer.data()[i] = static_cast<char>(i >> 12);
+  }
+  for (size_t i = 0; i < size; i += 4096) {
+    EXPECT_EQ(buffer.data()[i], static_cast<char>(i >> 12));
+  }
+}
+
+/**
+ * @given a filled buffer
+ * @when it is moved from
+ * @then the target owns the bytes and the source is empty
+ */
+TEST(HugePageBufferTest, Move) {
+  HugePageBuffer buffer(kHugePageSize);
+  buffer.data()[0] = 42;
+  HugePageBuffer moved(std::move(buffer));
+  EXPECT_EQ(moved.size(), kHugePageSize);
+  EXPECT_EQ(moved.data()[0], 42);
+  EXPECT_EQ(buffer.size(), 0);
+  EXPECT_EQ(buffer.data(), nullptr);
+}
+
+/**
+ * @given a standard vector on the huge page allocator
+ * @when it grows across the huge page threshold
+ * @then the contents survive the reallocations
+ */
+TEST(HugePageAllocatorTest, VectorGrowsAcrossThreshold) {
+  std::vector<uint64_t, HugePageAllocator<uint64_t>> values;
+  const size_t count = kHugePageSize / sizeof(uint64_t) + 1000;
+  for (size_t i = 0; i < count; ++i) {
+    values.push_back(i);
+  }
+  ASSERT_EQ(values.size(), count);
+  EXPECT_EQ(std::accumulate(values.begin(), values.end(), uint64_t{0}),
+            count * (count - 1) / 2);
+}
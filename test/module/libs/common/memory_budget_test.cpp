@@ -0,0 +1,43 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/memory_budget.hpp"
+
+#include <gtest/gtest.h>
+
+using iroha::MemoryBudget;
+
+/**
+ * @given a budget with no limit set
+ * @when charges exceed any amount
+ * @then the budget never reports exhaustion
+ */
+TEST(MemoryBudgetTest, NoLimitNeverOverBudget) {
+  MemoryBudget budget;
+  budget.charge(1ull << 40);
+  ASSERT_FALSE(budget.overBudget());
+  budget.release(1ull << 40);
+}
+
+/**
+ * @given a budget with a limit
+ * @when the charges cross the limit and are then released
+ * @then exhaustion is reported exactly while the limit is exceeded
+ */
+TEST(MemoryBudgetTest, ChargeAndRelease) {
+  MemoryBudget budget;
+  budget.setLimit(100);
+
+  budget.charge(60);
+  ASSERT_FALSE(budget.overBudget());
+  ASSERT_EQ(budget.used(), 60);
+
+  budget.charge(60);
+  ASSERT_TRUE(budget.overBudget());
+
+  budget.release(60);
+  ASSERT_FALSE(budget.overBudget());
+  ASSERT_EQ(budget.used(), 60);
+}
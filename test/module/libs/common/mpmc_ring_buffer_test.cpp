@@ -0,0 +1,122 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/mpmc_ring_buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using iroha::containers::MpmcRingBuffer;
+
+/**
+ * @given an empty ring buffer
+ * @when values are pushed and popped
+ * @then the values come out in push order and the capacity is respected
+ */
+TEST(MpmcRingBufferTest, PushPopRespectsOrderAndCapacity) {
+  MpmcRingBuffer<int, 4> buffer;
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_EQ(buffer.size(), 0u);
+
+  for (int value = 0; value < 4; ++value) {
+    ASSERT_TRUE(buffer.tryPush(value));
+    EXPECT_EQ(buffer.size(), static_cast<size_t>(value) + 1);
+  }
+  ASSERT_FALSE(buffer.tryPush(4));
+
+  int value;
+  for (int expected = 0; expected < 4; ++expected) {
+    ASSERT_TRUE(buffer.tryPop(value));
+    EXPECT_EQ(value, expected);
+  }
+  ASSERT_FALSE(buffer.tryPop(value));
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_EQ(buffer.size(), 0u);
+}
+
+/**
+ * @given a ring buffer with spare room for a part of a range
+ * @when the range is pushed as a batch and the buffer is drained
+ * @then only the fitting prefix is enqueued and popAll returns all of it
+ */
+TEST(MpmcRingBufferTest, BatchOperations) {
+  MpmcRingBuffer<int, 4> buffer;
+  std::vector<int> values{1, 2, 3, 4, 5, 6};
+
+  ASSERT_EQ(buffer.tryPushBatch(values.begin(), values.end()), 4);
+
+  std::vector<int> drained;
+  ASSERT_EQ(buffer.popAll([&drained](int &&value) {
+    drained.push_back(value);
+  }),
+            4);
+  EXPECT_EQ(drained, std::vector<int>({1, 2, 3, 4}));
+  ASSERT_TRUE(buffer.empty());
+}
+
+/**
+ * @given several producer threads pushing into one ring buffer
+ * @when several consumer threads pop concurrently until the producers are
+ *       done and the buffer is empty
+ * @then every pushed value is consumed exactly once
+ */
+TEST(MpmcRingBufferTest, ConcurrentProducersAndConsumersLoseNothing) {
+  constexpr size_t kProducers = 4;
+  constexpr size_t kConsumers = 4;
+  constexpr size_t kValuesPerProducer = 1000;
+
+  MpmcRingBuffer<size_t, 64> buffer;
+  std::atomic<size_t> remaining_producers{kProducers};
+  std::vector<std::vector<size_t>> consumed(kConsumers);
+
+  std::vector<std::thread> producers;
+  for (size_t producer = 0; producer < kProducers; ++producer) {
+    producers.emplace_back([&buffer, producer] {
+      for (size_t i = 0; i < kValuesPerProducer; ++i) {
+        while (not buffer.tryPush(producer * kValuesPerProducer + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::vector<std::thread> consumers;
+  for (size_t consumer = 0; consumer < kConsumers; ++consumer) {
+    consumers.emplace_back([&buffer, &remaining_producers, &consumed,
+                            consumer] {
+      size_t value;
+      while (remaining_producers.load() != 0 or not buffer.empty()) {
+        if (buffer.tryPop(value)) {
+          consumed[consumer].push_back(value);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  for (auto &producer : producers) {
+    producer.join();
+    --remaining_producers;
+  }
+  for (auto &consumer : consumers) {
+    consumer.join();
+  }
+
+  std::vector<size_t> all_consumed;
+  for (auto const &values : consumed) {
+    all_consumed.insert(all_consumed.end(), values.begin(), values.end());
+  }
+  ASSERT_EQ(all_consumed.size(), kProducers * kValuesPerProducer);
+  std::sort(all_consumed.begin(), all_consumed.end());
+  for (size_t i = 0; i < all_consumed.size(); ++i) {
+    EXPECT_EQ(all_consumed[i], i);
+  }
+}
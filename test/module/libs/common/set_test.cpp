@@ -0,0 +1,119 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/set.hpp"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace iroha;
+
+namespace {
+  struct IntHasher {
+    size_t operator()(int value) const {
+      return std::hash<int>{}(value);
+    }
+  };
+}  // namespace
+
+/**
+ * @given two vectors with overlapping elements
+ * @when they are merged with merge_unique
+ * @then the result holds the union without duplicates
+ */
+TEST(SetTest, MergeUnique) {
+  std::vector<int> left{1, 2, 3};
+  std::vector<int> right{3, 4, 5};
+  auto result = merge_unique<IntHasher>(left, right);
+  std::set<int> as_set(result.begin(), result.end());
+  ASSERT_EQ(result.size(), as_set.size());
+  ASSERT_EQ(as_set, (std::set<int>{1, 2, 3, 4, 5}));
+}
+
+/**
+ * @given two sorted vectors with overlapping elements
+ * @when they are merged with merge_unique_sorted
+ * @then the result is the sorted union without duplicates
+ */
+TEST(SetTest, MergeUniqueSorted) {
+  std::vector<int> left{1, 3, 5, 7};
+  std::vector<int> right{2, 3, 6, 7, 8};
+  auto result = merge_unique_sorted(left, right);
+  ASSERT_EQ(result, (std::vector<int>{1, 2, 3, 5, 6, 7, 8}));
+}
+
+/**
+ * @given two sets of pointers with equivalent elements
+ * @when they are merged with set_union_move
+ * @then equivalent elements are merged and the others are spliced into
+ * the result without reallocation
+ */
+TEST(SetTest, SetUnionMove) {
+  struct Counted {
+    int key;
+    int merged_count{0};
+  };
+  struct KeyLess {
+    bool operator()(const std::shared_ptr<Counted> &lhs,
+                    const std::shared_ptr<Counted> &rhs) const {
+      return lhs->key < rhs->key;
+    }
+  };
+  using PtrSet = std::set<std::shared_ptr<Counted>, KeyLess>;
+
+  PtrSet left{std::make_shared<Counted>(Counted{1}),
+              std::make_shared<Counted>(Counted{2})};
+  PtrSet right{std::make_shared<Counted>(Counted{2}),
+               std::make_shared<Counted>(Counted{3})};
+  auto *right_only = right.rbegin()->get();
+
+  auto result = set_union_move(
+      std::move(left), std::move(right), [](const auto &into, const auto &) {
+        ++into->merged_count;
+      });
+
+  ASSERT_EQ(3u, result.size());
+  auto it = result.begin();
+  EXPECT_EQ(0, (*it)->merged_count);
+  ++it;
+  EXPECT_EQ(1, (*it)->merged_count);
+  ++it;
+  // the node of the element unique to the right set is reused as is
+  EXPECT_EQ(right_only, it->get());
+}
+
+/**
+ * @given two sets with equivalent elements
+ * @when they are merged with set_union
+ * @then the sources are untouched and equal elements are merged
+ */
+TEST(SetTest, SetUnionKeepsSources) {
+  std::set<int> left{1, 2};
+  std::set<int> right{2, 3};
+  size_t merged = 0;
+  auto result =
+      set_union(left, right, [&merged](const auto &, const auto &) {
+        ++merged;
+      });
+  ASSERT_EQ((std::set<int>{1, 2, 3}), result);
+  ASSERT_EQ(1u, merged);
+  ASSERT_EQ(2u, left.size());
+  ASSERT_EQ(2u, right.size());
+}
+
+/**
+ * @given two sets
+ * @when set_difference is taken
+ * @then only elements missing from the right set remain
+ */
+TEST(SetTest, SetDifference) {
+  std::set<int> left{1, 2, 3};
+  std::set<int> right{2};
+  ASSERT_EQ((std::set<int>{1, 3}), set_difference(left, right));
+}
@@ -0,0 +1,103 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/spsc_channel.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using iroha::containers::SpscChannel;
+
+/**
+ * @given an empty channel
+ * @when values are pushed and popped on one thread
+ * @then the values come out in push order and the capacity is respected
+ */
+TEST(SpscChannelTest, PushPopRespectsOrderAndCapacity) {
+  SpscChannel<int, 4> channel;
+
+  for (int value = 0; value < 4; ++value) {
+    ASSERT_TRUE(channel.tryPush(value));
+  }
+  ASSERT_FALSE(channel.tryPush(4));
+
+  int value;
+  for (int expected = 0; expected < 4; ++expected) {
+    ASSERT_TRUE(channel.tryPop(value));
+    EXPECT_EQ(value, expected);
+  }
+  ASSERT_FALSE(channel.tryPop(value));
+}
+
+/**
+ * @given a channel closed with values still inside
+ * @when the consumer keeps popping
+ * @then the buffered values are served before pop reports the close
+ */
+TEST(SpscChannelTest, CloseDrainsBufferedValues) {
+  SpscChannel<int, 4> channel;
+  ASSERT_TRUE(channel.push(1));
+  ASSERT_TRUE(channel.push(2));
+  channel.close();
+
+  ASSERT_FALSE(channel.push(3));
+
+  int value;
+  ASSERT_TRUE(channel.pop(value));
+  EXPECT_EQ(value, 1);
+  ASSERT_TRUE(channel.pop(value));
+  EXPECT_EQ(value, 2);
+  ASSERT_FALSE(channel.pop(value));
+}
+
+/**
+ * @given a producer thread pushing through a channel smaller than the
+ *       stream, parking both sides along the way
+ * @when the consumer pops until the producer closes the channel
+ * @then every pushed value arrives exactly once and in order
+ */
+TEST(SpscChannelTest, BlockingHandoffLosesNothing) {
+  constexpr size_t kValues = 10000;
+
+  SpscChannel<size_t, 8> channel;
+
+  std::thread producer([&channel] {
+    for (size_t i = 0; i < kValues; ++i) {
+      ASSERT_TRUE(channel.push(i));
+    }
+    channel.close();
+  });
+
+  std::vector<size_t> consumed;
+  size_t value;
+  while (channel.pop(value)) {
+    consumed.push_back(value);
+  }
+  producer.join();
+
+  ASSERT_EQ(consumed.size(), kValues);
+  for (size_t i = 0; i < consumed.size(); ++i) {
+    EXPECT_EQ(consumed[i], i);
+  }
+}
+
+/**
+ * @given a consumer parked on an empty channel
+ * @when the channel is closed from another thread
+ * @then the consumer wakes up and pop reports the close
+ */
+TEST(SpscChannelTest, CloseWakesParkedConsumer) {
+  SpscChannel<int, 4> channel;
+
+  std::thread consumer([&channel] {
+    int value;
+    EXPECT_FALSE(channel.pop(value));
+  });
+
+  channel.close();
+  consumer.join();
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/task_scheduler.hpp"
+
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+
+using iroha::TaskScheduler;
+using Priority = iroha::TaskScheduler::Priority;
+
+/**
+ * @given a scheduler and several threads posting tasks concurrently
+ * @when the scheduler is destroyed
+ * @then every posted task has run exactly once
+ */
+TEST(TaskSchedulerTest, RunsTasksPostedFromManyThreads) {
+  std::atomic<int> executed{0};
+  {
+    TaskScheduler scheduler(4, getTestLogger("TaskScheduler"));
+    std::vector<std::thread> posters;
+    for (int t = 0; t < 4; ++t) {
+      posters.emplace_back([&scheduler, &executed] {
+        for (int i = 0; i < 100; ++i) {
+          scheduler.post(Priority::kValidation, [&executed] { ++executed; });
+        }
+      });
+    }
+    for (auto &poster : posters) {
+      poster.join();
+    }
+  }
+  ASSERT_EQ(executed.load(), 400);
+}
+
+/**
+ * @given a single-worker scheduler blocked on a gate task
+ * @when a background task is queued before a consensus task
+ * @then the consensus task runs first once the gate opens
+ */
+TEST(TaskSchedulerTest, UrgentTasksOvertakeQueuedBackgroundWork) {
+  std::promise<void> gate;
+  std::vector<int> order;
+  {
+    TaskScheduler scheduler(1, getTestLogger("TaskScheduler"));
+    scheduler.post(Priority::kConsensus,
+                   [future = gate.get_future().share()] { future.wait(); });
+    scheduler.post(Priority::kBackground, [&order] { order.push_back(2); });
+    scheduler.post(Priority::kConsensus, [&order] { order.push_back(1); });
+    gate.set_value();
+  }
+  ASSERT_EQ(order, std::vector<int>({1, 2}));
+}
+
+/**
+ * @given a scheduler with a task which fans out into further tasks
+ * @when the scheduler is destroyed
+ * @then the nested tasks have run as well
+ */
+TEST(TaskSchedulerTest, TasksPostedFromWorkersComplete) {
+  std::atomic<int> executed{0};
+  {
+    TaskScheduler scheduler(2, getTestLogger("TaskScheduler"));
+    scheduler.post(Priority::kValidation, [&scheduler, &executed] {
+      for (int i = 0; i < 50; ++i) {
+        scheduler.post(Priority::kValidation, [&executed] { ++executed; });
+      }
+    });
+  }
+  ASSERT_EQ(executed.load(), 50);
+}
+
+/**
+ * @given a scheduler sized to the hardware by default
+ * @when the worker count is queried
+ * @then it is positive, so fan-outs can size their chunks by it
+ */
+TEST(TaskSchedulerTest, DefaultWorkerCountIsPositive) {
+  TaskScheduler scheduler(0, getTestLogger("TaskScheduler"));
+  ASSERT_GT(scheduler.workerCount(), 0u);
+}
@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/timing_wheel.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using iroha::containers::TimingWheel;
+
+namespace {
+  std::vector<int> collectUpTo(TimingWheel<int> &wheel, uint64_t now) {
+    std::vector<int> due;
+    wheel.advanceTo(now, [&due](int &&value) { due.push_back(value); });
+    std::sort(due.begin(), due.end());
+    return due;
+  }
+}  // namespace
+
+/**
+ * @given a wheel with entries at various deadlines
+ * @when the wheel is advanced step by step
+ * @then each advance yields exactly the entries due by that time
+ */
+TEST(TimingWheelTest, YieldsEntriesByDeadline) {
+  TimingWheel<int> wheel;
+  wheel.advanceTo(1000, [](int &&) { FAIL() << "nothing is due yet"; });
+
+  wheel.insert(1005, 1);
+  wheel.insert(1500, 2);
+  wheel.insert(1500, 3);
+  // far enough to live in a coarse level and be cascaded down
+  wheel.insert(100000, 4);
+
+  EXPECT_EQ(collectUpTo(wheel, 1004), std::vector<int>{});
+  EXPECT_EQ(collectUpTo(wheel, 1005), std::vector<int>{1});
+  EXPECT_EQ(collectUpTo(wheel, 2000), (std::vector<int>{2, 3}));
+  EXPECT_EQ(collectUpTo(wheel, 99999), std::vector<int>{});
+  EXPECT_EQ(collectUpTo(wheel, 100000), std::vector<int>{4});
+  EXPECT_EQ(wheel.size(), 0u);
+}
+
+/**
+ * @given entries inserted before the first advance, some already overdue
+ * @when the wheel is advanced for the first time
+ * @then the overdue entries are yielded and the rest stay until their time
+ */
+TEST(TimingWheelTest, LazyInitializationHandlesOverdueEntries) {
+  TimingWheel<int> wheel;
+  wheel.insert(500, 1);
+  wheel.insert(5000, 2);
+  ASSERT_EQ(wheel.size(), 2u);
+
+  EXPECT_EQ(collectUpTo(wheel, 1000), std::vector<int>{1});
+  EXPECT_EQ(collectUpTo(wheel, 5000), std::vector<int>{2});
+}
+
+/**
+ * @given a wheel whose time has already advanced
+ * @when an entry with a deadline in the past is inserted
+ * @then the next advance yields it
+ */
+TEST(TimingWheelTest, LateInsertFiresOnNextAdvance) {
+  TimingWheel<int> wheel;
+  wheel.advanceTo(1000, [](int &&) {});
+  wheel.insert(10, 1);
+
+  EXPECT_EQ(collectUpTo(wheel, 1001), std::vector<int>{1});
+}
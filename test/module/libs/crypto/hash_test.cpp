@@ -139,3 +139,30 @@ TEST(Hash, sha3_512_RU_text_LOOP) {
                  res.c_str());
   }
 }
+
+/**
+ * @given many payloads, enough to spread over several hashing tasks
+ * @when they are hashed as one batch
+ * @then every digest matches the one computed by the single-payload api
+ */
+TEST(Hash, sha3_256_batch_matches_single) {
+  constexpr size_t kPayloads = 1000;
+  std::vector<std::string> payloads;
+  payloads.reserve(kPayloads);
+  for (size_t i = 0; i < kPayloads; ++i) {
+    payloads.push_back("payload number " + std::to_string(i));
+  }
+
+  std::vector<std::pair<const uint8_t *, size_t>> views;
+  views.reserve(kPayloads);
+  for (const auto &payload : payloads) {
+    views.emplace_back(reinterpret_cast<const uint8_t *>(payload.data()),
+                       payload.size());
+  }
+
+  const auto digests = iroha::sha3_256_batch(views);
+  ASSERT_EQ(digests.size(), kPayloads);
+  for (size_t i = 0; i < kPayloads; ++i) {
+    ASSERT_EQ(digests[i], sha3_256(payloads[i]));
+  }
+}
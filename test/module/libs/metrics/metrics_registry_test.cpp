@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics_registry.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using iroha::metrics::Counter;
+using iroha::metrics::Histogram;
+using iroha::metrics::MetricsRegistry;
+
+/**
+ * @given a counter incremented from several threads
+ * @when the threads join
+ * @then the scraped value is the total number of increments
+ */
+TEST(MetricsRegistryTest, CounterSumsThreadIncrements) {
+  constexpr size_t kThreads = 4;
+  constexpr size_t kIncrementsPerThread = 1000;
+
+  Counter counter;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&counter] {
+      for (size_t j = 0; j < kIncrementsPerThread; ++j) {
+        counter.inc();
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(counter.value(), kThreads * kIncrementsPerThread);
+}
+
+/**
+ * @given a registry with a counter and a histogram
+ * @when the metrics are rendered
+ * @then the output follows the Prometheus text exposition format
+ */
+TEST(MetricsRegistryTest, RenderExpositionFormat) {
+  MetricsRegistry registry;
+  auto counter = registry.makeCounter("test_counter", "A test counter");
+  counter->inc(3);
+  auto histogram =
+      registry.makeHistogram("test_histogram", "A test histogram", {1, 2});
+  histogram->observe(0.5);
+  histogram->observe(1.5);
+  histogram->observe(5);
+
+  const std::string rendered = registry.render();
+  EXPECT_NE(rendered.find("# TYPE test_counter counter\n"), std::string::npos);
+  EXPECT_NE(rendered.find("test_counter 3\n"), std::string::npos);
+  EXPECT_NE(rendered.find("# TYPE test_histogram histogram\n"),
+            std::string::npos);
+  EXPECT_NE(rendered.find("test_histogram_bucket{le=\"1\"} 1\n"),
+            std::string::npos);
+  EXPECT_NE(rendered.find("test_histogram_bucket{le=\"2\"} 2\n"),
+            std::string::npos);
+  EXPECT_NE(rendered.find("test_histogram_bucket{le=\"+Inf\"} 3\n"),
+            std::string::npos);
+  EXPECT_NE(rendered.find("test_histogram_count 3\n"), std::string::npos);
+}
+
+/**
+ * @given a registry holding a metric
+ * @when a metric with the same name is requested again
+ * @then the same instance is returned
+ */
+TEST(MetricsRegistryTest, SameNameReturnsSameMetric) {
+  MetricsRegistry registry;
+  auto first = registry.makeCounter("shared_counter", "help");
+  auto second = registry.makeCounter("shared_counter", "help");
+  ASSERT_EQ(first, second);
+}
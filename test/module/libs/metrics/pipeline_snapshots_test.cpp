@@ -0,0 +1,70 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/pipeline_snapshots.hpp"
+
+#include <gtest/gtest.h>
+
+using iroha::metrics::PipelineSnapshots;
+
+/**
+ * @given snapshots updated by every subsystem setter
+ * @when a snapshot is taken
+ * @then it reflects the latest stored values
+ */
+TEST(PipelineSnapshotsTest, SnapshotReflectsLatestValues) {
+  PipelineSnapshots snapshots;
+  snapshots.setConsensusRound(42, 1);
+  snapshots.setConsensusVotes(4);
+  snapshots.setOrderingCache(7, 120);
+  snapshots.setNextProposalTransactions(90);
+  snapshots.setMstPendingBatches(3);
+
+  const auto snapshot = snapshots.snapshot();
+  EXPECT_EQ(snapshot.consensus_block_round, 42);
+  EXPECT_EQ(snapshot.consensus_reject_round, 1);
+  EXPECT_EQ(snapshot.consensus_votes, 4);
+  EXPECT_EQ(snapshot.ordering_cache_batches, 7);
+  EXPECT_EQ(snapshot.ordering_cache_transactions, 120);
+  EXPECT_EQ(snapshot.next_proposal_transactions, 90);
+  EXPECT_EQ(snapshot.mst_pending_batches, 3);
+}
+
+/**
+ * @given fewer finished rounds than the ring retains
+ * @when a snapshot is taken
+ * @then only the recorded rounds are returned, most recent first
+ */
+TEST(PipelineSnapshotsTest, PartiallyFilledRingReturnsRecordedRounds) {
+  PipelineSnapshots snapshots;
+  snapshots.recordRound(1, 0, std::chrono::microseconds(100));
+  snapshots.recordRound(2, 0, std::chrono::microseconds(200));
+
+  const auto snapshot = snapshots.snapshot();
+  ASSERT_EQ(snapshot.recent_rounds.size(), 2);
+  EXPECT_EQ(snapshot.recent_rounds[0].block_round, 2);
+  EXPECT_EQ(snapshot.recent_rounds[0].duration_us, 200);
+  EXPECT_EQ(snapshot.recent_rounds[1].block_round, 1);
+  EXPECT_EQ(snapshot.recent_rounds[1].duration_us, 100);
+}
+
+/**
+ * @given more finished rounds than the ring retains
+ * @when a snapshot is taken
+ * @then the oldest rounds are evicted and the newest are kept in order
+ */
+TEST(PipelineSnapshotsTest, RingEvictsOldestRounds) {
+  PipelineSnapshots snapshots;
+  const uint64_t total = PipelineSnapshots::kRetainedRounds + 5;
+  for (uint64_t round = 1; round <= total; ++round) {
+    snapshots.recordRound(round, 0, std::chrono::microseconds(round));
+  }
+
+  const auto snapshot = snapshots.snapshot();
+  ASSERT_EQ(snapshot.recent_rounds.size(), PipelineSnapshots::kRetainedRounds);
+  for (size_t i = 0; i < snapshot.recent_rounds.size(); ++i) {
+    EXPECT_EQ(snapshot.recent_rounds[i].block_round, total - i);
+  }
+}
@@ -0,0 +1,46 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/tx_latency_tracer.hpp"
+
+#include <gtest/gtest.h>
+
+using iroha::metrics::TxLatencyTracer;
+using iroha::metrics::TxStage;
+
+/**
+ * @given a tracer sampling every transaction
+ * @when a transaction passes several stages up to the commit
+ * @then the rendered trace lists the passed stages and skips the others
+ */
+TEST(TxLatencyTracerTest, RendersPassedStages) {
+  TxLatencyTracer tracer(1);
+  tracer.recordStage("abcdef", TxStage::kToriiReceived);
+  tracer.recordStage("abcdef", TxStage::kOrderingCacheInserted);
+  tracer.recordStage("abcdef", TxStage::kProposalIncluded);
+  tracer.recordStage("abcdef", TxStage::kCommitted);
+
+  const std::string rendered = tracer.render();
+  EXPECT_NE(rendered.find("abcdef\n"), std::string::npos);
+  EXPECT_NE(rendered.find("torii_received"), std::string::npos);
+  EXPECT_NE(rendered.find("ordering_cache_inserted"), std::string::npos);
+  EXPECT_NE(rendered.find("proposal_included"), std::string::npos);
+  EXPECT_NE(rendered.find("committed"), std::string::npos);
+  // the transaction did not go through multisig or verified proposal
+  EXPECT_EQ(rendered.find("mst_pending"), std::string::npos);
+  EXPECT_EQ(rendered.find("verified_proposal"), std::string::npos);
+}
+
+/**
+ * @given a tracer sampling every transaction
+ * @when a transaction has not reached the commit stage yet
+ * @then it does not appear in the rendered traces
+ */
+TEST(TxLatencyTracerTest, PendingTraceIsNotRendered) {
+  TxLatencyTracer tracer(1);
+  tracer.recordStage("012345", TxStage::kToriiReceived);
+
+  EXPECT_EQ(tracer.render().find("012345"), std::string::npos);
+}
@@ -158,3 +158,46 @@ TEST(MultihashTest, CreateFromBufferWithWrongLength) {
   const char *error = multihash_result.assumeError();
   EXPECT_THAT(error, ::testing::HasSubstr("actual length"));
 }
+
+/**
+ *   @given buffers with a 32 byte key and a 64 byte signature in the
+ *          deployed multihash-ed25519 layouts
+ *   @when creating multihashes using the buffers
+ *   @then the fast-path parsing yields the same type and payload as the
+ *         generic encoding produced
+ **/
+TEST(MultihashTest, CreateFromDeployedKeyLayouts) {
+  for (auto [type, payload_size] :
+       {std::make_pair(Type::ed25519pub, size_t(32)),
+        std::make_pair(Type::ed25519_sha3_256, size_t(64))}) {
+    std::basic_string<std::byte> payload(payload_size, std::byte{0xAB});
+    std::basic_string<std::byte> buffer;
+    encodeVarIntType(type, buffer);
+    encodeVarInt(payload.size(), buffer);
+    buffer.append(payload);
+
+    const auto multihash_result = createFromBuffer(buffer);
+    IROHA_ASSERT_RESULT_VALUE(multihash_result);
+    const iroha::multihash::Multihash &multihash =
+        multihash_result.assumeValue();
+    EXPECT_EQ(multihash.type, type);
+    EXPECT_EQ(multihash.data, payload);
+  }
+}
+
+/**
+ *   @given a buffer with a deployed type tag whose payload is truncated
+ *   @when creating a multihash using the buffer
+ *   @then error is returned
+ **/
+TEST(MultihashTest, CreateFromDeployedTagWithTruncatedPayload) {
+  std::basic_string<std::byte> buffer;
+  encodeVarIntType(Type::ed25519pub, buffer);
+  encodeVarInt(size_t(32), buffer);
+  buffer.append("short"_bytestring);
+
+  const auto multihash_result = createFromBuffer(buffer);
+  IROHA_ASSERT_RESULT_ERROR(multihash_result);
+  const char *error = multihash_result.assumeError();
+  EXPECT_THAT(error, ::testing::HasSubstr("actual length"));
+}
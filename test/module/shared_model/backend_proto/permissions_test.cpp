@@ -4,6 +4,7 @@
  */
 
 #include "backend/protobuf/permissions.hpp"
+#include <bitset>
 #include <gtest/gtest.h>
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/range/irange.hpp>
@@ -138,6 +139,32 @@ TEST(ProtoPermission, PermissionSet) {
   ASSERT_FALSE(set.isSet(Role::kAddAssetQty));
 }
 
+/**
+ * @given a permission set
+ * @when it is serialized to a bitstring and parsed back
+ * @then the same set is produced, and the format matches std::bitset,
+ * which is what the WSV stores
+ */
+TEST(ProtoPermission, BitstringRoundTrip) {
+  using Role = shared_model::interface::permissions::Role;
+  using PermSet = shared_model::interface::PermissionSet<Role>;
+  PermSet set({Role::kAppendRole, Role::kTransfer, Role::kRoot});
+  std::bitset<PermSet::size()> expected;
+  expected.set(static_cast<size_t>(Role::kAppendRole));
+  expected.set(static_cast<size_t>(Role::kTransfer));
+  expected.set(static_cast<size_t>(Role::kRoot));
+  ASSERT_EQ(set.toBitstring(), expected.to_string());
+  ASSERT_EQ(PermSet(set.toBitstring()), set);
+
+  PermSet all;
+  all.setAll();
+  ASSERT_EQ(all.toBitstring(), std::string(PermSet::size(), '1'));
+  ASSERT_EQ(PermSet(all.toBitstring()), all);
+
+  ASSERT_EQ(PermSet().toBitstring(), std::string(PermSet::size(), '0'));
+  ASSERT_THROW(PermSet("01x"), std::invalid_argument);
+}
+
 TEST(ProtoPermission, PermissionSubset) {
   using Role = shared_model::interface::permissions::Role;
   using PermSet = shared_model::interface::PermissionSet<Role>;
@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/proposal_view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <boost/range/size.hpp>
+#include "backend/protobuf/proposal.hpp"
+#include "backend/protobuf/transaction.hpp"
+
+using namespace shared_model;
+
+namespace {
+  iroha::protocol::Proposal makeTestProposal() {
+    iroha::protocol::Proposal proposal;
+    proposal.set_height(13);
+    proposal.set_created_time(1024);
+    for (int i = 0; i < 3; ++i) {
+      auto *payload =
+          proposal.add_transactions()->mutable_payload()
+              ->mutable_reduced_payload();
+      payload->set_creator_account_id("user" + std::to_string(i) + "@test");
+      payload->set_created_time(1000 + i);
+      payload->set_quorum(1);
+    }
+    return proposal;
+  }
+}  // namespace
+
+/**
+ * @given a proposal view over a transport
+ * @when the envelope fields and the transaction hashes are queried
+ * @then they match the ones of the eagerly built proposal wrapper
+ */
+TEST(ProposalViewTest, ShallowScanMatchesTheEagerWrapper) {
+  proto::Proposal eager(makeTestProposal());
+  proto::ProposalView view(makeTestProposal());
+
+  EXPECT_EQ(eager.height(), view.height());
+  EXPECT_EQ(eager.createdTime(), view.createdTime());
+  ASSERT_EQ(boost::size(eager.transactions()), view.transactionsCount());
+
+  auto const &hashes = view.transactionHashes();
+  ASSERT_EQ(view.transactionsCount(), hashes.size());
+  size_t i = 0;
+  for (auto const &tx : eager.transactions()) {
+    EXPECT_EQ(tx.hash(), hashes[i++]);
+  }
+
+  EXPECT_EQ(eager.blob(), view.blob());
+  EXPECT_EQ(eager.hash(), view.hash());
+}
+
+/**
+ * @given a proposal view over a transport
+ * @when the transactions are materialized
+ * @then they match the ones of the eagerly built proposal wrapper
+ */
+TEST(ProposalViewTest, MaterializedTransactionsMatchTheEagerWrapper) {
+  proto::Proposal eager(makeTestProposal());
+  proto::ProposalView view(makeTestProposal());
+
+  EXPECT_EQ(eager.transactions(), view.transactions());
+  EXPECT_EQ(eager, view);
+}
@@ -524,3 +524,35 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateBlockQueryResponseWithError) {
     ASSERT_EQ(error_resp.message(), kErrorMsg);
   });
 }
+
+/**
+ * Checks that responses built on pooled arenas stay independent
+ * @given several responses created and destroyed in interleaved order
+ * @then surviving responses keep their contents intact after the arenas of
+ * the destroyed ones have been recycled and reused
+ */
+TEST_F(ProtoQueryResponseFactoryTest, PooledResponsesAreIndependent) {
+  const HashType kQueryHash{"my_super_hash"};
+
+  constexpr size_t kResponses = 100;
+  std::vector<std::unique_ptr<shared_model::interface::QueryResponse>> kept;
+  for (size_t i = 0; i < kResponses; ++i) {
+    auto response = response_factory->createRolesResponse(
+        {"role_" + std::to_string(i)}, kQueryHash);
+    if (i % 2 == 0) {
+      kept.push_back(std::move(response));
+    }
+    // odd responses are destroyed here, returning their arenas to the pool
+  }
+
+  for (size_t i = 0; i < kept.size(); ++i) {
+    ASSERT_EQ(kept[i]->queryHash(), kQueryHash);
+    ASSERT_NO_THROW({
+      const auto &response =
+          boost::get<const shared_model::interface::RolesResponse &>(
+              kept[i]->get());
+      ASSERT_EQ(response.roles(),
+                std::vector<RoleIdType>{"role_" + std::to_string(2 * i)});
+    });
+  }
+}
@@ -0,0 +1,50 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/block.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace shared_model::proto;
+
+/**
+ * @given a proto block and its clone
+ * @when the canonical serialized form of both is requested
+ * @then the clone shares the blob of the source instead of re-serializing
+ */
+TEST(SharedProtoBlockTest, CloneSharesCanonicalBlob) {
+  iroha::protocol::Block_v1 proto;
+  proto.mutable_payload()->set_height(7);
+  Block block{proto};
+
+  std::unique_ptr<shared_model::interface::Block> copy = clone(block);
+
+  ASSERT_EQ(block.blob(), copy->blob());
+  ASSERT_EQ(block.hash(), copy->hash());
+  // one canonical byte buffer, not an equal copy
+  ASSERT_EQ(&block.blob(), &copy->blob());
+}
+
+/**
+ * @given a proto block and its clone
+ * @when a signature is added to the clone
+ * @then the blob of the source block stays untouched
+ */
+TEST(SharedProtoBlockTest, CloneBlobDivergesOnNewSignature) {
+  using namespace std::literals;
+  iroha::protocol::Block_v1 proto;
+  proto.mutable_payload()->set_height(7);
+  Block block{proto};
+
+  std::unique_ptr<shared_model::interface::Block> copy = clone(block);
+  copy->addSignature(
+      shared_model::interface::types::SignedHexStringView{"0A"sv},
+      shared_model::interface::types::PublicKeyHexStringView{"0B"sv});
+
+  ASSERT_NE(block.blob(), copy->blob());
+  // the payload is not affected by signing
+  ASSERT_EQ(block.hash(), copy->hash());
+  ASSERT_TRUE(block.signatures().empty());
+}
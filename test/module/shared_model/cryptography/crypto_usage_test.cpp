@@ -126,6 +126,33 @@ TYPED_TEST(CryptoUsageTest, RawSignAndVerifyTest) {
   IROHA_ASSERT_RESULT_VALUE(verified);
 }
 
+/**
+ * @given a payload signed with _concrete_ algorithm
+ * @when the same signature is verified repeatedly
+ *       @and then a corrupted signature over the same payload and key
+ * @then the repeated checks succeed and the corrupted one is rejected
+ */
+TYPED_TEST(CryptoUsageTest, RepeatedVerifyIsConsistent) {
+  auto signature_hex = CryptoSigner::sign(this->data, this->keypair);
+  using namespace shared_model::interface::types;
+  for (int i = 0; i < 3; ++i) {
+    auto verified = CryptoVerifier::verify(
+        SignedHexStringView{signature_hex},
+        this->data,
+        PublicKeyHexStringView{this->keypair.publicKey()});
+    IROHA_ASSERT_RESULT_VALUE(verified);
+  }
+  // corrupt one byte of the signature; any verification result cache must
+  // key on the signature bytes, not only on the payload and the key
+  auto bad_signature_hex = signature_hex;
+  bad_signature_hex[1] = bad_signature_hex[1] == '0' ? '1' : '0';
+  auto bad_verified = CryptoVerifier::verify(
+      SignedHexStringView{bad_signature_hex},
+      this->data,
+      PublicKeyHexStringView{this->keypair.publicKey()});
+  IROHA_ASSERT_RESULT_ERROR(bad_verified);
+}
+
 /**
  * @given unsigned block
  * @when verify block
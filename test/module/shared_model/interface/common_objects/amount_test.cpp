@@ -48,6 +48,24 @@ TEST_F(AmountTest, Strange) {
   checkValid(Amount{"1.00000"}, 1, 5, "1.00000");
 }
 
+TEST_F(AmountTest, WideValues) {
+  // values around the boundary where the digits stop fitting into one
+  // machine word and the multiprecision parser takes over
+  checkValid(Amount{"9999999999999999999"}, 1, 0, "9999999999999999999");
+  checkValid(Amount{"18446744073709551616"}, 1, 0, "18446744073709551616");
+  checkValid(Amount{"12345678901234567890123456789012.345"},
+             1,
+             3,
+             "12345678901234567890123456789012.345");
+  checkValid(Amount{"000012345678901234567890.12345"},
+             1,
+             5,
+             "12345678901234567890.12345");
+  EXPECT_TRUE(Amount{"18446744073709551616"}
+              == Amount{"18446744073709551616"});
+  EXPECT_FALSE(Amount{"1.50"} == Amount{"1.5"});
+}
+
 TEST_F(AmountTest, Invalid) {
   checkInvalid(Amount{"-100"});
   checkInvalid(Amount{"-1.23"});
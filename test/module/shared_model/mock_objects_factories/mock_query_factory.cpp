@@ -170,6 +170,8 @@ MockQueryFactory::constructTxPaginationMeta(
       [&page_size, &first_tx_hash](MockTxPaginationMeta &mock) {
         EXPECT_CALL(mock, pageSize()).WillRepeatedly(Return(page_size));
         EXPECT_CALL(mock, firstTxHash()).WillRepeatedly(Return(first_tx_hash));
+        EXPECT_CALL(mock, firstTxTime()).WillRepeatedly(Return(std::nullopt));
+        EXPECT_CALL(mock, lastTxTime()).WillRepeatedly(Return(std::nullopt));
       });
 }
 
@@ -173,3 +173,38 @@ TEST_F(BlockValidatorTest, DuplicateTransactionsInBlock) {
   ASSERT_TRUE(error);
   ASSERT_THAT(error->toString(), testing::HasSubstr("Duplicates transaction"));
 }
+
+/**
+ * @given certified block validator @and block with a stateless invalid
+ * transaction
+ * @when block is validated
+ * @then result is OK, since per-transaction checks are left to the
+ * supermajority certificate
+ */
+TEST_F(BlockValidatorTest, CertifiedValidatorSkipsTransactionChecks) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(generateTx(false));
+  auto block = generateBlock(txs, std::vector<shared_model::crypto::Hash>{});
+
+  CertifiedBlockValidator certified_validator(
+      iroha::test::kTestsValidatorsConfig);
+  ASSERT_EQ(certified_validator.validate(block), std::nullopt);
+}
+
+/**
+ * @given certified block validator @and block with duplicate rejected hashes
+ * @when block is validated
+ * @then error appears, since block-level checks are kept
+ */
+TEST_F(BlockValidatorTest, CertifiedValidatorKeepsBlockChecks) {
+  std::vector<shared_model::proto::Transaction> txs;
+  std::vector<shared_model::crypto::Hash> rejected_hashes;
+  shared_model::proto::Transaction tx = generateTx(true);
+  rejected_hashes.push_back(tx.hash());
+  rejected_hashes.push_back(tx.hash());
+  auto invalid_block = generateBlock(txs, rejected_hashes);
+
+  CertifiedBlockValidator certified_validator(
+      iroha::test::kTestsValidatorsConfig);
+  ASSERT_TRUE(certified_validator.validate(invalid_block));
+}
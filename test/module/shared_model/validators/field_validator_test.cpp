@@ -18,6 +18,7 @@
 
 #include "backend/protobuf/batch_meta.hpp"
 #include "backend/protobuf/common_objects/peer.hpp"
+#include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/permissions.hpp"
 #include "backend/protobuf/queries/proto_query_payload_meta.hpp"
 #include "backend/protobuf/queries/proto_tx_pagination_meta.hpp"
@@ -896,3 +897,36 @@ TEST_F(FieldValidatorTest, QueryContainerFieldsValidation) {
       },
       [] {});
 }
+
+/**
+ * @given a payload with one valid signature attached twice
+ *        @and one corrupted signature of the same key
+ * @when  the signatures are validated
+ * @then  only the corrupted signature is reported
+ */
+TEST_F(FieldValidatorTest, DuplicateSignaturePairsValidation) {
+  using namespace shared_model::crypto;
+  auto keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  Blob payload{"payload"};
+  auto signed_hex = DefaultCryptoAlgorithmType::sign(payload, keypair);
+
+  iroha::protocol::Signature good;
+  good.set_public_key(keypair.publicKey());
+  good.set_signature(signed_hex);
+  auto bad_hex = signed_hex;
+  bad_hex[0] = bad_hex[0] == '0' ? '1' : '0';
+  iroha::protocol::Signature bad;
+  bad.set_public_key(keypair.publicKey());
+  bad.set_signature(bad_hex);
+
+  // identical pairs are verified once and share the verification result
+  std::vector<proto::Signature> signatures{proto::Signature{good},
+                                           proto::Signature{good},
+                                           proto::Signature{bad}};
+  validation::FieldValidator validator(iroha::test::kTestsValidatorsConfig);
+  auto error = validator.validateSignatures(signatures, payload);
+  ASSERT_TRUE(error);
+  EXPECT_THAT(error->toString(), ::testing::HasSubstr("Signature #3"));
+  EXPECT_THAT(error->toString(),
+              ::testing::Not(::testing::HasSubstr("Signature #1")));
+}